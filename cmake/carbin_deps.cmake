@@ -20,6 +20,10 @@ if (CARBIN_BUILD_TEST)
     include(require_gmock)
 endif (CARBIN_BUILD_TEST)
 
+if (CARBIN_BUILD_BENCHMARK)
+    include(require_benchmark)
+endif (CARBIN_BUILD_BENCHMARK)
+
 set(CARBIN_SYSTEM_DYLINK)
 if (APPLE)
     find_library(CoreFoundation CoreFoundation)
@@ -0,0 +1,154 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+// Throughput of the maximum matching segmenters against MPSegment and
+// MixSegment, with the F1 of their word boundaries against MixSegment as
+// the price in quality.
+//
+// The dictionaries are read from $LIBTEXT_JIEBA_DICT, default
+// ../dict/jieba.dict.utf8, and $LIBTEXT_HMM_MODEL, default
+// ../dict/hmm_model.utf8, and the text from $LIBTEXT_BENCH_TEXT, default
+// ../test/testdata/review.100, one sentence per line.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "libtext/jieba/max_match_seg.h"
+#include "libtext/jieba/mix_seg.h"
+#include "libtext/jieba/mps_seg.h"
+
+namespace libtext {
+
+namespace {
+
+std::string EnvOr(const char *name, const char *fallback) {
+  const char *value = std::getenv(name);
+  return value != nullptr ? value : fallback;
+}
+
+struct Corpus {
+  std::unique_ptr<DictTrie> trie;
+  std::unique_ptr<HMMModel> model;
+  std::vector<std::string> lines;
+  size_t bytes = 0;
+  // the byte offsets of the word ends of MixSegment, per line
+  std::vector<std::set<size_t>> reference;
+};
+
+std::set<size_t> WordEnds(const std::vector<Word> &words) {
+  std::set<size_t> ends;
+  for (const Word &w : words) {
+    ends.insert(w.offset + w.word.size());
+  }
+  return ends;
+}
+
+const Corpus &GetCorpus() {
+  static const Corpus corpus = [] {
+    Corpus c;
+    c.trie.reset(
+        new DictTrie(EnvOr("LIBTEXT_JIEBA_DICT", "../dict/jieba.dict.utf8")));
+    c.model.reset(
+        new HMMModel(EnvOr("LIBTEXT_HMM_MODEL", "../dict/hmm_model.utf8")));
+    std::ifstream in(EnvOr("LIBTEXT_BENCH_TEXT", "../test/testdata/review.100"));
+    std::string line;
+    MixSegment mix(c.trie.get(), c.model.get());
+    std::vector<Word> words;
+    while (std::getline(in, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      mix.Cut(line, words);
+      c.reference.push_back(WordEnds(words));
+      c.bytes += line.size();
+      c.lines.push_back(std::move(line));
+    }
+    return c;
+  }();
+  return corpus;
+}
+
+// Cuts every line of the corpus with segment, and reports the boundary F1
+// against MixSegment.
+template <typename Segment>
+void RunCut(benchmark::State &state, const Corpus &corpus,
+            const Segment &segment) {
+  if (corpus.lines.empty()) {
+    state.SkipWithError("missing text");
+    return;
+  }
+  std::vector<Word> words;
+  for (auto _ : state) {
+    for (const std::string &line : corpus.lines) {
+      segment.Cut(line, words);
+      benchmark::DoNotOptimize(words.data());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * corpus.bytes);
+
+  size_t matched = 0;
+  size_t predicted = 0;
+  size_t expected = 0;
+  for (size_t i = 0; i < corpus.lines.size(); ++i) {
+    segment.Cut(corpus.lines[i], words);
+    const std::set<size_t> ends = WordEnds(words);
+    for (size_t end : ends) {
+      matched += corpus.reference[i].count(end);
+    }
+    predicted += ends.size();
+    expected += corpus.reference[i].size();
+  }
+  state.counters["f1"] = 2.0 * matched / (predicted + expected);
+}
+
+void BM_MixSegment(benchmark::State &state) {
+  const Corpus &corpus = GetCorpus();
+  MixSegment segment(corpus.trie.get(), corpus.model.get());
+  RunCut(state, corpus, segment);
+}
+
+void BM_MPSegment(benchmark::State &state) {
+  const Corpus &corpus = GetCorpus();
+  MPSegment segment(corpus.trie.get());
+  RunCut(state, corpus, segment);
+}
+
+void BM_MaxMatchSegment(benchmark::State &state) {
+  static const char *const kModes[] = {"forward", "backward", "bidirectional"};
+  const Corpus &corpus = GetCorpus();
+  MaxMatchSegment segment(
+      corpus.trie.get(), static_cast<MaxMatchSegment::Mode>(state.range(0)));
+  state.SetLabel(kModes[state.range(0)]);
+  RunCut(state, corpus, segment);
+}
+
+}  // namespace
+
+BENCHMARK(BM_MixSegment);
+BENCHMARK(BM_MPSegment);
+// Arg is the MaxMatchSegment::Mode.
+BENCHMARK(BM_MaxMatchSegment)
+    ->Arg(MaxMatchSegment::MaxMatchForward)
+    ->Arg(MaxMatchSegment::MaxMatchBackward)
+    ->Arg(MaxMatchSegment::MaxMatchBidirectional);
+
+}  // namespace libtext
@@ -0,0 +1,173 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+// Memory and lookup throughput of the PrefixMap trie backends on the emoji
+// tables and on the jieba dictionary.
+//
+// The dictionary is read from $LIBTEXT_JIEBA_DICT, default
+// ../dict/jieba.dict.utf8, and the text from $LIBTEXT_BENCH_TEXT, default
+// ../test/testdata/weicheng.utf8.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "libtext/common/cedarpp_backend.h"
+#include "libtext/common/prefix_map.h"
+
+namespace libtext {
+
+extern const char* const UNICODE_EMOJI_EN[][2];
+extern const char* const UNICODE_EMOJI_ALIAS_EN[][2];
+
+namespace {
+
+std::string EnvOr(const char *name, const char *fallback) {
+  const char *value = std::getenv(name);
+  return value != nullptr ? value : fallback;
+}
+
+std::string ReadFile(const std::string &path) {
+  std::ifstream in(path);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+struct Corpus {
+  std::map<turbo::inlined_string, int> dic;
+  std::string text;
+  // every character start of `text`, as the segmenters probe it
+  std::vector<std::string_view> queries;
+
+  void SetText(std::string t) {
+    text = std::move(t);
+    for (size_t i = 0; i < text.size(); ++i) {
+      if ((static_cast<unsigned char>(text[i]) & 0xc0) != 0x80) {
+        queries.emplace_back(text.data() + i, text.size() - i);
+      }
+    }
+  }
+};
+
+const Corpus &EmojiCorpus() {
+  static const Corpus corpus = [] {
+    Corpus c;
+    std::string text;
+    for (auto table : {UNICODE_EMOJI_EN, UNICODE_EMOJI_ALIAS_EN}) {
+      for (size_t i = 0; table[i][0] != nullptr; ++i) {
+        c.dic.emplace(table[i][0], static_cast<int>(c.dic.size()));
+        c.dic.emplace(table[i][1], static_cast<int>(c.dic.size()));
+        if (i % 16 == 0) {
+          text.append("some text ").append(table[i][1]).append(table[i][0]);
+        }
+      }
+    }
+    c.SetText(std::move(text));
+    return c;
+  }();
+  return corpus;
+}
+
+const Corpus &JiebaCorpus() {
+  static const Corpus corpus = [] {
+    Corpus c;
+    std::ifstream in(EnvOr("LIBTEXT_JIEBA_DICT", "../dict/jieba.dict.utf8"));
+    std::string line;
+    while (std::getline(in, line)) {
+      std::string word = line.substr(0, line.find(' '));
+      if (!word.empty()) {
+        c.dic.emplace(word, static_cast<int>(c.dic.size()));
+      }
+    }
+    c.SetText(ReadFile(
+        EnvOr("LIBTEXT_BENCH_TEXT", "../test/testdata/weicheng.utf8")));
+    return c;
+  }();
+  return corpus;
+}
+
+const Corpus &GetCorpus(benchmark::State &state) {
+  const Corpus &corpus = state.range(0) == 0 ? EmojiCorpus() : JiebaCorpus();
+  state.SetLabel(state.range(0) == 0 ? "emoji" : "jieba");
+  if (corpus.dic.empty() || corpus.queries.empty()) {
+    state.SkipWithError("missing dictionary or text");
+  }
+  return corpus;
+}
+
+template <typename Backend>
+void BM_Build(benchmark::State &state) {
+  const Corpus &corpus = GetCorpus(state);
+  size_t memory = 0;
+  for (auto _ : state) {
+    BasicPrefixMap<Backend> map(corpus.dic);
+    memory = map.MemoryUsage();
+    benchmark::DoNotOptimize(memory);
+  }
+  state.counters["keys"] = static_cast<double>(corpus.dic.size());
+  state.counters["memory"] = static_cast<double>(memory);
+}
+
+template <typename Backend>
+void BM_PrefixSearch(benchmark::State &state) {
+  const Corpus &corpus = GetCorpus(state);
+  BasicPrefixMap<Backend> map(corpus.dic);
+  for (auto _ : state) {
+    size_t total = 0;
+    for (const auto &q : corpus.queries) {
+      int val;
+      total += map.PrefixSearch(q.data(), q.size(), &val);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * corpus.queries.size());
+  state.SetBytesProcessed(state.iterations() * corpus.text.size());
+  state.counters["memory"] = static_cast<double>(map.MemoryUsage());
+}
+
+template <typename Backend>
+void BM_BatchPrefixSearch(benchmark::State &state) {
+  const Corpus &corpus = GetCorpus(state);
+  BasicPrefixMap<Backend> map(corpus.dic);
+  std::vector<size_t> lens(corpus.queries.size());
+  std::vector<int> vals(corpus.queries.size());
+  for (auto _ : state) {
+    map.PrefixSearch(corpus.queries.data(), corpus.queries.size(),
+                     lens.data(), vals.data());
+    benchmark::DoNotOptimize(lens.data());
+  }
+  state.SetItemsProcessed(state.iterations() * corpus.queries.size());
+  state.SetBytesProcessed(state.iterations() * corpus.text.size());
+}
+
+}  // namespace
+
+// Arg 0 is the emoji tables, arg 1 the jieba dictionary.
+BENCHMARK_TEMPLATE(BM_Build, CedarBackend)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_Build, CedarppBackend)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_PrefixSearch, CedarBackend)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_PrefixSearch, CedarppBackend)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_BatchPrefixSearch, CedarBackend)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_BatchPrefixSearch, CedarppBackend)->Arg(0)->Arg(1);
+
+}  // namespace libtext
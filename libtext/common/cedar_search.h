@@ -0,0 +1,68 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_COMMON_CEDAR_SEARCH_H_
+#define LIBTEXT_COMMON_CEDAR_SEARCH_H_
+
+#include <cstddef>
+
+#include "libtext/common/double_array.h"
+
+namespace libtext {
+
+// Finds the longest key of `trie` which is a prefix of `w[0, w_len)`.
+// Walks the trie one byte at a time with cedar's traverse and remembers the
+// last node that holds a value, so unlike commonPrefixSearch there is no
+// result buffer and no cap on the number of shorter matches.
+// Returns the byte length of the key and stores its value in `val`, or
+// returns 0 if no key matches. `Pos` is the node position type of the
+// trie's traverse, cedarpp packs its tail offset into it.
+template <typename Trie, typename Pos = size_t>
+size_t CedarLongestPrefix(const Trie &trie, const char *w, size_t w_len,
+                          int *val) {
+  Pos from = 0;
+  size_t mblen = 0;
+  for (size_t pos = 0; pos < w_len;) {
+    // label 0 is reserved for the value slots
+    if (w[pos] == 0) {
+      break;
+    }
+    const int v = trie.traverse(w, from, pos, pos + 1);
+    if (v == Trie::CEDAR_NO_PATH) {
+      break;
+    }
+    if (v != Trie::CEDAR_NO_VALUE) {
+      mblen = pos;
+      if (val) {
+        *val = v;
+      }
+    }
+  }
+  return mblen;
+}
+
+// Returns a view of the units of `trie`. cedar::da<int> keeps its nodes as
+// {base, check} pairs, which is the layout DoubleArrayView reads.
+template <typename Trie>
+DoubleArrayView CedarView(const Trie &trie) {
+  static_assert(sizeof(typename Trie::node) == sizeof(DoubleArrayUnit),
+                "unexpected cedar node layout");
+  return DoubleArrayView(static_cast<const DoubleArrayUnit *>(trie.array()),
+                         trie.size());
+}
+
+} // namespace libtext
+
+#endif // LIBTEXT_COMMON_CEDAR_SEARCH_H_
@@ -0,0 +1,73 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef LIBTEXT_COMMON_CEDARPP_BACKEND_H_
+#define LIBTEXT_COMMON_CEDARPP_BACKEND_H_
+
+#include <cstddef>
+#include <string_view>
+
+// the vendored cedarpp.h does not build warning-free with -Wall
+#if defined(__GNUC__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmisleading-indentation"
+#endif
+#include "libtext/common/cedarpp.h"
+#if defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
+
+#include "libtext/common/cedar_search.h"
+#include "libtext/common/prefix_map.h"
+#include "libtext/common/prefix_matcher.h"
+
+namespace libtext {
+
+// cedarpp::da, the double array with tail compression. Keys are only
+// branched as far as they differ and the rest is kept as a string, which
+// makes large key sets with long unique suffixes much smaller. Kept out of
+// trie_backend.h so that only its users include cedarpp.h.
+struct CedarppBackend {
+  typedef cedarpp::da<int> trie_type;
+  static constexpr bool kMappable = false;
+
+  static size_t PrefixSearch(const trie_type &trie, const char *w,
+                             size_t w_len, int *val) {
+    return CedarLongestPrefix<trie_type, cedarpp::npos_t>(trie, w, w_len, val);
+  }
+
+  static void PrefixSearch(const trie_type &trie,
+                           const std::string_view *queries, size_t num,
+                           size_t *lens, int *vals) {
+    for (size_t i = 0; i < num; ++i) {
+      lens[i] = PrefixSearch(trie, queries[i].data(), queries[i].size(),
+                             vals ? vals + i : nullptr);
+    }
+  }
+
+  static size_t MemoryUsage(const trie_type &trie) {
+    return trie.capacity() *
+               (sizeof(trie_type::node) + sizeof(trie_type::ninfo)) +
+           (trie.capacity() >> 8) * sizeof(trie_type::block) + trie.length();
+  }
+};
+
+extern template class BasicPrefixMap<CedarppBackend>;
+extern template class BasicPrefixMatcher<CedarppBackend>;
+
+} // namespace libtext
+
+#endif // LIBTEXT_COMMON_CEDARPP_BACKEND_H_
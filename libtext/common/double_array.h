@@ -0,0 +1,189 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_COMMON_DOUBLE_ARRAY_H_
+#define LIBTEXT_COMMON_DOUBLE_ARRAY_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace libtext {
+
+// One unit of a cedar::da<int> double array built without USE_REDUCED_TRIE.
+// The child of node `from` labelled `c` is `base ^ c` if its `check` is
+// `from`; a key ending at `from` keeps its value in the `base` of the child
+// labelled 0. Free units have a negative `check`.
+struct DoubleArrayUnit {
+  int32_t base;
+  int32_t check;
+};
+
+// Read-only view of a double array owned by someone else, e.g. a static
+// table generated at build time or a cedar trie. Copying the view is free.
+class DoubleArrayView {
+public:
+  constexpr DoubleArrayView() : units_(nullptr), size_(0) {}
+  constexpr DoubleArrayView(const DoubleArrayUnit *units, size_t size)
+      : units_(units), size_(size) {}
+
+  bool empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+  const DoubleArrayUnit *units() const { return units_; }
+
+  // Checks that every search stays inside the array, i.e. that every unit
+  // in use has an in-range parent and that every inner node has all of its
+  // 256 possible children in range. Meant for arrays read from a file.
+  bool Validate() const {
+    for (size_t i = 0; i < size_; ++i) {
+      const DoubleArrayUnit &u = units_[i];
+      if (i != 0 && u.check < 0) {
+        continue; // free
+      }
+      if (i != 0 && static_cast<size_t>(u.check) >= size_) {
+        return false;
+      }
+      if (i != 0 && (static_cast<size_t>(units_[u.check].base) ^ i) == 0) {
+        continue; // value slot, its base is the value
+      }
+      if (u.base < 0 || (static_cast<size_t>(u.base) | 0xff) >= size_) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Finds the longest key which is a prefix of `w`.
+  // Returns the UTF8 byte length of matched key and stores its value in
+  // `val`. If no key is found, return 0.
+  size_t PrefixSearch(const char *w, size_t w_len, int *val) const {
+    if (size_ == 0) {
+      return 0;
+    }
+    size_t from = 0;
+    size_t mblen = 0;
+    for (size_t pos = 0; pos < w_len;) {
+      const unsigned char c = static_cast<unsigned char>(w[pos]);
+      // label 0 is reserved for the value slots
+      if (c == 0) {
+        break;
+      }
+      const size_t to = static_cast<size_t>(units_[from].base) ^ c;
+      if (units_[to].check != static_cast<int32_t>(from)) {
+        break;
+      }
+      from = to;
+      ++pos;
+      const DoubleArrayUnit &leaf = units_[units_[from].base];
+      if (leaf.check == static_cast<int32_t>(from)) {
+        mblen = pos;
+        if (val) {
+          *val = leaf.base;
+        }
+      }
+    }
+    return mblen;
+  }
+
+  // Runs PrefixSearch for each of `num` queries and stores the results in
+  // `lens[i]` and `vals[i]`; `vals` may be null and its entries are left
+  // untouched for queries without a match. Up to kBatchSize walks advance
+  // in turn and prefetch the units of their next step, so the cache misses
+  // of different queries overlap instead of stalling one after another.
+  // This pays off for tries that do not fit in cache; for small or hot
+  // tries the bookkeeping makes it slower than one search per query.
+  void PrefixSearch(const std::string_view *queries, size_t num, size_t *lens,
+                    int *vals) const {
+    for (size_t i = 0; i < num; ++i) {
+      lens[i] = 0;
+    }
+    if (size_ == 0) {
+      return;
+    }
+    for (size_t first = 0; first < num; first += kBatchSize) {
+      const size_t batch =
+          num - first < kBatchSize ? num - first : kBatchSize;
+      Walk walks[kBatchSize];
+      for (size_t i = 0; i < batch; ++i) {
+        const std::string_view &w = queries[first + i];
+        walks[i].begin = reinterpret_cast<const unsigned char *>(w.data());
+        walks[i].p = walks[i].begin;
+        walks[i].end = walks[i].begin + w.size();
+        walks[i].from = 0;
+        walks[i].index = first + i;
+      }
+      size_t active = batch;
+      while (active > 0) {
+        for (size_t k = 0; k < active;) {
+          Walk &w = walks[k];
+          const size_t from = w.from;
+          const DoubleArrayUnit node = units_[from];
+          if (from != 0) {
+            const DoubleArrayUnit leaf = units_[node.base];
+            if (leaf.check == static_cast<int32_t>(from)) {
+              lens[w.index] = static_cast<size_t>(w.p - w.begin);
+              if (vals) {
+                vals[w.index] = leaf.base;
+              }
+            }
+          }
+          unsigned char c;
+          size_t to;
+          if (w.p == w.end || (c = *w.p) == 0 ||
+              units_[to = static_cast<size_t>(node.base) ^ c].check !=
+                  static_cast<int32_t>(from)) {
+            // the walk is over, the last active one takes its slot
+            w = walks[--active];
+            continue;
+          }
+          w.from = to;
+          ++w.p;
+          const size_t base = static_cast<size_t>(units_[to].base);
+          Prefetch(units_ + base);
+          if (w.p != w.end) {
+            Prefetch(units_ + (base ^ *w.p));
+          }
+          ++k;
+        }
+      }
+    }
+  }
+
+private:
+  static constexpr size_t kBatchSize = 8;
+
+  struct Walk {
+    const unsigned char *begin;
+    const unsigned char *p;
+    const unsigned char *end;
+    size_t from;
+    size_t index;
+  };
+
+  static void Prefetch(const DoubleArrayUnit *p) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(p);
+#else
+    (void)p;
+#endif
+  }
+
+  const DoubleArrayUnit *units_;
+  size_t size_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_COMMON_DOUBLE_ARRAY_H_
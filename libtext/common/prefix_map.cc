@@ -14,12 +14,18 @@
 //
 
 #include "libtext/common/prefix_map.h"
+#include "libtext/common/cedarpp_backend.h"
+
+#include <algorithm>
+
 #include "turbo/log/logging.h"
 
 namespace libtext {
 
-PrefixMap::PrefixMap(const std::map<turbo::inlined_string, int> &dic) {
-  trie_ = std::make_unique<cedar_t>();
+template <typename Backend>
+BasicPrefixMap<Backend>::BasicPrefixMap(
+    const std::map<turbo::inlined_string, int> &dic) {
+  trie_ = std::make_unique<trie_t>();
   if (dic.empty())
     return;
   std::vector<const char *> key;
@@ -38,28 +44,64 @@ PrefixMap::PrefixMap(const std::map<turbo::inlined_string, int> &dic) {
   TURBO_CHECK_EQ(rc, 0) << "build trie failed!!!";
 }
 
-size_t PrefixMap::PrefixSearch(const char *w, size_t w_len, int *val) const {
+template <typename Backend>
+size_t BasicPrefixMap<Backend>::PrefixSearch(const char *w, size_t w_len,
+                                             int *val) const {
   if (trie_ == nullptr) {
     return 0;
   }
-  constexpr int kResultSize = 64;
-  cedar_t::result_pair_type trie_results[kResultSize];
-  const int num_nodes =
-      trie_->commonPrefixSearch(w, trie_results, kResultSize, w_len);
+  return Backend::PrefixSearch(*trie_, w, w_len, val);
+}
 
-  if (num_nodes == 0) {
-    return 0;
+template <typename Backend>
+void BasicPrefixMap<Backend>::PrefixSearch(const std::string_view *queries,
+                                           size_t num, size_t *lens,
+                                           int *vals) const {
+  if (trie_ == nullptr) {
+    std::fill(lens, lens + num, 0);
+    return;
   }
-  size_t mblen = 0;
-  for (int i = 0; i < num_nodes; ++i) {
-    if (mblen < (int64_t)trie_results[i].length) {
-      mblen = trie_results[i].length;
-      if (val) {
-        *val = trie_results[i].value;
-      }
+  Backend::PrefixSearch(*trie_, queries, num, lens, vals);
+}
+
+template <typename Backend>
+size_t BasicPrefixMap<Backend>::MemoryUsage() const {
+  return trie_ ? Backend::MemoryUsage(*trie_) : 0;
+}
+
+template <typename Backend>
+bool BasicPrefixMap<Backend>::Save(const std::string &path) const {
+  if constexpr (Backend::kMappable) {
+    return TrieFile::Save(path, kPrefixMapTrie,
+                          trie_ ? Backend::View(*trie_) : DoubleArrayView());
+  } else {
+    TURBO_LOG(ERROR) << "the trie backend can not be saved";
+    return false;
+  }
+}
+
+template <typename Backend>
+std::unique_ptr<BasicPrefixMap<Backend>>
+BasicPrefixMap<Backend>::Open(const std::string &path) {
+  if constexpr (Backend::kMappable) {
+    auto file = std::make_unique<TrieFile>();
+    if (!file->Open(path, kPrefixMapTrie)) {
+      return nullptr;
+    }
+    std::unique_ptr<BasicPrefixMap> result(new BasicPrefixMap());
+    if (!file->units().empty()) {
+      result->trie_ = std::make_unique<trie_t>();
+      Backend::Attach(file->units(), result->trie_.get());
     }
+    result->file_ = std::move(file);
+    return result;
+  } else {
+    TURBO_LOG(ERROR) << "the trie backend can not be mapped";
+    return nullptr;
   }
-  return mblen;
 }
 
+template class BasicPrefixMap<CedarBackend>;
+template class BasicPrefixMap<CedarppBackend>;
+
 } // namespace libtext
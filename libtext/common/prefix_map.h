@@ -19,23 +19,33 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <string>
+#include <string_view>
 #include <vector>
 
-#include "libtext/common/cedar.h"
+#include "libtext/common/trie_backend.h"
+#include "libtext/common/trie_file.h"
 #include "turbo/strings/inlined_string.h"
 
 namespace libtext {
 
 // Given a list of strings, finds the longest string which is a
-// prefix of a query.
-class PrefixMap {
-#if defined(USE_CEDAR_UNORDERED)
-  typedef cedar::da<int, -1, -2, false> cedar_t;
-#else
-  typedef cedar::da<int> cedar_t;
-#endif
+// prefix of a query. `Backend` is the trie implementation, see
+// trie_backend.h.
+template <typename Backend = CedarBackend>
+class BasicPrefixMap {
+  typedef typename Backend::trie_type trie_t;
  public:
-  explicit PrefixMap(const std::map<turbo::inlined_string, int>& dic);
+  explicit BasicPrefixMap(const std::map<turbo::inlined_string, int>& dic);
+
+  // Saves the trie so that it can be loaded with Open instead of being
+  // rebuilt. Returns false if the file can not be written or the backend
+  // is not mappable.
+  bool Save(const std::string& path) const;
+
+  // Maps a trie saved by Save read-only, without copying it.
+  // Returns nullptr if the file is missing or invalid.
+  static std::unique_ptr<BasicPrefixMap> Open(const std::string& path);
 
   // Finds the longest string in dic, which is a prefix of `w`.
   // Returns the UTF8 byte length of matched string.
@@ -43,9 +53,25 @@ class PrefixMap {
   // If no entry is found, return 0.
   size_t PrefixSearch(const char* w, size_t w_len, int* val) const;
 
+  // Batched PrefixSearch: stores the match length of `queries[i]` in
+  // `lens[i]` and its value in `vals[i]` (if `vals` is not null). The walks
+  // are interleaved so that their memory accesses overlap.
+  void PrefixSearch(const std::string_view* queries, size_t num, size_t* lens,
+                    int* vals = nullptr) const;
+
+  // Bytes held by the trie.
+  size_t MemoryUsage() const;
+
  private:
-  std::unique_ptr<cedar_t> trie_;
+  BasicPrefixMap() = default;
+
+  std::unique_ptr<TrieFile> file_;
+  std::unique_ptr<trie_t> trie_;
 };
 
+typedef BasicPrefixMap<> PrefixMap;
+
+extern template class BasicPrefixMap<CedarBackend>;
+
 }  // namespace libtext
 #endif  // LIBTEXT_COMMON_PREFIX_MAP_H_
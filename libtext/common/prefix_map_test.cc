@@ -0,0 +1,151 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include <gtest/gtest.h>
+#include <libtext/common/cedarpp_backend.h>
+#include <libtext/common/prefix_map.h>
+#include <libtext/common/prefix_matcher.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace libtext {
+
+TEST(PrefixMap, PrefixSearch) {
+  std::map<turbo::inlined_string, int> dic{
+      {"a", 1}, {"ab", 2}, {"abcd", 4}, {"b", 5}};
+  PrefixMap pm(dic);
+  int val = -1;
+  ASSERT_EQ(pm.PrefixSearch("abc", 3, &val), 2);
+  ASSERT_EQ(val, 2);
+  ASSERT_EQ(pm.PrefixSearch("abcde", 5, &val), 4);
+  ASSERT_EQ(val, 4);
+  val = -1;
+  ASSERT_EQ(pm.PrefixSearch("c", 1, &val), 0);
+  ASSERT_EQ(val, -1);
+  // the length bounds the search
+  ASSERT_EQ(pm.PrefixSearch("abcd", 1, &val), 1);
+  ASSERT_EQ(val, 1);
+}
+
+TEST(PrefixMap, BatchPrefixSearch) {
+  std::map<turbo::inlined_string, int> dic;
+  for (int i = 1; i <= 100; ++i) {
+    dic[turbo::inlined_string(i, 'x')] = i;
+  }
+  dic["xy"] = 1000;
+  dic["y"] = 2000;
+  PrefixMap pm(dic);
+  std::vector<std::string> data{std::string(150, 'x'), "xyz", "y", "z", "",
+                                std::string(65, 'x') + "y", "xx"};
+  std::vector<std::string_view> queries(data.begin(), data.end());
+  std::vector<size_t> lens(queries.size());
+  std::vector<int> vals(queries.size(), -1);
+  pm.PrefixSearch(queries.data(), queries.size(), lens.data(), vals.data());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    int val = -1;
+    ASSERT_EQ(lens[i], pm.PrefixSearch(data[i].data(), data[i].size(), &val))
+        << i;
+    ASSERT_EQ(vals[i], val) << i;
+  }
+  ASSERT_EQ(lens[0], 100);
+  ASSERT_EQ(vals[1], 1000);
+  ASSERT_EQ(vals[3], -1);
+}
+
+TEST(PrefixMap, SaveOpen) {
+  std::map<turbo::inlined_string, int> dic{
+      {"a", 1}, {"ab", 2}, {"abcd", 4}, {"\xE4\xBD\xA0", 5}};
+  PrefixMap pm(dic);
+  const std::string path = "prefix_map_test.trie";
+  ASSERT_TRUE(pm.Save(path));
+  auto loaded = PrefixMap::Open(path);
+  ASSERT_TRUE(loaded != nullptr);
+  for (const char *w : {"abcde", "abc", "a", "b", "\xE4\xBD\xA0\xE5\xA5\xBD"}) {
+    int val = -1;
+    int loaded_val = -1;
+    ASSERT_EQ(loaded->PrefixSearch(w, strlen(w), &loaded_val),
+              pm.PrefixSearch(w, strlen(w), &val)) << w;
+    ASSERT_EQ(loaded_val, val) << w;
+  }
+
+  // a PrefixMatcher trie is rejected
+  ASSERT_TRUE(PrefixMatcher(std::set<std::string>{"a"}).Save(path));
+  ASSERT_TRUE(PrefixMap::Open(path) == nullptr);
+
+  // so are truncated and corrupted files
+  ASSERT_TRUE(pm.Save(path));
+  std::string content;
+  {
+    std::ifstream in(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(in),
+                   std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size() - 8);
+  }
+  ASSERT_TRUE(PrefixMap::Open(path) == nullptr);
+  content[content.size() / 2] ^= 0x40;
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(content.data(), content.size());
+  }
+  ASSERT_TRUE(PrefixMap::Open(path) == nullptr);
+  ASSERT_TRUE(PrefixMap::Open("no_such_file.trie") == nullptr);
+  std::remove(path.c_str());
+}
+
+TEST(PrefixMap, CedarppBackend) {
+  std::map<turbo::inlined_string, int> dic;
+  for (int i = 1; i <= 80; ++i) {
+    dic[turbo::inlined_string(i, 'x')] = i;
+  }
+  dic["xyzzy"] = 1000;
+  dic["\xE4\xBD\xA0\xE5\xA5\xBD"] = 2000;
+  dic["\xE4\xBD\xA0\xE5\xA5\xBD\xE5\x90\x97"] = 3000;
+  PrefixMap cedar(dic);
+  BasicPrefixMap<CedarppBackend> cedarpp(dic);
+  std::vector<std::string> data{
+      std::string(100, 'x'), "xyz", "xyzzy!", "xyzzz", "y", "",
+      "\xE4\xBD\xA0\xE5\xA5\xBD\xE5\x90", "\xE4\xBD\xA0\xE5\xA5\xBD\xE5\x90\x97"};
+  std::vector<std::string_view> queries(data.begin(), data.end());
+  std::vector<size_t> lens(queries.size());
+  std::vector<int> vals(queries.size(), -1);
+  cedarpp.PrefixSearch(queries.data(), queries.size(), lens.data(),
+                       vals.data());
+  for (size_t i = 0; i < data.size(); ++i) {
+    int val = -1;
+    int cedarpp_val = -1;
+    ASSERT_EQ(cedarpp.PrefixSearch(data[i].data(), data[i].size(),
+                                   &cedarpp_val),
+              cedar.PrefixSearch(data[i].data(), data[i].size(), &val))
+        << i;
+    ASSERT_EQ(cedarpp_val, val) << i;
+    ASSERT_EQ(lens[i], cedar.PrefixSearch(data[i].data(), data[i].size(),
+                                          nullptr)) << i;
+    ASSERT_EQ(vals[i], val) << i;
+  }
+  ASSERT_GT(cedarpp.MemoryUsage(), 0);
+  // only plain double arrays can be mapped
+  ASSERT_FALSE(cedarpp.Save("prefix_map_test.cedarpp"));
+}
+
+}  // namespace libtext
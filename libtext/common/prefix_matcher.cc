@@ -13,7 +13,9 @@
 // limitations under the License.
 //
 #include "libtext/common/prefix_matcher.h"
+#include "libtext/common/cedarpp_backend.h"
 
+#include <algorithm>
 #include <memory>
 #include <set>
 #include <string>
@@ -31,7 +33,9 @@ static inline constexpr size_t OneCharLen(const char *src) noexcept {
 
 }
 
-PrefixMatcher::PrefixMatcher(const std::set<std::string> &dic) {
+template <typename Backend>
+BasicPrefixMatcher<Backend>::BasicPrefixMatcher(
+    const std::set<std::string> &dic) {
   if (dic.empty())
     return;
   std::vector<const char *> key;
@@ -39,57 +43,87 @@ PrefixMatcher::PrefixMatcher(const std::set<std::string> &dic) {
   for (const auto &it : dic) {
     key.push_back(it.data());
   }
-  trie_ = std::make_unique<cedar_t>();
+  trie_ = std::make_unique<trie_t>();
   TURBO_CHECK_EQ(0, trie_->build(key.size(), const_cast<const char **>(&key[0]),
                              nullptr, nullptr));
 }
 
-size_t PrefixMatcher::PrefixMatch(const char *w, size_t w_len, bool *found) const {
-  if (trie_ == nullptr) {
-    if (found) {
-      *found = false;
-    }
-    return std::min<size_t>(w_len, OneCharLen(w));
-  }
-  constexpr size_t kResultSize = 64;
-  cedar_t::result_pair_type trie_results[kResultSize];
-  const size_t num_nodes =
-      trie_->commonPrefixSearch(w, trie_results, kResultSize, w_len);
-
+template <typename Backend>
+size_t BasicPrefixMatcher<Backend>::PrefixMatch(const char *w, size_t w_len,
+                                                bool *found) const {
+  const size_t mblen = PrefixSearch(w, w_len);
   if (found) {
-    *found = (num_nodes > 0);
+    *found = (mblen > 0);
   }
-  if (num_nodes == 0) {
+  if (mblen == 0) {
     return std::min<size_t>(w_len, OneCharLen(w));
   }
-  size_t mblen = 0;
-  for (size_t i = 0; i < num_nodes; ++i) {
-    mblen = std::max<size_t>(trie_results[i].length, mblen);
-  }
   return mblen;
 }
 
-size_t PrefixMatcher::PrefixMatch(const std::string &w, bool *found) const {
+template <typename Backend>
+size_t BasicPrefixMatcher<Backend>::PrefixMatch(const std::string &w,
+                                                bool *found) const {
   return PrefixMatch(w.data(), w.length(), found);
 }
 
-size_t PrefixMatcher::PrefixSearch(const char *w, size_t w_len) const {
+template <typename Backend>
+size_t BasicPrefixMatcher<Backend>::PrefixSearch(const char *w,
+                                                 size_t w_len) const {
   if (trie_ == nullptr) {
     return 0;
   }
-  constexpr int kResultSize = 64;
-  cedar_t::result_pair_type trie_results[kResultSize];
-  const size_t num_nodes =
-      trie_->commonPrefixSearch(w, trie_results, kResultSize, w_len);
+  return Backend::PrefixSearch(*trie_, w, w_len, nullptr);
+}
 
-  if (num_nodes == 0) {
-    return 0;
+template <typename Backend>
+void BasicPrefixMatcher<Backend>::PrefixSearch(
+    const std::string_view *queries, size_t num, size_t *lens) const {
+  if (trie_ == nullptr) {
+    std::fill(lens, lens + num, 0);
+    return;
   }
-  size_t mblen = 0;
-  for (size_t i = 0; i < num_nodes; ++i) {
-    mblen = std::max<size_t>(trie_results[i].length, mblen);
+  Backend::PrefixSearch(*trie_, queries, num, lens, nullptr);
+}
+
+template <typename Backend>
+size_t BasicPrefixMatcher<Backend>::MemoryUsage() const {
+  return trie_ ? Backend::MemoryUsage(*trie_) : 0;
+}
+
+template <typename Backend>
+bool BasicPrefixMatcher<Backend>::Save(const std::string &path) const {
+  if constexpr (Backend::kMappable) {
+    return TrieFile::Save(path, kPrefixMatcherTrie,
+                          trie_ ? Backend::View(*trie_) : DoubleArrayView());
+  } else {
+    TURBO_LOG(ERROR) << "the trie backend can not be saved";
+    return false;
+  }
+}
+
+template <typename Backend>
+std::unique_ptr<BasicPrefixMatcher<Backend>>
+BasicPrefixMatcher<Backend>::Open(const std::string &path) {
+  if constexpr (Backend::kMappable) {
+    auto file = std::make_unique<TrieFile>();
+    if (!file->Open(path, kPrefixMatcherTrie)) {
+      return nullptr;
+    }
+    std::unique_ptr<BasicPrefixMatcher> result(new BasicPrefixMatcher());
+    if (!file->units().empty()) {
+      result->trie_ = std::make_unique<trie_t>();
+      Backend::Attach(file->units(), result->trie_.get());
+    }
+    result->file_ = std::move(file);
+    return result;
+  } else {
+    TURBO_LOG(ERROR) << "the trie backend can not be mapped";
+    return nullptr;
   }
-  return mblen;
 }
 
+template class BasicPrefixMatcher<CedarBackend>;
+template class BasicPrefixMatcher<CedarppBackend>;
+
 } // namespace libtext
@@ -19,22 +19,31 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <string_view>
 
-#include "libtext/common/cedar.h"
+#include "libtext/common/trie_backend.h"
+#include "libtext/common/trie_file.h"
 #include "turbo/platform/port.h"
 
 namespace libtext {
 
 // Given a list of strings, finds the longest string which is a
-// prefix of a query.
-class PrefixMatcher {
-#if defined(USE_CEDAR_UNORDERED)
-  typedef cedar::da<int, -1, -2, false> cedar_t;
-#else
-  typedef cedar::da<int> cedar_t;
-#endif
+// prefix of a query. `Backend` is the trie implementation, see
+// trie_backend.h.
+template <typename Backend = CedarBackend>
+class BasicPrefixMatcher {
+  typedef typename Backend::trie_type trie_t;
 public:
-  explicit PrefixMatcher(const std::set<std::string> &dic);
+  explicit BasicPrefixMatcher(const std::set<std::string> &dic);
+
+  // Saves the trie so that it can be loaded with Open instead of being
+  // rebuilt. Returns false if the file can not be written or the backend
+  // is not mappable.
+  bool Save(const std::string &path) const;
+
+  // Maps a trie saved by Save read-only, without copying it.
+  // Returns nullptr if the file is missing or invalid.
+  static std::unique_ptr<BasicPrefixMatcher> Open(const std::string &path);
 
   // Finds the longest string in dic, which is a prefix of `w`.
   // Returns the UTF8 byte length of matched string.
@@ -49,9 +58,25 @@ public:
   // If no entry is found, return 0.
   size_t PrefixSearch(const char *w, size_t w_len) const;
 
+  // Batched PrefixSearch: stores the match length of `queries[i]` in
+  // `lens[i]`. The walks are interleaved so that their memory accesses
+  // overlap.
+  void PrefixSearch(const std::string_view *queries, size_t num,
+                    size_t *lens) const;
+
+  // Bytes held by the trie.
+  size_t MemoryUsage() const;
+
 private:
-  std::unique_ptr<cedar_t> trie_;
+  BasicPrefixMatcher() = default;
+
+  std::unique_ptr<TrieFile> file_;
+  std::unique_ptr<trie_t> trie_;
 };
 
+typedef BasicPrefixMatcher<> PrefixMatcher;
+
+extern template class BasicPrefixMatcher<CedarBackend>;
+
 } // namespace libtext
 #endif // LIBTEXT_COMMON_PREFIX_MATCHER_H_
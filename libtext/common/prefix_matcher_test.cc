@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 #include <libtext/common/prefix_matcher.h>
+#include <cstdio>
 #include <iostream>
 #include <map>
 #include <string>
@@ -46,4 +47,65 @@ TEST(PrefixMatcher, PrefixMatch) {
   ASSERT_EQ(match_len, 5);
 }
 
+TEST(PrefixMatcher, ManyPrefixes) {
+  // more matches than the old 64 entry result buffer could hold
+  std::set<std::string> test_data;
+  for (size_t i = 1; i <= 100; ++i) {
+    test_data.insert(std::string(i, 'a'));
+  }
+  PrefixMatcher pm(test_data);
+  std::string data(120, 'a');
+  ASSERT_EQ(pm.PrefixSearch(data.data(), data.size()), 100);
+  ASSERT_EQ(pm.PrefixSearch(data.data(), 70), 70);
+  ASSERT_EQ(pm.PrefixSearch("b", 1), 0);
+}
+
+TEST(PrefixMatcher, BatchPrefixSearch) {
+  std::set<std::string> test_data{"hello world", "happy", "world", "hi",
+                                  "worldhi", "\xE4\xBD\xA0\xE5\xA5\xBD"};
+  PrefixMatcher pm(test_data);
+  std::vector<std::string> data{
+      "happyworld", "hello", "hello world!", "worldhi", "je", "",
+      "hi there",   "world", "\xE4\xBD\xA0\xE5\xA5\xBD\xE5\x90\x97",
+      "worl",       "h"};
+  std::vector<std::string_view> queries(data.begin(), data.end());
+  std::vector<size_t> lens(queries.size(), 42);
+  pm.PrefixSearch(queries.data(), queries.size(), lens.data());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    ASSERT_EQ(lens[i], pm.PrefixSearch(data[i].data(), data[i].size()))
+        << data[i];
+  }
+
+  PrefixMatcher empty((std::set<std::string>()));
+  empty.PrefixSearch(queries.data(), queries.size(), lens.data());
+  for (size_t i = 0; i < queries.size(); ++i) {
+    ASSERT_EQ(lens[i], 0);
+  }
+}
+
+TEST(PrefixMatcher, SaveOpen) {
+  std::set<std::string> test_data{"hello world", "happy", "world", "hi"};
+  PrefixMatcher pm(test_data);
+  const std::string path = "prefix_matcher_test.trie";
+  ASSERT_TRUE(pm.Save(path));
+  auto loaded = PrefixMatcher::Open(path);
+  ASSERT_TRUE(loaded != nullptr);
+  for (std::string w : {"hello world!", "happyworld", "hit", "je", ""}) {
+    ASSERT_EQ(loaded->PrefixSearch(w.data(), w.size()),
+              pm.PrefixSearch(w.data(), w.size()))
+        << w;
+  }
+  bool found = true;
+  ASSERT_EQ(loaded->PrefixMatch(std::string("je"), &found), 1);
+  ASSERT_FALSE(found);
+
+  // an empty matcher round-trips too
+  PrefixMatcher empty((std::set<std::string>()));
+  ASSERT_TRUE(empty.Save(path));
+  loaded = PrefixMatcher::Open(path);
+  ASSERT_TRUE(loaded != nullptr);
+  ASSERT_EQ(loaded->PrefixSearch("hi", 2), 0);
+  std::remove(path.c_str());
+}
+
 }  // namespace libtext
\ No newline at end of file
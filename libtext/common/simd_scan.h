@@ -0,0 +1,210 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_COMMON_SIMD_SCAN_H_
+#define LIBTEXT_COMMON_SIMD_SCAN_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace libtext {
+
+// Returns the index of the first byte in `s[0, len)` with the high bit set,
+// or `len` if the whole range is ASCII.
+inline size_t FindNonAscii(const char *s, size_t len) {
+  size_t i = 0;
+#if defined(__SSE2__)
+  for (; i + 16 <= len; i += 16) {
+    const __m128i v =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+    const int mask = _mm_movemask_epi8(v);
+    if (mask != 0) {
+      return i + __builtin_ctz(static_cast<unsigned>(mask));
+    }
+  }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+  for (; i + 16 <= len; i += 16) {
+    const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t *>(s + i));
+    if (vmaxvq_u8(v) >= 0x80) {
+      break;
+    }
+  }
+#else
+  for (; i + 8 <= len; i += 8) {
+    uint64_t v;
+    std::memcpy(&v, s + i, sizeof(v));
+    if (v & 0x8080808080808080ULL) {
+      break;
+    }
+  }
+#endif
+  for (; i < len; ++i) {
+    if (static_cast<unsigned char>(s[i]) >= 0x80) {
+      return i;
+    }
+  }
+  return len;
+}
+
+// A set of byte values that can be searched for with SIMD. The members are
+// kept as a 256-entry table and as a short list of contiguous ranges; the
+// vector loop tests every lane against the ranges. A set of more than
+// kMaxRanges ranges is covered by merging the closest ones, then the lanes
+// the vector loop finds are checked against the table.
+class ByteSet {
+public:
+  ByteSet() : num_ranges_(0), exact_(true) {
+    std::memset(table_, 0, sizeof(table_));
+  }
+
+  void Insert(unsigned char b) {
+    if (table_[b]) {
+      return;
+    }
+    table_[b] = true;
+    BuildRanges();
+  }
+
+  bool Contains(unsigned char b) const { return table_[b]; }
+
+  bool Empty() const { return num_ranges_ == 0; }
+
+  // Whether the ranges hold exactly the members, i.e. no lane found by the
+  // vector loop needs to be checked.
+  bool Exact() const { return exact_; }
+
+  // Returns the index of the first byte of `s[0, len)` in the set,
+  // or `len` if there is none.
+  size_t FindFirst(const char *s, size_t len) const {
+    size_t i = 0;
+#if defined(__SSE2__)
+    {
+      // ranges never cross 0x80, so signed compares are exact
+      __m128i lo[kMaxRanges];
+      __m128i hi[kMaxRanges];
+      for (int r = 0; r < num_ranges_; ++r) {
+        lo[r] = _mm_set1_epi8(range_lo_[r]);
+        hi[r] = _mm_set1_epi8(range_hi_[r]);
+      }
+      const __m128i ones = _mm_set1_epi8(-1);
+      for (; i + 16 <= len; i += 16) {
+        const __m128i v =
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+        __m128i in = _mm_setzero_si128();
+        for (int r = 0; r < num_ranges_; ++r) {
+          const __m128i out = _mm_or_si128(_mm_cmpgt_epi8(lo[r], v),
+                                           _mm_cmpgt_epi8(v, hi[r]));
+          in = _mm_or_si128(in, _mm_andnot_si128(out, ones));
+        }
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(in));
+        for (; mask != 0; mask &= mask - 1) {
+          const size_t j = i + __builtin_ctz(mask);
+          if (exact_ || table_[static_cast<unsigned char>(s[j])]) {
+            return j;
+          }
+        }
+      }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    {
+      for (; i + 16 <= len; i += 16) {
+        const int8x16_t v = vld1q_s8(reinterpret_cast<const int8_t *>(s + i));
+        uint8x16_t in = vdupq_n_u8(0);
+        for (int r = 0; r < num_ranges_; ++r) {
+          in = vorrq_u8(in, vandq_u8(vcgeq_s8(v, vdupq_n_s8(range_lo_[r])),
+                                     vcleq_s8(v, vdupq_n_s8(range_hi_[r]))));
+        }
+        if (vmaxvq_u8(in) != 0) {
+          for (size_t j = i; j < i + 16; ++j) {
+            if (table_[static_cast<unsigned char>(s[j])]) {
+              return j;
+            }
+          }
+        }
+      }
+    }
+#endif
+    for (; i < len; ++i) {
+      if (table_[static_cast<unsigned char>(s[i])]) {
+        return i;
+      }
+    }
+    return len;
+  }
+
+private:
+  static constexpr int kMaxRanges = 8;
+
+  // Splits the members into contiguous ranges, separately for the ASCII and
+  // the high half so that each range is ordered as signed chars. While
+  // there are too many, the two closest ranges of the same half are merged.
+  void BuildRanges() {
+    int lo[256];
+    int hi[256];
+    int num = 0;
+    for (int b = 0; b < 256; ++b) {
+      if (!table_[b]) {
+        continue;
+      }
+      int e = b;
+      while (e + 1 < 256 && e + 1 != 0x80 && table_[e + 1]) {
+        ++e;
+      }
+      lo[num] = b;
+      hi[num] = e;
+      ++num;
+      b = e;
+    }
+    exact_ = num <= kMaxRanges;
+    while (num > kMaxRanges) {
+      int best = -1;
+      for (int r = 0; r + 1 < num; ++r) {
+        if ((lo[r + 1] < 0x80) == (hi[r] < 0x80) &&
+            (best < 0 || lo[r + 1] - hi[r] < lo[best + 1] - hi[best])) {
+          best = r;
+        }
+      }
+      // at most one range per half is left otherwise
+      hi[best] = hi[best + 1];
+      for (int r = best + 1; r + 1 < num; ++r) {
+        lo[r] = lo[r + 1];
+        hi[r] = hi[r + 1];
+      }
+      --num;
+    }
+    num_ranges_ = num;
+    for (int r = 0; r < num; ++r) {
+      range_lo_[r] = static_cast<int8_t>(lo[r]);
+      range_hi_[r] = static_cast<int8_t>(hi[r]);
+    }
+  }
+
+  bool table_[256];
+  int8_t range_lo_[kMaxRanges];
+  int8_t range_hi_[kMaxRanges];
+  int num_ranges_;
+  bool exact_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_COMMON_SIMD_SCAN_H_
@@ -0,0 +1,87 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef LIBTEXT_COMMON_TRIE_BACKEND_H_
+#define LIBTEXT_COMMON_TRIE_BACKEND_H_
+
+#include <cstddef>
+#include <string_view>
+
+#include "libtext/common/cedar.h"
+#include "libtext/common/cedar_search.h"
+#include "libtext/common/double_array.h"
+
+namespace libtext {
+
+// Trie backends of PrefixMap and PrefixMatcher. A backend names the trie
+// type and knows how to search it:
+//
+//   typedef ... trie_type;
+//   static constexpr bool kMappable;  // trie is one plain double array
+//   static size_t PrefixSearch(const trie_type &, const char *w,
+//                              size_t w_len, int *val);
+//   static void PrefixSearch(const trie_type &, const std::string_view *,
+//                            size_t num, size_t *lens, int *vals);
+//   static size_t MemoryUsage(const trie_type &);
+//
+// Mappable backends also provide View() and Attach() to save the array
+// and to search it in place from a TrieFile. CedarppBackend is in
+// cedarpp_backend.h.
+
+// cedar::da, the plain double array. Fastest lookups and batched searches
+// with prefetching; the array can be saved and mapped.
+struct CedarBackend {
+#if defined(USE_CEDAR_UNORDERED)
+  typedef cedar::da<int, -1, -2, false> trie_type;
+#else
+  typedef cedar::da<int> trie_type;
+#endif
+  static constexpr bool kMappable = true;
+
+  static size_t PrefixSearch(const trie_type &trie, const char *w,
+                             size_t w_len, int *val) {
+    return CedarLongestPrefix(trie, w, w_len, val);
+  }
+
+  static void PrefixSearch(const trie_type &trie,
+                           const std::string_view *queries, size_t num,
+                           size_t *lens, int *vals) {
+    View(trie).PrefixSearch(queries, num, lens, vals);
+  }
+
+  static size_t MemoryUsage(const trie_type &trie) {
+    if (trie.capacity() == 0) {
+      // set_array, only the array is there
+      return trie.total_size();
+    }
+    return trie.capacity() *
+               (sizeof(trie_type::node) + sizeof(trie_type::ninfo)) +
+           (trie.capacity() >> 8) * sizeof(trie_type::block);
+  }
+
+  static DoubleArrayView View(const trie_type &trie) { return CedarView(trie); }
+
+  // Makes `trie` search `units` in place; it must outlive `trie`.
+  static void Attach(const DoubleArrayView &units, trie_type *trie) {
+    // cedar only reads the array it does not own
+    trie->set_array(const_cast<DoubleArrayUnit *>(units.units()),
+                    units.size());
+  }
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_COMMON_TRIE_BACKEND_H_
@@ -0,0 +1,146 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "libtext/common/trie_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include "turbo/log/logging.h"
+
+namespace libtext {
+
+constexpr char TrieFileHeader::kMagic[8];
+
+namespace {
+
+uint64_t Checksum(const void *data, size_t len) {
+  const unsigned char *p = static_cast<const unsigned char *>(data);
+  uint64_t h = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= p[i];
+    h *= 0x100000001b3ULL;
+  }
+  return h;
+}
+
+}  // namespace
+
+TrieFile::~TrieFile() { Close(); }
+
+void TrieFile::Close() {
+  if (addr_ != nullptr) {
+    munmap(addr_, length_);
+  }
+  addr_ = nullptr;
+  length_ = 0;
+  units_ = DoubleArrayView();
+}
+
+bool TrieFile::Save(const std::string &path, TrieFileKind kind,
+                    const DoubleArrayView &units) {
+  TrieFileHeader header;
+  std::memset(&header, 0, sizeof(header));
+  std::memcpy(header.magic, TrieFileHeader::kMagic, sizeof(header.magic));
+  header.version = TrieFileHeader::kVersion;
+  header.byte_order = TrieFileHeader::kByteOrder;
+  header.kind = kind;
+  header.unit_size = sizeof(DoubleArrayUnit);
+  header.num_units = units.size();
+  const size_t bytes = units.size() * sizeof(DoubleArrayUnit);
+  header.checksum = Checksum(units.units(), bytes);
+
+  FILE *fp = std::fopen(path.c_str(), "wb");
+  if (fp == nullptr) {
+    TURBO_LOG(ERROR) << "open " << path << " for writing failed";
+    return false;
+  }
+  bool ok = std::fwrite(&header, sizeof(header), 1, fp) == 1;
+  if (ok && bytes > 0) {
+    ok = std::fwrite(units.units(), bytes, 1, fp) == 1;
+  }
+  ok = std::fclose(fp) == 0 && ok;
+  if (!ok) {
+    TURBO_LOG(ERROR) << "write " << path << " failed";
+  }
+  return ok;
+}
+
+bool TrieFile::Open(const std::string &path, TrieFileKind kind) {
+  Close();
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    TURBO_LOG(ERROR) << "open " << path << " failed";
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(TrieFileHeader)) {
+    TURBO_LOG(ERROR) << path << " is too short for a trie file";
+    ::close(fd);
+    return false;
+  }
+  length_ = static_cast<size_t>(st.st_size);
+  addr_ = mmap(nullptr, length_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (addr_ == MAP_FAILED) {
+    addr_ = nullptr;
+    TURBO_LOG(ERROR) << "mmap " << path << " failed";
+    return false;
+  }
+
+  const auto *header = static_cast<const TrieFileHeader *>(addr_);
+  const char *error = nullptr;
+  if (std::memcmp(header->magic, TrieFileHeader::kMagic,
+                  sizeof(header->magic)) != 0) {
+    error = "bad magic";
+  } else if (header->version != TrieFileHeader::kVersion) {
+    error = "unsupported version";
+  } else if (header->byte_order != TrieFileHeader::kByteOrder ||
+             header->unit_size != sizeof(DoubleArrayUnit)) {
+    error = "written by an incompatible machine";
+  } else if (header->kind != kind) {
+    error = "wrong kind of trie";
+  } else if (header->num_units >
+                 (length_ - sizeof(TrieFileHeader)) / sizeof(DoubleArrayUnit) ||
+             length_ != sizeof(TrieFileHeader) +
+                            header->num_units * sizeof(DoubleArrayUnit)) {
+    error = "size mismatch";
+  } else {
+    const void *data =
+        static_cast<const char *>(addr_) + sizeof(TrieFileHeader);
+    const size_t bytes = header->num_units * sizeof(DoubleArrayUnit);
+    units_ = DoubleArrayView(static_cast<const DoubleArrayUnit *>(data),
+                             header->num_units);
+    if (Checksum(data, bytes) != header->checksum) {
+      error = "checksum mismatch";
+    } else if (!units_.Validate()) {
+      error = "corrupted double array";
+    }
+  }
+  if (error != nullptr) {
+    TURBO_LOG(ERROR) << path << ": " << error;
+    Close();
+    return false;
+  }
+  return true;
+}
+
+} // namespace libtext
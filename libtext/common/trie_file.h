@@ -0,0 +1,81 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef LIBTEXT_COMMON_TRIE_FILE_H_
+#define LIBTEXT_COMMON_TRIE_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "libtext/common/double_array.h"
+
+namespace libtext {
+
+// On-disk form of a double array: a TrieFileHeader followed by the units.
+// The file is mapped read-only, so every process loading it shares the
+// same pages and nothing is copied or rebuilt.
+struct TrieFileHeader {
+  static constexpr char kMagic[8] = {'L', 'T', 'X', 'T', 'R', 'I', 'E', 0};
+  static constexpr uint32_t kVersion = 1;
+  static constexpr uint32_t kByteOrder = 0x01020304;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order; // kByteOrder as written by the saving machine
+  uint32_t kind;       // what the array is for, checked when opening
+  uint32_t unit_size;  // sizeof(DoubleArrayUnit)
+  uint64_t num_units;
+  uint64_t checksum; // FNV-1a of the units
+};
+
+// Kinds of the tries saved by libtext.
+enum TrieFileKind : uint32_t {
+  kPrefixMapTrie = 1,
+  kPrefixMatcherTrie = 2,
+};
+
+class TrieFile {
+public:
+  TrieFile() = default;
+  ~TrieFile();
+
+  TrieFile(const TrieFile &) = delete;
+  TrieFile &operator=(const TrieFile &) = delete;
+
+  // Writes `units` to `path`. Returns false if the file can not be written.
+  static bool Save(const std::string &path, TrieFileKind kind,
+                   const DoubleArrayView &units);
+
+  // Maps `path` and validates its header, checksum and structure.
+  // Returns false and logs the reason if the file is not a `kind` trie
+  // written by a compatible build.
+  bool Open(const std::string &path, TrieFileKind kind);
+
+  // The mapped units, valid as long as this object lives.
+  DoubleArrayView units() const { return units_; }
+
+private:
+  void Close();
+
+  void *addr_ = nullptr;
+  size_t length_ = 0;
+  DoubleArrayView units_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_COMMON_TRIE_FILE_H_
@@ -27,6 +27,7 @@
 #include <map>
 #include <stdint.h>
 #include <string>
+#include <utility>
 #include "turbo/log/logging.h"
 #include "turbo/strings/str_split.h"
 
@@ -61,6 +62,7 @@ public:
     }
     active_node_infos_.push_back(node_info);
     trie_->InsertNode(node_info.word, &active_node_infos_.back());
+    ++version_;
     return true;
   }
 
@@ -74,6 +76,7 @@ public:
     }
     active_node_infos_.push_back(node_info);
     trie_->InsertNode(node_info.word, &active_node_infos_.back());
+    ++version_;
     return true;
   }
 
@@ -83,10 +86,30 @@ public:
     if (!MakeNodeInfo(node_info, word, user_word_default_weight_, tag)) {
       return false;
     }
-    trie_->DeleteNode(node_info.word, &node_info);
+    if (!trie_->DeleteNode(node_info.word)) {
+      return false;
+    }
+    ++version_;
     return true;
   }
 
+  // The length in runes of the longest word, user words included.
+  size_t GetMaxWordLength() const { return trie_->GetMaxKeyLength(); }
+
+  // The length in runes of the longest word starting with `first`, 0 if
+  // there is none.
+  size_t GetMaxWordLength(Rune first) const {
+    return trie_->GetMaxKeyLength(first);
+  }
+
+  // Whether r is an ASCII rune which no word contains, so that no word
+  // crosses it and it is cut alone without a lookup.
+  bool IsAsciiNotInWords(Rune r) const { return trie_->IsAsciiNotInKeys(r); }
+
+  // Changes whenever a word is inserted or deleted, so that results
+  // computed with an older dictionary can be told apart.
+  uint64_t GetVersion() const { return version_; }
+
   const DictUnit *Find(RuneStrArray::const_iterator begin,
                        RuneStrArray::const_iterator end) const {
     return trie_->Find(begin, end);
@@ -98,6 +121,32 @@ public:
     trie_->Find(begin, end, res, max_word_len);
   }
 
+  void Find(RuneStrArray::const_iterator begin,
+            RuneStrArray::const_iterator end, CompactDag &res,
+            size_t max_word_len = MAX_WORD_LENGTH) const {
+    trie_->Find(begin, end, res, max_word_len);
+  }
+
+  template <typename Fn>
+  void ForEachPrefix(RuneStrArray::const_iterator begin,
+                     RuneStrArray::const_iterator end, size_t max_word_len,
+                     Fn &&fn) const {
+    trie_->ForEachPrefix(begin, end, max_word_len, std::forward<Fn>(fn));
+  }
+
+  // The length of the longest word of at most max_word_len runes which is
+  // a prefix of runes[0, n), 0 if there is none.
+  size_t LongestPrefix(const Rune *runes, size_t n,
+                       size_t max_word_len = MAX_WORD_LENGTH) const {
+    return trie_->LongestPrefix(runes, n, max_word_len);
+  }
+
+  // Calls fn(unit) for every word, user words included.
+  template <typename Fn>
+  void ForEachWord(Fn &&fn) const {
+    trie_->ForEachValue(std::forward<Fn>(fn));
+  }
+
   bool Find(const std::string &word) {
     const DictUnit *tmp = NULL;
     RuneStrArray runes;
@@ -113,6 +162,9 @@ public:
   }
 
   bool IsUserDictSingleChineseWord(const Rune &word) const {
+    if (IsAsciiNotInWords(word)) {
+      return false;
+    }
     return user_dict_single_chinese_word_.find(word) !=
            user_dict_single_chinese_word_.end();
   }
@@ -133,10 +185,18 @@ public:
       double weight = log(1.0 * freq / freq_sum_);
       MakeNodeInfo(node_info, buf[0], weight, buf[2]);
     }
-    static_node_infos_.push_back(node_info);
+    if (trie_ == NULL) {
+      static_node_infos_.push_back(node_info);
+    } else {
+      // loaded after Init: the trie points into static_node_infos_, which
+      // must not grow any more
+      active_node_infos_.push_back(node_info);
+      trie_->InsertNode(node_info.word, &active_node_infos_.back());
+    }
     if (node_info.word.size() == 1) {
       user_dict_single_chinese_word_.insert(node_info.word[0]);
     }
+    ++version_;
   }
 
   void LoadUserDict(const std::vector<std::string> &buf) {
@@ -173,6 +233,8 @@ public:
 private:
   void Init(const std::string &dict_path, const std::string &user_dict_paths,
             UserWordWeightOption user_word_weight_opt) {
+    trie_ = NULL;
+    version_ = 0;
     LoadDict(dict_path);
     freq_sum_ = CalcFreqSum(static_node_infos_);
     CalculateWeight(static_node_infos_, freq_sum_);
@@ -279,6 +341,7 @@ private:
   double median_weight_;
   double user_word_default_weight_;
   std::unordered_set<Rune> user_dict_single_chinese_word_;
+  uint64_t version_;
 };
 } // namespace libtext
 
@@ -46,7 +46,7 @@ public:
     GetStringsFromWords(tmp, words);
   }
   void Cut(const std::string &sentence, std::vector<Word> &words) const {
-    PreFilter pre_filter(symbols_, sentence);
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
     PreFilter::Range range;
     std::vector<WordRange> wrs;
     wrs.reserve(sentence.size() / 2);
@@ -60,9 +60,6 @@ public:
   }
   void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
            std::vector<WordRange> &res) const {
-    // result of searching in trie tree
-    turbo::InlinedVector<std::pair<size_t, const DictUnit *>, 8> tRes;
-
     // max index of res's words
     size_t maxIdx = 0;
 
@@ -72,21 +69,22 @@ public:
     // tmp variables
     size_t wordLen = 0;
     assert(dictTrie_);
-    std::vector<struct Dag> dags;
-    dictTrie_->Find(begin, end, dags);
-    for (size_t i = 0; i < dags.size(); i++) {
-      for (size_t j = 0; j < dags[i].nexts.size(); j++) {
-        size_t nextoffset = dags[i].nexts[j].first;
-        assert(nextoffset < dags.size());
-        const DictUnit *du = dags[i].nexts[j].second;
+    CompactDag dag;
+    dictTrie_->Find(begin, end, dag);
+    for (size_t i = 0; i < dag.size(); i++) {
+      const size_t numEdges = dag.NumEdges(i);
+      for (size_t k = dag.starts[i]; k < dag.starts[i + 1]; k++) {
+        size_t nextoffset = dag.ends[k];
+        assert(nextoffset < dag.size());
+        const DictUnit *du = dag.units[k];
         if (du == NULL) {
-          if (dags[i].nexts.size() == 1 && maxIdx <= uIdx) {
+          if (numEdges == 1 && maxIdx <= uIdx) {
             WordRange wr(begin + i, begin + nextoffset);
             res.push_back(wr);
           }
         } else {
           wordLen = du->word.size();
-          if (wordLen >= 2 || (dags[i].nexts.size() == 1 && maxIdx <= uIdx)) {
+          if (wordLen >= 2 || (numEdges == 1 && maxIdx <= uIdx)) {
             WordRange wr(begin + i, begin + nextoffset);
             res.push_back(wr);
           }
@@ -0,0 +1,159 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_SEGMENT_HMM_CACHE_H_
+#define LIBTEXT_SEGMENT_HMM_CACHE_H_
+
+#include "libtext/jieba/unicode.h"
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <vector>
+#include "turbo/container/flat_hash_map.h"
+
+namespace libtext {
+
+// A cache of the HMM cuts of rune sequences, shared by concurrent callers.
+// The same unknown names come again and again in real text, and the cut
+// of a sequence only depends on its runes, so it never goes stale. A cut
+// is kept as a bitmask with bit i set if a word ends at rune i, which
+// bounds the cached sequences to 64 runes. Entries are spread over shards
+// by hash, each an LRU list under its own mutex with an equal part of the
+// entry budget.
+class HMMCache {
+public:
+  static constexpr size_t kMaxRunLength = 64;
+
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    size_t entries;
+  }; // struct Stats
+
+  HMMCache(size_t max_entries, size_t max_run_len = 16, size_t num_shards = 8)
+      : num_shards_(std::max<size_t>(std::min(num_shards, max_entries), 1)),
+        shard_capacity_(max_entries / num_shards_),
+        max_run_len_(max_run_len < kMaxRunLength ? max_run_len
+                                                 : kMaxRunLength),
+        shards_(new Shard[num_shards_]) {}
+
+  // The longest sequence worth a lookup, in runes.
+  size_t GetMaxRunLength() const { return max_run_len_; }
+
+  // Stores the word ends of `runes[0, n)` in `ends` and returns true if
+  // its cut is cached.
+  bool Lookup(const Rune *runes, size_t n, uint64_t *ends) {
+    const uint64_t hash = Hash(runes, n);
+    Shard &shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(hash);
+    if (it == shard.index.end() || !it->second->Equals(runes, n)) {
+      ++shard.misses;
+      return false;
+    }
+    ++shard.hits;
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    *ends = it->second->ends;
+    return true;
+  }
+
+  void Insert(const Rune *runes, size_t n, uint64_t ends) {
+    if (n > max_run_len_ || shard_capacity_ == 0) {
+      return;
+    }
+    const uint64_t hash = Hash(runes, n);
+    Shard &shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(hash);
+    if (it != shard.index.end()) {
+      // the same sequence from another caller, or a hash collision
+      it->second->runes.assign(runes, runes + n);
+      it->second->ends = ends;
+      shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+      return;
+    }
+    if (shard.lru.size() >= shard_capacity_) {
+      // the least recently used entry is reused in place
+      shard.index.erase(shard.lru.back().hash);
+      shard.lru.splice(shard.lru.begin(), shard.lru,
+                       std::prev(shard.lru.end()));
+    } else {
+      shard.lru.emplace_front();
+    }
+    Entry &entry = shard.lru.front();
+    entry.hash = hash;
+    entry.runes.assign(runes, runes + n);
+    entry.ends = ends;
+    shard.index[hash] = shard.lru.begin();
+  }
+
+  Stats GetStats() const {
+    Stats stats = {0, 0, 0};
+    for (size_t i = 0; i < num_shards_; ++i) {
+      Shard &shard = shards_[i];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      stats.hits += shard.hits;
+      stats.misses += shard.misses;
+      stats.entries += shard.lru.size();
+    }
+    return stats;
+  }
+
+private:
+  struct Entry {
+    uint64_t hash;
+    uint64_t ends;
+    std::vector<Rune> runes;
+    bool Equals(const Rune *r, size_t n) const {
+      return runes.size() == n && std::equal(runes.begin(), runes.end(), r);
+    }
+  }; // struct Entry
+
+  // aligned so that the mutexes of neighbouring shards do not share a line
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::list<Entry> lru;
+    turbo::flat_hash_map<uint64_t, std::list<Entry>::iterator> index;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+  }; // struct Shard
+
+  static uint64_t Hash(const Rune *runes, size_t n) {
+    uint64_t h = 0xcbf29ce484222325ULL ^ n;
+    for (size_t i = 0; i < n; ++i) {
+      h = (h ^ runes[i]) * 0x100000001b3ULL;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  Shard &GetShard(uint64_t hash) const {
+    return shards_[(hash >> 40) % num_shards_];
+  }
+
+  const size_t num_shards_;
+  const size_t shard_capacity_;
+  const size_t max_run_len_;
+  std::unique_ptr<Shard[]> shards_;
+}; // class HMMCache
+
+} // namespace libtext
+
+#endif // LIBTEXT_SEGMENT_HMM_CACHE_H_
@@ -16,6 +16,7 @@
 #ifndef LIBTEXT_SEGMENT_HMM_SEG_H_
 #define LIBTEXT_SEGMENT_HMM_SEG_H_
 
+#include "libtext/jieba/hmm_cache.h"
 #include "libtext/jieba/hmm_model.h"
 #include "libtext/jieba/seg_base.h"
 #include "libtext/jieba/dict_trie.h"
@@ -23,6 +24,8 @@
 #include <fstream>
 #include <iostream>
 #include <memory.h>
+#include <memory>
+#include "turbo/container/inlined_vector.h"
 
 namespace libtext {
 
@@ -43,7 +46,7 @@ public:
     GetStringsFromWords(tmp, words);
   }
   void Cut(const std::string &sentence, std::vector<Word> &words) const {
-    PreFilter pre_filter(symbols_, sentence);
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
     PreFilter::Range range;
     std::vector<WordRange> wrs;
     wrs.reserve(sentence.size() / 2);
@@ -60,7 +63,7 @@ public:
     RuneStrArray::const_iterator left = begin;
     RuneStrArray::const_iterator right = begin;
     while (right != end) {
-      if (right->rune < 0x80) {
+      if (right->rune < 0x80 || (right->char_class & kRuleClasses)) {
         if (left != right) {
           InternalCut(left, right, res);
         }
@@ -88,25 +91,35 @@ public:
     }
   }
 
+  // Keeps the cuts of up to `max_entries` sequences of at most
+  // `max_run_len` runes, so that unknown words which come again skip the
+  // Viterbi pass. Not to be called while other threads are cutting.
+  void EnableCache(size_t max_entries, size_t max_run_len = 16) {
+    cache_.reset(new HMMCache(max_entries, max_run_len));
+  }
+
+  // Null if the cache is disabled.
+  const HMMCache *GetCache() const { return cache_.get(); }
+
 private:
+  // runes which are cut by the rules below or on their own instead of by
+  // the HMM, like ASCII
+  static constexpr uint8_t kRuleClasses = CharClassLetter | CharClassDigit |
+                                          CharClassPunct | CharClassSpace |
+                                          CharClassEmoji;
+
   // sequential letters rule
   RuneStrArray::const_iterator
   SequentialLetterRule(RuneStrArray::const_iterator begin,
                        RuneStrArray::const_iterator end) const {
-    Rune x = begin->rune;
-    if (('a' <= x && x <= 'z') || ('A' <= x && x <= 'Z')) {
+    if (begin->char_class == CharClassLetter) {
       begin++;
     } else {
       return begin;
     }
-    while (begin != end) {
-      x = begin->rune;
-      if (('a' <= x && x <= 'z') || ('A' <= x && x <= 'Z') ||
-          ('0' <= x && x <= '9')) {
-        begin++;
-      } else {
-        break;
-      }
+    while (begin != end &&
+           (begin->char_class & (CharClassLetter | CharClassDigit))) {
+      begin++;
     }
     return begin;
   }
@@ -114,25 +127,50 @@ private:
   RuneStrArray::const_iterator
   NumbersRule(RuneStrArray::const_iterator begin,
               RuneStrArray::const_iterator end) const {
-    Rune x = begin->rune;
-    if ('0' <= x && x <= '9') {
+    if (begin->char_class == CharClassDigit) {
       begin++;
     } else {
       return begin;
     }
-    while (begin != end) {
-      x = begin->rune;
-      if (('0' <= x && x <= '9') || x == '.') {
-        begin++;
-      } else {
-        break;
-      }
+    while (begin != end && (begin->char_class == CharClassDigit ||
+                            begin->rune == '.' || begin->rune == 0xff0e)) {
+      begin++;
     }
     return begin;
   }
   void InternalCut(RuneStrArray::const_iterator begin,
                    RuneStrArray::const_iterator end,
                    std::vector<WordRange> &res) const {
+    const size_t n = end - begin;
+    if (n == 1) {
+      // ends in E or S whatever the model
+      res.push_back(WordRange(begin, begin));
+      return;
+    }
+    if (cache_ && n <= cache_->GetMaxRunLength()) {
+      turbo::InlinedVector<Rune, 16> runes(n);
+      for (size_t i = 0; i < n; i++) {
+        runes[i] = (begin + i)->rune;
+      }
+      uint64_t ends = 0;
+      if (!cache_->Lookup(runes.data(), n, &ends)) {
+        std::vector<size_t> status;
+        Viterbi(begin, end, status);
+        for (size_t i = 0; i < n; i++) {
+          ends |= uint64_t(status[i] % 2) << i;
+        }
+        cache_->Insert(runes.data(), n, ends);
+      }
+      RuneStrArray::const_iterator left = begin;
+      for (size_t i = 0; i < n; i++) {
+        if (ends >> i & 1) {
+          res.push_back(WordRange(left, begin + i));
+          left = begin + i + 1;
+        }
+      }
+      return;
+    }
+
     std::vector<size_t> status;
     Viterbi(begin, end, status);
 
@@ -208,6 +246,7 @@ private:
 
   const HMMModel *model_;
   bool isNeedDestroy_;
+  std::unique_ptr<HMMCache> cache_;
 }; // class HMMSegment
 
 } // namespace libtext
@@ -69,21 +69,20 @@ public:
 
   void Extract(const std::string &sentence, std::vector<Word> &keywords,
                size_t topN) const {
-    std::vector<std::string> words;
-    segment_.Cut(sentence, words);
-
-    std::map<std::string, Word> wordmap;
+    std::map<std::string, Word, std::less<>> wordmap;
     size_t offset = 0;
-    for (size_t i = 0; i < words.size(); ++i) {
-      size_t t = offset;
-      offset += words[i].size();
-      if (IsSingleWord(words[i]) ||
-          stopWords_.find(words[i]) != stopWords_.end()) {
-        continue;
+    segment_.Cut(sentence, [this, &wordmap, &offset](const WordView &w) {
+      offset += w.word.size();
+      if (w.unicode_length == 1 || stopWords_.contains(w.word)) {
+        return;
       }
-      wordmap[words[i]].offsets.push_back(t);
-      wordmap[words[i]].weight += 1.0;
-    }
+      auto it = wordmap.find(w.word);
+      if (it == wordmap.end()) {
+        it = wordmap.emplace(std::string(w.word), Word()).first;
+      }
+      it->second.offsets.push_back(w.offset);
+      it->second.weight += 1.0;
+    });
     if (offset != sentence.size()) {
       TURBO_LOG(ERROR) << "words illegal";
       return;
@@ -91,7 +90,8 @@ public:
 
     keywords.clear();
     keywords.reserve(wordmap.size());
-    for (std::map<std::string, Word>::iterator itr = wordmap.begin();
+    for (std::map<std::string, Word, std::less<>>::iterator itr =
+             wordmap.begin();
          itr != wordmap.end(); ++itr) {
       turbo::flat_hash_map<std::string, double>::const_iterator cit =
           idfMap_.find(itr->first);
@@ -157,7 +157,7 @@ private:
   turbo::flat_hash_map<std::string, double> idfMap_;
   double idfAverage_;
 
-  std::unordered_set<std::string> stopWords_;
+  turbo::flat_hash_set<std::string> stopWords_;
 }; // class KeywordExtractor
 
 inline std::ostream &operator<<(std::ostream &os,
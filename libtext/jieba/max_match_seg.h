@@ -0,0 +1,255 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_SEGMENT_MAX_MATCH_SEG_H_
+#define LIBTEXT_SEGMENT_MAX_MATCH_SEG_H_
+
+#include "libtext/jieba/dict_trie.h"
+#include "libtext/jieba/pre_filter.h"
+#include "libtext/jieba/seg_base.h"
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <mutex>
+#include "turbo/container/inlined_vector.h"
+
+namespace libtext {
+
+// Cuts by maximum matching over the words of a DictTrie, without the
+// weights of MPSegment or the HMM of MixSegment, for paths where latency
+// matters more than accuracy. The forward mode takes the longest word from
+// the left, the backward mode the longest word from the right, matched in
+// a trie of the reversed words, and the bidirectional mode runs both and
+// keeps the cut with fewer words, then fewer single runes, then the
+// backward one. The reversed trie follows the words inserted into or
+// deleted from the dictionary: it is rebuilt by the first cut after the
+// version of the dictionary changes. Where no word starts, a run of
+// letters and digits is kept in one piece, as the HMM rules do, and other
+// runes are cut alone.
+class MaxMatchSegment : public SegmentBase {
+public:
+  enum Mode {
+    MaxMatchForward,
+    MaxMatchBackward,
+    MaxMatchBidirectional,
+  }; // enum Mode
+
+  MaxMatchSegment(const std::string &dictPath,
+                  const std::string &userDictPath = "",
+                  Mode mode = MaxMatchBidirectional)
+      : dictTrie_(new DictTrie(dictPath, userDictPath)), isNeedDestroy_(true),
+        mode_(mode), reverseVersion_(kNoVersion) {
+    SetMode(mode);
+  }
+  MaxMatchSegment(const DictTrie *dictTrie, Mode mode = MaxMatchBidirectional)
+      : dictTrie_(dictTrie), isNeedDestroy_(false), mode_(mode),
+        reverseVersion_(kNoVersion) {
+    assert(dictTrie_);
+    SetMode(mode);
+  }
+  ~MaxMatchSegment() {
+    if (isNeedDestroy_) {
+      delete dictTrie_;
+    }
+  }
+
+  void Cut(const std::string &sentence, std::vector<std::string> &words) const {
+    Cut(sentence, words, MAX_WORD_LENGTH);
+  }
+  void Cut(const std::string &sentence, std::vector<std::string> &words,
+           size_t max_word_len) const {
+    std::vector<Word> tmp;
+    Cut(sentence, tmp, max_word_len);
+    GetStringsFromWords(tmp, words);
+  }
+  void Cut(const std::string &sentence, std::vector<Word> &words,
+           size_t max_word_len = MAX_WORD_LENGTH) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    PreFilter::Range range;
+    std::vector<WordRange> wrs;
+    wrs.reserve(sentence.size() / 2);
+    while (pre_filter.HasNext()) {
+      range = pre_filter.Next();
+      Cut(range.begin, range.end, wrs, max_word_len);
+    }
+    words.clear();
+    words.reserve(wrs.size());
+    GetWordsFromWordRanges(sentence, wrs, words);
+  }
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           std::vector<WordRange> &words,
+           size_t max_word_len = MAX_WORD_LENGTH) const {
+    const size_t n = end - begin;
+    Runes runes(n);
+    for (size_t i = 0; i < n; i++) {
+      runes[i] = (begin + i)->rune;
+    }
+    Lengths forward;
+    Lengths backward;
+    if (mode_ != MaxMatchBackward) {
+      MatchForward(*dictTrie_, begin, runes.data(), n, max_word_len, forward);
+    }
+    if (mode_ != MaxMatchForward) {
+      for (size_t i = 0; i < n / 2; i++) {
+        std::swap(runes[i], runes[n - 1 - i]);
+      }
+      MatchBackward(begin, runes.data(), n, max_word_len, backward);
+    }
+    if (mode_ == MaxMatchForward ||
+        (mode_ == MaxMatchBidirectional && Better(forward, backward))) {
+      for (size_t i = 0; i < forward.size(); i++) {
+        words.push_back(WordRange(begin, begin + (forward[i] - 1)));
+        begin += forward[i];
+      }
+    } else {
+      // the lengths from the right
+      for (size_t i = backward.size(); i > 0; i--) {
+        words.push_back(WordRange(begin, begin + (backward[i - 1] - 1)));
+        begin += backward[i - 1];
+      }
+    }
+  }
+
+  // Cuts [begin, end) by forward maximum matching in the words of trie.
+  static void CutForward(const DictTrie *trie,
+                         RuneStrArray::const_iterator begin,
+                         RuneStrArray::const_iterator end,
+                         size_t max_word_len, std::vector<WordRange> &words) {
+    const size_t n = end - begin;
+    Runes runes(n);
+    for (size_t i = 0; i < n; i++) {
+      runes[i] = (begin + i)->rune;
+    }
+    Lengths lengths;
+    MatchForward(*trie, begin, runes.data(), n, max_word_len, lengths);
+    for (size_t i = 0; i < lengths.size(); i++) {
+      words.push_back(WordRange(begin, begin + (lengths[i] - 1)));
+      begin += lengths[i];
+    }
+  }
+
+  // The backward and bidirectional modes match in a trie of the reversed
+  // words, built here.
+  void SetMode(Mode mode) {
+    mode_ = mode;
+    if (mode_ != MaxMatchForward) {
+      GetReverseTrie();
+    }
+  }
+  Mode GetMode() const { return mode_; }
+
+  // Brings the trie of the reversed words up to date with the dictionary
+  // now, instead of in the next cut.
+  void UpdateReverseTrie() { GetReverseTrie(); }
+
+  const DictTrie *GetDictTrie() const { return dictTrie_; }
+
+private:
+  typedef turbo::InlinedVector<Rune, 64> Runes;
+  // the lengths in runes of the words of a cut
+  typedef turbo::InlinedVector<uint32_t, 32> Lengths;
+
+  static bool IsAlnum(RuneStrArray::const_iterator it) {
+    return (it->char_class & (CharClassLetter | CharClassDigit)) != 0;
+  }
+
+  static void MatchForward(const DictTrie &trie,
+                           RuneStrArray::const_iterator begin,
+                           const Rune *runes, size_t n, size_t max_word_len,
+                           Lengths &lengths) {
+    for (size_t i = 0; i < n;) {
+      size_t len = trie.LongestPrefix(runes + i, n - i, max_word_len);
+      if (len <= 1) {
+        len = 1;
+        if (IsAlnum(begin + i)) {
+          while (i + len < n && IsAlnum(begin + (i + len))) {
+            len++;
+          }
+        }
+      }
+      lengths.push_back(static_cast<uint32_t>(len));
+      i += len;
+    }
+  }
+
+  // Matches the reversed runes from the right, reversed[j] being the rune
+  // n - 1 - j of [begin, begin + n); the lengths come from the right too.
+  void MatchBackward(RuneStrArray::const_iterator begin, const Rune *reversed,
+                     size_t n, size_t max_word_len, Lengths &lengths) const {
+    const Trie &reverse = *GetReverseTrie();
+    for (size_t j = 0; j < n;) {
+      size_t len = reverse.LongestPrefix(reversed + j, n - j, max_word_len);
+      if (len <= 1) {
+        len = 1;
+        if (IsAlnum(begin + (n - 1 - j))) {
+          while (j + len < n && IsAlnum(begin + (n - 1 - j - len))) {
+            len++;
+          }
+        }
+      }
+      lengths.push_back(static_cast<uint32_t>(len));
+      j += len;
+    }
+  }
+
+  // Whether the forward cut is better than the backward one.
+  static bool Better(const Lengths &forward, const Lengths &backward) {
+    if (forward.size() != backward.size()) {
+      return forward.size() < backward.size();
+    }
+    size_t forward_singles = 0;
+    size_t backward_singles = 0;
+    for (size_t i = 0; i < forward.size(); i++) {
+      forward_singles += forward[i] == 1;
+      backward_singles += backward[i] == 1;
+    }
+    return forward_singles < backward_singles;
+  }
+
+  // The trie of the reversed words of the current version of the
+  // dictionary. Cuts run concurrently, but never with changes to the
+  // dictionary, so the trie is only rebuilt while no cut uses it.
+  const Trie *GetReverseTrie() const {
+    const uint64_t version = dictTrie_->GetVersion();
+    if (reverseVersion_.load(std::memory_order_acquire) != version) {
+      std::lock_guard<std::mutex> lock(reverseMutex_);
+      if (reverseVersion_.load(std::memory_order_relaxed) != version) {
+        std::vector<Unicode> keys;
+        std::vector<const DictUnit *> values;
+        dictTrie_->ForEachWord([&keys, &values](const DictUnit *unit) {
+          keys.push_back(Unicode(unit->word.rbegin(), unit->word.rend()));
+          values.push_back(unit);
+        });
+        reverseTrie_.reset(new Trie(keys, values));
+        reverseVersion_.store(version, std::memory_order_release);
+      }
+    }
+    return reverseTrie_.get();
+  }
+
+  static constexpr uint64_t kNoVersion = ~static_cast<uint64_t>(0);
+
+  const DictTrie *dictTrie_;
+  bool isNeedDestroy_;
+  Mode mode_;
+  mutable std::unique_ptr<Trie> reverseTrie_;
+  // the version of the dictionary reverseTrie_ was built from
+  mutable std::atomic<uint64_t> reverseVersion_;
+  mutable std::mutex reverseMutex_;
+}; // class MaxMatchSegment
+
+} // namespace libtext
+
+#endif // LIBTEXT_SEGMENT_MAX_MATCH_SEG_H_
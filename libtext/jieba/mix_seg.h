@@ -19,6 +19,7 @@
 #include "libtext/jieba/hmm_seg.h"
 #include "libtext/jieba/mps_seg.h"
 #include "libtext/jieba/post_tagger.h"
+#include "libtext/jieba/seg_guard.h"
 #include <cassert>
 
 namespace libtext {
@@ -36,75 +37,109 @@ public:
     Cut(sentence, words, true);
   }
   void Cut(const std::string &sentence, std::vector<std::string> &words,
-           bool hmm) const {
+           bool hmm, const SegmentGuard *guard = nullptr) const {
     std::vector<Word> tmp;
-    Cut(sentence, tmp, hmm);
+    Cut(sentence, tmp, hmm, guard);
     GetStringsFromWords(tmp, words);
   }
+  // With a guard, the work on pathological input is bounded as described
+  // in SegmentGuard.
   void Cut(const std::string &sentence, std::vector<Word> &words,
-           bool hmm = true) const {
-    PreFilter pre_filter(symbols_, sentence);
+           bool hmm = true, const SegmentGuard *guard = nullptr) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
     PreFilter::Range range;
     std::vector<WordRange> wrs;
     wrs.reserve(sentence.size() / 2);
-    while (pre_filter.HasNext()) {
-      range = pre_filter.Next();
-      Cut(range.begin, range.end, wrs, hmm);
+    if (guard != nullptr) {
+      guard->Cut(GetDictTrie(), pre_filter, wrs,
+                 [this, hmm](RuneStrArray::const_iterator begin,
+                             RuneStrArray::const_iterator end,
+                             size_t max_word_len, std::vector<WordRange> &res) {
+                   Cut(begin, end, res, hmm, max_word_len);
+                 });
+    } else {
+      while (pre_filter.HasNext()) {
+        range = pre_filter.Next();
+        Cut(range.begin, range.end, wrs, hmm);
+      }
     }
     words.clear();
     words.reserve(wrs.size());
     GetWordsFromWordRanges(sentence, wrs, words);
   }
 
+  // Calls visit(const WordView &) for the words of Cut in order, without
+  // storing them or copying their strings; the words of the HMM have no
+  // unit.
+  template <typename Fn>
+  void Cut(const std::string &sentence, Fn &&visit, bool hmm = true) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    while (pre_filter.HasNext()) {
+      const PreFilter::Range range = pre_filter.Next();
+      Cut(
+          range.begin, range.end,
+          [&sentence, &visit](RuneStrArray::const_iterator left,
+                              RuneStrArray::const_iterator right,
+                              const DictUnit *unit) {
+            visit(GetWordViewFromRunes(sentence, left, right, unit));
+          },
+          hmm);
+    }
+  }
+
   void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
-           std::vector<WordRange> &res, bool hmm) const {
+           std::vector<WordRange> &res, bool hmm,
+           size_t max_word_len = MAX_WORD_LENGTH) const {
+    Cut(begin, end, WordRangeAppender(res), hmm, max_word_len);
+  }
+  // Calls emit(left, right, unit) for the words [left, right] of [begin,
+  // end) in order, as MPSegment does.
+  template <typename Fn>
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           Fn &&emit, bool hmm, size_t max_word_len = MAX_WORD_LENGTH) const {
+    assert(end >= begin);
     if (!hmm) {
-      mpSeg_.Cut(begin, end, res);
+      mpSeg_.Cut(begin, end, emit, max_word_len);
       return;
     }
-    std::vector<WordRange> words;
-    assert(end >= begin);
-    words.reserve(end - begin);
-    mpSeg_.Cut(begin, end, words);
-
-    std::vector<WordRange> hmmRes;
-    hmmRes.reserve(end - begin);
-    for (size_t i = 0; i < words.size(); i++) {
-      // if mp Get a word, it's ok, put it into result
-      if (words[i].left != words[i].right ||
-          (words[i].left == words[i].right &&
-           mpSeg_.IsUserDictSingleChineseWord(words[i].left->rune))) {
-        res.push_back(words[i]);
-        continue;
-      }
-
-      // if mp Get a single one and it is not in userdict, collect it in
-      // sequence
-      size_t j = i;
-      while (j < words.size() && words[j].left == words[j].right &&
-             !mpSeg_.IsUserDictSingleChineseWord(words[j].left->rune)) {
-        j++;
-      }
-
-      // Cut the sequence with hmm
-      assert(j - 1 >= i);
-      // TODO
-      hmmSeg_.Cut(words[i].left, words[j - 1].left + 1, hmmRes);
-      // put hmm result to result
-      for (size_t k = 0; k < hmmRes.size(); k++) {
-        res.push_back(hmmRes[k]);
-      }
-
-      // clear tmp vars
-      hmmRes.clear();
-
-      // let i jump over this piece
-      i = j - 1;
+    CutSingles(
+        end,
+        [this, begin, end, max_word_len](const auto &mp_emit) {
+          mpSeg_.Cut(begin, end, mp_emit, max_word_len);
+        },
+        emit);
+  }
+  // Cuts [begin, end) over its DAG, as built by DictTrie::Find.
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           const CompactDag &dag, std::vector<WordRange> &res,
+           bool hmm) const {
+    if (!hmm) {
+      mpSeg_.Cut(begin, end, dag, res);
+      return;
     }
+    CutSingles(
+        end,
+        [this, begin, end, &dag](const auto &mp_emit) {
+          mpSeg_.Cut(begin, end, dag, mp_emit);
+        },
+        WordRangeAppender(res));
   }
 
   const DictTrie *GetDictTrie() const { return mpSeg_.GetDictTrie(); }
 
+  // Caches the HMM cuts of the runs of single runes, see
+  // HMMSegment::EnableCache.
+  void EnableHMMCache(size_t max_entries, size_t max_run_len = 16) {
+    hmmSeg_.EnableCache(max_entries, max_run_len);
+  }
+
+  const HMMCache *GetHMMCache() const { return hmmSeg_.GetCache(); }
+
+  // Keeps the runs of ASCII letters and digits in one word each instead of
+  // passing them to the HMM, see MPSegment::EnableAsciiRuns.
+  void EnableAsciiRuns() { mpSeg_.EnableAsciiRuns(); }
+  void DisableAsciiRuns() { mpSeg_.DisableAsciiRuns(); }
+
   bool Tag(const std::string &src,
            std::vector<std::pair<std::string, std::string>> &res) const {
     return tagger_.Tag(src, res, *this);
@@ -115,6 +150,44 @@ public:
   }
 
 private:
+  // Calls emit for the words of the MP segmentation of a range ending at
+  // end, which cut_mp(mp_emit) makes, with the runs of single runes which
+  // are not user words cut again by the HMM.
+  template <typename CutFn, typename Fn>
+  void CutSingles(RuneStrArray::const_iterator end, const CutFn &cut_mp,
+                  Fn &&emit) const {
+    std::vector<WordRange> hmmRes;
+    // the first rune of the run of singles so far, end if there is none
+    RuneStrArray::const_iterator run = end;
+    const auto flush = [this, &hmmRes, &run, end,
+                        &emit](RuneStrArray::const_iterator run_end) {
+      hmmSeg_.Cut(run, run_end, hmmRes);
+      for (size_t k = 0; k < hmmRes.size(); k++) {
+        emit(hmmRes[k].left, hmmRes[k].right,
+             static_cast<const DictUnit *>(NULL));
+      }
+      hmmRes.clear();
+      run = end;
+    };
+    cut_mp([this, &run, end, &flush, &emit](RuneStrArray::const_iterator left,
+                                            RuneStrArray::const_iterator right,
+                                            const DictUnit *unit) {
+      if (left == right && !mpSeg_.IsUserDictSingleChineseWord(left->rune)) {
+        if (run == end) {
+          run = left;
+        }
+        return;
+      }
+      if (run != end) {
+        flush(left);
+      }
+      emit(left, right, unit);
+    });
+    if (run != end) {
+      flush(end);
+    }
+  }
+
   MPSegment mpSeg_;
   HMMSegment hmmSeg_;
   PosTagger tagger_;
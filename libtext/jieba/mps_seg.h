@@ -26,12 +26,20 @@
 
 namespace libtext {
 
+// A segmentation of a sentence with its weight, the sum of the weights of
+// its words.
+struct Segmentation {
+  std::vector<Word> words;
+  double weight;
+}; // struct Segmentation
+
 class MPSegment : public SegmentTagged {
 public:
   MPSegment(const std::string &dictPath, const std::string &userDictPath = "")
-      : dictTrie_(new DictTrie(dictPath, userDictPath)), isNeedDestroy_(true) {}
+      : dictTrie_(new DictTrie(dictPath, userDictPath)), isNeedDestroy_(true),
+        asciiRuns_(false) {}
   MPSegment(const DictTrie *dictTrie)
-      : dictTrie_(dictTrie), isNeedDestroy_(false) {
+      : dictTrie_(dictTrie), isNeedDestroy_(false), asciiRuns_(false) {
     assert(dictTrie_);
   }
   ~MPSegment() {
@@ -52,7 +60,7 @@ public:
   }
   void Cut(const std::string &sentence, std::vector<Word> &words,
            size_t max_word_len = MAX_WORD_LENGTH) const {
-    PreFilter pre_filter(symbols_, sentence);
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
     PreFilter::Range range;
     std::vector<WordRange> wrs;
     wrs.reserve(sentence.size() / 2);
@@ -64,13 +72,245 @@ public:
     words.reserve(wrs.size());
     GetWordsFromWordRanges(sentence, wrs, words);
   }
+  // Calls visit(const WordView &) for the words of Cut in order, without
+  // storing them or copying their strings.
+  template <typename Fn>
+  void Cut(const std::string &sentence, Fn &&visit,
+           size_t max_word_len = MAX_WORD_LENGTH) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    while (pre_filter.HasNext()) {
+      const PreFilter::Range range = pre_filter.Next();
+      Cut(
+          range.begin, range.end,
+          [&sentence, &visit](RuneStrArray::const_iterator left,
+                              RuneStrArray::const_iterator right,
+                              const DictUnit *unit) {
+            visit(GetWordViewFromRunes(sentence, left, right, unit));
+          },
+          max_word_len);
+    }
+  }
   void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
            std::vector<WordRange> &words,
            size_t max_word_len = MAX_WORD_LENGTH) const {
-    std::vector<Dag> dags;
-    dictTrie_->Find(begin, end, dags, max_word_len);
-    CalcDP(dags);
-    CutByDag(begin, end, dags, words);
+    Cut(begin, end, WordRangeAppender(words), max_word_len);
+  }
+  // Calls emit(left, right, unit) for the words [left, right] of [begin,
+  // end) in order, unit being null for a rune which is not a word.
+  template <typename Fn>
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           Fn &&emit, size_t max_word_len = MAX_WORD_LENGTH) const {
+    AsciiRuns runs;
+    FindAsciiRuns(begin, end, max_word_len, runs);
+    std::vector<const DictUnit *> best;
+    CalcDP(begin, end, max_word_len, runs, best);
+    CutByDag(begin, best, runs, emit);
+  }
+  // Cuts [begin, end) over its DAG, as built by DictTrie::Find, instead of
+  // matching the words in the trie again.
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           const CompactDag &dag, std::vector<WordRange> &words) const {
+    Cut(begin, end, dag, WordRangeAppender(words));
+  }
+  template <typename Fn>
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           const CompactDag &dag, Fn &&emit) const {
+    assert(dag.size() == static_cast<size_t>(end - begin));
+    AsciiRuns runs;
+    if (asciiRuns_) {
+      FindAsciiRunsIf(begin, end,
+                      [&dag](size_t i) {
+                        for (size_t k = dag.starts[i];
+                             k < dag.starts[i + 1]; k++) {
+                          if (dag.ends[k] > i) {
+                            return true;
+                          }
+                        }
+                        return false;
+                      },
+                      runs);
+    }
+    std::vector<const DictUnit *> best;
+    CalcDP(dag, runs, best);
+    CutByDag(begin, best, runs, emit);
+  }
+
+  // Keeps each run of ASCII letters and digits, like "iPhone15", with the
+  // dots between its digits, like "3.14", in one word instead of a word
+  // per rune. A run in which a dictionary word of two runes or more starts
+  // is cut as before; a word which starts before a run and ends inside it
+  // is not taken. The run weighs as one rune which is not a word. Applies
+  // to Cut, CutNBest and CutLattice; not to be called while other threads
+  // are cutting.
+  void EnableAsciiRuns() { asciiRuns_ = true; }
+  void DisableAsciiRuns() { asciiRuns_ = false; }
+  bool IsAsciiRunsEnabled() const { return asciiRuns_; }
+
+  // Stores the k best segmentations of the sentence in res, best first; the
+  // first one is the one of Cut. Each rune keeps its k best suffixes, which
+  // are merged from the suffixes after its words with a heap, so this costs
+  // about one Cut plus k steps per rune. A rune keeps no more suffixes than
+  // it has, so a k larger than the number of segmentations, SIZE_MAX for
+  // all of them, costs no more than that number.
+  void CutNBest(const std::string &sentence, size_t k,
+                std::vector<Segmentation> &res,
+                size_t max_word_len = MAX_WORD_LENGTH) const {
+    res.clear();
+    if (k == 0) {
+      return;
+    }
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    std::vector<PreFilter::Range> ranges;
+    while (pre_filter.HasNext()) {
+      ranges.push_back(pre_filter.Next());
+    }
+    if (ranges.empty()) {
+      res.push_back(Segmentation{std::vector<Word>(), 0.0});
+      return;
+    }
+    const RuneStrArray::const_iterator begin = ranges.front().begin;
+    const size_t n = static_cast<size_t>(ranges.back().end - begin);
+    // the suffixes of rune i are entries[starts[i], starts[i] + counts[i])
+    std::vector<NBestEntry> entries;
+    std::vector<size_t> starts(n + 1);
+    std::vector<size_t> counts(n + 1);
+    entries.push_back(NBestEntry{0.0, NULL, 0, 0});
+    starts[n] = 0;
+    counts[n] = 1;
+    const double minWeight = dictTrie_->GetMinWeight();
+    turbo::InlinedVector<std::pair<size_t, const DictUnit *>, 8> edges;
+    turbo::InlinedVector<NBestCandidate, 16> heap;
+    AsciiRuns runs;
+    for (size_t r = ranges.size(); r-- > 0;) {
+      const size_t first = static_cast<size_t>(ranges[r].begin - begin);
+      runs.clear();
+      FindAsciiRuns(ranges[r].begin, ranges[r].end, max_word_len, runs);
+      size_t run = runs.size();
+      for (size_t i = static_cast<size_t>(ranges[r].end - begin);
+           i-- > first;) {
+        edges.clear();
+        if (run > 0 && i - first >= runs[run - 1].start &&
+            i - first < runs[run - 1].start + runs[run - 1].len) {
+          if (i - first > runs[run - 1].start) {
+            // no suffix starts inside a run
+            starts[i] = entries.size();
+            counts[i] = 0;
+            continue;
+          }
+          --run;
+          edges.push_back(std::make_pair(runs[run].len,
+                                         static_cast<const DictUnit *>(NULL)));
+        } else {
+          // the words ending inside a run lead to no suffix
+          dictTrie_->ForEachPrefix(
+              begin + i, ranges[r].end, max_word_len,
+              [&edges, &counts, i](size_t len, const DictUnit *p) {
+                if (counts[i + len] > 0) {
+                  edges.push_back(std::make_pair(len, p));
+                }
+              });
+        }
+        // at most k suffixes, and no more than the words lead to
+        size_t bound = 0;
+        for (size_t e = 0; e < edges.size(); e++) {
+          const size_t next = counts[i + edges[e].first];
+          bound = next < k - bound ? bound + next : k;
+        }
+        starts[i] = entries.size();
+        entries.resize(entries.size() + bound);
+        NBestEntry *out = &entries[starts[i]];
+        if (edges.size() == 1) {
+          // the suffixes after the only word, in the same order
+          const size_t len = edges[0].first;
+          const NBestEntry *next = &entries[starts[i + len]];
+          const double weight =
+              edges[0].second ? edges[0].second->weight : minWeight;
+          counts[i] = bound;
+          for (size_t rank = 0; rank < counts[i]; rank++) {
+            out[rank] = NBestEntry{next[rank].weight + weight,
+                                   edges[0].second,
+                                   static_cast<uint32_t>(len),
+                                   static_cast<uint32_t>(rank)};
+          }
+          continue;
+        }
+        heap.clear();
+        for (size_t e = 0; e < edges.size(); e++) {
+          heap.push_back(NBestCandidate{
+              SuffixWeight(entries, starts, i, edges[e], 0, minWeight), e, 0});
+        }
+        std::make_heap(heap.begin(), heap.end());
+        size_t count = 0;
+        while (count < bound && !heap.empty()) {
+          std::pop_heap(heap.begin(), heap.end());
+          const NBestCandidate c = heap.back();
+          heap.pop_back();
+          const size_t len = edges[c.edge].first;
+          out[count++] = NBestEntry{c.weight, edges[c.edge].second,
+                                    static_cast<uint32_t>(len), c.rank};
+          if (c.rank + 1 < counts[i + len]) {
+            heap.push_back(NBestCandidate{SuffixWeight(entries, starts, i,
+                                                       edges[c.edge],
+                                                       c.rank + 1, minWeight),
+                                          c.edge, c.rank + 1});
+            std::push_heap(heap.begin(), heap.end());
+          }
+        }
+        counts[i] = count;
+      }
+    }
+
+    res.resize(counts[0]);
+    for (size_t r = 0; r < counts[0]; r++) {
+      res[r].weight = entries[starts[0] + r].weight;
+      size_t i = 0;
+      size_t rank = r;
+      while (i < n) {
+        const NBestEntry &e = entries[starts[i] + rank];
+        res[r].words.push_back(
+            GetWordFromRunes(sentence, begin + i, begin + i + e.len - 1));
+        i += e.len;
+        rank = e.rank;
+      }
+    }
+  }
+
+  // Stores every word of the dictionary found in the sentence, and every
+  // rune which is not one, with its weight in weights. The words are ordered
+  // by offset then length, and the segmentations of Cut and CutNBest are
+  // paths of them; runes which are not words weigh the min weight, and so
+  // do the ASCII runs kept whole, see EnableAsciiRuns.
+  void CutLattice(const std::string &sentence, std::vector<Word> &words,
+                  std::vector<double> &weights,
+                  size_t max_word_len = MAX_WORD_LENGTH) const {
+    words.clear();
+    weights.clear();
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    const double minWeight = dictTrie_->GetMinWeight();
+    AsciiRuns runs;
+    while (pre_filter.HasNext()) {
+      const PreFilter::Range range = pre_filter.Next();
+      runs.clear();
+      FindAsciiRuns(range.begin, range.end, max_word_len, runs);
+      size_t run = 0;
+      for (RuneStrArray::const_iterator it = range.begin; it != range.end;
+           ++it) {
+        dictTrie_->ForEachPrefix(
+            it, range.end, max_word_len,
+            [&](size_t len, const DictUnit *p) {
+              words.push_back(GetWordFromRunes(sentence, it, it + (len - 1)));
+              weights.push_back(p ? p->weight : minWeight);
+            });
+        // only the rune alone is a word where a run starts
+        if (run < runs.size() &&
+            runs[run].start == static_cast<size_t>(it - range.begin)) {
+          words.push_back(
+              GetWordFromRunes(sentence, it, it + (runs[run].len - 1)));
+          weights.push_back(minWeight);
+          run++;
+        }
+      }
+    }
   }
 
   const DictTrie *GetDictTrie() const { return dictTrie_; }
@@ -85,52 +325,221 @@ public:
   }
 
 private:
-  void CalcDP(std::vector<Dag> &dags) const {
-    size_t nextPos;
-    const DictUnit *p;
-    double val;
-
-    for (std::vector<Dag>::reverse_iterator rit = dags.rbegin();
-         rit != dags.rend(); rit++) {
-      rit->pInfo = NULL;
-      rit->weight = MIN_DOUBLE;
-      assert(!rit->nexts.empty());
-      for (turbo::InlinedVector<std::pair<size_t, const DictUnit *>,
-                                8>::const_iterator it = rit->nexts.begin();
-           it != rit->nexts.end(); it++) {
-        nextPos = it->first;
-        p = it->second;
-        val = 0.0;
-        if (nextPos + 1 < dags.size()) {
-          val += dags[nextPos + 1].weight;
-        }
+  // One of the best suffixes of a rune: its weight, its first word, whose
+  // unit is null for a rune which is not a word, and the rank of the rest
+  // among the suffixes after that word.
+  struct NBestEntry {
+    double weight;
+    const DictUnit *unit;
+    uint32_t len;
+    uint32_t rank;
+  }; // struct NBestEntry
 
-        if (p) {
-          val += p->weight;
-        } else {
-          val += dictTrie_->GetMinWeight();
-        }
-        if (val > rit->weight) {
-          rit->pInfo = p;
-          rit->weight = val;
+  // A suffix of a rune made of one of its words and the suffix of the given
+  // rank after it. Better candidates compare greater; of equal weights the
+  // shorter word wins, as in CalcDP.
+  struct NBestCandidate {
+    double weight;
+    size_t edge;
+    uint32_t rank;
+    bool operator<(const NBestCandidate &other) const {
+      if (weight != other.weight) {
+        return weight < other.weight;
+      }
+      if (edge != other.edge) {
+        return edge > other.edge;
+      }
+      return rank > other.rank;
+    }
+  }; // struct NBestCandidate
+
+  static double
+  SuffixWeight(const std::vector<NBestEntry> &entries,
+               const std::vector<size_t> &starts, size_t i,
+               const std::pair<size_t, const DictUnit *> &edge, size_t rank,
+               double minWeight) {
+    return entries[starts[i + edge.first] + rank].weight +
+           (edge.second ? edge.second->weight : minWeight);
+  }
+
+  // A run [start, start + len) of the runes of a range which is cut as one
+  // word, see EnableAsciiRuns.
+  struct AsciiRun {
+    size_t start;
+    size_t len;
+  }; // struct AsciiRun
+  typedef turbo::InlinedVector<AsciiRun, 8> AsciiRuns;
+
+  static bool IsAsciiAlnum(RuneStrArray::const_iterator it) {
+    return it->rune < 0x80 &&
+           (it->char_class & (CharClassLetter | CharClassDigit)) != 0;
+  }
+  static bool IsAsciiDigit(RuneStrArray::const_iterator it) {
+    return it->rune >= '0' && it->rune <= '9';
+  }
+
+  // Stores in runs the runs of two runes or more of [begin, end), in order,
+  // in none of whose runes starts_word(i) finds a word starting.
+  template <typename StartsWord>
+  static void FindAsciiRunsIf(RuneStrArray::const_iterator begin,
+                            RuneStrArray::const_iterator end,
+                            const StartsWord &starts_word, AsciiRuns &runs) {
+    const size_t n = static_cast<size_t>(end - begin);
+    for (size_t i = 0; i < n;) {
+      if (!IsAsciiAlnum(begin + i)) {
+        i++;
+        continue;
+      }
+      size_t j = i + 1;
+      while (j < n && (IsAsciiAlnum(begin + j) ||
+                       ((begin + j)->rune == '.' && j + 1 < n &&
+                        IsAsciiDigit(begin + (j - 1)) &&
+                        IsAsciiDigit(begin + (j + 1))))) {
+        j++;
+      }
+      bool keep = j - i >= 2;
+      for (size_t k = i; keep && k < j; k++) {
+        keep = !starts_word(k);
+      }
+      if (keep) {
+        runs.push_back(AsciiRun{i, j - i});
+      }
+      i = j;
+    }
+  }
+  // The runs of [begin, end) if they are enabled, the words starting in
+  // them being matched in the trie; the runes which no word contains, most
+  // letters and digits, are not looked up.
+  void FindAsciiRuns(RuneStrArray::const_iterator begin,
+                     RuneStrArray::const_iterator end, size_t max_word_len,
+                     AsciiRuns &runs) const {
+    if (!asciiRuns_) {
+      return;
+    }
+    FindAsciiRunsIf(begin, end,
+                    [this, begin, end, max_word_len](size_t i) {
+                      if (dictTrie_->IsAsciiNotInWords((begin + i)->rune)) {
+                        return false;
+                      }
+                      bool found = false;
+                      dictTrie_->ForEachPrefix(
+                          begin + i, end, max_word_len,
+                          [&found](size_t len, const DictUnit *) {
+                            found = found || len >= 2;
+                          });
+                      return found;
+                    },
+                    runs);
+  }
+
+  // Sets weights[i] and best[i] if the rune i is in a run, runs[r - 1]
+  // being the last run which does not start after it: a run is one word,
+  // and no word ends inside it.
+  static bool CalcRunDP(const AsciiRuns &runs, size_t &r, size_t i,
+                        double minWeight, std::vector<double> &weights,
+                        std::vector<const DictUnit *> &best) {
+    if (r == 0 || i < runs[r - 1].start ||
+        i >= runs[r - 1].start + runs[r - 1].len) {
+      return false;
+    }
+    best[i] = NULL;
+    if (i == runs[r - 1].start) {
+      weights[i] = weights[i + runs[r - 1].len] + minWeight;
+      r--;
+    } else {
+      weights[i] = MIN_DOUBLE;
+    }
+    return true;
+  }
+
+  // Stores in best[i] the first word of the best segmentation of the runes
+  // from i on, or null if it is the rune i alone or a run. The runes are
+  // visited backwards and the words starting at a rune are matched in the
+  // trie right away, so the weights of their ends are known and the DAG is
+  // never built.
+  void CalcDP(RuneStrArray::const_iterator begin,
+              RuneStrArray::const_iterator end, size_t max_word_len,
+              const AsciiRuns &runs,
+              std::vector<const DictUnit *> &best) const {
+    const size_t n = static_cast<size_t>(end - begin);
+    const double minWeight = dictTrie_->GetMinWeight();
+    // weights[i] is the weight of the runes from i on
+    std::vector<double> weights(n + 1);
+    weights[n] = 0.0;
+    best.resize(n);
+    size_t r = runs.size();
+    for (size_t i = n; i-- > 0;) {
+      if (CalcRunDP(runs, r, i, minWeight, weights, best)) {
+        continue;
+      }
+      const DictUnit *pInfo = NULL;
+      double weight = MIN_DOUBLE;
+      const double *next = &weights[i];
+      dictTrie_->ForEachPrefix(
+          begin + i, end, max_word_len,
+          [&](size_t len, const DictUnit *p) {
+            const double val = next[len] + (p ? p->weight : minWeight);
+            if (val > weight) {
+              pInfo = p;
+              weight = val;
+            }
+          });
+      best[i] = pInfo;
+      weights[i] = weight;
+    }
+  }
+  void CalcDP(const CompactDag &dag, const AsciiRuns &runs,
+              std::vector<const DictUnit *> &best) const {
+    const size_t n = dag.size();
+    const double minWeight = dictTrie_->GetMinWeight();
+    std::vector<double> weights(n + 1);
+    weights[n] = 0.0;
+    best.resize(n);
+    size_t r = runs.size();
+    for (size_t i = n; i-- > 0;) {
+      if (CalcRunDP(runs, r, i, minWeight, weights, best)) {
+        continue;
+      }
+      const DictUnit *pInfo = NULL;
+      double weight = MIN_DOUBLE;
+      for (size_t k = dag.starts[i]; k < dag.starts[i + 1]; k++) {
+        const DictUnit *p = dag.units[k];
+        const double val =
+            weights[dag.ends[k] + 1] + (p ? p->weight : minWeight);
+        if (val > weight) {
+          pInfo = p;
+          weight = val;
         }
       }
+      best[i] = pInfo;
+      weights[i] = weight;
     }
   }
-  void CutByDag(RuneStrArray::const_iterator begin,
-                RuneStrArray::const_iterator end, const std::vector<Dag> &dags,
-                std::vector<WordRange> &words) const {
+  template <typename Fn>
+  static void CutByDag(RuneStrArray::const_iterator begin,
+                       const std::vector<const DictUnit *> &best,
+                       const AsciiRuns &runs, Fn &emit) {
     size_t i = 0;
-    while (i < dags.size()) {
-      const DictUnit *p = dags[i].pInfo;
+    size_t r = 0;
+    while (i < best.size()) {
+      // skips the runs inside a word
+      while (r < runs.size() && runs[r].start < i) {
+        r++;
+      }
+      if (r < runs.size() && runs[r].start == i) {
+        emit(begin + i, begin + i + runs[r].len - 1,
+             static_cast<const DictUnit *>(NULL));
+        i += runs[r].len;
+        r++;
+        continue;
+      }
+      const DictUnit *p = best[i];
       if (p) {
         assert(p->word.size() >= 1);
-        WordRange wr(begin + i, begin + i + p->word.size() - 1);
-        words.push_back(wr);
+        emit(begin + i, begin + i + p->word.size() - 1, p);
         i += p->word.size();
       } else { // single chinese word
-        WordRange wr(begin + i, begin + i);
-        words.push_back(wr);
+        emit(begin + i, begin + i, p);
         i++;
       }
     }
@@ -138,6 +547,7 @@ private:
 
   const DictTrie *dictTrie_;
   bool isNeedDestroy_;
+  bool asciiRuns_;
   PosTagger tagger_;
 
 }; // class MPSegment
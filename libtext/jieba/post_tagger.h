@@ -66,9 +66,11 @@ private:
     size_t m = 0;
     size_t eng = 0;
     for (size_t i = 0; i < unicode.size() && eng < unicode.size() / 2; i++) {
-      if (unicode[i].rune < 0x80) {
+      // ascii, and letters and digits of other widths and scripts
+      if (unicode[i].rune < 0x80 ||
+          (unicode[i].char_class & (CharClassLetter | CharClassDigit))) {
         eng++;
-        if ('0' <= unicode[i].rune && unicode[i].rune <= '9') {
+        if (unicode[i].char_class == CharClassDigit) {
           m++;
         }
       }
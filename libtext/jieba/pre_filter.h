@@ -22,6 +22,34 @@
 
 namespace libtext {
 
+// The classes of a set of symbols, so that a rune is only looked up in the
+// set when it is of one of them.
+class SymbolClasses {
+public:
+  SymbolClasses() : classes_(0), other_(false) {}
+
+  explicit SymbolClasses(const turbo::flat_hash_set<Rune> &symbols)
+      : SymbolClasses() {
+    for (Rune symbol : symbols) {
+      Add(symbol);
+    }
+  }
+
+  void Add(Rune symbol) {
+    const CharClass cls = GetCharClass(symbol);
+    classes_ |= cls;
+    other_ = other_ || cls == CharClassOther;
+  }
+
+  bool MayContain(CharClass cls) const {
+    return cls == CharClassOther ? other_ : (cls & classes_) != 0;
+  }
+
+private:
+  uint8_t classes_;
+  bool other_;
+}; // class SymbolClasses
+
 class PreFilter {
 public:
   // TODO use WordRange instead of Range
@@ -32,7 +60,12 @@ public:
 
   PreFilter(const turbo::flat_hash_set<Rune> &symbols,
             const std::string &sentence)
-      : symbols_(symbols) {
+      : PreFilter(symbols, SymbolClasses(symbols), sentence) {}
+
+  // `classes` must be the classes of `symbols`, see SymbolClasses.
+  PreFilter(const turbo::flat_hash_set<Rune> &symbols,
+            const SymbolClasses &classes, const std::string &sentence)
+      : symbols_(symbols), symbol_classes_(classes) {
     if (!DecodeRunesInString(sentence, sentence_)) {
       TURBO_LOG(ERROR) << "decode failed. ";
     }
@@ -44,7 +77,8 @@ public:
     Range range;
     range.begin = cursor_;
     while (cursor_ != sentence_.end()) {
-      if (symbols_.find(cursor_->rune) != symbols_.end()) {
+      if (symbol_classes_.MayContain(cursor_->char_class) &&
+          symbols_.find(cursor_->rune) != symbols_.end()) {
         if (range.begin == cursor_) {
           cursor_++;
         }
@@ -61,6 +95,7 @@ private:
   RuneStrArray::const_iterator cursor_;
   RuneStrArray sentence_;
   const turbo::flat_hash_set<Rune> &symbols_;
+  SymbolClasses symbol_classes_;
 }; // class PreFilter
 
 } // namespace libtext
@@ -56,3 +56,44 @@ TEST(PreFilterTest, Test1) {
     ASSERT_EQ(res, expected);
   }
 }
+
+TEST(PreFilterTest, CharClass) {
+  ASSERT_EQ(GetCharClass(U'a'), CharClassLetter);
+  ASSERT_EQ(GetCharClass(U'Ｚ'), CharClassLetter);
+  ASSERT_EQ(GetCharClass(U'я'), CharClassLetter);
+  ASSERT_EQ(GetCharClass(U'7'), CharClassDigit);
+  ASSERT_EQ(GetCharClass(U'７'), CharClassDigit);
+  ASSERT_EQ(GetCharClass(U'中'), CharClassIdeograph);
+  ASSERT_EQ(GetCharClass(U'\U00020000'), CharClassIdeograph);
+  ASSERT_EQ(GetCharClass(U'か'), CharClassKana);
+  ASSERT_EQ(GetCharClass(U'ｶ'), CharClassKana);
+  ASSERT_EQ(GetCharClass(U'한'), CharClassHangul);
+  ASSERT_EQ(GetCharClass(U'，'), CharClassPunct);
+  ASSERT_EQ(GetCharClass(U'。'), CharClassPunct);
+  ASSERT_EQ(GetCharClass(U'$'), CharClassPunct);
+  ASSERT_EQ(GetCharClass(U'　'), CharClassSpace);
+  ASSERT_EQ(GetCharClass(U'\t'), CharClassSpace);
+  ASSERT_EQ(GetCharClass(U'\U0001f600'), CharClassEmoji);
+  ASSERT_EQ(GetCharClass(0x0), CharClassOther);
+  ASSERT_EQ(GetCharClass(0x110000), CharClassOther);
+
+  RuneStrArray runes;
+  ASSERT_TRUE(DecodeRunesInString("a，中", runes));
+  ASSERT_EQ(runes[0].char_class, CharClassLetter);
+  ASSERT_EQ(runes[1].char_class, CharClassPunct);
+  ASSERT_EQ(runes[2].char_class, CharClassIdeograph);
+
+  // symbols of any class still split
+  turbo::flat_hash_set<Rune> symbol;
+  symbol.insert(U'x');
+  symbol.insert(0x1);
+  std::string s = "abxcd\x01" "ef";
+  PreFilter filter(symbol, s);
+  std::vector<std::string> words;
+  while (filter.HasNext()) {
+    PreFilter::Range range = filter.Next();
+    words.push_back(GetStringFromRunes(s, range.begin, range.end - 1));
+  }
+  ASSERT_EQ(turbo::StrJoin(words.begin(), words.end(), "/"),
+            "ab/x/cd/\x01/ef");
+}
@@ -0,0 +1,521 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_SEGMENT_PRE_TOKENIZER_H_
+#define LIBTEXT_SEGMENT_PRE_TOKENIZER_H_
+
+#include "libtext/common/simd_scan.h"
+#include "libtext/jieba/unicode.h"
+#include "libtext/normalize/emoji_filter.h"
+#include <cstring>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libtext {
+
+// Finds the entities of a sentence which the segmenters would shred into
+// many words, URLs, emails, IPs, dates and times, numbers and emoji, so
+// that they are kept whole and the segmenters only cut the text between
+// them. A sentence is scanned once: the bytes an entity can start with are
+// found with SIMD, and at a start the recognizers of its class run, each a
+// small deterministic automaton over a table of byte classes, the longest
+// match winning. Emoji are the keys of the unicode table of EmojiFilter,
+// followed by variation selectors, skin tones and ZWJ joined emoji.
+class PreTokenizer {
+public:
+  enum EntityType : uint8_t {
+    EntityNone = 0, // text for the segmenters
+    EntityUrl,      // http://, https://, ftp:// or www. and a host
+    EntityEmail,
+    EntityIp,     // IPv4, with a port
+    EntityDate,   // 2023-05-21, 2023/5/21, 2023.05.21, with a time
+    EntityTime,   // 12:30, 12:30:59, 12:30:59.250
+    EntityNumber, // 42, 1,234.5, 99.5%
+    EntityEmoji,
+  }; // enum EntityType
+
+  struct Options {
+    bool urls;
+    bool emails;
+    bool ips;
+    bool dates; // dates and times
+    bool numbers;
+    bool emoji;
+
+    Options()
+        : urls(true), emails(true), ips(true), dates(true), numbers(true),
+          emoji(true) {}
+  }; // struct Options
+
+  // A piece of a sentence, in bytes.
+  struct Span {
+    uint32_t offset;
+    uint32_t length;
+    EntityType type;
+  }; // struct Span
+
+  explicit PreTokenizer(const Options &options = Options())
+      : options_(options), emoji_(EmojiFilter::Options()) {
+    for (int c = 0; c < 256; ++c) {
+      const uint8_t cls = Classes()[c];
+      if (((cls & ByteClassAlpha) &&
+           (options_.urls || options_.emails)) ||
+          ((cls & ByteClassDigit) && (options_.ips || options_.dates ||
+                                      options_.numbers || options_.emails)) ||
+          (options_.emoji &&
+           emoji_.lead_bytes().Contains(static_cast<unsigned char>(c)))) {
+        starts_.Insert(static_cast<unsigned char>(c));
+      }
+    }
+  }
+
+  const Options &GetOptions() const { return options_; }
+
+  static const char *GetTypeName(EntityType type) {
+    static const char *const kNames[] = {"",     "url",  "email",  "ip",
+                                         "date", "time", "number", "emoji"};
+    return kNames[type];
+  }
+
+  // Splits text into entities and the text between them, in order.
+  void Split(const std::string_view &text, std::vector<Span> &spans) const {
+    spans.clear();
+    const char *s = text.data();
+    const size_t n = text.size();
+    size_t last = 0;
+    size_t i = 0;
+    while (i < n) {
+      i += starts_.FindFirst(s + i, n - i);
+      if (i == n) {
+        break;
+      }
+      EntityType type = EntityNone;
+      const size_t len = Match(s, n, i, &type);
+      if (len == 0) {
+        // no entity starts inside a run of letters and digits either
+        const size_t next = i + 1;
+        while (++i < n && (Classes()[static_cast<unsigned char>(s[i])] &
+                           (ByteClassAlpha | ByteClassDigit))) {
+        }
+        i = std::max(i, next);
+        continue;
+      }
+      if (i > last) {
+        spans.push_back(Span{static_cast<uint32_t>(last),
+                             static_cast<uint32_t>(i - last), EntityNone});
+      }
+      spans.push_back(Span{static_cast<uint32_t>(i),
+                           static_cast<uint32_t>(len), type});
+      i += len;
+      last = i;
+    }
+    if (n > last) {
+      spans.push_back(Span{static_cast<uint32_t>(last),
+                           static_cast<uint32_t>(n - last), EntityNone});
+    }
+  }
+
+  // Cuts the text between the entities of sentence with cut(text, words)
+  // and stores its words and the entities in words, in order, with the
+  // offsets in sentence. types, if not null, gets the type of every word,
+  // EntityNone for the words of cut.
+  template <typename Fn>
+  void Cut(const std::string &sentence, std::vector<Word> &words, Fn &&cut,
+           std::vector<EntityType> *types = nullptr) const {
+    std::vector<Span> spans;
+    Split(sentence, spans);
+    if (spans.size() <= 1 && (spans.empty() || spans[0].type == EntityNone)) {
+      cut(sentence, words);
+      if (types != nullptr) {
+        types->assign(words.size(), EntityNone);
+      }
+      return;
+    }
+    words.clear();
+    if (types != nullptr) {
+      types->clear();
+    }
+    std::vector<Word> tmp;
+    uint32_t runes = 0;
+    for (const Span &span : spans) {
+      const uint32_t num_runes =
+          CountRunes(sentence.data() + span.offset, span.length);
+      if (span.type == EntityNone) {
+        cut(sentence.substr(span.offset, span.length), tmp);
+        for (Word &w : tmp) {
+          w.offset += span.offset;
+          w.unicode_offset += runes;
+          words.push_back(std::move(w));
+        }
+        if (types != nullptr) {
+          types->resize(words.size(), EntityNone);
+        }
+      } else {
+        words.push_back(Word(sentence.substr(span.offset, span.length),
+                             span.offset, runes, num_runes));
+        if (types != nullptr) {
+          types->push_back(span.type);
+        }
+      }
+      runes += num_runes;
+    }
+  }
+
+private:
+  enum ByteClass : uint8_t {
+    ByteClassDigit = 1 << 0,
+    ByteClassAlpha = 1 << 1,
+    ByteClassLocal = 1 << 2, // in the local part of an email
+    ByteClassUrl = 1 << 3,   // in a URL after its host
+    ByteClassGlue = 1 << 4,  // joins letters and digits into one token
+  }; // enum ByteClass
+
+  static const uint8_t *Classes() {
+    static const struct Table {
+      uint8_t classes[256];
+      Table() {
+        std::memset(classes, 0, sizeof(classes));
+        for (int c = '0'; c <= '9'; ++c) {
+          classes[c] |= ByteClassDigit | ByteClassLocal | ByteClassUrl;
+        }
+        for (int c = 'a'; c <= 'z'; ++c) {
+          classes[c] |= ByteClassAlpha | ByteClassLocal | ByteClassUrl;
+          classes[c - 'a' + 'A'] |=
+              ByteClassAlpha | ByteClassLocal | ByteClassUrl;
+        }
+        for (const char *p = "._%+-"; *p; ++p) {
+          classes[static_cast<unsigned char>(*p)] |= ByteClassLocal;
+        }
+        for (const char *p = "-._~:/?#[]@!$&'()*+,;=%"; *p; ++p) {
+          classes[static_cast<unsigned char>(*p)] |= ByteClassUrl;
+        }
+        for (const char *p = "._@%+:,"; *p; ++p) {
+          classes[static_cast<unsigned char>(*p)] |= ByteClassGlue;
+        }
+      }
+    } table;
+    return table.classes;
+  }
+
+  static bool Is(char c, uint8_t cls) {
+    return (Classes()[static_cast<unsigned char>(c)] & cls) != 0;
+  }
+
+  static uint32_t CountRunes(const char *s, size_t n) {
+    uint32_t count = 0;
+    for (size_t i = 0; i < n; ++i) {
+      count += (static_cast<unsigned char>(s[i]) & 0xc0) != 0x80;
+    }
+    return count;
+  }
+
+  // The length of the entity at s[i], 0 if there is none.
+  size_t Match(const char *s, size_t n, size_t i, EntityType *type) const {
+    size_t best = 0;
+    const auto consider = [&best, type](size_t len, EntityType t) {
+      if (len > best) {
+        best = len;
+        *type = t;
+      }
+    };
+    const bool word_start = i == 0 || !Is(s[i - 1], ByteClassAlpha |
+                                                        ByteClassDigit |
+                                                        ByteClassGlue);
+    if (word_start && Is(s[i], ByteClassAlpha)) {
+      if (options_.urls) {
+        consider(MatchUrl(s, n, i), EntityUrl);
+      }
+      if (options_.emails) {
+        consider(MatchEmail(s, n, i), EntityEmail);
+      }
+    } else if (word_start && Is(s[i], ByteClassDigit)) {
+      if (options_.emails) {
+        consider(MatchEmail(s, n, i), EntityEmail);
+      }
+      if (options_.ips) {
+        consider(Delimited(s, n, i, MatchIp(s, n, i)), EntityIp);
+      }
+      if (options_.dates) {
+        consider(Delimited(s, n, i, MatchDate(s, n, i)), EntityDate);
+        consider(Delimited(s, n, i, MatchTime(s, n, i)), EntityTime);
+      }
+      if (options_.numbers) {
+        consider(Delimited(s, n, i, MatchNumber(s, n, i)), EntityNumber);
+      }
+    }
+    if (options_.emoji) {
+      consider(MatchEmoji(s, n, i), EntityEmoji);
+    }
+    return best;
+  }
+
+  // len if the match of len bytes at s[i] is not followed by a letter or
+  // a digit, or by a dot, colon or comma joining one, 0 otherwise, so that
+  // 1.2.3 or 12:30:5x are not cut into an entity and a rest.
+  static size_t Delimited(const char *s, size_t n, size_t i, size_t len) {
+    if (len == 0 || i + len == n) {
+      return len;
+    }
+    const char c = s[i + len];
+    if (Is(c, ByteClassAlpha | ByteClassDigit)) {
+      return 0;
+    }
+    if ((c == '.' || c == ':' || c == ',') && i + len + 1 < n &&
+        Is(s[i + len + 1], ByteClassAlpha | ByteClassDigit)) {
+      return 0;
+    }
+    return len;
+  }
+
+  static bool StartsWith(const char *s, size_t n, size_t i,
+                         const char *prefix) {
+    for (; *prefix; ++prefix, ++i) {
+      if (i == n || (s[i] | 0x20) != *prefix) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Reads up to max_len digits at s[*i] into *value and returns how many.
+  static size_t Digits(const char *s, size_t n, size_t *i, size_t max_len,
+                       uint32_t *value) {
+    size_t len = 0;
+    *value = 0;
+    while (*i < n && len < max_len && Is(s[*i], ByteClassDigit)) {
+      *value = *value * 10 + (s[*i] - '0');
+      ++*i;
+      ++len;
+    }
+    return len;
+  }
+
+  static size_t MatchUrl(const char *s, size_t n, size_t i) {
+    size_t j = i;
+    bool www = false;
+    if (StartsWith(s, n, i, "http://")) {
+      j += 7;
+    } else if (StartsWith(s, n, i, "https://")) {
+      j += 8;
+    } else if (StartsWith(s, n, i, "ftp://")) {
+      j += 6;
+    } else if (StartsWith(s, n, i, "www.")) {
+      www = true;
+    } else {
+      return 0;
+    }
+    const size_t host = j;
+    while (j < n &&
+           (Is(s[j], ByteClassAlpha | ByteClassDigit) || s[j] == '-' ||
+            s[j] == '.')) {
+      ++j;
+    }
+    if (j == host ||
+        (www && std::memchr(s + host + 4, '.', j - host - 4) == nullptr)) {
+      return 0;
+    }
+    while (j < n && Is(s[j], ByteClassUrl)) {
+      ++j;
+    }
+    // punctuation after a URL is rarely a part of it
+    while (j > host + 1 && std::strchr(".,;:!?)'", s[j - 1]) != nullptr) {
+      --j;
+    }
+    return j - i;
+  }
+
+  static size_t MatchEmail(const char *s, size_t n, size_t i) {
+    size_t j = i;
+    while (j < n && Is(s[j], ByteClassLocal)) {
+      ++j;
+    }
+    if (j == n || s[j] != '@') {
+      return 0;
+    }
+    ++j;
+    // labels of letters, digits and inner hyphens, the last of letters
+    size_t end = 0;
+    size_t labels = 0;
+    for (;;) {
+      const size_t label = j;
+      bool alpha = true;
+      while (j < n && (Is(s[j], ByteClassAlpha | ByteClassDigit) ||
+                       s[j] == '-')) {
+        alpha = alpha && Is(s[j], ByteClassAlpha);
+        ++j;
+      }
+      if (j == label || s[label] == '-' || s[j - 1] == '-') {
+        break;
+      }
+      if (++labels >= 2 && alpha && j - label >= 2) {
+        end = j;
+      }
+      if (j + 1 < n && s[j] == '.' && Is(s[j + 1], ByteClassAlpha |
+                                                       ByteClassDigit)) {
+        ++j;
+        continue;
+      }
+      break;
+    }
+    return end == 0 ? 0 : end - i;
+  }
+
+  static size_t MatchIp(const char *s, size_t n, size_t i) {
+    size_t j = i;
+    uint32_t value;
+    for (int part = 0; part < 4; ++part) {
+      if (part > 0) {
+        if (j == n || s[j] != '.') {
+          return 0;
+        }
+        ++j;
+      }
+      if (Digits(s, n, &j, 3, &value) == 0 || value > 255 ||
+          (j < n && Is(s[j], ByteClassDigit))) {
+        return 0;
+      }
+    }
+    size_t k = j + 1;
+    if (j < n && s[j] == ':' && Digits(s, n, &k, 5, &value) > 0 &&
+        value <= 65535) {
+      j = k;
+    }
+    return j - i;
+  }
+
+  static size_t MatchDate(const char *s, size_t n, size_t i) {
+    size_t j = i;
+    uint32_t year, month, day;
+    if (Digits(s, n, &j, 4, &year) != 4 || j == n) {
+      return 0;
+    }
+    const char sep = s[j];
+    if (sep != '-' && sep != '/' && sep != '.') {
+      return 0;
+    }
+    ++j;
+    if (Digits(s, n, &j, 2, &month) == 0 || month < 1 || month > 12 ||
+        j == n || s[j] != sep) {
+      return 0;
+    }
+    ++j;
+    if (Digits(s, n, &j, 2, &day) == 0 || day < 1 || day > 31) {
+      return 0;
+    }
+    // a time after T or a space makes a timestamp
+    if (j + 1 < n && (s[j] == 'T' || s[j] == ' ')) {
+      const size_t time = MatchTime(s, n, j + 1);
+      if (time > 0) {
+        j += 1 + time;
+        if (j < n && s[j] == 'Z') {
+          ++j;
+        }
+      }
+    }
+    return j - i;
+  }
+
+  static size_t MatchTime(const char *s, size_t n, size_t i) {
+    size_t j = i;
+    uint32_t hour, minute, second;
+    if (Digits(s, n, &j, 2, &hour) == 0 || hour > 23 || j == n ||
+        s[j] != ':') {
+      return 0;
+    }
+    ++j;
+    if (Digits(s, n, &j, 2, &minute) != 2 || minute > 59) {
+      return 0;
+    }
+    size_t k = j + 1;
+    if (j < n && s[j] == ':' && Digits(s, n, &k, 2, &second) == 2 &&
+        second <= 60) {
+      j = k;
+      k = j + 1;
+      if (j < n && s[j] == '.' && Digits(s, n, &k, 9, &second) > 0) {
+        j = k;
+      }
+    }
+    return j - i;
+  }
+
+  static size_t MatchNumber(const char *s, size_t n, size_t i) {
+    size_t j = i;
+    uint32_t value;
+    const size_t lead = Digits(s, n, &j, 3, &value);
+    while (j < n && Is(s[j], ByteClassDigit)) {
+      ++j;
+    }
+    if (j - i == lead) {
+      // thousands separators
+      size_t k = j + 1;
+      while (j < n && s[j] == ',' && Digits(s, n, &k, 3, &value) == 3 &&
+             (k == n || !Is(s[k], ByteClassDigit))) {
+        j = k;
+        k = j + 1;
+      }
+    }
+    size_t k = j + 1;
+    if (j < n && s[j] == '.' && Digits(s, n, &k, SIZE_MAX, &value) > 0) {
+      j = k;
+    }
+    if (j < n && s[j] == '%') {
+      ++j;
+    }
+    return j - i;
+  }
+
+  size_t MatchEmoji(const char *s, size_t n, size_t i) const {
+    const size_t len = emoji_.CheckPos(s, n, i);
+    if (len == 0) {
+      return 0;
+    }
+    size_t j = i + len;
+    for (;;) {
+      // variation selector 16
+      if (n - j >= 3 && std::memcmp(s + j, "\xef\xb8\x8f", 3) == 0) {
+        j += 3;
+        continue;
+      }
+      // skin tones, U+1F3FB to U+1F3FF
+      if (n - j >= 4 && std::memcmp(s + j, "\xf0\x9f\x8f", 3) == 0 &&
+          static_cast<unsigned char>(s[j + 3]) >= 0xbb &&
+          static_cast<unsigned char>(s[j + 3]) <= 0xbf) {
+        j += 4;
+        continue;
+      }
+      // zero width joiner and another emoji
+      if (n - j >= 3 && std::memcmp(s + j, "\xe2\x80\x8d", 3) == 0) {
+        const size_t next = emoji_.CheckPos(s, n, j + 3);
+        if (next > 0) {
+          j += 3 + next;
+          continue;
+        }
+      }
+      break;
+    }
+    return j - i;
+  }
+
+  Options options_;
+  EmojiFilter emoji_;
+  // the bytes an entity can start with
+  ByteSet starts_;
+}; // class PreTokenizer
+
+} // namespace libtext
+
+#endif // LIBTEXT_SEGMENT_PRE_TOKENIZER_H_
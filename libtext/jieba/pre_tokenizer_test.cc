@@ -0,0 +1,115 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "libtext/jieba/pre_tokenizer.h"
+#include "libtext/jieba/mix_seg.h"
+#include "gtest/gtest.h"
+#include <turbo/strings/str_join.h>
+
+using namespace libtext;
+
+// The spans of s as type:text, joined by "/".
+static std::string Split(const PreTokenizer &tokenizer, const std::string &s) {
+  std::vector<PreTokenizer::Span> spans;
+  tokenizer.Split(s, spans);
+  std::string res;
+  for (size_t i = 0; i < spans.size(); ++i) {
+    turbo::StrAppend(&res, i ? "/" : "",
+                     PreTokenizer::GetTypeName(spans[i].type), ":",
+                     s.substr(spans[i].offset, spans[i].length));
+  }
+  return res;
+}
+
+TEST(PreTokenizerTest, Entities) {
+  PreTokenizer tokenizer;
+  ASSERT_EQ("", Split(tokenizer, ""));
+  ASSERT_EQ(":我来自北京邮电大学", Split(tokenizer, "我来自北京邮电大学"));
+  ASSERT_EQ(":见/url:https://example.com/a?b=1&c=2#x/:。",
+            Split(tokenizer, "见https://example.com/a?b=1&c=2#x。"));
+  ASSERT_EQ("url:www.example.com/:, ",
+            Split(tokenizer, "www.example.com, "));
+  ASSERT_EQ(":联系/email:foo.bar+x@mail.example.cn/:或/email:123456@qq.com",
+            Split(tokenizer, "联系foo.bar+x@mail.example.cn或123456@qq.com"));
+  ASSERT_EQ(":服务器/ip:192.168.1.10:8080/:上线",
+            Split(tokenizer, "服务器192.168.1.10:8080上线"));
+  ASSERT_EQ(":于/date:2023-05-21/:和/date:2023/5/1/:发布",
+            Split(tokenizer, "于2023-05-21和2023/5/1发布"));
+  ASSERT_EQ("date:2023-05-21T12:30:00Z/: /date:2023.05.21 08:00",
+            Split(tokenizer, "2023-05-21T12:30:00Z 2023.05.21 08:00"));
+  ASSERT_EQ(":从/time:10:30/:-/time:11:45:30.5",
+            Split(tokenizer, "从10:30-11:45:30.5"));
+  ASSERT_EQ(":涨了/number:12.5%/:，共/number:1,234,567/:元",
+            Split(tokenizer, "涨了12.5%，共1,234,567元"));
+  ASSERT_EQ(":好/emoji:😀/:！", Split(tokenizer, "好😀！"));
+  // ZWJ sequences and skin tones stay whole
+  ASSERT_EQ("emoji:👍🏽/emoji:👨‍👩‍👧", Split(tokenizer, "👍🏽👨‍👩‍👧"));
+
+  // not inside words, and not cut off a longer token
+  ASSERT_EQ(":AK47 1.2.3 5G v2.0 256.1.1.1",
+            Split(tokenizer, "AK47 1.2.3 5G v2.0 256.1.1.1"));
+  ASSERT_EQ(":abcwww.example.com a@b x:30 /number:3/:-/number:5",
+            Split(tokenizer, "abcwww.example.com a@b x:30 3-5"));
+}
+
+TEST(PreTokenizerTest, Options) {
+  PreTokenizer::Options options;
+  options.numbers = false;
+  options.emoji = false;
+  PreTokenizer tokenizer(options);
+  ASSERT_EQ(":共1,234元😀，/date:2023-05-21",
+            Split(tokenizer, "共1,234元😀，2023-05-21"));
+}
+
+TEST(PreTokenizerTest, Cut) {
+  MixSegment segment("../dict/jieba.dict.utf8", "../dict/hmm_model.utf8");
+  PreTokenizer tokenizer;
+  const std::string sentence = "我来自北京，邮箱foo@bar.com，2023-05-21到😀";
+  std::vector<Word> words;
+  std::vector<PreTokenizer::EntityType> types;
+  tokenizer.Cut(
+      sentence, words,
+      [&segment](const std::string &text, std::vector<Word> &res) {
+        segment.Cut(text, res);
+      },
+      &types);
+  ASSERT_EQ(words.size(), types.size());
+  std::string res;
+  for (size_t i = 0; i < words.size(); ++i) {
+    turbo::StrAppend(&res, i ? "/" : "", words[i].word,
+                     types[i] ? ":" : "",
+                     PreTokenizer::GetTypeName(types[i]));
+    // the offsets are in the sentence
+    ASSERT_EQ(words[i].word, sentence.substr(words[i].offset,
+                                             words[i].word.size()));
+  }
+  ASSERT_EQ("我/来自/北京/，/邮箱/foo@bar.com:email/，/2023-05-21:date/到/😀:emoji",
+            res);
+  Unicode runes;
+  ASSERT_TRUE(DecodeRunesInString(sentence, runes));
+  ASSERT_EQ(runes.size(),
+            words.back().unicode_offset + words.back().unicode_length);
+
+  // without entities the segmenter cuts the sentence itself
+  tokenizer.Cut(
+      "我来自北京", words,
+      [&segment](const std::string &text, std::vector<Word> &res) {
+        segment.Cut(text, res);
+      },
+      &types);
+  ASSERT_EQ(3u, words.size());
+  ASSERT_EQ(std::vector<PreTokenizer::EntityType>(3, PreTokenizer::EntityNone),
+            types);
+}
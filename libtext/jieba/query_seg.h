@@ -24,71 +24,199 @@
 #include <algorithm>
 #include <cassert>
 #include <set>
+#include <tuple>
 
 namespace libtext {
 
+// The words of a sentence at two granularities: coarse holds the words of
+// MixSegment, and the dictionary words nested in coarse[i] are
+// fine[fine_begin[i], fine_begin[i + 1]), by length then offset.
+struct MultiGranularity {
+  std::vector<Word> coarse;
+  std::vector<Word> fine;
+  std::vector<size_t> fine_begin;
+}; // struct MultiGranularity
+
 class QuerySegment : public SegmentBase {
 public:
   QuerySegment(const std::string &dict, const std::string &model,
                const std::string &userDict = "")
-      : mixSeg_(dict, model, userDict), trie_(mixSeg_.GetDictTrie()) {}
+      : mixSeg_(dict, model, userDict), trie_(mixSeg_.GetDictTrie()),
+        max_sub_word_len_(3) {}
   QuerySegment(const DictTrie *dictTrie, const HMMModel *model)
-      : mixSeg_(dictTrie, model), trie_(dictTrie) {}
+      : mixSeg_(dictTrie, model), trie_(dictTrie), max_sub_word_len_(3) {}
   ~QuerySegment() {}
 
   void Cut(const std::string &sentence, std::vector<std::string> &words) const {
     Cut(sentence, words, true);
   }
   void Cut(const std::string &sentence, std::vector<std::string> &words,
-           bool hmm) const {
+           bool hmm, const SegmentGuard *guard = nullptr) const {
     std::vector<Word> tmp;
-    Cut(sentence, tmp, hmm);
+    Cut(sentence, tmp, hmm, guard);
     GetStringsFromWords(tmp, words);
   }
+  // With a guard, the work on pathological input is bounded as described
+  // in SegmentGuard; the ranges it cuts by maximum matching get no
+  // sub-words.
   void Cut(const std::string &sentence, std::vector<Word> &words,
-           bool hmm = true) const {
-    PreFilter pre_filter(symbols_, sentence);
+           bool hmm = true, const SegmentGuard *guard = nullptr) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
     PreFilter::Range range;
     std::vector<WordRange> wrs;
     wrs.reserve(sentence.size() / 2);
-    while (pre_filter.HasNext()) {
-      range = pre_filter.Next();
-      Cut(range.begin, range.end, wrs, hmm);
+    if (guard != nullptr) {
+      guard->Cut(trie_, pre_filter, wrs,
+                 [this, hmm](RuneStrArray::const_iterator begin,
+                             RuneStrArray::const_iterator end,
+                             size_t max_word_len, std::vector<WordRange> &res) {
+                   Cut(begin, end, res, hmm, max_word_len);
+                 });
+    } else {
+      while (pre_filter.HasNext()) {
+        range = pre_filter.Next();
+        Cut(range.begin, range.end, wrs, hmm);
+      }
     }
     words.clear();
     words.reserve(wrs.size());
     GetWordsFromWordRanges(sentence, wrs, words);
   }
+  // Calls visit(const WordView &) for the words of Cut in order, without
+  // storing them or copying their strings.
+  template <typename Fn>
+  void Cut(const std::string &sentence, Fn &&visit, bool hmm = true) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    while (pre_filter.HasNext()) {
+      const PreFilter::Range range = pre_filter.Next();
+      Cut(
+          range.begin, range.end,
+          [&sentence, &visit](RuneStrArray::const_iterator left,
+                              RuneStrArray::const_iterator right,
+                              const DictUnit *unit) {
+            visit(GetWordViewFromRunes(sentence, left, right, unit));
+          },
+          hmm);
+    }
+  }
   void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
-           std::vector<WordRange> &res, bool hmm) const {
-    // use mix Cut first
-    std::vector<WordRange> mixRes;
-    mixSeg_.Cut(begin, end, mixRes, hmm);
-
-    std::vector<WordRange> fullRes;
-    for (std::vector<WordRange>::const_iterator mixResItr = mixRes.begin();
-         mixResItr != mixRes.end(); mixResItr++) {
-      if (mixResItr->Length() > 2) {
-        for (size_t i = 0; i + 1 < mixResItr->Length(); i++) {
-          WordRange wr(mixResItr->left + i, mixResItr->left + i + 1);
-          if (trie_->Find(wr.left, wr.right + 1) != NULL) {
-            res.push_back(wr);
+           std::vector<WordRange> &res, bool hmm,
+           size_t max_word_len = MAX_WORD_LENGTH) const {
+    Cut(begin, end, WordRangeAppender(res), hmm, max_word_len);
+  }
+  // Calls emit(left, right, unit) for the words [left, right] of [begin,
+  // end) in order, each word of MixSegment after its sub-words.
+  template <typename Fn>
+  void Cut(RuneStrArray::const_iterator begin, RuneStrArray::const_iterator end,
+           Fn &&emit, bool hmm, size_t max_word_len = MAX_WORD_LENGTH) const {
+    // the sub-words by length then offset, with their units
+    turbo::InlinedVector<std::tuple<size_t, size_t, const DictUnit *>, 16>
+        subWords;
+    mixSeg_.Cut(
+        begin, end,
+        [this, &subWords, &emit](RuneStrArray::const_iterator left,
+                                 RuneStrArray::const_iterator right,
+                                 const DictUnit *unit) {
+          const size_t length = right - left + 1;
+          if (length > 2) {
+            // the DAG edges inside the word, one trie walk per rune
+            subWords.clear();
+            for (size_t i = 0; i + 2 <= length; i++) {
+              trie_->ForEachPrefix(
+                  left + i, right + 1,
+                  std::min(max_sub_word_len_, length - 1),
+                  [&subWords, i](size_t len, const DictUnit *p) {
+                    if (len >= 2) {
+                      subWords.push_back(std::make_tuple(len, i, p));
+                    }
+                  });
+            }
+            std::sort(subWords.begin(), subWords.end());
+            for (size_t k = 0; k < subWords.size(); k++) {
+              RuneStrArray::const_iterator sub =
+                  left + std::get<1>(subWords[k]);
+              emit(sub, sub + (std::get<0>(subWords[k]) - 1),
+                   std::get<2>(subWords[k]));
+            }
           }
-        }
+          emit(left, right, unit);
+        },
+        hmm, max_word_len);
+  }
+
+  // Sets the length in runes of the longest sub-words Cut adds before a
+  // word, 3 by default.
+  void SetMaxSubWordLen(size_t len) { max_sub_word_len_ = len; }
+  size_t GetMaxSubWordLen() const { return max_sub_word_len_; }
+
+  void EnableHMMCache(size_t max_entries, size_t max_run_len = 16) {
+    mixSeg_.EnableHMMCache(max_entries, max_run_len);
+  }
+
+  // The runs kept whole have no sub-words, no word starts inside them.
+  void EnableAsciiRuns() { mixSeg_.EnableAsciiRuns(); }
+  void DisableAsciiRuns() { mixSeg_.DisableAsciiRuns(); }
+
+  // Cuts the sentence both ways from one DAG per range: the coarse words
+  // are cut over it and their sub-words of 2 to max_sub_word_len runes are
+  // read from its edges, instead of looking every n-gram up in the trie.
+  // Without max_sub_word_len, the nested words are the sub-words of Cut.
+  void CutMultiGranularity(const std::string &sentence,
+                           MultiGranularity &res) const {
+    CutMultiGranularity(sentence, res, max_sub_word_len_);
+  }
+  void CutMultiGranularity(const std::string &sentence, MultiGranularity &res,
+                           size_t max_sub_word_len, bool hmm = true) const {
+    PreFilter pre_filter(symbols_, symbol_classes_, sentence);
+    std::vector<WordRange> coarse;
+    std::vector<WordRange> fine;
+    std::vector<size_t> fine_begin;
+    coarse.reserve(sentence.size() / 2);
+    CompactDag dag;
+    while (pre_filter.HasNext()) {
+      const PreFilter::Range range = pre_filter.Next();
+      trie_->Find(range.begin, range.end, dag);
+      const size_t first = coarse.size();
+      mixSeg_.Cut(range.begin, range.end, dag, coarse, hmm);
+      for (size_t i = first; i < coarse.size(); i++) {
+        fine_begin.push_back(fine.size());
+        AppendSubWords(range.begin, dag, coarse[i], max_sub_word_len, fine);
       }
-      if (mixResItr->Length() > 3) {
-        for (size_t i = 0; i + 2 < mixResItr->Length(); i++) {
-          WordRange wr(mixResItr->left + i, mixResItr->left + i + 2);
-          if (trie_->Find(wr.left, wr.right + 1) != NULL) {
-            res.push_back(wr);
+    }
+    fine_begin.push_back(fine.size());
+    res.coarse.clear();
+    res.coarse.reserve(coarse.size());
+    GetWordsFromWordRanges(sentence, coarse, res.coarse);
+    res.fine.clear();
+    res.fine.reserve(fine.size());
+    GetWordsFromWordRanges(sentence, fine, res.fine);
+    res.fine_begin.swap(fine_begin);
+  }
+
+private:
+  // Appends the dictionary words of 2 to max_len runes which are nested in
+  // word, by length then offset, reading them from the DAG of the range
+  // which starts at begin.
+  static void AppendSubWords(RuneStrArray::const_iterator begin,
+                             const CompactDag &dag, const WordRange &word,
+                             size_t max_len, std::vector<WordRange> &res) {
+    const size_t left = static_cast<size_t>(word.left - begin);
+    const size_t length = word.Length();
+    for (size_t len = 2; len < length && len <= max_len; len++) {
+      for (size_t i = left; i + len <= left + length; i++) {
+        const size_t last = i + len - 1;
+        for (size_t k = dag.starts[i]; k < dag.starts[i + 1]; k++) {
+          if (dag.ends[k] >= last) {
+            if (dag.ends[k] == last && dag.units[k] != NULL) {
+              res.push_back(WordRange(begin + i, begin + last));
+            }
+            break;
           }
         }
       }
-      res.push_back(*mixResItr);
     }
   }
 
-private:
   bool IsAllAscii(const Unicode &s) const {
     for (size_t i = 0; i < s.size(); i++) {
       if (s[i] >= 0x80) {
@@ -99,6 +227,7 @@ private:
   }
   MixSegment mixSeg_;
   const DictTrie *trie_;
+  size_t max_sub_word_len_;
 }; // QuerySegment
 
 } // namespace libtext
@@ -17,7 +17,12 @@
 #define LIBTEXT_SEGMENT_SEG_H_
 
 #include "libtext/jieba/keyword_extrator.h"
+#include "libtext/jieba/pre_tokenizer.h"
 #include "libtext/jieba/query_seg.h"
+#include "libtext/jieba/seg_cache.h"
+#include <algorithm>
+#include <limits>
+#include <memory>
 
 namespace libtext {
 
@@ -40,41 +45,83 @@ public:
 
   void Cut(const std::string &sentence, std::vector<std::string> &words,
            bool hmm = true) const {
-    mix_seg_.Cut(sentence, words, hmm);
+    CachedCut(CacheMix, hmm, mix_seg_, sentence, words, hmm, guard_.get());
   }
   void Cut(const std::string &sentence, std::vector<Word> &words,
            bool hmm = true) const {
-    mix_seg_.Cut(sentence, words, hmm);
+    CachedCut(CacheMix, hmm, mix_seg_, sentence, words, hmm, guard_.get());
   }
   void CutAll(const std::string &sentence,
               std::vector<std::string> &words) const {
-    full_seg_.Cut(sentence, words);
+    CachedCut(CacheFull, 0, full_seg_, sentence, words);
   }
   void CutAll(const std::string &sentence, std::vector<Word> &words) const {
-    full_seg_.Cut(sentence, words);
+    CachedCut(CacheFull, 0, full_seg_, sentence, words);
   }
   void CutForSearch(const std::string &sentence,
                     std::vector<std::string> &words, bool hmm = true) const {
-    query_seg_.Cut(sentence, words, hmm);
+    CachedCut(CacheQuery, QueryCacheArg(hmm), query_seg_, sentence, words,
+              hmm, guard_.get());
   }
   void CutForSearch(const std::string &sentence, std::vector<Word> &words,
                     bool hmm = true) const {
-    query_seg_.Cut(sentence, words, hmm);
+    CachedCut(CacheQuery, QueryCacheArg(hmm), query_seg_, sentence, words,
+              hmm, guard_.get());
+  }
+  // Cut and the nested words of CutForSearch at once, for indexing; the
+  // nested words are up to the length of SetMaxSubWordLen by default.
+  void CutMultiGranularity(const std::string &sentence,
+                           MultiGranularity &res) const {
+    query_seg_.CutMultiGranularity(sentence, res);
+  }
+  void CutMultiGranularity(const std::string &sentence, MultiGranularity &res,
+                           size_t max_sub_word_len, bool hmm = true) const {
+    query_seg_.CutMultiGranularity(sentence, res, max_sub_word_len, hmm);
   }
   void CutHMM(const std::string &sentence,
               std::vector<std::string> &words) const {
-    hmm_seg_.Cut(sentence, words);
+    CachedCut(CacheHMM, 0, hmm_seg_, sentence, words);
   }
   void CutHMM(const std::string &sentence, std::vector<Word> &words) const {
-    hmm_seg_.Cut(sentence, words);
+    CachedCut(CacheHMM, 0, hmm_seg_, sentence, words);
   }
   void CutSmall(const std::string &sentence, std::vector<std::string> &words,
                 size_t max_word_len) const {
-    mp_seg_.Cut(sentence, words, max_word_len);
+    CachedCut(CacheMP, max_word_len, mp_seg_, sentence, words, max_word_len);
   }
   void CutSmall(const std::string &sentence, std::vector<Word> &words,
                 size_t max_word_len) const {
-    mp_seg_.Cut(sentence, words, max_word_len);
+    CachedCut(CacheMP, max_word_len, mp_seg_, sentence, words, max_word_len);
+  }
+  // Cut, with types[i] the type of words[i], EntityNone for all of them if
+  // the pre-tokenizer is disabled. Not cached.
+  void CutEntities(const std::string &sentence, std::vector<Word> &words,
+                   std::vector<PreTokenizer::EntityType> &types,
+                   bool hmm = true) const {
+    if (!pre_tokenizer_) {
+      mix_seg_.Cut(sentence, words, hmm, guard_.get());
+      types.assign(words.size(), PreTokenizer::EntityNone);
+      return;
+    }
+    pre_tokenizer_->Cut(
+        sentence, words,
+        [this, hmm](const std::string &text, std::vector<Word> &res) {
+          mix_seg_.Cut(text, res, hmm, guard_.get());
+        },
+        &types);
+  }
+
+  // The k best segmentations without HMM, best first, for query rewriting
+  // and recall expansion.
+  void CutNBest(const std::string &sentence, size_t k,
+                std::vector<Segmentation> &res,
+                size_t max_word_len = MAX_WORD_LENGTH) const {
+    mp_seg_.CutNBest(sentence, k, res, max_word_len);
+  }
+  void CutLattice(const std::string &sentence, std::vector<Word> &words,
+                  std::vector<double> &weights,
+                  size_t max_word_len = MAX_WORD_LENGTH) const {
+    mp_seg_.CutLattice(sentence, words, weights, max_word_len);
   }
 
   void Tag(const std::string &sentence,
@@ -101,6 +148,9 @@ public:
 
   bool Find(const std::string &word) { return dict_trie_.Find(word); }
 
+  // The length in runes of the longest sub-words of CutForSearch.
+  void SetMaxSubWordLen(size_t len) { query_seg_.SetMaxSubWordLen(len); }
+
   void ResetSeparators(const std::string &s) {
     // TODO
     mp_seg_.ResetSeparators(s);
@@ -108,21 +158,123 @@ public:
     mix_seg_.ResetSeparators(s);
     full_seg_.ResetSeparators(s);
     query_seg_.ResetSeparators(s);
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
+
+  // Caches the results of Cut, CutAll, CutForSearch, CutHMM and CutSmall
+  // in at most about `capacity_bytes`, for skewed traffic where the same
+  // sentences come again and again. Results cut before InsertUserWord or
+  // DeleteUserWord are not hit afterwards. Not to be called while other
+  // threads are cutting.
+  void EnableCache(size_t capacity_bytes, size_t num_shards = 16) {
+    cache_.reset(new SegmentCache(capacity_bytes, num_shards));
+  }
+
+  void DisableCache() { cache_.reset(); }
+
+  // Caches the HMM cuts of unknown words in Cut, CutForSearch and CutHMM,
+  // up to `max_entries` runs of at most `max_run_len` runes per mode.
+  // Not to be called while other threads are cutting.
+  void EnableHMMCache(size_t max_entries, size_t max_run_len = 16) {
+    hmm_seg_.EnableCache(max_entries, max_run_len);
+    mix_seg_.EnableHMMCache(max_entries, max_run_len);
+    query_seg_.EnableHMMCache(max_entries, max_run_len);
+  }
+
+  // Keeps the runs of ASCII letters and digits, and decimal numbers, in one
+  // word each in Cut, CutForSearch, CutSmall, CutNBest and CutLattice, see
+  // MPSegment::EnableAsciiRuns. Not to be called while other threads are
+  // cutting.
+  void EnableAsciiRuns() {
+    mp_seg_.EnableAsciiRuns();
+    mix_seg_.EnableAsciiRuns();
+    query_seg_.EnableAsciiRuns();
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
+
+  void DisableAsciiRuns() {
+    mp_seg_.DisableAsciiRuns();
+    mix_seg_.DisableAsciiRuns();
+    query_seg_.DisableAsciiRuns();
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
+
+  // Null if the cache is disabled.
+  const SegmentCache *GetCache() const { return cache_.get(); }
+
+  // Bounds the work of Cut and CutForSearch on pathological input, like
+  // long strings without separators, see SegmentGuard. Not to be called
+  // while other threads are cutting.
+  void EnableGuard(
+      const SegmentGuard::Options &options = SegmentGuard::Options()) {
+    guard_.reset(new SegmentGuard(options));
+    if (cache_) {
+      cache_->Clear();
+    }
   }
 
+  void DisableGuard() {
+    guard_.reset();
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
+
+  // Null if the guard is disabled.
+  const SegmentGuard *GetGuard() const { return guard_.get(); }
+
+  // Keeps the URLs, emails, IPs, dates, times, numbers and emoji of the
+  // sentences of Cut, CutAll, CutForSearch, CutHMM and CutSmall in one
+  // word each, see PreTokenizer. Not to be called while other threads are
+  // cutting.
+  void EnablePreTokenizer(
+      const PreTokenizer::Options &options = PreTokenizer::Options()) {
+    pre_tokenizer_.reset(new PreTokenizer(options));
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
+
+  void DisablePreTokenizer() {
+    pre_tokenizer_.reset();
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
+
+  // Null if the pre-tokenizer is disabled.
+  const PreTokenizer *GetPreTokenizer() const { return pre_tokenizer_.get(); }
+
   const DictTrie *GetDictTrie() const { return &dict_trie_; }
 
   const HMMModel *GetHMMModel() const { return &model_; }
 
   void LoadUserDict(const std::vector<std::string> &buf) {
     dict_trie_.LoadUserDict(buf);
+    if (cache_) {
+      cache_->Clear();
+    }
   }
 
   void LoadUserDict(const std::set<std::string> &buf) {
     dict_trie_.LoadUserDict(buf);
+    if (cache_) {
+      cache_->Clear();
+    }
   }
 
-  void LoadUserDict(const std::string &path) { dict_trie_.LoadUserDict(path); }
+  void LoadUserDict(const std::string &path) {
+    dict_trie_.LoadUserDict(path);
+    if (cache_) {
+      cache_->Clear();
+    }
+  }
 
 private:
   DictTrie dict_trie_;
@@ -135,6 +287,71 @@ private:
   FullSegment full_seg_;
   QuerySegment query_seg_;
 
+  enum CacheMode {
+    CacheMix,
+    CacheFull,
+    CacheQuery,
+    CacheHMM,
+    CacheMP,
+  }; // enum CacheMode
+
+  // The sub-word length and the hmm flag. Lengths past the top bit cut as
+  // the largest one, no word is that long.
+  uint64_t QueryCacheArg(bool hmm) const {
+    const uint64_t len =
+        std::min<uint64_t>(query_seg_.GetMaxSubWordLen(),
+                           std::numeric_limits<uint64_t>::max() >> 1);
+    return len << 1 | hmm;
+  }
+
+  template <typename Seg, typename... Args>
+  void CachedCut(CacheMode mode, uint64_t arg, const Seg &seg,
+                 const std::string &sentence, std::vector<Word> &words,
+                 Args... args) const {
+    if (!cache_) {
+      PreTokenizedCut(seg, sentence, words, args...);
+      return;
+    }
+    const SegmentCache::Key key = {static_cast<uint32_t>(mode), arg,
+                                   dict_trie_.GetVersion()};
+    if (cache_->Lookup(sentence, key, words)) {
+      return;
+    }
+    PreTokenizedCut(seg, sentence, words, args...);
+    cache_->Insert(sentence, key, words);
+  }
+
+  template <typename Seg, typename... Args>
+  void CachedCut(CacheMode mode, uint64_t arg, const Seg &seg,
+                 const std::string &sentence, std::vector<std::string> &words,
+                 Args... args) const {
+    if (!cache_ && !pre_tokenizer_) {
+      seg.Cut(sentence, words, args...);
+      return;
+    }
+    std::vector<Word> tmp;
+    CachedCut(mode, arg, seg, sentence, tmp, args...);
+    GetStringsFromWords(tmp, words);
+  }
+
+  template <typename Seg, typename... Args>
+  void PreTokenizedCut(const Seg &seg, const std::string &sentence,
+                       std::vector<Word> &words, Args... args) const {
+    if (!pre_tokenizer_) {
+      seg.Cut(sentence, words, args...);
+      return;
+    }
+    pre_tokenizer_->Cut(
+        sentence, words,
+        [&seg, args...](const std::string &text, std::vector<Word> &res) {
+          seg.Cut(text, res, args...);
+        });
+  }
+
+  std::unique_ptr<SegmentCache> cache_;
+  std::unique_ptr<SegmentGuard> guard_;
+  std::unique_ptr<PreTokenizer> pre_tokenizer_;
+
 public:
   KeywordExtractor extractor;
 }; // class Segmentor
@@ -34,6 +34,7 @@ public:
 
   bool ResetSeparators(const std::string &s) {
     symbols_.clear();
+    symbol_classes_ = SymbolClasses();
     RuneStrArray runes;
     if (!DecodeRunesInString(s, runes)) {
       TURBO_LOG(ERROR) << "decode " << s << " failed";
@@ -45,12 +46,15 @@ public:
                          << " already exists";
         return false;
       }
+      symbol_classes_.Add(runes[i].rune);
     }
     return true;
   }
 
 protected:
   turbo::flat_hash_set<Rune> symbols_;
+  // kept with symbols_ so that a PreFilter does not walk the set per sentence
+  SymbolClasses symbol_classes_;
 }; // class SegmentBase
 
 } // namespace libtext
@@ -0,0 +1,216 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_SEGMENT_SEG_CACHE_H_
+#define LIBTEXT_SEGMENT_SEG_CACHE_H_
+
+#include "libtext/jieba/unicode.h"
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "turbo/container/flat_hash_map.h"
+
+namespace libtext {
+
+// A cache of segmentation results, shared by concurrent callers. Entries
+// are spread over shards by the hash of the sentence and the key; each
+// shard is an LRU list under its own mutex, with an equal part of the
+// memory budget. A result is kept as the offsets of its words only and is
+// turned back into words from the sentence on a hit.
+class SegmentCache {
+public:
+  // What the result depends on besides the sentence: the kind of cut, its
+  // options, and the version of the dictionary it was computed with, so
+  // that the results of an older dictionary are never hit again and just
+  // age out of the LRU.
+  struct Key {
+    uint32_t mode;
+    uint64_t arg;
+    uint64_t version;
+    bool operator==(const Key &rhs) const {
+      return mode == rhs.mode && arg == rhs.arg && version == rhs.version;
+    }
+  }; // struct Key
+
+  struct Stats {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    size_t entries;
+    size_t bytes;
+  }; // struct Stats
+
+  explicit SegmentCache(size_t capacity_bytes, size_t num_shards = 16)
+      : num_shards_(num_shards ? num_shards : 1),
+        shards_(new Shard[num_shards_]) {
+    shard_capacity_ = capacity_bytes / num_shards_;
+  }
+
+  // Fills `words` and returns true if the result of `sentence` under `key`
+  // is cached.
+  bool Lookup(const std::string &sentence, const Key &key,
+              std::vector<Word> &words) {
+    const uint64_t hash = Hash(sentence, key);
+    Shard &shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(hash);
+    if (it == shard.index.end() || !(it->second->key == key) ||
+        it->second->sentence != sentence) {
+      ++shard.misses;
+      return false;
+    }
+    ++shard.hits;
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    const std::vector<uint32_t> &spans = it->second->spans;
+    words.clear();
+    words.reserve(spans.size() / kSpanSize);
+    for (size_t i = 0; i < spans.size(); i += kSpanSize) {
+      words.emplace_back(sentence.substr(spans[i], spans[i + 1]), spans[i],
+                         spans[i + 2], spans[i + 3]);
+    }
+    return true;
+  }
+
+  // Caches `words` as the result of `sentence` under `key`, evicting the
+  // least recently used entries of the shard to stay in its budget.
+  // Results larger than the budget of a shard are not cached.
+  void Insert(const std::string &sentence, const Key &key,
+              const std::vector<Word> &words) {
+    const size_t bytes = EntryBytes(sentence.size(), words.size());
+    if (bytes > shard_capacity_) {
+      return;
+    }
+    Entry entry;
+    entry.key = key;
+    entry.sentence = sentence;
+    entry.spans.reserve(words.size() * kSpanSize);
+    for (size_t i = 0; i < words.size(); ++i) {
+      entry.spans.push_back(words[i].offset);
+      entry.spans.push_back(static_cast<uint32_t>(words[i].word.size()));
+      entry.spans.push_back(words[i].unicode_offset);
+      entry.spans.push_back(words[i].unicode_length);
+    }
+    entry.bytes = bytes;
+
+    const uint64_t hash = Hash(sentence, key);
+    entry.hash = hash;
+    Shard &shard = GetShard(hash);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(hash);
+    if (it != shard.index.end()) {
+      // the same sentence from another caller, or a hash collision
+      shard.bytes -= it->second->bytes;
+      shard.lru.erase(it->second);
+      shard.index.erase(it);
+    }
+    while (shard.bytes + bytes > shard_capacity_) {
+      const Entry &last = shard.lru.back();
+      shard.bytes -= last.bytes;
+      shard.index.erase(last.hash);
+      shard.lru.pop_back();
+      ++shard.evictions;
+    }
+    shard.lru.push_front(std::move(entry));
+    shard.index[hash] = shard.lru.begin();
+    shard.bytes += bytes;
+  }
+
+  // Drops every entry; the counters are kept.
+  void Clear() {
+    for (size_t i = 0; i < num_shards_; ++i) {
+      Shard &shard = shards_[i];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      shard.lru.clear();
+      shard.index.clear();
+      shard.bytes = 0;
+    }
+  }
+
+  Stats GetStats() const {
+    Stats stats = {0, 0, 0, 0, 0};
+    for (size_t i = 0; i < num_shards_; ++i) {
+      Shard &shard = shards_[i];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      stats.hits += shard.hits;
+      stats.misses += shard.misses;
+      stats.evictions += shard.evictions;
+      stats.entries += shard.lru.size();
+      stats.bytes += shard.bytes;
+    }
+    return stats;
+  }
+
+  size_t GetCapacity() const { return shard_capacity_ * num_shards_; }
+
+private:
+  // byte offset, byte length, unicode offset, unicode length
+  static constexpr size_t kSpanSize = 4;
+
+  struct Entry {
+    uint64_t hash;
+    Key key;
+    size_t bytes;
+    std::string sentence;
+    std::vector<uint32_t> spans;
+  }; // struct Entry
+
+  // aligned so that the mutexes of neighbouring shards do not share a line
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::list<Entry> lru;
+    turbo::flat_hash_map<uint64_t, std::list<Entry>::iterator> index;
+    size_t bytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  }; // struct Shard
+
+  // The memory of an entry: the list node, its slot in the index, the
+  // sentence and the spans.
+  static size_t EntryBytes(size_t sentence_size, size_t num_words) {
+    return sizeof(Entry) + 2 * sizeof(void *) + sizeof(uint64_t) +
+           sizeof(std::list<Entry>::iterator) + sentence_size +
+           num_words * kSpanSize * sizeof(uint32_t);
+  }
+
+  static uint64_t Hash(const std::string &sentence, const Key &key) {
+    uint64_t h = std::hash<std::string_view>()(sentence);
+    h ^= key.mode + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    h ^= key.arg + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    h ^= key.version + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+    // the low bits pick the slot in the index, the high bits the shard
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    return h;
+  }
+
+  Shard &GetShard(uint64_t hash) const {
+    return shards_[(hash >> 40) % num_shards_];
+  }
+
+  const size_t num_shards_;
+  size_t shard_capacity_;
+  std::unique_ptr<Shard[]> shards_;
+}; // class SegmentCache
+
+} // namespace libtext
+
+#endif // LIBTEXT_SEGMENT_SEG_CACHE_H_
@@ -0,0 +1,179 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "libtext/jieba/seg_cache.h"
+#include "libtext/jieba/mix_seg.h"
+#include "gtest/gtest.h"
+#include <thread>
+#include <turbo/strings/str_join.h>
+
+using namespace libtext;
+
+static std::string JoinWords(const std::vector<Word> &words) {
+  std::string s;
+  for (size_t i = 0; i < words.size(); ++i) {
+    turbo::StrAppend(&s, i ? "/" : "", words[i].word, ":", words[i].offset,
+                     ":", words[i].unicode_offset, ":",
+                     words[i].unicode_length);
+  }
+  return s;
+}
+
+TEST(SegmentCacheTest, HitAndMiss) {
+  MixSegment segment("../dict/jieba.dict.utf8", "../dict/hmm_model.utf8");
+  SegmentCache cache(1 << 20, 4);
+  const SegmentCache::Key key = {0, 1, 0};
+  std::string sentence = "我来自北京邮电大学。。。学号123456，用AK47";
+  std::vector<Word> expected;
+  segment.Cut(sentence, expected);
+
+  std::vector<Word> words;
+  ASSERT_FALSE(cache.Lookup(sentence, key, words));
+  cache.Insert(sentence, key, expected);
+  ASSERT_TRUE(cache.Lookup(sentence, key, words));
+  ASSERT_EQ(JoinWords(expected), JoinWords(words));
+
+  // any part of the key tells the results apart
+  SegmentCache::Key other = key;
+  other.arg = 0;
+  ASSERT_FALSE(cache.Lookup(sentence, other, words));
+  other.arg = key.arg + (uint64_t(1) << 32);
+  ASSERT_FALSE(cache.Lookup(sentence, other, words));
+  other = key;
+  other.version = 1;
+  ASSERT_FALSE(cache.Lookup(sentence, other, words));
+  ASSERT_FALSE(cache.Lookup(sentence + "。", key, words));
+
+  SegmentCache::Stats stats = cache.GetStats();
+  ASSERT_EQ(1u, stats.hits);
+  ASSERT_EQ(5u, stats.misses);
+  ASSERT_EQ(1u, stats.entries);
+  ASSERT_LE(stats.bytes, cache.GetCapacity());
+
+  cache.Clear();
+  ASSERT_FALSE(cache.Lookup(sentence, key, words));
+  ASSERT_EQ(0u, cache.GetStats().entries);
+}
+
+TEST(SegmentCacheTest, Eviction) {
+  SegmentCache cache(4096, 1);
+  const SegmentCache::Key key = {0, 0, 0};
+  std::vector<Word> words;
+  words.push_back(Word("ab", 0, 0, 2));
+  for (int i = 0; i < 1000; ++i) {
+    cache.Insert("ab" + std::to_string(i), key, words);
+  }
+  SegmentCache::Stats stats = cache.GetStats();
+  ASSERT_LE(stats.bytes, cache.GetCapacity());
+  ASSERT_GT(stats.entries, 0u);
+  ASSERT_EQ(1000u, stats.entries + stats.evictions);
+
+  // the most recent entries are kept, and a hit refreshes an entry
+  std::vector<Word> res;
+  ASSERT_TRUE(cache.Lookup("ab999", key, res));
+  ASSERT_FALSE(cache.Lookup("ab0", key, res));
+  const std::string oldest = "ab" + std::to_string(1000 - stats.entries);
+  ASSERT_TRUE(cache.Lookup(oldest, key, res));
+  cache.Insert("ab1000", key, words);
+  ASSERT_TRUE(cache.Lookup(oldest, key, res));
+  ASSERT_EQ("ab", res[0].word);
+
+  // too large for the budget
+  cache.Insert(std::string(8192, 'a'), key, words);
+  ASSERT_FALSE(cache.Lookup(std::string(8192, 'a'), key, res));
+}
+
+TEST(SegmentCacheTest, DictVersion) {
+  DictTrie trie("../dict/jieba.dict.utf8");
+  HMMModel model("../dict/hmm_model.utf8");
+  MixSegment segment(&trie, &model);
+  SegmentCache cache(1 << 20);
+  const std::string sentence = "他来到了网易杭研大厦";
+
+  std::vector<Word> words;
+  SegmentCache::Key key = {0, 1, trie.GetVersion()};
+  segment.Cut(sentence, words);
+  cache.Insert(sentence, key, words);
+
+  uint64_t version = trie.GetVersion();
+  ASSERT_TRUE(trie.InsertUserWord("杭研大厦"));
+  ASSERT_NE(version, trie.GetVersion());
+  key.version = trie.GetVersion();
+  ASSERT_FALSE(cache.Lookup(sentence, key, words));
+  segment.Cut(sentence, words);
+  ASSERT_EQ("杭研大厦", words.back().word);
+  cache.Insert(sentence, key, words);
+
+  version = trie.GetVersion();
+  ASSERT_TRUE(trie.DeleteUserWord("杭研大厦"));
+  ASSERT_NE(version, trie.GetVersion());
+  key.version = trie.GetVersion();
+  ASSERT_FALSE(cache.Lookup(sentence, key, words));
+  version = trie.GetVersion();
+  ASSERT_FALSE(trie.DeleteUserWord("杭研大厦"));
+  ASSERT_EQ(version, trie.GetVersion());
+
+  // a user dict loaded later adds single-rune words
+  version = trie.GetVersion();
+  trie.LoadUserDict(std::vector<std::string>{"杭 nz"});
+  ASSERT_NE(version, trie.GetVersion());
+}
+
+TEST(SegmentCacheTest, Concurrent) {
+  MixSegment segment("../dict/jieba.dict.utf8", "../dict/hmm_model.utf8");
+  SegmentCache cache(16 << 10, 8);
+  const SegmentCache::Key key = {0, 1, 0};
+  const char *sentences[] = {"他来到了网易杭研大厦", "我来自北京邮电大学",
+                             "南京市长江大桥", "小明硕士毕业于中国科学院计算所",
+                             "我来到北京清华大学"};
+  const size_t num = sizeof(sentences) / sizeof(sentences[0]);
+  std::vector<std::string> expected(num);
+  for (size_t i = 0; i < num; ++i) {
+    std::vector<Word> words;
+    segment.Cut(sentences[i], words);
+    expected[i] = JoinWords(words);
+  }
+
+  std::vector<std::thread> threads;
+  std::vector<int> failures(4, 0);
+  for (size_t t = 0; t < failures.size(); ++t) {
+    threads.emplace_back([&, t]() {
+      std::vector<Word> words;
+      for (size_t n = 0; n < 2000; ++n) {
+        const size_t i = (n + t) % num;
+        // distinct sentences keep the shards evicting
+        const std::string sentence =
+            n % 3 ? std::string(sentences[i]) : sentences[i] + std::to_string(n);
+        if (!cache.Lookup(sentence, key, words)) {
+          segment.Cut(sentence, words);
+          cache.Insert(sentence, key, words);
+        } else if (sentence == sentences[i] &&
+                   JoinWords(words) != expected[i]) {
+          ++failures[t];
+        }
+      }
+    });
+  }
+  for (size_t t = 0; t < threads.size(); ++t) {
+    threads[t].join();
+  }
+  for (size_t t = 0; t < failures.size(); ++t) {
+    ASSERT_EQ(0, failures[t]);
+  }
+  SegmentCache::Stats stats = cache.GetStats();
+  ASSERT_EQ(8000u, stats.hits + stats.misses);
+  ASSERT_GT(stats.hits, 0u);
+  ASSERT_LE(stats.bytes, cache.GetCapacity());
+}
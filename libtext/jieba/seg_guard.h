@@ -0,0 +1,147 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_SEGMENT_SEG_GUARD_H_
+#define LIBTEXT_SEGMENT_SEG_GUARD_H_
+
+#include "libtext/jieba/dict_trie.h"
+#include "libtext/jieba/max_match_seg.h"
+#include "libtext/jieba/pre_filter.h"
+#include <atomic>
+#include <stdint.h>
+#include <vector>
+
+namespace libtext {
+
+// Bounds the work of a cut on pathological input, such as long strings
+// without separators. Ranges longer than max_range_len runes are split,
+// where possible at a point no dictionary word crosses; words are looked
+// up to max_word_len runes; and once max_work runes of a sentence have
+// been cut, the rest of it is cut by forward maximum matching only,
+// without the DP and the HMM. The output for ordinary sentences is
+// unchanged as long as their words are shorter than max_word_len.
+class SegmentGuard {
+public:
+  struct Options {
+    size_t max_range_len;
+    size_t max_word_len;
+    size_t max_work;
+    Options() : max_range_len(1024), max_word_len(32), max_work(1 << 16) {}
+  }; // struct Options
+
+  struct Stats {
+    uint64_t splits;
+    uint64_t fallbacks;
+  }; // struct Stats
+
+  explicit SegmentGuard(const Options &options = Options())
+      : options_(options), splits_(0), fallbacks_(0) {
+    if (options_.max_range_len == 0) {
+      options_.max_range_len = 1;
+    }
+    if (options_.max_word_len == 0) {
+      options_.max_word_len = 1;
+    }
+  }
+
+  const Options &GetOptions() const { return options_; }
+
+  // How often ranges were split, and how often the rest of a sentence was
+  // cut by maximum matching.
+  Stats GetStats() const {
+    Stats stats = {splits_.load(std::memory_order_relaxed),
+                   fallbacks_.load(std::memory_order_relaxed)};
+    return stats;
+  }
+
+  // Cuts the ranges of pre_filter into res, with cut(begin, end,
+  // max_word_len, res) while the work budget lasts. Splitting a range
+  // costs about one more trie walk per rune of the second half of its
+  // pieces.
+  template <typename Fn>
+  void Cut(const DictTrie *trie, PreFilter &pre_filter,
+           std::vector<WordRange> &res, Fn &&cut) const {
+    size_t work = 0;
+    bool fallback = false;
+    while (pre_filter.HasNext()) {
+      const PreFilter::Range range = pre_filter.Next();
+      RuneStrArray::const_iterator begin = range.begin;
+      while (begin != range.end) {
+        RuneStrArray::const_iterator end = range.end;
+        if (static_cast<size_t>(end - begin) > options_.max_range_len) {
+          end = SplitPoint(trie, begin, begin + options_.max_range_len,
+                           range.end);
+          splits_.fetch_add(1, std::memory_order_relaxed);
+        }
+        const size_t len = end - begin;
+        if (!fallback && work + len > options_.max_work) {
+          fallback = true;
+          fallbacks_.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (fallback) {
+          MaxMatchSegment::CutForward(trie, begin, end, options_.max_word_len,
+                                      res);
+        } else {
+          work += len;
+          cut(begin, end, options_.max_word_len, res);
+        }
+        begin = end;
+      }
+    }
+  }
+
+private:
+  // The point in the second half of [begin, limit] to split the range
+  // [begin, end) at: the last one no dictionary word crosses, or limit if
+  // there is none. Takes one walk per rune from max_word_len runes before
+  // the half on.
+  RuneStrArray::const_iterator
+  SplitPoint(const DictTrie *trie, RuneStrArray::const_iterator begin,
+             RuneStrArray::const_iterator limit,
+             RuneStrArray::const_iterator end) const {
+    const size_t max_word_len = options_.max_word_len;
+    const RuneStrArray::const_iterator half = begin + (limit - begin + 1) / 2;
+    RuneStrArray::const_iterator it =
+        static_cast<size_t>(half - begin) > max_word_len ? half - max_word_len
+                                                         : begin;
+    // the farthest end of the words which start before it
+    RuneStrArray::const_iterator reach = it;
+    RuneStrArray::const_iterator split = limit;
+    for (; it < limit; ++it) {
+      if (it >= half && reach <= it) {
+        split = it;
+      }
+      size_t len = 1;
+      trie->ForEachPrefix(it, end, max_word_len,
+                          [&len](size_t n, const DictUnit *unit) {
+                            if (unit != nullptr) {
+                              len = n;
+                            }
+                          });
+      if (it + len > reach) {
+        reach = it + len;
+      }
+    }
+    return reach <= limit ? limit : split;
+  }
+
+  Options options_;
+  mutable std::atomic<uint64_t> splits_;
+  mutable std::atomic<uint64_t> fallbacks_;
+}; // class SegmentGuard
+
+} // namespace libtext
+
+#endif // LIBTEXT_SEGMENT_SEG_GUARD_H_
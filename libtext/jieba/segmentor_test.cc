@@ -150,3 +150,53 @@ TEST(JiebaTest, InsertUserWord) {
     ASSERT_EQ(res, "{\"word\": \"iPhone6\", \"offset\": [6], \"weight\": 11.7392}, {\"word\": \"\xE4\xB8\x80\xE9\x83\xA8\", \"offset\": [0], \"weight\": 6.47592}");
   }
 }
+
+TEST(JiebaTest, Cache) {
+  libtext::Segmentor jieba("../dict/jieba.dict.utf8",
+                        "../dict/hmm_model.utf8",
+                        "../dict/user.dict.utf8",
+                        "../dict/idf.utf8",
+                        "../dict/stop_words.utf8");
+  jieba.EnableCache(1 << 20);
+  std::vector<std::string> words;
+  std::string result;
+
+  for (int i = 0; i < 2; i++) {
+    jieba.Cut("他来到了网易杭研大厦", words);
+    result = turbo::StrJoin(words, "/");
+    ASSERT_EQ("他/来到/了/网易/杭研/大厦", result);
+    jieba.CutForSearch("小明硕士毕业于中国科学院计算所", words);
+    result = turbo::StrJoin(words, "/");
+    ASSERT_EQ("小明/硕士/毕业/于/中国/科学/学院/科学院/中国科学院/计算/计算所", result);
+    jieba.CutSmall("南京市长江大桥", words, 3);
+    result = turbo::StrJoin(words, "/");
+    ASSERT_EQ("南京市/长江/大桥", result);
+  }
+  SegmentCache::Stats stats = jieba.GetCache()->GetStats();
+  ASSERT_EQ(3u, stats.hits);
+  ASSERT_EQ(3u, stats.misses);
+
+  // the modes and their options are cached apart
+  jieba.Cut("我来自北京邮电大学。", words, false);
+  result = turbo::StrJoin(words, "/");
+  ASSERT_EQ("我/来自/北京邮电大学/。", result);
+  jieba.Cut("我来自北京邮电大学。", words, true);
+  result = turbo::StrJoin(words, "/");
+  ASSERT_EQ("我/来自/北京邮电大学/。", result);
+  jieba.CutAll("我来自北京邮电大学", words);
+  result = turbo::StrJoin(words, "/");
+  ASSERT_EQ("我/来自/北京/北京邮电/北京邮电大学/邮电/邮电大学/电大/大学", result);
+  ASSERT_EQ(3u, jieba.GetCache()->GetStats().hits);
+
+  // results cut with an older dictionary are not served
+  ASSERT_TRUE(jieba.InsertUserWord("杭研大厦"));
+  jieba.Cut("他来到了网易杭研大厦", words);
+  result = turbo::StrJoin(words, "/");
+  ASSERT_EQ("他/来到/了/网易/杭研大厦", result);
+  ASSERT_EQ(3u, jieba.GetCache()->GetStats().hits);
+
+  // nor those cut before a user dict was loaded
+  jieba.LoadUserDict(std::vector<std::string>{"杭"});
+  jieba.Cut("他来到了网易杭研大厦", words);
+  ASSERT_EQ(3u, jieba.GetCache()->GetStats().hits);
+}
@@ -15,6 +15,7 @@
 
 #include "libtext/jieba/full_seg.h"
 #include "libtext/jieba/hmm_seg.h"
+#include "libtext/jieba/max_match_seg.h"
 #include "libtext/jieba/mix_seg.h"
 #include "libtext/jieba/mps_seg.h"
 #include "libtext/jieba/query_seg.h"
@@ -165,6 +166,61 @@ TEST(MixSegmentTest, TestMultiUserDict) {
   ASSERT_EQ("忽如一夜春风来/，/千树万树梨花开", res);
 }
 
+TEST(MixSegmentTest, Guard) {
+  MixSegment segment("../dict/jieba.dict.utf8", "../dict/hmm_model.utf8");
+  QuerySegment query("../dict/jieba.dict.utf8", "../dict/hmm_model.utf8");
+  SegmentGuard::Options options;
+  options.max_range_len = 64;
+  options.max_work = 256;
+  SegmentGuard guard(options);
+
+  std::vector<std::string> expected;
+  std::vector<std::string> words;
+  const char *sentence = "我来自北京邮电大学。。。学号123456，用AK47";
+  segment.Cut(sentence, expected, true);
+  segment.Cut(sentence, words, true, &guard);
+  ASSERT_EQ(expected, words);
+  query.Cut(sentence, expected, true);
+  query.Cut(sentence, words, true, &guard);
+  ASSERT_EQ(expected, words);
+  ASSERT_EQ(0u, guard.GetStats().splits);
+  ASSERT_EQ(0u, guard.GetStats().fallbacks);
+
+  // 900 runes without a separator: split into ranges of at most 64 runes,
+  // the last ones cut by maximum matching
+  std::string s;
+  for (int i = 0; i < 100; i++) {
+    s += "我来自北京邮电大学";
+  }
+  std::vector<Word> res;
+  segment.Cut(s, res, true, &guard);
+  std::string joined;
+  size_t max_match = 0;
+  for (size_t i = 0; i < res.size(); i++) {
+    ASSERT_EQ(joined.size(), res[i].offset);
+    joined += res[i].word;
+    max_match += res[i].word == "北京邮电大学";
+  }
+  ASSERT_EQ(s, joined);
+  ASSERT_EQ(100u, max_match);
+  SegmentGuard::Stats stats = guard.GetStats();
+  ASSERT_EQ(14u, stats.splits);
+  ASSERT_EQ(1u, stats.fallbacks);
+
+  RuneStrArray runes;
+  ASSERT_TRUE(DecodeRunesInString("北京邮电大学生活动", runes));
+  std::vector<WordRange> wrs;
+  MaxMatchSegment::CutForward(segment.GetDictTrie(), runes.begin(),
+                              runes.end(), 32, wrs);
+  std::vector<Word> mm;
+  GetWordsFromWordRanges("北京邮电大学生活动", wrs, mm);
+  std::string result = turbo::StrJoin(mm, "/", [](std::string *out,
+                                                  const Word &w) {
+    out->append(w.word);
+  });
+  ASSERT_EQ("北京邮电大学/生活/动", result);
+}
+
 TEST(MPSegmentTest, Test1) {
   MPSegment segment("../dict/jieba.dict.utf8");
   ;
@@ -221,6 +277,51 @@ TEST(HMMSegmentTest, Test1) {
     ASSERT_EQ(words, std::vector<std::string>(res, res + sizeof(res) /
                                                              sizeof(res[0])));
   }
+
+  {
+    // full-width letters and digits follow the rules of ASCII ones, CJK
+    // punctuation is cut on its own instead of by the HMM
+    const char *str = "ＩＢＭ１２．５：保湿";
+    const char *res[] = {"ＩＢＭ１２", "．", "５", "：", "保湿"};
+    std::vector<std::string> words;
+    segment.Cut(str, words);
+    ASSERT_EQ(words, std::vector<std::string>(res, res + sizeof(res) /
+                                                             sizeof(res[0])));
+  }
+}
+
+TEST(HMMSegmentTest, Cache) {
+  HMMSegment segment("../dict/hmm_model.utf8");
+  HMMSegment cached("../dict/hmm_model.utf8");
+  cached.EnableCache(16, 4);
+  const char *strs[] = {"我来自北京邮电大学。。。学号123456",
+                        "小明硕士毕业于中国科学院计算所",
+                        "他来到了网易杭研大厦，杭研大厦", "长春市长春节讲话"};
+  for (int round = 0; round < 2; round++) {
+    for (size_t i = 0; i < sizeof(strs) / sizeof(strs[0]); i++) {
+      std::vector<std::string> expected;
+      std::vector<std::string> words;
+      segment.Cut(strs[i], expected);
+      cached.Cut(strs[i], words);
+      ASSERT_EQ(expected, words);
+    }
+  }
+  // only the runs of 2 to 4 runes are looked up, 学号 and 杭研大厦
+  HMMCache::Stats stats = cached.GetCache()->GetStats();
+  ASSERT_EQ(2u, stats.entries);
+  ASSERT_EQ(2u, stats.hits);
+  ASSERT_EQ(2u, stats.misses);
+
+  MixSegment mix("../dict/jieba.dict.utf8", "../dict/hmm_model.utf8");
+  std::vector<std::string> expected;
+  mix.Cut("他来到了网易杭研大厦，杭研大厦", expected);
+  mix.EnableHMMCache(64);
+  std::vector<std::string> words;
+  mix.Cut("他来到了网易杭研大厦，杭研大厦", words);
+  ASSERT_EQ(expected, words);
+  stats = mix.GetHMMCache()->GetStats();
+  ASSERT_EQ(1u, stats.entries);
+  ASSERT_EQ(1u, stats.hits);
 }
 
 TEST(FullSegment, Test1) {
@@ -290,6 +391,79 @@ TEST(QuerySegment, Test2) {
     s2 = "中国/科学/学院/科学院/中国科学院";
     ASSERT_EQ(s1, s2);
   }
+
+  {
+    segment.Cut("中华人民共和国", words);
+    s1 = turbo::StrJoin(words.begin(), words.end(), "/");
+    ASSERT_EQ("中华/华人/人民/共和/共和国/中华人民共和国", s1);
+
+    segment.SetMaxSubWordLen(MAX_WORD_LENGTH);
+    segment.Cut("中华人民共和国", words);
+    s1 = turbo::StrJoin(words.begin(), words.end(), "/");
+    ASSERT_EQ("中华/华人/人民/共和/共和国/人民共和国/中华人民共和国", s1);
+
+    segment.SetMaxSubWordLen(2);
+    segment.Cut("中华人民共和国", words);
+    s1 = turbo::StrJoin(words.begin(), words.end(), "/");
+    ASSERT_EQ("中华/华人/人民/共和/中华人民共和国", s1);
+    segment.SetMaxSubWordLen(3);
+  }
+}
+
+TEST(QuerySegment, MultiGranularity) {
+  DictTrie trie("../test/testdata/extra_dict/jieba.dict.small.utf8",
+                "../test/testdata/userdict.utf8|../test/testdata/userdict.english");
+  HMMModel model("../dict/hmm_model.utf8");
+  QuerySegment segment(&trie, &model);
+  MixSegment mix(&trie, &model);
+  const char *sentences[] = {
+      "小明硕士毕业于中国科学院计算所，后在日本京都大学深造",
+      "小明硕士毕业于中国科学院计算所iPhone6", "中国科学院", ""};
+  for (const char *sentence : sentences) {
+    for (size_t max_sub_word_len : {3, 2, 4}) {
+      segment.SetMaxSubWordLen(max_sub_word_len);
+      for (bool hmm : {true, false}) {
+        MultiGranularity res;
+        if (hmm) {
+          // the length of CutForSearch by default
+          segment.CutMultiGranularity(sentence, res);
+        } else {
+          segment.CutMultiGranularity(sentence, res, max_sub_word_len, hmm);
+        }
+        std::vector<Word> words;
+        mix.Cut(sentence, words, hmm);
+        ASSERT_EQ(words.size(), res.coarse.size());
+        ASSERT_EQ(words.size() + 1, res.fine_begin.size());
+        ASSERT_EQ(res.fine.size(), res.fine_begin.back());
+        for (size_t i = 0; i < words.size(); i++) {
+          ASSERT_EQ(words[i].word, res.coarse[i].word);
+          ASSERT_EQ(words[i].offset, res.coarse[i].offset);
+        }
+
+        // nested words then their coarse word, as in CutForSearch
+        std::vector<std::string> flat;
+        for (size_t i = 0; i < res.coarse.size(); i++) {
+          for (size_t j = res.fine_begin[i]; j < res.fine_begin[i + 1]; j++) {
+            ASSERT_GE(res.fine[j].offset, res.coarse[i].offset);
+            ASSERT_LE(res.fine[j].offset + res.fine[j].word.size(),
+                      res.coarse[i].offset + res.coarse[i].word.size());
+            flat.push_back(res.fine[j].word);
+          }
+          flat.push_back(res.coarse[i].word);
+        }
+        std::vector<std::string> query;
+        segment.Cut(sentence, query, hmm);
+        ASSERT_EQ(turbo::StrJoin(query, "/"), turbo::StrJoin(flat, "/"));
+      }
+    }
+  }
+
+  MultiGranularity res;
+  segment.CutMultiGranularity("中国科学院", res, 4);
+  ASSERT_EQ(1u, res.coarse.size());
+  std::vector<std::string> fine;
+  GetStringsFromWords(res.fine, fine);
+  ASSERT_EQ("中国/科学/学院/科学院", turbo::StrJoin(fine, "/"));
 }
 
 TEST(MPSegmentTest, Unicode32) {
@@ -303,3 +477,279 @@ TEST(MPSegmentTest, Unicode32) {
   ASSERT_EQ(turbo::StrJoin(words.begin(), words.end(), "/"),
             "天气/很/好/，/🙋/ /我们/去/郊游/。");
 }
+
+TEST(MPSegmentTest, NBest) {
+  MPSegment segment("../dict/jieba.dict.utf8");
+  const char *sentences[] = {"南京市长江大桥", "我来自北京邮电大学。", "B超 T恤", ""};
+  for (const char *sentence : sentences) {
+    std::vector<Word> best;
+    segment.Cut(sentence, best);
+    std::vector<Word> lattice;
+    std::vector<double> weights;
+    segment.CutLattice(sentence, lattice, weights);
+    ASSERT_EQ(lattice.size(), weights.size());
+
+    // number of paths through the lattice, by byte offset
+    std::string s(sentence);
+    std::vector<double> paths(s.size() + 1);
+    paths[s.size()] = 1;
+    for (size_t i = lattice.size(); i-- > 0;) {
+      paths[lattice[i].offset] += paths[lattice[i].offset + lattice[i].word.size()];
+    }
+
+    std::vector<Segmentation> res;
+    segment.CutNBest(sentence, 1000, res);
+    ASSERT_EQ(paths[0], res.size());
+    ASSERT_EQ(best.size(), res[0].words.size());
+    for (size_t i = 0; i < best.size(); i++) {
+      ASSERT_EQ(best[i].word, res[0].words[i].word);
+      ASSERT_EQ(best[i].offset, res[0].words[i].offset);
+    }
+    std::set<std::string> seen;
+    for (size_t r = 0; r < res.size(); r++) {
+      if (r > 0) {
+        ASSERT_LE(res[r].weight, res[r - 1].weight);
+      }
+      std::string joined = turbo::StrJoin(res[r].words, "/", WordFormatter());
+      ASSERT_TRUE(seen.insert(joined).second) << joined;
+      double weight = 0.0;
+      std::string concat;
+      for (const Word &w : res[r].words) {
+        ASSERT_EQ(concat.size(), w.offset);
+        concat += w.word;
+        size_t j = 0;
+        while (j < lattice.size() && (lattice[j].offset != w.offset ||
+                                      lattice[j].word != w.word)) {
+          j++;
+        }
+        ASSERT_LT(j, lattice.size());
+        weight += weights[j];
+      }
+      ASSERT_EQ(s, concat);
+      ASSERT_NEAR(weight, res[r].weight, 1e-6);
+    }
+
+    segment.CutNBest(sentence, 2, res);
+    ASSERT_LE(res.size(), 2u);
+    segment.CutNBest(sentence, 0, res);
+    ASSERT_TRUE(res.empty());
+  }
+
+  std::vector<Segmentation> res;
+  segment.CutNBest("南京市长江大桥", 3, res);
+  ASSERT_EQ(3u, res.size());
+  std::vector<std::string> words;
+  GetStringsFromWords(res[0].words, words);
+  ASSERT_EQ("南京市/长江大桥", turbo::StrJoin(words, "/"));
+  GetStringsFromWords(res[1].words, words);
+  ASSERT_NE("南京市/长江大桥", turbo::StrJoin(words, "/"));
+
+  // a k past the number of segmentations gets all of them
+  std::vector<Segmentation> all;
+  segment.CutNBest("南京市长江大桥", 1000, all);
+  segment.CutNBest("南京市长江大桥", SIZE_MAX, res);
+  ASSERT_EQ(all.size(), res.size());
+  segment.CutNBest("南京市长江大桥", SIZE_MAX / 8 + 2, res);
+  ASSERT_EQ(all.size(), res.size());
+  for (size_t r = 0; r < res.size(); r++) {
+    ASSERT_EQ(all[r].words.size(), res[r].words.size());
+    ASSERT_EQ(all[r].weight, res[r].weight);
+  }
+}
+
+TEST(MPSegmentTest, AsciiRuns) {
+  DictTrie trie("../dict/jieba.dict.utf8");
+  HMMModel model("../dict/hmm_model.utf8");
+  MPSegment mp(&trie);
+  MixSegment mix(&trie, &model);
+  QuerySegment query(&trie, &model);
+  const std::string sentence = "iPhone15 售价3.14元";
+  const std::string expected = "iPhone15/ /售价/3.14/元";
+  std::vector<std::string> words;
+
+  // off by default
+  mp.Cut(sentence, words);
+  ASSERT_EQ("i/P/h/o/n/e/1/5/ /售价/3/./1/4/元", turbo::StrJoin(words, "/"));
+
+  mp.EnableAsciiRuns();
+  mix.EnableAsciiRuns();
+  query.EnableAsciiRuns();
+  mp.Cut(sentence, words);
+  ASSERT_EQ(expected, turbo::StrJoin(words, "/"));
+  mix.Cut(sentence, words);
+  ASSERT_EQ(expected, turbo::StrJoin(words, "/"));
+  mix.Cut(sentence, words, false);
+  ASSERT_EQ(expected, turbo::StrJoin(words, "/"));
+  query.Cut(sentence, words);
+  ASSERT_EQ(expected, turbo::StrJoin(words, "/"));
+  MultiGranularity mg;
+  query.CutMultiGranularity(sentence, mg);
+  GetStringsFromWords(mg.coarse, words);
+  ASSERT_EQ(expected, turbo::StrJoin(words, "/"));
+
+  // the best of CutNBest is the cut, and no segmentation cuts a run
+  std::vector<Segmentation> res;
+  mp.CutNBest(sentence, 100, res);
+  ASSERT_FALSE(res.empty());
+  GetStringsFromWords(res[0].words, words);
+  ASSERT_EQ(expected, turbo::StrJoin(words, "/"));
+  for (size_t r = 0; r < res.size(); r++) {
+    GetStringsFromWords(res[r].words, words);
+    ASSERT_EQ("iPhone15", words[0]);
+    ASSERT_NE(words.end(), std::find(words.begin(), words.end(), "3.14"));
+  }
+  std::vector<Word> lattice;
+  std::vector<double> weights;
+  mp.CutLattice(sentence, lattice, weights);
+  GetStringsFromWords(lattice, words);
+  ASSERT_NE(words.end(), std::find(words.begin(), words.end(), "iPhone15"));
+  ASSERT_NE(words.end(), std::find(words.begin(), words.end(), "3.14"));
+
+  // the dots only join digits
+  mp.Cut("v1.2.3 a.b 3.", words);
+  ASSERT_EQ("v1.2.3/ /a/./b/ /3/.", turbo::StrJoin(words, "/"));
+
+  // a run in which a word starts is cut as before
+  ASSERT_TRUE(trie.InsertUserWord("B超"));
+  ASSERT_TRUE(trie.InsertUserWord("Phone15"));
+  mp.Cut("CB超", words);
+  ASSERT_EQ("C/B超", turbo::StrJoin(words, "/"));
+  mp.Cut(sentence, words);
+  ASSERT_EQ("i/Phone15/ /售价/3.14/元", turbo::StrJoin(words, "/"));
+  mix.Cut(sentence, words);
+  ASSERT_EQ("i/Phone15/ /售价/3.14/元", turbo::StrJoin(words, "/"));
+
+  mp.DisableAsciiRuns();
+  mp.Cut("3.14", words);
+  ASSERT_EQ("3/./1/4", turbo::StrJoin(words, "/"));
+}
+
+TEST(MaxMatchSegmentTest, Test1) {
+  DictTrie trie("../dict/jieba.dict.utf8");
+  MaxMatchSegment forward(&trie, MaxMatchSegment::MaxMatchForward);
+  MaxMatchSegment backward(&trie, MaxMatchSegment::MaxMatchBackward);
+  MaxMatchSegment both(&trie);
+  std::vector<std::string> words;
+
+  forward.Cut("研究生命起源", words);
+  ASSERT_EQ("研究生/命/起源", turbo::StrJoin(words, "/"));
+  backward.Cut("研究生命起源", words);
+  ASSERT_EQ("研究/生命/起源", turbo::StrJoin(words, "/"));
+  both.Cut("研究生命起源", words);
+  ASSERT_EQ("研究/生命/起源", turbo::StrJoin(words, "/"));
+
+  // letters and digits no word starts with stay together
+  both.Cut("我来自北京邮电大学。。。123456，用AK47", words);
+  ASSERT_EQ("我/来自/北京邮电大学/。/。/。/123456/，/用/AK47",
+            turbo::StrJoin(words, "/"));
+
+  // words of the input, in order, in every mode
+  const std::string s = "小明硕士毕业于中国科学院计算所，后在日本京都大学深造";
+  MaxMatchSegment *segments[] = {&forward, &backward, &both};
+  for (MaxMatchSegment *segment : segments) {
+    std::vector<Word> res;
+    segment->Cut(s, res);
+    std::string joined;
+    for (size_t i = 0; i < res.size(); i++) {
+      ASSERT_EQ(joined.size(), res[i].offset);
+      joined += res[i].word;
+    }
+    ASSERT_EQ(s, joined);
+    segment->Cut(s, res, 1);
+    ASSERT_EQ(26u, res.size());
+  }
+}
+
+TEST(MaxMatchSegmentTest, UserWord) {
+  DictTrie trie("../dict/jieba.dict.utf8");
+  MaxMatchSegment segment(&trie, MaxMatchSegment::MaxMatchBackward);
+  std::vector<std::string> words;
+  segment.Cut("他来到了网易杭研大厦", words);
+  ASSERT_NE("杭研大厦", words.back());
+
+  // the reversed words follow the dictionary
+  ASSERT_TRUE(trie.InsertUserWord("杭研大厦"));
+  segment.Cut("他来到了网易杭研大厦", words);
+  ASSERT_EQ("杭研大厦", words.back());
+
+  ASSERT_TRUE(trie.DeleteUserWord("杭研大厦"));
+  segment.Cut("他来到了网易杭研大厦", words);
+  ASSERT_NE("杭研大厦", words.back());
+  std::vector<std::string> forward;
+  MaxMatchSegment(&trie, MaxMatchSegment::MaxMatchForward)
+      .Cut("他来到了网易杭研大厦", forward);
+  ASSERT_EQ(turbo::StrJoin(forward, "/"), turbo::StrJoin(words, "/"));
+  segment.SetMode(MaxMatchSegment::MaxMatchBidirectional);
+  segment.Cut("他来到了网易杭研大厦", words);
+  ASSERT_NE("杭研大厦", words.back());
+}
+
+// The words of a streaming Cut in the format of the Cuts into Words, and
+// whether every unit is the dictionary entry of its word.
+template <typename Seg, typename... Args>
+static std::string StreamWords(const Seg &segment, const std::string &s,
+                               bool *units_match, Args... args) {
+  std::string res;
+  *units_match = true;
+  segment.Cut(
+      s,
+      [&res, units_match](const WordView &w) {
+        turbo::StrAppend(&res, res.empty() ? "" : "/", std::string(w.word),
+                         ":", w.offset, ":", w.unicode_offset, ":",
+                         w.unicode_length);
+        if (w.unit != nullptr && w.unit->word.size() != w.unicode_length) {
+          *units_match = false;
+        }
+      },
+      args...);
+  return res;
+}
+
+static std::string JoinWords(const std::vector<Word> &words) {
+  std::string res;
+  for (size_t i = 0; i < words.size(); ++i) {
+    turbo::StrAppend(&res, i ? "/" : "", words[i].word, ":", words[i].offset,
+                     ":", words[i].unicode_offset, ":",
+                     words[i].unicode_length);
+  }
+  return res;
+}
+
+TEST(SegmentTest, StreamingCut) {
+  DictTrie trie("../dict/jieba.dict.utf8");
+  HMMModel model("../dict/hmm_model.utf8");
+  MPSegment mp(&trie);
+  MixSegment mix(&trie, &model);
+  QuerySegment query(&trie, &model);
+  const char *sentences[] = {
+      "", "他来到了网易杭研大厦", "我来自北京邮电大学。。。学号123456，用AK47",
+      "小明硕士毕业于中国科学院计算所，后在日本京都大学深造"};
+  bool units_match;
+  std::vector<Word> words;
+  for (const char *s : sentences) {
+    mp.Cut(s, words);
+    ASSERT_EQ(JoinWords(words), StreamWords(mp, s, &units_match));
+    ASSERT_TRUE(units_match);
+    mp.Cut(s, words, 2);
+    ASSERT_EQ(JoinWords(words), StreamWords(mp, s, &units_match, size_t(2)));
+    mix.Cut(s, words);
+    ASSERT_EQ(JoinWords(words), StreamWords(mix, s, &units_match));
+    ASSERT_TRUE(units_match);
+    mix.Cut(s, words, false);
+    ASSERT_EQ(JoinWords(words), StreamWords(mix, s, &units_match, false));
+    query.Cut(s, words);
+    ASSERT_EQ(JoinWords(words), StreamWords(query, s, &units_match));
+    ASSERT_TRUE(units_match);
+  }
+
+  // the dictionary words have their units, the words of the HMM none
+  std::vector<const DictUnit *> units;
+  mix.Cut("他来到了网易杭研大厦", [&units](const WordView &w) {
+    units.push_back(w.unit);
+  });
+  ASSERT_EQ(6u, units.size());
+  ASSERT_NE(nullptr, units[1]);
+  ASSERT_EQ(DecodeRunesInString("来到"), units[1]->word);
+  // 杭研
+  ASSERT_EQ(nullptr, units[4]);
+}
@@ -17,6 +17,7 @@
 #define LIBTEXT_SEGMENT_TRIE_H_
 
 #include "libtext/jieba/unicode.h"
+#include <algorithm>
 #include <queue>
 #include "turbo/container/flat_hash_map.h"
 #include <vector>
@@ -40,36 +41,92 @@ struct DictUnit {
 // }
 
 struct Dag {
-  RuneStr runestr;
   // [offset, nexts.first]
   turbo::InlinedVector<std::pair<size_t, const DictUnit *>, 8> nexts;
   const DictUnit *pInfo;
   double weight;
   size_t nextPos; // TODO
-  Dag() : runestr(), pInfo(nullptr), weight(0.0), nextPos(0) {}
+  Dag() : pInfo(nullptr), weight(0.0), nextPos(0) {}
 }; // struct Dag
 
+// The DAG of a sentence in compressed sparse row form, a few flat arrays
+// instead of one vector of edges per rune. The edges leaving rune i are
+// [starts[i], starts[i + 1]); edge k ends at rune ends[k] and is the word
+// units[k], or the rune alone if it is not in the dictionary and units[k]
+// is null. As in Dag::nexts, the first edge of a rune is the rune alone.
+struct CompactDag {
+  std::vector<uint32_t> starts;
+  std::vector<uint32_t> ends;
+  std::vector<const DictUnit *> units;
+
+  size_t size() const { return starts.empty() ? 0 : starts.size() - 1; }
+
+  size_t NumEdges(size_t i) const { return starts[i + 1] - starts[i]; }
+
+  void clear() {
+    starts.clear();
+    ends.clear();
+    units.clear();
+  }
+
+  void AddEdge(size_t end, const DictUnit *unit) {
+    ends.push_back(static_cast<uint32_t>(end));
+    units.push_back(unit);
+  }
+}; // struct CompactDag
+
 typedef Rune TrieKey;
 
 class TrieNode {
 public:
-  TrieNode() : next(nullptr), ptValue(nullptr) {}
+  TrieNode() : next(nullptr), ptValue(nullptr), child_mask(0), height(0) {}
+
+  // False if no child is keyed by `key`, which ends most walks off the
+  // dictionary without probing next.
+  bool MayHaveChild(TrieKey key) const {
+    return (child_mask >> (key & 63)) & 1;
+  }
 
 public:
   typedef turbo::flat_hash_map<TrieKey, TrieNode *> NextMap;
   NextMap *next;
   const DictUnit *ptValue;
+  // bit k is set if a child is keyed by a rune r with r % 64 == k
+  uint64_t child_mask;
+  // the length in runes of the longest key below this node, 0 if it has
+  // no child; the heights of the children of the root bound the words by
+  // their first rune
+  uint32_t height;
 };
 
 class Trie {
 public:
   Trie(const std::vector<Unicode> &keys,
        const std::vector<const DictUnit *> &valuePointers)
-      : root_(new TrieNode) {
+      : root_(new TrieNode), ascii_in_keys_{0, 0} {
     CreateTrie(keys, valuePointers);
   }
   ~Trie() { DeleteNode(root_); }
 
+  // The length in runes of the longest key.
+  size_t GetMaxKeyLength() const { return root_->height; }
+
+  // The length in runes of the longest key starting with `first`, 0 if
+  // there is none.
+  size_t GetMaxKeyLength(TrieKey first) const {
+    if (root_->next == nullptr || !root_->MayHaveChild(first)) {
+      return 0;
+    }
+    TrieNode::NextMap::const_iterator citer = root_->next->find(first);
+    return citer == root_->next->end() ? 0 : citer->second->height + 1;
+  }
+
+  // Whether `key` is an ASCII rune which no key contains, so that no key
+  // crosses it. The runes of deleted keys still count as contained.
+  bool IsAsciiNotInKeys(TrieKey key) const {
+    return key < 0x80 && !((ascii_in_keys_[key >> 6] >> (key & 63)) & 1);
+  }
+
   const DictUnit *Find(RuneStrArray::const_iterator begin,
                        RuneStrArray::const_iterator end) const {
     if (begin == end) {
@@ -79,7 +136,7 @@ public:
     const TrieNode *ptNode = root_;
     TrieNode::NextMap::const_iterator citer;
     for (RuneStrArray::const_iterator it = begin; it != end; it++) {
-      if (nullptr == ptNode->next) {
+      if (!ptNode->MayHaveChild(it->rune)) {
         return nullptr;
       }
       citer = ptNode->next->find(it->rune);
@@ -91,50 +148,120 @@ public:
     return ptNode->ptValue;
   }
 
-  void Find(RuneStrArray::const_iterator begin,
-            RuneStrArray::const_iterator end, std::vector<struct Dag> &res,
-            size_t max_word_len = MAX_WORD_LENGTH) const {
+  // Calls fn(len, unit) for every word of at most max_word_len runes which
+  // is a prefix of [begin, end), shortest first. The first call is always
+  // for the first rune alone, with a null unit if it is not a word. The
+  // walk stops at the height of the node it reached, and skips the probe
+  // of a rune the child mask rules out. ASCII runes which no key contains,
+  // like most letters and digits in mixed text, are not looked up at all.
+  template <typename Fn>
+  void ForEachPrefix(RuneStrArray::const_iterator begin,
+                     RuneStrArray::const_iterator end, size_t max_word_len,
+                     Fn &&fn) const {
     assert(root_ != nullptr);
-    res.resize(static_cast<size_t>(end - begin));
-
+    assert(begin != end);
     const TrieNode *ptNode = nullptr;
     TrieNode::NextMap::const_iterator citer;
-    for (size_t i = 0; i < size_t(end - begin); i++) {
-      res[i].runestr = *(begin + i);
+    if (!IsAsciiNotInKeys(begin->rune) && root_->MayHaveChild(begin->rune) &&
+        root_->next->end() != (citer = root_->next->find(begin->rune))) {
+      ptNode = citer->second;
+    }
+    fn(size_t(1), ptNode != nullptr ? ptNode->ptValue : nullptr);
+    if (ptNode == nullptr) {
+      return;
+    }
 
-      if (root_->next != nullptr &&
-          root_->next->end() !=
-              (citer = root_->next->find(res[i].runestr.rune))) {
-        ptNode = citer->second;
-      } else {
-        ptNode = nullptr;
+    size_t n = static_cast<size_t>(end - begin);
+    n = std::min(n, std::min(max_word_len, size_t(ptNode->height) + 1));
+    for (size_t len = 2; len <= n; len++) {
+      const Rune rune = (begin + (len - 1))->rune;
+      if (!ptNode->MayHaveChild(rune)) {
+        break;
       }
-      if (ptNode != nullptr) {
-        res[i].nexts.push_back(
-            std::pair<size_t, const DictUnit *>(i, ptNode->ptValue));
-      } else {
-        res[i].nexts.push_back(std::pair<size_t, const DictUnit *>(
-            i, static_cast<const DictUnit *>(nullptr)));
+      citer = ptNode->next->find(rune);
+      if (ptNode->next->end() == citer) {
+        break;
       }
+      ptNode = citer->second;
+      if (nullptr != ptNode->ptValue) {
+        fn(len, ptNode->ptValue);
+      }
+    }
+  }
 
-      for (size_t j = i + 1;
-           j < size_t(end - begin) && (j - i + 1) <= max_word_len; j++) {
-        if (ptNode == nullptr || ptNode->next == nullptr) {
-          break;
-        }
-        citer = ptNode->next->find((begin + j)->rune);
-        if (ptNode->next->end() == citer) {
-          break;
-        }
-        ptNode = citer->second;
-        if (nullptr != ptNode->ptValue) {
-          res[i].nexts.push_back(
-              std::pair<size_t, const DictUnit *>(j, ptNode->ptValue));
+  // The length of the longest key of at most max_len runes which is a
+  // prefix of runes[0, n), 0 if there is none.
+  size_t LongestPrefix(const Rune *runes, size_t n, size_t max_len) const {
+    const TrieNode *ptNode = root_;
+    size_t longest = 0;
+    n = std::min(n, max_len);
+    for (size_t len = 0; len < n && ptNode->height != 0; len++) {
+      if (IsAsciiNotInKeys(runes[len]) || !ptNode->MayHaveChild(runes[len])) {
+        break;
+      }
+      TrieNode::NextMap::const_iterator citer = ptNode->next->find(runes[len]);
+      if (ptNode->next->end() == citer) {
+        break;
+      }
+      ptNode = citer->second;
+      if (nullptr != ptNode->ptValue) {
+        longest = len + 1;
+      }
+    }
+    return longest;
+  }
+
+  // Calls fn(unit) for the value of every key, in no particular order.
+  template <typename Fn>
+  void ForEachValue(Fn &&fn) const {
+    std::vector<const TrieNode *> stack(1, root_);
+    while (!stack.empty()) {
+      const TrieNode *node = stack.back();
+      stack.pop_back();
+      if (nullptr != node->ptValue) {
+        fn(node->ptValue);
+      }
+      if (nullptr != node->next) {
+        for (TrieNode::NextMap::const_iterator it = node->next->begin();
+             it != node->next->end(); ++it) {
+          stack.push_back(it->second);
         }
       }
     }
   }
 
+  void Find(RuneStrArray::const_iterator begin,
+            RuneStrArray::const_iterator end, CompactDag &res,
+            size_t max_word_len = MAX_WORD_LENGTH) const {
+    const size_t n = static_cast<size_t>(end - begin);
+    res.clear();
+    res.starts.reserve(n + 1);
+    res.ends.reserve(2 * n);
+    res.units.reserve(2 * n);
+    for (size_t i = 0; i < n; i++) {
+      res.starts.push_back(static_cast<uint32_t>(res.ends.size()));
+      ForEachPrefix(begin + i, end, max_word_len,
+                    [&res, i](size_t len, const DictUnit *unit) {
+                      res.AddEdge(i + len - 1, unit);
+                    });
+    }
+    res.starts.push_back(static_cast<uint32_t>(res.ends.size()));
+  }
+
+  void Find(RuneStrArray::const_iterator begin,
+            RuneStrArray::const_iterator end, std::vector<struct Dag> &res,
+            size_t max_word_len = MAX_WORD_LENGTH) const {
+    CompactDag dag;
+    Find(begin, end, dag, max_word_len);
+    res.resize(dag.size());
+    for (size_t i = 0; i < dag.size(); i++) {
+      for (size_t k = dag.starts[i]; k < dag.starts[i + 1]; k++) {
+        res[i].nexts.push_back(
+            std::pair<size_t, const DictUnit *>(dag.ends[k], dag.units[k]));
+      }
+    }
+  }
+
   void InsertNode(const Unicode &key, const DictUnit *ptValue) {
     if (key.begin() == key.end()) {
       return;
@@ -144,9 +271,15 @@ public:
     TrieNode *ptNode = root_;
     for (Unicode::const_iterator citer = key.begin(); citer != key.end();
          ++citer) {
+      if (*citer < 0x80) {
+        ascii_in_keys_[*citer >> 6] |= uint64_t(1) << (*citer & 63);
+      }
       if (nullptr == ptNode->next) {
         ptNode->next = new TrieNode::NextMap;
       }
+      ptNode->child_mask |= uint64_t(1) << (*citer & 63);
+      ptNode->height = std::max(ptNode->height,
+                                static_cast<uint32_t>(key.end() - citer));
       kmIter = ptNode->next->find(*citer);
       if (ptNode->next->end() == kmIter) {
         TrieNode *nextNode = new TrieNode;
@@ -160,33 +293,48 @@ public:
     assert(ptNode != nullptr);
     ptNode->ptValue = ptValue;
   }
-  void DeleteNode(const Unicode &key, const DictUnit *ptValue) {
+  // Removes key and the nodes it leaves without a value or a child, then
+  // updates the masks and heights above them. Returns false if key is not
+  // in the trie.
+  bool DeleteNode(const Unicode &key) {
     if (key.begin() == key.end()) {
-      return;
+      return false;
     }
-    // 定义一个NextMap迭代器
-    TrieNode::NextMap::const_iterator kmIter;
-    // 定义一个指向root的TrieNode指针
+    std::vector<TrieNode *> path;
+    path.reserve(key.size() + 1);
     TrieNode *ptNode = root_;
+    path.push_back(ptNode);
     for (Unicode::const_iterator citer = key.begin(); citer != key.end();
          ++citer) {
-      // 链表不存在元素
-      if (nullptr == ptNode->next) {
-        return;
+      if (!ptNode->MayHaveChild(*citer)) {
+        return false;
       }
-      kmIter = ptNode->next->find(*citer);
-      // if not exist, break loop
+      TrieNode::NextMap::const_iterator kmIter = ptNode->next->find(*citer);
       if (ptNode->next->end() == kmIter) {
-        break;
+        return false;
       }
-      // erase from flat_hash_map
-      ptNode->next->erase(*citer);
-      // erase node
       ptNode = kmIter->second;
-      delete ptNode;
-      break;
+      path.push_back(ptNode);
+    }
+    if (ptNode->ptValue == nullptr) {
+      return false;
     }
-    return;
+    ptNode->ptValue = nullptr;
+
+    for (size_t depth = key.size(); depth > 0; depth--) {
+      TrieNode *child = path[depth];
+      TrieNode *parent = path[depth - 1];
+      if (child->ptValue == nullptr && child->next == nullptr) {
+        parent->next->erase(key[depth - 1]);
+        delete child;
+        if (parent->next->empty()) {
+          delete parent->next;
+          parent->next = nullptr;
+        }
+      }
+      UpdateNode(parent);
+    }
+    return true;
   }
 
 private:
@@ -202,6 +350,20 @@ private:
     }
   }
 
+  // Recomputes the child mask and the height of node from its children.
+  static void UpdateNode(TrieNode *node) {
+    node->child_mask = 0;
+    node->height = 0;
+    if (node->next == nullptr) {
+      return;
+    }
+    for (TrieNode::NextMap::const_iterator it = node->next->begin();
+         it != node->next->end(); ++it) {
+      node->child_mask |= uint64_t(1) << (it->first & 63);
+      node->height = std::max(node->height, it->second->height + 1);
+    }
+  }
+
   void DeleteNode(TrieNode *node) {
     if (nullptr == node) {
       return;
@@ -217,6 +379,8 @@ private:
   }
 
   TrieNode *root_;
+  // bit r is set if a key contains the ASCII rune r
+  uint64_t ascii_in_keys_[2];
 }; // class Trie
 } // namespace libtext
 
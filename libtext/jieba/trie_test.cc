@@ -16,6 +16,8 @@
 
 #include "libtext/jieba/dict_trie.h"
 #include "libtext/jieba/mps_seg.h"
+#include <algorithm>
+#include <fstream>
 #include <turbo/strings/str_join.h>
 #include "gtest/gtest.h"
 
@@ -37,6 +39,69 @@ TEST(TrieTest, Construct) {
   Trie trie(keys, values);
 }
 
+TEST(TrieTest, RuneStrArray) {
+  // long enough to outgrow the inlined storage
+  std::string s("a你好b世界cd１２3こんにちはxyz");
+  RuneStrArray runes;
+  ASSERT_TRUE(DecodeRunesInString(s, runes));
+  Unicode unicode = DecodeRunesInString(s);
+  ASSERT_EQ(unicode.size(), runes.size());
+  uint32_t offset = 0;
+  for (size_t i = 0; i < runes.size(); ++i) {
+    RuneStr r = runes[i];
+    ASSERT_EQ(unicode[i], r.rune);
+    ASSERT_EQ(GetCharClass(r.rune), r.char_class);
+    ASSERT_EQ(offset, r.offset);
+    ASSERT_EQ(i, r.unicode_offset);
+    ASSERT_EQ(1u, r.unicode_length);
+    offset += r.len;
+  }
+  ASSERT_EQ(s.size(), offset);
+
+  RuneStrArray::const_iterator it = runes.begin() + 3;
+  ASSERT_EQ(3, it - runes.begin());
+  ASSERT_EQ(runes[3].offset, it->offset);
+  ASSERT_EQ(runes[4].rune, (*++it).rune);
+  ASSERT_EQ(runes.size(), size_t(runes.end() - runes.begin()));
+  ASSERT_EQ("世界", GetStringFromRunes(s, runes.begin() + 4, runes.begin() + 5));
+
+  ASSERT_TRUE(DecodeRunesInString("你好", runes));
+  ASSERT_EQ(2u, runes.size());
+  ASSERT_EQ(3u, runes[1].offset);
+  ASSERT_EQ(3u, runes[1].len);
+  ASSERT_FALSE(DecodeRunesInString("\xe4\xbd", runes));
+  ASSERT_TRUE(runes.empty());
+}
+
+TEST(TrieTest, RuneStrArrayAscii) {
+  // runs of ASCII shorter and longer than a vector, between other runes
+  std::string s("Hello, world! std::vector<int> v(16);你a好b, 1234567890123456"
+                "７x\t\n\x7f世");
+  for (size_t i = 0; i < 3; ++i) {
+    s += s;
+  }
+  RuneStrArray runes;
+  ASSERT_TRUE(DecodeRunesInString(s, runes));
+  Unicode unicode = DecodeRunesInString(s);
+  ASSERT_EQ(unicode.size(), runes.size());
+  uint32_t offset = 0;
+  for (size_t i = 0; i < runes.size(); ++i) {
+    RuneStr r = runes[i];
+    ASSERT_EQ(unicode[i], r.rune);
+    ASSERT_EQ(GetCharClass(r.rune), r.char_class);
+    ASSERT_EQ(offset, r.offset);
+    offset += r.len;
+  }
+  ASSERT_EQ(s.size(), offset);
+
+  ASSERT_TRUE(DecodeRunesInString(std::string(100, 'x'), runes));
+  ASSERT_EQ(100u, runes.size());
+  ASSERT_EQ(99u, runes[99].offset);
+  ASSERT_EQ(CharClassLetter, runes[99].char_class);
+  ASSERT_FALSE(DecodeRunesInString(std::string(20, 'x') + "\xe4\xbd", runes));
+  ASSERT_TRUE(runes.empty());
+}
+
 TEST(DictTrieTest, NewAndDelete) {
   DictTrie * trie;
   trie = new DictTrie(DICT_FILE);
@@ -117,6 +182,51 @@ TEST(DictTrieTest, UserDictWithMaxWeight) {
   ASSERT_NEAR(unit->weight, -2.975, 0.001);
 }
 
+TEST(DictTrieTest, CompactDag) {
+  DictTrie trie(DICT_FILE, "../test/testdata/userdict.utf8");
+  const char *words[] = {"清华大学", "北京邮电大学", "长江大桥", "他来到了网易杭研大厦"};
+  for (size_t w = 0; w < sizeof(words) / sizeof(words[0]); w++) {
+    for (size_t max_word_len : {size_t(3), MAX_WORD_LENGTH}) {
+      libtext::RuneStrArray unicode;
+      ASSERT_TRUE(DecodeRunesInString(words[w], unicode));
+      CompactDag dag;
+      trie.Find(unicode.begin(), unicode.end(), dag, max_word_len);
+      ASSERT_EQ(unicode.size(), dag.size());
+      for (size_t i = 0; i < dag.size(); i++) {
+        // the rune alone, then every longer span which is a word
+        std::vector<std::pair<size_t, const DictUnit *>> expected;
+        expected.push_back(std::make_pair(
+            i, trie.Find(unicode.begin() + i, unicode.begin() + i + 1)));
+        for (size_t j = i + 1; j < dag.size() && j - i < max_word_len; j++) {
+          const DictUnit *unit =
+              trie.Find(unicode.begin() + i, unicode.begin() + j + 1);
+          if (unit != nullptr) {
+            expected.push_back(std::make_pair(j, unit));
+          }
+        }
+        ASSERT_EQ(expected.size(), dag.NumEdges(i));
+        for (size_t k = 0; k < expected.size(); k++) {
+          ASSERT_EQ(expected[k].first, dag.ends[dag.starts[i] + k]);
+          ASSERT_EQ(expected[k].second, dag.units[dag.starts[i] + k]);
+        }
+      }
+    }
+  }
+
+  // 清华 and 清华大学 start at 清, 华大 at 华, 大学 at 大
+  libtext::RuneStrArray unicode;
+  ASSERT_TRUE(DecodeRunesInString("清华大学", unicode));
+  CompactDag dag;
+  trie.Find(unicode.begin(), unicode.end(), dag);
+  std::string edges;
+  for (size_t i = 0; i < dag.size(); i++) {
+    for (size_t k = dag.starts[i]; k < dag.starts[i + 1]; k++) {
+      turbo::StrAppend(&edges, edges.empty() ? "" : " ", i, "-", dag.ends[k]);
+    }
+  }
+  ASSERT_EQ("0-0 0-1 0-3 1-1 1-2 2-2 2-3 3-3", edges);
+}
+
 TEST(DictTrieTest, Dag) {
   DictTrie trie(DICT_FILE, "../test/testdata/userdict.utf8");
 
@@ -190,3 +300,98 @@ TEST(DictTrieTest, Dag) {
     }
   }
 }
+
+TEST(DictTrieTest, MaxWordLength) {
+  DictTrie trie(DICT_FILE);
+  std::ifstream ifs(DICT_FILE);
+  std::string line;
+  size_t max_len = 0;
+  size_t max_len_qing = 0;
+  const Rune qing = DecodeRunesInString("清")[0];
+  while (getline(ifs, line)) {
+    Unicode word = DecodeRunesInString(line.substr(0, line.find(' ')));
+    max_len = std::max(max_len, word.size());
+    if (word[0] == qing) {
+      max_len_qing = std::max(max_len_qing, word.size());
+    }
+  }
+  ASSERT_EQ(max_len, trie.GetMaxWordLength());
+  ASSERT_EQ(max_len_qing, trie.GetMaxWordLength(qing));
+  ASSERT_EQ(0u, trie.GetMaxWordLength(Rune('~')));
+
+  std::string long_word;
+  for (size_t i = 0; i <= max_len; i++) {
+    long_word += "清";
+  }
+  ASSERT_TRUE(trie.InsertUserWord(long_word));
+  ASSERT_EQ(max_len + 1, trie.GetMaxWordLength());
+  ASSERT_EQ(max_len + 1, trie.GetMaxWordLength(qing));
+  ASSERT_TRUE(trie.DeleteUserWord(long_word));
+  ASSERT_EQ(max_len, trie.GetMaxWordLength());
+  ASSERT_EQ(max_len_qing, trie.GetMaxWordLength(qing));
+}
+
+TEST(DictTrieTest, DeleteUserWord) {
+  DictTrie trie(DICT_FILE);
+  const char *sentence = "清华大学城北京邮电大学";
+  libtext::RuneStrArray unicode;
+  ASSERT_TRUE(DecodeRunesInString(sentence, unicode));
+  std::vector<struct Dag> expected;
+  trie.Find(unicode.begin(), unicode.end(), expected);
+
+  ASSERT_FALSE(trie.Find("清华大学城"));
+  ASSERT_FALSE(trie.DeleteUserWord("清华大学城"));
+  ASSERT_FALSE(trie.DeleteUserWord("清华大"));
+  ASSERT_TRUE(trie.InsertUserWord("清华大学城"));
+  ASSERT_TRUE(trie.InsertUserWord("城北京"));
+  ASSERT_TRUE(trie.Find("清华大学城"));
+  ASSERT_TRUE(trie.DeleteUserWord("清华大学城"));
+  ASSERT_TRUE(trie.DeleteUserWord("城北京"));
+  ASSERT_FALSE(trie.DeleteUserWord("城北京"));
+  ASSERT_FALSE(trie.Find("清华大学城"));
+  ASSERT_FALSE(trie.Find("城北京"));
+  ASSERT_TRUE(trie.Find("清华大学"));
+  ASSERT_TRUE(trie.Find("北京"));
+
+  std::vector<struct Dag> dags;
+  trie.Find(unicode.begin(), unicode.end(), dags);
+  ASSERT_EQ(expected.size(), dags.size());
+  for (size_t i = 0; i < dags.size(); i++) {
+    ASSERT_EQ(expected[i].nexts, dags[i].nexts);
+  }
+
+  // a dictionary word can be deleted too, without losing its prefixes
+  ASSERT_TRUE(trie.DeleteUserWord("清华大学"));
+  ASSERT_FALSE(trie.Find("清华大学"));
+  ASSERT_TRUE(trie.Find("清华"));
+}
+
+TEST(DictTrieTest, AsciiNotInWords) {
+  DictTrie trie(DICT_FILE);
+  const Rune ni = DecodeRunesInString("你")[0];
+  ASSERT_TRUE(trie.IsAsciiNotInWords('B'));
+  ASSERT_TRUE(trie.IsAsciiNotInWords('4'));
+  ASSERT_FALSE(trie.IsAsciiNotInWords(ni));
+
+  // the ASCII runes of the words are looked up as before
+  ASSERT_TRUE(trie.InsertUserWord("B超"));
+  ASSERT_TRUE(trie.InsertUserWord("AK47"));
+  ASSERT_FALSE(trie.IsAsciiNotInWords('B'));
+  ASSERT_FALSE(trie.IsAsciiNotInWords('4'));
+  ASSERT_TRUE(trie.IsAsciiNotInWords('C'));
+
+  RuneStrArray runes;
+  ASSERT_TRUE(DecodeRunesInString("CB超AK47", runes));
+  CompactDag dag;
+  trie.Find(runes.begin(), runes.end(), dag);
+  ASSERT_EQ(1u, dag.NumEdges(0));
+  ASSERT_EQ(2u, dag.NumEdges(1));
+  ASSERT_EQ(2u, dag.ends[dag.starts[1] + 1]);
+  ASSERT_EQ(2u, dag.NumEdges(3));
+  ASSERT_EQ(6u, dag.ends[dag.starts[3] + 1]);
+
+  MPSegment segment(&trie);
+  std::vector<std::string> words;
+  segment.Cut("CB超AK47", words);
+  ASSERT_EQ("C/B超/AK47", turbo::StrJoin(words, "/"));
+}
@@ -15,19 +15,159 @@
 #ifndef LIBTEXT_SEGMENT_UNICODE_H_
 #define LIBTEXT_SEGMENT_UNICODE_H_
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <ostream>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string>
+#include <string_view>
 #include "turbo/container/inlined_vector.h"
 #include "turbo/strings/string_view.h"
 #include "turbo/strings/str_join.h"
 #include <vector>
+#include "libtext/common/simd_scan.h"
 
 namespace libtext {
 
 typedef uint32_t Rune;
 
+// Coarse classes of runes, one bit each so that a set of classes is a mask.
+enum CharClass : uint8_t {
+  CharClassOther = 0,
+  CharClassIdeograph = 1 << 0, // CJK ideographs and radicals
+  CharClassKana = 1 << 1,      // hiragana and katakana, half-width included
+  CharClassHangul = 1 << 2,
+  CharClassLetter = 1 << 3, // Latin, Greek and Cyrillic, full-width included
+  CharClassDigit = 1 << 4,  // 0-9, full-width included
+  CharClassPunct = 1 << 5,  // punctuation and symbols, CJK and full-width
+  CharClassSpace = 1 << 6,
+  CharClassEmoji = 1 << 7,
+};
+
+// Two-level table of the CharClass of every rune: the high bits of a rune
+// select a block of 256 classes and equal blocks are shared, so the table
+// is a few KB and a lookup is two loads.
+class CharClassTable {
+public:
+  static const CharClassTable &Instance() {
+    static const CharClassTable table;
+    return table;
+  }
+
+  CharClass Get(Rune r) const {
+    if (r > kMaxRune) {
+      return CharClassOther;
+    }
+    return static_cast<CharClass>(blocks_[index_[r >> 8]][r & 0xff]);
+  }
+
+  // The classes of the runes below 0x80, indexed by rune.
+  const uint8_t *AsciiClasses() const { return blocks_[index_[0]].data(); }
+
+private:
+  static constexpr Rune kMaxRune = 0x10ffff;
+
+  CharClassTable() {
+    struct Range {
+      Rune first;
+      Rune last;
+      CharClass cls;
+    };
+    // later ranges override earlier ones
+    static const Range kRanges[] = {
+        {0x21, 0x7e, CharClassPunct},
+        {0xa1, 0xbf, CharClassPunct},
+        {0x2010, 0x205e, CharClassPunct},
+        {0x20a0, 0x20cf, CharClassPunct}, // currency
+        {0x2100, 0x2bff, CharClassPunct}, // arrows, math, shapes, ...
+        {0x3001, 0x303f, CharClassPunct},
+        {0xfe10, 0xfe1f, CharClassPunct},
+        {0xfe30, 0xfe6f, CharClassPunct},
+        {0xff01, 0xff65, CharClassPunct},
+        {0xffe0, 0xffee, CharClassPunct},
+        {'0', '9', CharClassDigit},
+        {0xff10, 0xff19, CharClassDigit},
+        {'A', 'Z', CharClassLetter},
+        {'a', 'z', CharClassLetter},
+        {0xaa, 0xaa, CharClassLetter},
+        {0xb5, 0xb5, CharClassLetter},
+        {0xba, 0xba, CharClassLetter},
+        {0xc0, 0x24f, CharClassLetter},
+        {0x370, 0x52f, CharClassLetter},
+        {0x1e00, 0x1fff, CharClassLetter},
+        {0xff21, 0xff3a, CharClassLetter},
+        {0xff41, 0xff5a, CharClassLetter},
+        {0xd7, 0xd7, CharClassPunct},
+        {0xf7, 0xf7, CharClassPunct},
+        {0x37e, 0x37e, CharClassPunct},
+        {0x387, 0x387, CharClassPunct},
+        {0x2e80, 0x2fdf, CharClassIdeograph},
+        {0x3005, 0x3007, CharClassIdeograph},
+        {0x3021, 0x3029, CharClassIdeograph},
+        {0x3400, 0x4dbf, CharClassIdeograph},
+        {0x4e00, 0x9fff, CharClassIdeograph},
+        {0xf900, 0xfaff, CharClassIdeograph},
+        {0x20000, 0x3134f, CharClassIdeograph},
+        {0x3041, 0x3096, CharClassKana},
+        {0x3099, 0x30ff, CharClassKana},
+        {0x31f0, 0x31ff, CharClassKana},
+        {0xff66, 0xff9f, CharClassKana},
+        {0x30fb, 0x30fb, CharClassPunct},
+        {0x1100, 0x11ff, CharClassHangul},
+        {0x3130, 0x318f, CharClassHangul},
+        {0xac00, 0xd7af, CharClassHangul},
+        {0xffa0, 0xffdc, CharClassHangul},
+        {0x2600, 0x27bf, CharClassEmoji},
+        {0x2b50, 0x2b50, CharClassEmoji},
+        {0x2b55, 0x2b55, CharClassEmoji},
+        {0x1f000, 0x1faff, CharClassEmoji},
+        {0x09, 0x0d, CharClassSpace},
+        {0x20, 0x20, CharClassSpace},
+        {0x85, 0x85, CharClassSpace},
+        {0xa0, 0xa0, CharClassSpace},
+        {0x1680, 0x1680, CharClassSpace},
+        {0x2000, 0x200a, CharClassSpace},
+        {0x2028, 0x2029, CharClassSpace},
+        {0x202f, 0x202f, CharClassSpace},
+        {0x205f, 0x205f, CharClassSpace},
+        {0x3000, 0x3000, CharClassSpace},
+    };
+    std::vector<std::array<uint8_t, 256>> blocks((kMaxRune >> 8) + 1);
+    for (auto &block : blocks) {
+      block.fill(CharClassOther);
+    }
+    for (const Range &range : kRanges) {
+      for (Rune r = range.first; r <= range.last; ++r) {
+        blocks[r >> 8][r & 0xff] = range.cls;
+      }
+    }
+    // block 0 is the empty one
+    blocks_.emplace_back();
+    blocks_.back().fill(CharClassOther);
+    for (size_t i = 0; i < blocks.size(); ++i) {
+      size_t j = 0;
+      while (j < blocks_.size() && blocks_[j] != blocks[i]) {
+        ++j;
+      }
+      if (j == blocks_.size()) {
+        blocks_.push_back(blocks[i]);
+      }
+      index_[i] = static_cast<uint8_t>(j);
+    }
+  }
+
+  uint8_t index_[(kMaxRune >> 8) + 1];
+  std::vector<std::array<uint8_t, 256>> blocks_;
+}; // class CharClassTable
+
+inline CharClass GetCharClass(Rune r) {
+  return CharClassTable::Instance().Get(r);
+}
+
 struct Word {
   std::string word;
   uint32_t offset;
@@ -40,6 +180,19 @@ struct Word {
         unicode_length(unicode_length) {}
 }; // struct Word
 
+struct DictUnit;
+
+// A word of the streaming Cuts of the segmenters: a view of the sentence,
+// valid while it is, the offsets of Word, and the dictionary entry of the
+// word if the segmenter knows it, else null.
+struct WordView {
+  std::string_view word;
+  uint32_t offset;
+  uint32_t unicode_offset;
+  uint32_t unicode_length;
+  const DictUnit *unit;
+}; // struct WordView
+
 inline std::ostream &operator<<(std::ostream &os, const Word &w) {
   return os << "{\"word\": \"" << w.word << "\", \"offset\": " << w.offset
             << "}";
@@ -53,17 +206,25 @@ struct WordFormatter {
 struct RuneStr {
   Rune rune;
   uint32_t offset;
-  uint32_t len;
+  uint16_t len; // at most 4
+  CharClass char_class;
   uint32_t unicode_offset;
   uint32_t unicode_length;
   RuneStr()
-      : rune(0), offset(0), len(0), unicode_offset(0), unicode_length(0) {}
+      : rune(0), offset(0), len(0), char_class(CharClassOther),
+        unicode_offset(0), unicode_length(0) {}
   RuneStr(Rune r, uint32_t o, uint32_t l)
-      : rune(r), offset(o), len(l), unicode_offset(0), unicode_length(0) {}
+      : rune(r), offset(o), len(static_cast<uint16_t>(l)),
+        char_class(GetCharClass(r)), unicode_offset(0), unicode_length(0) {}
   RuneStr(Rune r, uint32_t o, uint32_t l, uint32_t unicode_offset,
           uint32_t unicode_length)
-      : rune(r), offset(o), len(l), unicode_offset(unicode_offset),
+      : rune(r), offset(o), len(static_cast<uint16_t>(l)),
+        char_class(GetCharClass(r)), unicode_offset(unicode_offset),
         unicode_length(unicode_length) {}
+  RuneStr(Rune r, CharClass c, uint32_t o, uint32_t l,
+          uint32_t unicode_offset, uint32_t unicode_length)
+      : rune(r), offset(o), len(static_cast<uint16_t>(l)), char_class(c),
+        unicode_offset(unicode_offset), unicode_length(unicode_length) {}
 }; // struct RuneStr
 
 inline std::ostream &operator<<(std::ostream &os, const RuneStr &r) {
@@ -72,7 +233,174 @@ inline std::ostream &operator<<(std::ostream &os, const RuneStr &r) {
 }
 
 typedef turbo::InlinedVector<Rune, 8> Unicode;
-typedef turbo::InlinedVector<struct RuneStr, 8> RuneStrArray;
+
+// The runes of a decoded string as a structure of arrays in one buffer:
+// the runes, each with its class in the high byte, then the byte offsets of
+// the runes followed by the length of the string. The byte length of a
+// rune is derived from the offsets and its unicode_offset is its index, so
+// a rune takes 8 bytes instead of the 20 of a RuneStr. Elements are read as
+// RuneStr values.
+class RuneStrArray {
+public:
+  class const_iterator {
+  public:
+    typedef std::random_access_iterator_tag iterator_category;
+    typedef RuneStr value_type;
+    typedef ptrdiff_t difference_type;
+    typedef RuneStr reference;
+    struct pointer {
+      RuneStr value;
+      const RuneStr *operator->() const { return &value; }
+    };
+
+    const_iterator() : data_(nullptr), capacity_(0), index_(0) {}
+
+    RuneStr operator*() const { return Get(index_); }
+    pointer operator->() const { return pointer{Get(index_)}; }
+    RuneStr operator[](difference_type n) const {
+      return Get(static_cast<uint32_t>(index_ + n));
+    }
+
+    const_iterator &operator++() {
+      ++index_;
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator old = *this;
+      ++index_;
+      return old;
+    }
+    const_iterator &operator--() {
+      --index_;
+      return *this;
+    }
+    const_iterator operator--(int) {
+      const_iterator old = *this;
+      --index_;
+      return old;
+    }
+    const_iterator &operator+=(difference_type n) {
+      index_ = static_cast<uint32_t>(index_ + n);
+      return *this;
+    }
+    const_iterator &operator-=(difference_type n) {
+      index_ = static_cast<uint32_t>(index_ - n);
+      return *this;
+    }
+    const_iterator operator+(difference_type n) const {
+      const_iterator it = *this;
+      it += n;
+      return it;
+    }
+    const_iterator operator-(difference_type n) const {
+      const_iterator it = *this;
+      it -= n;
+      return it;
+    }
+    difference_type operator-(const const_iterator &other) const {
+      return static_cast<difference_type>(index_) -
+             static_cast<difference_type>(other.index_);
+    }
+
+    bool operator==(const const_iterator &o) const { return index_ == o.index_; }
+    bool operator!=(const const_iterator &o) const { return index_ != o.index_; }
+    bool operator<(const const_iterator &o) const { return index_ < o.index_; }
+    bool operator<=(const const_iterator &o) const { return index_ <= o.index_; }
+    bool operator>(const const_iterator &o) const { return index_ > o.index_; }
+    bool operator>=(const const_iterator &o) const { return index_ >= o.index_; }
+
+  private:
+    friend class RuneStrArray;
+    // 16 bytes, so that iterators and WordRanges stay cheap to pass around
+    // and reading an element needs no load besides the element itself.
+    const_iterator(const uint32_t *data, uint32_t capacity, uint32_t index)
+        : data_(data), capacity_(capacity), index_(index) {}
+
+    RuneStr Get(uint32_t i) const {
+      const uint32_t *offsets = data_ + capacity_;
+      return RuneStr(data_[i] & kRuneMask,
+                     static_cast<CharClass>(data_[i] >> kClassShift),
+                     offsets[i], offsets[i + 1] - offsets[i], i, 1);
+    }
+
+    const uint32_t *data_;
+    uint32_t capacity_;
+    uint32_t index_;
+  }; // class const_iterator
+
+  RuneStrArray() : size_(0), capacity_(0), data_(1, 0) {}
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  void clear() {
+    size_ = 0;
+    data_[capacity_] = 0;
+  }
+
+  void reserve(size_t n) {
+    if (n > capacity_) {
+      Grow(static_cast<uint32_t>(n));
+    }
+  }
+
+  // Appends a rune of `len` bytes which follows the last one.
+  void Append(Rune r, CharClass c, uint32_t len) {
+    if (size_ == capacity_) {
+      Grow(capacity_ < 8 ? 8 : capacity_ * 2);
+    }
+    uint32_t *offsets = data_.data() + capacity_;
+    data_[size_] = r | static_cast<uint32_t>(c) << kClassShift;
+    offsets[size_ + 1] = offsets[size_] + len;
+    ++size_;
+  }
+
+  // Appends the n ASCII bytes of s, which follow the last rune, with their
+  // classes from `classes`.
+  void AppendAscii(const char *s, uint32_t n, const uint8_t *classes) {
+    if (size_ + n > capacity_) {
+      Grow(std::max(size_ + n, capacity_ < 8 ? 8 : capacity_ * 2));
+    }
+    uint32_t *runes = data_.data() + size_;
+    uint32_t *offsets = data_.data() + capacity_ + size_;
+    for (uint32_t i = 0; i < n; ++i) {
+      const uint32_t r = static_cast<unsigned char>(s[i]);
+      runes[i] = r | static_cast<uint32_t>(classes[r]) << kClassShift;
+      offsets[i + 1] = offsets[i] + 1;
+    }
+    size_ += n;
+  }
+
+  RuneStr operator[](size_t i) const {
+    return const_iterator(data_.data(), capacity_, 0)[i];
+  }
+
+  const_iterator begin() const {
+    return const_iterator(data_.data(), capacity_, 0);
+  }
+  const_iterator end() const {
+    return const_iterator(data_.data(), capacity_, size_);
+  }
+
+private:
+  // runes are at most 21 bits
+  static constexpr uint32_t kClassShift = 24;
+  static constexpr uint32_t kRuneMask = (1u << kClassShift) - 1;
+
+  // Makes room for `capacity` runes and moves the offsets behind them.
+  void Grow(uint32_t capacity) {
+    data_.resize(2 * static_cast<size_t>(capacity) + 1);
+    uint32_t *data = data_.data();
+    std::memmove(data + capacity, data + capacity_,
+                 (size_ + 1) * sizeof(uint32_t));
+    capacity_ = capacity;
+  }
+
+  uint32_t size_;
+  uint32_t capacity_;
+  // [0, capacity_): runes, [capacity_, capacity_ + size_]: byte offsets
+  turbo::InlinedVector<uint32_t, 17> data_;
+}; // class RuneStrArray
 
 // [left, right]
 struct WordRange {
@@ -91,6 +419,16 @@ struct WordRange {
   }
 }; // struct WordRange
 
+// Appends the words of the range Cuts of the segmenters to a vector.
+struct WordRangeAppender {
+  std::vector<WordRange> &words;
+  explicit WordRangeAppender(std::vector<WordRange> &w) : words(w) {}
+  void operator()(RuneStrArray::const_iterator left,
+                  RuneStrArray::const_iterator right, const DictUnit *) const {
+    words.push_back(WordRange(left, right));
+  }
+}; // struct WordRangeAppender
+
 struct RuneStrLite {
   uint32_t rune;
   uint32_t len;
@@ -157,16 +495,23 @@ inline bool DecodeRunesInString(const char *s, size_t len,
                                 RuneStrArray &runes) {
   runes.clear();
   runes.reserve(len / 2);
-  for (uint32_t i = 0, j = 0; i < len;) {
+  const CharClassTable &classes = CharClassTable::Instance();
+  for (uint32_t i = 0; i < len;) {
+    if (!(s[i] & 0x80)) {
+      // the runs of ASCII in mixed text are found with SIMD and copied
+      // without decoding
+      const uint32_t n = static_cast<uint32_t>(FindNonAscii(s + i, len - i));
+      runes.AppendAscii(s + i, n, classes.AsciiClasses());
+      i += n;
+      continue;
+    }
     RuneStrLite rp = DecodeRuneInString(s + i, len - i);
     if (rp.len == 0) {
       runes.clear();
       return false;
     }
-    RuneStr x(rp.rune, i, rp.len, j, 1);
-    runes.push_back(x);
+    runes.Append(rp.rune, classes.Get(rp.rune), rp.len);
     i += rp.len;
-    ++j;
   }
   return true;
 }
@@ -177,13 +522,15 @@ inline bool DecodeRunesInString(const std::string &s, RuneStrArray &runes) {
 
 inline bool DecodeRunesInString(const char *s, size_t len, Unicode &unicode) {
   unicode.clear();
-  RuneStrArray runes;
-  if (!DecodeRunesInString(s, len, runes)) {
-    return false;
-  }
-  unicode.reserve(runes.size());
-  for (size_t i = 0; i < runes.size(); i++) {
-    unicode.push_back(runes[i].rune);
+  unicode.reserve(len / 2);
+  for (uint32_t i = 0; i < len;) {
+    RuneStrLite rp = DecodeRuneInString(s + i, len - i);
+    if (rp.len == 0) {
+      unicode.clear();
+      return false;
+    }
+    unicode.push_back(rp.rune);
+    i += rp.len;
   }
   return true;
 }
@@ -215,6 +562,18 @@ inline Word GetWordFromRunes(const std::string &s,
               unicode_length);
 }
 
+inline WordView GetWordViewFromRunes(const std::string &s,
+                                     RuneStrArray::const_iterator left,
+                                     RuneStrArray::const_iterator right,
+                                     const DictUnit *unit) {
+  assert(right->offset >= left->offset);
+  uint32_t len = right->offset - left->offset + right->len;
+  uint32_t unicode_length =
+      right->unicode_offset - left->unicode_offset + right->unicode_length;
+  return WordView{std::string_view(s.data() + left->offset, len),
+                  left->offset, left->unicode_offset, unicode_length, unit};
+}
+
 inline std::string GetStringFromRunes(const std::string &s,
                                       RuneStrArray::const_iterator left,
                                       RuneStrArray::const_iterator right) {
@@ -0,0 +1,131 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef LIBTEXT_NORMALIZE_CHAR_FOLD_H_
+#define LIBTEXT_NORMALIZE_CHAR_FOLD_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace libtext {
+
+// Decodes the UTF8 character at the start of `s[0, len)`, `len` > 0.
+// Returns its byte length. A byte that does not start a complete sequence
+// decodes to itself with length 1, so invalid input is passed through.
+inline size_t DecodeCodePoint(const char *s, size_t len, uint32_t *cp) {
+  const uint8_t b0 = static_cast<uint8_t>(s[0]);
+  if (b0 < 0x80) {
+    *cp = b0;
+    return 1;
+  }
+  size_t n;
+  uint32_t c;
+  if (b0 >= 0xc2 && b0 <= 0xdf) {
+    n = 2;
+    c = b0 & 0x1f;
+  } else if (b0 >= 0xe0 && b0 <= 0xef) {
+    n = 3;
+    c = b0 & 0x0f;
+  } else if (b0 >= 0xf0 && b0 <= 0xf4) {
+    n = 4;
+    c = b0 & 0x07;
+  } else {
+    *cp = b0;
+    return 1;
+  }
+  if (n > len) {
+    *cp = b0;
+    return 1;
+  }
+  for (size_t i = 1; i < n; ++i) {
+    const uint8_t b = static_cast<uint8_t>(s[i]);
+    if ((b & 0xc0) != 0x80) {
+      *cp = b0;
+      return 1;
+    }
+    c = (c << 6) | (b & 0x3f);
+  }
+  *cp = c;
+  return n;
+}
+
+// Encodes `cp` as UTF8 into `out`, which has room for 4 bytes.
+// Returns the byte length.
+inline size_t EncodeCodePoint(uint32_t cp, char *out) {
+  if (cp < 0x80) {
+    out[0] = static_cast<char>(cp);
+    return 1;
+  }
+  if (cp < 0x800) {
+    out[0] = static_cast<char>(0xc0 | (cp >> 6));
+    out[1] = static_cast<char>(0x80 | (cp & 0x3f));
+    return 2;
+  }
+  if (cp < 0x10000) {
+    out[0] = static_cast<char>(0xe0 | (cp >> 12));
+    out[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+    out[2] = static_cast<char>(0x80 | (cp & 0x3f));
+    return 3;
+  }
+  out[0] = static_cast<char>(0xf0 | (cp >> 18));
+  out[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+  out[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+  out[3] = static_cast<char>(0x80 | (cp & 0x3f));
+  return 4;
+}
+
+// Maps the full-width forms of ASCII (U+FF01..U+FF5E) and the ideographic
+// space to their ASCII counterparts.
+inline uint32_t FoldWidth(uint32_t cp) {
+  if (cp >= 0xff01 && cp <= 0xff5e) {
+    return cp - 0xfee0;
+  }
+  if (cp == 0x3000) {
+    return 0x20;
+  }
+  return cp;
+}
+
+// Simple lower-casing of the ASCII, Latin-1, Greek and Cyrillic capitals.
+// Other scripts are returned as they are.
+inline uint32_t FoldCase(uint32_t cp) {
+  if (cp < 0x80) {
+    return cp >= 'A' && cp <= 'Z' ? cp + 0x20 : cp;
+  }
+  if ((cp >= 0xc0 && cp <= 0xde && cp != 0xd7) ||
+      (cp >= 0x391 && cp <= 0x3ab && cp != 0x3a2) ||
+      (cp >= 0x410 && cp <= 0x42f)) {
+    return cp + 0x20;
+  }
+  if (cp >= 0x400 && cp <= 0x40f) {
+    return cp + 0x50;
+  }
+  return cp;
+}
+
+// White space of the Unicode White_Space property.
+inline bool IsSpace(uint32_t cp) {
+  if (cp < 0x80) {
+    return cp == ' ' || (cp >= '\t' && cp <= '\r');
+  }
+  return cp == 0x85 || cp == 0xa0 || cp == 0x1680 ||
+         (cp >= 0x2000 && cp <= 0x200a) || cp == 0x2028 || cp == 0x2029 ||
+         cp == 0x202f || cp == 0x205f || cp == 0x3000;
+}
+
+} // namespace libtext
+
+#endif // LIBTEXT_NORMALIZE_CHAR_FOLD_H_
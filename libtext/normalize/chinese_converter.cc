@@ -0,0 +1,153 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "libtext/normalize/chinese_converter.h"
+
+#include <fstream>
+#include "turbo/log/logging.h"
+#include "turbo/strings/str_split.h"
+#include "libtext/normalize/char_fold.h"
+
+namespace libtext {
+
+ChineseConverter::ChineseConverter(const std::string &phrase_paths,
+                                   const std::string &char_paths)
+    : num_chars_(0) {
+  std::map<turbo::inlined_string, int> phrases;
+  LoadDict(phrase_paths, &phrases);
+  LoadDict(char_paths, &phrases);
+  phrases_ = std::make_unique<PrefixMap>(phrases);
+}
+
+void ChineseConverter::LoadDict(
+    const std::string &paths, std::map<turbo::inlined_string, int> *phrases) {
+  if (paths.empty()) {
+    return;
+  }
+  std::vector<std::string> files =
+      turbo::StrSplit(paths, turbo::ByAnyChar("|;"));
+  for (size_t i = 0; i < files.size(); i++) {
+    std::ifstream ifs(files[i].c_str());
+    TURBO_CHECK(ifs.is_open()) << "open " << files[i] << " failed";
+    std::string line;
+    while (getline(ifs, line)) {
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+      std::vector<std::string> buf = turbo::StrSplit(line, "\t");
+      TURBO_CHECK(buf.size() == 2 && !buf[0].empty())
+          << "split result illegal, line:" << line;
+      // the first of the alternatives
+      std::vector<std::string> values =
+          turbo::StrSplit(buf[1], " ", turbo::SkipEmpty());
+      TURBO_CHECK(!values.empty()) << "no value, line:" << line;
+      const std::string &key = buf[0];
+      const std::string &value = values[0];
+      uint32_t cp;
+      const size_t n = DecodeCodePoint(key.data(), key.size(), &cp);
+      if (n == key.size()) {
+        TURBO_CHECK(value.size() < 256) << "value too long, line:" << line;
+        if (!chars_.Contains(cp)) {
+          chars_.Set(cp, value);
+          lead_bytes_.Insert(static_cast<unsigned char>(key[0]));
+          ++num_chars_;
+        }
+        continue;
+      }
+      const int index = static_cast<int>(targets_.size());
+      if (phrases->emplace(turbo::inlined_string(key.data(), key.size()),
+                           index).second) {
+        targets_.push_back(value);
+        heads_.Set(cp, std::string_view());
+        lead_bytes_.Insert(static_cast<unsigned char>(key[0]));
+      }
+    }
+  }
+}
+
+void ChineseConverter::Convert(const std::string_view &str,
+                               turbo::inlined_string *out,
+                               std::vector<uint32_t> *offsets) const {
+  if (offsets) {
+    Run<true>(str, out, offsets);
+  } else {
+    Run<false>(str, out, nullptr);
+  }
+}
+
+turbo::inlined_string
+ChineseConverter::Convert(const std::string_view &str) const {
+  turbo::inlined_string result;
+  Run<false>(str, &result, nullptr);
+  return result;
+}
+
+template <bool kOffsets>
+void ChineseConverter::Run(const std::string_view &str,
+                           turbo::inlined_string *out,
+                           std::vector<uint32_t> *offsets) const {
+  const char *ptr = str.data();
+  const size_t len = str.size();
+  out->clear();
+  out->reserve(len);
+  if (kOffsets) {
+    offsets->clear();
+    offsets->reserve(len + 1);
+  }
+  size_t i = 0;
+  while (i < len) {
+    const size_t skip = lead_bytes_.FindFirst(ptr + i, len - i);
+    if (skip > 0) {
+      out->append(ptr + i, skip);
+      if (kOffsets) {
+        for (size_t k = 0; k < skip; ++k) {
+          offsets->push_back(static_cast<uint32_t>(i + k));
+        }
+      }
+      i += skip;
+      if (i == len) {
+        break;
+      }
+    }
+    uint32_t cp;
+    size_t n = DecodeCodePoint(ptr + i, len - i, &cp);
+    std::string_view repl(ptr + i, n);
+    // invalid bytes decode to themselves and are kept as they are
+    if (n > 1 || cp < 0x80) {
+      int target = 0;
+      size_t m = 0;
+      if (heads_.Contains(cp)) {
+        m = phrases_->PrefixSearch(ptr + i, len - i, &target);
+      }
+      if (m > 0) {
+        repl = targets_[target];
+        n = m;
+      } else {
+        chars_.Lookup(cp, &repl);
+      }
+    }
+    out->append(repl.data(), repl.size());
+    if (kOffsets) {
+      offsets->insert(offsets->end(), repl.size(), static_cast<uint32_t>(i));
+    }
+    i += n;
+  }
+  if (kOffsets) {
+    offsets->push_back(static_cast<uint32_t>(len));
+  }
+}
+
+}  // namespace libtext
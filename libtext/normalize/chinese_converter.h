@@ -0,0 +1,85 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef LIBTEXT_NORMALIZE_CHINESE_CONVERTER_H_
+#define LIBTEXT_NORMALIZE_CHINESE_CONVERTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "turbo/strings/string_view.h"
+#include "turbo/strings/inlined_string.h"
+#include "libtext/common/prefix_map.h"
+#include "libtext/common/simd_scan.h"
+#include "libtext/normalize/codepoint_table.h"
+
+namespace libtext {
+
+// Converts between Chinese variants, e.g. Traditional to Simplified, with
+// dictionaries in the OpenCC text format: one "key<TAB>value" per line,
+// where the value may list alternatives separated by spaces and the first
+// one is used. Lines starting with '#' are comments.
+//
+// Keys of one character go to a CodepointTable, longer ones (phrases) to
+// a PrefixMap. At each position the longest phrase wins over the mapping
+// of its first character, so phrase tables can undo character mappings
+// that are wrong in context. Text is converted in one pass.
+class ChineseConverter {
+public:
+  // `phrase_paths` and `char_paths` are lists of files separated by '|'
+  // or ';'; either may be empty. The kind of a file only decides the order
+  // of loading: for a key listed twice the first entry wins, and the
+  // phrase files are read first.
+  ChineseConverter(const std::string &phrase_paths,
+                   const std::string &char_paths);
+  virtual ~ChineseConverter() = default;
+
+  // Writes the converted `str` to `out`. If `offsets` is given it gets one
+  // entry per byte of `out`, the offset in `str` of the byte it was copied
+  // from or of the character or phrase it was converted from, plus a last
+  // entry `str.size()`.
+  void Convert(const std::string_view &str, turbo::inlined_string *out,
+               std::vector<uint32_t> *offsets = nullptr) const;
+  turbo::inlined_string Convert(const std::string_view &str) const;
+
+  // Number of distinct phrase and character keys loaded.
+  size_t num_phrases() const { return targets_.size(); }
+  size_t num_chars() const { return num_chars_; }
+
+private:
+  template <bool kOffsets>
+  void Run(const std::string_view &str, turbo::inlined_string *out,
+           std::vector<uint32_t> *offsets) const;
+
+  void LoadDict(const std::string &paths,
+                std::map<turbo::inlined_string, int> *phrases);
+
+  std::unique_ptr<PrefixMap> phrases_;
+  std::vector<std::string> targets_;
+  // first characters of the phrases, only Contains is used
+  CodepointTable heads_;
+  CodepointTable chars_;
+  size_t num_chars_;
+  // first bytes of the keys, other bytes are copied in bulk
+  ByteSet lead_bytes_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_NORMALIZE_CHINESE_CONVERTER_H_
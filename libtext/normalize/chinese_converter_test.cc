@@ -0,0 +1,68 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include <gtest/gtest.h>
+#include <libtext/normalize/chinese_converter.h>
+#include <string>
+#include <vector>
+
+namespace libtext {
+
+static const char *const kPhrases = "../test/testdata/t2s_phrases.utf8";
+static const char *const kChars = "../test/testdata/t2s_chars.utf8";
+
+TEST(ChineseConverter, Convert) {
+  ChineseConverter converter(kPhrases, kChars);
+  ASSERT_EQ(converter.num_phrases(), 7);
+  ASSERT_EQ(converter.num_chars(), 19);
+  ASSERT_EQ(converter.Convert(""), "");
+  ASSERT_EQ(converter.Convert("hello"), "hello");
+  ASSERT_EQ(converter.Convert("這個國語說話"), "这个国语说话");
+  // phrases win over the mappings of their characters
+  ASSERT_EQ(converter.Convert("電腦軟體"), "电脑软件");
+  ASSERT_EQ(converter.Convert("乾隆乾淨乾"), "乾隆干净干");
+  ASSERT_EQ(converter.Convert("著作著名顯著"), "著作著名顯着");
+  ASSERT_EQ(converter.Convert("頭髮頭"), "头发头");
+  // simplified, mixed and invalid text is copied as it is
+  ASSERT_EQ(converter.Convert("我们 ok 學\xE5\xAD"), "我们 ok 学\xE5\xAD");
+}
+
+TEST(ChineseConverter, Offsets) {
+  ChineseConverter converter(kPhrases, kChars);
+  std::string text("a頭髮b們");
+  turbo::inlined_string out;
+  std::vector<uint32_t> offsets;
+  converter.Convert(text, &out, &offsets);
+  ASSERT_EQ(out, "a头发b们");
+  ASSERT_EQ(offsets, std::vector<uint32_t>({0, 1, 1, 1, 1, 1, 1, 7, 8, 8, 8,
+                                            11}));
+  turbo::inlined_string plain;
+  converter.Convert(text, &plain);
+  ASSERT_EQ(plain, out);
+}
+
+TEST(ChineseConverter, CharsOnly) {
+  ChineseConverter converter("", kChars);
+  ASSERT_EQ(converter.num_phrases(), 0);
+  ASSERT_EQ(converter.Convert("頭髮乾淨"), "头发干淨");
+  // the kind of a file only orders the loading: the character file listed
+  // first among the phrase files still maps characters, and the longer
+  // phrases of the file after it still win at their positions
+  ChineseConverter both(std::string(kChars) + "|" + kPhrases, "");
+  ASSERT_EQ(both.Convert("頭髮乾淨"), "头发干净");
+}
+
+}  // namespace libtext
@@ -0,0 +1,97 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_NORMALIZE_CODEPOINT_TABLE_H_
+#define LIBTEXT_NORMALIZE_CODEPOINT_TABLE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace libtext {
+
+// Rows of generated mapping tables, `repl` is UTF8.
+struct CodepointMapping {
+  uint32_t cp;
+  const char *repl;
+};
+
+struct CodepointPairMapping {
+  uint32_t first;
+  uint32_t second;
+  const char *repl;
+};
+
+// Maps code points to UTF8 replacements. The table has two levels: the
+// high bits of a code point select a 256-entry page and pages without
+// replacements all share the empty page 0, so a table touching a few
+// scripts stays small while a lookup is two loads.
+class CodepointTable {
+public:
+  static constexpr uint32_t kMaxCodePoint = 0x10ffff;
+
+  CodepointTable()
+      : index_((kMaxCodePoint >> 8) + 1, 0), pages_(1), pool_(1, 0) {
+    pages_[0].fill(0);
+  }
+
+  // Replaces `cp` by `repl`, which may be empty to delete it.
+  // `repl` is at most 255 bytes long.
+  void Set(uint32_t cp, std::string_view repl) {
+    uint16_t &page = index_[cp >> 8];
+    if (page == 0) {
+      page = static_cast<uint16_t>(pages_.size());
+      pages_.emplace_back();
+      pages_.back().fill(0);
+    }
+    // offsets start at 1, so a deletion is not 0 either
+    const uint32_t offset = static_cast<uint32_t>(pool_.size());
+    pool_.append(repl.data(), repl.size());
+    pages_[page][cp & 0xff] =
+        (offset << 8) | static_cast<uint32_t>(repl.size());
+  }
+
+  // Returns true and sets `repl` if `cp` has a replacement.
+  bool Lookup(uint32_t cp, std::string_view *repl) const {
+    const uint32_t entry = pages_[index_[cp >> 8]][cp & 0xff];
+    if (entry == 0) {
+      return false;
+    }
+    *repl = std::string_view(pool_.data() + (entry >> 8), entry & 0xff);
+    return true;
+  }
+
+  bool Contains(uint32_t cp) const {
+    return pages_[index_[cp >> 8]][cp & 0xff] != 0;
+  }
+
+  // Bytes held by the table.
+  size_t MemoryUsage() const {
+    return index_.size() * sizeof(uint16_t) +
+           pages_.size() * sizeof(pages_[0]) + pool_.size();
+  }
+
+private:
+  std::vector<uint16_t> index_;
+  std::vector<std::array<uint32_t, 256>> pages_;
+  std::string pool_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_NORMALIZE_CODEPOINT_TABLE_H_
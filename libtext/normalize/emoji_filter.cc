@@ -15,46 +15,114 @@
 
 #include "libtext/normalize/emoji_filter.h"
 
+#include <initializer_list>
+#include <vector>
 
 namespace libtext {
 
 // declare resource
+extern const DoubleArrayUnit EMOJI_CODES_EN_TRIE[];
+extern const size_t EMOJI_CODES_EN_TRIE_SIZE;
+extern const DoubleArrayUnit EMOJI_NAMES_EN_TRIE[];
+extern const size_t EMOJI_NAMES_EN_TRIE_SIZE;
+extern const DoubleArrayUnit EMOJI_ALIAS_NAMES_EN_TRIE[];
+extern const size_t EMOJI_ALIAS_NAMES_EN_TRIE_SIZE;
 extern const char* const UNICODE_EMOJI_EN[][2];
 extern const char* const UNICODE_EMOJI_ALIAS_EN[][2];
 
-template <typename DictContainerType>
-static void AppendResource(const char* const resource[], DictContainerType& dic) {
-  uint32_t len = 0;
-  while (resource[len] != nullptr) {
-    dic[turbo::inlined_string(resource[len])] = 0;
-    ++len;
+namespace {
+
+// the children of the root are the first bytes of the keys
+void InsertFirstBytes(const DoubleArrayView &trie, ByteSet *bytes) {
+  const DoubleArrayUnit *units = trie.units();
+  for (int c = 1; c < 256; ++c) {
+    if (units[units[0].base ^ c].check == 0) {
+      bytes->Insert(static_cast<unsigned char>(c));
+    }
   }
 }
 
-template <typename DictContainerType>
-static void AppendResource(const char* const resource[][2], int idx, DictContainerType& dic) {
-  uint32_t len = 0;
-  while (resource[len][idx] != nullptr) {
-    dic[turbo::inlined_string(resource[len][idx])] = 0;
-    ++len;
+// A trie whose values are rows of an emoji table, `column` of the row is
+// the text a match is transcribed to.
+struct TranscribeTable {
+  DoubleArrayView trie;
+  const char* const (*rows)[2];
+  int column;
+};
+
+// Copies `str` to `out`, replacing the longest key of `tables` at every
+// position by its transcription. Earlier tables win on equal length.
+void Transcribe(const std::string_view &str, const ByteSet &lead_bytes,
+                const TranscribeTable *tables, size_t num_tables,
+                turbo::inlined_string *out) {
+  auto ptr = str.data();
+  auto len = str.size();
+  out->reserve(out->size() + len);
+  while (len > 0) {
+    auto skip = lead_bytes.FindFirst(ptr, len);
+    out->append(ptr, skip);
+    ptr += skip;
+    len -= skip;
+    if (len == 0) {
+      break;
+    }
+    size_t mblen = 0;
+    const char *repl = nullptr;
+    for (size_t i = 0; i < num_tables; ++i) {
+      int row = 0;
+      size_t n = tables[i].trie.PrefixSearch(ptr, len, &row);
+      if (n > mblen) {
+        mblen = n;
+        repl = tables[i].rows[row][tables[i].column];
+      }
+    }
+    if (mblen == 0) {
+      out->push_back(ptr[0]);
+      ++ptr;
+      --len;
+    } else {
+      out->append(repl);
+      ptr += mblen;
+      len -= mblen;
+    }
   }
 }
 
+// The tables of a transcription and the bytes their keys start with.
+struct Transcriber {
+  explicit Transcriber(std::initializer_list<TranscribeTable> list)
+      : tables(list) {
+    for (const auto &table : tables) {
+      InsertFirstBytes(table.trie, &lead_bytes);
+    }
+  }
+
+  void Run(const std::string_view &str, turbo::inlined_string *out) const {
+    Transcribe(str, lead_bytes, tables.data(), tables.size(), out);
+  }
+
+  std::vector<TranscribeTable> tables;
+  ByteSet lead_bytes;
+};
 
-// just for static link
-EmojiFilter::EmojiFilter(Options opt) {
-  opt_ = opt;
-  std::map<turbo::inlined_string , int> dic;
+}  // namespace
+
+EmojiFilter::EmojiFilter(Options opt) : opt_(opt), num_tries_(0) {
   if (opt_.unicode) {
-    AppendResource(UNICODE_EMOJI_EN, 1, dic);
+    tries_[num_tries_++] =
+        DoubleArrayView(EMOJI_CODES_EN_TRIE, EMOJI_CODES_EN_TRIE_SIZE);
   }
   if (opt_.unicode_trans) {
-    AppendResource(UNICODE_EMOJI_EN, 0, dic);
+    tries_[num_tries_++] =
+        DoubleArrayView(EMOJI_NAMES_EN_TRIE, EMOJI_NAMES_EN_TRIE_SIZE);
   }
   if (opt_.unicode_trans_alias) {
-    AppendResource(UNICODE_EMOJI_ALIAS_EN, 0, dic);
+    tries_[num_tries_++] = DoubleArrayView(EMOJI_ALIAS_NAMES_EN_TRIE,
+                                           EMOJI_ALIAS_NAMES_EN_TRIE_SIZE);
+  }
+  for (size_t i = 0; i < num_tries_; ++i) {
+    InsertFirstBytes(tries_[i], &lead_bytes_);
   }
-  emoji_codes_ = std::make_shared<PrefixMap>(dic);
 }
 
 turbo::inlined_string EmojiFilter::Replace(const std::string_view& str, const std::string_view& repl, bool keep_all) const {
@@ -67,7 +135,18 @@ turbo::inlined_string EmojiFilter::Replace(const std::string_view& str, const st
     result.reserve(len);
     bool last_is_emoji = false;
     while (len > 0) {
-      auto match_len = emoji_codes_->PrefixSearch(ptr, len, nullptr);
+      // copy the span that can not start an emoji in bulk
+      auto skip = lead_bytes_.FindFirst(ptr, len);
+      if (skip > 0) {
+        result.append(ptr, skip);
+        ptr += skip;
+        len -= skip;
+        last_is_emoji = false;
+        if (len == 0) {
+          break;
+        }
+      }
+      auto match_len = PrefixSearch(ptr, len);
       if (match_len <= 0) {
         result.push_back(ptr[0]);
         ++ptr;
@@ -93,7 +172,14 @@ turbo::inlined_string EmojiFilter::Filter(const std::string_view& str) const {
   result.reserve(len);
 
   while (len > 0) {
-    auto match_len = emoji_codes_->PrefixSearch(ptr, len, nullptr);
+    auto skip = lead_bytes_.FindFirst(ptr, len);
+    result.append(ptr, skip);
+    ptr += skip;
+    len -= skip;
+    if (len == 0) {
+      break;
+    }
+    auto match_len = PrefixSearch(ptr, len);
     if (match_len <= 0) {
       result.push_back(ptr[0]);
       ++ptr;
@@ -107,4 +193,37 @@ turbo::inlined_string EmojiFilter::Filter(const std::string_view& str) const {
   return result;
 }
 
+void Demojize(const std::string_view &str, turbo::inlined_string *out) {
+  // built on first use, the trie sizes are defined in another translation
+  // unit and may not be initialized yet during static initialization
+  static const Transcriber transcriber({
+      {DoubleArrayView(EMOJI_CODES_EN_TRIE, EMOJI_CODES_EN_TRIE_SIZE),
+       UNICODE_EMOJI_EN, 0},
+  });
+  transcriber.Run(str, out);
+}
+
+turbo::inlined_string Demojize(const std::string_view &str) {
+  turbo::inlined_string result;
+  Demojize(str, &result);
+  return result;
+}
+
+void Emojize(const std::string_view &str, turbo::inlined_string *out) {
+  static const Transcriber transcriber({
+      {DoubleArrayView(EMOJI_NAMES_EN_TRIE, EMOJI_NAMES_EN_TRIE_SIZE),
+       UNICODE_EMOJI_EN, 1},
+      {DoubleArrayView(EMOJI_ALIAS_NAMES_EN_TRIE,
+                       EMOJI_ALIAS_NAMES_EN_TRIE_SIZE),
+       UNICODE_EMOJI_ALIAS_EN, 1},
+  });
+  transcriber.Run(str, out);
+}
+
+turbo::inlined_string Emojize(const std::string_view &str) {
+  turbo::inlined_string result;
+  Emojize(str, &result);
+  return result;
+}
+
 }  // namespace libtext
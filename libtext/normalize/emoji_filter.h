@@ -16,14 +16,13 @@
 #ifndef LIBTEXT_NORMALIZE_EMOJI_FILTER_H_
 #define LIBTEXT_NORMALIZE_EMOJI_FILTER_H_
 
-#include <memory>
 #include <cstddef>
 #include <cstdint>
 #include <string>
-#include <map>
 #include "turbo/strings/string_view.h"
 #include "turbo/strings/inlined_string.h"
-#include "libtext/common/prefix_map.h"
+#include "libtext/common/double_array.h"
+#include "libtext/common/simd_scan.h"
 
 namespace libtext {
 
@@ -38,15 +37,17 @@ public:
         : unicode(true), unicode_trans(false), unicode_trans_alias(false){}
   };
 
+  // The emoji tries are generated at build time (emoji_trie_data.cc), so
+  // constructing a filter does not allocate and all filters share them.
   explicit EmojiFilter(Options opt);
   virtual ~EmojiFilter() = default;
 
   // check ptr[pos: return_len] is emoji
   inline size_t CheckPos(const char *ptr, size_t len, size_t pos = 0) const {
-    if (pos > len) {
+    if (pos >= len || !lead_bytes_.Contains(static_cast<unsigned char>(ptr[pos]))) {
       return 0;
     }
-    return emoji_codes_->PrefixSearch(ptr + pos, len - pos, nullptr);
+    return PrefixSearch(ptr + pos, len - pos);
   }
 
   turbo::inlined_string Replace(const std::string_view &str, const std::string_view &repl,
@@ -54,11 +55,40 @@ public:
 
   turbo::inlined_string Filter(const std::string_view &str) const;
 
+  // Bytes an emoji of the enabled tries can start with.
+  const ByteSet &lead_bytes() const { return lead_bytes_; }
+
 private:
+  // longest emoji of the enabled tries at the start of `ptr`
+  inline size_t PrefixSearch(const char *ptr, size_t len) const {
+    size_t mblen = 0;
+    for (size_t i = 0; i < num_tries_; ++i) {
+      size_t n = tries_[i].PrefixSearch(ptr, len, nullptr);
+      if (n > mblen) {
+        mblen = n;
+      }
+    }
+    return mblen;
+  }
+
   Options opt_;
-  std::shared_ptr<PrefixMap> emoji_codes_;
+  DoubleArrayView tries_[3];
+  size_t num_tries_;
+  // first bytes of all emoji keys, the tries are only probed at these
+  ByteSet lead_bytes_;
 };
 
+// Transcribes every emoji to its name, e.g. "\U0001f44d" to ":thumbs_up:".
+// The result is appended to `out`. Unlike EmojiFilter this always uses the
+// full emoji and name tables.
+void Demojize(const std::string_view &str, turbo::inlined_string *out);
+turbo::inlined_string Demojize(const std::string_view &str);
+
+// Transcribes emoji names and aliases back to emoji, e.g. ":thumbs_up:"
+// and ":+1:" to "\U0001f44d". The result is appended to `out`.
+void Emojize(const std::string_view &str, turbo::inlined_string *out);
+turbo::inlined_string Emojize(const std::string_view &str);
+
 } // namespace libtext
 
 #endif // LIBTEXT_NORMALIZE_EMOJI_FILTER_H_
@@ -0,0 +1,94 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <gtest/gtest.h>
+#include <libtext/normalize/emoji_filter.h>
+#include <string>
+
+namespace libtext {
+
+TEST(EmojiFilter, Filter) {
+  EmojiFilter filter((EmojiFilter::Options()));
+  ASSERT_EQ(filter.Filter(""), "");
+  ASSERT_EQ(filter.Filter("hello world"), "hello world");
+  ASSERT_EQ(filter.Filter("hello \U0001f600 world"), "hello  world");
+  ASSERT_EQ(filter.Filter("\U0001f600\U0001f600abc\U0001f600"), "abc");
+  // keycaps start with an ASCII byte
+  ASSERT_EQ(filter.Filter("a 1\U0000fe0f\U000020e3 b 123"), "a  b 123");
+  // spans longer than one vector with emoji on both sides of the boundary
+  std::string text(40, 'x');
+  text.insert(15, "\U0001f44d\U0001f3fd");
+  text.insert(0, "\U0001f64c");
+  text.append("\U0001f930");
+  ASSERT_EQ(filter.Filter(text), std::string(40, 'x'));
+  // CJK punctuation shares the first byte with some emoji
+  ASSERT_EQ(filter.Filter("\xE3\x80\x82\U0001f600\xE4\xBD\xA0\xE5\xA5\xBD"),
+            "\xE3\x80\x82\xE4\xBD\xA0\xE5\xA5\xBD");
+  // truncated sequences are kept as they are
+  ASSERT_EQ(filter.Filter("a\xF0\x9F"), "a\xF0\x9F");
+}
+
+TEST(EmojiFilter, Replace) {
+  EmojiFilter filter((EmojiFilter::Options()));
+  ASSERT_EQ(filter.Replace("a\U0001f600\U0001f600b", "<e>"), "a<e><e>b");
+  ASSERT_EQ(filter.Replace("a\U0001f600\U0001f600b", "<e>", false), "a<e>b");
+  ASSERT_EQ(filter.Replace("\U0001f600 \U0001f600", "<e>", false), "<e> <e>");
+  ASSERT_EQ(filter.Replace("a\U0001f600b", ""), "ab");
+}
+
+TEST(EmojiFilter, CheckPos) {
+  EmojiFilter filter((EmojiFilter::Options()));
+  std::string text("ab\U0001f600");
+  ASSERT_EQ(filter.CheckPos(text.data(), text.size(), 0), 0);
+  ASSERT_EQ(filter.CheckPos(text.data(), text.size(), 2), 4);
+  ASSERT_EQ(filter.CheckPos(text.data(), text.size(), 3), 0);
+  ASSERT_EQ(filter.CheckPos(text.data(), text.size(), text.size()), 0);
+}
+
+TEST(EmojiFilter, Transcription) {
+  EmojiFilter::Options opt;
+  opt.unicode = false;
+  opt.unicode_trans = true;
+  EmojiFilter filter(opt);
+  ASSERT_EQ(filter.Filter("a:thumbs_up:b:not_an_emoji:"), "ab:not_an_emoji:");
+  ASSERT_EQ(filter.Filter("a\U0001f600b"), "a\U0001f600b");
+
+  opt.unicode = true;
+  opt.unicode_trans_alias = true;
+  EmojiFilter all(opt);
+  ASSERT_EQ(all.Filter("a:thumbs_up:\U0001f600:+1:b"), "ab");
+}
+
+TEST(EmojiFilter, Demojize) {
+  ASSERT_EQ(Demojize(""), "");
+  ASSERT_EQ(Demojize("I \U0001f44d it"), "I :thumbs_up: it");
+  ASSERT_EQ(Demojize("\U0001f44d\U0001f44d"), ":thumbs_up::thumbs_up:");
+  ASSERT_EQ(Demojize("a:thumbs_up:b"), "a:thumbs_up:b");
+  // the result is appended to the buffer
+  turbo::inlined_string out("> ");
+  Demojize("\U0001f44d", &out);
+  ASSERT_EQ(out, "> :thumbs_up:");
+}
+
+TEST(EmojiFilter, Emojize) {
+  ASSERT_EQ(Emojize(":thumbs_up: :+1:"), "\U0001f44d \U0001f44d");
+  ASSERT_EQ(Emojize(":not_an_emoji: \U0001f44d"),
+            ":not_an_emoji: \U0001f44d");
+  ASSERT_EQ(Emojize("a:thumbs_up"), "a:thumbs_up");
+  std::string text("I \U0001f44d it, \U0001f600 \U0001f64c\U0001f3fd!");
+  ASSERT_EQ(Emojize(Demojize(text)), text);
+}
+
+}  // namespace libtext
@@ -0,0 +1,7192 @@
+// GENERATED! DO NOT MANUALLY EDIT THIS FILE.
+//
+// (1) Edit libtext/normalize/emoji_unicode_codes_en.cc or
+//     libtext/normalize/emoji_unicode_alias_codes_en.cc.
+// (2) Run `python <path_to_libtext>/libtext/normalize/generate_emoji_trie.py`.
+
+#include "libtext/common/double_array.h"
+#include "turbo/platform/port.h"
+
+namespace libtext {
+
+TURBO_DLL extern const DoubleArrayUnit EMOJI_CODES_EN_TRIE[] = {
+    {34, -1}, {224, 0}, {143, 1}, {154, 8}, {158, 18}, {256, 210}, {164, 19}, {178, 16},
+    {225, 0}, {166, 18}, {138, 16}, {146, 19}, {243, 2}, {221, 15}, {164, 8}, {181, 1},
+    {229, 0}, {194, 0}, {230, 0}, {228, 0}, {193, 0}, {198, 0}, {195, 0}, {192, 0},
+    {69, 224}, {196, 3}, {199, 0}, {196, 0}, {251, 14}, {212, 4}, {9, 9}, {71, 224},
+    {176, 17}, {182, 22}, {180, 23}, {186, 20}, {191, 21}, {189, 26}, {193, 27}, {36, 6},
+    {135, 26}, {133, 21}, {1, 11}, {251, 27}, {142, 22}, {140, 17}, {131, 20}, {128, 23},
+    {197, 193}, {51, 7}, {30, 10}, {49, 32}, {27, 45}, {54, 33}, {24, 44}, {59, 34},
+    {22, 47}, {56, 35}, {242, 193}, {19, 46}, {62, 36}, {47, 41}, {1, 37}, {44, 40},
+    {244, 192}, {192, 192}, {5, 38}, {40, 43}, {232, 192}, {1772, 24}, {20, 192}, {1847, 31},
+    {170, 64}, {172, 65}, {174, 68}, {211, 78}, {206, 192}, {254, 83}, {195, 192}, {208, 192},
+    {483, 12}, {175, 68}, {260, 13}, {207, 192}, {199, 76}, {208, 76}, {196, 192}, {4, 192},
+    {11, 192}, {68, 192}, {402, 192}, {421, 192}, {450, 192}, {97, 192}, {72, 192}, {216, 79},
+    {238, 79}, {240, 79}, {241, 79}, {243, 79}, {196, 192}, {476, 58}, {209, 76}, {487, 25},
+    {249, 79}, {252, 79}, {253, 79}, {477, 58}, {417, 192}, {227, 192}, {258, 86}, {259, 86},
+    {465, 100}, {466, 100}, {264, 86}, {472, 109}, {266, 28}, {474, 48}, {473, 109}, {489, 29},
+    {475, 48}, {217, 79}, {218, 79}, {220, 79}, {227, 79}, {232, 79}, {234, 79}, {235, 79},
+    {176, 70}, {180, 70}, {181, 70}, {182, 70}, {266, 87}, {302, 88}, {264, 30}, {491, 39},
+    {296, 88}, {293, 88}, {286, 88}, {283, 88}, {183, 70}, {187, 70}, {270, 42}, {297, 88},
+    {493, 49}, {274, 50}, {497, 51}, {315, 88}, {272, 52}, {499, 53}, {316, 88}, {277, 54},
+    {508, 55}, {743, 56}, {304, 88}, {572, 57}, {735, 59}, {574, 60}, {311, 88}, {309, 88},
+    {733, 61}, {323, 88}, {584, 62}, {683, 63}, {325, 88}, {324, 88}, {586, 66}, {681, 67},
+    {321, 88}, {319, 88}, {218, 72}, {318, 88}, {991, 73}, {322, 88}, {2412, 74}, {2773, 81},
+    {1922, 128}, {337, 88}, {332, 88}, {326, 88}, {644, 129}, {998, 130}, {1037, 131}, {351, 140},
+    {275, 87}, {281, 87}, {282, 87}, {973, 141}, {2427, 189}, {188, 70}, {195, 70}, {269, 87},
+    {192, 0}, {176, 0}, {456, 93}, {901, 190}, {338, 89}, {457, 93}, {339, 89}, {1081, 84},
+    {346, 89}, {347, 89}, {348, 89}, {349, 89}, {341, 89}, {343, 89}, {344, 89}, {345, 89},
+    {435, 85}, {425, 102}, {154, 0}, {2811, 75}, {350, 89}, {352, 89}, {353, 89}, {354, 89},
+    {2480, 95}, {1513, 121}, {1646, 122}, {356, 89}, {1459, 123}, {458, 94}, {459, 94}, {461, 94},
+    {177, 0}, {359, 89}, {360, 89}, {417, 124}, {357, 89}, {448, 93}, {449, 93}, {358, 89},
+    {2151, 125}, {462, 94}, {1730, 126}, {2243, 127}, {361, 89}, {450, 93}, {673, 96}, {451, 93},
+    {1295, 97}, {1374, 98}, {452, 93}, {2079, 99}, {454, 93}, {453, 93}, {455, 93}, {464, 94},
+    {463, 94}, {1544, 104}, {364, 89}, {365, 89}, {492, 105}, {1606, 106}, {635, 77}, {363, 89},
+    {366, 90}, {367, 90}, {2542, 110}, {1493, 111}, {371, 90}, {372, 90}, {368, 90}, {370, 90},
+    {1282, 114}, {375, 90}, {2152, 132}, {373, 90}, {417, 91}, {2027, 191}, {376, 90}, {418, 91},
+    {430, 91}, {429, 91}, {431, 91}, {1859, 184}, {424, 91}, {419, 91}, {428, 91}, {427, 91},
+    {434, 91}, {1024, 185}, {2091, 186}, {751, 139}, {512, 91}, {432, 91}, {2550, 138}, {433, 91},
+    {388, 91}, {386, 91}, {381, 90}, {382, 90}, {467, 108}, {2651, 137}, {469, 108}, {468, 108},
+    {1721, 136}, {2160, 143}, {412, 91}, {395, 91}, {385, 90}, {394, 91}, {662, 133}, {383, 90},
+    {774, 154}, {416, 91}, {377, 90}, {378, 90}, {413, 91}, {2763, 159}, {414, 91}, {2386, 158},
+    {379, 90}, {380, 90}, {470, 108}, {2762, 147}, {863, 150}, {471, 108}, {2299, 171}, {1614, 169},
+    {435, 92}, {1820, 168}, {2502, 173}, {195, 161}, {1487, 165}, {896, 164}, {271, 179}, {436, 92},
+    {513, 92}, {514, 92}, {437, 92}, {438, 92}, {2465, 178}, {439, 92}, {515, 92}, {516, 92},
+    {440, 92}, {2150, 177}, {497, 196}, {1193, 198}, {442, 92}, {446, 204}, {441, 92}, {1661, 205},
+    {792, 206}, {2529, 207}, {2020, 200}, {2279, 201}, {778, 202}, {1833, 203}, {2041, 212}, {443, 92},
+    {325, 213}, {1265, 214}, {537, 215}, {444, 92}, {968, 219}, {2086, 228}, {1779, 231}, {830, 225},
+    {873, 226}, {1653, 236}, {445, 92}, {2357, 255}, {2581, 250}, {1148, 251}, {1397, 256}, {524, 257},
+    {2664, 262}, {446, 92}, {2044, 263}, {1229, 260}, {2522, 261}, {277, 267}, {447, 92}, {2439, 265},
+    {2403, 270}, {332, 306}, {1174, 307}, {1320, 312}, {213, 313}, {1799, 290}, {2195, 291}, {2646, 303},
+    {346, 5}, {1794, 300}, {2794, 289}, {336, 5}, {221, 288}, {336, 5}, {364, 5}, {672, 5},
+    {705, 5}, {372, 5}, {236, 301}, {1591, 299}, {512, 5}, {896, 5}, {960, 5}, {768, 5},
+    {832, 5}, {1152, 5}, {1216, 5}, {1024, 5}, {1088, 5}, {1417, 5}, {724, 5}, {582, 5},
+    {1472, 5}, {672, 5}, {1280, 5}, {1344, 5}, {1175, 298}, {1217, 308}, {2024, 310}, {656, 5},
+    {1547, 305}, {2390, 268}, {756, 271}, {2576, 277}, {1677, 5}, {1728, 5}, {1536, 5}, {1600, 5},
+    {2430, 276}, {767, 5}, {604, 5}, {1667, 279}, {189, 278}, {1479, 273}, {1628, 272}, {498, 274},
+    {1524, 285}, {1520, 287}, {2684, 280}, {158, 320}, {2708, 327}, {104, 330}, {1634, 331}, {554, 333},
+    {1525, 336}, {1162, 342}, {2611, 340}, {1577, 351}, {2656, 355}, {1228, 362}, {24, 369}, {1458, 374},
+    {461, 229}, {731, 230}, {2088, 237}, {1536, 239}, {422, 242}, {2764, 245}, {784, 244}, {964, 246},
+    {503, 194}, {355, 197}, {552, 221}, {2720, 222}, {719, 150}, {2424, 223}, {2035, 233}, {1418, 248},
+    {2344, 247}, {2746, 112}, {1083, 113}, {2016, 292}, {550, 295}, {382, 294}, {1262, 314}, {182, 317},
+    {760, 115}, {1176, 118}, {1268, 117}, {1752, 120}, {1701, 101}, {722, 107}, {602, 384}, {604, 387},
+    {605, 389}, {608, 389}, {611, 390}, {290, 80}, {722, 393}, {723, 393}, {3053, 82}, {303, 103},
+    {3052, 116}, {2139, 119}, {3059, 134}, {1892, 135}, {3058, 142}, {2353, 144}, {609, 389}, {610, 389},
+    {3057, 145}, {251, 146}, {3056, 148}, {99, 149}, {623, 390}, {634, 390}, {637, 390}, {3063, 151},
+    {618, 390}, {619, 390}, {620, 390}, {621, 390}, {974, 152}, {612, 390}, {615, 390}, {617, 390},
+    {345, 284}, {343, 328}, {735, 329}, {510, 334}, {713, 335}, {3062, 153}, {1281, 391}, {1291, 391},
+    {1292, 391}, {1293, 391}, {1294, 391}, {1295, 391}, {1315, 391}, {1316, 391}, {1319, 391}, {1334, 391},
+    {1335, 391}, {1336, 391}, {1792, 391}, {1793, 391}, {1794, 391}, {1795, 391}, {1796, 391}, {1797, 391},
+    {1798, 391}, {1799, 391}, {1800, 391}, {1801, 391}, {1802, 391}, {1803, 391}, {1804, 391}, {1805, 391},
+    {2505, 409}, {2506, 409}, {2507, 409}, {2508, 409}, {2509, 409}, {2560, 409}, {2561, 409}, {2562, 409},
+    {2510, 409}, {2511, 409}, {2512, 409}, {2563, 409}, {2564, 409}, {2565, 409}, {2566, 409}, {2567, 409},
+    {2618, 415}, {2619, 415}, {2620, 415}, {2621, 415}, {2622, 415}, {2623, 415}, {2624, 415}, {2625, 415},
+    {2626, 415}, {2627, 415}, {2628, 415}, {2629, 415}, {2301, 155}, {3061, 156}, {2168, 157}, {3060, 160},
+    {638, 392}, {2406, 406}, {2407, 406}, {639, 392}, {2405, 406}, {2917, 425}, {2916, 425}, {2915, 425},
+    {549, 162}, {3067, 163}, {868, 166}, {3066, 167}, {2914, 425}, {2913, 425}, {2912, 425}, {2911, 425},
+    {3061, 460}, {3060, 751}, {3059, 752}, {2400, 406}, {3058, 753}, {3057, 754}, {3056, 755}, {2831, 756},
+    {2403, 406}, {2404, 406}, {1147, 478}, {674, 392}, {2388, 479}, {2740, 480}, {2401, 406}, {2402, 406},
+    {551, 481}, {120, 494}, {2082, 495}, {477, 482}, {668, 509}, {2411, 406}, {2412, 406}, {629, 510},
+    {2413, 406}, {2094, 511}, {2657, 504}, {1250, 505}, {1681, 506}, {2023, 507}, {675, 392}, {1131, 500},
+    {2408, 406}, {2409, 406}, {705, 392}, {704, 392}, {710, 392}, {707, 392}, {714, 392}, {711, 392},
+    {720, 392}, {715, 392}, {2208, 501}, {721, 392}, {2410, 406}, {476, 502}, {2609, 576}, {2631, 579},
+    {726, 396}, {729, 396}, {734, 396}, {735, 396}, {736, 396}, {737, 396}, {738, 396}, {739, 396},
+    {740, 396}, {742, 396}, {744, 396}, {746, 396}, {747, 396}, {748, 396}, {749, 396}, {758, 396},
+    {759, 396}, {766, 396}, {767, 396}, {852, 396}, {853, 396}, {856, 396}, {860, 396}, {861, 396},
+    {945, 396}, {946, 396}, {950, 396}, {1214, 396}, {1278, 396}, {1279, 396}, {1286, 396}, {1288, 396},
+    {1289, 396}, {1290, 396}, {1693, 603}, {327, 622}, {1312, 396}, {1313, 396}, {1314, 396}, {1317, 396},
+    {1330, 396}, {1332, 396}, {1333, 396}, {1339, 396}, {1481, 396}, {1482, 396}, {1494, 396}, {1496, 396},
+    {1497, 396}, {1498, 396}, {1499, 396}, {1500, 396}, {1501, 396}, {1502, 396}, {1503, 396}, {1510, 396},
+    {1511, 396}, {1512, 396}, {1514, 396}, {1517, 396}, {1518, 396}, {1519, 396}, {1522, 396}, {1537, 396},
+    {1133, 627}, {2206, 626}, {2416, 407}, {986, 629}, {2414, 407}, {2415, 407}, {372, 628}, {2785, 631},
+    {2924, 426}, {2925, 426}, {1130, 630}, {2682, 633}, {2920, 426}, {2921, 426}, {2922, 426}, {2923, 426},
+    {97, 632}, {2191, 635}, {1620, 484}, {1056, 485}, {2418, 407}, {2419, 407}, {943, 640}, {2417, 407},
+    {2422, 407}, {469, 641}, {2420, 407}, {2421, 407}, {2918, 426}, {2919, 426}, {910, 642}, {695, 643},
+    {2538, 644}, {1522, 645}, {1774, 646}, {1726, 647}, {666, 648}, {2424, 407}, {228, 649}, {2423, 407},
+    {767, 650}, {2426, 407}, {2741, 651}, {2025, 652}, {2201, 653}, {2236, 654}, {2425, 407}, {745, 284},
+    {717, 284}, {715, 328}, {714, 329}, {713, 334}, {712, 335}, {2427, 407}, {2425, 655}, {1677, 656},
+    {2432, 407}, {2433, 407}, {2430, 407}, {2431, 407}, {2428, 407}, {2429, 407}, {1886, 657}, {1686, 658},
+    {1540, 397}, {1541, 397}, {1542, 397}, {1543, 397}, {1544, 397}, {1545, 397}, {1546, 397}, {1547, 397},
+    {1548, 397}, {1549, 397}, {1550, 397}, {1551, 397}, {1590, 397}, {1606, 397}, {1650, 397}, {1655, 397},
+    {1656, 397}, {1657, 397}, {1699, 397}, {1700, 397}, {1707, 397}, {1708, 397}, {1709, 397}, {1739, 397},
+    {1740, 397}, {1806, 397}, {1807, 397}, {1808, 397}, {1809, 397}, {1810, 397}, {1811, 397}, {1812, 397},
+    {1813, 397}, {1814, 397}, {1815, 397}, {1816, 397}, {1817, 397}, {1818, 397}, {1819, 397}, {1820, 397},
+    {1821, 397}, {1822, 397}, {1823, 397}, {1824, 397}, {1825, 397}, {1826, 397}, {1827, 397}, {1828, 397},
+    {1829, 397}, {1830, 397}, {1831, 397}, {1832, 397}, {1833, 397}, {1834, 397}, {1835, 397}, {1836, 397},
+    {1837, 397}, {1838, 397}, {1839, 397}, {1840, 397}, {1841, 397}, {1842, 397}, {1843, 397}, {1844, 397},
+    {1845, 398}, {1846, 398}, {1847, 398}, {1848, 398}, {1849, 398}, {1850, 398}, {1851, 398}, {1852, 398},
+    {1853, 398}, {1854, 398}, {1855, 398}, {1856, 398}, {1857, 398}, {1858, 398}, {1859, 398}, {1860, 398},
+    {1861, 398}, {1862, 398}, {1863, 398}, {1864, 398}, {1091, 659}, {1570, 660}, {1865, 398}, {1866, 398},
+    {1316, 661}, {1867, 398}, {1868, 398}, {1869, 398}, {878, 662}, {2792, 663}, {1870, 398}, {1871, 398},
+    {1872, 398}, {1873, 398}, {1874, 398}, {1875, 398}, {1876, 398}, {1877, 398}, {1878, 398}, {1879, 398},
+    {1880, 398}, {1881, 398}, {1882, 398}, {1883, 398}, {1884, 398}, {1885, 398}, {1886, 398}, {1887, 398},
+    {1888, 398}, {1889, 398}, {1890, 398}, {1891, 398}, {1892, 398}, {1893, 398}, {1894, 398}, {1895, 398},
+    {1896, 398}, {1897, 398}, {1898, 398}, {1899, 398}, {1900, 398}, {1901, 398}, {1902, 398}, {1903, 398},
+    {1904, 399}, {1905, 399}, {1906, 399}, {1907, 399}, {1908, 399}, {1909, 399}, {1910, 399}, {1911, 399},
+    {1912, 399}, {1913, 399}, {1914, 399}, {1915, 399}, {1916, 399}, {1917, 399}, {1918, 399}, {1919, 399},
+    {1920, 399}, {1921, 399}, {1925, 399}, {1926, 399}, {1928, 399}, {1929, 399}, {1933, 399}, {1934, 399},
+    {1935, 399}, {1936, 399}, {1938, 399}, {1941, 399}, {1943, 399}, {1945, 399}, {1946, 399}, {1947, 399},
+    {1948, 399}, {1949, 399}, {1950, 399}, {1951, 399}, {1952, 399}, {1953, 399}, {1954, 399}, {1955, 399},
+    {1956, 399}, {1957, 399}, {1958, 399}, {1959, 399}, {1960, 399}, {1961, 399}, {1962, 399}, {1963, 399},
+    {1964, 399}, {1660, 664}, {12, 665}, {2048, 399}, {2049, 399}, {1965, 399}, {622, 666}, {1966, 399},
+    {1967, 399}, {1968, 399}, {1969, 399}, {1970, 399}, {1971, 399}, {1972, 399}, {1973, 399}, {1974, 399},
+    {1975, 400}, {1976, 400}, {1977, 400}, {1978, 400}, {1979, 400}, {1980, 400}, {1981, 400}, {1982, 400},
+    {1983, 400}, {1984, 400}, {1985, 400}, {1986, 400}, {1987, 400}, {1988, 400}, {1989, 400}, {1990, 400},
+    {1991, 400}, {1992, 400}, {1993, 400}, {1995, 400}, {1996, 400}, {2050, 400}, {1997, 400}, {1998, 400},
+    {1999, 400}, {2000, 400}, {2001, 400}, {2002, 400}, {2003, 400}, {2004, 400}, {2005, 400}, {2006, 400},
+    {2007, 400}, {2008, 400}, {2009, 400}, {2010, 400}, {2011, 400}, {2012, 400}, {2013, 400}, {2014, 400},
+    {2015, 400}, {2016, 400}, {2017, 400}, {2018, 400}, {2019, 400}, {2020, 400}, {2021, 400}, {2022, 400},
+    {2023, 400}, {2024, 400}, {2025, 400}, {2026, 400}, {2027, 400}, {2028, 400}, {2029, 400}, {2030, 400},
+    {2031, 400}, {2046, 400}, {2047, 400}, {2051, 400}, {2052, 400}, {2053, 400}, {2054, 400}, {2055, 400},
+    {2056, 401}, {2057, 401}, {2058, 401}, {2059, 401}, {2060, 401}, {2061, 401}, {2062, 401}, {2063, 401},
+    {2065, 401}, {2066, 401}, {2068, 401}, {2069, 401}, {2071, 401}, {2072, 401}, {2073, 401}, {2074, 401},
+    {2075, 401}, {2064, 401}, {2067, 401}, {2070, 401}, {2076, 401}, {2077, 401}, {2078, 401}, {2079, 401},
+    {2080, 401}, {2081, 401}, {2082, 401}, {2083, 401}, {2084, 401}, {2085, 401}, {2086, 401}, {2087, 401},
+    {2088, 401}, {2089, 401}, {2090, 401}, {2091, 401}, {2092, 401}, {2093, 401}, {2094, 401}, {2095, 401},
+    {2096, 401}, {2097, 401}, {2098, 401}, {2099, 401}, {2100, 401}, {2101, 401}, {2102, 401}, {2103, 401},
+    {2104, 401}, {2105, 401}, {2106, 401}, {2107, 401}, {2108, 401}, {2109, 401}, {2110, 401}, {2111, 401},
+    {2112, 401}, {2113, 401}, {2114, 401}, {2115, 401}, {2116, 401}, {2117, 401}, {2118, 401}, {2119, 401},
+    {2120, 402}, {2121, 402}, {2122, 402}, {2123, 402}, {2124, 402}, {2125, 402}, {2126, 402}, {2127, 402},
+    {2128, 402}, {2129, 402}, {2130, 402}, {2131, 402}, {2132, 402}, {2133, 402}, {2134, 402}, {2135, 402},
+    {2136, 402}, {2137, 402}, {2138, 402}, {2139, 402}, {2140, 402}, {2141, 402}, {2142, 402}, {2143, 402},
+    {2144, 402}, {2145, 402}, {2146, 402}, {2147, 402}, {2148, 402}, {2149, 402}, {2150, 402}, {2151, 402},
+    {2152, 402}, {2153, 402}, {2154, 402}, {2155, 402}, {2156, 402}, {2157, 402}, {2158, 402}, {2159, 402},
+    {2160, 402}, {2161, 402}, {2162, 402}, {2163, 402}, {2164, 402}, {2165, 402}, {2166, 402}, {2167, 402},
+    {2168, 402}, {2169, 402}, {2170, 402}, {2171, 402}, {2172, 402}, {2173, 402}, {2174, 402}, {2175, 402},
+    {2176, 402}, {2177, 402}, {2179, 402}, {2180, 402}, {2181, 402}, {2182, 402}, {2183, 402}, {2184, 402},
+    {2185, 403}, {2186, 403}, {2187, 403}, {2188, 403}, {2189, 403}, {2190, 403}, {2191, 403}, {2192, 403},
+    {2193, 403}, {2194, 403}, {2195, 403}, {2196, 403}, {2197, 403}, {2198, 403}, {2199, 403}, {2200, 403},
+    {2201, 403}, {2202, 403}, {2203, 403}, {2204, 403}, {2205, 403}, {2206, 403}, {2207, 403}, {2208, 403},
+    {2209, 403}, {2210, 403}, {2211, 403}, {2212, 403}, {2213, 403}, {2214, 403}, {2215, 403}, {2217, 403},
+    {2218, 403}, {2222, 403}, {2223, 403}, {2225, 403}, {2226, 403}, {2227, 403}, {2229, 403}, {2230, 403},
+    {2231, 403}, {2232, 403}, {2236, 403}, {2242, 403}, {2243, 403}, {2244, 403}, {2245, 403}, {2247, 403},
+    {2256, 403}, {2257, 403}, {2262, 403}, {2263, 403}, {2264, 403}, {2266, 403}, {2268, 403}, {2284, 403},
+    {2285, 403}, {2286, 403}, {2288, 403}, {2289, 403}, {2291, 403}, {2292, 403}, {310, 667}, {2293, 403},
+    {2294, 404}, {2295, 404}, {2296, 404}, {2297, 404}, {2300, 404}, {2301, 404}, {2304, 404}, {2305, 404},
+    {2306, 404}, {2307, 404}, {2308, 404}, {2309, 404}, {2310, 404}, {2311, 404}, {2312, 404}, {2313, 404},
+    {2314, 404}, {2315, 404}, {2316, 404}, {2317, 404}, {2318, 404}, {2319, 404}, {2320, 404}, {2321, 404},
+    {2322, 404}, {2323, 404}, {2324, 404}, {2325, 404}, {2326, 404}, {2327, 404}, {2328, 404}, {2329, 404},
+    {2330, 404}, {2331, 404}, {2332, 404}, {2333, 404}, {2334, 404}, {2335, 404}, {2336, 404}, {2337, 404},
+    {2338, 404}, {2339, 404}, {2340, 404}, {2341, 404}, {2342, 404}, {2343, 404}, {2344, 404}, {2345, 404},
+    {2346, 404}, {2347, 404}, {2348, 404}, {2349, 404}, {2350, 404}, {2351, 404}, {2352, 404}, {2353, 404},
+    {2354, 404}, {2355, 404}, {2356, 404}, {2357, 404}, {2358, 404}, {2359, 404}, {1436, 668}, {1023, 669},
+    {2360, 405}, {2466, 518}, {2362, 405}, {2361, 405}, {2364, 405}, {2363, 405}, {2132, 670}, {2365, 405},
+    {392, 671}, {1076, 672}, {650, 673}, {34, 519}, {132, 520}, {2249, 521}, {102, 522}, {2459, 523},
+    {2375, 405}, {2374, 405}, {2377, 405}, {2376, 405}, {2379, 405}, {2378, 405}, {2381, 405}, {2380, 405},
+    {2367, 405}, {2366, 405}, {2369, 405}, {2368, 405}, {2371, 405}, {2370, 405}, {2373, 405}, {2372, 405},
+    {1901, 676}, {2137, 677}, {1379, 678}, {2559, 524}, {997, 525}, {462, 679}, {2390, 405}, {1600, 526},
+    {2383, 405}, {2382, 405}, {2385, 405}, {2384, 405}, {2387, 405}, {2386, 405}, {2389, 405}, {2388, 405},
+    {2398, 405}, {2397, 405}, {1049, 680}, {2399, 405}, {1364, 681}, {2226, 682}, {801, 527}, {893, 528},
+    {232, 529}, {2391, 405}, {2392, 405}, {320, 683}, {2394, 405}, {2393, 405}, {2396, 405}, {2395, 405},
+    {2434, 408}, {2435, 408}, {2436, 408}, {2437, 408}, {2438, 408}, {2439, 408}, {2440, 408}, {2441, 408},
+    {2442, 408}, {2443, 408}, {2444, 408}, {2445, 408}, {2446, 408}, {2447, 408}, {2448, 408}, {2449, 408},
+    {2450, 408}, {2451, 408}, {2452, 408}, {2456, 408}, {2457, 408}, {2458, 408}, {2459, 408}, {2460, 408},
+    {2461, 408}, {2462, 408}, {2463, 408}, {2464, 408}, {2465, 408}, {2466, 408}, {2467, 408}, {2468, 408},
+    {2469, 408}, {2470, 408}, {2471, 408}, {2472, 408}, {2475, 408}, {2476, 408}, {2477, 408}, {2478, 408},
+    {2480, 408}, {2481, 408}, {2482, 408}, {2483, 408}, {2484, 408}, {2486, 408}, {2487, 408}, {2488, 408},
+    {2489, 408}, {2490, 408}, {2491, 408}, {2492, 408}, {2493, 408}, {2494, 408}, {2495, 408}, {2496, 408},
+    {2497, 408}, {2498, 408}, {2499, 408}, {2500, 408}, {2501, 408}, {2502, 408}, {2503, 408}, {2504, 408},
+    {2513, 410}, {2514, 410}, {2515, 410}, {2516, 410}, {2517, 410}, {2518, 410}, {2519, 410}, {2520, 410},
+    {2521, 410}, {2522, 410}, {2523, 410}, {2524, 410}, {2525, 410}, {2526, 410}, {2527, 410}, {2528, 410},
+    {2529, 410}, {2530, 410}, {2531, 410}, {2532, 410}, {2533, 410}, {2534, 410}, {2535, 410}, {2536, 410},
+    {2537, 410}, {2538, 410}, {2539, 410}, {2540, 410}, {2541, 410}, {2542, 410}, {2543, 410}, {2544, 410},
+    {2545, 410}, {2546, 410}, {2547, 410}, {2568, 410}, {2548, 410}, {2549, 410}, {2550, 410}, {2551, 410},
+    {2552, 410}, {2553, 410}, {2554, 410}, {2555, 410}, {2556, 410}, {2557, 410}, {2558, 410}, {2559, 410},
+    {2569, 410}, {2570, 410}, {2571, 410}, {2572, 410}, {2573, 410}, {2574, 410}, {2575, 410}, {2576, 410},
+    {2577, 410}, {2578, 410}, {2579, 410}, {2580, 410}, {2581, 410}, {2582, 410}, {2583, 410}, {2584, 410},
+    {2585, 411}, {2586, 411}, {2587, 411}, {2588, 411}, {2589, 411}, {2590, 411}, {2837, 527}, {2836, 528},
+    {2835, 529}, {2475, 684}, {2693, 685}, {2591, 411}, {2592, 411}, {2593, 411}, {2594, 411}, {2595, 411},
+    {2596, 411}, {2597, 411}, {2598, 411}, {2840, 524}, {2839, 525}, {2599, 411}, {617, 686}, {2838, 526},
+    {1891, 687}, {1902, 688}, {946, 689}, {296, 690}, {72, 691}, {10, 692}, {851, 693}, {790, 694},
+    {2600, 411}, {2601, 411}, {2602, 411}, {2603, 411}, {2604, 411}, {2605, 411}, {1447, 695}, {634, 696},
+    {521, 697}, {2606, 411}, {273, 698}, {2607, 411}, {2608, 411}, {68, 699}, {440, 700}, {1649, 701},
+    {2609, 411}, {2846, 518}, {1802, 702}, {2610, 411}, {2611, 411}, {2612, 411}, {2613, 411}, {2614, 411},
+    {2615, 411}, {2616, 411}, {2617, 411}, {2845, 519}, {2844, 520}, {2843, 521}, {2842, 522}, {2841, 523},
+    {2630, 420}, {789, 703}, {2632, 420}, {2631, 420}, {1999, 768}, {2269, 769}, {2197, 770}, {2757, 771},
+    {1435, 772}, {2562, 773}, {1044, 774}, {1702, 775}, {2626, 776}, {1253, 777}, {424, 778}, {219, 779},
+    {2646, 420}, {2645, 420}, {2648, 420}, {2647, 420}, {2642, 420}, {2641, 420}, {2644, 420}, {2643, 420},
+    {2638, 420}, {2637, 420}, {2640, 420}, {2639, 420}, {2634, 420}, {2633, 420}, {2636, 420}, {2635, 420},
+    {2662, 420}, {2661, 420}, {2664, 420}, {2663, 420}, {2658, 420}, {2657, 420}, {2660, 420}, {2659, 420},
+    {2654, 420}, {2653, 420}, {2656, 420}, {2655, 420}, {2650, 420}, {2649, 420}, {2652, 420}, {2651, 420},
+    {2677, 420}, {2676, 420}, {2679, 420}, {2678, 420}, {2674, 420}, {2673, 420}, {1251, 780}, {2675, 420},
+    {2670, 420}, {2669, 420}, {2672, 420}, {2671, 420}, {2666, 420}, {2665, 420}, {2668, 420}, {2667, 420},
+    {2680, 421}, {2681, 421}, {2682, 421}, {2683, 421}, {2684, 421}, {2685, 421}, {2327, 781}, {2686, 421},
+    {2687, 421}, {2691, 421}, {2692, 421}, {2695, 421}, {2696, 421}, {2697, 421}, {2698, 421}, {2699, 421},
+    {2700, 421}, {2701, 421}, {2702, 421}, {2703, 421}, {2705, 421}, {2709, 421}, {2712, 421}, {2720, 421},
+    {2726, 421}, {2729, 421}, {2730, 421}, {2731, 421}, {2732, 421}, {2733, 421}, {2734, 421}, {2736, 421},
+    {2737, 421}, {2738, 421}, {2739, 421}, {2740, 421}, {2741, 421}, {2742, 421}, {2743, 421}, {2744, 421},
+    {2745, 421}, {2746, 421}, {2747, 421}, {2748, 421}, {2750, 421}, {2751, 421}, {2752, 421}, {2753, 421},
+    {2754, 421}, {2755, 421}, {2589, 782}, {2756, 421}, {2757, 421}, {2758, 421}, {2759, 421}, {1260, 783},
+    {2567, 784}, {2752, 785}, {2760, 421}, {2761, 421}, {2762, 421}, {2763, 421}, {2764, 421}, {2765, 421},
+    {2766, 422}, {2767, 422}, {2769, 422}, {2770, 422}, {2771, 422}, {2772, 422}, {2773, 422}, {2774, 422},
+    {2775, 422}, {2776, 422}, {2777, 422}, {2778, 422}, {2779, 422}, {2780, 422}, {2781, 422}, {2782, 422},
+    {2783, 422}, {2789, 422}, {2790, 422}, {2792, 422}, {2795, 422}, {2798, 422}, {2809, 422}, {2810, 422},
+    {2811, 422}, {2812, 422}, {2816, 422}, {2817, 422}, {2818, 422}, {2819, 422}, {2820, 422}, {2821, 422},
+    {2822, 422}, {2823, 422}, {2824, 422}, {193, 786}, {1698, 787}, {2825, 422}, {2826, 422}, {2827, 422},
+    {2828, 422}, {2829, 422}, {2830, 422}, {1966, 788}, {2172, 789}, {2739, 790}, {2831, 422}, {2832, 422},
+    {2833, 422}, {2834, 422}, {2835, 422}, {2836, 422}, {2837, 422}, {2838, 422}, {2839, 422}, {2840, 422},
+    {2841, 422}, {2842, 422}, {2843, 422}, {2844, 422}, {2845, 422}, {2846, 422}, {2847, 422}, {2848, 422},
+    {2849, 423}, {2850, 423}, {2851, 423}, {2852, 423}, {2853, 423}, {2854, 423}, {2855, 423}, {2856, 423},
+    {2857, 423}, {2858, 423}, {2859, 423}, {1373, 791}, {317, 792}, {2860, 423}, {2861, 423}, {2862, 423},
+    {2863, 423}, {2864, 423}, {2865, 423}, {2866, 423}, {2867, 423}, {2868, 423}, {2869, 423}, {2870, 423},
+    {2871, 423}, {2872, 423}, {2873, 423}, {2874, 423}, {2875, 423}, {2876, 423}, {2877, 423}, {2878, 423},
+    {2879, 423}, {2880, 423}, {2881, 423}, {2882, 423}, {2883, 423}, {2884, 423}, {2885, 423}, {2886, 423},
+    {2887, 423}, {2888, 423}, {2889, 423}, {2890, 423}, {2891, 423}, {2892, 423}, {2893, 423}, {2894, 423},
+    {2895, 423}, {2896, 423}, {2897, 423}, {2898, 423}, {2899, 423}, {2900, 423}, {2901, 423}, {2902, 423},
+    {2903, 423}, {2904, 423}, {2905, 423}, {2906, 423}, {2907, 423}, {2908, 423}, {2909, 423}, {2910, 423},
+    {334, 530}, {2599, 531}, {533, 532}, {129, 533}, {1504, 534}, {1608, 535}, {1716, 536}, {992, 537},
+    {1096, 538}, {1205, 539}, {1307, 540}, {2205, 541}, {2326, 542}, {2418, 543}, {1819, 793}, {2231, 794},
+    {1887, 795}, {423, 796}, {494, 797}, {1150, 798}, {416, 799}, {1992, 800}, {421, 801}, {2373, 802},
+    {2218, 803}, {89, 804}, {700, 805}, {1745, 806}, {2464, 807}, {625, 808}, {2138, 809}, {1687, 810},
+    {1476, 811}, {1616, 812}, {603, 813}, {123, 814}, {335, 815}, {2671, 816}, {733, 817}, {2321, 818},
+    {2523, 819}, {987, 820}, {357, 821}, {155, 822}, {2428, 823}, {450, 824}, {1860, 825}, {637, 826},
+    {170, 827}, {458, 828}, {2113, 829}, {127, 830}, {718, 831}, {2383, 832}, {2223, 833}, {2285, 834},
+    {2516, 835}, {1697, 836}, {1063, 837}, {168, 838}, {1121, 839}, {281, 840}, {1654, 841}, {2264, 842},
+    {929, 843}, {2512, 844}, {222, 845}, {1816, 846}, {2109, 847}, {933, 848}, {263, 849}, {2178, 850},
+    {2093, 851}, {71, 854}, {261, 855}, {46, 857}, {1365, 858}, {996, 859}, {1469, 862}, {299, 863},
+    {2755, 864}, {411, 865}, {714, 866}, {2391, 867}, {2366, 868}, {2001, 869}, {1976, 870}, {2156, 871},
+    {2154, 872}, {1239, 873}, {818, 874}, {2030, 875}, {1367, 876}, {2643, 877}, {2744, 878}, {1432, 879},
+    {2521, 880}, {285, 881}, {2635, 882}, {903, 883}, {2779, 884}, {2317, 885}, {480, 886}, {1670, 887},
+    {1442, 888}, {2381, 889}, {73, 890}, {2665, 891}, {2568, 892}, {2563, 893}, {2688, 894}, {2495, 895},
+    {938, 896}, {2627, 897}, {1492, 898}, {2046, 899}, {342, 900}, {1430, 901}, {1927, 902}, {1484, 903},
+    {31, 904}, {1777, 905}, {982, 906}, {753, 907}, {2066, 908}, {2546, 909}, {2604, 910}, {702, 911},
+    {2402, 912}, {465, 913}, {2819, 898}, {2817, 899}, {2879, 900}, {1652, 914}, {1323, 915}, {2878, 903},
+    {978, 916}, {2393, 917}, {2876, 906}, {2874, 907}, {2872, 908}, {2645, 918}, {1598, 919}, {246, 920},
+    {2370, 921}, {2845, 899}, {1207, 922}, {2846, 908}, {2844, 907}, {237, 923}, {2847, 900}, {2192, 924},
+    {2850, 906}, {837, 925}, {1002, 926}, {1917, 927}, {427, 928}, {599, 929}, {2518, 930}, {1578, 931},
+    {2345, 932}, {1514, 933}, {161, 934}, {1888, 935}, {1669, 936}, {197, 937}, {1165, 938}, {961, 939},
+    {932, 940}, {2171, 941}, {1020, 942}, {2470, 943}, {1297, 944}, {2760, 949}, {1411, 951}, {2614, 952},
+    {593, 953}, {1851, 954}, {2658, 955}, {844, 956}, {466, 957}, {2296, 958}, {658, 959}, {2394, 960},
+    {2272, 961}, {975, 962}, {2569, 963}, {1739, 964}, {407, 965}, {1204, 966}, {275, 967}, {1636, 968},
+    {1837, 969}, {1094, 970}, {618, 971}, {1058, 972}, {649, 973}, {315, 974}, {1535, 975}, {1761, 976},
+    {1275, 977}, {23, 978}, {2820, 837}, {1041, 979}, {2313, 980}, {2515, 982}, {1241, 983}, {1206, 984},
+    {2654, 985}, {1912, 986}, {2748, 987}, {1357, 988}, {2805, 989}, {834, 990}, {1022, 991}, {2392, 992},
+    {2169, 993}, {664, 994}, {1355, 995}, {1089, 996}, {2014, 997}, {591, 998}, {725, 999}, {1714, 1000},
+    {579, 1001}, {56, 1002}, {1173, 1003}, {588, 1004}, {794, 1005}, {1129, 1006}, {2039, 1007}, {1983, 1008},
+    {704, 1009}, {2065, 1010}, {1026, 1011}, {1579, 1012}, {1248, 1013}, {48, 1014}, {2490, 1015}, {2497, 1016},
+    {2834, 530}, {2833, 531}, {2832, 532}, {2831, 533}, {2830, 534}, {2829, 535}, {2828, 536}, {2827, 537},
+    {2826, 538}, {2825, 539}, {2824, 540}, {2823, 541}, {2822, 542}, {2821, 543}, {1528, 1017}, {1827, 1018},
+    {787, 947}, {2146, 948}, {1021, 981}, {1856, 1019}, {337, 1020}, {665, 1021}, {1433, 1022}, {2089, 1023},
+    {741, 1024}, {1075, 1025}, {687, 1026}, {1118, 1027}, {231, 1028}, {2534, 1029}, {254, 1030}, {2409, 1031},
+    {771, 1041}, {1244, 1032}, {2585, 1033}, {1785, 1042}, {2000, 1034}, {2616, 1035}, {2778, 1043}, {829, 1036},
+    {1817, 1037}, {2776, 1038}, {1342, 1039}, {354, 1040}, {2072, 1044}, {1401, 1045}, {2500, 1046}, {181, 1047},
+    {2806, 1048}, {1919, 1049}, {956, 1050}, {941, 1051}, {388, 1052}, {2421, 1053}, {2647, 1054}, {1362, 1055},
+    {2144, 1056}, {657, 1057}, {2574, 1058}, {676, 1059}, {2051, 1060}, {1068, 1061}, {2789, 1062}, {2074, 1063},
+    {2048, 1064}, {1631, 1065}, {28, 1066}, {116, 1067}, {1042, 1068}, {62, 1069}, {692, 1070}, {2128, 1071},
+    {2333, 1072}, {1309, 1073}, {1759, 1074}, {2302, 1075}, {1632, 1076}, {1102, 1077}, {2722, 1078}, {2715, 1079},
+    {2098, 1080}, {2433, 1081}, {2493, 1082}, {1082, 1083}, {1301, 1084}, {912, 1085}, {17, 1086}, {1699, 1087},
+    {1893, 1088}, {1551, 1089}, {2011, 1090}, {118, 1091}, {1310, 1092}, {2268, 1093}, {2148, 1094}, {1399, 1095},
+    {1760, 1096}, {2632, 1097}, {2228, 1098}, {2198, 1099}, {952, 1100}, {1607, 1101}, {1211, 1102}, {562, 1103},
+    {1985, 1104}, {2544, 1105}, {1580, 1106}, {2312, 1107}, {1475, 1108}, {661, 1109}, {2555, 1110}, {78, 1111},
+    {360, 1112}, {1481, 1113}, {2676, 1114}, {1874, 1115}, {1317, 1116}, {880, 1117}, {2531, 1118}, {426, 1119},
+    {1850, 1120}, {1332, 1121}, {1281, 1122}, {451, 1123}, {2729, 1124}, {2505, 1125}, {136, 1126}, {1485, 1127},
+    {359, 1128}, {2803, 1129}, {919, 1130}, {1975, 1131}, {449, 1132}, {1405, 1133}, {2607, 1134}, {805, 1135},
+    {1015, 1136}, {1279, 1137}, {2283, 1138}, {2063, 1139}, {11, 1140}, {225, 1141}, {88, 1142}, {985, 1143},
+    {1183, 1144}, {1048, 1145}, {2925, 1130}, {214, 1146}, {1589, 1147}, {1097, 1148}, {1717, 1149}, {2458, 1150},
+    {38, 1151}, {191, 1152}, {306, 1153}, {2410, 1154}, {543, 1155}, {2376, 1156}, {2663, 1157}, {614, 1158},
+    {61, 1159}, {460, 1160}, {475, 1161}, {849, 1162}, {1640, 1163}, {297, 1164}, {811, 1165}, {1713, 1166},
+    {1630, 1167}, {1471, 1168}, {1897, 1169}, {743, 1170}, {840, 1171}, {1378, 1172}, {2237, 1173}, {2790, 1174},
+    {748, 1175}, {2034, 1176}, {2290, 1177}, {1515, 1178}, {2071, 1179}, {1170, 1180}, {1812, 1181}, {2341, 1182},
+    {2922, 1090}, {1665, 1183}, {1923, 1184}, {2920, 1089}, {2926, 1094}, {2928, 1095}, {1335, 1185}, {2597, 1186},
+    {2937, 1080}, {1518, 1187}, {1623, 1188}, {331, 1189}, {2936, 1084}, {445, 1190}, {2085, 1191}, {1604, 1192},
+    {406, 1193}, {2934, 1089}, {2932, 1090}, {2931, 1091}, {1257, 1194}, {2930, 1093}, {2928, 1094}, {2926, 1095},
+    {2850, 1064}, {2848, 1065}, {2454, 1195}, {1499, 1196}, {1962, 1197}, {395, 1198}, {2897, 1070}, {253, 1199},
+    {2895, 1072}, {2892, 1073}, {2889, 1074}, {2943, 1075}, {2942, 1076}, {2941, 1077}, {2940, 1078}, {2938, 1079},
+    {2786, 1200}, {1143, 1201}, {2876, 1064}, {2878, 1065}, {2893, 1070}, {2895, 1071}, {512, 1202}, {561, 1203},
+    {1803, 1204}, {2909, 1075}, {2560, 1205}, {2897, 1073}, {1796, 1206}, {2916, 1079}, {2853, 1062}, {2852, 1063},
+    {2859, 981}, {2862, 1032}, {2861, 1033}, {2857, 948}, {2860, 1034}, {2859, 1035}, {2836, 1025}, {2858, 1036},
+    {2857, 1037}, {2856, 1038}, {2855, 1039}, {2854, 1040}, {501, 1207}, {831, 1208}, {870, 1209}, {2832, 947},
+    {1866, 1210}, {1724, 1211}, {2826, 948}, {415, 1212}, {828, 1213}, {50, 1215}, {1077, 1216}, {2362, 1217},
+    {2371, 1218}, {37, 1219}, {2866, 1026}, {2865, 1027}, {1989, 1220}, {1940, 1221}, {2864, 1030}, {2863, 1031},
+    {1521, 1222}, {140, 1223}, {112, 1224}, {341, 1225}, {1480, 1226}, {1220, 1227}, {485, 1228}, {2624, 1229},
+    {2683, 1230}, {1236, 1231}, {663, 1232}, {1523, 1233}, {2368, 1234}, {1723, 1235}, {1071, 1236}, {2444, 1237},
+    {2033, 1238}, {2612, 1239}, {403, 1240}, {1450, 1241}, {101, 1242}, {2419, 1243}, {820, 1244}, {1558, 1245},
+    {1510, 1246}, {2700, 1247}, {2352, 1248}, {632, 1249}, {2734, 1250}, {1916, 1251}, {1603, 1252}, {517, 1253},
+    {1668, 1254}, {1602, 1255}, {364, 1256}, {1541, 1257}, {921, 1258}, {1238, 1259}, {1385, 1260}, {520, 1261},
+    {920, 1262}, {1274, 1263}, {2552, 1264}, {1445, 1265}, {2723, 1266}, {2176, 1267}, {1227, 1268}, {754, 1269},
+    {63, 1270}, {1381, 1271}, {223, 1272}, {2547, 1273}, {1119, 1274}, {2363, 1275}, {937, 1276}, {508, 1277},
+    {2541, 1280}, {401, 1283}, {100, 1282}, {530, 1285}, {413, 1284}, {2774, 1287}, {248, 1305}, {397, 1304},
+    {1675, 1307}, {1409, 1306}, {1605, 1309}, {2592, 1308}, {1959, 1311}, {621, 1310}, {453, 1297}, {2553, 1296},
+    {1107, 1299}, {1656, 1298}, {1298, 1301}, {176, 1300}, {35, 1303}, {2716, 1302}, {1406, 1321}, {744, 1320},
+    {1942, 1323}, {1789, 1322}, {1565, 1325}, {1545, 1324}, {853, 1327}, {1582, 1326}, {1330, 1318}, {1100, 1337},
+    {208, 1338}, {473, 1341}, {2456, 1340}, {344, 1343}, {2431, 1342}, {1007, 1329}, {1256, 1328}, {582, 1331},
+    {1712, 595}, {1782, 606}, {2622, 607}, {1931, 600}, {2452, 601}, {708, 580}, {82, 577}, {2240, 578},
+    {1398, 624}, {553, 625}, {2170, 636}, {2265, 613}, {1146, 614}, {2029, 616}, {589, 708}, {2736, 709},
+    {1913, 706}, {631, 727}, {210, 724}, {2219, 725}, {339, 730}, {1113, 731}, {374, 728}, {660, 743},
+    {2147, 741}, {947, 750}, {2678, 745}, {659, 757}, {1038, 764}, {807, 765}, {1219, 762}, {361, 763},
+    {2189, 760}, {188, 761}, {408, 1344}, {806, 1345}, {139, 1346}, {150, 1347}, {1511, 1348}, {1972, 1349},
+    {1465, 1350}, {175, 1351}, {2670, 1352}, {311, 1353}, {2727, 1354}, {54, 1355}, {1028, 1356}, {2382, 1357},
+    {186, 1358}, {1890, 1359}, {81, 1360}, {2807, 1361}, {1771, 1362}, {2920, 580}, {2919, 577}, {2918, 578},
+    {2103, 1363}, {768, 1364}, {180, 1365}, {366, 1366}, {2486, 1367}, {1863, 1368}, {1567, 1369}, {1392, 1370},
+    {2126, 1371}, {340, 1372}, {1599, 1373}, {2173, 1374}, {1404, 1375}, {2361, 1376}, {2233, 1377}, {1546, 1378},
+    {939, 1379}, {2924, 1341}, {2922, 1340}, {1950, 1380}, {860, 1381}, {2545, 1382}, {2561, 1383}, {2921, 1331},
+    {859, 1384}, {13, 1385}, {1109, 1386}, {59, 1387}, {1990, 1388}, {2892, 1340}, {346, 1389}, {1814, 1390},
+    {1590, 1391}, {2182, 1392}, {1201, 1393}, {1086, 1394}, {1741, 1395}, {1116, 1396}, {1291, 1397}, {556, 1398},
+    {2036, 1399}, {2477, 1400}, {2259, 1401}, {2735, 1402}, {2300, 1403}, {1811, 1404}, {249, 1405}, {2584, 1406},
+    {1960, 1407}, {1423, 544}, {592, 545}, {1534, 546}, {452, 547}, {266, 548}, {867, 552}, {2726, 553},
+    {2105, 554}, {2076, 1408}, {448, 1409}, {557, 1410}, {897, 1411}, {224, 1412}, {2273, 1413}, {117, 1414},
+    {2157, 1415}, {1395, 1416}, {1300, 1417}, {1900, 1418}, {265, 1419}, {752, 1420}, {931, 1421}, {1937, 1422},
+    {98, 1423}, {1503, 1424}, {1526, 1425}, {1949, 1426}, {737, 1427}, {1486, 1428}, {2364, 1429}, {1482, 1430},
+    {1691, 1431}, {2702, 1432}, {1831, 1433}, {1457, 1434}, {1095, 1435}, {2375, 1436}, {536, 1437}, {1461, 1438},
+    {2061, 1439}, {2573, 1440}, {2415, 1441}, {1327, 1442}, {1572, 1444}, {977, 1445}, {1935, 1446}, {2602, 1447},
+    {988, 1448}, {2049, 1449}, {1221, 1450}, {1933, 1451}, {83, 1452}, {738, 1453}, {1186, 1454}, {79, 1455},
+    {2069, 549}, {607, 550}, {2469, 551}, {216, 555}, {2062, 556}, {1581, 557}, {1263, 558}, {1078, 559},
+    {2084, 1443}, {502, 1456}, {2187, 1457}, {2677, 1458}, {2056, 1459}, {1871, 1460}, {142, 1461}, {1348, 1462},
+    {1973, 1463}, {1791, 1464}, {2674, 1465}, {1549, 1466}, {1542, 1467}, {2441, 1468}, {1798, 1469}, {1287, 1470},
+    {36, 1471}, {1725, 1472}, {2307, 1473}, {2787, 1474}, {782, 1475}, {2728, 1476}, {420, 1477}, {1844, 1483},
+    {1597, 1484}, {1304, 1485}, {1246, 1486}, {2699, 1487}, {2593, 1488}, {1944, 1489}, {272, 1490}, {1644, 1493},
+    {441, 1504}, {1154, 1505}, {1964, 1506}, {2102, 1507}, {2164, 1508}, {2407, 1509}, {627, 1513}, {1156, 1515},
+    {1151, 1516}, {2481, 1520}, {2524, 1523}, {781, 1524}, {2123, 1525}, {750, 1526}, {1790, 1527}, {1537, 1528},
+    {706, 1529}, {1127, 1530}, {2355, 560}, {1171, 561}, {1865, 562}, {2253, 563}, {316, 564}, {1313, 565},
+    {1333, 566}, {384, 567}, {803, 568}, {2145, 569}, {711, 570}, {2274, 571}, {535, 1536}, {1223, 1539},
+    {1425, 1538}, {486, 1565}, {824, 1564}, {356, 1567}, {1715, 1566}, {1633, 1561}, {187, 1560}, {2006, 1563},
+    {1996, 1562}, {2122, 1557}, {217, 1556}, {134, 1559}, {85, 1558}, {710, 1553}, {2311, 1552}, {2057, 1555},
+    {1057, 1554}, {2675, 1581}, {1946, 1580}, {2334, 1583}, {698, 1582}, {814, 1577}, {2216, 1576}, {1440, 1579},
+    {2742, 1578}, {1613, 1573}, {292, 1572}, {2689, 1575}, {322, 1574}, {1954, 1569}, {1352, 1568}, {1869, 1571},
+    {1997, 1570}, {4, 1597}, {1336, 1596}, {135, 1599}, {1053, 1598}, {2527, 1593}, {2417, 1592}, {742, 1595},
+    {2768, 1594}, {1108, 1589}, {2396, 1588}, {2118, 1591}, {1834, 1585}, {1592, 1584}, {1809, 1587}, {688, 1586},
+    {2378, 1600}, {1372, 1601}, {1873, 1602}, {1292, 1603}, {2045, 1604}, {2095, 1605}, {1885, 1607}, {2018, 1608},
+    {3260, 1594}, {3258, 1589}, {3256, 1588}, {674, 1609}, {1626, 1610}, {3253, 1584}, {3251, 1587}, {2697, 1611},
+    {156, 1612}, {1909, 1613}, {199, 1614}, {64, 1615}, {2054, 1616}, {109, 1617}, {2487, 1618}, {888, 1619},
+    {3238, 1588}, {2472, 1620}, {3234, 1594}, {3236, 1589}, {3243, 1587}, {1277, 1621}, {3240, 1585}, {3241, 1584},
+    {1666, 1622}, {3204, 1597}, {3203, 1596}, {3202, 1599}, {3201, 1598}, {3200, 1593}, {3263, 1592}, {3262, 1595},
+    {564, 1623}, {3213, 1557}, {3212, 1556}, {3211, 1559}, {3210, 1558}, {3209, 1553}, {1910, 1624}, {3208, 1555},
+    {3207, 1554}, {2270, 1625}, {1351, 1626}, {148, 1627}, {2292, 1628}, {2426, 1629}, {2287, 1630}, {3205, 1579},
+    {858, 1631}, {2706, 1632}, {2174, 1633}, {400, 1634}, {2225, 1635}, {1255, 1636}, {813, 1637}, {1101, 1638},
+    {2318, 1639}, {1710, 1640}, {2429, 1641}, {1443, 1642}, {983, 1643}, {3225, 1579}, {2213, 1644}, {808, 1645},
+    {1792, 1646}, {1784, 1647}, {2692, 1648}, {2002, 1649}, {2462, 1651}, {727, 1652}, {1941, 1653}, {1858, 1654},
+    {1595, 1658}, {2005, 1659}, {926, 1660}, {444, 1661}, {1446, 1662}, {2615, 1663}, {628, 1664}, {2450, 1665},
+    {3214, 1484}, {2247, 1666}, {701, 1667}, {610, 1668}, {2185, 1669}, {2114, 1670}, {258, 1671}, {842, 1672},
+    {67, 1673}, {482, 1674}, {312, 1675}, {2461, 1676}, {2294, 1677}, {1353, 1678}, {2304, 1679}, {53, 1680},
+    {2942, 551}, {3200, 555}, {2938, 549}, {2940, 550}, {3205, 558}, {1611, 1681}, {235, 1682}, {3203, 557},
+    {2416, 1683}, {3215, 1472}, {3208, 1443}, {1657, 1684}, {3212, 1461}, {3214, 1462}, {1087, 1685}, {3210, 1460},
+    {2916, 549}, {2914, 550}, {2912, 551}, {3230, 555}, {3229, 556}, {3227, 557}, {3225, 558}, {3224, 559},
+    {3222, 1443}, {2549, 1686}, {1502, 1687}, {2639, 1688}, {2096, 1689}, {3220, 1460}, {3218, 1461}, {3216, 1462},
+    {2058, 1690}, {669, 1691}, {454, 1692}, {92, 1693}, {1943, 1694}, {2707, 1695}, {630, 1696}, {802, 1697},
+    {1474, 1698}, {268, 1701}, {597, 1702}, {328, 1703}, {559, 1704}, {651, 1705}, {2282, 1706}, {1584, 1710},
+    {1904, 1711}, {600, 1712}, {2488, 1713}, {2655, 1714}, {2772, 1715}, {2155, 1716}, {2190, 1717}, {2572, 1718},
+    {2610, 1719}, {33, 1720}, {596, 1721}, {1696, 1722}, {2533, 1723}, {523, 1724}, {173, 1725}, {821, 1726},
+    {1527, 1727}, {703, 1728}, {2613, 1729}, {514, 1730}, {518, 1731}, {2634, 1732}, {1588, 1733}, {773, 1734},
+    {1898, 1735}, {2628, 1736}, {457, 1737}, {516, 1738}, {412, 1741}, {2351, 1742}, {2332, 1743}, {615, 1744},
+    {1566, 1745}, {1393, 1746}, {2167, 1747}, {2501, 1748}, {1828, 1749}, {201, 1750}, {1497, 1751}, {375, 1752},
+    {330, 1753}, {2725, 1754}, {164, 1755}, {1543, 1756}, {1849, 1757}, {1164, 1758}, {958, 1759}, {2315, 1760},
+    {1468, 1761}, {114, 1762}, {2733, 1763}, {749, 1764}, {8, 1765}, {761, 1766}, {918, 1767}, {2281, 1768},
+    {27, 1769}, {2753, 1770}, {368, 1771}, {1213, 1772}, {1214, 1773}, {959, 1774}, {1178, 1775}, {1650, 1776},
+    {2775, 1777}, {866, 1778}, {585, 1779}, {924, 1780}, {2701, 1781}, {1137, 1782}, {1192, 1783}, {2314, 1784},
+    {119, 1785}, {604, 1786}, {1290, 1787}, {70, 1788}, {1921, 1789}, {667, 1790}, {1452, 1791}, {848, 591},
+    {2129, 590}, {439, 589}, {15, 588}, {1822, 583}, {2316, 582}, {1709, 581}, {2060, 732}, {1945, 733},
+    {2010, 716}, {1703, 717}, {2244, 718}, {2686, 719}, {570, 712}, {1033, 713}, {3302, 486}, {3301, 488},
+    {3300, 490}, {3307, 492}, {3306, 496}, {3305, 498}, {3304, 503}, {3311, 517}, {3310, 573}, {3309, 575},
+    {3308, 585}, {3315, 587}, {3306, 592}, {3248, 593}, {3299, 594}, {3291, 596}, {3283, 597}, {3275, 598},
+    {3267, 599}, {3284, 1521}, {3294, 1531}, {3293, 1532}, {3292, 1533}, {3302, 1534}, {3301, 1535}, {3300, 1491},
+    {3310, 1492}, {3309, 1495}, {3308, 1478}, {3318, 1479}, {3317, 1480}, {3316, 2032}, {3326, 2033}, {3325, 2034},
+    {3324, 2035}, {3079, 2036}, {3078, 2037}, {3077, 2038}, {3076, 2039}, {3075, 2040}, {3074, 2041}, {3073, 2042},
+    {3072, 2043}, {3087, 2044}, {3086, 2045}, {3077, 1994}, {3076, 1922}, {3073, 1937}, {3074, 1923}, {3075, 1942},
+    {3072, 1924}, {3103, 1927}, {3100, 1944}, {3101, 1930}, {3100, 1940}, {3099, 1931}, {3098, 1939}, {3097, 1932},
+    {3096, 2287}, {3093, 2275}, {3096, 2290}, {3095, 2272}, {3092, 2278}, {3091, 2298}, {3090, 2299}, {3089, 2302},
+    {3088, 2303}, {3119, 2273}, {3118, 2274}, {3117, 2276}, {3116, 2277}, {3115, 2279}, {3114, 2280}, {3113, 2281},
+    {3112, 2282}, {3111, 2283}, {3110, 2270}, {3109, 2271}, {3110, 2258}, {3107, 2240}, {3104, 2259}, {3105, 2241},
+    {3249, 1745}, {3248, 1746}, {3247, 1747}, {3246, 1748}, {3245, 1749}, {3243, 1750}, {3241, 1751}, {3239, 1752},
+    {3237, 1753}, {3235, 1754}, {3233, 1755}, {3295, 1756}, {3293, 1757}, {3106, 2260}, {3135, 2246}, {3132, 2261},
+    {3133, 2248}, {3134, 2267}, {3245, 1745}, {3131, 2249}, {3253, 1751}, {3255, 1752}, {3130, 2250}, {3251, 1750},
+    {3261, 1755}, {3263, 1756}, {3257, 1753}, {3259, 1754}, {3268, 1759}, {3131, 2265}, {3265, 1757}, {3267, 1758},
+    {3128, 2251}, {3127, 2252}, {3126, 2253}, {3125, 2254}, {3126, 2269}, {3123, 2255}, {3122, 2224}, {3121, 2228},
+    {3122, 2219}, {3151, 2233}, {3148, 2216}, {3149, 2234}, {3148, 2235}, {3147, 2237}, {3144, 2220}, {3145, 2238},
+    {3146, 2221}, {3143, 2239}, {3142, 2178}, {3141, 2473}, {3140, 2485}, {3139, 2474}, {3138, 2479}, {3137, 2453},
+    {3136, 2454}, {3167, 2455}, {3164, 2786}, {3165, 2800}, {3166, 2787}, {3163, 2801}, {3160, 2784}, {3161, 2802},
+    {3162, 2785}, {3159, 2803}, {3158, 2804}, {3159, 2791}, {3156, 2805}, {3153, 2788}, {3154, 2806}, {3153, 2807},
+    {3154, 2794}, {3183, 2808}, {3180, 2799}, {3181, 2813}, {3182, 2796}, {3179, 2814}, {3176, 2797}, {3177, 2815},
+    {3176, 2793}, {3175, 2768}, {3174, 2721}, {3173, 2722}, {3172, 2723}, {3171, 2724}, {3170, 2725}, {3169, 2727},
+    {3168, 2728}, {3197, 2749}, {3198, 2735}, {3197, 2713}, {3196, 2714}, {3195, 2715}, {3194, 2716}, {3193, 2717},
+    {3192, 2718}, {3191, 2719}, {3188, 2706}, {3189, 2688}, {3190, 2707}, {3187, 2689}, {3184, 2704}, {3185, 2690},
+    {3186, 2710}, {3469, 2711}, {3470, 2693}, {3471, 2708}, {3468, 2694}, {3465, 3026}, {3466, 3008}, {3465, 3009},
+    {3464, 3010}, {3463, 3011}, {3462, 3012}, {3463, 3031}, {3460, 3013}, {3457, 3028}, {3458, 3014}, {3459, 3029},
+    {3456, 3015}, {3485, 3034}, {3486, 3016}, {3487, 3035}, {3484, 3017}, {3481, 3032}, {3482, 3018}, {3483, 3033},
+    {3480, 3019}, {3477, 3038}, {3478, 3020}, {3479, 3039}, {3478, 3036}, {3356, 2926}, {3357, 2927}, {3358, 2928},
+    {3359, 2929}, {3360, 2930}, {3361, 2931}, {3362, 2932}, {3363, 2933}, {3364, 2934}, {3365, 2935}, {3366, 2936},
+    {3367, 2937}, {3368, 2938}, {3501, 2939}, {3552, 2945}, {3371, 2938}, {3372, 2938}, {3369, 2938}, {3370, 2938},
+    {3374, 2940}, {3526, 2946}, {3366, 2947}, {3338, 2948}, {3378, 2940}, {3377, 2940}, {3376, 2940}, {3375, 2940},
+    {3379, 2941}, {3333, 2949}, {3377, 2950}, {3398, 2951}, {3383, 2941}, {3382, 2941}, {3381, 2941}, {3380, 2941},
+    {3384, 2942}, {3440, 2952}, {3436, 2953}, {3537, 2954}, {3388, 2942}, {3387, 2942}, {3386, 2942}, {3385, 2942},
+    {3389, 2943}, {3754, 2955}, {3718, 2956}, {3814, 2957}, {3393, 2943}, {3392, 2943}, {3391, 2943}, {3390, 2943},
+    {3394, 2944}, {3782, 2958}, {3573, 2959}, {3622, 2960}, {3398, 2944}, {3397, 2944}, {3396, 2944}, {3395, 2944},
+    {3563, 2961}, {3750, 2962}, {3590, 2963}, {3686, 2964}, {3773, 2965}, {3715, 2966}, {3337, 2967}, {3583, 2968},
+    {3342, 2969}, {3419, 2970}, {3766, 2971}, {3834, 2972}, {3506, 2973}, {3802, 2974}, {3505, 2975}, {3642, 2976},
+    {3609, 2977}, {3511, 2978}, {3706, 2979}, {3513, 2980}, {3675, 2981}, {3516, 2982}, {3667, 2983}, {3456, 2984},
+    {3460, 2985}, {3520, 2986}, {3486, 2987}, {3473, 2988}, {3659, 2989}, {3651, 2990}, {4027, 2991}, {4019, 2992},
+    {4011, 2993}, {4003, 2994}, {3995, 2995}, {3987, 2996}, {3979, 2997}, {3971, 2998}, {4091, 2999}, {4083, 3000},
+    {4075, 3001}, {4067, 3002}, {4059, 3003}, {3424, 3004}, {4051, 3005}, {3395, 3006}, {4043, 3007}, {3476, 3021},
+    {4035, 3022}, {3486, 3023}, {3899, 3024}, {3430, 3025}, {3891, 3027}, {3883, 3030}, {3429, 3037}, {3875, 3040},
+    {3867, 3041}, {3859, 3042}, {3851, 3043}, {3435, 3044}, {3843, 3045}, {3963, 3046}, {3955, 3047}, {3438, 3048},
+    {3947, 3049}, {3397, 3050}, {3939, 3051}, {3931, 3052}, {3923, 3053}, {3400, 3054}, {3915, 3055}, {3401, 3056},
+    {3907, 3057}, {4283, 3058}, {4275, 3059}, {3406, 3060}, {4267, 3061}, {4259, 3062}, {4251, 3063}, {4243, 3064},
+    {4235, 3065}, {3404, 3066}, {4227, 3067}, {3410, 3068}, {4347, 3069}, {3414, 3070}, {4339, 3071}, {3412, 3072},
+    {4331, 3073}, {4323, 3074}, {3419, 3075}, {4315, 3076}, {3417, 3077}, {4307, 3078}, {4299, 3079}, {3363, 3080},
+    {4291, 3081}, {3370, 3082}, {4155, 3083}, {3369, 3084}, {4147, 3085}, {3372, 3086}, {4139, 3087}, {4131, 3088},
+    {4123, 3089}, {4115, 3090}, {4107, 3091}, {4099, 3092}, {4219, 3093}, {4211, 3094}, {4203, 3095}, {4195, 3096},
+    {3373, 3097}, {4187, 3098}, {4179, 3099}, {4171, 3100}, {4163, 3101}, {4539, 3102}, {4531, 3103}, {4523, 3104},
+    {4515, 3105}, {3379, 3106}, {4507, 3107}, {3380, 3108}, {4499, 3109}, {3381, 3110}, {4491, 3111}, {3387, 3112},
+    {3390, 3113}, {4483, 3114}, {3328, 3115}, {4603, 3116}, {3347, 3117}, {4595, 3118}, {4587, 3119}, {4579, 3120},
+    {4571, 3121}, {4563, 3122}, {3334, 3123}, {4555, 3124}, {3335, 3125}, {4547, 3126}, {3332, 3127}, {4411, 3128},
+    {3340, 3129}, {4403, 3130}, {3344, 3131}, {4395, 3132}, {3348, 3133}, {4387, 3134}, {3355, 3135}, {4379, 3136},
+    {3353, 3137}, {4371, 3138}, {3811, 3139}, {3826, 3140}, {2013, 3141}, {1105, 3142}, {152, 3143}, {264, 3144},
+    {352, 3145}, {456, 3146}, {2564, 3147}, {2652, 3148}, {2758, 3149}, {57, 3150}, {2140, 3151}, {2255, 3152},
+    {865, 3153}, {1280, 3158}, {291, 3159}, {169, 3156}, {967, 3157}, {3742, 3154}, {1286, 3160}, {1915, 3167},
+    {2380, 3166}, {107, 3165}, {2239, 3164}, {1232, 3168}, {2554, 3175}, {1505, 3174}, {2765, 3173}, {1230, 3172},
+    {1000, 3176}, {1708, 3183}, {1648, 3182}, {1009, 3181}, {691, 3180}, {2625, 3184}, {602, 3191}, {2406, 3190},
+    {1153, 3189}, {6, 3188}, {788, 3192}, {499, 3199}, {633, 3198}, {1163, 3197}, {798, 3196}, {4123, 3194},
+    {3623, 3155}, {3626, 3155}, {3628, 3155}, {3634, 3155}, {3635, 3155}, {4163, 3200}, {3636, 3155}, {4323, 3207},
+    {4488, 3212}, {3637, 3155}, {3639, 3155}, {4536, 3214}, {3642, 3155}, {4514, 3217}, {3643, 3155}, {3650, 3155},
+    {3651, 3155}, {3656, 3155}, {3657, 3155}, {4546, 3219}, {3682, 3155}, {3683, 3155}, {4554, 3221}, {3689, 3155},
+    {3691, 3161}, {3695, 3161}, {4578, 3223}, {3963, 3179}, {3970, 3179}, {3969, 3179}, {4594, 3224}, {4481, 3225},
+    {3706, 3161}, {3707, 3161}, {3702, 3161}, {3704, 3161}, {3700, 3161}, {3701, 3161}, {4588, 3226}, {3696, 3161},
+    {3715, 3161}, {3720, 3161}, {3714, 3161}, {4601, 3227}, {3710, 3161}, {3711, 3161}, {4747, 3247}, {3709, 3161},
+    {3730, 3161}, {3731, 3161}, {3728, 3161}, {3962, 3179}, {4737, 3249}, {3727, 3161}, {3721, 3161}, {3726, 3161},
+    {3737, 3162}, {3857, 3170}, {4762, 3243}, {3858, 3170}, {4743, 3251}, {3859, 3170}, {3865, 3170}, {4784, 3254},
+    {3760, 3162}, {4775, 3259}, {3747, 3162}, {3757, 3162}, {4823, 3263}, {3741, 3162}, {3739, 3162}, {3740, 3162},
+    {4766, 3243}, {3788, 3162}, {3779, 3162}, {3784, 3162}, {3772, 3162}, {3778, 3162}, {3763, 3162}, {3770, 3162},
+    {3804, 3162}, {3806, 3162}, {3800, 3162}, {3803, 3162}, {3792, 3162}, {3795, 3162}, {3851, 3170}, {3850, 3170},
+    {3809, 3163}, {4755, 3245}, {4321, 3206}, {3826, 3169}, {4329, 3208}, {3811, 3163}, {3810, 3163}, {4813, 3265},
+    {3835, 3169}, {3834, 3169}, {4861, 3269}, {4851, 3271}, {4858, 3275}, {3827, 3169}, {4670, 3281}, {3833, 3169},
+    {4657, 3283}, {4322, 3206}, {3841, 3169}, {4757, 3245}, {4656, 3285}, {3825, 3163}, {4659, 3287}, {4330, 3208},
+    {3818, 3163}, {4641, 3290}, {3817, 3163}, {4640, 3292}, {3843, 3169}, {3842, 3169}, {3819, 3163}, {3849, 3169},
+    {3915, 3177}, {4700, 3295}, {3921, 3177}, {3922, 3177}, {3931, 3178}, {3937, 3178}, {3938, 3178}, {3923, 3177},
+    {4703, 3297}, {3929, 3177}, {3930, 3177}, {4702, 3299}, {3735, 3160}, {3746, 3167}, {4691, 3301}, {5031, 3312},
+    {3750, 3164}, {5118, 3321}, {3747, 3166}, {3748, 3165}, {3955, 3178}, {3961, 3178}, {5108, 3323}, {5098, 3325},
+    {3947, 3178}, {5088, 3327}, {3953, 3178}, {3954, 3178}, {5091, 3328}, {3939, 3178}, {3945, 3178}, {3946, 3178},
+    {3866, 3171}, {3867, 3171}, {4889, 3330}, {4894, 3332}, {4906, 3338}, {4909, 3340}, {4908, 3342}, {4338, 3209},
+    {3883, 3171}, {4337, 3209}, {3881, 3171}, {3882, 3171}, {3874, 3171}, {3875, 3171}, {4911, 3344}, {3873, 3171},
+    {3898, 3171}, {3899, 3171}, {4910, 3346}, {3897, 3171}, {3890, 3171}, {3891, 3171}, {4897, 3348}, {3889, 3171},
+    {3914, 3171}, {4896, 3350}, {3913, 3171}, {4899, 3352}, {3907, 3171}, {4331, 3209}, {3905, 3171}, {3906, 3171},
+    {3971, 3185}, {4898, 3354}, {4298, 3204}, {4297, 3204}, {3979, 3185}, {4291, 3204}, {3977, 3185}, {3978, 3185},
+    {4347, 3210}, {4353, 3210}, {4345, 3210}, {4346, 3210}, {4169, 3201}, {4339, 3210}, {4290, 3204}, {4289, 3204},
+    {4901, 3355}, {4283, 3204}, {4170, 3201}, {4959, 3373}, {3995, 3185}, {4001, 3185}, {3994, 3185}, {4915, 3532},
+    {3985, 3185}, {3986, 3185}, {4178, 3201}, {4282, 3204}, {4177, 3201}, {3993, 3185}, {4171, 3201}, {3987, 3185},
+    {4002, 3186}, {4003, 3186}, {4914, 3533}, {4957, 3538}, {4956, 3539}, {4299, 3205}, {4953, 3536}, {2291, 3400},
+    {4010, 3186}, {4306, 3205}, {835, 3401}, {4305, 3205}, {1980, 3402}, {4313, 3205}, {4009, 3186}, {4307, 3205},
+    {4314, 3205}, {4017, 3186}, {2528, 3403}, {1738, 3404}, {1157, 3406}, {758, 3409}, {4011, 3186}, {1801, 3410},
+    {4027, 3186}, {4315, 3205}, {2798, 3412}, {348, 3414}, {4025, 3186}, {4026, 3186}, {4018, 3186}, {4019, 3186},
+    {4033, 3187}, {4354, 3211}, {1587, 3415}, {1763, 3416}, {4362, 3211}, {4363, 3211}, {4355, 3211}, {4361, 3211},
+    {2131, 3417}, {1155, 3418}, {4043, 3187}, {4049, 3187}, {4041, 3187}, {4042, 3187}, {4034, 3187}, {4035, 3187},
+    {4066, 3187}, {4067, 3187}, {4059, 3187}, {4065, 3187}, {4057, 3187}, {4058, 3187}, {4050, 3187}, {4051, 3187},
+    {4089, 3187}, {4090, 3187}, {4082, 3187}, {4083, 3187}, {4075, 3187}, {4081, 3187}, {4073, 3187}, {4074, 3187},
+    {4091, 3193}, {4370, 3213}, {2548, 3420}, {640, 3421}, {4378, 3213}, {4379, 3213}, {4371, 3213}, {4377, 3213},
+    {4106, 3193}, {1384, 3423}, {4105, 3193}, {1911, 3424}, {4098, 3193}, {4099, 3193}, {4097, 3193}, {1586, 3425},
+    {1074, 3439}, {4115, 3193}, {4113, 3193}, {4114, 3193}, {1449, 3436}, {791, 3437}, {16, 3434}, {4107, 3193},
+    {363, 3435}, {4122, 3193}, {1643, 3432}, {2754, 3433}, {4121, 3193}, {1169, 3447}, {387, 3444}, {2769, 3445},
+    {4129, 3195}, {4386, 3215}, {1198, 3442}, {283, 3440}, {4394, 3215}, {4395, 3215}, {4387, 3215}, {4393, 3215},
+    {2591, 3441}, {793, 3454}, {4137, 3195}, {4138, 3195}, {4130, 3195}, {4131, 3195}, {1325, 3455}, {481, 3453},
+    {293, 3450}, {4153, 3195}, {1014, 3448}, {1296, 3449}, {4146, 3195}, {4147, 3195}, {4139, 3195}, {4145, 3195},
+    {4162, 3195}, {226, 3456}, {4161, 3195}, {1416, 3470}, {438, 3471}, {1326, 3469}, {4154, 3195}, {4155, 3195},
+    {4179, 3202}, {4185, 3202}, {4401, 3216}, {1755, 3466}, {4403, 3216}, {4402, 3216}, {4410, 3216}, {4409, 3216},
+    {4201, 3202}, {4202, 3202}, {4194, 3202}, {4195, 3202}, {4193, 3202}, {611, 3467}, {4186, 3202}, {4187, 3202},
+    {491, 3464}, {4218, 3202}, {4217, 3202}, {594, 3478}, {4210, 3202}, {4211, 3202}, {4203, 3202}, {4209, 3202},
+    {4233, 3202}, {4234, 3202}, {1671, 3479}, {4227, 3202}, {1645, 3476}, {4226, 3202}, {4219, 3202}, {4225, 3202},
+    {4235, 3203}, {4417, 3218}, {1040, 3477}, {2474, 3474}, {4427, 3218}, {4433, 3218}, {4419, 3218}, {4425, 3218},
+    {1483, 3475}, {4251, 3203}, {4249, 3203}, {4250, 3203}, {1914, 3473}, {4243, 3203}, {4241, 3203}, {4242, 3203},
+    {680, 3484}, {4267, 3203}, {4266, 3203}, {2401, 3485}, {4259, 3203}, {4265, 3203}, {4257, 3203}, {4258, 3203},
+    {1410, 3482}, {4281, 3203}, {4275, 3203}, {1766, 3483}, {2050, 3480}, {4274, 3203}, {826, 3481}, {4273, 3203},
+    {4434, 3220}, {1512, 3488}, {1402, 3494}, {506, 3493}, {4443, 3220}, {4442, 3220}, {4441, 3220}, {4435, 3220},
+    {4449, 3222}, {1066, 3514}, {905, 3512}, {827, 3518}, {4465, 3222}, {4459, 3222}, {4457, 3222}, {4451, 3222},
+    {4474, 3228}, {1746, 3509}, {2017, 3491}, {899, 3501}, {4497, 3228}, {4490, 3228}, {4482, 3228}, {4475, 3228},
+    {4498, 3229}, {693, 3503}, {864, 3497}, {2788, 3496}, {4514, 3229}, {4507, 3229}, {4506, 3229}, {4505, 3229},
+    {4522, 3230}, {1685, 3506}, {2303, 3517}, {105, 3516}, {4534, 3230}, {4533, 3230}, {4532, 3230}, {4530, 3230},
+    {4535, 3231}, {1870, 3519}, {2422, 3487}, {1734, 3486}, {4542, 3231}, {4541, 3231}, {4540, 3231}, {4538, 3231},
+    {4543, 3232}, {1158, 3457}, {1930, 3459}, {979, 3461}, {4549, 3232}, {4548, 3232}, {4547, 3232}, {4546, 3232},
+    {4550, 3233}, {1085, 3462}, {2133, 3552}, {1797, 3553}, {4557, 3233}, {4556, 3233}, {4554, 3233}, {4551, 3233},
+    {4558, 3234}, {447, 3567}, {1136, 3564}, {1564, 3565}, {4562, 3234}, {4561, 3234}, {4560, 3234}, {4559, 3234},
+    {4563, 3235}, {841, 3562}, {1467, 3563}, {1662, 3560}, {4567, 3235}, {4566, 3235}, {4565, 3235}, {4564, 3235},
+    {4568, 3236}, {39, 3575}, {846, 3572}, {1407, 3573}, {4572, 3236}, {4571, 3236}, {4570, 3236}, {4569, 3236},
+    {4573, 3237}, {1907, 3571}, {2241, 3568}, {1222, 3569}, {4577, 3237}, {4576, 3237}, {4575, 3237}, {4574, 3237},
+    {4578, 3238}, {329, 3582}, {1419, 3583}, {1854, 3580}, {4582, 3238}, {4581, 3238}, {4580, 3238}, {4579, 3238},
+    {4583, 3239}, {1422, 3578}, {1861, 3576}, {2558, 3520}, {4587, 3239}, {4586, 3239}, {4585, 3239}, {4584, 3239},
+    {4588, 3240}, {125, 3522}, {1271, 3523}, {1437, 3527}, {4594, 3240}, {4591, 3240}, {4590, 3240}, {4589, 3240},
+    {4595, 3241}, {206, 3529}, {474, 3530}, {2242, 3524}, {4599, 3241}, {4598, 3241}, {4597, 3241}, {4596, 3241},
+    {4602, 3242}, {638, 3525}, {1936, 3526}, {887, 3549}, {4607, 3242}, {4606, 3242}, {4605, 3242}, {4604, 3242},
+    {4610, 3244}, {759, 3550}, {1838, 3551}, {1601, 3544}, {4616, 3244}, {4613, 3244}, {4612, 3244}, {4611, 3244},
+    {4619, 3246}, {2092, 3546}, {2608, 3547}, {696, 3540}, {4625, 3246}, {4624, 3246}, {4621, 3246}, {4620, 3246},
+    {4627, 3248}, {1167, 3541}, {159, 3451}, {1596, 3427}, {4631, 3248}, {4630, 3248}, {4629, 3248}, {4628, 3248},
+    {4633, 3250}, {2245, 3429}, {843, 3428}, {1463, 3584}, {4637, 3250}, {4636, 3250}, {4635, 3250}, {4634, 3250},
+    {4639, 3252}, {1152, 3590}, {1805, 3591}, {2661, 3588}, {4643, 3252}, {4642, 3252}, {4641, 3252}, {4640, 3252},
+    {4644, 3253}, {295, 3608}, {1035, 3609}, {541, 3615}, {4648, 3253}, {4647, 3253}, {4646, 3253}, {4645, 3253},
+    {4650, 3255}, {1334, 3613}, {540, 3606}, {1554, 3604}, {4654, 3255}, {4653, 3255}, {4652, 3255}, {4651, 3255},
+    {4655, 3256}, {1658, 3605}, {220, 3616}, {1043, 3617}, {4659, 3256}, {4658, 3256}, {4657, 3256}, {4656, 3256},
+    {4660, 3257}, {1302, 3630}, {1128, 3624}, {2135, 3638}, {4664, 3257}, {4663, 3257}, {4662, 3257}, {4661, 3257},
+    {4665, 3258}, {2440, 3633}, {2250, 3646}, {1218, 3647}, {4669, 3258}, {4668, 3258}, {4667, 3258}, {4666, 3258},
+    {4671, 3260}, {957, 3644}, {2305, 3645}, {66, 3640}, {4675, 3260}, {4674, 3260}, {4673, 3260}, {4672, 3260},
+    {4676, 3261}, {2557, 3648}, {227, 3662}, {2260, 3663}, {4680, 3261}, {4679, 3261}, {4678, 3261}, {4677, 3261},
+    {4681, 3262}, {1319, 3660}, {145, 3661}, {2809, 3658}, {4685, 3262}, {4684, 3262}, {4683, 3262}, {4682, 3262},
+    {4687, 3264}, {242, 3659}, {1906, 3670}, {1663, 3671}, {4691, 3264}, {4690, 3264}, {4689, 3264}, {4688, 3264},
+    {4693, 3266}, {404, 3668}, {2797, 3669}, {1948, 3666}, {4697, 3266}, {4696, 3266}, {4695, 3266}, {4694, 3266},
+    {4698, 3267}, {2508, 3667}, {111, 3664}, {274, 3665}, {4702, 3267}, {4701, 3267}, {4700, 3267}, {4699, 3267},
+    {4703, 3268}, {2251, 3678}, {2184, 3679}, {1439, 3676}, {4707, 3268}, {4706, 3268}, {4705, 3268}, {4704, 3268},
+    {4709, 3270}, {1676, 3677}, {1609, 3674}, {2603, 3675}, {4713, 3270}, {4712, 3270}, {4711, 3270}, {4710, 3270},
+    {4715, 3272}, {721, 3672}, {294, 3673}, {230, 3680}, {4719, 3272}, {4718, 3272}, {4717, 3272}, {4716, 3272},
+    {4720, 3273}, {685, 3694}, {2295, 3692}, {2800, 3693}, {4724, 3273}, {4723, 3273}, {4722, 3273}, {4721, 3273},
+    {4725, 3274}, {906, 3690}, {2224, 3688}, {1539, 3703}, {4729, 3274}, {4728, 3274}, {4727, 3274}, {4726, 3274},
+    {4731, 3276}, {149, 3698}, {493, 3699}, {1770, 3697}, {4735, 3276}, {4734, 3276}, {4733, 3276}, {4732, 3276},
+    {4736, 3277}, {1896, 3708}, {763, 3705}, {233, 3399}, {4742, 3277}, {4739, 3277}, {4738, 3277}, {4737, 3277},
+    {4744, 3278}, {817, 3712}, {1375, 3724}, {2442, 3725}, {4755, 3278}, {4754, 3278}, {4753, 3278}, {4752, 3278},
+    {4756, 3279}, {269, 3722}, {1191, 3723}, {994, 3734}, {4760, 3279}, {4759, 3279}, {4758, 3279}, {4757, 3279},
+    {4762, 3280}, {2204, 3735}, {1315, 3732}, {483, 3733}, {4774, 3280}, {4773, 3280}, {4772, 3280}, {4763, 3280},
+    {4864, 3282}, {414, 3729}, {1202, 3742}, {1259, 3743}, {4868, 3282}, {4867, 3282}, {4866, 3282}, {4865, 3282},
+    {4869, 3284}, {2021, 3738}, {857, 3736}, {2108, 3405}, {4873, 3284}, {4872, 3284}, {4871, 3284}, {4870, 3284},
+    {4874, 3286}, {1680, 3596}, {2275, 3602}, {1013, 3614}, {4878, 3286}, {4877, 3286}, {4876, 3286}, {4875, 3286},
+    {4879, 3288}, {2566, 3612}, {1610, 3610}, {1868, 3744}, {4883, 3288}, {4882, 3288}, {4881, 3288}, {4880, 3288},
+    {4779, 3289}, {2230, 3745}, {1016, 3758}, {2359, 3759}, {4790, 3289}, {4783, 3289}, {4782, 3289}, {4780, 3289},
+    {4884, 3291}, {1612, 3756}, {2329, 3754}, {877, 3755}, {4888, 3291}, {4887, 3291}, {4886, 3291}, {4885, 3291},
+    {4889, 3293}, {935, 3752}, {545, 3753}, {1312, 3766}, {4893, 3293}, {4892, 3293}, {4891, 3293}, {4890, 3293},
+    {4796, 3294}, {1635, 3767}, {1453, 3764}, {538, 3765}, {4804, 3294}, {4799, 3294}, {4798, 3294}, {4797, 3294},
+    {4894, 3296}, {472, 3762}, {584, 3761}, {1882, 3774}, {4898, 3296}, {4897, 3296}, {4896, 3296}, {4895, 3296},
+    {4899, 3298}, {881, 3775}, {1571, 3773}, {279, 3771}, {4903, 3298}, {4902, 3298}, {4901, 3298}, {4900, 3298},
+    {4904, 3300}, {238, 3768}, {2520, 3769}, {1762, 3776}, {4908, 3300}, {4907, 3300}, {4906, 3300}, {4905, 3300},
+    {4909, 3302}, {2503, 3790}, {1329, 3791}, {898, 3789}, {4913, 3302}, {4912, 3302}, {4911, 3302}, {4910, 3302},
+    {4811, 3303}, {103, 3786}, {1264, 3787}, {479, 3785}, {4818, 3303}, {4817, 3303}, {4816, 3303}, {4813, 3303},
+    {4819, 3304}, {969, 3798}, {2214, 3799}, {1328, 3796}, {4823, 3304}, {4822, 3304}, {4821, 3304}, {4820, 3304},
+    {4824, 3305}, {2134, 3797}, {1427, 3794}, {2330, 3793}, {4828, 3305}, {4827, 3305}, {4826, 3305}, {4825, 3305},
+    {4830, 3306}, {780, 3807}, {2590, 3805}, {2738, 3802}, {4836, 3306}, {4835, 3306}, {4834, 3306}, {4831, 3306},
+    {4837, 3307}, {470, 3801}, {178, 3611}, {636, 3601}, {4845, 3307}, {4844, 3307}, {4843, 3307}, {4840, 3307},
+    {4848, 3308}, {490, 3599}, {1679, 3598}, {889, 3589}, {4859, 3308}, {4858, 3308}, {4857, 3308}, {4856, 3308},
+    {4860, 3309}, {2166, 3587}, {1733, 3586}, {43, 3621}, {4915, 3309}, {4914, 3309}, {4863, 3309}, {4862, 3309},
+    {4916, 3310}, {902, 3627}, {764, 3625}, {1700, 3631}, {4920, 3310}, {4919, 3310}, {4918, 3310}, {4917, 3310},
+    {4921, 3311}, {2737, 3629}, {1226, 3632}, {619, 3641}, {4925, 3311}, {4924, 3311}, {4923, 3311}, {4922, 3311},
+    {4927, 3313}, {747, 3490}, {436, 3505}, {45, 3407}, {4931, 3313}, {4930, 3313}, {4929, 3313}, {4928, 3313},
+    {4932, 3314}, {1642, 3492}, {1659, 3511}, {911, 3581}, {4936, 3314}, {4935, 3314}, {4934, 3314}, {4933, 3314},
+    {4937, 3315}, {2097, 3561}, {951, 3559}, {128, 3597}, {4941, 3315}, {4940, 3315}, {4939, 3315}, {4938, 3315},
+    {4942, 3316}, {2220, 3594}, {1245, 3595}, {2217, 3592}, {4946, 3316}, {4945, 3316}, {4944, 3316}, {4943, 3316},
+    {4947, 3317}, {891, 3593}, {47, 3649}, {1740, 3654}, {4951, 3317}, {4950, 3317}, {4949, 3317}, {4948, 3317},
+    {4952, 3318}, {2116, 3655}, {2640, 3652}, {839, 3653}, {4956, 3318}, {4955, 3318}, {4954, 3318}, {4953, 3318},
+    {4957, 3319}, {4949, 3408}, {1756, 3681}, {1692, 3686}, {4961, 3319}, {4960, 3319}, {4959, 3319}, {4958, 3319},
+    {4962, 3320}, {1758, 3687}, {347, 3684}, {1862, 3685}, {4966, 3320}, {4965, 3320}, {4964, 3320}, {4963, 3320},
+    {4968, 3322}, {4956, 3411}, {2432, 3713}, {2770, 3718}, {4972, 3322}, {4971, 3322}, {4970, 3322}, {4969, 3322},
+    {4974, 3324}, {519, 3719}, {580, 3716}, {908, 3717}, {4978, 3324}, {4977, 3324}, {4976, 3324}, {4975, 3324},
+    {4980, 3326}, {529, 3746}, {2436, 3749}, {484, 3748}, {4984, 3326}, {4983, 3326}, {4982, 3326}, {4981, 3326},
+    {4987, 3329}, {1138, 3751}, {1067, 3750}, {5297, 3413}, {4991, 3329}, {4990, 3329}, {4989, 3329}, {4988, 3329},
+    {5120, 3331}, {2203, 3777}, {5301, 3419}, {1881, 3782}, {5124, 3331}, {5123, 3331}, {5122, 3331}, {5121, 3331},
+    {4994, 3333}, {1090, 3783}, {5299, 3422}, {284, 3780}, {4998, 3333}, {4997, 3333}, {4996, 3333}, {4995, 3333},
+    {4999, 3334}, {2101, 3781}, {1159, 3808}, {126, 3815}, {5019, 3334}, {5016, 3334}, {5009, 3334}, {5007, 3334},
+    {5028, 3335}, {1111, 3814}, {2690, 3813}, {2492, 3812}, {5032, 3335}, {5031, 3335}, {5030, 3335}, {5029, 3335},
+    {5033, 3336}, {1349, 3816}, {5321, 3426}, {886, 3823}, {5037, 3336}, {5036, 3336}, {5035, 3336}, {5034, 3336},
+    {5038, 3337}, {573, 3822}, {5349, 3430}, {587, 3821}, {5042, 3337}, {5041, 3337}, {5040, 3337}, {5039, 3337},
+    {5125, 3339}, {740, 3820}, {5350, 3431}, {5345, 3438}, {5129, 3339}, {5128, 3339}, {5127, 3339}, {5126, 3339},
+    {5130, 3341}, {5317, 3443}, {1947, 3824}, {2153, 3831}, {5134, 3341}, {5133, 3341}, {5132, 3341}, {5131, 3341},
+    {5135, 3343}, {5312, 3823}, {1593, 3830}, {5311, 3816}, {5139, 3343}, {5138, 3343}, {5137, 3343}, {5136, 3343},
+    {5140, 3345}, {5314, 3821}, {410, 3829}, {5313, 3822}, {5144, 3345}, {5143, 3345}, {5142, 3345}, {5141, 3345},
+    {5145, 3347}, {1995, 3828}, {160, 3832}, {5315, 3820}, {5149, 3347}, {5148, 3347}, {5147, 3347}, {5146, 3347},
+    {5150, 3349}, {2434, 3839}, {2254, 3838}, {2047, 3837}, {5154, 3349}, {5153, 3349}, {5152, 3349}, {5151, 3349},
+    {5155, 3351}, {5300, 3782}, {1629, 3836}, {5298, 3777}, {5159, 3351}, {5158, 3351}, {5157, 3351}, {5156, 3351},
+    {5160, 3353}, {5302, 3780}, {1625, 3840}, {5301, 3783}, {5164, 3353}, {5163, 3353}, {5162, 3353}, {5161, 3353},
+    {5305, 3808}, {5306, 3815}, {1728, 3847}, {5303, 3781}, {2257, 3846}, {981, 3845}, {616, 3844}, {41, 3848},
+    {5308, 3813}, {5309, 3812}, {2346, 3855}, {5307, 3814}, {383, 3854}, {1456, 3853}, {1345, 3852}, {2350, 3856},
+    {4959, 3713}, {5293, 3718}, {2100, 3863}, {2042, 3862}, {942, 3861}, {1034, 3860}, {2556, 3864}, {1179, 3871},
+    {5295, 3716}, {5296, 3717}, {2513, 3870}, {5294, 3719}, {2448, 3869}, {2405, 3868}, {2756, 3872}, {2372, 3879},
+    {799, 3878}, {1694, 3877}, {2680, 3876}, {876, 3880}, {2751, 3887}, {2750, 3886}, {113, 3885}, {2795, 3884},
+    {950, 3888}, {1104, 3895}, {1638, 3894}, {194, 3893}, {1346, 3892}, {1032, 3896}, {1540, 3903}, {734, 3902},
+    {1197, 3901}, {1961, 3900}, {318, 3904}, {14, 3911}, {2669, 3910}, {1055, 3909}, {684, 3908}, {1233, 3912},
+    {1181, 3919}, {783, 3918}, {683, 3917}, {875, 3916}, {940, 3920}, {511, 3927}, {2349, 3926}, {2319, 3925},
+    {4950, 3681}, {4952, 3686}, {1722, 3924}, {642, 3928}, {1464, 3935}, {373, 3934}, {2494, 3933}, {30, 3932},
+    {4954, 3684}, {4955, 3685}, {2052, 3936}, {4953, 3687}, {608, 3943}, {2535, 3942}, {20, 3941}, {810, 3940},
+    {5340, 3458}, {5352, 3472}, {2511, 3944}, {2414, 3951}, {262, 3950}, {1560, 3949}, {5315, 3458}, {5352, 3458},
+    {1556, 3948}, {5313, 3489}, {5368, 3507}, {1507, 3952}, {1974, 3959}, {1472, 3958}, {5361, 3489}, {5339, 3489},
+    {971, 3957}, {1619, 3956}, {5341, 3446}, {2621, 3960}, {1380, 3967}, {287, 3966}, {95, 3965}, {96, 3964},
+    {5357, 3452}, {32, 3968}, {106, 3975}, {948, 3974}, {1958, 3973}, {1478, 3972}, {5361, 3460}, {146, 3976},
+    {2286, 3983}, {1377, 3982}, {613, 3981}, {2070, 3980}, {276, 3984}, {87, 3991}, {86, 3990}, {1231, 3989},
+    {1314, 3988}, {5373, 3463}, {1208, 3992}, {1744, 3999}, {539, 3998}, {712, 3997}, {555, 3996}, {1508, 4000},
+    {1981, 4007}, {1473, 4006}, {970, 4005}, {1622, 4004}, {548, 4008}, {2479, 4015}, {2328, 4014}, {2782, 4013},
+    {785, 4012}, {719, 4016}, {2, 4023}, {601, 4022}, {1575, 4021}, {302, 4020}, {5124, 3465}, {431, 4024},
+    {504, 4031}, {1951, 4030}, {746, 4029}, {1843, 4028}, {913, 4032}, {174, 4039}, {2578, 4038}, {646, 4037},
+    {1813, 4036}, {42, 4040}, {739, 4047}, {229, 4046}, {464, 4045}, {1506, 4044}, {5132, 3468}, {1062, 4048},
+    {350, 4055}, {568, 4054}, {478, 4053}, {2668, 4052}, {5140, 3495}, {437, 4056}, {1832, 4063}, {2163, 4062},
+    {2709, 4061}, {2248, 4060}, {1209, 4064}, {1010, 4071}, {1533, 4070}, {80, 4069}, {715, 4068}, {1424, 4072},
+    {1969, 4079}, {822, 4078}, {872, 4077}, {1705, 4076}, {5145, 3498}, {689, 4080}, {565, 4087}, {1278, 4086},
+    {2235, 4085}, {1069, 4084}, {5152, 3499}, {280, 4088}, {1460, 4095}, {459, 4094}, {1994, 4093}, {1149, 4092},
+    {1200, 4096}, {1441, 4103}, {2278, 4102}, {2473, 4101}, {362, 4100}, {1905, 4104}, {639, 4111}, {2106, 4110},
+    {1998, 4109}, {1841, 4108}, {5162, 3500}, {862, 4112}, {1018, 4119}, {286, 4118}, {2202, 4117}, {143, 4116},
+    {775, 4120}, {1736, 4127}, {558, 4126}, {371, 4125}, {5148, 4087}, {5149, 4086}, {378, 4124}, {5146, 4080},
+    {2127, 4128}, {5153, 4088}, {5150, 4085}, {5151, 4084}, {5157, 4093}, {5158, 4092}, {5155, 4095}, {5156, 4094},
+    {2747, 4135}, {1371, 4134}, {252, 4133}, {2120, 4132}, {1688, 4136}, {1795, 4143}, {1839, 4142}, {1788, 4141},
+    {1114, 4140}, {5160, 4112}, {2232, 4144}, {1216, 4151}, {5163, 4117}, {5164, 4116}, {5161, 4119}, {5162, 4118},
+    {5129, 4029}, {5130, 4028}, {5127, 4031}, {5128, 4030}, {2637, 4150}, {2263, 4149}, {2211, 4148}, {5165, 3502},
+    {5172, 3504}, {5180, 3508}, {5200, 3510}, {1707, 4184}, {69, 4191}, {5131, 4048}, {1318, 4190}, {2437, 4189},
+    {5136, 4053}, {5137, 4052}, {5133, 4055}, {5135, 4054}, {5139, 4063}, {5141, 4062}, {0, 4188}, {5138, 4056},
+    {5208, 3513}, {5213, 3515}, {5143, 4061}, {5144, 4060}, {1324, 4208}, {1420, 4215}, {1072, 4214}, {1305, 4213},
+    {5368, 3981}, {5371, 3980}, {5358, 3983}, {5360, 3982}, {2796, 4212}, {5508, 3521}, {5516, 3528}, {5524, 3531},
+    {5374, 3992}, {5120, 3999}, {5529, 3534}, {1594, 4248}, {5123, 3996}, {154, 4255}, {5121, 3998}, {5122, 3997},
+    {1732, 4254}, {377, 4253}, {2601, 4252}, {1823, 4256}, {1386, 4263}, {2379, 4262}, {1448, 4261}, {2389, 4260},
+    {765, 4264}, {1695, 4271}, {1498, 4270}, {1563, 4269}, {546, 4268}, {5125, 4024}, {353, 4272}, {2090, 4279},
+    {5325, 3944}, {5327, 3951}, {2238, 4278}, {1988, 4277}, {2078, 4276}, {815, 4280}, {5328, 3950}, {5329, 3949},
+    {163, 4287}, {5334, 3952}, {5330, 3948}, {515, 4286}, {2267, 4285}, {1509, 4284}, {5336, 3959}, {5337, 3958},
+    {319, 4288}, {5340, 3960}, {5338, 3957}, {5339, 3956}, {5347, 3965}, {5352, 3964}, {5344, 3967}, {5345, 3966},
+    {1337, 4295}, {5, 4294}, {2387, 4293}, {892, 4292}, {307, 4296}, {5355, 3976}, {1030, 4303}, {1824, 4302},
+    {1835, 4152}, {679, 4159}, {2719, 4158}, {1490, 4157}, {1382, 4156}, {52, 4160}, {972, 4167}, {686, 4166},
+    {94, 4165}, {2262, 4164}, {2499, 4168}, {255, 4175}, {575, 4174}, {890, 4173}, {620, 4172}, {1050, 4176},
+    {65, 4183}, {1434, 4182}, {40, 4181}, {2453, 4180}, {1003, 4192}, {1415, 4199}, {1039, 4198}, {581, 4197},
+    {1489, 4196}, {1583, 4200}, {2586, 4207}, {709, 4206}, {267, 4205}, {2340, 4204}, {2339, 4216}, {1064, 4223},
+    {432, 4222}, {2004, 4221}, {648, 4220}, {240, 4224}, {670, 4231}, {144, 4230}, {1529, 4229}, {2115, 4228},
+    {1196, 4232}, {567, 4239}, {2083, 4238}, {1929, 4237}, {396, 4236}, {1970, 4240}, {2320, 4247}, {2565, 4246},
+    {1254, 4245}, {200, 4244}, {1389, 4301}, {1225, 4300}, {338, 4304}, {2125, 4311}, {2276, 4310}, {2484, 4309},
+    {1967, 4308}, {1383, 4312}, {2246, 4319}, {1006, 4318}, {183, 4317}, {1187, 4316}, {5536, 3535}, {586, 4320},
+    {2007, 4327}, {2660, 4326}, {1684, 4325}, {1982, 4324}, {463, 4328}, {1184, 4335}, {211, 4334}, {2323, 4333},
+    {1454, 4332}, {1455, 4336}, {874, 4343}, {953, 4342}, {1142, 4341}, {2404, 4340}, {2298, 4344}, {2193, 4351},
+    {496, 4350}, {1011, 4349}, {1955, 4348}, {800, 4352}, {192, 4359}, {509, 4358}, {879, 4357}, {894, 4356},
+    {1829, 4360}, {2630, 4367}, {2343, 4366}, {298, 4365}, {1875, 4364}, {804, 4368}, {1748, 4375}, {2385, 4374},
+    {2077, 4373}, {2791, 4372}, {2099, 4376}, {2667, 4383}, {885, 4382}, {769, 4381}, {1189, 4380}, {5544, 3537},
+    {2705, 4384}, {1451, 4391}, {282, 4390}, {205, 4389}, {1269, 4388}, {5552, 3542}, {576, 4392}, {1477, 4399},
+    {2280, 4398}, {2009, 4397}, {2451, 4396}, {5557, 3543}, {1689, 4400}, {823, 4407}, {1928, 4406}, {2618, 4405},
+    {1830, 4404}, {5564, 3545}, {5565, 3548}, {171, 4408}, {2662, 4415}, {726, 4414}, {2600, 4413}, {2180, 4412},
+    {5573, 3554}, {5608, 3555}, {1124, 4424}, {418, 4431}, {1054, 4430}, {443, 4429}, {2530, 4428}, {2222, 4432},
+    {5547, 4390}, {5548, 4389}, {5543, 4384}, {5545, 4391}, {5550, 4392}, {5551, 4399}, {5549, 4388}, {2040, 4439},
+    {5556, 4396}, {487, 4438}, {5553, 4398}, {5555, 4397}, {5561, 4406}, {5562, 4405}, {5558, 4400}, {5560, 4407},
+    {1235, 4437}, {5568, 4408}, {5563, 4404}, {1426, 4436}, {5571, 4413}, {5572, 4412}, {5569, 4415}, {5570, 4414},
+    {5541, 4325}, {5542, 4324}, {5539, 4327}, {5540, 4326}, {923, 4440}, {2149, 4447}, {2724, 4446}, {2594, 4445},
+    {2026, 4444}, {2649, 4448}, {2730, 4455}, {654, 4454}, {75, 4453}, {1894, 4452}, {904, 4456}, {2717, 4463},
+    {2570, 4462}, {532, 4461}, {1403, 4460}, {5581, 3556}, {5588, 3557}, {5596, 3558}, {5604, 3566}, {5609, 3570},
+    {5616, 3574}, {5624, 3577}, {5376, 3579}, {5381, 3585}, {5384, 3600}, {5407, 3603}, {5483, 3607}, {5481, 3618},
+    {5514, 4220}, {5515, 4224}, {5512, 4222}, {5513, 4221}, {5520, 4229}, {5521, 4228}, {5517, 4231}, {5519, 4230},
+    {5525, 4238}, {5527, 4237}, {5522, 4232}, {5523, 4239}, {5532, 4247}, {5533, 4246}, {5528, 4236}, {5530, 4240},
+    {5486, 3619}, {5487, 3620}, {5534, 4245}, {5535, 4244}, {5484, 3622}, {5472, 4369}, {5404, 4592}, {5503, 4369},
+    {5407, 4593}, {5406, 4603}, {5401, 4600}, {5400, 4601}, {5497, 4385}, {5537, 4320}, {5496, 4385}, {5397, 4544},
+    {5169, 4158}, {5170, 4157}, {5166, 4152}, {5168, 4159}, {5175, 4167}, {5176, 4166}, {5171, 4156}, {5173, 4160},
+    {5179, 4168}, {5181, 4175}, {5177, 4165}, {5178, 4164}, {5197, 4172}, {5199, 4176}, {5183, 4174}, {5196, 4173},
+    {5204, 4181}, {5205, 4180}, {5201, 4183}, {5203, 4182}, {5209, 4198}, {5211, 4197}, {5206, 4192}, {5207, 4199},
+    {5504, 4207}, {5505, 4206}, {5212, 4196}, {5214, 4200}, {5509, 4216}, {5511, 4223}, {5506, 4205}, {5507, 4204},
+    {130, 4416}, {204, 4423}, {243, 4422}, {724, 4421}, {1288, 4420}, {699, 4464}, {1283, 4471}, {1769, 4470},
+    {1743, 4469}, {385, 4468}, {656, 4472}, {1161, 4479}, {1615, 4478}, {2580, 4477}, {22, 4476}, {1195, 4480},
+    {1135, 4487}, {2799, 4486}, {2496, 4485}, {323, 4484}, {367, 4488}, {2252, 4495}, {1651, 4494}, {954, 4493},
+    {838, 4492}, {51, 4496}, {1517, 4503}, {1308, 4502}, {2761, 4501}, {124, 4500}, {91, 4504}, {1495, 4511},
+    {177, 4510}, {153, 4509}, {1939, 4508}, {304, 4512}, {2745, 4519}, {626, 4518}, {1757, 4517}, {652, 4516},
+    {167, 4520}, {2356, 4527}, {157, 4526}, {999, 4525}, {1806, 4524}, {5396, 4545}, {5399, 4555}, {5398, 4552},
+    {5393, 4553}, {5490, 4411}, {5394, 4515}, {5489, 4411}, {5421, 4513}, {5420, 4523}, {5423, 4521}, {5422, 4531},
+    {5446, 4418}, {5416, 4528}, {5419, 4529}, {5418, 4539}, {5413, 4536}, {5412, 4537}, {5448, 4426}, {5414, 4483},
+    {5409, 4481}, {5408, 4491}, {5411, 4489}, {5410, 4499}, {5440, 4450}, {5470, 4458}, {5427, 4466}, {5385, 4467},
+    {5444, 4473}, {5466, 4608}, {5465, 4608}, {5464, 4614}, {5463, 4615}, {5425, 4832}, {5480, 4609}, {5427, 4833},
+    {5426, 4838}, {5445, 4839}, {5444, 4842}, {5409, 4623}, {5413, 4617}, {5439, 4622}, {5457, 4841}, {5412, 4617},
+    {5459, 4846}, {5458, 4847}, {5480, 4850}, {5482, 4851}, {5473, 4849}, {5381, 4626}, {5807, 4618}, {5380, 4626},
+    {5474, 4854}, {5501, 4855}, {5473, 4618}, {5500, 4852}, {5383, 4609}, {5385, 4609}, {5459, 4609}, {5392, 4609},
+    {5503, 4853}, {5444, 4618}, {5458, 4618}, {5492, 4861}, {5489, 4618}, {5403, 4632}, {5495, 4802}, {5402, 4632},
+    {5489, 4803}, {5401, 4638}, {5445, 4609}, {5399, 4638}, {5487, 4618}, {5473, 4618}, {5440, 4618}, {5451, 4618},
+    {5488, 4800}, {5476, 4609}, {5498, 4609}, {5491, 4801}, {5475, 4609}, {5392, 4649}, {5775, 4808}, {5870, 4649},
+    {5774, 4809}, {5769, 4814}, {5768, 4815}, {5771, 4812}, {5864, 4670}, {5764, 4829}, {5863, 4670}, {5767, 4770},
+    {5766, 4771}, {5761, 4768}, {5760, 4769}, {5789, 4781}, {5857, 4686}, {5788, 4786}, {5856, 4686}, {5785, 4787},
+    {5784, 4784}, {5787, 4785}, {5780, 4791}, {5783, 4788}, {5880, 4692}, {5782, 4789}, {5879, 4692}, {5805, 4794},
+    {5804, 4795}, {5837, 4708}, {5801, 4743}, {5836, 4708}, {5800, 4740}, {5803, 4741}, {5802, 4746}, {5797, 4747},
+    {5830, 4714}, {5798, 4745}, {5829, 4714}, {5793, 4750}, {5792, 4751}, {5795, 4748}, {5794, 4749}, {5842, 4730},
+    {5820, 4761}, {5823, 4766}, {5822, 4767}, {5817, 4764}, {5816, 4765}, {5849, 4775}, {5813, 5090}, {5848, 4775},
+    {5812, 5091}, {5815, 5088}, {5814, 5089}, {5809, 5094}, {5842, 4776}, {5810, 5095}, {5841, 4776}, {5837, 5092},
+    {5836, 5093}, {5839, 5098}, {5838, 5099}, {5835, 5096}, {5803, 4777}, {5834, 5097}, {5802, 4777}, {5829, 5102},
+    {5622, 4508}, {5623, 4512}, {5620, 4510}, {5621, 4509}, {5628, 4517}, {5629, 4516}, {5625, 4519}, {5627, 4518},
+    {5377, 4526}, {5379, 4525}, {5630, 4520}, {5631, 4527}, {5828, 5103}, {5831, 5100}, {5380, 4524}, {5824, 5101},
+    {5796, 4778}, {5827, 5106}, {5795, 4778}, {5826, 5107}, {5853, 5104}, {5852, 5105}, {5849, 5110}, {5848, 5111},
+    {5821, 4792}, {5851, 5108}, {5820, 4792}, {5850, 5109}, {5845, 5114}, {5814, 4793}, {5846, 5115}, {5813, 4793},
+    {5577, 4422}, {5578, 4421}, {5574, 4416}, {5576, 4423}, {5584, 4471}, {5585, 4470}, {5579, 4420}, {5582, 4464},
+    {5589, 4472}, {5591, 4479}, {5586, 4469}, {5587, 4468}, {5594, 4476}, {5595, 4480}, {5592, 4478}, {5593, 4477},
+    {5600, 4485}, {5601, 4484}, {5597, 4487}, {5599, 4486}, {5605, 4494}, {5607, 4493}, {5602, 4488}, {5603, 4495},
+    {5612, 4503}, {5613, 4502}, {5608, 4492}, {5610, 4496}, {5617, 4504}, {5619, 4511}, {5614, 4501}, {5615, 4500},
+    {5841, 5112}, {5840, 5113}, {5843, 5118}, {5842, 5119}, {5775, 4805}, {5871, 5116}, {5774, 4805}, {5870, 5117},
+    {5865, 5058}, {5864, 5059}, {5867, 5056}, {5860, 5057}, {5768, 4806}, {5863, 5062}, {5767, 4806}, {5862, 5063},
+    {5857, 5060}, {5856, 5061}, {5885, 5066}, {5884, 5067}, {5761, 4807}, {5887, 5064}, {5760, 4807}, {5886, 5065},
+    {5881, 5070}, {5786, 4810}, {5882, 5071}, {5785, 4810}, {5877, 5068}, {5876, 5069}, {5879, 5074}, {5878, 5075},
+    {5779, 4926}, {5875, 5085}, {5778, 4926}, {5874, 5026}, {5645, 5027}, {5644, 5024}, {5647, 5025}, {5640, 5002},
+    {5740, 4967}, {5643, 5003}, {5739, 4967}, {5642, 5000}, {5637, 5001}, {5636, 5006}, {5633, 5004}, {5632, 5005},
+    {5733, 4973}, {5635, 5010}, {5732, 4973}, {5634, 5011}, {5661, 5008}, {5758, 4979}, {5662, 5014}, {5757, 4979},
+    {5657, 5015}, {5656, 5012}, {5659, 5013}, {5658, 5018}, {5751, 4985}, {5749, 4986}, {5750, 4985}, {5748, 4986},
+    {5649, 5017}, {5648, 5022}, {5651, 5023}, {5650, 5020}, {5677, 5021}, {5710, 4992}, {5678, 5346}, {5709, 4992},
+    {5673, 5347}, {5672, 5344}, {5675, 5345}, {5674, 5350}, {5685, 4993}, {5702, 5043}, {5670, 5351}, {5701, 5043},
+    {5665, 5348}, {5664, 5349}, {5667, 5354}, {5666, 5355}, {5727, 5044}, {5695, 5352}, {5726, 5044}, {5694, 5353},
+    {5689, 5358}, {5688, 5359}, {5691, 5356}, {5684, 5357}, {5720, 5045}, {5687, 5362}, {5719, 5045}, {5686, 5363},
+    {5681, 5360}, {5680, 5361}, {5709, 5366}, {5708, 5367}, {5713, 5046}, {5711, 5364}, {5712, 5046}, {5710, 5365},
+    {5705, 5370}, {5674, 5047}, {5706, 5371}, {5673, 5047}, {5701, 5368}, {5700, 5369}, {5703, 5374}, {5702, 5375},
+    {5667, 5048}, {5699, 5372}, {5666, 5048}, {5698, 5373}, {5725, 5314}, {5724, 5315}, {5727, 5312}, {5720, 5313},
+    {5692, 5049}, {5723, 5318}, {5691, 5049}, {5722, 5319}, {5717, 5316}, {5716, 5317}, {5713, 5322}, {5712, 5323},
+    {5685, 5050}, {5715, 5320}, {5684, 5050}, {5714, 5321}, {5741, 5326}, {5646, 5051}, {5733, 5053}, {5645, 5051},
+    {5644, 5052}, {5759, 5054}, {5643, 5052}, {5745, 5055}, {5744, 5072}, {5747, 5073}, {5746, 5076}, {5716, 5077},
+    {5717, 5079}, {5644, 5078}, {5645, 5080}, {5650, 5081}, {5651, 5082}, {5648, 5083}, {5707, 5084}, {5708, 5086},
+    {5655, 5087}, {5652, 5165}, {5653, 5166}, {5658, 5167}, {5659, 5168}, {5698, 5169}, {5699, 5171}, {5662, 5170},
+    {5663, 5172}, {5660, 5173}, {5661, 5174}, {6114, 5175}, {6040, 5176}, {6112, 5177}, {6113, 5178}, {6118, 5179},
+    {6119, 5180}, {6116, 5181}, {6046, 5182}, {6122, 5183}, {6123, 5184}, {6120, 5185}, {6121, 5186}, {6126, 5187},
+    {6034, 5188}, {6070, 5189}, {6061, 5190}, {5904, 5191}, {6030, 5192}, {6058, 5193}, {6059, 5194}, {6060, 5195},
+    {6061, 5196}, {5910, 5220}, {5911, 5221}, {5915, 5223}, {6092, 5197}, {5916, 5223}, {6093, 5199}, {6050, 5200},
+    {5912, 5222}, {5921, 5242}, {5917, 5241}, {5918, 5241}, {5923, 5244}, {5925, 5234}, {5922, 5242}, {5927, 5198},
+    {6051, 5201}, {6048, 5202}, {6024, 5204}, {6025, 5207}, {6141, 5241}, {6082, 5241}, {6026, 5203}, {5924, 5244},
+    {6027, 5205}, {5940, 5236}, {5941, 5237}, {5942, 5238}, {5932, 5198}, {5933, 5198}, {5957, 5228}, {5926, 5234},
+    {5928, 5198}, {5929, 5198}, {5930, 5198}, {5931, 5198}, {6018, 5206}, {5958, 5228}, {6019, 5208}, {6016, 5209},
+    {5945, 5239}, {5959, 5218}, {5947, 5225}, {5950, 5225}, {5943, 5238}, {6017, 5210}, {5946, 5239}, {6022, 5211},
+    {5944, 5238}, {5955, 5226}, {6121, 5213}, {6124, 5215}, {6071, 5212}, {6109, 5225}, {5956, 5226}, {6068, 5216},
+    {6069, 5217}, {6074, 5219}, {6075, 5224}, {5960, 5218}, {6114, 5229}, {6115, 5231}, {6116, 5233}, {5913, 5222},
+    {6117, 5235}, {6076, 5227}, {6077, 5230}, {5914, 5222}, {6023, 5232}, {6020, 5240}, {6021, 5243}, {6096, 5245},
+    {5961, 5214}, {6097, 5247}, {6024, 5246}, {6025, 5248}, {6030, 5249}, {6031, 5250}, {6028, 5251}, {6103, 5252},
+    {6092, 5254}, {6039, 5253}, {6037, 5255}, {6042, 5256}, {6043, 5257}, {6040, 5258}, {6083, 5260}, {6084, 5262},
+    {6047, 5259}, {6044, 5261}, {5967, 5214}, {5966, 5214}, {6045, 5263}, {5986, 5264}, {5987, 5265}, {5946, 5268},
+    {5947, 5270}, {5990, 5266}, {5991, 5267}, {5988, 5269}, {5965, 5214}, {5964, 5214}, {5963, 5214}, {5962, 5214},
+    {5989, 5271}, {5994, 5272}, {5937, 5273}, {5938, 5275}, {5993, 5274}, {5998, 5276}, {5999, 5277}, {5996, 5278},
+    {5997, 5279}, {5928, 5280}, {5929, 5282}, {6000, 5281}, {6001, 5283}, {6006, 5284}, {6007, 5285}, {6004, 5286},
+    {5902, 5287}, {6010, 5288}, {6011, 5289}, {6008, 5290}, {6009, 5291}, {6014, 5292}, {5925, 5293}, {5926, 5295},
+    {6013, 5294}, {5954, 5296}, {5955, 5297}, {5952, 5298}, {5953, 5299}, {5916, 5300}, {5917, 5302}, {5956, 5301},
+    {5957, 5303}, {5962, 5304}, {5963, 5305}, {5960, 5306}, {5907, 5308}, {5908, 5310}, {5967, 5307}, {5964, 5309},
+    {5965, 5311}, {5970, 5324}, {5971, 5325}, {5898, 5328}, {5899, 5330}, {5974, 5327}, {5975, 5329}, {5972, 5331},
+    {5973, 5332}, {5978, 5333}, {5889, 5336}, {5890, 5338}, {5977, 5334}, {5982, 5335}, {5983, 5337}, {5980, 5339},
+    {5981, 5340}, {6008, 5341}, {6009, 5343}, {5920, 5342}, {5921, 5376}, {5926, 5377}, {5927, 5378}, {5924, 5379},
+    {6015, 5380}, {6000, 5382}, {5931, 5381}, {5928, 5383}, {5929, 5384}, {5934, 5385}, {5935, 5386}, {6006, 5388},
+    {6007, 5390}, {5938, 5387}, {5939, 5389}, {5936, 5391}, {5937, 5392}, {5942, 5393}, {5997, 5396}, {5998, 5398},
+    {5941, 5394}, {5946, 5395}, {5944, 5397}, {5945, 5399}, {5951, 5400}, {5990, 5401}, {5991, 5403}, {5890, 5402},
+    {5891, 5404}, {5888, 5405}, {5889, 5406}, {5894, 5407}, {5981, 5408}, {5982, 5410}, {5893, 5409}, {5898, 5411},
+    {5899, 5412}, {5896, 5413}, {5897, 5414}, {5972, 5416}, {5973, 5418}, {5900, 5415}, {5901, 5417}, {5906, 5419},
+    {5907, 5420}, {5904, 5421}, {5963, 5424}, {5964, 5426}, {5911, 5422}, {5908, 5423}, {5909, 5425}, {5914, 5427},
+    {5915, 5428}, {5954, 5429}, {5955, 5431}, {5919, 5430}, {5916, 5432}, {6370, 5433}, {6371, 5434}, {6368, 5435},
+    {6331, 5436}, {6332, 5438}, {6333, 5437}, {6334, 5439}, {6373, 5440}, {6378, 5441}, {6379, 5442}, {6376, 5443},
+    {6377, 5444}, {6324, 5445}, {6325, 5447}, {6380, 5446}, {6381, 5448}, {6386, 5449}, {6387, 5450}, {6384, 5451},
+    {6385, 5452}, {6316, 5453}, {6317, 5455}, {6388, 5454}, {6389, 5456}, {6394, 5457}, {6395, 5458}, {6392, 5459},
+    {6307, 5460}, {6308, 5462}, {6399, 5461}, {6396, 5463}, {6397, 5464}, {6338, 5465}, {6339, 5466}, {6298, 5468},
+    {6299, 5470}, {6342, 5467}, {6343, 5469}, {6340, 5471}, {6341, 5472}, {6346, 5473}, {6289, 5476}, {6290, 5478},
+    {6345, 5474}, {6350, 5475}, {6351, 5477}, {6348, 5479}, {6349, 5480}, {6280, 5481}, {6281, 5483}, {6352, 5482},
+    {6353, 5484}, {6358, 5485}, {6359, 5486}, {6356, 5487}, {6287, 5488}, {6272, 5490}, {6363, 5489}, {6360, 5491},
+    {6361, 5492}, {6366, 5493}, {6367, 5494}, {6278, 5496}, {6279, 5498}, {6306, 5495}, {6307, 5497}, {6304, 5499},
+    {6305, 5500}, {6310, 5501}, {6397, 5504}, {6398, 5506}, {6309, 5502}, {6314, 5503}, {6315, 5505}, {6312, 5507},
+    {6313, 5508}, {6388, 5509}, {6389, 5511}, {6390, 5512}, {6391, 5514}, {6335, 5510}, {6356, 5513}, {6334, 5510},
+    {6357, 5515}, {6360, 5516}, {6361, 5517}, {6364, 5518}, {6365, 5519}, {6364, 5520}, {6340, 5521}, {6342, 5522},
+    {6393, 5523}, {6392, 5524}, {6395, 5525}, {6380, 5526}, {6379, 5527}, {6396, 5528}, {6399, 5529}, {6398, 5530},
+    {6385, 5531}, {6384, 5532}, {6373, 5533}, {6372, 5534}, {6389, 5535}, {6388, 5536}, {6391, 5537}, {6390, 5538},
+    {6377, 5539}, {6385, 5540}, {6379, 5541}, {6381, 5542}, {6380, 5543}, {6383, 5544}, {6382, 5545}, {6392, 5546},
+    {6368, 5547}, {6370, 5548}, {6373, 5549}, {6372, 5550}, {6375, 5551}, {6387, 5552}, {6159, 5553}, {6258, 5554},
+    {1140, 5555}, {6165, 5556}, {6156, 5557}, {6155, 5558}, {6154, 5559}, {6153, 5560}, {2119, 5561}, {495, 5562},
+    {1775, 5568}, {1414, 5623}, {1986, 5627}, {1126, 5563}, {2443, 5565}, {766, 5570}, {1987, 5571}, {6153, 5580},
+    {6154, 5581}, {141, 5569}, {1621, 5574}, {928, 5572}, {1880, 5583}, {643, 5573}, {2482, 5591}, {1793, 5575},
+    {816, 5592}, {2714, 5593}, {2399, 5594}, {869, 5595}, {2293, 5588}, {2309, 5589}, {6161, 5564}, {6154, 5566},
+    {6166, 5578}, {6165, 5579}, {6164, 5582}, {6163, 5584}, {2587, 5585}, {2623, 5586}, {2620, 5587}, {1059, 5604},
+    {185, 5608}, {288, 5600}, {2721, 5606}, {1004, 5602}, {6163, 5564}, {6161, 5566}, {488, 5603}, {6176, 5613},
+    {6155, 5567}, {6152, 5576}, {6146, 5577}, {1494, 5609}, {430, 5614}, {1177, 5590}, {190, 5597}, {574, 5601},
+    {577, 5619}, {1825, 5632}, {1284, 5663}, {1061, 5662}, {1462, 5661}, {1639, 5660}, {2064, 5651}, {2188, 5650},
+    {6154, 5577}, {6207, 5610}, {6160, 5567}, {6156, 5576}, {6206, 5611}, {6187, 5612}, {6186, 5615}, {6189, 5616},
+    {6188, 5617}, {6191, 5618}, {6200, 5620}, {6199, 5621}, {6198, 5622}, {6197, 5624}, {6178, 5625}, {6181, 5626},
+    {6203, 5596}, {6201, 5598}, {6194, 5599}, {6195, 5605}, {6193, 5607}, {6180, 5628}, {6183, 5629}, {6182, 5630},
+    {6223, 5631}, {6222, 5633}, {6235, 5634}, {6234, 5635}, {6237, 5636}, {6236, 5637}, {6239, 5638}, {6216, 5639},
+    {6201, 5599}, {6197, 5605}, {6205, 5596}, {6203, 5598}, {6215, 5640}, {6224, 5641}, {6195, 5607}, {6227, 5642},
+    {6226, 5643}, {6229, 5644}, {6228, 5645}, {6209, 5646}, {6208, 5647}, {6217, 5648}, {6216, 5649}, {6219, 5652},
+    {6218, 5653}, {6221, 5654}, {6234, 5655}, {6233, 5656}, {6222, 5657}, {6209, 5658}, {6208, 5659}, {6211, 5664},
+    {6210, 5665}, {6227, 5666}, {6226, 5667}, {6215, 5668}, {6214, 5669}, {6265, 5670}, {6264, 5671}, {6267, 5672},
+    {6252, 5673}, {6251, 5674}, {6268, 5675}, {6271, 5676}, {6270, 5677}, {6257, 5678}, {6256, 5679}, {6252, 5680},
+    {6259, 5681}, {6258, 5682}, {6260, 5683}, {6262, 5684}, {6249, 5685}, {6270, 5686}, {6269, 5687}, {6250, 5688},
+    {6253, 5689}, {6252, 5690}, {6255, 5691}, {6254, 5692}, {6263, 5693}, {6262, 5694}, {6243, 5695}, {6242, 5696},
+    {6245, 5697}, {6244, 5698}, {6247, 5699}, {6256, 5700}, {6543, 5701}, {6552, 5702}, {6555, 5703}, {6554, 5704},
+    {6557, 5705}, {6556, 5706}, {6537, 5707}, {6536, 5708}, {6545, 5709}, {6544, 5710}, {6547, 5711}, {6546, 5712},
+    {6549, 5713}, {6530, 5714}, {6529, 5715}, {6550, 5716}, {6537, 5717}, {6536, 5718}, {6539, 5719}, {6538, 5720},
+    {6555, 5721}, {6554, 5722}, {6543, 5723}, {6542, 5724}, {6529, 5725}, {6528, 5726}, {6531, 5727}, {6548, 5728},
+    {6547, 5729}, {6532, 5730}, {6535, 5731}, {6534, 5732}, {6585, 5733}, {6584, 5734}, {6573, 5735}, {6572, 5736},
+    {6589, 5737}, {6588, 5738}, {6591, 5739}, {6590, 5740}, {6577, 5741}, {6566, 5742}, {6565, 5743}, {6578, 5744},
+    {6581, 5745}, {6173, 5602}, {6580, 5746}, {6583, 5747}, {6175, 5603}, {6582, 5748}, {6591, 5749}, {6590, 5750},
+    {6571, 5751}, {6570, 5752}, {6573, 5753}, {6572, 5754}, {6575, 5755}, {6584, 5756}, {6583, 5757}, {6560, 5758},
+    {6563, 5759}, {6562, 5760}, {6565, 5761}, {6564, 5762}, {6577, 5763}, {6576, 5764}, {6617, 5765}, {6616, 5766},
+    {6619, 5767}, {6618, 5768}, {6621, 5769}, {6602, 5770}, {6601, 5771}, {6622, 5772}, {6609, 5773}, {6608, 5774},
+    {6611, 5775}, {6610, 5776}, {6595, 5777}, {6594, 5778}, {6152, 5571}, {6615, 5779}, {6614, 5780}, {6151, 5570},
+    {6601, 5781}, {6600, 5782}, {6603, 5783}, {6620, 5784}, {6619, 5785}, {6618, 5786}, {6617, 5787}, {6606, 5788},
+    {6593, 5789}, {6592, 5790}, {6595, 5791}, {6594, 5792}, {6611, 5793}, {6610, 5794}, {6599, 5795}, {6598, 5796},
+    {6649, 5797}, {6648, 5798}, {6651, 5799}, {6627, 5800}, {6635, 5801}, {6634, 5802}, {6655, 5803}, {6654, 5804},
+    {6641, 5805}, {6640, 5806}, {6643, 5807}, {6628, 5808}, {6627, 5809}, {6644, 5810}, {6647, 5811}, {6646, 5812},
+    {6633, 5813}, {6632, 5814}, {6653, 5815}, {6652, 5816}, {6637, 5817}, {6636, 5818}, {6639, 5819}, {6638, 5820},
+    {6625, 5821}, {6646, 5822}, {6645, 5823}, {6626, 5824}, {6629, 5825}, {6628, 5826}, {6631, 5827}, {6630, 5828},
+    {6415, 5829}, {6414, 5830}, {6427, 5831}, {6426, 5832}, {6429, 5833}, {6428, 5834}, {6431, 5835}, {6408, 5836},
+    {6407, 5837}, {6416, 5838}, {6419, 5839}, {6418, 5840}, {6421, 5841}, {6420, 5842}, {6401, 5843}, {6400, 5844},
+    {6409, 5845}, {6408, 5846}, {6411, 5847}, {6410, 5848}, {6413, 5849}, {6426, 5850}, {6425, 5851}, {6414, 5852},
+    {6401, 5853}, {6400, 5854}, {6403, 5855}, {6402, 5856}, {6419, 5857}, {6418, 5858}, {6417, 5859}, {6416, 5860},
+    {6424, 5861}, {6425, 5863}, {6572, 5868}, {6573, 5869}, {6477, 5862}, {6475, 5864}, {6476, 5862}, {6474, 5864},
+    {6473, 5865}, {6471, 5866}, {6472, 5865}, {6470, 5866}, {6469, 5867}, {6448, 5870}, {6468, 5867}, {6449, 5871},
+    {6452, 5872}, {6453, 5873}, {6456, 5874}, {6574, 5875}, {6575, 5876}, {6457, 5877}, {6460, 5878}, {6461, 5879},
+    {6464, 5880}, {6465, 5881}, {6596, 5882}, {6597, 5883}, {6472, 5884}, {6473, 5885}, {6476, 5886}, {6477, 5887},
+    {6480, 5888}, {6441, 5889}, {6481, 5890}, {6440, 5889}, {6484, 5891}, {6485, 5892}, {6488, 5893}, {6489, 5894},
+    {6451, 5895}, {6496, 5896}, {6450, 5895}, {6497, 5897}, {6500, 5898}, {6501, 5899}, {6504, 5900}, {6486, 5901},
+    {6623, 5902}, {6473, 5903}, {6467, 5905}, {6636, 5906}, {6637, 5907}, {6638, 5908}, {6413, 5909}, {6525, 6143},
+    {6524, 6140}, {6527, 5919}, {6526, 5920}, {6497, 5934}, {6796, 5948}, {6525, 5934}, {6792, 5949}, {6789, 5970},
+    {6509, 5935}, {6508, 5952}, {6504, 5953}, {6785, 5971}, {6519, 5953}, {6824, 5968}, {6526, 5935}, {6516, 5952},
+    {6837, 5954}, {6676, 5936}, {6681, 5937}, {6685, 5938}, {6851, 5939}, {6831, 6105}, {6808, 5954}, {6821, 6108},
+    {6820, 5951}, {6841, 5984}, {6860, 6002}, {6840, 5985}, {6856, 6003}, {6819, 5985}, {6853, 6000}, {6818, 5984},
+    {6821, 5986}, {6817, 5987}, {6849, 6001}, {6829, 5988}, {6892, 6006}, {6846, 5988}, {6841, 5986}, {6845, 5987},
+    {6713, 5969}, {6717, 5972}, {6884, 5973}, {6885, 5974}, {6888, 5975}, {6889, 5976}, {6892, 5977}, {6718, 5978},
+    {6719, 5979}, {6736, 5980}, {6740, 5981}, {6893, 5982}, {6896, 5983}, {6897, 5989}, {6901, 5990}, {6905, 5991},
+    {6745, 5992}, {6749, 5993}, {6909, 5994}, {6656, 5995}, {6657, 5996}, {6660, 5997}, {6661, 5998}, {6772, 5999},
+    {6778, 6004}, {6664, 6005}, {6665, 6007}, {6668, 6008}, {6669, 6009}, {6672, 6010}, {6780, 6011}, {6801, 6012},
+    {6676, 6013}, {6677, 6014}, {6680, 6015}, {6681, 6016}, {6684, 6017}, {6803, 6018}, {6813, 6019}, {6688, 6020},
+    {6689, 6021}, {6692, 6022}, {6693, 6023}, {6696, 6024}, {6815, 6025}, {6825, 6026}, {6700, 6027}, {6701, 6028},
+    {6704, 6029}, {6705, 6030}, {6708, 6031}, {6827, 6032}, {6837, 6033}, {6712, 6034}, {6713, 6035}, {6716, 6036},
+    {6717, 6037}, {6720, 6038}, {6724, 6040}, {6725, 6041}, {6744, 6039}, {6728, 6042}, {6702, 6039}, {6729, 6043},
+    {6732, 6044}, {6851, 6045}, {6861, 6046}, {6736, 6047}, {6737, 6048}, {6740, 6049}, {6741, 6050}, {6744, 6051},
+    {6863, 6052}, {6873, 6053}, {6748, 6054}, {6749, 6055}, {6752, 6056}, {6753, 6057}, {6756, 6058}, {6875, 6059},
+    {6885, 6060}, {6760, 6061}, {6761, 6062}, {6764, 6063}, {6765, 6064}, {6768, 6065}, {6887, 6066}, {6897, 6067},
+    {6772, 6068}, {6773, 6069}, {6776, 6070}, {6777, 6071}, {6780, 6072}, {6899, 6073}, {6909, 6074}, {7040, 6075},
+    {7041, 6076}, {7044, 6077}, {7045, 6078}, {7048, 6079}, {6911, 6080}, {6921, 6081}, {7052, 6082}, {7053, 6083},
+    {7056, 6084}, {7057, 6085}, {7060, 6086}, {6923, 6087}, {6933, 6088}, {7064, 6089}, {7065, 6090}, {7068, 6091},
+    {7069, 6092}, {7072, 6093}, {6935, 6094}, {6945, 6095}, {7076, 6096}, {7077, 6097}, {7080, 6098}, {7081, 6099},
+    {7084, 6100}, {6947, 6101}, {6957, 6102}, {7088, 6103}, {7089, 6104}, {7092, 6106}, {7093, 6107}, {7096, 6109},
+    {6959, 6110}, {6969, 6111}, {7100, 6112}, {7101, 6113}, {7104, 6114}, {7105, 6115}, {7108, 6116}, {6971, 6117},
+    {6981, 6118}, {7112, 6119}, {7113, 6120}, {7116, 6121}, {7117, 6122}, {7120, 6123}, {6983, 6124}, {6993, 6125},
+    {7124, 6126}, {7125, 6127}, {7128, 6128}, {7129, 6129}, {7132, 6130}, {6995, 6131}, {7005, 6132}, {7136, 6133},
+    {7137, 6134}, {7140, 6135}, {7141, 6136}, {7144, 6137}, {7007, 6138}, {7017, 6139}, {7148, 6141}, {7149, 6142},
+    {7152, 6144}, {7153, 6145}, {7156, 6146}, {7019, 6147}, {7029, 6148}, {7031, 6149}, {7032, 6150}, {7161, 6151},
+    {7164, 6152}, {7165, 6153}, {6912, 6154}, {6913, 6155}, {7034, 6156}, {7044, 6157}, {6917, 6158}, {6920, 6159},
+    {6921, 6160}, {6924, 6161}, {6925, 6162}, {6923, 6163}, {7056, 6164}, {7057, 6165}, {6932, 6166}, {6933, 6167},
+    {6936, 6168}, {6937, 6169}, {6940, 6170}, {7058, 6171}, {7059, 6172}, {6941, 6173}, {6944, 6174}, {6945, 6175},
+    {6948, 6176}, {6949, 6177}, {7080, 6178}, {7081, 6179}, {6956, 6180}, {6957, 6181}, {6960, 6182}, {6961, 6183},
+    {6964, 6184}, {7082, 6185}, {7083, 6186}, {6965, 6187}, {6968, 6188}, {6969, 6189}, {6972, 6190}, {6973, 6191},
+    {7104, 6192}, {7105, 6193}, {6980, 6194}, {6981, 6195}, {6984, 6196}, {6985, 6197}, {6988, 6198}, {7106, 6199},
+    {7107, 6200}, {6989, 6201}, {6992, 6202}, {6993, 6203}, {6996, 6204}, {6997, 6205}, {7128, 6206}, {7129, 6207},
+    {7004, 6208}, {7005, 6209}, {7008, 6210}, {7009, 6211}, {7012, 6212}, {7130, 6213}, {7131, 6214}, {7013, 6215},
+    {7016, 6216}, {7017, 6217}, {7020, 6218}, {7021, 6219}, {7152, 6220}, {7153, 6221}, {7154, 6222}, {7155, 6223},
+    {7035, 6224}, {7034, 6225}, {6990, 6228}, {6991, 6230}, {6976, 6229}, {6977, 6231}, {6978, 6232}, {6979, 6234},
+    {6980, 6233}, {6981, 6235}, {6982, 6236}, {6983, 6238}, {990, 6226}, {1194, 6227}, {1338, 6243}, {1394, 6244},
+    {7407, 6237}, {7405, 6239}, {7406, 6237}, {7404, 6239}, {7403, 6240}, {7401, 6241}, {7402, 6240}, {7400, 6241},
+    {7399, 6242}, {7397, 6245}, {7398, 6242}, {7396, 6245}, {7395, 6246}, {7393, 6247}, {7394, 6246}, {7392, 6247},
+    {7423, 6248}, {7421, 6249}, {7422, 6248}, {7420, 6249}, {544, 6250}, {1466, 6251}, {7334, 6257}, {7335, 6259},
+    {7419, 6252}, {7417, 6253}, {7418, 6252}, {7416, 6253}, {7415, 6254}, {7413, 6255}, {7414, 6254}, {7412, 6255},
+    {7411, 6256}, {7375, 6258}, {7410, 6256}, {7374, 6258}, {7373, 6260}, {7371, 6261}, {7372, 6260}, {7370, 6261},
+    {7369, 6262}, {7367, 6263}, {7368, 6262}, {7366, 6263}, {7314, 6264}, {7315, 6266}, {7222, 6271}, {245, 6272},
+    {7363, 6265}, {7361, 6267}, {7362, 6265}, {7360, 6267}, {7391, 6268}, {7389, 6269}, {7390, 6268}, {7388, 6269},
+    {7387, 6270}, {7350, 6273}, {7386, 6270}, {7383, 6274}, {1339, 6275}, {2124, 6276}, {883, 6277}, {7353, 6278},
+    {7370, 6279}, {7371, 6280}, {7372, 6281}, {7373, 6282}, {7377, 6283}, {7343, 6285}, {7334, 6294}, {7376, 6283},
+    {7337, 6288}, {7354, 6289}, {7350, 6289}, {7336, 6288}, {7349, 6295}, {7345, 6290}, {7344, 6290}, {7308, 6292},
+    {7423, 6284}, {7409, 6284}, {7376, 6284}, {7395, 6284}, {7413, 6286}, {7423, 6286}, {7363, 6286}, {7417, 6286},
+    {7407, 6287}, {7397, 6287}, {7369, 6287}, {7374, 6287}, {7391, 6291}, {7383, 6291}, {7387, 6291}, {7187, 6291},
+    {7316, 6302}, {7362, 6287}, {7392, 6286}, {7362, 6291}, {2038, 6297}, {7382, 6291}, {7365, 6284}, {7379, 6287},
+    {7395, 6284}, {2619, 6298}, {7402, 6286}, {7405, 6291}, {7412, 6286}, {1098, 6299}, {7409, 6284}, {7393, 6287},
+    {7322, 6296}, {7174, 6300}, {7287, 6301}, {7320, 6296}, {7362, 6293}, {7374, 6293}, {7186, 6293}, {7209, 6293},
+    {7289, 6303}, {7290, 6304}, {7266, 6311}, {7288, 6309}, {7268, 6305}, {7290, 6307}, {7289, 6307}, {7267, 6305},
+    {7235, 6312}, {7233, 6318}, {7171, 6293}, {7234, 6312}, {7262, 6313}, {7250, 6319}, {7204, 6317}, {7251, 6313},
+    {7209, 6315}, {1431, 6320}, {7219, 6293}, {7206, 6315}, {7202, 6293}, {1289, 6321}, {1093, 6327}, {49, 6328},
+    {7214, 6306}, {7201, 6306}, {7168, 6306}, {7219, 6306}, {7207, 6308}, {7208, 6308}, {7183, 6308}, {7176, 6308},
+    {7171, 6310}, {7185, 6310}, {7192, 6310}, {7251, 6310}, {7280, 6314}, {7292, 6314}, {7267, 6314}, {7255, 6314},
+    {301, 6329}, {7187, 6310}, {7210, 6308}, {7281, 6314}, {1103, 6330}, {7264, 6314}, {7200, 6306}, {7170, 6310},
+    {7219, 6306}, {1120, 6336}, {7194, 6308}, {7237, 6314}, {7173, 6308}, {1673, 6337}, {7201, 6306}, {7233, 6310},
+    {7281, 6316}, {7267, 6316}, {7234, 6316}, {7289, 6316}, {7225, 6322}, {7221, 6323}, {7222, 6322}, {7220, 6323},
+    {7219, 6324}, {7182, 6325}, {7218, 6324}, {7181, 6325}, {7180, 6326}, {7178, 6331}, {7179, 6326}, {7176, 6331},
+    {7175, 6332}, {7172, 6333}, {7174, 6332}, {7171, 6333}, {2112, 6343}, {7170, 6334}, {7264, 6316}, {7169, 6334},
+    {7282, 6316}, {7168, 6335}, {1242, 6344}, {7199, 6335}, {653, 6350}, {7198, 6338}, {7267, 6316}, {7195, 6338},
+    {7194, 6339}, {7191, 6340}, {7193, 6339}, {7190, 6340}, {7189, 6341}, {7186, 6342}, {7187, 6341}, {7185, 6342},
+    {7663, 6345}, {7661, 6346}, {7662, 6345}, {7660, 6346}, {7659, 6347}, {7657, 6348}, {7658, 6347}, {7656, 6348},
+    {7655, 6349}, {681, 6351}, {7654, 6349}, {2743, 6357}, {7653, 6352}, {7651, 6353}, {7652, 6352}, {7650, 6353},
+    {7649, 6354}, {7679, 6355}, {7648, 6354}, {7678, 6355}, {7677, 6356}, {2196, 6358}, {7676, 6356}, {2783, 6364},
+    {7675, 6359}, {7673, 6360}, {7674, 6359}, {7672, 6360}, {7671, 6361}, {7669, 6362}, {7670, 6361}, {7668, 6362},
+    {7667, 6363}, {2342, 6365}, {7666, 6363}, {1920, 6371}, {7665, 6366}, {7631, 6367}, {7664, 6366}, {7630, 6367},
+    {7629, 6368}, {7627, 6369}, {7628, 6368}, {7626, 6369}, {7625, 6370}, {1354, 6372}, {7624, 6370}, {7562, 6380},
+    {7623, 6373}, {7621, 6374}, {7622, 6373}, {7620, 6374}, {7619, 6375}, {7617, 6376}, {7618, 6375}, {7616, 6376},
+    {7647, 6377}, {7563, 6382}, {7646, 6377}, {1655, 6385}, {7643, 6378}, {7641, 6379}, {7642, 6378}, {7640, 6379},
+    {7639, 6381}, {7637, 6383}, {7638, 6381}, {7636, 6383}, {7635, 6384}, {1180, 6386}, {7634, 6384}, {365, 6392},
+    {7633, 6387}, {7599, 6388}, {7632, 6387}, {7598, 6388}, {7597, 6389}, {7595, 6390}, {7596, 6389}, {7594, 6390},
+    {7593, 6391}, {1767, 6393}, {7592, 6391}, {1552, 6399}, {7591, 6394}, {7589, 6395}, {7590, 6394}, {7588, 6395},
+    {7587, 6396}, {7585, 6397}, {7586, 6396}, {7584, 6397}, {7615, 6398}, {2310, 6400}, {7614, 6398}, {2506, 6406},
+    {7613, 6401}, {7611, 6402}, {7612, 6401}, {7610, 6402}, {7609, 6403}, {7607, 6404}, {7608, 6403}, {7606, 6404},
+    {7605, 6405}, {1496, 6407}, {7604, 6405}, {960, 6413}, {7603, 6408}, {7601, 6409}, {7602, 6408}, {7600, 6409},
+    {7567, 6410}, {7565, 6411}, {7566, 6410}, {7564, 6411}, {7563, 6412}, {547, 6414}, {7562, 6412}, {1574, 6420},
+    {7561, 6415}, {7559, 6416}, {7560, 6415}, {7558, 6416}, {7557, 6417}, {7555, 6418}, {7556, 6417}, {7554, 6418},
+    {7553, 6419}, {2087, 6421}, {7552, 6419}, {1115, 6427}, {7583, 6422}, {7581, 6423}, {7582, 6422}, {7580, 6423},
+    {7579, 6424}, {7577, 6425}, {7578, 6424}, {7576, 6425}, {7575, 6426}, {1210, 6428}, {7574, 6426}, {1773, 6434},
+    {7573, 6429}, {7571, 6430}, {7572, 6429}, {7570, 6430}, {7569, 6431}, {7535, 6432}, {7568, 6431}, {7534, 6432},
+    {7533, 6433}, {2181, 6435}, {7532, 6433}, {1810, 6441}, {7531, 6436}, {7529, 6437}, {7530, 6436}, {7528, 6437},
+    {7527, 6438}, {7525, 6439}, {7526, 6438}, {7524, 6439}, {7523, 6440}, {845, 6442}, {7522, 6440}, {202, 6448},
+    {7521, 6443}, {7551, 6444}, {7520, 6443}, {7550, 6444}, {7549, 6445}, {7547, 6446}, {7548, 6445}, {7546, 6446},
+    {7545, 6447}, {2780, 6449}, {7544, 6447}, {717, 6455}, {7543, 6450}, {7541, 6451}, {7542, 6450}, {7540, 6451},
+    {7539, 6452}, {7537, 6453}, {7538, 6452}, {7536, 6453}, {7503, 6454}, {1122, 6456}, {7502, 6454}, {402, 6462},
+    {7501, 6457}, {7499, 6458}, {7500, 6457}, {7498, 6458}, {7497, 6459}, {7495, 6460}, {7496, 6459}, {7494, 6460},
+    {7493, 6461}, {605, 6463}, {7492, 6461}, {1368, 6469}, {7491, 6464}, {7489, 6465}, {7490, 6464}, {7488, 6465},
+    {7519, 6466}, {7517, 6467}, {7518, 6466}, {7516, 6467}, {7515, 6468}, {1742, 6470}, {7514, 6468}, {1877, 6476},
+    {7513, 6471}, {7511, 6472}, {7512, 6471}, {7510, 6472}, {7509, 6473}, {7507, 6474}, {7508, 6473}, {7506, 6474},
+    {7505, 6475}, {467, 6477}, {7504, 6475}, {380, 6483}, {7471, 6478}, {7469, 6479}, {7470, 6478}, {7468, 6479},
+    {7467, 6480}, {7465, 6481}, {7466, 6480}, {7464, 6481}, {7463, 6482}, {1568, 6484}, {7462, 6482}, {1047, 6485},
+    {762, 6486}, {7461, 6487}, {1060, 6492}, {7460, 6487}, {7459, 6488}, {7457, 6489}, {7458, 6488}, {7456, 6489},
+    {7487, 6490}, {7485, 6491}, {7486, 6490}, {7484, 6491}, {1845, 6493}, {7483, 6494}, {7470, 6499}, {7482, 6494},
+    {7481, 6495}, {7479, 6496}, {7480, 6495}, {7478, 6496}, {7477, 6497}, {7475, 6498}, {7476, 6497}, {7474, 6498},
+    {934, 6500}, {203, 6501}, {847, 6507}, {2012, 6508}, {7472, 6502}, {7438, 6503}, {7439, 6502}, {7437, 6503},
+    {7436, 6504}, {7434, 6505}, {7435, 6504}, {7433, 6505}, {7432, 6506}, {7430, 6509}, {7431, 6506}, {7429, 6509},
+    {7428, 6510}, {7426, 6511}, {7427, 6510}, {7425, 6511}, {7424, 6512}, {7454, 6513}, {7455, 6512}, {7453, 6513},
+    {2703, 6514}, {162, 6515}, {2435, 6521}, {1417, 6522}, {7452, 6516}, {7450, 6517}, {7451, 6516}, {7449, 6517},
+    {7448, 6518}, {7446, 6519}, {7447, 6518}, {7445, 6519}, {7444, 6520}, {7442, 6523}, {7443, 6520}, {7441, 6523},
+    {7440, 6524}, {7918, 6525}, {7919, 6524}, {7917, 6525}, {7916, 6526}, {7914, 6527}, {7915, 6526}, {7913, 6527},
+    {2471, 6528}, {1421, 6529}, {2650, 6535}, {1978, 6536}, {7912, 6530}, {7910, 6531}, {7911, 6530}, {7909, 6531},
+    {7908, 6532}, {7906, 6533}, {7907, 6532}, {7905, 6533}, {7904, 6534}, {7934, 6537}, {7935, 6534}, {7933, 6537},
+    {7932, 6538}, {7930, 6539}, {7931, 6538}, {7929, 6539}, {7928, 6540}, {7926, 6541}, {7927, 6540}, {7925, 6541},
+    {776, 6542}, {349, 6543}, {2802, 6549}, {1846, 6550}, {7924, 6544}, {7922, 6545}, {7923, 6544}, {7921, 6545},
+    {7920, 6546}, {7886, 6547}, {7887, 6546}, {7885, 6547}, {7884, 6548}, {7882, 6551}, {7883, 6548}, {7881, 6551},
+    {7880, 6552}, {7878, 6553}, {7879, 6552}, {7877, 6553}, {7876, 6554}, {7874, 6555}, {7875, 6554}, {7873, 6555},
+    {1272, 6556}, {2360, 6557}, {1400, 6558}, {2445, 6559}, {7727, 6560}, {7728, 6561}, {7870, 6562}, {7869, 6563},
+    {7868, 6564}, {7867, 6565}, {7866, 6566}, {7865, 6567}, {7864, 6568}, {7863, 6569}, {7862, 6570}, {7861, 6571},
+    {7811, 6576}, {7812, 6578}, {7813, 6577}, {7814, 6579}, {7815, 6580}, {7928, 6582}, {7929, 6581}, {7930, 6583},
+    {7931, 6584}, {7932, 6586}, {7933, 6585}, {7934, 6587}, {7935, 6588}, {7920, 6590}, {7921, 6589}, {7922, 6591},
+    {7923, 6592}, {7924, 6594}, {7925, 6593}, {7926, 6595}, {7927, 6600}, {7912, 6602}, {7913, 6601}, {7914, 6603},
+    {7915, 6604}, {7916, 6606}, {7917, 6605}, {7918, 6607}, {7919, 6608}, {7904, 6610}, {7894, 6598}, {7893, 6599},
+    {7907, 6609}, {7908, 6611}, {7909, 6612}, {7910, 6614}, {7911, 6613}, {7896, 6615}, {7897, 6616}, {7898, 6618},
+    {7899, 6617}, {7900, 6619}, {7914, 6620}, {7913, 6621}, {7903, 6624}, {7888, 6626}, {7889, 6625}, {7890, 6627},
+    {7891, 6628}, {7892, 6630}, {7893, 6629}, {7894, 6631}, {7895, 6632}, {7880, 6634}, {855, 6622}, {7717, 6633},
+    {7881, 6635}, {7935, 6639}, {7916, 6640}, {7915, 6641}, {7914, 6642}, {7913, 6643}, {7887, 6644}, {7872, 6647},
+    {7873, 6645}, {7802, 6656}, {7803, 6657}, {7804, 6658}, {7812, 6680}, {7814, 6678}, {7728, 6648}, {7729, 6651},
+    {7807, 6659}, {7730, 6646}, {7810, 6686}, {7819, 6660}, {7820, 6661}, {7811, 6686}, {7809, 6659}, {7813, 6680},
+    {7821, 6662}, {7827, 6682}, {7824, 6663}, {7829, 6684}, {7825, 6663}, {7714, 6649}, {7828, 6682}, {7815, 6678},
+    {7831, 6684}, {7715, 6650}, {7716, 6652}, {7837, 6665}, {7838, 6664}, {7839, 6667}, {7698, 6653}, {7699, 6654},
+    {7832, 6674}, {7848, 6687}, {7842, 6666}, {7700, 6655}, {7843, 6666}, {7846, 6673}, {7841, 6667}, {7822, 6662},
+    {7844, 6679}, {7853, 6669}, {7840, 6667}, {7823, 6662}, {7854, 6668}, {7864, 6683}, {7847, 6673}, {7845, 6679},
+    {7858, 6670}, {7862, 6677}, {7833, 6674}, {7849, 6687}, {7805, 6658}, {7682, 6688}, {7859, 6670}, {7683, 6691},
+    {7806, 6658}, {7860, 6675}, {7863, 6677}, {7684, 6672}, {7869, 6692}, {7870, 6693}, {7861, 6675}, {7865, 6683},
+    {7855, 6671}, {7871, 6694}, {7874, 6695}, {7880, 6706}, {7875, 6695}, {7878, 6716}, {7751, 6689}, {7764, 6690},
+    {7876, 6714}, {7763, 6696}, {7762, 6697}, {7798, 6700}, {7799, 6703}, {7784, 6698}, {7879, 6716}, {7877, 6714},
+    {7889, 6720}, {7881, 6706}, {7890, 6721}, {7891, 6722}, {7898, 6744}, {7782, 6701}, {7783, 6702}, {7768, 6699},
+    {7894, 6723}, {7905, 6724}, {7896, 6750}, {7906, 6725}, {7907, 6726}, {7897, 6750}, {7895, 6723}, {7899, 6744},
+    {7900, 6742}, {7912, 6746}, {7914, 6748}, {7910, 6727}, {7892, 6722}, {7911, 6727}, {7913, 6746}, {7909, 6726},
+    {7893, 6722}, {7915, 6748}, {7916, 6738}, {7908, 6726}, {7766, 6704}, {7767, 6707}, {7752, 6705}, {7921, 6729},
+    {7922, 6728}, {7750, 6708}, {7901, 6742}, {7926, 6730}, {7930, 6737}, {7927, 6730}, {7872, 6694}, {7856, 6671},
+    {7917, 6738}, {7928, 6743}, {7873, 6694}, {7857, 6671}, {7751, 6711}, {8120, 6709}, {7929, 6743}, {7931, 6737},
+    {7923, 6731}, {7932, 6751}, {7937, 6733}, {7938, 6732}, {7939, 6735}, {7948, 6747}, {8118, 6712}, {7946, 6741},
+    {7942, 6734}, {8119, 6715}, {7944, 6739}, {8104, 6710}, {7947, 6741}, {7945, 6739}, {7943, 6734}, {7953, 6752},
+    {7954, 6753}, {7955, 6754}, {7958, 6755}, {7933, 6751}, {7959, 6755}, {7962, 6776}, {8102, 6756}, {7949, 6747},
+    {7960, 6782}, {8103, 6758}, {8088, 6757}, {8089, 6759}, {8090, 6760}, {8091, 6762}, {7963, 6776}, {7961, 6782},
+    {7964, 6774}, {8092, 6761}, {8093, 6763}, {8094, 6764}, {8095, 6766}, {8080, 6765}, {7956, 6754}, {8081, 6767},
+    {8082, 6768}, {8083, 6770}, {7957, 6754}, {8084, 6769}, {8085, 6771}, {8086, 6773}, {8087, 6775}, {8072, 6777},
+    {8073, 6779}, {8074, 6781}, {7965, 6774}, {7940, 6735}, {8075, 6783}, {8076, 6784}, {8077, 6786}, {7924, 6731},
+    {8078, 6785}, {8079, 6787}, {8064, 6788}, {7925, 6731}, {8065, 6790}, {8066, 6789}, {8067, 6791}, {7941, 6735},
+    {8068, 6792}, {8069, 6794}, {8070, 6793}, {8071, 6795}, {8184, 6796}, {8185, 6798}, {8186, 6797}, {8187, 6799},
+    {8188, 6800}, {8189, 6802}, {8190, 6804}, {8191, 6806}, {8176, 6805}, {8177, 6807}, {8178, 6808}, {8179, 6810},
+    {8180, 6809}, {8181, 6811}, {8182, 6812}, {8183, 6814}, {8168, 6816}, {8169, 6818}, {8170, 6817}, {8171, 6819},
+    {8172, 6820}, {8173, 6822}, {8174, 6821}, {8175, 6823}, {8160, 6824}, {8161, 6826}, {8162, 6828}, {8163, 6830},
+    {8164, 6829}, {8165, 6831}, {8166, 6832}, {8167, 6834}, {8152, 6833}, {8153, 6835}, {8154, 6836}, {8155, 6838},
+    {8156, 6840}, {8157, 6842}, {8158, 6841}, {8159, 6843}, {8144, 6844}, {8145, 6846}, {8146, 6845}, {8147, 6847},
+    {8148, 6848}, {8149, 6850}, {8161, 6839}, {8160, 6849}, {8136, 6852}, {8137, 6854}, {8138, 6853}, {8139, 6855},
+    {8140, 6856}, {8141, 6858}, {8142, 6857}, {8143, 6859}, {8128, 6860}, {8129, 6862}, {8130, 6864}, {8131, 6866},
+    {8132, 6865}, {8133, 6867}, {8134, 6868}, {8135, 6870}, {7992, 6869}, {7993, 6871}, {7994, 6872}, {7995, 6874},
+    {7996, 6876}, {7997, 6878}, {7998, 6877}, {7999, 6879}, {7984, 6880}, {7985, 6882}, {7986, 6881}, {7987, 6883},
+    {7988, 6884}, {7989, 6886}, {7990, 6888}, {7991, 6890}, {7976, 6889}, {7977, 6891}, {7978, 6892}, {7979, 6894},
+    {7980, 6893}, {7981, 6895}, {7982, 6896}, {7983, 6898}, {7968, 6900}, {7969, 6902}, {7970, 6901}, {7971, 6903},
+    {7972, 6904}, {7973, 6906}, {7974, 6905}, {7975, 6907}, {7960, 6908}, {7961, 6910}, {7962, 6912}, {7963, 6914},
+    {7964, 6913}, {7965, 6915}, {7966, 6916}, {7967, 6918}, {7952, 6917}, {7953, 6919}, {7954, 6920}, {7955, 6922},
+    {7956, 6924}, {7957, 6926}, {7958, 6925}, {7959, 6927}, {7944, 6928}, {7945, 6930}, {7946, 6929}, {7947, 6931},
+    {7948, 6932}, {7949, 6934}, {7950, 6936}, {7951, 6938}, {7936, 6937}, {7937, 6939}, {7938, 6940}, {7939, 6942},
+    {7940, 6941}, {7941, 6943}, {7942, 6944}, {7943, 6946}, {8056, 6948}, {8057, 6950}, {8058, 6949}, {8059, 6951},
+    {8060, 6952}, {8061, 6954}, {8062, 6953}, {8063, 6955}, {8048, 6956}, {8049, 6958}, {8050, 6960}, {8051, 6962},
+    {8052, 6961}, {8053, 6963}, {8054, 6964}, {8055, 6966}, {8040, 6965}, {8041, 6967}, {8042, 6968}, {8043, 6970},
+    {8044, 6972}, {8045, 6974}, {8046, 6973}, {8047, 6975}, {8032, 6976}, {8033, 6978}, {8034, 6977}, {8035, 6979},
+    {8036, 6980}, {8037, 6982}, {8038, 6984}, {8039, 6986}, {8024, 6985}, {8025, 6987}, {8026, 6988}, {8027, 6990},
+    {8028, 6989}, {8029, 6991}, {8030, 6992}, {8031, 6994}, {8016, 6996}, {8017, 6998}, {8018, 6997}, {8019, 6999},
+    {8020, 7000}, {8021, 7002}, {8022, 7001}, {8023, 7003}, {8008, 7004}, {8009, 7006}, {8010, 7008}, {8011, 7010},
+    {8012, 7009}, {8013, 7011}, {8014, 7012}, {8015, 7014}, {8000, 7013}, {8001, 7015}, {8002, 7016}, {8003, 7018},
+    {8004, 7020}, {8005, 7022}, {8006, 7021}, {8007, 7023}, {8376, 7024}, {8377, 7026}, {8378, 7025}, {8379, 7027},
+    {8380, 7028}, {8381, 7030}, {8382, 7033}, {8383, 7035}, {8368, 7036}, {8369, 7038}, {8370, 7037}, {8371, 7039},
+    {8372, 7040}, {8373, 7042}, {8374, 7041}, {8375, 7043}, {8360, 7045}, {8361, 7047}, {8362, 7048}, {8363, 7050},
+    {8364, 7049}, {8365, 7051}, {8366, 7052}, {8367, 7054}, {8352, 7053}, {8353, 7055}, {8325, 7046}, {8355, 7060},
+    {8356, 7062}, {8357, 7061}, {8358, 7063}, {8359, 7064}, {8344, 7066}, {8345, 7065}, {8346, 7067}, {8347, 7068},
+    {8348, 7070}, {8349, 7069}, {8350, 7071}, {8351, 7072}, {8336, 7074}, {8337, 7073}, {8338, 7075}, {8339, 7076},
+    {8340, 7078}, {8341, 7077}, {8342, 7079}, {8343, 7084}, {8328, 7086}, {8329, 7085}, {8330, 7087}, {8331, 7088},
+    {8332, 7090}, {8333, 7089}, {8334, 7091}, {8335, 7092}, {8320, 7094}, {8321, 7093}, {8322, 7095}, {8323, 7096},
+    {8324, 7098}, {8325, 7097}, {8326, 7099}, {8327, 7100}, {8440, 7102}, {8441, 7101}, {8442, 7103}, {8443, 7108},
+    {8444, 7110}, {8445, 7109}, {8446, 7111}, {8447, 7112}, {8432, 7114}, {8433, 7113}, {8434, 7115}, {8435, 7116},
+    {8436, 7118}, {8437, 7117}, {8438, 7119}, {8439, 7120}, {8424, 7122}, {8425, 7121}, {8426, 7123}, {8427, 7124},
+    {8428, 7126}, {8429, 7125}, {8430, 7127}, {8431, 7132}, {8416, 7134}, {8417, 7133}, {8418, 7135}, {8419, 7136},
+    {8420, 7138}, {8421, 7137}, {8422, 7139}, {8423, 7140}, {8408, 7142}, {8409, 7141}, {8410, 7143}, {8411, 7144},
+    {8412, 7146}, {8413, 7145}, {8414, 7147}, {8415, 7148}, {8400, 7150}, {8401, 7149}, {8402, 7151}, {1396, 7156},
+    {1080, 7157}, {8299, 7158}, {8300, 7159}, {8301, 7160}, {8302, 7161}, {8303, 7162}, {8304, 7163}, {8305, 7164},
+    {8306, 7165}, {8307, 7166}, {8308, 7167}, {8442, 7168}, {8441, 7169}, {8440, 7170}, {8439, 7171}, {8438, 7172},
+    {8437, 7173}, {8436, 7174}, {8435, 7175}, {8434, 7176}, {8433, 7177}, {8432, 7178}, {8207, 7179}, {8206, 7180},
+    {8205, 7181}, {8204, 7182}, {8203, 7183}, {8202, 7184}, {8201, 7185}, {8200, 7186}, {8199, 7187}, {8198, 7188},
+    {8197, 7189}, {8196, 7190}, {8195, 7191}, {8194, 7192}, {8193, 7193}, {8192, 7194}, {8223, 7195}, {8222, 7196},
+    {8221, 7197}, {8339, 7198}, {8340, 7199}, {8218, 7200}, {8217, 7201}, {8216, 7202}, {8215, 7203}, {8214, 7204},
+    {8213, 7205}, {8212, 7206}, {8211, 7207}, {8210, 7208}, {8209, 7209}, {8351, 7210}, {8352, 7211}, {8238, 7212},
+    {8237, 7213}, {8236, 7214}, {8235, 7215}, {8234, 7216}, {8233, 7217}, {8232, 7218}, {8231, 7219}, {8230, 7220},
+    {8229, 7221}, {8225, 7224}, {8287, 7225}, {8225, 7226}, {8224, 7227}, {8227, 7228}, {8226, 7229}, {8251, 7230},
+    {8250, 7231}, {8249, 7232}, {376, 7233}, {1344, 7234}, {641, 7235}, {1925, 7284}, {2347, 7288}, {278, 7240},
+    {8280, 7223}, {256, 7246}, {1261, 7242}, {900, 7245}, {1857, 7236}, {2766, 7247}, {1073, 7237}, {58, 7255},
+    {8248, 7238}, {8247, 7239}, {8246, 7241}, {2165, 7243}, {1240, 7244}, {1815, 7248}, {151, 7271}, {2420, 7275},
+    {1132, 7250}, {1735, 7252}, {8286, 7223}, {2543, 7249}, {1808, 7254}, {2659, 7251}, {8287, 7223}, {1182, 7256},
+    {980, 7264}, {2781, 7282}, {8245, 7253}, {8244, 7257}, {8243, 7258}, {1519, 7259}, {2288, 7260}, {1926, 7261},
+    {2653, 7274}, {2731, 7270}, {2509, 7266}, {300, 7268}, {976, 7272}, {690, 7279}, {1110, 7269}, {1768, 7278},
+    {1641, 7265}, {1934, 7283}, {8242, 7262}, {8241, 7263}, {8240, 7267}, {1247, 7273}, {2234, 7276}, {1530, 7296},
+    {1557, 7351}, {1172, 7355}, {133, 7280}, {1001, 7286}, {2537, 7289}, {1025, 7294}, {1199, 7281}, {1550, 7290},
+    {179, 7277}, {60, 7295}, {8271, 7285}, {8270, 7287}, {8269, 7291}, {21, 7292}, {2019, 7293}, {115, 7297},
+    {2666, 7350}, {2777, 7354}, {1807, 7298}, {2517, 7300}, {313, 7304}, {2031, 7311}, {2209, 7301}, {2215, 7310},
+    {172, 7299}, {1303, 7313}, {8243, 7302}, {8277, 7303}, {8276, 7305}, {8279, 7306}, {8264, 7307}, {8263, 7308},
+    {8262, 7309}, {2325, 7312}, {2606, 7314}, {755, 7315}, {1977, 7332}, {1270, 7336}, {1821, 7320}, {1343, 7326},
+    {1331, 7322}, {370, 7325}, {241, 7316}, {1836, 7327}, {1924, 7328}, {336, 7346}, {8261, 7317}, {8260, 7318},
+    {8259, 7319}, {1224, 7321}, {1754, 7323}, {1867, 7324}, {2335, 7339}, {1045, 7335}, {1968, 7331}, {9, 7333},
+    {770, 7329}, {1123, 7334}, {305, 7330}, {2073, 7337}, {2256, 7338}, {394, 7352}, {8258, 7340}, {8257, 7341},
+    {8256, 7342}, {2704, 7343}, {572, 7344}, {184, 7360}, {914, 7415}, {2111, 7419}, {2483, 7347}, {409, 7349},
+    {2446, 7353}, {1903, 7358}, {2384, 7348}, {2793, 7359}, {1358, 7361}, {1361, 7379}, {8287, 7345}, {8286, 7356},
+    {8285, 7357}, {1618, 7362}, {1864, 7363}, {381, 7364}, {1737, 7411}, {936, 7423}, {386, 7368}, {1786, 7374},
+    {2199, 7370}, {1008, 7373}, {2177, 7367}, {122, 7372}, {1683, 7365}, {1031, 7383}, {8284, 7366}, {8283, 7369},
+    {8282, 7371}, {1092, 7375}, {612, 7376}, {571, 7377}, {2438, 7398}, {1952, 7402}, {2571, 7378}, {2617, 7380},
+    {736, 7384}, {2398, 7391}, {2638, 7381}, {1005, 7390}, {2808, 7392}, {2455, 7410}, {8281, 7382}, {8280, 7385},
+    {8279, 7386}, {8278, 7387}, {8277, 7388}, {8276, 7389}, {8275, 7393}, {8274, 7394}, {8273, 7395}, {8272, 7396},
+    {8303, 7397}, {8302, 7399}, {8301, 7400}, {8300, 7401}, {8299, 7403}, {8298, 7404}, {8297, 7405}, {8296, 7406},
+    {8295, 7407}, {8294, 7408}, {8293, 7409}, {8292, 7412}, {8291, 7413}, {8290, 7414}, {8289, 7416}, {8288, 7417},
+    {8319, 7418}, {8318, 7420}, {8317, 7421}, {8316, 7422}, {8315, 7424}, {8314, 7425}, {8313, 7426}, {8312, 7427},
+    {8311, 7428}, {8310, 7429}, {8309, 7430}, {8308, 7431}, {8307, 7432}, {8306, 7433}, {8305, 7434}, {8304, 7435},
+    {8591, 7436}, {8590, 7437}, {8589, 7438}, {8588, 7439}, {8587, 7440}, {8586, 7441}, {8585, 7442}, {8584, 7443},
+    {8583, 7444}, {8582, 7445}, {8581, 7446}, {8580, 7447}, {8579, 7448}, {8578, 7449}, {8577, 7450}, {8576, 7451},
+    {8607, 7452}, {8606, 7453}, {8605, 7454}, {8604, 7455}, {8603, 7456}, {8602, 7457}, {8601, 7458}, {8600, 7459},
+    {8599, 7460}, {8598, 7461}, {8597, 7462}, {8596, 7463}, {8595, 7464}, {8594, 7465}, {8593, 7466}, {8592, 7467},
+    {8623, 7468}, {8622, 7469}, {8621, 7470}, {8620, 7471}, {8619, 7472}, {8618, 7473}, {8486, 7474}, {8487, 7475},
+    {8615, 7476}, {8614, 7477}, {8613, 7478}, {8612, 7479}, {8611, 7480}, {8610, 7481}, {8609, 7482}, {8608, 7483},
+    {8639, 7484}, {8638, 7485}, {8637, 7486}, {8636, 7487}, {8635, 7488}, {8634, 7489}, {8633, 7490}, {8632, 7491},
+    {8631, 7492}, {8630, 7493}, {8629, 7494}, {8628, 7495}, {8627, 7496}, {8626, 7497}, {8625, 7498}, {8624, 7499},
+    {8655, 7500}, {8654, 7501}, {8653, 7502}, {8652, 7503}, {8651, 7504}, {8650, 7505}, {8649, 7506}, {8648, 7507},
+    {8647, 7508}, {8646, 7509}, {8645, 7510}, {8644, 7511}, {8643, 7512}, {8642, 7513}, {8641, 7514}, {8640, 7515},
+    {8671, 7516}, {8670, 7517}, {8669, 7518}, {8668, 7519}, {8667, 7520}, {8666, 7521}, {8665, 7522}, {8664, 7523},
+    {8663, 7524}, {8662, 7525}, {8661, 7526}, {8660, 7527}, {8659, 7528}, {8658, 7529}, {8657, 7530}, {8656, 7531},
+    {8687, 7532}, {8686, 7533}, {8685, 7534}, {8684, 7535}, {8683, 7536}, {8682, 7537}, {8681, 7538}, {8680, 7539},
+    {8679, 7540}, {8678, 7541}, {8677, 7542}, {8676, 7543}, {8675, 7544}, {8674, 7545}, {8673, 7546}, {8672, 7547},
+    {8703, 7548}, {8702, 7549}, {8701, 7550}, {8700, 7551}, {8699, 7552}, {8698, 7553}, {8697, 7554}, {8696, 7555},
+    {8695, 7556}, {8694, 7557}, {8693, 7558}, {8692, 7559}, {8691, 7560}, {8690, 7561}, {8689, 7562}, {8688, 7563},
+    {8463, 7564}, {8462, 7565}, {8461, 7566}, {8460, 7567}, {8459, 7568}, {8458, 7569}, {8457, 7570}, {8456, 7571},
+    {8455, 7572}, {8454, 7573}, {8453, 7574}, {8452, 7575}, {8451, 7576}, {8450, 7577}, {8449, 7578}, {8448, 7579},
+    {8479, 7580}, {8478, 7581}, {8477, 7582}, {8476, 7583}, {8475, 7584}, {8474, 7585}, {8473, 7586}, {8472, 7587},
+    {8471, 7588}, {8470, 7589}, {8469, 7590}, {8468, 7591}, {8467, 7592}, {8466, 7593}, {8465, 7594}, {8464, 7595},
+    {8495, 7596}, {8494, 7597}, {8493, 7598}, {8492, 7599}, {8491, 7600}, {8490, 7601}, {8489, 7602}, {8488, 7603},
+    {8487, 7604}, {8486, 7605}, {8485, 7606}, {8484, 7607}, {8483, 7608}, {8482, 7609}, {8481, 7610}, {8480, 7611},
+    {8511, 7612}, {8510, 7613}, {8509, 7614}, {8508, 7615}, {8507, 7616}, {8506, 7617}, {8505, 7618}, {8504, 7619},
+    {8503, 7620}, {8502, 7621}, {8501, 7622}, {8500, 7623}, {8499, 7624}, {8498, 7625}, {8497, 7626}, {8496, 7627},
+    {8527, 7628}, {8526, 7629}, {8525, 7630}, {8524, 7631}, {8523, 7632}, {8522, 7633}, {8521, 7634}, {8520, 7635},
+    {8519, 7636}, {8518, 7637}, {8517, 7638}, {8516, 7639}, {8515, 7640}, {8514, 7641}, {8513, 7642}, {8512, 7643},
+    {8543, 7644}, {8542, 7645}, {8565, 7646}, {8540, 7647}, {8539, 7648}, {8538, 7649}, {8537, 7650}, {8536, 7651},
+    {8535, 7652}, {8534, 7653}, {8533, 7654}, {8532, 7655}, {8531, 7656}, {8530, 7657}, {8529, 7658}, {8528, 7659},
+    {8559, 7660}, {8558, 7661}, {8557, 7662}, {8556, 7663}, {8555, 7664}, {8554, 7665}, {8553, 7666}, {8552, 7667},
+    {8551, 7668}, {8550, 7669}, {8549, 7670}, {8548, 7671}, {8547, 7672}, {8546, 7673}, {8545, 7674}, {8544, 7675},
+    {8575, 7676}, {8574, 7677}, {8573, 7678}, {8572, 7679}, {8571, 7680}, {8570, 7681}, {8569, 7682}, {8568, 7683},
+    {8567, 7684}, {8566, 7685}, {8565, 7686}, {8564, 7687}, {8563, 7688}, {8562, 7689}, {8561, 7690}, {8560, 7691},
+    {8847, 7692}, {8846, 7693}, {8845, 7694}, {8844, 7695}, {8843, 7696}, {8842, 7697}, {8841, 7698}, {8840, 7699},
+    {8839, 7700}, {8838, 7701}, {8837, 7702}, {8836, 7703}, {8835, 7704}, {8834, 7705}, {8833, 7706}, {8832, 7707},
+    {8863, 7708}, {8862, 7709}, {8861, 7710}, {8860, 7711}, {8859, 7712}, {8858, 7713}, {8857, 7714}, {8856, 7715},
+    {8855, 7716}, {8854, 7717}, {8853, 7718}, {8852, 7719}, {8851, 7720}, {8850, 7721}, {8849, 7722}, {8848, 7723},
+    {8879, 7724}, {8878, 7725}, {8877, 7726}, {2374, 7729}, {542, 7730}, {2673, 7731}, {1117, 7732}, {2672, 7733},
+    {2514, 7734}, {675, 7735}, {525, 7736}, {2687, 7737}, {1878, 7738}, {8739, 7739}, {8740, 7740}, {8741, 7741},
+    {8742, 7742}, {8743, 7743}, {8744, 7744}, {8745, 7745}, {8746, 7746}, {8747, 7747}, {8748, 7748}, {8749, 7749},
+    {8750, 7750}, {8751, 7751}, {8752, 7752}, {8753, 7753}, {8754, 7754}, {8755, 7755}, {8756, 7756}, {8757, 7757},
+    {8758, 7758}, {8759, 7759}, {8760, 7760}, {8761, 7761}, {8762, 7762}, {8763, 7763}, {8764, 7764}, {8765, 7765},
+    {8766, 7766}, {8767, 7767}, {8768, 7768}, {1787, 7769}, {2338, 7770}, {8769, 7771}, {8770, 7772}, {8771, 7773},
+    {8772, 7774}, {8773, 7775}, {8774, 7776}, {8775, 7777}, {8776, 7778}, {8777, 7779}, {8778, 7780}, {434, 7781},
+    {786, 7782}, {8779, 7783}, {8780, 7784}, {8781, 7785}, {8782, 7786}, {8783, 7787}, {8784, 7788}, {8785, 7789},
+    {8786, 7790}, {8787, 7791}, {8788, 7792}, {8949, 7808}, {8950, 7830}, {8951, 7826}, {8792, 7793}, {8902, 7794},
+    {8956, 7795}, {8954, 7796}, {8952, 7797}, {8902, 7798}, {8795, 7799}, {8802, 7800}, {8803, 7801}, {8804, 7816},
+    {8805, 7817}, {8806, 7818}, {8807, 7834}, {8808, 7835}, {8809, 7836}, {8810, 7850}, {8811, 7851}, {8812, 7852},
+    {8813, 7866}, {8814, 7867}, {8815, 7868}, {8943, 7882}, {8919, 7883}, {8916, 7884}, {8914, 7885}, {8822, 7886},
+    {8823, 7887}, {8824, 7888}, {8825, 7902}, {8826, 7903}, {8827, 7904}, {8828, 7918}, {8829, 7919}, {8830, 7920},
+    {8831, 7934}, {8832, 7935}, {8833, 7936}, {8834, 7950}, {8835, 7951}, {8836, 7952}, {8837, 7966}, {8838, 7967},
+    {8839, 7968}, {8840, 7969}, {8841, 7970}, {8842, 7971}, {8843, 7972}, {8844, 7973}, {8845, 7974}, {8846, 7975},
+    {8847, 7976}, {8848, 7977}, {8849, 7978}, {8850, 7979}, {8851, 7980}, {8852, 7981}, {8853, 7982}, {8854, 7983},
+    {8855, 7984}, {8856, 7985}, {8857, 7986}, {8858, 7987}, {8859, 7988}, {8860, 7989}, {8861, 7990}, {8862, 7991},
+    {8863, 7992}, {8864, 7993}, {8865, 7994}, {8866, 7995}, {8867, 7996}, {8868, 7997}, {8869, 7998}, {8870, 7999},
+    {8871, 8000}, {8872, 8001}, {8873, 8002}, {8874, 8003}, {8875, 8004}, {8876, 8005}, {8877, 8006}, {8878, 8007},
+    {8879, 8008}, {8880, 8009}, {8881, 8010}, {8882, 8011}, {8883, 8012}, {8884, 8013}, {8885, 8014}, {8886, 8015},
+    {8887, 8016}, {8888, 8017}, {8889, 8018}, {8890, 8019}, {8891, 8020}, {8892, 8021}, {8893, 8022}, {8894, 8023},
+    {8895, 8024}, {8896, 8025}, {8897, 8026}, {8898, 8027}, {8899, 8028}, {8900, 8029}, {8901, 8030}, {8902, 8031},
+    {8903, 8032}, {8904, 8033}, {8905, 8034}, {8906, 8035}, {8907, 8036}, {8908, 8037}, {8909, 8038}, {8910, 8039},
+    {8911, 8040}, {8912, 8041}, {8913, 8042}, {8914, 8043}, {8915, 8044}, {8916, 8045}, {93, 8046}, {1690, 8047},
+    {8917, 8048}, {8918, 8049}, {8919, 8050}, {8920, 8051}, {8921, 8052}, {8922, 8053}, {8923, 8054}, {8924, 8055},
+    {8925, 8056}, {8926, 8057}, {8927, 8058}, {8928, 8059}, {8929, 8060}, {8930, 8061}, {8931, 8062}, {8932, 8063},
+    {8933, 8064}, {8934, 8065}, {8935, 8066}, {8936, 8067}, {8937, 8068}, {8938, 8069}, {8939, 8070}, {8940, 8071},
+    {8941, 8072}, {8942, 8073}, {8943, 8074}, {8944, 8075}, {8945, 8076}, {8946, 8077}, {8947, 8078}, {8948, 8079},
+    {8949, 8080}, {8950, 8081}, {8951, 8082}, {8952, 8083}, {8953, 8084}, {8954, 8085}, {8955, 8086}, {8956, 8087},
+    {8957, 8088}, {8958, 8089}, {8959, 8090}, {8960, 8091}, {8961, 8092}, {8962, 8093}, {8963, 8094}, {8964, 8095},
+    {8965, 8096}, {8966, 8097}, {8967, 8098}, {8968, 8099}, {8969, 8100}, {8970, 8101}, {8971, 8102}, {8972, 8103},
+    {8973, 8104}, {8974, 8105}, {8975, 8106}, {8976, 8107}, {8977, 8108}, {8978, 8109}, {8979, 8110}, {8980, 8111},
+    {8981, 8112}, {8982, 8113}, {8983, 8114}, {8984, 8115}, {8985, 8116}, {8986, 8117}, {8987, 8118}, {8988, 8119},
+    {8989, 8120}, {8990, 8121}, {8991, 8122}, {8992, 8123}, {8993, 8124}, {8994, 8125}, {8995, 8126}, {8996, 8127},
+    {8997, 8128}, {8998, 8129}, {8999, 8130}, {9000, 8131}, {9001, 8132}, {9002, 8133}, {9003, 8134}, {9004, 8135},
+    {9005, 8136}, {9006, 8137}, {9007, 8138}, {9008, 8139}, {9009, 8140}, {9010, 8141}, {9011, 8142}, {9012, 8143},
+    {9013, 8144}, {9014, 8145}, {9015, 8146}, {9016, 8147}, {9017, 8148}, {9018, 8149}, {9019, 8150}, {9020, 8151},
+    {9021, 8152}, {9022, 8153}, {9023, 8154}, {9024, 8155}, {9025, 8156}, {9026, 8157}, {9027, 8158}, {9028, 8159},
+    {9029, 8160}, {9030, 8161}, {9031, 8162}, {9032, 8163}, {9033, 8164}, {9034, 8165}, {9035, 8166}, {9036, 8167},
+    {9037, 8168}, {9038, 8169}, {9039, 8170}, {9040, 8171}, {9041, 8172}, {9042, 8173}, {9043, 8174}, {9044, 8175},
+    {9045, 8176}, {9046, 8177}, {9047, 8178}, {9048, 8179}, {9049, 8180}, {9050, 8181}, {9051, 8182}, {9052, 8183},
+    {9053, 8184}, {9054, 8185}, {9055, 8186}, {9056, 8187}, {9057, 8188}, {9058, 8189}, {9059, 8190}, {9060, 8191},
+    {9061, 8192}, {9062, 8193}, {9063, 8194}, {9064, 8195}, {9065, 8196}, {9066, 8197}, {9067, 8198}, {9068, 8199},
+    {9069, 8200}, {9070, 8201}, {9071, 8202}, {9072, 8203}, {9073, 8204}, {9074, 8205}, {9075, 8206}, {9076, 8207},
+    {9077, 8208}, {9078, 8209}, {9079, 8210}, {9080, 8211}, {9081, 8212}, {9082, 8213}, {9083, 8214}, {9084, 8215},
+    {9085, 8216}, {9086, 8217}, {9198, 8218}, {9088, 8219}, {9089, 8220}, {9090, 8221}, {9091, 8222}, {9092, 8223},
+    {9093, 8224}, {9094, 8225}, {9095, 8226}, {9096, 8227}, {9097, 8228}, {9098, 8229}, {9099, 8230}, {9100, 8231},
+    {9101, 8232}, {9102, 8233}, {9103, 8234}, {9104, 8235}, {9105, 8236}, {9106, 8237}, {9107, 8238}, {9108, 8239},
+    {9109, 8240}, {9110, 8241}, {9111, 8242}, {9112, 8243}, {9113, 8244}, {9114, 8245}, {9115, 8246}, {9116, 8247},
+    {9117, 8248}, {9118, 8249}, {9119, 8250}, {9120, 8251}, {9121, 8252}, {9122, 8253}, {9123, 8254}, {9124, 8255},
+    {9125, 8256}, {9126, 8257}, {9127, 8258}, {9128, 8259}, {9129, 8260}, {9130, 8261}, {9131, 8262}, {9132, 8263},
+    {9133, 8264}, {9134, 8265}, {9135, 8266}, {9136, 8267}, {9137, 8268}, {9138, 8269}, {9139, 8270}, {9140, 8271},
+    {9141, 8272}, {9142, 8273}, {9143, 8274}, {9144, 8275}, {9145, 8276}, {9146, 8277}, {9147, 8278}, {9148, 8279},
+    {9149, 8280}, {9150, 8281}, {9151, 8282}, {9152, 8283}, {9153, 8284}, {9154, 8285}, {9155, 8286}, {9156, 8287},
+    {9157, 8288}, {9158, 8289}, {9159, 8290}, {9160, 8291}, {9161, 8292}, {9162, 8293}, {9163, 8294}, {9164, 8295},
+    {9165, 8296}, {9166, 8297}, {9167, 8298}, {2732, 8309}, {1276, 8310}, {1516, 8311}, {694, 8312}, {809, 8313},
+    {2261, 8314}, {1322, 8315}, {2539, 8316}, {1160, 8317}, {1899, 8318}, {1984, 8319}, {949, 8320}, {2577, 8321},
+    {563, 8322}, {2641, 8323}, {2297, 8324}, {1369, 8325}, {2043, 8326}, {1750, 8327}, {29, 8328}, {1637, 8329},
+    {2081, 8330}, {2526, 8331}, {2367, 8332}, {2159, 8333}, {196, 8334}, {1879, 8335}, {2161, 8336}, {1134, 8337},
+    {326, 8338}, {984, 8341}, {850, 8342}, {358, 8343}, {260, 8344}, {1166, 8345}, {779, 8346}, {1963, 8347},
+    {624, 8348}, {419, 8349}, {2447, 8350}, {895, 8353}, {2498, 8354}, {1753, 8355}, {55, 8356}, {945, 8357},
+    {1908, 8358}, {2696, 8359}, {854, 8360}, {569, 8361}, {1706, 8362}, {9041, 8363}, {9040, 8364}, {9043, 8365},
+    {166, 8366}, {9029, 8367}, {9171, 8368}, {2032, 8372}, {9173, 8369}, {9174, 8369}, {9216, 8370}, {9217, 8370},
+    {9218, 8371}, {9219, 8371}, {84, 8373}, {2681, 8374}, {1366, 8375}, {1548, 8376}, {757, 8377}, {1190, 8378},
+    {1428, 8379}, {1266, 8380}, {2130, 8381}, {137, 8382}, {2365, 8383}, {513, 8384}, {1052, 8385}, {1299, 8386},
+    {9033, 8387}, {9177, 8388}, {9178, 8389}, {9180, 8389}, {9220, 8390}, {9221, 8390}, {2408, 8391}, {2695, 8392},
+    {655, 8393}, {270, 8394}, {2489, 8395}, {1185, 8396}, {1363, 8397}, {1294, 8398}, {2711, 8399}, {1957, 8400},
+    {729, 8401}, {2467, 8402}, {595, 8403}, {1842, 8404}, {861, 8405}, {1956, 8406}, {2551, 8407}, {489, 8408},
+    {884, 8409}, {2504, 8410}, {1872, 8411}, {2306, 8412}, {2759, 8413}, {623, 8414}, {531, 8415}, {1237, 8416},
+    {1046, 8417}, {234, 8418}, {455, 8419}, {18, 8420}, {989, 8421}, {1781, 8422}, {1731, 8423}, {215, 8424},
+    {1672, 8425}, {1084, 8426}, {1112, 8427}, {390, 8428}, {955, 8429}, {138, 8430}, {244, 8431}, {2322, 8432},
+    {289, 8433}, {2022, 8434}, {1029, 8435}, {2104, 8436}, {2337, 8437}, {1704, 8438}, {2629, 8439}, {1387, 8440},
+    {1889, 8441}, {963, 8442}, {2413, 8443}, {259, 8444}, {2784, 8445}, {2121, 8446}, {1559, 8447}, {677, 8448},
+    {1388, 8449}, {716, 8450}, {1390, 8451}, {1249, 8452}, {2028, 8453}, {1749, 8454}, {1711, 8455}, {966, 8456},
+    {1360, 8457}, {925, 8458}, {1408, 8459}, {324, 8460}, {2003, 8461}, {2067, 8462}, {745, 8463}, {2194, 8464},
+    {2679, 8465}, {856, 8466}, {732, 8467}, {2400, 8468}, {2143, 8469}, {1359, 8470}, {1321, 8471}, {2575, 8472},
+    {108, 8473}, {1168, 8474}, {1438, 8475}, {819, 8476}, {1017, 8477}, {428, 8478}, {522, 8479}, {772, 8480},
+    {2397, 8481}, {1883, 8482}, {871, 8483}, {2476, 8484}, {165, 8485}, {500, 8488}, {730, 8489}, {76, 8490},
+    {566, 8491}, {647, 8492}, {321, 8493}, {2636, 8494}, {723, 8495}, {2598, 8496}, {2141, 8497}, {1953, 8498},
+    {2179, 8499}, {379, 8500}, {1, 8501}, {1991, 8502}, {1347, 8503}, {707, 8504}, {393, 8505}, {1938, 8506},
+    {909, 8507}, {2308, 8508}, {1855, 8509}, {2710, 8510}, {1573, 8511}, {2068, 8512}, {930, 8513}, {682, 8514},
+    {1561, 8515}, {2136, 8516}, {1764, 8517}, {1125, 8518}, {19, 8519}, {44, 8520}, {2718, 8521}, {672, 8522},
+    {2485, 8523}, {1340, 8524}, {1019, 8525}, {2142, 8526}, {1051, 8527}, {527, 8528}, {1012, 8529}, {90, 8530},
+    {257, 8531}, {922, 8532}, {391, 8533}, {598, 8534}, {2463, 8535}, {832, 8536}, {1070, 8537}, {1141, 8538},
+    {1293, 8539}, {1562, 8540}, {2186, 8541}, {927, 8542}, {2258, 8543}, {1780, 8544}, {2284, 8545}, {609, 8546},
+    {1470, 8547}, {1765, 8548}, {671, 8549}, {1243, 8550}, {1818, 8551}, {907, 8552}, {882, 8553}, {1804, 8554},
+    {505, 8555}, {1826, 8556}, {1376, 8557}, {2749, 8558}, {442, 8559}, {2059, 8560}, {2519, 8561}, {309, 8562},
+    {2507, 8563}, {962, 8564}, {1751, 8565}, {433, 8566}, {1144, 8567}, {77, 8568}, {308, 8569}, {1356, 8570},
+    {2107, 8571}, {2713, 8572}, {2008, 8573}, {1627, 8574}, {1413, 8575}, {825, 8576}, {1682, 8577}, {2336, 8578},
+    {2358, 8579}, {2478, 8580}, {2266, 8581}, {795, 8582}, {2468, 8583}, {2804, 8584}, {917, 8585}, {468, 8586},
+    {2331, 8587}, {1429, 8588}, {250, 8589}, {645, 8590}, {1444, 8591}, {2210, 8592}, {2080, 8593}, {1678, 8594},
+    {916, 8595}, {1993, 8596}, {2685, 8597}, {1720, 8598}, {1311, 8599}, {2579, 8600}, {212, 8601}, {2595, 8602},
+    {1106, 8603}, {534, 8604}, {797, 8605}, {1776, 8606}, {2175, 8607}, {720, 8608}, {2525, 8609}, {1341, 8610},
+    {429, 8611}, {2644, 8612}, {110, 8613}, {2596, 8614}, {697, 8615}, {2354, 8616}, {1918, 8617}, {2377, 8618},
+    {389, 8619}, {1852, 8620}, {606, 8621}, {915, 8622}, {333, 8623}, {1876, 8624}, {131, 8625}, {2510, 8626},
+    {405, 8627}, {2532, 8628}, {2583, 8629}, {1555, 8630}, {944, 8631}, {1500, 8632}, {1491, 8633}, {1884, 8634},
+    {2053, 8635}, {2348, 8636}, {1617, 8637}, {2771, 8638}, {2229, 8639}, {2536, 8640}, {1212, 8641}, {2642, 8642},
+    {247, 8643}, {812, 8644}, {1252, 8645}, {777, 8646}, {993, 8647}, {1188, 8648}, {1273, 8649}, {796, 8650},
+    {1501, 8651}, {198, 8652}, {1840, 8653}, {207, 8654}, {1538, 8655}, {2324, 8656}, {1576, 8657}, {9181, 8658},
+    {1391, 8659}, {1664, 8660}, {1569, 8661}, {852, 8662}, {2582, 8663}, {1488, 8664}, {2227, 8665}, {1079, 8666},
+    {2110, 8667}, {1531, 8668}, {2395, 8669}, {1139, 8670}, {2200, 8671}, {2212, 8672}, {1267, 8673}, {2423, 8674},
+    {2207, 8675}, {2457, 8676}, {1800, 8677}, {2605, 8678}, {25, 8679}, {678, 8680}, {1747, 8681}, {590, 8682},
+    {1553, 8683}, {2767, 8684}, {1306, 8685}, {1718, 8686}, {1971, 8687}, {1932, 8688}, {1532, 8689}, {728, 8690},
+    {1088, 8691}, {2075, 8692}, {2694, 8693}, {2810, 8694}, {1027, 8695}, {1647, 8696}, {369, 8697}, {1783, 8698},
+    {560, 8699}, {2162, 8700}, {399, 8701}, {1778, 8702}, {3, 8703}, {1065, 8704}, {2411, 8705}, {1674, 8706},
+    {1965, 8707}, {965, 8708}, {507, 8709}, {1258, 8710}, {2289, 8711}, {2449, 8712}, {2712, 8713}, {528, 8714},
+    {526, 8715}, {1350, 8716}, {2271, 8717}, {314, 8718}, {1719, 8719}, {583, 8720}, {1979, 8721}, {471, 8722},
+    {121, 8723}, {2158, 8724}, {209, 8725}, {2015, 8726}, {2055, 8727}, {2540, 8728}, {74, 8729}, {1729, 8730},
+    {1215, 8731}, {1585, 8732}, {1370, 8733}, {2117, 8734}, {2183, 8735}, {836, 8736}, {2460, 8737}, {2648, 8738},
+    {9072, 8789}, {9084, 8790}, {9036, 8791}, {239, 8794}, {9033, 8793}, {1853, 8796}, {1848, 8797}, {9065, 8793},
+    {9024, 8816}, {1036, 8817}, {1203, 8818}, {9068, 8816}, {1412, 8819}, {2801, 9087}, {8991, 9168}, {8990, 9169},
+    {8989, 9170}, {9199, 9172}, {8978, 9175}, {9084, 9442}, {9087, 9443}, {9086, 9440}, {9081, 9441}, {8981, 9179},
+    {9205, 9176}, {9206, 9176}, {9077, 9446}, {9076, 9447}, {9050, 9182}, {9051, 9183}, {9052, 9184}, {2277, 9185},
+    {9085, 9186}, {8974, 9187}, {8975, 9188}, {9462, 9189}, {9463, 9190}, {1624, 9192}, {1285, 9193}, {9352, 9191},
+    {9465, 9194}, {9466, 9195}, {9354, 9196}, {9357, 9197}, {9356, 9198}, {9347, 9200}, {9360, 9201}, {9359, 9202},
+    {2691, 8798}, {7, 8799}, {26, 8800}, {995, 8801}, {1145, 8820}, {2698, 8821}, {9358, 9203}, {9357, 9204},
+    {9374, 9207}, {9355, 9208}, {9354, 9209}, {9393, 9210}, {9379, 9211}, {9387, 9212}, {9449, 9213}, {9355, 9214},
+    {9354, 9215}, {9357, 9222}, {9356, 9223}, {9454, 9224}, {9358, 9225}, {9393, 9226}, {9426, 9227}, {9425, 9228},
+    {9424, 9229}, {9403, 9230}, {9347, 9231}, {9344, 9232}, {9358, 9233}, {9356, 9234}, {9398, 9235}, {9354, 9236},
+    {9352, 9237}, {9357, 9238}, {9360, 9239}, {9361, 9240}, {9379, 9241}, {9267, 9242}, {9268, 9243}, {9269, 9243},
+    {9270, 9244}, {9384, 9246}, {9271, 9245}, {9272, 9245}, {9274, 9247}, {9404, 9249}, {9275, 9248}, {9276, 9248},
+    {9407, 9250}, {9406, 9251}, {9448, 9252}, {2369, 9253}, {2633, 9254}, {147, 9255}, {1099, 9256}, {1895, 9258},
+    {2588, 9259}, {9450, 9257}, {1727, 9260}, {2037, 9262}, {578, 9263}, {9470, 9261}, {9467, 9264}, {9466, 9265},
+    {9286, 9266}, {9289, 9277}, {9287, 9273}, {9288, 9273}, {9290, 9278}, {9291, 9279}, {398, 9280}, {705, 9282},
+    {1234, 9283}, {833, 9281}, {2491, 9284}, {2221, 9285}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {9061, 8800}, {9062, 8801}, {9059, 8798}, {9060, 8799}, {0, -1}, {0, -1}, {9066, 8820}, {9067, 8821},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+};
+TURBO_DLL extern const size_t EMOJI_CODES_EN_TRIE_SIZE = 9472;
+
+TURBO_DLL extern const DoubleArrayUnit EMOJI_NAMES_EN_TRIE[] = {
+    {59, -1}, {53, 0}, {86, 4}, {85, 7}, {113, 1}, {87, 6}, {119, 1}, {109, 1},
+    {107, 116}, {367, 119}, {457, 124}, {455, 124}, {312, 124}, {348, 115}, {143, 119}, {114, 118},
+    {164, 113}, {392, 100}, {527, 108}, {461, 119}, {254, 119}, {43, 116}, {311, 124}, {782, 68},
+    {897, 246}, {177, 119}, {184, 113}, {308, 124}, {170, 113}, {139, 119}, {122, 116}, {187, 113},
+    {336, 125}, {320, 114}, {943, 2}, {234, 119}, {133, 116}, {464, 114}, {9, 116}, {40, 116},
+    {324, 114}, {325, 114}, {338, 125}, {562, 98}, {45, 116}, {267, 115}, {345, 125}, {556, 98},
+    {15, 116}, {942, 3}, {334, 114}, {928, 5}, {1120, 8}, {614, 114}, {368, 115}, {1115, 30},
+    {193, 116}, {11, 116}, {295, 125}, {59, 116}, {272, 124}, {54, 119}, {325, 115}, {26, 116},
+    {37, 1}, {430, 1}, {439, 1}, {499, 1}, {98, 1}, {417, 1}, {385, 1}, {496, 1},
+    {1002, 64}, {1148, 21}, {1125, 44}, {1056, 64}, {402, 1}, {1094, 39}, {1075, 59}, {609, 1},
+    {268, 1}, {290, 1}, {481, 1}, {311, 1}, {352, 1}, {1199, 64}, {349, 1}, {133, 1},
+    {262, 1}, {494, 1}, {451, 1}, {281, 1}, {240, 1}, {382, 1}, {303, 1}, {181, 1},
+    {303, 1}, {164, 1}, {74, 1}, {154, 1}, {112, 1}, {157, 1}, {335, 1}, {174, 1},
+    {1263, 57}, {1248, 63}, {1255, 48}, {1139, 38}, {119, 1}, {675, 103}, {1100, 38}, {246, 1},
+    {201, 1}, {117, 1}, {64, 1}, {95, 1}, {74, 1}, {1235, 61}, {204, 1}, {124, 1},
+    {161, 1}, {241, 1}, {210, 1}, {244, 1}, {120, 1}, {79, 1}, {227, 1}, {224, 1},
+    {209, 118}, {423, 127}, {293, 126}, {221, 118}, {271, 121}, {296, 127}, {271, 126}, {154, 112},
+    {1260, 35}, {615, 97}, {278, 126}, {1232, 20}, {283, 126}, {478, 122}, {1233, 128}, {302, 127},
+    {454, 121}, {401, 123}, {1274, 131}, {729, 92}, {447, 121}, {431, 123}, {262, 126}, {526, 111},
+    {622, 121}, {505, 122}, {256, 126}, {465, 123}, {401, 122}, {438, 123}, {780, 92}, {521, 111},
+    {200, 118}, {1205, 160}, {395, 122}, {638, 118}, {366, 118}, {176, 112}, {1074, 56}, {154, 112},
+    {1038, 56}, {197, 118}, {146, 112}, {1224, 169}, {1033, 56}, {620, 118}, {148, 112}, {1196, 190},
+    {1225, 169}, {458, 123}, {1186, 181}, {449, 123}, {1049, 56}, {194, 118}, {210, 118}, {1202, 182},
+    {139, 112}, {165, 118}, {380, 112}, {367, 112}, {354, 112}, {354, 112}, {192, 118}, {424, 122},
+    {579, 120}, {402, 103}, {389, 101}, {1230, 25}, {261, 120}, {556, 97}, {1190, 15}, {1199, 185},
+    {285, 120}, {516, 99}, {1214, 16}, {566, 97}, {602, 97}, {553, 97}, {589, 120}, {1203, 28},
+    {679, 95}, {546, 97}, {1207, 31}, {505, 120}, {734, 95}, {1214, 26}, {545, 97}, {1198, 185},
+    {497, 120}, {616, 103}, {803, 95}, {630, 103}, {686, 95}, {1216, 25}, {1158, 135}, {1270, 25},
+    {761, 87}, {1086, 36}, {1256, 36}, {1219, 29}, {738, 87}, {1276, 29}, {1241, 14}, {1211, 170},
+    {415, 101}, {705, 87}, {706, 87}, {617, 97}, {744, 87}, {1195, 174}, {1238, 14}, {1166, 165},
+    {717, 87}, {1044, 36}, {618, 101}, {516, 99}, {394, 101}, {411, 101}, {157, 1}, {673, 87},
+    {409, 101}, {1278, 29}, {1216, 14}, {526, 99}, {578, 101}, {1203, 167}, {1153, 184}, {562, 99},
+    {621, 102}, {542, 96}, {516, 84}, {1224, 9}, {512, 84}, {532, 84}, {1173, 187}, {1192, 164},
+    {1165, 186}, {539, 84}, {1162, 189}, {842, 93}, {529, 84}, {521, 84}, {521, 84}, {1190, 164},
+    {1163, 188}, {781, 93}, {539, 84}, {518, 84}, {540, 84}, {515, 84}, {532, 84}, {770, 93},
+    {537, 84}, {1184, 13}, {1153, 54}, {831, 93}, {1194, 164}, {1195, 9}, {1157, 54}, {657, 93},
+    {592, 102}, {741, 80}, {1155, 33}, {633, 102}, {541, 86}, {1180, 40}, {579, 102}, {1153, 41},
+    {650, 86}, {1165, 62}, {586, 102}, {1169, 50}, {635, 102}, {1167, 33}, {551, 102}, {658, 86},
+    {1164, 46}, {682, 86}, {641, 86}, {1163, 42}, {691, 86}, {703, 86}, {601, 102}, {1160, 62},
+    {546, 102}, {587, 102}, {549, 102}, {518, 102}, {673, 86}, {624, 102}, {1177, 32}, {630, 102},
+    {642, 94}, {572, 96}, {886, 83}, {871, 81}, {545, 96}, {877, 83}, {995, 94}, {866, 81},
+    {558, 96}, {1181, 58}, {677, 94}, {833, 81}, {542, 81}, {874, 81}, {839, 94}, {1177, 60},
+    {711, 81}, {1168, 27}, {647, 83}, {1384, 22}, {742, 81}, {568, 96}, {834, 83}, {710, 81},
+    {805, 83}, {1386, 12}, {1400, 133}, {801, 83}, {1384, 143}, {547, 96}, {838, 83}, {1388, 130},
+    {725, 80}, {1399, 134}, {741, 80}, {928, 88}, {1382, 138}, {746, 80}, {759, 80}, {935, 88},
+    {1406, 140}, {897, 88}, {1156, 45}, {750, 80}, {894, 91}, {749, 80}, {1157, 45}, {793, 88},
+    {849, 91}, {1395, 150}, {1396, 154}, {849, 88}, {642, 80}, {763, 80}, {981, 91}, {1406, 132},
+    {977, 91}, {742, 80}, {764, 80}, {766, 80}, {937, 91}, {1355, 196}, {1366, 200}, {623, 96},
+    {714, 82}, {960, 89}, {645, 89}, {776, 65}, {694, 82}, {960, 71}, {1009, 67}, {967, 89},
+    {707, 82}, {710, 82}, {1280, 211}, {992, 89}, {663, 102}, {886, 82}, {804, 82}, {993, 89},
+    {1374, 216}, {1096, 71}, {1012, 67}, {814, 82}, {688, 82}, {1059, 71}, {1000, 67}, {665, 89},
+    {772, 71}, {1089, 71}, {1083, 67}, {655, 89}, {1015, 67}, {1390, 177}, {1360, 179}, {1065, 71},
+    {895, 90}, {1228, 19}, {1180, 37}, {1318, 155}, {853, 90}, {893, 90}, {1315, 153}, {874, 90},
+    {1388, 10}, {1383, 144}, {836, 90}, {1377, 11}, {1391, 10}, {828, 90}, {775, 90}, {856, 90},
+    {1377, 156}, {773, 90}, {1379, 144}, {775, 90}, {829, 90}, {1380, 11}, {824, 90}, {842, 90},
+    {1245, 19}, {1241, 19}, {815, 90}, {872, 90}, {1335, 141}, {1159, 37}, {1224, 19}, {1181, 37},
+    {907, 69}, {1032, 65}, {1370, 149}, {1368, 157}, {1121, 69}, {1275, 66}, {1051, 65}, {1250, 65},
+    {1124, 69}, {1325, 191}, {1385, 129}, {1250, 65}, {1399, 148}, {785, 69}, {1129, 69}, {1077, 65},
+    {1325, 148}, {1374, 157}, {971, 66}, {1089, 69}, {788, 69}, {1371, 157}, {1222, 66}, {1387, 129},
+    {1252, 66}, {935, 65}, {1350, 149}, {1071, 65}, {1106, 65}, {1399, 148}, {945, 66}, {1137, 66},
+    {1028, 70}, {1364, 145}, {1119, 70}, {1325, 162}, {1249, 70}, {1360, 145}, {1382, 145}, {1328, 194},
+    {970, 70}, {1046, 70}, {904, 70}, {1336, 248}, {976, 70}, {959, 70}, {1002, 70}, {991, 70},
+    {771, 70}, {1104, 70}, {1314, 245}, {897, 76}, {950, 70}, {1150, 70}, {1017, 70}, {1108, 76},
+    {904, 70}, {1324, 244}, {1319, 232}, {1008, 76}, {1335, 17}, {946, 76}, {1331, 244}, {1334, 193},
+    {977, 79}, {1242, 173}, {1240, 173}, {1159, 53}, {955, 79}, {1323, 219}, {1330, 242}, {1380, 53},
+    {916, 79}, {1335, 217}, {1327, 109}, {1402, 152}, {1349, 152}, {1208, 163}, {903, 79}, {1176, 53},
+    {1197, 163}, {1184, 163}, {1191, 163}, {1190, 163}, {1299, 300}, {1239, 173}, {1310, 291}, {1285, 319},
+    {1312, 242}, {1330, 317}, {1394, 152}, {913, 79}, {1188, 173}, {1192, 163}, {1246, 173}, {1174, 53},
+    {1344, 192}, {1347, 206}, {1301, 256}, {1355, 206}, {1287, 298}, {1311, 288}, {1303, 294}, {1405, 192},
+    {1329, 315}, {1327, 252}, {1310, 313}, {1297, 310}, {1318, 252}, {1281, 294}, {1321, 252}, {1346, 192},
+    {1323, 252}, {1371, 192}, {1340, 252}, {1287, 298}, {1302, 396}, {1311, 137}, {1388, 192}, {1356, 206},
+    {1281, 298}, {1316, 235}, {1392, 192}, {1513, 204}, {1286, 288}, {1291, 288}, {1283, 256}, {1350, 206},
+    {1332, 302}, {1297, 314}, {1284, 197}, {1289, 312}, {1518, 205}, {1291, 197}, {1300, 197}, {1298, 312},
+    {1515, 214}, {1280, 302}, {1329, 302}, {1283, 312}, {1519, 209}, {1447, 257}, {1493, 383}, {1509, 328},
+    {1516, 209}, {1517, 203}, {1284, 302}, {1517, 324}, {1513, 209}, {1529, 321}, {1513, 349}, {1304, 314},
+    {1507, 203}, {1293, 197}, {1514, 341}, {1522, 201}, {1526, 255}, {1510, 203}, {1522, 43}, {1506, 47},
+    {1508, 251}, {1504, 243}, {1532, 18}, {1528, 151}, {1529, 159}, {1535, 258}, {1483, 261}, {1307, 315},
+    {1528, 260}, {1491, 265}, {1474, 270}, {1490, 269}, {1498, 269}, {1481, 260}, {1486, 270}, {1479, 274},
+    {1494, 268}, {1476, 270}, {1472, 275}, {1501, 276}, {1480, 268}, {1485, 260}, {1522, 243}, {1502, 277},
+    {1475, 268}, {1473, 269}, {1531, 251}, {1489, 278}, {1417, 280}, {1430, 270}, {1620, 292}, {1638, 332},
+    {1485, 228}, {1490, 228}, {1620, 340}, {1446, 236}, {1469, 236}, {1445, 228}, {1490, 228}, {1466, 236},
+    {1550, 289}, {1720, 363}, {1564, 365}, {1463, 236}, {1442, 228}, {1561, 357}, {1440, 228}, {1455, 224},
+    {1434, 228}, {1491, 228}, {1553, 358}, {1558, 354}, {1563, 377}, {1450, 224}, {1421, 228}, {1459, 224},
+    {1465, 224}, {1540, 378}, {1412, 236}, {1613, 379}, {1484, 224}, {1408, 224}, {1724, 373}, {1723, 365},
+    {1456, 233}, {1419, 240}, {1562, 336}, {1444, 234}, {1416, 240}, {1543, 343}, {1551, 336}, {1736, 384},
+    {1541, 336}, {1734, 393}, {1497, 240}, {1565, 343}, {1469, 234}, {1458, 234}, {1420, 233}, {1461, 234},
+    {1760, 352}, {1751, 392}, {1542, 336}, {1726, 352}, {1456, 233}, {1410, 234}, {1455, 234}, {1453, 234},
+    {1730, 384}, {1437, 240}, {1463, 234}, {1594, 234}, {1851, 147}, {1688, 212}, {1595, 240}, {1434, 240},
+    {1462, 247}, {1647, 308}, {1438, 316}, {1615, 305}, {1408, 247}, {1601, 305}, {1690, 208}, {1652, 308},
+    {1416, 247}, {1670, 220}, {1415, 309}, {1613, 305}, {1639, 316}, {1425, 316}, {1425, 247}, {1432, 316},
+    {1636, 309}, {1719, 404}, {1413, 316}, {1632, 316}, {1641, 308}, {1593, 316}, {1637, 309}, {1757, 388},
+    {1755, 388}, {1711, 404}, {1646, 309}, {1775, 388}, {1848, 330}, {1647, 308}, {1644, 309}, {1644, 305},
+    {1637, 306}, {1557, 372}, {1608, 306}, {1896, 320}, {1911, 386}, {1710, 287}, {1787, 338}, {1653, 306},
+    {1862, 411}, {1631, 296}, {1770, 338}, {1576, 303}, {1600, 306}, {1600, 306}, {1661, 306}, {1615, 306},
+    {1868, 407}, {1632, 306}, {1769, 372}, {1610, 303}, {1605, 306}, {1790, 338}, {1568, 306}, {1609, 303},
+    {1603, 296}, {1626, 296}, {1563, 296}, {1656, 303}, {1700, 287}, {1571, 303}, {1640, 296}, {1704, 287},
+    {1572, 323}, {1568, 327}, {1759, 325}, {1582, 327}, {1730, 325}, {1583, 333}, {1548, 333}, {1593, 327},
+    {1739, 325}, {1570, 323}, {1795, 364}, {1842, 416}, {1737, 325}, {1722, 333}, {1573, 327}, {1807, 423},
+    {1579, 327}, {1588, 327}, {1580, 327}, {1733, 322}, {1583, 323}, {1581, 323}, {1591, 327}, {1732, 397},
+    {1737, 322}, {1698, 397}, {1735, 322}, {1804, 421}, {1540, 333}, {1549, 333}, {1578, 333}, {1536, 333},
+    {1598, 331}, {1773, 342}, {1838, 371}, {1761, 350}, {1672, 267}, {1882, 371}, {1691, 334}, {1795, 420},
+    {1848, 426}, {1693, 334}, {1783, 350}, {1544, 342}, {1546, 331}, {1678, 267}, {1766, 342}, {1554, 342},
+    {1780, 350}, {1545, 342}, {1590, 331}, {1587, 331}, {1771, 350}, {1767, 350}, {1852, 368}, {1585, 331},
+    {1592, 331}, {1669, 267}, {1569, 342}, {1568, 331}, {2015, 431}, {1899, 430}, {1808, 439}, {1840, 368},
+    {1735, 347}, {1716, 403}, {1709, 344}, {1757, 398}, {1766, 347}, {1709, 398}, {1749, 398}, {1705, 403},
+    {1683, 218}, {1784, 344}, {1769, 344}, {1755, 403}, {1812, 438}, {1715, 283}, {1745, 347}, {1702, 403},
+    {1741, 344}, {1869, 436}, {1912, 443}, {1715, 283}, {1767, 347}, {1793, 429}, {1749, 398}, {1737, 344},
+    {1788, 347}, {1964, 429}, {1675, 218}, {1719, 283}, {1805, 442}, {1728, 344}, {1706, 283}, {1795, 429},
+    {1723, 279}, {1671, 273}, {1793, 435}, {1667, 273}, {1820, 433}, {1723, 279}, {2012, 468}, {1985, 468},
+    {1685, 158}, {1716, 279}, {1688, 158}, {2014, 23}, {1723, 279}, {1958, 408}, {1665, 158}, {1664, 158},
+    {1986, 461}, {1820, 433}, {1680, 279}, {1817, 435}, {2046, 461}, {1885, 367}, {2150, 496}, {1884, 367},
+    {1688, 273}, {1887, 273}, {1856, 367}, {2137, 387}, {1671, 158}, {1879, 367}, {1688, 273}, {1678, 273},
+    {1680, 326}, {1899, 395}, {1909, 399}, {1881, 399}, {1897, 395}, {1905, 399}, {1915, 395}, {1834, 395},
+    {2091, 72}, {2166, 494}, {1807, 374}, {2171, 494}, {2170, 494}, {1918, 395}, {1683, 326}, {1890, 395},
+    {1677, 326}, {1917, 399}, {1919, 399}, {1901, 399}, {1686, 326}, {1893, 399}, {1910, 395}, {1888, 326},
+    {2114, 502}, {2074, 402}, {2079, 406}, {2064, 412}, {2127, 502}, {2069, 390}, {2245, 507}, {2274, 509},
+    {1916, 391}, {1852, 374}, {1896, 385}, {1867, 385}, {1855, 376}, {1826, 376}, {1842, 374}, {1976, 389},
+    {1912, 391}, {1918, 391}, {2292, 466}, {1836, 376}, {1904, 385}, {1946, 488}, {1970, 389}, {2275, 466},
+    {2160, 495}, {1943, 492}, {2088, 488}, {1900, 391}, {1908, 385}, {1914, 385}, {1914, 385}, {1892, 391},
+    {1828, 376}, {2148, 492}, {1944, 495}, {1915, 374}, {1836, 376}, {1912, 391}, {2169, 495}, {2277, 512},
+    {1862, 359}, {1887, 355}, {2107, 473}, {1860, 355}, {1860, 355}, {2117, 500}, {2126, 500}, {1871, 355},
+    {2220, 473}, {1821, 359}, {1828, 380}, {1859, 359}, {1856, 355}, {1887, 355}, {1822, 355}, {1871, 359},
+    {1933, 493}, {1831, 380}, {1838, 355}, {1871, 359}, {1859, 355}, {1885, 359}, {1936, 493}, {1823, 359},
+    {2067, 500}, {2287, 516}, {2152, 493}, {1844, 380}, {1829, 380}, {2303, 478}, {1805, 380}, {2292, 478},
+    {1886, 361}, {2156, 490}, {2028, 448}, {1873, 361}, {2286, 520}, {2027, 448}, {2126, 504}, {2030, 448},
+    {1808, 448}, {1921, 490}, {2243, 526}, {2200, 539}, {1816, 448}, {2242, 24}, {1879, 361}, {1825, 361},
+    {2260, 34}, {2261, 49}, {1866, 361}, {2299, 499}, {1835, 361}, {1874, 361}, {2297, 499}, {1879, 361},
+    {2038, 448}, {2040, 448}, {2137, 504}, {2017, 448}, {2008, 448}, {1940, 490}, {2037, 448}, {2262, 51},
+    {2043, 452}, {1960, 456}, {2258, 52}, {1961, 456}, {2267, 55}, {1993, 462}, {1990, 462}, {2042, 456},
+    {2033, 456}, {2269, 73}, {2041, 456}, {2124, 501}, {2118, 501}, {2251, 74}, {2045, 452}, {1969, 452},
+    {2276, 479}, {2154, 501}, {2245, 107}, {2024, 452}, {2284, 479}, {2018, 452}, {2039, 456}, {2019, 456},
+    {2302, 479}, {1984, 462}, {2000, 462}, {2119, 501}, {1993, 462}, {1951, 462}, {2019, 456}, {2118, 501},
+    {2015, 467}, {1965, 401}, {1967, 409}, {1963, 409}, {1996, 467}, {1931, 401}, {1955, 409}, {2105, 476},
+    {1990, 467}, {2270, 110}, {1996, 401}, {2007, 401}, {2009, 401}, {1923, 482}, {2001, 467}, {1963, 409},
+    {1945, 482}, {2116, 497}, {2010, 401}, {2048, 476}, {2244, 77}, {2162, 497}, {1945, 482}, {1926, 482},
+    {2292, 503}, {2117, 497}, {2246, 503}, {2105, 476}, {1928, 401}, {2057, 476}, {1946, 482}, {2122, 497},
+    {1953, 405}, {2103, 75}, {2100, 475}, {2108, 475}, {2015, 405}, {1976, 415}, {1958, 415}, {1946, 405},
+    {1982, 415}, {2104, 75}, {1976, 415}, {1952, 415}, {2099, 75}, {2133, 463}, {2006, 405}, {2005, 405},
+    {1956, 405}, {2268, 225}, {2241, 78}, {1955, 405}, {2078, 410}, {1972, 405}, {2134, 463}, {2266, 166},
+    {2075, 410}, {2078, 410}, {1970, 415}, {2138, 463}, {1975, 415}, {2060, 475}, {2143, 463}, {2068, 410},
+    {1922, 480}, {2082, 449}, {1978, 480}, {2146, 489}, {1947, 489}, {2094, 449}, {2103, 449}, {2062, 449},
+    {1942, 480}, {2083, 454}, {1927, 480}, {2246, 168}, {2264, 172}, {1932, 480}, {2090, 454}, {1924, 480},
+    {1920, 480}, {1940, 480}, {2090, 454}, {1936, 489}, {2096, 454}, {2243, 241}, {1933, 480}, {2158, 489},
+    {2061, 449}, {2153, 489}, {2109, 449}, {2262, 180}, {1928, 480}, {2261, 241}, {2097, 454}, {2148, 489},
+    {1945, 484}, {2083, 455}, {2050, 85}, {2083, 459}, {2093, 484}, {2095, 455}, {2138, 459}, {2243, 226},
+    {2282, 472}, {2291, 472}, {2262, 104}, {2295, 472}, {2221, 459}, {1928, 484}, {2084, 459}, {2094, 455},
+    {2088, 455}, {2102, 459}, {2272, 453}, {1945, 484}, {2251, 105}, {2264, 106}, {2252, 472}, {1941, 484},
+    {2276, 117}, {2248, 136}, {2302, 453}, {2220, 229}, {2208, 249}, {2265, 226}, {2273, 453}, {2216, 223},
+    {2077, 470}, {2224, 221}, {2256, 227}, {2226, 195}, {2217, 139}, {2239, 417}, {2211, 446}, {2221, 221},
+    {2068, 470}, {2239, 221}, {2236, 441}, {2217, 440}, {2212, 238}, {2215, 230}, {2218, 250}, {2225, 259},
+    {2282, 470}, {2270, 227}, {2273, 470}, {2214, 142}, {2064, 470}, {2059, 470}, {2187, 146}, {2233, 542},
+    {2234, 513}, {2180, 514}, {2237, 533}, {2226, 514}, {2223, 171}, {2239, 176}, {2284, 470}, {2212, 513},
+    {2232, 285}, {2183, 540}, {2277, 271}, {2192, 284}, {2180, 263}, {2196, 161}, {2179, 263}, {2198, 541},
+    {2187, 530}, {2197, 531}, {2183, 528}, {2230, 529}, {2187, 525}, {2207, 175}, {2262, 199}, {2094, 215},
+    {2203, 178}, {2183, 183}, {2197, 198}, {2192, 202}, {2203, 207}, {2202, 210}, {2227, 540}, {2201, 213},
+    {2057, 85}, {2201, 222}, {2205, 231}, {2190, 237}, {2102, 85}, {2202, 239}, {2236, 285}, {2205, 253},
+    {2185, 254}, {2188, 262}, {2193, 264}, {2415, 266}, {2417, 272}, {2397, 281}, {2415, 297}, {2401, 311},
+    {2367, 282}, {2407, 286}, {2404, 362}, {2411, 366}, {2407, 290}, {2403, 301}, {2405, 445}, {2411, 447},
+    {2111, 85}, {2412, 418}, {2415, 293}, {2414, 295}, {2419, 299}, {2427, 515}, {2419, 527}, {2425, 543},
+    {2417, 304}, {2429, 307}, {2429, 329}, {2411, 335}, {2430, 337}, {2415, 318}, {2372, 318}, {2416, 299},
+    {2423, 519}, {2369, 339}, {2328, 424}, {2373, 428}, {2426, 427}, {2371, 437}, {2398, 345}, {2383, 339},
+    {2369, 458}, {2345, 519}, {2375, 471}, {2383, 346}, {2378, 348}, {2375, 351}, {2380, 353}, {2380, 356},
+    {2417, 519}, {2393, 360}, {2393, 369}, {2376, 370}, {2312, 425}, {2394, 434}, {2394, 477}, {2357, 464},
+    {2370, 460}, {2386, 523}, {2382, 538}, {2385, 375}, {2392, 551}, {2329, 424}, {2351, 566}, {2355, 570},
+    {2373, 524}, {2376, 544}, {2347, 381}, {2359, 559}, {2342, 382}, {2394, 544}, {2344, 559}, {2341, 545},
+    {2348, 561}, {2348, 575}, {2344, 547}, {2424, 559}, {2339, 547}, {2365, 567}, {2318, 394}, {2348, 561},
+    {2367, 400}, {2353, 413}, {2337, 414}, {2359, 450}, {2339, 474}, {2363, 481}, {2338, 559}, {2393, 524},
+    {2365, 485}, {2339, 486}, {2347, 469}, {2344, 465}, {2392, 524}, {2406, 451}, {2306, 432}, {2344, 547},
+    {2354, 419}, {2324, 422}, {2320, 444}, {2399, 457}, {2323, 483}, {2323, 487}, {2331, 553}, {2310, 556},
+    {2332, 558}, {2317, 562}, {2314, 560}, {2307, 422}, {2329, 558}, {2388, 491}, {2310, 498}, {2325, 505},
+    {2320, 510}, {2366, 419}, {2358, 419}, {2332, 518}, {2310, 536}, {2304, 506}, {2311, 508}, {2328, 511},
+    {2334, 517}, {2332, 521}, {2324, 522}, {2340, 546}, {2334, 574}, {2313, 576}, {2335, 586}, {2354, 585},
+    {2536, 594}, {2546, 532}, {2531, 548}, {2540, 568}, {2542, 563}, {2549, 550}, {2537, 557}, {2543, 532},
+    {2539, 534}, {2534, 572}, {2528, 573}, {2533, 549}, {2529, 535}, {2524, 537}, {2530, 552}, {2532, 615},
+    {2556, 577}, {2557, 599}, {2550, 554}, {2556, 579}, {2529, 585}, {2518, 557}, {2547, 583}, {2541, 587},
+    {2553, 555}, {2502, 564}, {2530, 565}, {2554, 569}, {2557, 581}, {2550, 582}, {2559, 578}, {2538, 601},
+    {2509, 571}, {2512, 580}, {2457, 593}, {2504, 605}, {2503, 600}, {2510, 584}, {2520, 588}, {2526, 592},
+    {2496, 596}, {2543, 589}, {2515, 590}, {2513, 591}, {2527, 595}, {2514, 597}, {2509, 598}, {2514, 602},
+    {2511, 603}, {2525, 608}, {2526, 634}, {2500, 604}, {2513, 609}, {2479, 630}, {2470, 607}, {2482, 606},
+    {2524, 584}, {2474, 610}, {2476, 611}, {2471, 612}, {2482, 613}, {2491, 616}, {2475, 606}, {2506, 605},
+    {2490, 621}, {2494, 629}, {2474, 614}, {2464, 617}, {2464, 624}, {2476, 628}, {2465, 632}, {2492, 619},
+    {2488, 620}, {2493, 633}, {2492, 618}, {2470, 622}, {2519, 637}, {2486, 625}, {2435, 623}, {2484, 626},
+    {2436, 627}, {2435, 631}, {2492, 635}, {2526, 636}, {2618, 640}, {2439, 646}, {2447, 657}, {2546, 662},
+    {2442, 657}, {2487, 641}, {2552, 669}, {2495, 622}, {2476, 622}, {2447, 641}, {2470, 668}, {2442, 646},
+    {2440, 645}, {2441, 654}, {2436, 645}, {2438, 652}, {2619, 654}, {2440, 656}, {2617, 661}, {2453, 663},
+    {2438, 652}, {2512, 652}, {2446, 655}, {2653, 664}, {2452, 654}, {2462, 664}, {2462, 651}, {2448, 643},
+    {2435, 645}, {2458, 644}, {2661, 647}, {2668, 672}, {2463, 664}, {2644, 692}, {2614, 675}, {2615, 687},
+    {2612, 684}, {2658, 685}, {2461, 664}, {2684, 694}, {2663, 695}, {2674, 693}, {2683, 698}, {2678, 704},
+    {2623, 666}, {2628, 708}, {2668, 686}, {2598, 682}, {2627, 676}, {2439, 662}, {2635, 718}, {2637, 673},
+    {2624, 703}, {2633, 697}, {2648, 706}, {2674, 712}, {2628, 712}, {2684, 712}, {2635, 693}, {2675, 712},
+    {2670, 666}, {2644, 722}, {2687, 718}, {2486, 637}, {2624, 717}, {2601, 714}, {2644, 719}, {2647, 719},
+    {2441, 656}, {2449, 662}, {2680, 718}, {2668, 686}, {2606, 719}, {2672, 717}, {2633, 718}, {2682, 686},
+    {2582, 699}, {2602, 702}, {2605, 716}, {2618, 725}, {2668, 723}, {2602, 734}, {2600, 726}, {2600, 720},
+    {2617, 724}, {2593, 726}, {2593, 733}, {2638, 730}, {2593, 705}, {2621, 711}, {2562, 735}, {2625, 723},
+    {2666, 723}, {2650, 736}, {2649, 723}, {2570, 743}, {2618, 720}, {2603, 726}, {2581, 750}, {2649, 716},
+    {2621, 735}, {2560, 753}, {2678, 758}, {2795, 763}, {2637, 730}, {2619, 730}, {2632, 734}, {2635, 730},
+    {2592, 715}, {2622, 707}, {2610, 709}, {2581, 738}, {2616, 749}, {2589, 748}, {2587, 756}, {2572, 738},
+    {2627, 755}, {2590, 751}, {2794, 745}, {2560, 756}, {2561, 749}, {2580, 759}, {2801, 761}, {2787, 760},
+    {2571, 748}, {2798, 760}, {2623, 709}, {2581, 755}, {2623, 709}, {2585, 756}, {2610, 709}, {2787, 766},
+    {2786, 638}, {2570, 751}, {2588, 759}, {2588, 751}, {2585, 751}, {2594, 715}, {2592, 715}, {2612, 707},
+    {2798, 765}, {2795, 747}, {2583, 758}, {2795, 768}, {2815, 762}, {2784, 777}, {2766, 789}, {2811, 788},
+    {2764, 771}, {2800, 769}, {2801, 765}, {2735, 775}, {2784, 782}, {2794, 786}, {2805, 784}, {2591, 702},
+    {2800, 765}, {2793, 785}, {2814, 790}, {2800, 800}, {2794, 765}, {2754, 812}, {2754, 819}, {2770, 818},
+    {2765, 823}, {2811, 824}, {2780, 827}, {2802, 747}, {2726, 639}, {2705, 773}, {2761, 798}, {2792, 785},
+    {2760, 774}, {2709, 796}, {2753, 799}, {2717, 797}, {2648, 702}, {2675, 699}, {2653, 725}, {2758, 799},
+    {2782, 678}, {2753, 674}, {2783, 680}, {2702, 690}, {2703, 677}, {2778, 683}, {2743, 642}, {2769, 648},
+    {2780, 650}, {2761, 653}, {2762, 658}, {2731, 659}, {2708, 660}, {2719, 680}, {2731, 665}, {2765, 667},
+    {2792, 762}, {2737, 737}, {2720, 811}, {2736, 815}, {2754, 774}, {2861, 817}, {2736, 826}, {2577, 758},
+    {2727, 781}, {2746, 671}, {2747, 649}, {2763, 688}, {2757, 691}, {2750, 754}, {2772, 670}, {2748, 814},
+    {2696, 801}, {2744, 742}, {2750, 814}, {2739, 746}, {2697, 757}, {2693, 803}, {2875, 820}, {2872, 821},
+    {2731, 688}, {2862, 816}, {2749, 810}, {2715, 836}, {2694, 852}, {2689, 856}, {2721, 688}, {2801, 834},
+    {2704, 820}, {2743, 801}, {2748, 810}, {2742, 754}, {2705, 841}, {2878, 842}, {2702, 836}, {2718, 861},
+    {2746, 832}, {2716, 846}, {2730, 855}, {2691, 848}, {2716, 780}, {2713, 776}, {2696, 846}, {2719, 772},
+    {2705, 770}, {2905, 787}, {2703, 832}, {2904, 794}, {2938, 792}, {2902, 679}, {2915, 696}, {2865, 727},
+    {2943, 731}, {2697, 770}, {2920, 728}, {2743, 832}, {2703, 832}, {2938, 681}, {2921, 689}, {2914, 791},
+    {2723, 770}, {2942, 838}, {2932, 835}, {2858, 689}, {2933, 854}, {2691, 855}, {2930, 843}, {2856, 848},
+    {2935, 793}, {2890, 837}, {2927, 847}, {2934, 833}, {2940, 839}, {2884, 721}, {2902, 764}, {2928, 839},
+    {2768, 649}, {2881, 764}, {2699, 834}, {2884, 729}, {2847, 767}, {2894, 741}, {2903, 862}, {2796, 670},
+    {2895, 859}, {2839, 845}, {2909, 864}, {2818, 869}, {2934, 793}, {2941, 793}, {2942, 847}, {2897, 764},
+    {2820, 862}, {2860, 837}, {2888, 851}, {2883, 729}, {2897, 862}, {2910, 873}, {2931, 851}, {2884, 876},
+    {2909, 882}, {2722, 691}, {2825, 865}, {2748, 670}, {2725, 671}, {2766, 781}, {2893, 867}, {2895, 895},
+    {2910, 894}, {2898, 813}, {2910, 888}, {2911, 888}, {2894, 804}, {2904, 825}, {2887, 878}, {2862, 879},
+    {2876, 872}, {2856, 874}, {2878, 892}, {2918, 701}, {2878, 710}, {2862, 713}, {2854, 840}, {2874, 874},
+    {2849, 858}, {2871, 806}, {2870, 809}, {2819, 896}, {2864, 910}, {2899, 895}, {3002, 912}, {2878, 916},
+    {2851, 889}, {2878, 700}, {2905, 732}, {2871, 919}, {2819, 739}, {2906, 919}, {2816, 899}, {2825, 898},
+    {2871, 901}, {2822, 913}, {2831, 915}, {2868, 914}, {2819, 917}, {3038, 897}, {2827, 900}, {2991, 902},
+    {2927, 903}, {2845, 909}, {2837, 911}, {2842, 918}, {2828, 928}, {3001, 937}, {2854, 936}, {2830, 951},
+    {2846, 947}, {2830, 957}, {2847, 740}, {2827, 930}, {3055, 940}, {3048, 948}, {3044, 949}, {2980, 950},
+    {3041, 931}, {3051, 744}, {3052, 752}, {2998, 960}, {3048, 931}, {3042, 975}, {3025, 971}, {2959, 969},
+    {3061, 960}, {3057, 981}, {2979, 979}, {3013, 961}, {3066, 963}, {3018, 964}, {3053, 967}, {3056, 972},
+    {2981, 973}, {3029, 980}, {3028, 890}, {3024, 893}, {3018, 885}, {2979, 887}, {3001, 885}, {3064, 992},
+    {2991, 995}, {2968, 1006}, {2900, 889}, {3005, 1010}, {2825, 899}, {3003, 1013}, {2984, 1015}, {2996, 805},
+    {3066, 983}, {3035, 974}, {3015, 969}, {3033, 978}, {3005, 1007}, {3006, 1012}, {3004, 802}, {2988, 802},
+    {2958, 952}, {2957, 956}, {2976, 1007}, {3003, 933}, {2992, 932}, {2980, 939}, {2996, 1007}, {2979, 970},
+    {2951, 987}, {2987, 988}, {2999, 990}, {2946, 977}, {2986, 822}, {3117, 831}, {2967, 955}, {3131, 934},
+    {2990, 1012}, {2954, 929}, {2869, 732}, {2874, 732}, {2955, 778}, {2971, 779}, {3036, 978}, {2980, 1012},
+    {2957, 906}, {3030, 783}, {2957, 906}, {2952, 906}, {2849, 700}, {2958, 795}, {3028, 807}, {2955, 808},
+    {3058, 969}, {3063, 969}, {2958, 906}, {2541, 829}, {2975, 863}, {2998, 906}, {2971, 853}, {2985, 866},
+    {2971, 883}, {3008, 974}, {2974, 868}, {3059, 983}, {2965, 881}, {2958, 830}, {2962, 844}, {3070, 849},
+    {975, 850}, {2970, 860}, {3070, 969}, {3170, 1000}, {2955, 906}, {3162, 1004}, {2987, 990}, {2945, 906},
+    {3177, 828}, {2947, 857}, {3186, 994}, {3160, 999}, {3192, 1019}, {3176, 1016}, {3179, 1022}, {3199, 1020},
+    {3177, 997}, {3112, 1024}, {3172, 1017}, {3091, 1039}, {3155, 1017}, {3195, 1038}, {3190, 1043}, {3176, 997},
+    {3186, 1045}, {3110, 1031}, {3103, 1025}, {3104, 1027}, {3198, 1032}, {3172, 1024}, {3155, 1046}, {3138, 1047},
+    {3189, 1024}, {3151, 1054}, {3149, 1034}, {3142, 1043}, {3103, 1034}, {3096, 1032}, {3193, 1034}, {3157, 884},
+    {3153, 1029}, {3146, 880}, {3167, 1030}, {3162, 1049}, {3102, 1050}, {3139, 1052}, {3167, 1056}, {3164, 1052},
+    {3111, 1064}, {3125, 871}, {3179, 1030}, {3157, 1060}, {3155, 870}, {3122, 875}, {3118, 1066}, {3110, 870},
+    {3109, 1068}, {3149, 1061}, {3150, 1084}, {3156, 1070}, {3111, 1067}, {3133, 1074}, {3081, 1092}, {3134, 1095},
+    {3142, 1060}, {3159, 1070}, {2947, 828}, {3183, 880}, {3122, 1103}, {3152, 1052}, {3111, 1067}, {3126, 1102},
+    {3161, 1053}, {3132, 1057}, {3199, 1039}, {3118, 1057}, {3128, 1088}, {3072, 1095}, {3128, 1107}, {3119, 1104},
+    {3120, 877}, {3087, 1059}, {3133, 1058}, {3091, 1062}, {3258, 1071}, {3101, 1096}, {3104, 1088}, {3102, 1099},
+    {3113, 1104}, {3119, 1109}, {3197, 1039}, {3086, 1098}, {3294, 1093}, {3096, 1094}, {3168, 1039}, {3256, 1114},
+    {3126, 1088}, {3081, 1116}, {3095, 935}, {3122, 1109}, {3078, 942}, {3091, 1120}, {3125, 1057}, {3073, 1122},
+    {3092, 1133}, {3149, 1135}, {3138, 1128}, {3086, 1130}, {3137, 1142}, {3089, 1136}, {3308, 1137}, {3316, 1148},
+    {3299, 1086}, {3305, 1079}, {3316, 1078}, {3320, 1072}, {3301, 1069}, {3248, 1152}, {3300, 1165}, {3303, 1171},
+    {3297, 1175}, {3314, 1139}, {3313, 1124}, {2971, 857}, {3264, 941}, {3271, 1001}, {3138, 1027}, {3265, 982},
+    {3273, 1021}, {3231, 976}, {3277, 1021}, {3270, 945}, {2870, 974}, {3285, 954}, {3104, 1053}, {2836, 969},
+    {3301, 1156}, {3321, 1151}, {3324, 1143}, {3299, 1143}, {3323, 1123}, {3284, 946}, {3308, 1145}, {3229, 944},
+    {3266, 953}, {3281, 993}, {3298, 1151}, {3211, 907}, {3229, 986}, {3288, 986}, {3230, 908}, {3232, 886},
+    {3265, 958}, {3318, 1123}, {3275, 958}, {3283, 1077}, {3245, 1151}, {3287, 905}, {3271, 953}, {3290, 1077},
+    {3318, 1143}, {3305, 1145}, {3222, 1041}, {3310, 1145}, {3321, 1143}, {3264, 905}, {3326, 1145}, {3230, 993},
+    {3281, 1073}, {3295, 1081}, {3244, 1055}, {3293, 1073}, {3290, 1087}, {3281, 1087}, {3242, 1051}, {3235, 1036},
+    {3234, 1035}, {3279, 984}, {3243, 1035}, {3239, 966}, {3298, 920}, {3263, 965}, {3245, 924}, {3261, 998},
+    {3253, 1018}, {3253, 891}, {3247, 1055}, {3232, 1051}, {3373, 1055}, {3250, 965}, {3293, 1073}, {3293, 1081},
+    {3254, 1087}, {3303, 1110}, {3249, 1118}, {3200, 1115}, {3294, 1101}, {3206, 1115}, {3230, 1158}, {3255, 1087},
+    {3216, 1155}, {3224, 1166}, {3248, 1169}, {3228, 1150}, {3225, 1138}, {3220, 1140}, {3224, 1129}, {3222, 1134},
+    {3219, 1153}, {3296, 1156}, {3210, 1157}, {3208, 1167}, {3202, 984}, {3226, 1168}, {3428, 1121}, {3446, 1125},
+    {3446, 1126}, {3275, 1155}, {3438, 1144}, {3430, 1146}, {3455, 1063}, {3426, 1091}, {3455, 1090}, {3424, 962},
+    {3426, 1083}, {3453, 904}, {3436, 1089}, {3445, 1097}, {3448, 1100}, {3432, 1083}, {3437, 1264}, {3398, 1244},
+    {3254, 984}, {3259, 984}, {3430, 1127}, {3427, 1075}, {3436, 1075}, {3426, 1085}, {3443, 1154}, {3441, 1117},
+    {3409, 1240}, {3428, 1075}, {3404, 921}, {3406, 922}, {3401, 1113}, {3377, 1075}, {3448, 1154}, {3398, 1112},
+    {3447, 1154}, {3397, 1119}, {3394, 1108}, {3405, 923}, {3261, 984}, {3260, 984}, {3407, 925}, {3278, 946},
+    {3449, 1117}, {3448, 1085}, {3437, 1127}, {3395, 1184}, {3400, 923}, {3422, 1192}, {3416, 1204}, {3415, 1205},
+    {3229, 1164}, {3400, 968}, {3419, 1202}, {3419, 1200}, {3398, 1202}, {3417, 1214}, {3393, 938}, {3408, 943},
+    {3423, 1040}, {3415, 1044}, {3416, 1048}, {3418, 989}, {3356, 1160}, {3391, 1163}, {3385, 1178}, {3369, 1182},
+    {3359, 991}, {3358, 991}, {3370, 1161}, {3433, 1200}, {3362, 1170}, {3446, 1011}, {3371, 1161}, {3364, 1014},
+    {3361, 1080}, {3373, 1082}, {3369, 926}, {3390, 927}, {3341, 959}, {3378, 985}, {3377, 996}, {3371, 991},
+    {3363, 1174}, {3388, 1002}, {3414, 1003}, {3385, 1005}, {3380, 1008}, {3381, 1009}, {3382, 1023}, {3375, 1026},
+    {3381, 1028}, {3369, 1033}, {3376, 1037}, {3382, 1042}, {3337, 1065}, {3330, 1076}, {3344, 1105}, {3330, 1159},
+    {3336, 1181}, {3334, 1141}, {3347, 1149}, {3342, 1106}, {3356, 1111}, {3411, 1131}, {3331, 1132}, {3409, 1147},
+    {3359, 1162}, {3345, 1172}, {3340, 1173}, {3342, 1176}, {3333, 1177}, {3346, 1186}, {3361, 1174}, {3357, 1201},
+    {3348, 1179}, {3346, 1180}, {3330, 1185}, {3205, 1164}, {3340, 1191}, {3359, 1193}, {3393, 1183}, {3352, 1187},
+    {3347, 1188}, {3351, 1189}, {3358, 1190}, {3553, 1194}, {3573, 1195}, {3566, 1196}, {3568, 1197}, {3565, 1198},
+    {3575, 1199}, {3560, 1216}, {3555, 1246}, {3580, 1203}, {3563, 1206}, {3566, 1208}, {3556, 1215}, {3580, 1211},
+    {3545, 1217}, {3287, 1164}, {3571, 1238}, {3571, 1207}, {3580, 1210}, {3570, 1212}, {3531, 1213}, {3477, 1218},
+    {3565, 1209}, {3500, 1220}, {3501, 1222}, {3564, 1219}, {3580, 1221}, {3525, 1223}, {3577, 1224}, {3571, 1225},
+    {3522, 1226}, {3543, 1227}, {3520, 1228}, {3529, 1229}, {3489, 1230}, {3333, 1231}, {3536, 1232}, {3533, 1233},
+    {3578, 1234}, {3540, 1235}, {3205, 1164}, {3401, 968}, {3576, 1236}, {3549, 1237}, {3572, 1209}, {3520, 1239},
+    {3544, 1241}, {3524, 1242}, {3478, 1243}, {3521, 1245}, {3520, 1247}, {3520, 1248}, {3541, 1249}, {3544, 1250},
+    {3522, 1251}, {3542, 1252}, {3542, 1253}, {3540, 1254}, {3561, 1255}, {3511, 1256}, {3542, 1257}, {3548, 1258},
+    {3538, 1259}, {3457, 1260}, {3549, 1261}, {3540, 1262}, {3543, 1263}, {3537, 1265}, {3578, 1266}, {3501, 1267},
+    {3495, 1268}, {3488, 1279}, {3497, 1280}, {3526, 1289}, {3498, 1296}, {3515, 1269}, {3496, 1270}, {3499, 1271},
+    {3569, 1272}, {3475, 1273}, {3519, 1277}, {3461, 1278}, {3517, 1274}, {3503, 1268}, {3492, 1275}, {3519, 1276},
+    {3560, 1281}, {3510, 1287}, {3540, 1282}, {3541, 1309}, {3512, 1283}, {3512, 1284}, {3508, 1285}, {3555, 1286},
+    {3513, 1288}, {3642, 1290}, {3490, 1291}, {3506, 1292}, {3509, 1293}, {3556, 1294}, {3518, 1295}, {3471, 1297},
+    {3477, 1298}, {3480, 1299}, {3555, 1300}, {3461, 1301}, {3466, 1302}, {2020, 1303}, {3470, 1304}, {3470, 1312},
+    {3538, 1335}, {3539, 1340}, {3486, 1305}, {3466, 1306}, {3470, 1307}, {3506, 1313}, {3457, 1317}, {3470, 1308},
+    {3481, 1315}, {3460, 1318}, {3571, 1323}, {3534, 1334}, {3476, 1320}, {3480, 1327}, {3459, 1310}, {3468, 1311},
+    {3478, 1314}, {3476, 1316}, {3469, 1319}, {3475, 1322}, {3473, 1324}, {3472, 1343}, {3458, 1315}, {3682, 1321},
+    {3680, 1325}, {3648, 1326}, {3685, 1328}, {3696, 1329}, {3698, 1330}, {3694, 1331}, {3634, 1332}, {3635, 1333},
+    {3704, 1336}, {3692, 1338}, {3636, 1339}, {3482, 1343}, {3599, 1341}, {3708, 1344}, {3662, 1362}, {3691, 1361},
+    {3690, 1337}, {3687, 1345}, {3706, 1355}, {3687, 1342}, {3682, 1346}, {3607, 1347}, {3707, 1348}, {3693, 1349},
+    {3694, 1350}, {3617, 1352}, {3688, 1356}, {3708, 1351}, {3649, 1353}, {3690, 1354}, {3616, 1357}, {3665, 1358},
+    {3665, 1359}, {3658, 1360}, {3648, 1363}, {3650, 1364}, {3657, 1365}, {3613, 1366}, {3649, 1367}, {3656, 1368},
+    {3659, 1369}, {3689, 1337}, {3653, 1370}, {3660, 1371}, {3675, 1372}, {3675, 1373}, {3594, 1374}, {3664, 1375},
+    {3693, 1396}, {3692, 1376}, {3677, 1377}, {3668, 1383}, {3671, 1378}, {3670, 1379}, {3677, 1380}, {3672, 1381},
+    {3658, 1382}, {3702, 1397}, {3671, 1384}, {3665, 1385}, {3670, 1386}, {3615, 1387}, {3667, 1384}, {3707, 1388},
+    {3619, 1389}, {3631, 1391}, {3697, 1392}, {3629, 1393}, {3628, 1394}, {3618, 1395}, {3617, 1398}, {3637, 1399},
+    {3691, 1400}, {3590, 1401}, {3689, 1402}, {3622, 1403}, {3643, 1404}, {3647, 1405}, {3641, 1406}, {3627, 1407},
+    {3618, 1390}, {3640, 1408}, {3703, 1409}, {3675, 1410}, {3645, 1411}, {3585, 1439}, {3674, 1412}, {3589, 1413},
+    {3587, 1432}, {3628, 1390}, {3617, 1390}, {3594, 1414}, {3602, 1416}, {3641, 1415}, {3635, 1390}, {3622, 1390},
+    {3623, 1417}, {3612, 1418}, {3617, 1390}, {3584, 1415}, {3616, 1390}, {3595, 1419}, {3589, 1420}, {3592, 1421},
+    {3596, 1422}, {3591, 1423}, {3611, 1424}, {3613, 1415}, {3588, 1425}, {3603, 1426}, {3590, 1427}, {3605, 1428},
+    {3663, 1429}, {3660, 1431}, {3588, 1438}, {3594, 1430}, {3651, 1433}, {3611, 1434}, {3609, 1435}, {3599, 1436},
+    {3604, 1437}, {3597, 1440}, {3770, 1441}, {3603, 1442}, {3808, 1443}, {3805, 1444}, {3818, 1445}, {3774, 1446},
+    {3812, 1447}, {3813, 1448}, {3829, 1449}, {3834, 1450}, {3798, 1451}, {3797, 1468}, {3832, 1467}, {1357, 1452},
+    {3810, 1523}, {3832, 1453}, {3833, 1455}, {3810, 1456}, {3808, 1457}, {3824, 1458}, {2686, 1459}, {3831, 1465},
+    {3835, 1454}, {3757, 1469}, {3818, 1461}, {3831, 1471}, {3744, 1472}, {3836, 1474}, {3816, 1488}, {3838, 1473},
+    {3783, 1475}, {3741, 1480}, {3752, 1481}, {3777, 1477}, {3800, 1528}, {3786, 1462}, {3836, 1457}, {3802, 1464},
+    {3835, 1454}, {3819, 1484}, {258, 1463}, {3802, 1509}, {3778, 1529}, {3822, 1498}, {3805, 1492}, {3800, 1485},
+    {2699, 1466}, {3802, 1470}, {3811, 1479}, {3787, 1484}, {3804, 1482}, {3794, 1486}, {3753, 1487}, {3749, 1489},
+    {3733, 1460}, {3742, 1476}, {3794, 1483}, {3768, 1478}, {3768, 1490}, {3779, 1504}, {3744, 1520}, {3738, 1491},
+    {3819, 1506}, {3752, 1535}, {3745, 1531}, {3770, 1493}, {3786, 1494}, {3787, 1495}, {3788, 1496}, {3756, 1497},
+    {3754, 1499}, {3828, 1497}, {3765, 1500}, {3775, 1501}, {3748, 1518}, {3762, 1502}, {2789, 1536}, {3767, 1637},
+    {3809, 1503}, {3812, 1515}, {3713, 1517}, {3735, 1519}, {3723, 1522}, {3720, 1530}, {3775, 1637}, {3774, 1637},
+    {3814, 1505}, {3712, 1516}, {3770, 1518}, {3717, 1516}, {3805, 1534}, {3767, 1510}, {2748, 1507}, {3712, 1508},
+    {3742, 1511}, {3743, 1512}, {752, 1537}, {3736, 1636}, {3741, 1513}, {3715, 1514}, {3733, 1524}, {3742, 1533},
+    {3736, 1559}, {3741, 1526}, {3776, 1527}, {3942, 1540}, {3720, 1551}, {3727, 1552}, {3721, 1554}, {3753, 1505},
+    {3739, 1521}, {3792, 1483}, {1636, 1539}, {3742, 1638}, {3932, 1566}, {3937, 1547}, {3936, 1567}, {3951, 1564},
+    {3716, 1615}, {3790, 1538}, {3730, 1532}, {3948, 1542}, {3954, 1541}, {3888, 1545}, {3966, 1557}, {3936, 1543},
+    {3928, 1565}, {3961, 1556}, {3942, 1525}, {3957, 1544}, {3952, 1546}, {3959, 1548}, {3959, 1549}, {3942, 1565},
+    {3887, 1568}, {3797, 1478}, {3954, 1597}, {3953, 1598}, {3936, 1548}, {3952, 1569}, {3957, 1599}, {3778, 1532},
+    {3896, 1541}, {3947, 1570}, {3961, 1586}, {3876, 1588}, {3904, 1590}, {3923, 1550}, {3913, 1560}, {3732, 1538},
+    {3874, 1553}, {3906, 1571}, {3921, 1575}, {3915, 1555}, {3788, 1476}, {3777, 1460}, {3790, 1478}, {3904, 1572},
+    {3924, 1580}, {3858, 1573}, {3930, 1584}, {3934, 1577}, {3761, 1615}, {3932, 1596}, {3904, 1595}, {3934, 1593},
+    {3925, 1558}, {3929, 1577}, {3930, 1561}, {3947, 1574}, {3920, 1579}, {3923, 1589}, {1739, 1562}, {3926, 1663},
+    {3905, 1602}, {3898, 1576}, {3925, 1587}, {3935, 1577}, {3927, 1558}, {3912, 1581}, {3934, 1584}, {3928, 1594},
+    {3931, 1563}, {3931, 1600}, {3891, 1610}, {3868, 1616}, {3963, 1620}, {3875, 1601}, {3876, 1627}, {3876, 1578},
+    {3886, 1604}, {3875, 1656}, {3879, 1583}, {3876, 1585}, {3880, 1591}, {3873, 1592}, {3874, 1603}, {3947, 1605},
+    {3902, 1582}, {3873, 1606}, {3901, 1607}, {3876, 1608}, {3872, 1609}, {3926, 1611}, {3890, 1612}, {3860, 1585},
+    {3884, 1613}, {3888, 1614}, {4013, 1583}, {3886, 1617}, {3892, 1631}, {3880, 1618}, {3872, 1582}, {3891, 1619},
+    {3883, 1621}, {3883, 1622}, {3856, 1623}, {3846, 1624}, {3854, 1625}, {4027, 1626}, {1213, 1628}, {1021, 1664},
+    {3842, 1765}, {3862, 1632}, {3852, 1660}, {3942, 1629}, {3843, 1630}, {3853, 1634}, {3847, 1639}, {3946, 1633},
+    {3847, 1635}, {3870, 1640}, {3915, 1641}, {3867, 1642}, {3958, 1643}, {3959, 1644}, {3857, 1645}, {191, 1646},
+    {3862, 1647}, {3910, 1648}, {687, 1665}, {1351, 1666}, {4069, 1736}, {4008, 1649}, {4057, 1650}, {4085, 1667},
+    {3868, 1653}, {3868, 1764}, {3853, 1635}, {4073, 1680}, {4071, 1686}, {1849, 1668}, {4075, 1761}, {4066, 1651},
+    {3866, 1764}, {3863, 1764}, {4068, 1764}, {4076, 1652}, {4093, 1654}, {1275, 1655}, {4066, 1761}, {4073, 1761},
+    {4093, 1657}, {4085, 1669}, {4074, 1764}, {4065, 1691}, {1075, 1670}, {4093, 1763}, {3988, 1743}, {4034, 1672},
+    {4071, 1689}, {4012, 1658}, {4082, 1671}, {4086, 1674}, {4064, 1659}, {4090, 1662}, {4073, 1673}, {4088, 1675},
+    {4077, 1676}, {4093, 1677}, {4032, 1682}, {4034, 1690}, {4085, 1688}, {4058, 1696}, {4056, 1706}, {4052, 1716},
+    {4042, 1715}, {3991, 1683}, {3855, 1635}, {4063, 1694}, {4037, 1697}, {4047, 1702}, {4059, 1684}, {4056, 1685},
+    {4005, 1676}, {320, 1687}, {4090, 1738}, {3857, 1653}, {4005, 1692}, {4005, 1698}, {4011, 1725}, {4007, 1699},
+    {4008, 1695}, {4014, 1700}, {4004, 1701}, {3986, 1703}, {4008, 1720}, {4066, 1713}, {3852, 1635}, {4025, 1704},
+    {4092, 1661}, {4005, 1678}, {4011, 1679}, {4058, 1681}, {4034, 1693}, {4019, 1727}, {4001, 1705}, {4031, 1707},
+    {4018, 1708}, {4016, 1709}, {4022, 1710}, {4054, 1711}, {4003, 1712}, {4066, 1714}, {4067, 1717}, {4028, 1718},
+    {4059, 1723}, {3971, 1719}, {3970, 1728}, {4013, 1748}, {4017, 1749}, {3983, 1729}, {4066, 1753}, {3981, 1721},
+    {3968, 1722}, {3979, 1724}, {3979, 1730}, {3992, 1750}, {4019, 1726}, {3982, 1732}, {3975, 1735}, {3969, 1731},
+    {4154, 1733}, {4015, 1739}, {3971, 1755}, {3974, 1734}, {3975, 1737}, {3987, 1751}, {3986, 1741}, {3988, 1742},
+    {4000, 1756}, {3987, 1752}, {4201, 1744}, {4205, 1754}, {4208, 1758}, {4100, 1745}, {4198, 1746}, {4206, 1747},
+    {4207, 1757}, {4182, 1759}, {4218, 1760}, {4107, 1762}, {4179, 1766}, {4194, 1767}, {4148, 1789}, {4219, 1768},
+    {4143, 1850}, {4218, 1770}, {4141, 1771}, {4214, 1769}, {4220, 1772}, {4222, 1773}, {516, 1793}, {4160, 1774},
+    {3983, 1740}, {4213, 1792}, {4201, 1892}, {4169, 1775}, {4222, 1776}, {4211, 1792}, {4171, 1777}, {4222, 1792},
+    {4174, 1783}, {4211, 1892}, {4219, 1778}, {4170, 1779}, {4038, 1678}, {4124, 1780}, {4017, 1693}, {4176, 1781},
+    {4196, 1792}, {4035, 1679}, {4213, 1892}, {4214, 1792}, {4114, 1782}, {4160, 1784}, {4112, 1785}, {4185, 1786},
+    {4058, 1678}, {1523, 1794}, {4173, 1882}, {4189, 1883}, {4189, 1787}, {4209, 1747}, {4160, 1788}, {4182, 1795},
+    {4148, 1797}, {4179, 1791}, {4108, 1796}, {4184, 1798}, {4034, 1678}, {4098, 1852}, {4170, 1799}, {4047, 1679},
+    {4184, 1800}, {4171, 1801}, {4195, 1802}, {4144, 1803}, {3986, 1740}, {4194, 1804}, {4144, 1806}, {2190, 1808},
+    {4001, 1752}, {4032, 1681}, {4037, 1661}, {4223, 1809}, {4149, 1810}, {3972, 1723}, {4119, 1811}, {4004, 1727},
+    {4118, 1812}, {4139, 1814}, {4135, 1815}, {4157, 1816}, {4148, 1817}, {3992, 1740}, {4203, 1818}, {4151, 1819},
+    {4144, 1790}, {4184, 1805}, {4133, 1807}, {4170, 1813}, {4151, 1824}, {4154, 1828}, {4134, 1820}, {4150, 1821},
+    {4128, 1822}, {4133, 1823}, {4154, 1825}, {4096, 1826}, {4193, 1827}, {4105, 1829}, {4123, 1830}, {2048, 1831},
+    {4118, 1832}, {4165, 1914}, {4331, 1897}, {4344, 1896}, {4108, 2047}, {4349, 1856}, {4290, 1907}, {4139, 1822},
+    {4350, 1833}, {4256, 1834}, {4302, 1835}, {4300, 1836}, {4101, 1832}, {4301, 1838}, {4252, 1839}, {4263, 1840},
+    {4324, 1858}, {4321, 1858}, {4097, 1858}, {4114, 1858}, {4113, 1858}, {4099, 1858}, {4103, 1858}, {4192, 1805},
+    {4124, 1858}, {4290, 1837}, {4323, 1858}, {4112, 1858}, {4289, 1857}, {4109, 1858}, {4120, 1858}, {4116, 1858},
+    {4343, 1858}, {4122, 1858}, {4296, 1905}, {4341, 1858}, {4333, 1858}, {4322, 1858}, {4147, 2044}, {4326, 1858},
+    {4290, 1859}, {4319, 1886}, {4244, 1841}, {4301, 1842}, {4309, 1843}, {4115, 1858}, {4304, 1844}, {4297, 1837},
+    {4333, 1846}, {4289, 1845}, {4277, 1847}, {4307, 1848}, {4250, 1860}, {4289, 1866}, {4312, 1870}, {4259, 1849},
+    {4260, 1851}, {4253, 1853}, {4252, 1861}, {4224, 1880}, {4225, 1887}, {4323, 1854}, {4304, 1862}, {4261, 1863},
+    {4249, 1855}, {4279, 1864}, {4266, 1865}, {4188, 1790}, {4263, 1867}, {4267, 1868}, {4244, 1869}, {4261, 1871},
+    {4264, 1872}, {4270, 1873}, {4287, 1874}, {4272, 1918}, {4136, 1813}, {4262, 1875}, {4236, 1876}, {4276, 1901},
+    {4268, 1898}, {4269, 1891}, {4280, 1890}, {4286, 1888}, {4280, 1919}, {4141, 1790}, {4274, 1916}, {4273, 1878},
+    {4237, 1881}, {4098, 1827}, {4237, 1884}, {4241, 1885}, {4325, 1889}, {4227, 1893}, {4327, 1894}, {4249, 1895},
+    {4135, 1807}, {4272, 1978}, {4249, 1900}, {4248, 1921}, {4113, 2035}, {4303, 1902}, {4450, 1903}, {4250, 1921},
+    {4247, 1904}, {4452, 1906}, {4243, 1908}, {4104, 1823}, {4290, 1909}, {4225, 1910}, {67, 1911}, {4232, 1913},
+    {4256, 1877}, {4320, 1879}, {4233, 1920}, {4252, 1915}, {4236, 1920}, {4452, 1917}, {4253, 1922}, {4471, 1923},
+    {4461, 1928}, {4440, 1935}, {4459, 1924}, {4477, 1930}, {4458, 1932}, {4451, 1925}, {4431, 1926}, {4448, 1927},
+    {4427, 1944}, {4451, 1941}, {4376, 1929}, {1782, 1931}, {4469, 2002}, {4467, 2006}, {4461, 1986}, {4473, 1933},
+    {4449, 1925}, {4463, 1934}, {4469, 1944}, {4479, 1936}, {4385, 1937}, {4399, 1944}, {4225, 1920}, {2318, 1938},
+    {2515, 1939}, {4427, 1940}, {4389, 1949}, {4456, 1947}, {4419, 2038}, {4431, 1946}, {4441, 1950}, {4431, 1942},
+    {4294, 1917}, {4465, 1947}, {4435, 1932}, {4442, 1923}, {4428, 2038}, {4423, 1943}, {4374, 1945}, {4466, 1953},
+    {4434, 1979}, {4423, 1951}, {4426, 1952}, {4436, 1954}, {4362, 1962}, {4417, 1955}, {4433, 1984}, {4425, 1957},
+    {4451, 1959}, {4432, 1981}, {4429, 1958}, {4385, 1963}, {4388, 1976}, {4394, 1971}, {4391, 1977}, {4387, 1964},
+    {4419, 1948}, {4443, 1956}, {4436, 2046}, {4477, 1967}, {4391, 1960}, {4385, 1961}, {4384, 1965}, {4414, 1966},
+    {4388, 1972}, {4395, 1982}, {4538, 1968}, {4396, 1985}, {4385, 1987}, {1535, 1969}, {2394, 1970}, {4459, 1973},
+    {4395, 2014}, {4386, 1988}, {4407, 1998}, {4390, 1960}, {4438, 2046}, {4408, 2008}, {4404, 1975}, {4374, 1980},
+    {4357, 1983}, {4374, 1990}, {4358, 1991}, {4363, 2000}, {4414, 2014}, {4374, 2001}, {4368, 2011}, {4356, 1992},
+    {4358, 1993}, {4390, 1989}, {4360, 1994}, {4414, 1989}, {4229, 1879}, {4406, 1989}, {4400, 1974}, {4524, 1995},
+    {4408, 1989}, {4360, 1997}, {4401, 1999}, {4379, 2003}, {4375, 2005}, {4394, 2009}, {4393, 2010}, {4377, 2012},
+    {4411, 1989}, {4365, 2013}, {4281, 1877}, {4394, 1989}, {4398, 1989}, {4352, 2015}, {4373, 2016}, {4475, 2017},
+    {4476, 2018}, {4372, 2019}, {4395, 1974}, {4478, 2020}, {4441, 1956}, {4371, 2021}, {4440, 1948}, {4441, 1956},
+    {4457, 1996}, {4383, 2004}, {4467, 2007}, {4595, 2022}, {4588, 2023}, {4543, 2024}, {4586, 2025}, {4584, 2026},
+    {4577, 2027}, {4581, 2028}, {4490, 2029}, {4580, 2048}, {4581, 2121}, {4584, 2030}, {4589, 2031}, {4514, 2032},
+    {4607, 2050}, {4606, 2051}, {4520, 2076}, {4599, 2072}, {4554, 2033}, {4594, 2049}, {4600, 2058}, {4504, 2068},
+    {4592, 2054}, {4595, 2073}, {4547, 2075}, {4585, 2078}, {4588, 2034}, {4593, 2052}, {4599, 2065}, {4592, 2036},
+    {4553, 2053}, {4416, 2167}, {4545, 2037}, {4510, 2057}, {4517, 2079}, {4508, 2040}, {4509, 2042}, {4520, 2060},
+    {4544, 2061}, {4574, 2039}, {4594, 2043}, {4544, 2056}, {4550, 2070}, {4491, 2064}, {4488, 2066}, {4570, 2045},
+    {4567, 2055}, {4536, 2059}, {4552, 2069}, {4481, 2077}, {4577, 2080}, {4570, 2083}, {4524, 2102}, {4383, 2004},
+    {4653, 2067}, {4521, 2071}, {4534, 2081}, {4582, 2004}, {4521, 2103}, {4515, 2084}, {4512, 2071}, {4605, 2085},
+    {4550, 2041}, {4565, 2062}, {4503, 2104}, {4512, 2111}, {4592, 2063}, {4537, 2082}, {4513, 2098}, {4518, 2086},
+    {4542, 2099}, {4482, 2074}, {4532, 2087}, {4538, 2088}, {4352, 2007}, {4531, 2090}, {4543, 2063}, {751, 2089},
+    {4534, 2165}, {4539, 2164}, {4527, 2145}, {4521, 2144}, {4534, 2087}, {4489, 2091}, {4581, 2093}, {4492, 2101},
+    {4579, 2092}, {4537, 2094}, {4488, 2095}, {4495, 2096}, {4507, 2097}, {4586, 2105}, {4510, 2106}, {4360, 1996},
+    {4530, 2124}, {4531, 2074}, {4493, 2107}, {4511, 2109}, {4590, 2108}, {4511, 2112}, {4511, 2129}, {4525, 2110},
+    {4508, 2113}, {4511, 2176}, {4378, 2290}, {4502, 2113}, {4490, 2243}, {4602, 2265}, {4511, 2113}, {4495, 2114},
+    {4566, 2055}, {4499, 2115}, {4503, 2116}, {4713, 2117}, {4727, 2119}, {4529, 2124}, {4721, 2120}, {4502, 2041},
+    {4668, 2122}, {4710, 2118}, {4696, 2123}, {4570, 2055}, {4572, 2062}, {4654, 2118}, {4695, 2125}, {4570, 2055},
+    {4542, 2100}, {4733, 2126}, {4709, 2127}, {4718, 2128}, {4707, 2146}, {4663, 2170}, {4719, 2130}, {4715, 2131},
+    {4722, 2147}, {4685, 2148}, {4649, 2153}, {4628, 2157}, {4721, 2136}, {4729, 2141}, {4733, 2149}, {4734, 2132},
+    {4704, 2169}, {4729, 2169}, {4646, 2133}, {4728, 2134}, {4711, 2151}, {4730, 2168}, {4677, 2135}, {4734, 2147},
+    {4683, 2137}, {4699, 2138}, {4699, 2139}, {4673, 2140}, {4700, 2150}, {4682, 2158}, {4682, 2160}, {4700, 2142},
+    {4692, 2177}, {4678, 2291}, {4682, 2143}, {4692, 2152}, {4673, 2291}, {4675, 2154}, {4807, 2291}, {4689, 2155},
+    {4679, 2156}, {4678, 2159}, {4639, 2161}, {4699, 2162}, {4696, 2163}, {4686, 2172}, {4694, 2166}, {4700, 2171},
+    {4701, 2173}, {4693, 2174}, {4702, 2175}, {4615, 2178}, {4638, 2180}, {4697, 2179}, {4699, 2195}, {4645, 2181},
+    {4636, 2182}, {4651, 2183}, {4732, 2184}, {4632, 2185}, {4682, 2177}, {4781, 2186}, {4681, 2291}, {4653, 2187},
+    {4649, 2192}, {4652, 2193}, {4642, 2207}, {4651, 2188}, {4795, 2194}, {4625, 2198}, {4623, 2189}, {4622, 2208},
+    {4663, 2238}, {4662, 2190}, {4668, 2191}, {4667, 2196}, {4694, 2197}, {4665, 2199}, {4655, 2200}, {4667, 2201},
+    {4666, 2202}, {4710, 2203}, {4667, 2204}, {4708, 2205}, {4653, 2206}, {4613, 2209}, {2729, 2210}, {4613, 2211},
+    {4611, 2212}, {4613, 2213}, {4612, 2214}, {4626, 2215}, {4608, 2216}, {4615, 2217}, {4608, 2218}, {4619, 2219},
+    {4618, 2220}, {4621, 2221}, {4620, 2222}, {4692, 2223}, {4611, 2224}, {4612, 2225}, {4627, 2226}, {4609, 2227},
+    {4636, 2228}, {4726, 2229}, {4630, 2230}, {4728, 2231}, {4624, 2232}, {4631, 2234}, {4726, 2157}, {4621, 2235},
+    {4630, 2233}, {4845, 2236}, {4529, 2100}, {4848, 2237}, {4842, 2239}, {4833, 2240}, {4841, 2241}, {4852, 2242},
+    {4636, 2233}, {4837, 2244}, {4787, 2245}, {4746, 2246}, {4842, 2247}, {4790, 2248}, {4844, 2249}, {4817, 2250},
+    {4833, 2251}, {4815, 2252}, {4779, 2253}, {4858, 2254}, {4777, 2255}, {4861, 2256}, {4852, 2257}, {4863, 2258},
+    {4835, 2259}, {4845, 2260}, {4848, 2261}, {4853, 2262}, {4769, 2272}, {4803, 2294}, {4775, 2263}, {4859, 2264},
+    {4848, 2266}, {4805, 2267}, {4862, 2268}, {4814, 2269}, {4741, 2270}, {1329, 2271}, {4772, 2273}, {4773, 2274},
+    {4811, 2275}, {4821, 2276}, {4736, 2277}, {4800, 2278}, {4825, 2279}, {4742, 2280}, {4831, 2281}, {4863, 2282},
+    {4815, 2283}, {680, 2284}, {4814, 2285}, {4746, 2286}, {4816, 2287}, {4822, 2288}, {4824, 2289}, {4851, 2292},
+    {4801, 2293}, {4821, 2295}, {4805, 2296}, {4810, 2297}, {4793, 2298}, {4812, 2299}, {4831, 2300}, {4814, 2301},
+    {4828, 2302}, {4831, 2303}, {4822, 2304}, {4769, 2305}, {4788, 2306}, {4780, 2307}, {4746, 2308}, {1734, 2309},
+    {4768, 2310}, {4863, 2311}, {4761, 2312}, {4807, 2313}, {4850, 2314}, {4851, 2315}, {4779, 2316}, {4786, 2317},
+    {4812, 2318}, {4793, 2319}, {4852, 2320}, {4782, 2333}, {4785, 2321}, {4798, 2322}, {1854, 2323}, {4787, 2324},
+    {4790, 2325}, {4813, 2326}, {4846, 2327}, {4821, 2328}, {4848, 2329}, {4790, 2330}, {4791, 2331}, {4768, 2332},
+    {4782, 2334}, {4799, 2335}, {4828, 2336}, {4782, 2337}, {2608, 2338}, {2092, 2339}, {4794, 2340}, {4793, 2341},
+    {4827, 2342}, {4834, 2343}, {4738, 2344}, {4829, 2346}, {4818, 2347}, {4762, 2348}, {4842, 2349}, {4767, 2350},
+    {4822, 2351}, {4823, 2352}, {4765, 2353}, {220, 2354}, {4821, 2355}, {4766, 2356}, {4766, 2358}, {4757, 2359},
+    {4853, 2360}, {4854, 2361}, {4765, 2362}, {4759, 2363}, {4757, 2364}, {4776, 2365}, {4754, 2366}, {4750, 2367},
+    {4804, 2368}, {4758, 2382}, {4965, 2369}, {1663, 2370}, {4865, 2371}, {4974, 2372}, {4970, 2373}, {4965, 2374},
+    {4960, 2375}, {4924, 2376}, {4962, 2377}, {4969, 2378}, {4915, 2379}, {4963, 2380}, {4974, 2381}, {4991, 2395},
+    {4837, 2345}, {4961, 2383}, {4966, 2384}, {4988, 2385}, {4963, 2386}, {4966, 2387}, {4967, 2388}, {4981, 2389},
+    {4885, 2390}, {4886, 2391}, {4987, 2392}, {4980, 2400}, {4984, 2425}, {4989, 2393}, {4891, 2394}, {1896, 2396},
+    {4982, 2397}, {4949, 2398}, {4890, 2399}, {4949, 2401}, {4934, 2402}, {4945, 2403}, {4939, 2404}, {233, 2405},
+    {4941, 2406}, {4937, 2407}, {4934, 2408}, {4904, 2409}, {4928, 2410}, {4880, 2411}, {4965, 2412}, {4941, 2413},
+    {1375, 2414}, {4957, 2415}, {4884, 2416}, {4957, 2417}, {4874, 2418}, {4944, 2419}, {4973, 2420}, {4915, 2421},
+    {4949, 2422}, {4879, 2423}, {4876, 2424}, {4973, 2398}, {4952, 2426}, {4938, 2427}, {4941, 2428}, {4955, 2429},
+    {4923, 2430}, {4942, 2431}, {4990, 2432}, {4991, 2433}, {4944, 2434}, {4910, 2435}, {4909, 2436}, {4984, 2437},
+    {4911, 2438}, {4891, 2439}, {4906, 2440}, {4903, 2441}, {4910, 2442}, {4897, 2446}, {4903, 2443}, {4907, 2444},
+    {4888, 2445}, {4940, 2447}, {4899, 2448}, {4924, 2464}, {4899, 2474}, {4900, 2473}, {4914, 2478}, {4896, 2479},
+    {4913, 2482}, {4923, 2484}, {4873, 2449}, {4951, 2450}, {4917, 2451}, {4904, 2452}, {4922, 2453}, {4966, 2454},
+    {4911, 2455}, {4958, 2456}, {4879, 2457}, {4961, 2458}, {4880, 2459}, {4953, 2460}, {4887, 2461}, {4876, 2462},
+    {4956, 2463}, {4873, 2465}, {4900, 2466}, {103, 2467}, {4892, 2468}, {4989, 2394}, {4894, 2469}, {4757, 2345},
+    {4971, 2470}, {4877, 2471}, {4867, 2472}, {4879, 2475}, {4949, 2491}, {4894, 2483}, {4951, 2477}, {4936, 2476},
+    {4870, 2480}, {4865, 2481}, {4940, 2485}, {4882, 2486}, {4903, 2487}, {4864, 2488}, {4873, 2489}, {4879, 2490},
+    {4873, 2492}, {4893, 2480}, {4883, 2493}, {4891, 2494}, {4882, 2495}, {4992, 2496}, {4993, 2497}, {5085, 2498},
+    {5101, 2499}, {4996, 2500}, {5055, 2501}, {5105, 2502}, {5053, 2503}, {5118, 2504}, {5088, 2505}, {5076, 2507},
+    {5002, 2506}, {5090, 2508}, {5102, 2509}, {5101, 2510}, {5007, 2511}, {5116, 2512}, {5106, 2513}, {5109, 2514},
+    {5039, 2515}, {5093, 2516}, {5105, 2517}, {5106, 2518}, {5114, 2520}, {5103, 2521}, {5105, 2528}, {5057, 2544},
+    {5100, 2522}, {5081, 2523}, {5064, 2524}, {5056, 2542}, {5068, 2525}, {2722, 2560}, {5061, 2527}, {5036, 2529},
+    {5015, 2530}, {5082, 2531}, {5039, 2532}, {5077, 2533}, {5061, 2534}, {5079, 2535}, {2655, 2561}, {5098, 2545},
+    {5066, 2661}, {5074, 2660}, {5070, 2661}, {5066, 2661}, {5080, 2555}, {5062, 2661}, {4994, 2536}, {5049, 2537},
+    {161, 2538}, {5083, 2539}, {5092, 2540}, {5072, 2541}, {5068, 2661}, {5057, 2661}, {4999, 2543}, {5084, 2547},
+    {5062, 2548}, {5047, 2549}, {5075, 2661}, {5030, 2550}, {5027, 2562}, {5031, 2617}, {5027, 2551}, {5040, 2553},
+    {1071, 2563}, {5039, 2662}, {5047, 2641}, {5083, 2660}, {5034, 2554}, {5038, 2556}, {5039, 2557}, {5096, 2555},
+    {5105, 2558}, {5011, 2559}, {5036, 2564}, {591, 2565}, {5039, 2566}, {5052, 2567}, {5051, 2568}, {5048, 2569},
+    {5029, 2570}, {5034, 2571}, {1241, 2572}, {451, 2573}, {2155, 2574}, {5038, 2575}, {5085, 2577}, {4993, 2576},
+    {5012, 2578}, {4997, 2579}, {5052, 2571}, {5003, 2580}, {4996, 2594}, {5051, 2581}, {5012, 2583}, {4992, 2591},
+    {5048, 2571}, {5041, 2571}, {5004, 2590}, {5097, 2584}, {5098, 2592}, {5062, 2615}, {5100, 2585}, {5018, 2593},
+    {5041, 2595}, {5116, 2511}, {5006, 2586}, {5038, 2587}, {5022, 2588}, {5108, 2506}, {5036, 2589}, {5108, 2596},
+    {5219, 2597}, {5019, 2599}, {5033, 2600}, {5016, 2601}, {5015, 2603}, {5015, 2624}, {5011, 2668}, {5179, 2604},
+    {5057, 2605}, {5021, 2606}, {5066, 2586}, {5016, 2607}, {5118, 2625}, {5176, 2655}, {5016, 2608}, {5177, 2626},
+    {5124, 2647}, {5210, 2609}, {5126, 2610}, {5228, 2612}, {5246, 2613}, {5174, 2614}, {5175, 2616}, {5229, 2619},
+    {5230, 2611}, {5173, 2628}, {5137, 2648}, {5238, 2620}, {5196, 2621}, {5222, 2622}, {5232, 2623}, {5223, 2632},
+    {5229, 2639}, {5239, 2627}, {5146, 2629}, {5234, 2630}, {5244, 2631}, {5239, 2633}, {5147, 2634}, {5222, 2611},
+    {5206, 2635}, {5145, 2636}, {5184, 2637}, {5242, 2644}, {5191, 2638}, {5159, 2640}, {5193, 2623}, {5208, 2642},
+    {5199, 2643}, {5187, 2645}, {5199, 2646}, {5189, 2642}, {5190, 2649}, {5231, 2650}, {5169, 2651}, {5205, 2652},
+    {5185, 2653}, {5226, 2654}, {8, 2656}, {5215, 2657}, {5187, 2658}, {5122, 2659}, {5208, 2663}, {5203, 2664},
+    {5179, 2665}, {5199, 2666}, {5208, 2686}, {5194, 2683}, {5201, 2673}, {5157, 2667}, {5172, 2669}, {5166, 2670},
+    {5162, 2671}, {5147, 2672}, {5247, 2684}, {5152, 2674}, {5161, 2675}, {5179, 2676}, {5141, 2677}, {5160, 2679},
+    {5139, 2680}, {5153, 2684}, {628, 2681}, {5239, 2682}, {5137, 2685}, {5153, 2687}, {5156, 2688}, {5176, 2689},
+    {5171, 2690}, {5205, 2692}, {5246, 2629}, {5182, 2691}, {5129, 2693}, {5179, 2694}, {5181, 2695}, {5165, 2696},
+    {5183, 2697}, {5180, 2698}, {5181, 2699}, {5165, 2711}, {5125, 2704}, {5137, 2718}, {5180, 2700}, {5120, 2701},
+    {5212, 2702}, {5224, 2703}, {5122, 2705}, {5133, 2706}, {5134, 2707}, {5123, 2708}, {2461, 2709}, {5151, 2710},
+    {5123, 2712}, {5132, 2713}, {5306, 2715}, {5120, 2716}, {5144, 2717}, {5142, 2719}, {5127, 2720}, {5163, 2721},
+    {5146, 2722}, {5161, 2723}, {5142, 2724}, {5145, 2728}, {5156, 2729}, {5138, 2730}, {1221, 2731}, {5154, 2732},
+    {5153, 2733}, {5130, 2734}, {401, 2735}, {5348, 2736}, {5361, 2754}, {5367, 2814}, {5367, 2794}, {5188, 2629},
+    {5308, 2737}, {5255, 2738}, {5350, 2739}, {5359, 2752}, {5374, 2803}, {5355, 2736}, {1372, 2740}, {2114, 2741},
+    {5349, 2742}, {5168, 2691}, {5302, 2744}, {5189, 2651}, {5261, 2745}, {5372, 2753}, {5352, 2761}, {5364, 2760},
+    {5172, 2714}, {5240, 2725}, {5326, 2762}, {5350, 2770}, {5373, 2748}, {5352, 2749}, {5367, 2750}, {5375, 2751},
+    {5369, 2755}, {5300, 2756}, {5352, 2758}, {5370, 2766}, {5370, 2767}, {5359, 2759}, {5313, 2763}, {5316, 2764},
+    {5315, 2768}, {5322, 2769}, {5335, 2771}, {5370, 2773}, {741, 2774}, {5330, 2776}, {5292, 2777}, {5313, 2778},
+    {5361, 2779}, {5269, 2780}, {5342, 2816}, {5334, 2781}, {5338, 2782}, {5352, 2783}, {5349, 2784}, {5307, 2800},
+    {5322, 2775}, {5341, 2930}, {5332, 2785}, {5340, 2786}, {5325, 2787}, {517, 2817}, {5329, 2786}, {5295, 2916},
+    {5283, 2904}, {5297, 2892}, {5301, 2788}, {1022, 2818}, {5284, 2919}, {5281, 2897}, {5295, 2819}, {5162, 2929},
+    {5316, 2930}, {5321, 2775}, {5298, 2787}, {5287, 2789}, {5320, 2775}, {5312, 2775}, {5292, 2790}, {5334, 2930},
+    {5285, 2791}, {5285, 2792}, {5290, 2793}, {5264, 2795}, {5263, 2796}, {5262, 2797}, {5302, 2798}, {5260, 2799},
+    {5332, 2802}, {5258, 2804}, {2572, 2820}, {5311, 2894}, {5302, 2805}, {5308, 2806}, {5299, 2807}, {5299, 2821},
+    {5305, 2935}, {5309, 2808}, {5248, 2809}, {5183, 2935}, {5311, 2810}, {5266, 2811}, {5251, 2812}, {5250, 2813},
+    {5256, 2815}, {5266, 2822}, {5255, 2823}, {5253, 2824}, {5251, 2825}, {5334, 2826}, {277, 2827}, {5250, 2828},
+    {5358, 2829}, {5359, 2830}, {5269, 2831}, {2074, 2832}, {5275, 2833}, {5259, 2834}, {5324, 2835}, {5264, 2836},
+    {5264, 2933}, {5276, 2837}, {1761, 2838}, {5312, 2839}, {5151, 2725}, {5256, 2840}, {5254, 2833}, {5276, 2841},
+    {5275, 2933}, {5270, 2933}, {5258, 2842}, {5317, 2843}, {5473, 2844}, {5480, 2845}, {5482, 2846}, {5474, 2847},
+    {5484, 2849}, {5424, 2850}, {5128, 2714}, {5332, 2777}, {5484, 2851}, {5430, 2852}, {5503, 2853}, {5371, 2749},
+    {5497, 2880}, {5494, 2941}, {5490, 2924}, {5498, 2854}, {5498, 2855}, {5497, 2857}, {5444, 2928}, {5442, 2856},
+    {5382, 2848}, {5496, 2858}, {5480, 2859}, {5472, 2860}, {789, 2861}, {5487, 2862}, {5502, 2863}, {5490, 2909},
+    {5441, 2864}, {5483, 2865}, {5453, 2866}, {208, 2867}, {5459, 2868}, {5451, 2869}, {5415, 2870}, {5448, 2871},
+    {5469, 2881}, {5451, 2887}, {5454, 2885}, {5440, 2899}, {5443, 2896}, {5428, 2872}, {5460, 2873}, {5430, 2874},
+    {5469, 2875}, {5471, 2876}, {5474, 2877}, {5467, 2882}, {5468, 2889}, {5484, 2863}, {5409, 2898}, {5429, 2879},
+    {5420, 2883}, {5427, 2884}, {5424, 2886}, {5412, 2888}, {5412, 2890}, {5483, 2891}, {5447, 2893}, {5491, 2895},
+    {5451, 2900}, {5423, 2901}, {5453, 2902}, {5409, 2903}, {5437, 2906}, {5391, 2907}, {5426, 2908}, {5480, 2910},
+    {562, 2944}, {5441, 2868}, {5426, 3027}, {5432, 2911}, {1945, 2912}, {5418, 2913}, {5465, 2914}, {5435, 2915},
+    {5467, 2917}, {5423, 2918}, {5432, 2920}, {5377, 2921}, {5378, 2922}, {5377, 2925}, {5391, 2945}, {5379, 2983},
+    {5426, 3045}, {5418, 2923}, {5471, 2926}, {5383, 2946}, {5395, 2923}, {5484, 2931}, {5402, 3056}, {5386, 2932},
+    {5404, 2934}, {5602, 2936}, {2612, 2947}, {5407, 3056}, {5423, 3036}, {5392, 2937}, {5393, 2938}, {5420, 2939},
+    {5454, 2940}, {5493, 2942}, {5380, 2943}, {5563, 2948}, {5403, 3056}, {5379, 2949}, {5399, 2950}, {5390, 2946},
+    {5414, 2951}, {5413, 2952}, {5435, 3045}, {5406, 2967}, {5395, 2953}, {5402, 2954}, {5379, 2874}, {5604, 2955},
+    {5394, 3067}, {330, 2956}, {5564, 2960}, {5630, 2972}, {5403, 3067}, {5475, 2848}, {5602, 3049}, {5615, 2957},
+    {5600, 2958}, {5614, 2982}, {5606, 2981}, {5454, 2870}, {5601, 2981}, {5617, 2978}, {5613, 3049}, {5600, 3049},
+    {5628, 2980}, {5629, 2991}, {5455, 2874}, {5582, 2979}, {5624, 2982}, {5631, 2982}, {5570, 2990}, {5601, 2979},
+    {5568, 2989}, {5624, 2987}, {5568, 2984}, {5590, 2993}, {5550, 3005}, {5606, 2980}, {5628, 2980}, {5572, 2961},
+    {5570, 2977}, {5580, 2976}, {5572, 2986}, {5572, 2997}, {5594, 2996}, {5569, 2996}, {5579, 2986}, {5557, 2962},
+    {5610, 2977}, {5568, 2999}, {5579, 2999}, {5622, 2976}, {5584, 2986}, {5593, 2997}, {5595, 2996}, {5573, 2999},
+    {5537, 2995}, {5626, 2976}, {5599, 2992}, {5622, 2977}, {5529, 2963}, {5556, 2964}, {5585, 2992}, {5599, 2997},
+    {5573, 2996}, {5571, 2996}, {5584, 2996}, {5527, 2965}, {5578, 2995}, {5541, 2966}, {5557, 2992}, {5542, 2968},
+    {457, 2969}, {5541, 2970}, {5541, 2971}, {5537, 2985}, {5521, 3007}, {5536, 2973}, {5584, 2974}, {1812, 2975},
+    {5541, 2988}, {5563, 2994}, {5543, 2998}, {5553, 3000}, {5690, 3000}, {5541, 3001}, {5591, 3002}, {5565, 3003},
+    {5508, 3004}, {5550, 3006}, {5546, 3008}, {5559, 2988}, {5549, 3009}, {188, 3010}, {5504, 3011}, {5517, 3012},
+    {5691, 3013}, {5515, 3014}, {5614, 3019}, {5616, 3020}, {5522, 3021}, {5553, 3003}, {5561, 3003}, {5533, 3022},
+    {5506, 3015}, {5596, 3016}, {5514, 3017}, {5514, 3018}, {5535, 3023}, {5507, 3012}, {5510, 3024}, {5529, 3025},
+    {5526, 3026}, {5529, 3028}, {5518, 3029}, {5530, 3030}, {5529, 3031}, {5523, 3016}, {5532, 3032}, {5522, 3033},
+    {5520, 3034}, {5746, 3035}, {5745, 3037}, {5747, 3038}, {5741, 3072}, {5516, 3015}, {5860, 3186}, {5758, 3039},
+    {5754, 3040}, {5757, 3041}, {5731, 3042}, {5716, 3043}, {5737, 3044}, {5734, 3046}, {5754, 3047}, {5513, 3019},
+    {1118, 3073}, {5742, 3172}, {5757, 3048}, {5751, 3050}, {5735, 3051}, {2373, 3052}, {5706, 3053}, {2433, 3054},
+    {5748, 3172}, {5753, 3172}, {5514, 3017}, {5731, 3055}, {5742, 3074}, {5750, 3076}, {5748, 3102}, {5755, 3057},
+    {5749, 3058}, {5753, 3059}, {5748, 3063}, {5790, 3060}, {5520, 3017}, {5663, 3061}, {5704, 3064}, {5704, 3066},
+    {5672, 3068}, {5750, 3069}, {5648, 3071}, {5710, 3075}, {5678, 3112}, {5508, 3018}, {5520, 3017}, {5725, 3078},
+    {5711, 3062}, {5754, 3065}, {5709, 3077}, {5698, 3079}, {5704, 3062}, {5700, 3115}, {5719, 3080}, {5717, 3081},
+    {5720, 3082}, {5647, 3083}, {5699, 3062}, {5722, 3084}, {5703, 3114}, {5726, 3085}, {5704, 3096}, {5698, 3062},
+    {5721, 3086}, {5714, 3065}, {5717, 3087}, {5700, 3077}, {5710, 3088}, {5694, 3101}, {5716, 3098}, {5683, 3089},
+    {2567, 3090}, {5755, 3092}, {5676, 3093}, {5670, 3094}, {5659, 3095}, {5672, 3097}, {5667, 3107}, {5656, 3113},
+    {5676, 3099}, {1175, 3100}, {5674, 3108}, {5689, 3116}, {5677, 3105}, {2228, 3106}, {5666, 3109}, {5672, 3136},
+    {5694, 3198}, {5664, 3110}, {5647, 3111}, {5739, 3117}, {5714, 3118}, {5692, 3119}, {5688, 3121}, {5640, 3122},
+    {5665, 3120}, {5730, 3123}, {5638, 3124}, {5684, 3125}, {5693, 3137}, {5635, 3199}, {5669, 3196}, {5633, 3126},
+    {5690, 3138}, {5722, 3156}, {5718, 3114}, {5656, 3127}, {5632, 3128}, {5671, 3120}, {5636, 3129}, {5689, 3130},
+    {5641, 3131}, {5636, 3132}, {5818, 3140}, {5659, 3155}, {5645, 3133}, {5634, 3134}, {5683, 3135}, {5741, 3139},
+    {5632, 3141}, {5632, 3142}, {5819, 3143}, {5662, 3144}, {5678, 3145}, {5644, 3147}, {5633, 3148}, {5672, 3152},
+    {5663, 3164}, {5753, 3151}, {5646, 3153}, {5668, 3154}, {5653, 3157}, {5652, 3158}, {5646, 3169}, {5645, 3171},
+    {5876, 3173}, {5866, 3176}, {5877, 3184}, {5875, 3187}, {5870, 3188}, {5861, 3176}, {5865, 3174}, {5868, 3194},
+    {5871, 3159}, {5870, 3160}, {5843, 3161}, {5842, 3162}, {5857, 3163}, {5866, 3165}, {5881, 3166}, {5876, 3167},
+    {5800, 3168}, {1607, 3200}, {5874, 3170}, {5862, 3170}, {5832, 3295}, {5884, 3177}, {5887, 3178}, {5792, 3179},
+    {5885, 3201}, {5881, 3255}, {5869, 3180}, {521, 3202}, {5829, 3276}, {5841, 3181}, {5828, 3182}, {5828, 3183},
+    {5840, 3185}, {5882, 3189}, {5831, 3190}, {155, 3191}, {514, 3192}, {5828, 3193}, {2005, 3195}, {5825, 3197},
+    {5746, 3146}, {5875, 3175}, {5809, 3259}, {5830, 3203}, {5829, 3204}, {5803, 3205}, {5783, 3206}, {5854, 3207},
+    {5825, 3208}, {5781, 3209}, {214, 3210}, {5789, 3211}, {5855, 3212}, {5768, 3213}, {5846, 3214}, {5824, 3215},
+    {5825, 3216}, {5844, 3217}, {5816, 3218}, {5862, 3219}, {5826, 3259}, {5845, 3220}, {5761, 3221}, {5859, 3222},
+    {1327, 3223}, {5843, 3224}, {5840, 3225}, {5883, 3227}, {5880, 3228}, {5798, 3229}, {5802, 3230}, {5795, 3231},
+    {5854, 3226}, {5807, 3232}, {5703, 3233}, {5797, 3234}, {5835, 3235}, {2495, 3236}, {5836, 3237}, {5838, 3238},
+    {1790, 3239}, {5793, 3240}, {5821, 3241}, {5811, 3264}, {5843, 3319}, {5812, 3242}, {5811, 3243}, {5814, 3244},
+    {5882, 3226}, {5849, 3245}, {5850, 3246}, {5810, 3247}, {5820, 3248}, {5823, 3327}, {5822, 3323}, {5774, 3312},
+    {70, 3249}, {5775, 3240}, {5822, 3250}, {5858, 3251}, {5760, 3265}, {5770, 3324}, {5780, 3252}, {5788, 3253},
+    {5781, 3254}, {5811, 3257}, {5762, 3262}, {5804, 3237}, {5946, 3258}, {5809, 3260}, {5845, 3261}, {5873, 3263},
+    {5767, 3266}, {5786, 3267}, {5877, 3268}, {5791, 3278}, {5786, 3269}, {5772, 3328}, {5781, 3270}, {5779, 3271},
+    {5783, 3442}, {5773, 3272}, {6006, 3297}, {5995, 3274}, {5985, 3284}, {5978, 3275}, {5986, 3277}, {5999, 3296},
+    {6012, 3317}, {6014, 3280}, {6009, 3281}, {5655, 3146}, {5998, 3282}, {5942, 3283}, {5788, 3442}, {5903, 3286},
+    {5770, 3273}, {5992, 3285}, {5987, 3287}, {1474, 3288}, {5804, 3266}, {5649, 3146}, {6005, 3289}, {6005, 3290},
+    {6006, 3291}, {5984, 3292}, {617, 3293}, {5985, 3294}, {5986, 3298}, {6014, 3299}, {2364, 3300}, {5959, 3301},
+    {6015, 3302}, {5992, 3273}, {6008, 3303}, {5879, 3175}, {6004, 3304}, {6003, 3307}, {5998, 3310}, {6007, 3305},
+    {6047, 3306}, {5914, 3308}, {1520, 3309}, {5972, 3311}, {5967, 3313}, {5850, 3215}, {5965, 3314}, {5991, 3285},
+    {5767, 3256}, {5968, 3315}, {5919, 3321}, {5970, 3325}, {6007, 3316}, {5907, 3318}, {5930, 3320}, {5967, 3322},
+    {5963, 3326}, {5908, 3329}, {5909, 3330}, {5898, 3331}, {5961, 3332}, {5938, 3333}, {5959, 3334}, {5979, 3335},
+    {5972, 3336}, {5956, 3351}, {5978, 3337}, {5944, 3338}, {1900, 3339}, {5976, 3438}, {5967, 3340}, {5967, 3341},
+    {5957, 3342}, {5895, 3344}, {5983, 3345}, {5963, 3343}, {5952, 3346}, {5939, 3347}, {6008, 3348}, {6009, 3349},
+    {6061, 3350}, {5929, 3360}, {5932, 3388}, {5927, 3361}, {5929, 3364}, {6088, 3366}, {5924, 3390}, {5926, 3352},
+    {5934, 3353}, {5922, 3354}, {5928, 3355}, {5920, 3356}, {5947, 3357}, {5944, 3358}, {5950, 3359}, {6015, 3362},
+    {5920, 3363}, {5937, 3365}, {5940, 3367}, {5951, 3368}, {5934, 3369}, {5984, 3371}, {5940, 3372}, {5951, 3373},
+    {5889, 3374}, {5989, 3375}, {5951, 3376}, {5894, 3377}, {5891, 3378}, {5987, 3379}, {5943, 3381}, {5896, 3382},
+    {5947, 3370}, {5892, 3380}, {5941, 3383}, {5896, 3384}, {5765, 3256}, {5899, 3385}, {5997, 3386}, {5888, 3387},
+    {5784, 3256}, {5933, 3391}, {5916, 3392}, {5914, 3393}, {5904, 3394}, {5913, 3395}, {5900, 3397}, {5908, 3392},
+    {5915, 3398}, {5907, 3399}, {5915, 3400}, {6118, 3401}, {6073, 3402}, {6114, 3403}, {1137, 3404}, {6113, 3405},
+    {6103, 3406}, {6138, 3396}, {6119, 3407}, {6117, 3408}, {6028, 3409}, {6124, 3410}, {6032, 3411}, {6079, 3412},
+    {6062, 3413}, {6090, 3415}, {6133, 3416}, {5965, 3320}, {6132, 3417}, {6139, 3418}, {6134, 3419}, {6132, 3420},
+    {6133, 3421}, {6127, 3422}, {6055, 3423}, {6052, 3424}, {6129, 3425}, {6043, 3426}, {6058, 3427}, {6094, 3428},
+    {6105, 3429}, {5960, 3325}, {6123, 3430}, {5889, 3380}, {6091, 3431}, {6103, 3432}, {446, 3433}, {6016, 3434},
+    {2548, 3435}, {6099, 3436}, {6100, 3440}, {5912, 3387}, {5944, 3370}, {6020, 3448}, {6101, 3437}, {6066, 3439},
+    {5913, 3389}, {6009, 3396}, {6063, 3441}, {6136, 3443}, {6137, 3444}, {6049, 3445}, {6070, 3446}, {6140, 3447},
+    {6141, 3449}, {6088, 3450}, {2754, 3451}, {6131, 3452}, {6090, 3453}, {6129, 3454}, {6122, 3455}, {6060, 3456},
+    {6023, 3457}, {6095, 3458}, {6031, 3459}, {6097, 3460}, {6067, 3461}, {6028, 3462}, {6126, 3463}, {6074, 3464},
+    {6050, 3465}, {6070, 3466}, {6070, 3467}, {6105, 3468}, {6035, 3469}, {6107, 3470}, {6062, 3471}, {6063, 3472},
+    {6079, 3473}, {6038, 3474}, {6079, 3475}, {6078, 3476}, {1671, 3478}, {1040, 3479}, {6019, 3480}, {6039, 3481},
+    {6063, 3482}, {6020, 3483}, {6108, 3484}, {6072, 3485}, {6020, 3486}, {6016, 3487}, {6096, 3488}, {6020, 3490},
+    {6124, 3491}, {6103, 3492}, {5900, 3493}, {6101, 3494}, {6033, 3495}, {6040, 3496}, {6034, 3497}, {6043, 3498},
+    {6095, 3499}, {864, 3500}, {6039, 3501}, {6093, 3502}, {6033, 3503}, {6083, 3504}, {6080, 3505}, {6042, 3506},
+    {6034, 3507}, {6025, 3508}, {6042, 3509}, {6028, 3510}, {6202, 3512}, {6145, 3513}, {6213, 3514}, {2133, 3515},
+    {6147, 3516}, {6148, 3517}, {6207, 3518}, {6204, 3519}, {1467, 3520}, {6246, 3521}, {6152, 3522}, {6247, 3523},
+    {6192, 3524}, {6270, 3525}, {6240, 3527}, {6260, 3528}, {6160, 3530}, {206, 3531}, {6222, 3532}, {6241, 3533},
+    {6269, 3534}, {6190, 3535}, {6264, 3536}, {6178, 3537}, {1838, 3538}, {6256, 3539}, {6176, 3542}, {6212, 3543},
+    {6220, 3529}, {6172, 3544}, {1167, 3545}, {6183, 3546}, {6081, 3396}, {843, 3584}, {6267, 3679}, {6175, 3547},
+    {6176, 3548}, {6229, 3549}, {1463, 3550}, {6219, 3551}, {6179, 3552}, {6180, 3553}, {6225, 3554}, {6182, 3556},
+    {6173, 3557}, {6162, 3558}, {6114, 3389}, {6140, 3397}, {6163, 3559}, {778, 3560}, {66, 3561}, {6159, 3529},
+    {6212, 3562}, {6210, 3563}, {6233, 3564}, {6252, 3565}, {6215, 3566}, {6220, 3567}, {6192, 3568}, {6224, 3569},
+    {6209, 3570}, {2184, 3572}, {6239, 3573}, {6213, 3574}, {6235, 3575}, {6157, 3576}, {6200, 3577}, {6218, 3578},
+    {6144, 3579}, {6203, 3580}, {6237, 3581}, {6234, 3582}, {6211, 3575}, {6220, 3583}, {6149, 3585}, {6193, 3586},
+    {6176, 3587}, {6173, 3588}, {6199, 3589}, {6187, 3590}, {6271, 3591}, {1770, 3592}, {493, 3593}, {6183, 3594},
+    {6178, 3595}, {6180, 3596}, {6204, 3597}, {2295, 3598}, {6256, 3677}, {6164, 3600}, {6179, 3601}, {6179, 3627},
+    {6222, 3602}, {6176, 3603}, {6330, 3604}, {6207, 3605}, {6207, 3606}, {6183, 3608}, {6205, 3609}, {6202, 3610},
+    {2021, 3611}, {6203, 3612}, {6230, 3613}, {6194, 3614}, {6177, 3615}, {6192, 3617}, {6234, 3618}, {6197, 3619},
+    {6236, 3620}, {6193, 3621}, {6156, 3622}, {2108, 3623}, {6245, 3624}, {6240, 3625}, {6241, 3626}, {6156, 3628},
+    {6161, 3629}, {6160, 3630}, {6167, 3631}, {436, 3632}, {6159, 3633}, {6155, 3634}, {6170, 3635}, {6227, 3636},
+    {6158, 3637}, {6225, 3638}, {6252, 3639}, {6145, 3640}, {6178, 3641}, {6173, 3642}, {6161, 3643}, {6160, 3644},
+    {6163, 3645}, {6188, 3646}, {6222, 3647}, {6157, 3648}, {2303, 3649}, {6162, 3650}, {6158, 3651}, {6174, 3652},
+    {6152, 3653}, {6164, 3654}, {6154, 3655}, {6168, 3648}, {6157, 3656}, {6370, 3657}, {6381, 3658}, {2359, 3659},
+    {6374, 3660}, {6163, 3648}, {6368, 3661}, {6379, 3662}, {6278, 3663}, {6379, 3664}, {238, 3665}, {6163, 3648},
+    {6373, 3666}, {2549, 3667}, {6374, 3668}, {6282, 3669}, {6399, 3670}, {6381, 3671}, {6285, 3672}, {6378, 3673},
+    {6378, 3674}, {6314, 3676}, {6398, 3678}, {1427, 3680}, {6390, 3681}, {6348, 3682}, {6318, 3683}, {6293, 3684},
+    {6399, 3685}, {6344, 3686}, {6296, 3687}, {6381, 3688}, {6376, 3697}, {6383, 3689}, {6300, 3690}, {6311, 3691},
+    {6369, 3692}, {6308, 3693}, {6379, 3694}, {6350, 3695}, {6296, 3696}, {6396, 3698}, {6344, 3699}, {6303, 3700},
+    {2279, 3701}, {2221, 3702}, {6272, 3703}, {6392, 3704}, {1642, 3705}, {6312, 3706}, {6348, 3707}, {6315, 3708},
+    {6345, 3709}, {6338, 3710}, {1566, 3712}, {6343, 3711}, {6353, 3713}, {6361, 3714}, {6284, 3715}, {912, 3716},
+    {6351, 3813}, {6360, 3809}, {6363, 3717}, {6359, 3718}, {6272, 3719}, {6331, 3720}, {6341, 3721}, {6364, 3722},
+    {6361, 3813}, {6356, 3813}, {6363, 3723}, {6368, 3724}, {6303, 3725}, {6304, 3726}, {6322, 3727}, {6315, 3728},
+    {6313, 3729}, {6310, 3730}, {6319, 3731}, {6397, 3732}, {6319, 3744}, {6333, 3747}, {6307, 3746}, {6329, 3749},
+    {6315, 3757}, {6313, 3756}, {6307, 3762}, {6315, 3734}, {888, 3735}, {6352, 3736}, {6334, 3737}, {1784, 3738},
+    {6285, 3739}, {6326, 3740}, {6283, 3741}, {6331, 3745}, {6331, 3771}, {6308, 3743}, {6370, 3748}, {6331, 3775},
+    {6362, 3750}, {1033, 3751}, {6313, 3753}, {6316, 3754}, {6321, 3755}, {6366, 3758}, {6362, 3759}, {6363, 3760},
+    {6283, 3761}, {6332, 3763}, {6279, 3764}, {6329, 3765}, {6328, 3766}, {6287, 3767}, {6301, 3769}, {6325, 3770},
+    {6276, 3772}, {6281, 3773}, {6359, 3774}, {6382, 3776}, {6284, 3777}, {6274, 3778}, {6280, 3780}, {6509, 3781},
+    {6292, 3781}, {6291, 3781}, {6302, 3781}, {6297, 3782}, {6289, 3781}, {6339, 3783}, {6290, 3784}, {6292, 3800},
+    {6286, 3801}, {6300, 3794}, {6303, 3781}, {6283, 3785}, {6292, 3789}, {1515, 3790}, {6518, 3791}, {6299, 3781},
+    {6456, 3792}, {6492, 3793}, {6512, 3795}, {6463, 3796}, {6497, 3797}, {6334, 3758}, {6508, 3798}, {6496, 3799},
+    {6496, 3802}, {2315, 3803}, {1150, 3804}, {6508, 3805}, {2775, 3806}, {6498, 3807}, {6509, 3808}, {6526, 3810},
+    {6414, 3826}, {6509, 3811}, {6521, 3812}, {6521, 3814}, {119, 3815}, {6514, 3817}, {6498, 3818}, {6445, 3819},
+    {6504, 3820}, {6470, 3821}, {6516, 3822}, {6430, 3824}, {6509, 3825}, {6527, 3827}, {56, 3828}, {6425, 3830},
+    {6523, 3816}, {6427, 3823}, {6433, 3829}, {6436, 3831}, {1616, 3832}, {6467, 3833}, {750, 3834}, {6474, 3840},
+    {6467, 3855}, {6468, 3835}, {6491, 3836}, {6518, 3816}, {6442, 3837}, {6443, 3838}, {6473, 3839}, {6445, 3841},
+    {6501, 3816}, {1703, 3842}, {6475, 3843}, {6471, 3844}, {6484, 3845}, {6465, 3846}, {6481, 3862}, {6485, 3847},
+    {6465, 3848}, {6412, 3849}, {1393, 3850}, {6484, 3906}, {6480, 3851}, {6472, 3852}, {6494, 3853}, {6465, 3843},
+    {6486, 3951}, {6462, 3854}, {6475, 3856}, {6464, 3857}, {6430, 3858}, {6454, 3859}, {6451, 3860}, {339, 3861},
+    {6481, 3951}, {6492, 3951}, {6427, 3863}, {6434, 3867}, {6439, 3864}, {6432, 3865}, {6458, 3866}, {6458, 3868},
+    {6458, 3869}, {2550, 3870}, {6435, 3963}, {6442, 3871}, {6437, 3872}, {6447, 3873}, {6434, 3875}, {6506, 3876},
+    {6481, 3877}, {6449, 3878}, {6460, 3879}, {2160, 3880}, {6510, 3881}, {6439, 3882}, {6463, 3883}, {6461, 3884},
+    {6462, 3885}, {6456, 3886}, {6403, 3887}, {6456, 3888}, {6444, 3889}, {6495, 3890}, {6490, 3897}, {6409, 3891},
+    {6412, 3892}, {6400, 3893}, {6419, 3894}, {6400, 3895}, {6414, 3896}, {6503, 3899}, {6411, 3900}, {6429, 3901},
+    {6586, 3902}, {6406, 3903}, {6405, 3904}, {6413, 3907}, {6450, 3961}, {771, 3905}, {6419, 3908}, {6449, 3909},
+    {6429, 3910}, {6425, 3911}, {6472, 3912}, {6444, 3913}, {6421, 3968}, {6513, 3823}, {6401, 3914}, {6416, 3915},
+    {6423, 4082}, {6464, 3916}, {6465, 3917}, {6417, 3918}, {6424, 4082}, {6471, 3919}, {6526, 3920}, {6485, 3829},
+    {421, 3921}, {6422, 3922}, {6622, 3923}, {6640, 3924}, {6646, 3925}, {6653, 3927}, {6624, 3928}, {6642, 3929},
+    {6614, 3931}, {6652, 3932}, {6612, 3933}, {6648, 3934}, {6629, 3935}, {6631, 3936}, {6626, 3937}, {6653, 3938},
+    {1975, 3969}, {6640, 4068}, {6647, 3939}, {6641, 3940}, {6574, 3941}, {6630, 3943}, {6651, 3944}, {6626, 3945},
+    {6535, 3930}, {6641, 3947}, {6654, 3957}, {6632, 3948}, {6639, 3949}, {6648, 3950}, {6557, 3952}, {181, 3953},
+    {6599, 3954}, {6654, 3955}, {6552, 3956}, {6596, 3960}, {6564, 3962}, {2185, 3964}, {6606, 3965}, {6606, 3966},
+    {6606, 3967}, {6603, 3970}, {6593, 3971}, {6622, 3972}, {6476, 4087}, {6618, 3974}, {6611, 3975}, {6597, 3976},
+    {6596, 3973}, {6598, 3977}, {6623, 3978}, {6620, 3973}, {6597, 3973}, {6621, 3979}, {6623, 3980}, {6610, 3981},
+    {6614, 3982}, {6620, 3983}, {6606, 3984}, {6613, 3985}, {6613, 3986}, {6606, 3987}, {6609, 4000}, {6572, 4020},
+    {6601, 4017}, {6582, 4021}, {6578, 4017}, {6649, 3989}, {2725, 3990}, {6653, 3991}, {6564, 3992}, {6601, 3993},
+    {6565, 4083}, {6585, 3994}, {6587, 4001}, {6587, 4023}, {6545, 4016}, {6567, 3995}, {6542, 3996}, {6561, 3997},
+    {6572, 4083}, {6563, 4083}, {6564, 3998}, {1479, 3999}, {6587, 4002}, {6583, 4003}, {6586, 4006}, {6582, 4004},
+    {6583, 4018}, {6590, 4007}, {6584, 4008}, {6583, 4009}, {6568, 4010}, {6581, 4012}, {6528, 4013}, {6537, 4014},
+    {6497, 4015}, {6589, 4019}, {6567, 3993}, {6540, 4022}, {6531, 4024}, {6537, 4025}, {6530, 4026}, {6538, 4027},
+    {6541, 4028}, {6554, 4029}, {6580, 4030}, {6536, 4031}, {469, 4032}, {6533, 4033}, {6528, 4035}, {6574, 4007},
+    {6539, 4036}, {6575, 4037}, {6559, 4038}, {6555, 4039}, {6546, 4040}, {6516, 4043}, {6544, 4041}, {6534, 4042},
+    {6545, 4044}, {6544, 4045}, {6554, 4046}, {6649, 3952}, {6555, 4047}, {6625, 3930}, {6555, 4048}, {6544, 4049},
+    {6545, 4050}, {6560, 4051}, {6757, 4052}, {6620, 3977}, {6657, 4053}, {6764, 4055}, {1164, 4056}, {1082, 4057},
+    {6713, 4058}, {6774, 4064}, {6754, 4072}, {6754, 4073}, {6753, 4060}, {6706, 4070}, {6667, 4062}, {6739, 4063},
+    {6753, 4061}, {6777, 4065}, {6670, 4067}, {6709, 4069}, {6755, 4061}, {6698, 4071}, {6776, 4074}, {6674, 4075},
+    {6755, 4076}, {6777, 4077}, {6780, 4076}, {6779, 4076}, {6783, 4078}, {6726, 4079}, {2011, 4096}, {6779, 4197},
+    {6770, 4080}, {6771, 4076}, {6686, 4081}, {6778, 4084}, {6689, 4085}, {6780, 4086}, {6777, 4197}, {6770, 4197},
+    {6736, 4088}, {6687, 4089}, {6721, 4076}, {6733, 4090}, {6720, 4091}, {6726, 4092}, {6660, 4093}, {6740, 4097},
+    {6720, 4098}, {6744, 4099}, {6725, 4101}, {6749, 4102}, {6748, 4125}, {6742, 4103}, {6745, 4104}, {6745, 4105},
+    {6735, 4094}, {6725, 4095}, {6729, 4106}, {6737, 4108}, {6746, 4145}, {6709, 4109}, {6744, 4095}, {315, 4110},
+    {6691, 4203}, {6696, 4111}, {6731, 4095}, {6688, 4112}, {6780, 4113}, {6690, 4114}, {6734, 4095}, {6697, 4095},
+    {6712, 4115}, {6688, 4116}, {6750, 4095}, {6725, 4094}, {1669, 4117}, {6713, 4118}, {427, 4119}, {6750, 4094},
+    {6690, 4210}, {6732, 4190}, {6674, 4120}, {6673, 4121}, {6690, 4203}, {6697, 4122}, {6705, 4123}, {6714, 4124},
+    {6694, 4126}, {6689, 4127}, {6707, 4128}, {6714, 4129}, {6703, 4130}, {6691, 4131}, {6711, 4133}, {2500, 4134},
+    {6713, 4132}, {6749, 4135}, {6700, 4132}, {2388, 4136}, {6709, 4137}, {100, 4138}, {6704, 4139}, {6660, 4140},
+    {6819, 4141}, {6670, 4142}, {6754, 4143}, {6669, 4160}, {6665, 4186}, {6714, 4146}, {6713, 4147}, {6691, 4132},
+    {6674, 4149}, {1714, 4150}, {6684, 4151}, {1411, 4152}, {6668, 4153}, {6671, 4154}, {6664, 4155}, {6671, 4161},
+    {6656, 4156}, {6670, 4164}, {6658, 4157}, {6660, 4158}, {6656, 4159}, {6771, 4162}, {6679, 4163}, {6674, 4183},
+    {6660, 4166}, {6723, 4085}, {6672, 4171}, {6685, 4180}, {219, 4165}, {6687, 4156}, {6723, 4167}, {6678, 4168},
+    {6670, 4172}, {6882, 4173}, {6889, 4174}, {6890, 4175}, {6788, 4176}, {2096, 4177}, {6847, 4178}, {6881, 4181},
+    {6906, 4182}, {6889, 4184}, {6895, 4185}, {6892, 4187}, {6907, 4188}, {6907, 4192}, {6892, 4196}, {6819, 4189},
+    {6670, 4169}, {6790, 4179}, {6909, 4191}, {6895, 4198}, {6905, 4206}, {6907, 4207}, {6816, 4194}, {6856, 4195},
+    {6909, 4199}, {6852, 4200}, {6907, 4201}, {6860, 4213}, {6868, 4212}, {6862, 4202}, {6878, 4208}, {6854, 4221},
+    {6685, 4169}, {6678, 4169}, {6879, 4222}, {6854, 4222}, {6854, 4204}, {6869, 4215}, {6848, 4204}, {6795, 4205},
+    {6865, 4232}, {6850, 4243}, {6879, 4235}, {6856, 4241}, {6871, 4209}, {6824, 4214}, {6858, 4217}, {6871, 4217},
+    {6861, 4211}, {6821, 4224}, {6879, 4225}, {6820, 4226}, {6875, 4216}, {6822, 4236}, {6816, 4218}, {6874, 4216},
+    {6827, 4230}, {6821, 4239}, {6834, 4234}, {6848, 4224}, {6821, 4233}, {6844, 4227}, {6841, 4237}, {6831, 4230},
+    {6878, 4224}, {6844, 4247}, {6838, 4238}, {6816, 4229}, {6833, 4228}, {6842, 4233}, {6835, 4249}, {6846, 4248},
+    {6860, 4225}, {6836, 4250}, {6830, 4252}, {6831, 4219}, {6852, 4211}, {6795, 4246}, {6803, 4242}, {6851, 4225},
+    {6841, 4240}, {6794, 4254}, {6837, 4240}, {6785, 4220}, {808, 4223}, {6797, 4231}, {6802, 4244}, {6841, 4245},
+    {6829, 4251}, {6797, 4253}, {6838, 4255}, {6837, 4257}, {6792, 4258}, {6835, 4259}, {6812, 4260}, {6787, 4261},
+    {2626, 4262}, {6790, 4264}, {6786, 4275}, {6856, 4265}, {6828, 4266}, {6970, 4267}, {6809, 4269}, {2157, 4270},
+    {6861, 4271}, {6806, 4285}, {6805, 4286}, {6813, 4272}, {6791, 4273}, {6814, 4274}, {6971, 4276}, {7026, 4278},
+    {7020, 4279}, {7013, 4293}, {7012, 4281}, {7010, 4288}, {6896, 4179}, {7023, 4309}, {6923, 4289}, {7011, 4301},
+    {7010, 4290}, {7020, 4350}, {7029, 4340}, {7016, 4330}, {7015, 4291}, {7037, 4349}, {2272, 4282}, {7029, 4319},
+    {231, 4283}, {7028, 4284}, {7035, 4287}, {6984, 4292}, {7020, 4293}, {7016, 4294}, {7029, 4295}, {7038, 4296},
+    {7031, 4297}, {7021, 4290}, {7033, 4298}, {7024, 4299}, {6948, 4300}, {7036, 4302}, {7039, 4303}, {6991, 4304},
+    {6900, 4268}, {6918, 4280}, {6983, 4305}, {6978, 4306}, {6989, 4307}, {6988, 4308}, {7078, 4310}, {6980, 4311},
+    {6993, 4312}, {6988, 4313}, {6982, 4314}, {7006, 4315}, {7007, 4316}, {6980, 4317}, {6991, 4318}, {7005, 4321},
+    {6999, 4329}, {6997, 4328}, {7001, 4322}, {7020, 4323}, {6926, 4324}, {6999, 4326}, {7003, 4331}, {6925, 4332},
+    {6914, 4333}, {7000, 4334}, {7006, 4335}, {7004, 4336}, {7007, 4337}, {6991, 4338}, {7079, 4339}, {1588, 4341},
+    {6992, 4352}, {6956, 4356}, {6959, 4362}, {6955, 4367}, {6940, 4342}, {6950, 4353}, {6951, 4369}, {6975, 4343},
+    {597, 4344}, {6972, 4345}, {6985, 4346}, {7024, 4347}, {6952, 4354}, {6968, 4371}, {1665, 4348}, {6968, 4351},
+    {6954, 4355}, {6944, 4357}, {6946, 4358}, {6963, 4359}, {6970, 4360}, {6996, 4361}, {6946, 4363}, {6968, 4364},
+    {6975, 4410}, {6972, 4365}, {6958, 4366}, {6958, 4368}, {6962, 4370}, {6951, 4372}, {2752, 4373}, {7013, 4374},
+    {7002, 4375}, {7009, 4377}, {7000, 4378}, {6972, 4379}, {6924, 4380}, {6927, 4381}, {6933, 4382}, {6938, 4383},
+    {6914, 4384}, {6921, 4386}, {6922, 4387}, {6957, 4388}, {6931, 4390}, {6934, 4391}, {6934, 4392}, {6928, 4393},
+    {6937, 4394}, {7040, 4395}, {2172, 4396}, {7143, 4397}, {7158, 4400}, {7132, 4413}, {7139, 4398}, {7142, 4399},
+    {7046, 4401}, {7141, 4402}, {7090, 4403}, {7148, 4404}, {7139, 4405}, {7094, 4406}, {7147, 4407}, {7121, 4408},
+    {7055, 4409}, {7119, 4411}, {7152, 4412}, {7117, 4414}, {7009, 4280}, {6801, 4268}, {7153, 4415}, {7136, 4416},
+    {7087, 4417}, {7075, 4419}, {7109, 4420}, {7151, 4421}, {7107, 4422}, {941, 4423}, {7078, 4424}, {7155, 4425},
+    {7065, 4427}, {7111, 4428}, {1724, 4480}, {7120, 4581}, {7122, 4571}, {7160, 4429}, {7058, 4430}, {7123, 4431},
+    {7158, 4432}, {2244, 4433}, {7056, 4434}, {7118, 4435}, {7107, 4436}, {7132, 4437}, {7107, 4438}, {7121, 4439},
+    {7062, 4418}, {7073, 4426}, {7126, 4440}, {7110, 4441}, {7108, 4445}, {7122, 4442}, {7129, 4443}, {7128, 4444},
+    {7126, 4446}, {7118, 4447}, {7129, 4448}, {7116, 4449}, {7074, 4450}, {7112, 4451}, {7084, 4452}, {7069, 4453},
+    {7085, 4454}, {7094, 4455}, {7109, 4456}, {7082, 4458}, {7078, 4459}, {7081, 4481}, {7079, 4595}, {7098, 4460},
+    {7060, 4461}, {7085, 4462}, {7118, 4463}, {7056, 4464}, {7077, 4482}, {7089, 4500}, {7052, 4465}, {7150, 4466},
+    {7148, 4468}, {7074, 4469}, {7095, 4470}, {7046, 4471}, {7045, 4472}, {7083, 4473}, {7080, 4474}, {7094, 4477},
+    {7083, 4479}, {7044, 4483}, {7055, 4484}, {2733, 4485}, {7063, 4487}, {7138, 4486}, {7051, 4488}, {7142, 4489},
+    {7042, 4491}, {7055, 4492}, {7145, 4493}, {7093, 4494}, {7043, 4495}, {6926, 4605}, {7090, 4496}, {7045, 4497},
+    {842, 4498}, {7046, 4499}, {7063, 4501}, {7154, 4502}, {7040, 4503}, {7059, 4505}, {7058, 4506}, {7069, 4512},
+    {7159, 4528}, {7162, 4507}, {7163, 4508}, {7075, 4509}, {7066, 4510}, {7073, 4511}, {7053, 4513}, {7321, 4514},
+    {7041, 4486}, {7147, 4418}, {7264, 4515}, {498, 4516}, {1893, 4518}, {7276, 4547}, {559, 4519}, {7268, 4521},
+    {7266, 4537}, {7292, 4522}, {7269, 4523}, {268, 4524}, {7253, 4526}, {7278, 4525}, {7268, 4525}, {7060, 4493},
+    {7276, 4527}, {1058, 4529}, {649, 4530}, {7291, 4525}, {7275, 4531}, {7293, 4532}, {7292, 4533}, {7268, 4534},
+    {7210, 4535}, {7283, 4538}, {761, 4539}, {7287, 4540}, {7108, 4426}, {7155, 4418}, {7295, 4541}, {7265, 4542},
+    {7265, 4543}, {7287, 4608}, {7238, 4680}, {7293, 4676}, {7289, 4545}, {7293, 4546}, {7235, 4549}, {7199, 4550},
+    {7212, 4544}, {2045, 4551}, {7253, 4552}, {7247, 4580}, {7236, 4553}, {1611, 4554}, {7242, 4555}, {7199, 4556},
+    {7252, 4557}, {7235, 4560}, {7287, 4574}, {7187, 4558}, {7289, 4544}, {7245, 4559}, {7240, 4561}, {7256, 4576},
+    {7197, 4548}, {7241, 4593}, {7244, 4562}, {7237, 4563}, {7232, 4564}, {7262, 4565}, {7275, 4566}, {7260, 4567},
+    {7262, 4568}, {7250, 4569}, {7243, 4570}, {7171, 4572}, {7226, 4573}, {7241, 4577}, {7248, 4607}, {2218, 4575},
+    {7252, 4578}, {7244, 4582}, {7242, 4583}, {7290, 4584}, {7291, 4585}, {7197, 4587}, {7202, 4588}, {7210, 4589},
+    {7218, 4591}, {7200, 4592}, {7202, 4594}, {7206, 4596}, {7225, 4597}, {7203, 4598}, {7225, 4599}, {7381, 4600},
+    {7245, 4601}, {7212, 4603}, {7210, 4604}, {7223, 4606}, {7182, 4609}, {7250, 4610}, {7227, 4611}, {7350, 4721},
+    {7172, 4612}, {7253, 4613}, {407, 4614}, {7223, 4707}, {7227, 4615}, {7225, 4616}, {7257, 4617}, {7258, 4618},
+    {7259, 4619}, {7271, 4620}, {2610, 4621}, {7259, 4622}, {7256, 4623}, {7183, 4624}, {7262, 4625}, {7172, 4626},
+    {117, 4627}, {7188, 4629}, {7179, 4630}, {7223, 4631}, {7179, 4632}, {7274, 4633}, {7175, 4634}, {7254, 4635},
+    {1447, 4636}, {7218, 4637}, {7278, 4638}, {7279, 4639}, {7171, 4641}, {7174, 4642}, {7172, 4643}, {7208, 4644},
+    {7393, 4645}, {7196, 4646}, {7195, 4647}, {7199, 4648}, {7203, 4649}, {7193, 4650}, {7201, 4651}, {7200, 4652},
+    {7412, 4653}, {7414, 4654}, {7398, 4655}, {7388, 4656}, {7358, 4657}, {7401, 4658}, {7401, 4659}, {7384, 4660},
+    {7401, 4672}, {7417, 4732}, {7307, 4661}, {7350, 4662}, {7400, 4672}, {7404, 4663}, {7421, 4664}, {7311, 4665},
+    {7411, 4666}, {7339, 4667}, {7393, 4668}, {1081, 4669}, {7419, 4723}, {7273, 4548}, {7398, 4673}, {7417, 4673},
+    {7408, 4670}, {7402, 4671}, {7417, 4674}, {7418, 4675}, {7335, 4677}, {618, 4678}, {7421, 4675}, {7417, 4679},
+    {7361, 4731}, {7360, 4736}, {7372, 4681}, {7415, 4673}, {7362, 4682}, {7374, 4687}, {7375, 4683}, {7408, 4684},
+    {7379, 4685}, {1631, 4737}, {7252, 4697}, {7335, 4686}, {7246, 4851}, {7352, 4688}, {7354, 4689}, {7299, 4690},
+    {7172, 4640}, {7371, 4850}, {7298, 4691}, {7391, 4692}, {7368, 4850}, {7357, 4693}, {7356, 4695}, {7387, 4850},
+    {7302, 4696}, {7311, 4698}, {7369, 4850}, {7297, 4699}, {2060, 4700}, {7300, 4701}, {7364, 4850}, {7363, 4850},
+    {2416, 4702}, {7364, 4850}, {7301, 4703}, {7378, 4850}, {7401, 4704}, {7333, 4705}, {7304, 4706}, {7306, 4708},
+    {7317, 4709}, {7327, 4710}, {7368, 4711}, {7340, 4712}, {7308, 4713}, {7417, 4714}, {7418, 4715}, {7332, 4716},
+    {7360, 4836}, {7420, 4717}, {7381, 4836}, {7384, 4836}, {7386, 4836}, {7385, 4836}, {7332, 4836}, {7329, 4836},
+    {7379, 4836}, {7390, 4836}, {2798, 4718}, {7371, 4836}, {7331, 4836}, {7382, 4836}, {7333, 4836}, {7367, 4719},
+    {7325, 4720}, {7334, 4836}, {7299, 4836}, {7345, 4836}, {7385, 4722}, {7345, 4836}, {7347, 4836}, {7332, 4836},
+    {7482, 4724}, {7520, 4725}, {7426, 4727}, {7336, 4836}, {7533, 4729}, {7525, 4730}, {7429, 4733}, {7527, 4734},
+    {7528, 4735}, {7511, 4738}, {7433, 4739}, {7434, 4740}, {7544, 4741}, {7478, 4742}, {7437, 4743}, {7438, 4744},
+    {1296, 4745}, {7439, 4747}, {1325, 4748}, {7440, 4749}, {7502, 4750}, {7464, 4751}, {7520, 4752}, {2591, 4753},
+    {7529, 4754}, {2769, 4755}, {7470, 4756}, {7507, 4757}, {7446, 4758}, {7545, 4759}, {7532, 4760}, {7459, 4761},
+    {7456, 4762}, {226, 4763}, {7528, 4764}, {2529, 4765}, {7544, 4766}, {7539, 4767}, {7536, 4768}, {7532, 4769},
+    {7520, 4770}, {7535, 4771}, {7504, 4774}, {7499, 4775}, {7488, 4776}, {7452, 4777}, {7463, 4778}, {7538, 4779},
+    {7497, 4780}, {7498, 4781}, {7466, 4782}, {7441, 4783}, {2050, 4784}, {7468, 4785}, {7597, 4786}, {7470, 4787},
+    {7517, 4788}, {7435, 4789}, {7197, 4640}, {7432, 4790}, {7492, 4791}, {7476, 4792}, {7505, 4794}, {7478, 4795},
+    {7510, 4796}, {7480, 4797}, {7482, 4798}, {7425, 4799}, {7523, 4800}, {7497, 4801}, {7521, 4802}, {7468, 4803},
+    {7489, 4804}, {1085, 4805}, {7479, 4806}, {846, 4808}, {792, 4809}, {7493, 4810}, {7494, 4811}, {7477, 4813},
+    {1222, 4814}, {7468, 4815}, {7497, 4816}, {7482, 4817}, {7466, 4818}, {7542, 4819}, {7460, 4832}, {1407, 4855},
+    {1861, 4820}, {7427, 4822}, {7541, 4823}, {7479, 4824}, {7505, 4825}, {7468, 4806}, {7467, 4806}, {7484, 4826},
+    {7507, 4827}, {7477, 4829}, {7509, 4830}, {7451, 4831}, {887, 4833}, {7511, 4835}, {7431, 4838}, {159, 4839},
+    {2245, 4840}, {7480, 4841}, {7520, 4843}, {45, 4844}, {540, 4845}, {7482, 4846}, {2305, 4847}, {7516, 4848},
+    {7517, 4849}, {7518, 4852}, {7468, 4856}, {7425, 4857}, {7443, 4858}, {7472, 4859}, {7426, 4860}, {7429, 4861},
+    {1609, 4862}, {7519, 4863}, {7517, 4864}, {7479, 4866}, {7452, 4867}, {7427, 4868}, {7448, 4876}, {7532, 4869},
+    {2603, 4870}, {7428, 4871}, {7534, 4872}, {227, 4873}, {7509, 4874}, {7426, 4875}, {7440, 4877}, {7538, 4878},
+    {7430, 4879}, {7425, 4880}, {7517, 4881}, {7449, 4882}, {7449, 4883}, {7544, 4884}, {7447, 4887}, {7454, 4888},
+    {7450, 4889}, {7453, 4890}, {7549, 4892}, {7479, 4893}, {7437, 4894}, {7647, 4895}, {149, 4896}, {7663, 4897},
+    {7667, 4899}, {7642, 4900}, {7669, 4901}, {7613, 4902}, {7602, 4903}, {7648, 4905}, {817, 4906}, {7675, 4907},
+    {7607, 4908}, {7648, 4909}, {537, 4910}, {7632, 4911}, {2204, 4912}, {7594, 4913}, {7672, 4914}, {7570, 4916},
+    {2566, 4917}, {1610, 4918}, {7593, 4919}, {7675, 4920}, {7674, 4921}, {7679, 4922}, {7673, 4924}, {7673, 4925},
+    {7672, 4926}, {7578, 4927}, {7585, 4928}, {7580, 4929}, {1013, 4930}, {7672, 4931}, {7675, 4932}, {7674, 4933},
+    {7634, 4934}, {7579, 4935}, {7576, 4936}, {7658, 4937}, {7588, 4938}, {7639, 4953}, {7625, 4959}, {7637, 4947},
+    {7628, 4939}, {7624, 4941}, {7618, 4942}, {7621, 4943}, {7647, 4944}, {7628, 4945}, {7623, 4946}, {7645, 4948},
+    {7554, 4898}, {7637, 4949}, {7639, 4950}, {7560, 4952}, {7660, 4954}, {7632, 4955}, {1612, 4956}, {7636, 4957},
+    {7541, 4960}, {7616, 4962}, {2738, 4963}, {7641, 4964}, {7555, 4965}, {1661, 4966}, {7552, 4967}, {7624, 4968},
+    {7612, 4969}, {7626, 4970}, {7649, 4972}, {7643, 4973}, {7616, 4974}, {2330, 4975}, {7602, 4976}, {7553, 4977},
+    {2590, 4978}, {7599, 4979}, {7587, 4980}, {7594, 4981}, {636, 4982}, {7622, 4983}, {7627, 4985}, {7597, 4986},
+    {7605, 4984}, {7587, 4987}, {7630, 4988}, {7564, 4989}, {7601, 4990}, {7633, 4991}, {7565, 4994}, {7552, 4995},
+    {2097, 4997}, {7662, 4998}, {7585, 4984}, {959, 4999}, {7562, 5000}, {7608, 5001}, {7589, 5008}, {7592, 4984},
+    {7615, 5016}, {7613, 5017}, {7614, 4984}, {7592, 5003}, {7738, 5004}, {7604, 5005}, {7644, 5006}, {7603, 5009},
+    {7611, 5010}, {7552, 5011}, {7648, 5012}, {524, 5013}, {7564, 5014}, {7553, 5015}, {7559, 5018}, {7558, 5019},
+    {7555, 5020}, {7570, 5021}, {7558, 5022}, {7565, 5023}, {7563, 5024}, {7553, 5025}, {7559, 5026}, {7660, 5027},
+    {7560, 5028}, {7578, 5029}, {7564, 5030}, {7579, 5031}, {7577, 5032}, {7579, 5033}, {7569, 5034}, {7595, 5035},
+    {802, 5037}, {7579, 5038}, {7573, 5040}, {7592, 5041}, {7563, 5042}, {7619, 5043}, {7579, 5044}, {7571, 5045},
+    {7676, 5046}, {7570, 5047}, {1251, 5048}, {7562, 5050}, {7568, 5051}, {7739, 5052}, {604, 5053}, {7790, 5093},
+    {7683, 5054}, {7684, 5055}, {7793, 5056}, {7776, 5057}, {7778, 5058}, {7655, 4898}, {7800, 5059}, {7777, 5060},
+    {7728, 5061}, {7779, 5062}, {7790, 5063}, {7797, 5064}, {7761, 5065}, {7695, 5066}, {1919, 5067}, {7793, 5068},
+    {7797, 5069}, {7757, 5070}, {7777, 5087}, {7797, 5082}, {7796, 5076}, {7780, 5072}, {7795, 5073}, {7802, 5074},
+    {7794, 5075}, {7708, 5077}, {7719, 5078}, {7797, 5079}, {7804, 5080}, {7762, 5081}, {7744, 5083}, {7704, 5084},
+    {7800, 5071}, {7754, 5086}, {7716, 5088}, {7748, 5089}, {7758, 5090}, {7719, 5091}, {7748, 5092}, {7798, 5094},
+    {7774, 5095}, {7774, 5096}, {7753, 5099}, {7769, 5101}, {7770, 5102}, {7754, 5103}, {439, 5104}, {7749, 5105},
+    {7691, 5106}, {7767, 5107}, {7745, 5120}, {7765, 5131}, {7744, 5136}, {7785, 5109}, {7749, 5110}, {7736, 5111},
+    {7683, 5112}, {7753, 5113}, {7780, 5114}, {2628, 5121}, {7791, 5071}, {7749, 5213}, {851, 5115}, {7687, 5116},
+    {7766, 5117}, {501, 5122}, {7766, 5223}, {7744, 5119}, {1330, 5123}, {7726, 5125}, {7719, 5127}, {7718, 5128},
+    {7707, 5129}, {7712, 5130}, {1277, 5132}, {1297, 5133}, {7866, 5134}, {2024, 5135}, {7717, 5138}, {7723, 5151},
+    {7724, 5139}, {7726, 5140}, {7793, 5141}, {7712, 5142}, {7738, 5143}, {7796, 5144}, {7759, 5145}, {7714, 5152},
+    {7734, 5160}, {7734, 5161}, {7692, 5147}, {7790, 5148}, {7728, 5149}, {7741, 5150}, {756, 5153}, {7730, 5154},
+    {1976, 5155}, {7701, 5156}, {7740, 5157}, {7743, 5158}, {7737, 5162}, {7683, 5163}, {7729, 5164}, {7681, 5165},
+    {7739, 5166}, {7685, 5167}, {7696, 5170}, {7685, 5171}, {7699, 5172}, {7689, 5173}, {7734, 5174}, {7694, 5168},
+    {7786, 5175}, {1799, 5176}, {7694, 5177}, {7682, 5178}, {7789, 5180}, {7729, 5181}, {7728, 5182}, {7683, 5168},
+    {7694, 5168}, {7701, 5183}, {7726, 5184}, {7686, 5185}, {7704, 5186}, {7706, 5187}, {7708, 5188}, {1687, 5189},
+    {7798, 5190}, {7683, 5191}, {7708, 5192}, {7701, 5193}, {7699, 5194}, {7745, 5195}, {7709, 5196}, {2452, 5197},
+    {7708, 5198}, {7713, 5199}, {7911, 5201}, {7927, 5202}, {7926, 5203}, {7907, 5204}, {7914, 5207}, {7859, 5208},
+    {7911, 5206}, {7893, 5209}, {7819, 5210}, {7935, 5211}, {7908, 5212}, {7910, 5206}, {7911, 5216}, {7904, 5220},
+    {7886, 5214}, {7921, 5215}, {7827, 5217}, {7828, 5218}, {7920, 5219}, {7830, 5221}, {660, 5222}, {7929, 5225},
+    {7807, 5200}, {7929, 5226}, {7914, 5227}, {7913, 5228}, {7876, 5229}, {7922, 5230}, {7874, 5231}, {2192, 5248},
+    {7917, 5349}, {7932, 5232}, {7877, 5233}, {7890, 5234}, {7885, 5235}, {7882, 5236}, {7882, 5237}, {7879, 5238},
+    {7895, 5239}, {7883, 5241}, {7827, 5242}, {7883, 5243}, {7851, 5244}, {7877, 5245}, {7829, 5247}, {7876, 5249},
+    {7896, 5246}, {7897, 5250}, {7901, 5251}, {7916, 5252}, {7879, 5253}, {1837, 5254}, {7894, 5246}, {7892, 5347},
+    {7913, 5256}, {7893, 5257}, {7864, 5258}, {7811, 5259}, {2085, 5260}, {7909, 5262}, {7887, 5263}, {7881, 5264},
+    {7890, 5265}, {7905, 5266}, {7813, 5267}, {7849, 5272}, {7854, 5275}, {7851, 5276}, {7747, 5268}, {7856, 5269},
+    {7834, 5270}, {7932, 5271}, {7855, 5273}, {7722, 5355}, {7830, 5274}, {7870, 5277}, {7870, 5278}, {7994, 5279},
+    {7847, 5280}, {7843, 5281}, {7847, 5282}, {7848, 5283}, {7871, 5284}, {7841, 5285}, {7845, 5286}, {7868, 5288},
+    {7857, 5290}, {7868, 5287}, {7870, 5289}, {7895, 5291}, {7850, 5296}, {7870, 5304}, {7870, 5305}, {7899, 5293},
+    {7865, 5294}, {28, 5295}, {7868, 5322}, {7848, 5297}, {7822, 5298}, {7812, 5299}, {7808, 5300}, {7818, 5301},
+    {7857, 5322}, {7810, 5302}, {7823, 5303}, {7823, 5306}, {7819, 5308}, {7808, 5309}, {7822, 5310}, {7814, 5311},
+    {7814, 5312}, {7812, 5313}, {7815, 5335}, {7812, 5314}, {7811, 5315}, {7824, 5316}, {7831, 5317}, {7811, 5318},
+    {7814, 5319}, {7788, 5320}, {7838, 5321}, {7885, 5323}, {7824, 5324}, {7910, 5200}, {7836, 5325}, {7895, 5326},
+    {7826, 5327}, {7829, 5328}, {7825, 5329}, {7832, 5330}, {7830, 5331}, {8035, 5333}, {8055, 5334}, {8027, 5336},
+    {8038, 5337}, {7996, 5338}, {8053, 5339}, {8046, 5340}, {8080, 5341}, {7984, 5342}, {8034, 5343}, {8062, 5344},
+    {8063, 5345}, {8043, 5346}, {8044, 5348}, {8032, 5331}, {8015, 5350}, {8033, 5351}, {8060, 5352}, {8038, 5353},
+    {7982, 5354}, {2634, 5356}, {8048, 5357}, {7958, 5360}, {8060, 5361}, {8048, 5362}, {8048, 5363}, {8005, 5364},
+    {7963, 5365}, {8051, 5368}, {8041, 5372}, {749, 5366}, {8045, 5367}, {7973, 5369}, {2493, 5370}, {7968, 5371},
+    {7969, 5373}, {8013, 5374}, {1702, 5375}, {8019, 5376}, {8011, 5379}, {8023, 5378}, {8007, 5385}, {8014, 5377},
+    {8053, 5380}, {8003, 5381}, {8030, 5383}, {8010, 5391}, {8010, 5390}, {8008, 5384}, {1442, 5386}, {8002, 5387},
+    {8011, 5394}, {364, 5388}, {8031, 5481}, {8020, 5389}, {8027, 5392}, {7988, 5393}, {8016, 5395}, {8041, 5396},
+    {8018, 5397}, {8029, 5398}, {8026, 5408}, {8019, 5431}, {8015, 5427}, {8025, 5409}, {8030, 5418}, {7986, 5422},
+    {8029, 5394}, {8011, 5414}, {7990, 5426}, {8062, 5399}, {7968, 5400}, {7972, 5401}, {8061, 5402}, {8018, 5414},
+    {7972, 5403}, {7980, 5404}, {7998, 5405}, {7972, 5406}, {7969, 5407}, {7980, 5410}, {7994, 5411}, {8053, 5412},
+    {7983, 5423}, {7985, 5413}, {7986, 5416}, {7985, 5436}, {8041, 5417}, {7974, 5419}, {8021, 5420}, {8044, 5421},
+    {7986, 5424}, {7990, 5425}, {7978, 5429}, {7982, 5432}, {246, 5433}, {7997, 5434}, {7980, 5435}, {7996, 5437},
+    {7987, 5438}, {7994, 5439}, {7941, 5440}, {7936, 5441}, {7997, 5442}, {7949, 5443}, {8028, 5444}, {7950, 5445},
+    {7964, 5448}, {7940, 5450}, {7943, 5463}, {7946, 5446}, {7982, 5423}, {27, 5449}, {8022, 5452}, {8023, 5454},
+    {8020, 5455}, {7952, 5457}, {2806, 5458}, {8159, 5459}, {8163, 5460}, {8160, 5461}, {8175, 5462}, {8172, 5464},
+    {8125, 5466}, {8114, 5468}, {8189, 5469}, {8165, 5470}, {8190, 5472}, {8173, 5485}, {8191, 5471}, {8173, 5473},
+    {8160, 5474}, {8164, 5475}, {8180, 5476}, {743, 5477}, {8187, 5478}, {8187, 5479}, {8187, 5480}, {8178, 5482},
+    {8179, 5483}, {8087, 5486}, {8177, 5487}, {8181, 5504}, {8179, 5520}, {8178, 5521}, {8189, 5488}, {8170, 5459},
+    {8021, 5456}, {8184, 5489}, {8100, 5490}, {8177, 5491}, {1353, 5492}, {8096, 5494}, {2368, 5505}, {8136, 5604},
+    {8148, 5495}, {8010, 5456}, {8089, 5496}, {8139, 5497}, {8151, 5498}, {8141, 5499}, {8184, 5500}, {8141, 5501},
+    {8014, 5456}, {8009, 5456}, {8002, 5456}, {8011, 5456}, {8003, 5456}, {8013, 5456}, {8012, 5456}, {8015, 5456},
+    {8157, 5502}, {8106, 5503}, {8001, 5456}, {8000, 5456}, {8136, 5506}, {8135, 5507}, {8133, 5508}, {8135, 5509},
+    {866, 5510}, {8129, 5511}, {8130, 5512}, {8159, 5513}, {8133, 5514}, {8128, 5515}, {8155, 5516}, {8155, 5517},
+    {8149, 5524}, {8153, 5526}, {8143, 5518}, {8155, 5519}, {8142, 5522}, {8065, 5523}, {8149, 5536}, {8162, 5564},
+    {8157, 5525}, {8127, 5527}, {8122, 5547}, {8097, 5552}, {8099, 5528}, {8104, 5529}, {8098, 5538}, {8127, 5567},
+    {8098, 5560}, {8101, 5530}, {8105, 5531}, {8122, 5532}, {8113, 5540}, {8121, 5543}, {8127, 5534}, {8099, 5535},
+    {8113, 5537}, {8250, 5539}, {7951, 5456}, {8121, 5544}, {8096, 5533}, {8112, 5533}, {8108, 5551}, {7956, 5456},
+    {8110, 5541}, {8120, 5542}, {8104, 5545}, {8116, 5546}, {8067, 5548}, {7947, 5456}, {8072, 5557}, {8075, 5549},
+    {8077, 5550}, {8109, 5537}, {8077, 5553}, {8075, 5554}, {8100, 5527}, {8065, 5555}, {8066, 5556}, {8077, 5558},
+    {8064, 5559}, {8071, 5561}, {8067, 5568}, {8102, 5533}, {8101, 5533}, {8066, 5570}, {8068, 5562}, {8071, 5563},
+    {8070, 5565}, {8089, 5566}, {8110, 5569}, {8091, 5571}, {8086, 5573}, {8092, 5574}, {8070, 5575}, {8087, 5576},
+    {8086, 5577}, {8089, 5578}, {8091, 5579}, {8091, 5580}, {8072, 5581}, {8090, 5583}, {8286, 5585}, {8085, 5582},
+    {8084, 5582}, {8310, 5586}, {8195, 5587}, {8310, 5588}, {349, 5632}, {8294, 5733}, {8292, 5590}, {8203, 5592},
+    {8093, 5582}, {8290, 5593}, {8317, 5594}, {8313, 5595}, {8300, 5733}, {8289, 5733}, {8270, 5596}, {8299, 5597},
+    {8197, 5589}, {8211, 5598}, {8316, 5599}, {8288, 5600}, {8305, 5601}, {8291, 5620}, {23, 5633}, {8313, 5732},
+    {8227, 5602}, {8319, 5603}, {8300, 5605}, {530, 5606}, {8230, 5607}, {8316, 5608}, {8305, 5625}, {8307, 5609},
+    {8260, 5610}, {8219, 5611}, {8264, 5612}, {8217, 5613}, {8263, 5615}, {8264, 5617}, {8220, 5618}, {8259, 5619},
+    {8258, 5621}, {8256, 5622}, {8269, 5623}, {8308, 5624}, {8264, 5626}, {8283, 5627}, {8239, 5628}, {8276, 5629},
+    {8276, 5630}, {8201, 5631}, {8262, 5634}, {8278, 5635}, {8258, 5636}, {8261, 5637}, {8353, 5638}, {8277, 5639},
+    {8192, 5640}, {8265, 5641}, {8281, 5642}, {8275, 5643}, {8266, 5644}, {8273, 5645}, {8226, 5646}, {8234, 5647},
+    {8234, 5648}, {8234, 5649}, {8378, 5650}, {8230, 5651}, {8261, 5652}, {8242, 5653}, {8306, 5654}, {8265, 5655},
+    {8266, 5656}, {8229, 5657}, {8249, 5658}, {8210, 5659}, {8235, 5660}, {8251, 5661}, {8242, 5662}, {8249, 5664},
+    {8246, 5665}, {8240, 5666}, {8249, 5667}, {8243, 5668}, {8245, 5669}, {8242, 5669}, {8240, 5670}, {8192, 5671},
+    {8210, 5673}, {2282, 5674}, {8289, 5675}, {8203, 5676}, {8203, 5677}, {8215, 5679}, {8249, 5669}, {8195, 5680},
+    {8248, 5681}, {8274, 5682}, {8202, 5683}, {8218, 5684}, {454, 5685}, {8236, 5669}, {8206, 5686}, {8220, 5687},
+    {8242, 5688}, {8220, 5689}, {8240, 5690}, {8196, 5691}, {8197, 5692}, {8244, 5656}, {8223, 5693}, {8307, 5695},
+    {8308, 5696}, {554, 5697}, {8309, 5698}, {8208, 5699}, {8216, 5700}, {8290, 5589}, {8214, 5701}, {8208, 5702},
+    {8435, 5703}, {8417, 5703}, {8420, 5703}, {8441, 5704}, {8374, 5705}, {8434, 5703}, {8432, 5703}, {8375, 5706},
+    {8200, 5703}, {8208, 5703}, {8424, 5707}, {8213, 5703}, {8388, 5708}, {8434, 5709}, {8214, 5703}, {8426, 5703},
+    {8211, 5703}, {8419, 5703}, {8443, 5710}, {8424, 5700}, {8418, 5703}, {8417, 5703}, {8440, 5711}, {8396, 5712},
+    {1238, 5713}, {8446, 5715}, {8406, 5716}, {8403, 5717}, {8443, 5718}, {8388, 5719}, {579, 5720}, {8390, 5721},
+    {8360, 5722}, {8384, 5719}, {8384, 5723}, {8389, 5724}, {8363, 5725}, {8387, 5726}, {8410, 5727}, {2472, 5728},
+    {8386, 5729}, {8385, 5730}, {8403, 5731}, {8404, 5734}, {8429, 5735}, {8371, 5736}, {2527, 5760}, {8405, 5861},
+    {8322, 5833}, {8377, 5737}, {8409, 5738}, {8414, 5739}, {8383, 5742}, {8351, 5743}, {8402, 5861}, {8415, 5861},
+    {8405, 5740}, {275, 5761}, {8352, 5860}, {8386, 5744}, {8354, 5745}, {8368, 5747}, {8364, 5748}, {8357, 5749},
+    {8391, 5750}, {8356, 5752}, {8397, 5754}, {8408, 5740}, {8379, 5755}, {8360, 5756}, {8373, 5757}, {8375, 5758},
+    {8399, 5740}, {8360, 5751}, {8383, 5759}, {8376, 5762}, {8431, 5763}, {8355, 5751}, {8354, 5764}, {8357, 5765},
+    {8362, 5766}, {8375, 5767}, {8325, 5768}, {8362, 5751}, {8382, 5769}, {8323, 5770}, {8321, 5771}, {8334, 5773},
+    {8362, 5772}, {8408, 5774}, {8321, 5775}, {8323, 5776}, {8329, 5777}, {2383, 5778}, {8331, 5779}, {8331, 5780},
+    {8330, 5781}, {8333, 5782}, {8320, 5783}, {8350, 5784}, {8333, 5785}, {8366, 5750}, {2076, 5786}, {8351, 5787},
+    {8320, 5788}, {8329, 5772}, {8350, 5789}, {8349, 5790}, {8435, 5791}, {8345, 5782}, {8436, 5792}, {8326, 5793},
+    {8345, 5794}, {8324, 5795}, {8330, 5796}, {8336, 5797}, {8385, 5798}, {8351, 5797}, {8390, 5799}, {8344, 5800},
+    {8388, 5801}, {8346, 5802}, {961, 5805}, {8545, 5832}, {8507, 5804}, {8504, 5806}, {1170, 5807}, {8565, 5808},
+    {8510, 5809}, {1053, 5810}, {8556, 5811}, {8544, 5812}, {8586, 5813}, {8571, 5814}, {8502, 5815}, {8558, 5817},
+    {8548, 5847}, {8529, 5818}, {1154, 5819}, {8551, 5820}, {8527, 5821}, {8526, 5822}, {8567, 5823}, {15, 5824},
+    {8559, 5847}, {8546, 5847}, {36, 5825}, {53, 5826}, {8551, 5827}, {8523, 5828}, {8545, 5829}, {8546, 5830},
+    {8564, 5831}, {8554, 5834}, {8573, 5837}, {8517, 5839}, {8570, 5840}, {8515, 5841}, {8565, 5842}, {8556, 5845},
+    {8554, 5846}, {8513, 5851}, {8514, 5844}, {8573, 5848}, {8572, 5852}, {8533, 5853}, {8514, 5854}, {8514, 5855},
+    {8488, 5856}, {8523, 5857}, {8564, 5859}, {8470, 5862}, {8516, 5863}, {8519, 5864}, {8495, 5872}, {8533, 5884},
+    {8478, 5865}, {8528, 5866}, {8555, 5867}, {8532, 5868}, {8514, 5869}, {2431, 5888}, {8530, 5989}, {1921, 5871},
+    {8536, 5870}, {8535, 5874}, {8538, 5875}, {8479, 5876}, {8486, 5878}, {8514, 5879}, {8502, 5880}, {8475, 5881},
+    {8449, 5882}, {8518, 5883}, {8472, 5885}, {8487, 5886}, {8509, 5887}, {8533, 5870}, {8484, 5889}, {8483, 5890},
+    {8531, 5870}, {8467, 5891}, {8511, 5892}, {8487, 5893}, {8489, 5894}, {8510, 5895}, {8462, 5896}, {8480, 5897},
+    {8502, 5898}, {8532, 5899}, {1726, 5900}, {8505, 5901}, {8507, 5902}, {8503, 5904}, {8502, 5905}, {8511, 5906},
+    {8539, 5907}, {8540, 5908}, {8511, 5909}, {8449, 5910}, {8506, 5911}, {8457, 5912}, {8510, 5913}, {8451, 5914},
+    {8454, 5915}, {8449, 5916}, {8458, 5917}, {8466, 5918}, {8452, 5919}, {2688, 5920}, {8461, 5921}, {8477, 5922},
+    {8501, 5923}, {8457, 5924}, {2701, 5925}, {8453, 5926}, {8685, 5927}, {2030, 5929}, {8467, 5931}, {8478, 5932},
+    {8465, 5933}, {1798, 5934}, {2562, 5935}, {2534, 5936}, {8506, 5899}, {8563, 5937}, {8458, 5872}, {8459, 5872},
+    {8449, 5928}, {8564, 5939}, {8565, 5940}, {8474, 5941}, {8567, 5942}, {8458, 5943}, {8515, 5945}, {8475, 5946},
+    {8478, 5947}, {8457, 5948}, {1927, 5949}, {8482, 5950}, {8574, 5951}, {8472, 5953}, {701, 5954}, {664, 5955},
+    {8680, 6016}, {8479, 5928}, {8547, 6130}, {8669, 5956}, {8695, 5957}, {8542, 5856}, {8688, 5958}, {8685, 5959},
+    {8677, 5960}, {8681, 5961}, {8626, 5962}, {8662, 5963}, {8684, 5964}, {8625, 5965}, {8685, 5966}, {8684, 5967},
+    {8657, 5968}, {8629, 5969}, {8703, 5970}, {8691, 5971}, {8594, 5972}, {8651, 5973}, {8699, 5974}, {8702, 5975},
+    {8698, 5976}, {8693, 5980}, {8682, 5977}, {2665, 5978}, {8604, 5979}, {8689, 5981}, {8703, 5982}, {1898, 5983},
+    {8685, 5984}, {8609, 5985}, {8649, 5986}, {8645, 5990}, {8649, 5984}, {8651, 5991}, {8659, 6003}, {8649, 5988},
+    {8646, 5992}, {8640, 5993}, {8667, 5994}, {8671, 5995}, {8655, 5998}, {8621, 5996}, {8643, 5994}, {8689, 5999},
+    {8646, 6000}, {8665, 6001}, {8643, 6017}, {8657, 6023}, {8658, 6020}, {8644, 6030}, {8659, 6031}, {8669, 6035},
+    {8669, 6026}, {8664, 6033}, {8663, 6002}, {8657, 6004}, {8660, 6026}, {8667, 6005}, {8652, 6006}, {8614, 6007},
+    {8612, 6008}, {8623, 6051}, {8630, 6048}, {8631, 6048}, {8628, 6050}, {8655, 6033}, {8619, 6052}, {8624, 6051},
+    {8615, 6053}, {8609, 6050}, {8612, 6050}, {8626, 6057}, {8632, 6053}, {8585, 6056}, {8636, 6059}, {8634, 6061},
+    {8637, 6055}, {8590, 6054}, {8624, 6060}, {8636, 6062}, {8585, 6067}, {8604, 6071}, {8578, 6060}, {8603, 6075},
+    {8636, 6055}, {8585, 6065}, {8579, 6065}, {8637, 6054}, {8620, 6060}, {8580, 6010}, {8588, 6011}, {8627, 6065},
+    {8586, 6067}, {8627, 6054}, {8607, 6070}, {8639, 6055}, {8593, 6069}, {8604, 6011}, {8597, 6070}, {8584, 6012},
+    {8607, 6069}, {8605, 6013}, {8577, 6070}, {8591, 6014}, {8806, 6015}, {8806, 6018}, {8595, 6067}, {1602, 6019},
+    {8577, 6066}, {8695, 5972}, {8810, 6021}, {8805, 6022}, {8809, 6025}, {8813, 6024}, {8754, 6027}, {8812, 6029},
+    {8805, 6034}, {958, 6036}, {8580, 6066}, {8603, 6066}, {8824, 6037}, {8787, 6038}, {8800, 6024}, {8786, 6039},
+    {8785, 6040}, {8784, 6041}, {8720, 6042}, {8761, 6043}, {8583, 6066}, {8823, 6024}, {8606, 6066}, {8606, 6066},
+    {8819, 6044}, {758, 6045}, {1746, 6046}, {8768, 6047}, {835, 6049}, {8724, 6063}, {8820, 6064}, {8777, 6068},
+    {8727, 6072}, {8738, 6073}, {1801, 6074}, {8774, 6076}, {8736, 6077}, {2131, 6078}, {8821, 6079}, {8811, 6080},
+    {8757, 6081}, {793, 6082}, {363, 6083}, {8822, 6084}, {8735, 6085}, {1014, 6086}, {1449, 6087}, {387, 6089},
+    {1198, 6091}, {8808, 6092}, {8737, 6093}, {8782, 6094}, {8741, 6098}, {8775, 6099}, {1643, 6100}, {8733, 6101},
+    {8775, 6102}, {8745, 6103}, {8746, 6104}, {8775, 6106}, {8777, 6108}, {8727, 6109}, {8817, 6110}, {8771, 6111},
+    {8781, 6096}, {8790, 6112}, {8788, 6113}, {8813, 6114}, {8797, 6115}, {8785, 6116}, {8757, 6117}, {295, 6118},
+    {8790, 6120}, {8792, 6121}, {1437, 6122}, {8762, 6123}, {826, 6125}, {8866, 6126}, {1066, 6127}, {8799, 6128},
+    {8772, 6119}, {8765, 6129}, {8766, 6131}, {8826, 6132}, {899, 6133}, {8750, 6134}, {833, 6135}, {8750, 6136},
+    {1685, 6137}, {8798, 6119}, {693, 6138}, {8771, 6139}, {8721, 6140}, {8746, 6141}, {8719, 6142}, {8781, 6096},
+    {8742, 6143}, {2422, 6144}, {8737, 6146}, {8741, 6165}, {8767, 6166}, {1136, 6149}, {1512, 6150}, {8817, 6151},
+    {8822, 6153}, {447, 6154}, {8744, 6155}, {8820, 6156}, {8783, 6157}, {8739, 6158}, {8754, 6161}, {8786, 6162},
+    {8716, 6163}, {474, 6164}, {8814, 6167}, {696, 6168}, {8815, 6169}, {1936, 6170}, {8759, 6171}, {1596, 6173},
+    {8705, 6174}, {8761, 6177}, {8792, 6178}, {8759, 6181}, {1043, 6183}, {2250, 6184}, {2440, 6185}, {8750, 6186},
+    {8801, 6187}, {8763, 6188}, {8706, 6189}, {8804, 6190}, {8749, 6191}, {8801, 6193}, {8800, 6131}, {8804, 6194},
+    {8751, 6195}, {8717, 6196}, {8715, 6197}, {8785, 6198}, {1659, 6199}, {8716, 6201}, {2260, 6202}, {8816, 6204},
+    {8731, 6205}, {8705, 6206}, {2557, 6207}, {8723, 6208}, {8715, 6209}, {8763, 6210}, {8724, 6211}, {8769, 6212},
+    {230, 6213}, {8728, 6214}, {8722, 6215}, {8720, 6216}, {8773, 6217}, {906, 6218}, {8947, 6219}, {8932, 6220},
+    {8911, 6221}, {8889, 6223}, {829, 6272}, {8933, 6373}, {8893, 6224}, {8864, 6225}, {8883, 6226}, {8842, 6227},
+    {8843, 6228}, {8941, 6229}, {8931, 6373}, {8940, 6373}, {8914, 6231}, {8846, 6232}, {8938, 6233}, {8921, 6235},
+    {8849, 6237}, {8945, 6238}, {2275, 6239}, {8851, 6242}, {8931, 6243}, {8955, 6244}, {8931, 6245}, {8952, 6246},
+    {8941, 6247}, {8955, 6248}, {1833, 6249}, {8858, 6250}, {538, 6251}, {8936, 6253}, {8947, 6254}, {8871, 6255},
+    {8938, 6256}, {8863, 6257}, {8864, 6258}, {8914, 6259}, {472, 6260}, {8907, 6261}, {8913, 6262}, {8897, 6263},
+    {8900, 6264}, {8860, 6265}, {8804, 6266}, {8905, 6267}, {8950, 6268}, {8848, 6269}, {8901, 6270}, {8905, 6271},
+    {8899, 6273}, {8945, 6274}, {8879, 6275}, {8854, 6276}, {8843, 6277}, {8924, 6279}, {8730, 6280}, {8846, 6281},
+    {8923, 6283}, {8886, 6284}, {8887, 6286}, {8908, 6287}, {969, 6288}, {8924, 6289}, {8860, 6290}, {8922, 6291},
+    {2134, 6292}, {8904, 6294}, {8924, 6295}, {8903, 6297}, {8918, 6298}, {8878, 6299}, {178, 6301}, {8864, 6304},
+    {8876, 6314}, {8887, 6319}, {8869, 6322}, {2166, 6302}, {8875, 6303}, {8956, 6305}, {619, 6306}, {8878, 6307},
+    {8946, 6308}, {1226, 6309}, {8847, 6310}, {8875, 6311}, {8907, 6313}, {8878, 6316}, {8850, 6317}, {8869, 6318},
+    {8871, 6320}, {8889, 6321}, {8880, 6323}, {8887, 6325}, {2522, 6326}, {8870, 6327}, {8941, 6328}, {8894, 6329},
+    {1851, 6330}, {8891, 6332}, {8895, 6333}, {8836, 6334}, {8893, 6335}, {8892, 6336}, {8891, 6337}, {8883, 6338},
+    {8836, 6339}, {8846, 6340}, {8849, 6341}, {8838, 6342}, {109, 6343}, {8840, 6344}, {8841, 6345}, {8845, 6346},
+    {8888, 6347}, {8860, 6348}, {8860, 6349}, {8837, 6350}, {8834, 6351}, {8918, 6353}, {8833, 6354}, {8844, 6355},
+    {8844, 6356}, {8944, 6357}, {8863, 6358}, {8861, 6359}, {281, 6360}, {8843, 6361}, {8910, 6363}, {8857, 6364},
+    {8914, 6324}, {8950, 6365}, {8859, 6367}, {2307, 6368}, {1220, 6369}, {8848, 6370}, {8856, 6371}, {8896, 6372},
+    {8862, 6374}, {8857, 6375}, {8957, 6376}, {8865, 6377}, {8858, 6378}, {9018, 6379}, {9059, 6380}, {2677, 6381},
+    {9074, 6383}, {9017, 6384}, {9063, 6385}, {9062, 6386}, {9057, 6387}, {9077, 6388}, {9071, 6389}, {9056, 6390},
+    {9008, 6391}, {9063, 6400}, {9069, 6428}, {9087, 6392}, {440, 6393}, {8974, 6394}, {9013, 6395}, {9084, 6396},
+    {9061, 6397}, {9056, 6398}, {8979, 6399}, {9057, 6401}, {1985, 6402}, {9060, 6403}, {9032, 6404}, {903, 6405},
+    {9079, 6406}, {9066, 6407}, {9029, 6408}, {9078, 6409}, {9081, 6410}, {9077, 6411}, {9025, 6412}, {8997, 6413},
+    {9044, 6415}, {8993, 6416}, {9027, 6417}, {9024, 6418}, {9046, 6419}, {9028, 6420}, {9029, 6421}, {9030, 6422},
+    {1891, 6423}, {9000, 6424}, {9024, 6425}, {9049, 6426}, {8977, 6429}, {9004, 6431}, {9036, 6432}, {9050, 6434},
+    {2393, 6435}, {9024, 6437}, {9071, 6438}, {9033, 6439}, {9050, 6440}, {9042, 6441}, {9028, 6446}, {9056, 6399},
+    {9029, 6447}, {9052, 6448}, {9062, 6449}, {9018, 6450}, {9044, 6451}, {9042, 6452}, {9021, 6453}, {2313, 6454},
+    {9045, 6455}, {9047, 6456}, {9001, 6457}, {8994, 6458}, {9026, 6459}, {8988, 6460}, {9015, 6461}, {9087, 6463},
+    {9084, 6465}, {9001, 6466}, {9146, 6467}, {8999, 6468}, {8993, 6469}, {8981, 6470}, {9001, 6471}, {9078, 6472},
+    {8978, 6473}, {8992, 6488}, {9017, 6487}, {9011, 6479}, {9018, 6474}, {8882, 6324}, {9014, 6475}, {9070, 6476},
+    {9010, 6477}, {9009, 6478}, {813, 6480}, {9069, 6482}, {9058, 6483}, {1214, 6484}, {8964, 6485}, {9019, 6486},
+    {9022, 6489}, {9021, 6490}, {9013, 6491}, {9011, 6492}, {9021, 6493}, {9020, 6494}, {2523, 6496}, {9051, 6497},
+    {9021, 6498}, {8972, 6499}, {8976, 6500}, {9061, 6501}, {8978, 6502}, {8981, 6504}, {8965, 6505}, {1502, 6528},
+    {9012, 6444}, {8971, 6629}, {9041, 6506}, {9046, 6507}, {8966, 6508}, {8985, 6509}, {8987, 6512}, {8978, 6517},
+    {8979, 6510}, {9075, 6511}, {8967, 6513}, {2613, 6514}, {8962, 6515}, {8965, 6516}, {8970, 6518}, {8969, 6519},
+    {8985, 6509}, {8991, 6520}, {8990, 6521}, {123, 6522}, {782, 6523}, {8989, 6524}, {943, 6525}, {8994, 6527},
+    {8969, 6529}, {8976, 6530}, {9182, 6531}, {9206, 6532}, {9207, 6533}, {9196, 6534}, {9193, 6536}, {9193, 6537},
+    {9149, 6538}, {9213, 6539}, {9188, 6540}, {9215, 6541}, {9208, 6542}, {9184, 6539}, {9214, 6543}, {9140, 6544},
+    {9194, 6545}, {9104, 6546}, {9215, 6547}, {588, 6548}, {9194, 6549}, {9185, 6552}, {9207, 6558}, {9109, 6550},
+    {9161, 6551}, {9187, 6553}, {9199, 6554}, {9215, 6555}, {9157, 6556}, {9208, 6559}, {9210, 6560}, {9201, 6561},
+    {1485, 6562}, {9118, 6563}, {9196, 6565}, {9215, 6566}, {9164, 6567}, {9168, 6568}, {9163, 6569}, {9124, 6570},
+    {9163, 6571}, {9165, 6572}, {9173, 6573}, {9009, 6574}, {9181, 6575}, {9178, 6576}, {9131, 6577}, {9157, 6578},
+    {9005, 6579}, {9181, 6580}, {9200, 6581}, {9181, 6582}, {9181, 6584}, {9195, 6585}, {9178, 6586}, {9193, 6587},
+    {9177, 6588}, {9181, 6589}, {9168, 6590}, {9160, 6591}, {9178, 6592}, {9160, 6593}, {9119, 6594}, {2171, 6595},
+    {9174, 6596}, {9174, 6597}, {9174, 6598}, {773, 6599}, {9120, 6600}, {9132, 6602}, {9134, 6608}, {9125, 6603},
+    {9114, 6604}, {9140, 6605}, {9138, 6606}, {9126, 6607}, {9128, 6609}, {9026, 6444}, {9133, 6610}, {9134, 6611},
+    {9127, 6612}, {9123, 6613}, {9131, 6614}, {9130, 6615}, {9141, 6616}, {9151, 6617}, {9148, 6618}, {9142, 6619},
+    {9198, 6620}, {9127, 6621}, {9097, 6622}, {9144, 6623}, {9132, 6624}, {9146, 6625}, {9141, 6626}, {9179, 6627},
+    {9128, 6628}, {9191, 6630}, {9138, 6631}, {9148, 6632}, {9107, 6633}, {9088, 6634}, {9090, 6635}, {9111, 6636},
+    {9137, 6583}, {9107, 6651}, {9097, 6637}, {9115, 6638}, {9090, 6639}, {9093, 6640}, {9195, 6641}, {9113, 6642},
+    {9137, 6643}, {9100, 6644}, {9201, 6645}, {9105, 6646}, {9114, 6647}, {9117, 6648}, {9167, 6649}, {9119, 6650},
+    {9105, 6652}, {9154, 6653}, {9274, 6654}, {9099, 6655}, {9210, 6656}, {9153, 6658}, {235, 6659}, {9123, 6660},
+    {9097, 6661}, {9099, 6662}, {9106, 6663}, {2778, 6664}, {9334, 6665}, {9322, 6666}, {9335, 6668}, {9220, 6669},
+    {444, 6671}, {2294, 6672}, {9323, 6673}, {9322, 6675}, {9324, 6676}, {9323, 6677}, {9339, 6678}, {9323, 6688},
+    {9322, 6704}, {9299, 6679}, {9342, 6680}, {9323, 6681}, {9316, 6682}, {9336, 6683}, {9336, 6684}, {9256, 6685},
+    {9257, 6687}, {9328, 6690}, {9332, 6691}, {9289, 6692}, {388, 6693}, {9261, 6694}, {9338, 6695}, {9248, 6696},
+    {9325, 6697}, {9331, 6698}, {9322, 6699}, {9335, 6700}, {9283, 6701}, {9288, 6705}, {9294, 6711}, {9297, 6702},
+    {9283, 6703}, {9296, 6720}, {9298, 6748}, {9300, 6706}, {9256, 6707}, {9307, 6708}, {9285, 6709}, {9259, 6710},
+    {9289, 6712}, {9289, 6713}, {9295, 6714}, {9280, 6715}, {9280, 6716}, {9308, 6717}, {9224, 6718}, {9267, 6719},
+    {9304, 6721}, {9296, 6722}, {9311, 6723}, {9271, 6724}, {9305, 6725}, {2693, 6726}, {9273, 6727}, {9288, 6728},
+    {9308, 6729}, {9315, 6730}, {9301, 6731}, {9311, 6733}, {9296, 6734}, {9251, 6735}, {9339, 6736}, {9275, 6737},
+    {9337, 6738}, {9277, 6739}, {9248, 6740}, {9116, 6641}, {9256, 6741}, {9157, 6583}, {9287, 6742}, {9255, 6743},
+    {9248, 6744}, {9256, 6745}, {9257, 6746}, {9250, 6747}, {9293, 6750}, {9294, 6751}, {9295, 6752}, {9296, 6784},
+    {9297, 6793}, {9298, 6803}, {9321, 6802}, {9301, 6801}, {9302, 6800}, {9303, 6807}, {9304, 6806}, {9305, 6805},
+    {9300, 6802}, {9306, 6804}, {9307, 6811}, {9308, 6810}, {9257, 6850}, {9273, 6855}, {9266, 6861}, {9236, 6753},
+    {9228, 6755}, {9304, 6783}, {9229, 6756}, {9221, 6757}, {9225, 6758}, {9244, 6759}, {9223, 6757}, {9321, 6760},
+    {9322, 6761}, {9223, 6762}, {9217, 6763}, {9224, 6764}, {9216, 6765}, {9243, 6766}, {9243, 6767}, {9218, 6768},
+    {9222, 6769}, {9238, 6770}, {9242, 6772}, {9217, 6773}, {9217, 6774}, {9238, 6775}, {9243, 6776}, {1204, 6777},
+    {9245, 6778}, {9240, 6779}, {9239, 6780}, {9234, 6781}, {9229, 6782}, {9284, 6785}, {9343, 6786}, {9439, 6787},
+    {1943, 6789}, {9461, 6791}, {9447, 6792}, {9347, 6794}, {9456, 6795}, {9468, 6796}, {9443, 6797}, {9440, 6798},
+    {9444, 6799}, {9452, 6808}, {585, 6809}, {9455, 6812}, {9428, 6813}, {9464, 6814}, {9464, 6815}, {9449, 6817},
+    {9450, 6818}, {9386, 6819}, {9470, 6820}, {9446, 6821}, {9469, 6822}, {9459, 6823}, {9468, 6824}, {9457, 6825},
+    {9471, 6826}, {9457, 6827}, {9451, 6828}, {9370, 6829}, {9461, 6830}, {9455, 6831}, {9449, 6832}, {1846, 6833},
+    {9471, 6868}, {9411, 6848}, {9425, 6865}, {9374, 6834}, {9431, 6835}, {9423, 6836}, {9422, 6837}, {9360, 6838},
+    {9462, 6868}, {9412, 6868}, {9433, 6839}, {9410, 6840}, {9411, 6841}, {9364, 6842}, {9415, 6843}, {9412, 6852},
+    {9421, 6876}, {9439, 6853}, {9430, 6875}, {9437, 6875}, {9356, 6844}, {9438, 6845}, {9430, 6846}, {9446, 6847},
+    {9429, 6851}, {9425, 6854}, {9436, 6856}, {9435, 6857}, {9349, 6858}, {9388, 6859}, {9412, 6829}, {9414, 6853},
+    {9382, 6860}, {9386, 6862}, {9387, 6863}, {9377, 6864}, {9385, 6866}, {9406, 6867}, {9387, 6869}, {9407, 6870},
+    {9376, 6871}, {9377, 6872}, {9401, 6873}, {9396, 6874}, {9405, 6877}, {9402, 6878}, {9383, 6879}, {9400, 6880},
+    {9401, 6881}, {9371, 6882}, {9404, 6883}, {9400, 6884}, {9401, 6885}, {9397, 6886}, {9390, 6887}, {9401, 6888},
+    {9362, 6889}, {9358, 6890}, {9358, 6891}, {9370, 6892}, {9366, 6904}, {9346, 6896}, {9359, 6895}, {9437, 6893},
+    {9402, 6849}, {9354, 6894}, {9349, 6897}, {2774, 6898}, {9349, 6899}, {776, 6912}, {9357, 7013}, {9373, 6901},
+    {9367, 6909}, {9365, 6908}, {9530, 6902}, {630, 6903}, {9367, 6905}, {9366, 6906}, {9348, 7013}, {9355, 7013},
+    {9370, 6907}, {9368, 6910}, {9420, 6911}, {1503, 6913}, {9368, 6914}, {9356, 6915}, {9411, 6916}, {9362, 6917},
+    {9368, 6919}, {9468, 6920}, {9415, 6921}, {9367, 6922}, {9471, 6924}, {9589, 6925}, {9581, 6926}, {9574, 6927},
+    {9563, 6928}, {9477, 6929}, {9583, 6930}, {9479, 6931}, {9580, 6932}, {9583, 6933}, {9483, 6934}, {9582, 6936},
+    {9577, 6935}, {9571, 6937}, {9588, 6938}, {9570, 6939}, {9548, 6940}, {9570, 6935}, {9592, 6941}, {2072, 6942},
+    {9581, 6935}, {9519, 6943}, {9591, 6944}, {9495, 6945}, {9504, 6946}, {9584, 6947}, {9588, 6948}, {9577, 6949},
+    {9597, 6950}, {9594, 6951}, {9504, 6952}, {9544, 6953}, {9597, 6954}, {9543, 6955}, {9558, 6956}, {9538, 6957},
+    {9546, 6958}, {9592, 6959}, {9564, 6960}, {9564, 6961}, {9539, 6963}, {2654, 6964}, {9579, 6931}, {9540, 6965},
+    {9518, 6966}, {1113, 6967}, {1632, 6968}, {9480, 6969}, {9567, 6970}, {9505, 6971}, {9579, 6972}, {9548, 6973},
+    {9550, 7005}, {9562, 6974}, {9485, 6975}, {9575, 6976}, {9546, 6977}, {9560, 6978}, {9598, 6945}, {9554, 6979},
+    {9561, 7005}, {9556, 7005}, {9555, 6980}, {9551, 6981}, {9567, 6990}, {9546, 6997}, {9595, 6982}, {9505, 6983},
+    {9509, 6984}, {445, 6986}, {9515, 6987}, {9497, 6988}, {9504, 6989}, {9380, 6849}, {9587, 6991}, {9534, 6992},
+    {9547, 6993}, {9513, 6994}, {9591, 6995}, {9532, 6998}, {9535, 6999}, {9526, 7000}, {9485, 7001}, {9520, 7002},
+    {9504, 7003}, {9509, 7004}, {9530, 7006}, {2058, 7007}, {2292, 7008}, {725, 7010}, {9528, 7011}, {9526, 7012},
+    {9530, 7014}, {9520, 7015}, {9524, 7032}, {9525, 7027}, {9493, 7032}, {9484, 7024}, {9481, 7025}, {9483, 7030},
+    {9514, 6962}, {9519, 7035}, {9491, 7033}, {9479, 7036}, {9499, 7037}, {9499, 7031}, {9498, 7016}, {9480, 7036},
+    {9489, 7018}, {9479, 7017}, {9493, 7019}, {9476, 7018}, {9598, 7020}, {9599, 7023}, {9477, 7037}, {9482, 7033},
+    {9480, 7036}, {9490, 7022}, {9499, 7016}, {9495, 7021}, {9477, 7017}, {9495, 7017}, {9489, 7017}, {9501, 7021},
+    {9711, 7026}, {9482, 7022}, {9529, 7035}, {9705, 7028}, {9476, 7016}, {9712, 7029}, {9657, 7034}, {9662, 7038},
+    {9700, 7039}, {9713, 7041}, {9704, 7042}, {9705, 7043}, {9711, 7044}, {9720, 7045}, {9709, 7049}, {9696, 7047},
+    {718, 7048}, {9710, 7050}, {9724, 7051}, {395, 7052}, {9696, 7053}, {9713, 7054}, {9716, 7056}, {9721, 7057},
+    {9714, 7058}, {9716, 7059}, {9697, 7060}, {1710, 7061}, {9701, 7063}, {9717, 7058}, {9727, 7071}, {9725, 7070},
+    {9626, 7064}, {2170, 7065}, {9722, 7066}, {9720, 7067}, {9711, 7072}, {9727, 7083}, {9706, 7088}, {297, 7068},
+    {9676, 7069}, {9665, 7074}, {92, 7075}, {9681, 7076}, {9680, 7077}, {9683, 7078}, {9671, 7079}, {666, 7080},
+    {9670, 7117}, {9672, 7089}, {9695, 7093}, {9667, 7099}, {9679, 7081}, {667, 7082}, {9691, 7084}, {9711, 7085},
+    {9685, 7086}, {9685, 7079}, {9608, 7087}, {9686, 7090}, {9691, 7091}, {9653, 7092}, {9612, 7094}, {9704, 7095},
+    {9693, 7096}, {9694, 7097}, {9683, 7098}, {9695, 7100}, {9690, 7101}, {9668, 7064}, {9679, 7102}, {9674, 7104},
+    {9681, 7121}, {9650, 7103}, {9665, 7105}, {9655, 7106}, {9628, 7107}, {9564, 6962}, {9655, 7108}, {9727, 7110},
+    {9645, 7111}, {9646, 7112}, {9645, 7113}, {9638, 7125}, {9643, 7114}, {9660, 7115}, {9641, 7116}, {9644, 7119},
+    {9617, 7120}, {9646, 7122}, {9662, 7123}, {1041, 7124}, {2760, 7126}, {9657, 7127}, {9638, 7128}, {9659, 7129},
+    {9649, 7130}, {9659, 7131}, {9637, 7133}, {9687, 7132}, {9688, 7134}, {9786, 7135}, {9689, 7136}, {9696, 7137},
+    {9656, 7139}, {9692, 7140}, {9693, 7141}, {9655, 7143}, {9695, 7144}, {9618, 7152}, {9606, 7160}, {9606, 7161},
+    {9612, 7146}, {9622, 7147}, {9596, 7148}, {9607, 7149}, {9703, 7150}, {9613, 7151}, {9627, 7153}, {9624, 7155},
+    {9624, 7156}, {9614, 7157}, {9684, 7158}, {9629, 7164}, {9622, 7165}, {9625, 7166}, {9611, 7167}, {9631, 7168},
+    {9616, 7169}, {9642, 7170}, {9616, 7171}, {9620, 7172}, {9831, 7173}, {9617, 7174}, {9609, 7175}, {9631, 7176},
+    {9621, 7177}, {9629, 7178}, {9624, 7179}, {9625, 7180}, {9628, 7178}, {9831, 7181}, {9830, 7182}, {9790, 7183},
+    {1721, 7184}, {9836, 7285}, {9834, 7185}, {9828, 7186}, {9736, 7187}, {9853, 7188}, {9776, 7189}, {731, 7190},
+    {9739, 7262}, {9740, 7263}, {9810, 7191}, {9835, 7192}, {9850, 7194}, {9855, 7195}, {9775, 7196}, {9844, 7198},
+    {9830, 7193}, {9851, 7200}, {9836, 7213}, {9852, 7216}, {9855, 7193}, {9844, 7193}, {9846, 7201}, {9855, 7202},
+    {9835, 7203}, {9794, 7204}, {1917, 7205}, {9853, 7206}, {9852, 7207}, {9793, 7208}, {1300, 7209}, {9795, 7210},
+    {9810, 7211}, {9804, 7212}, {9758, 7214}, {9759, 7215}, {9812, 7217}, {9822, 7218}, {9803, 7219}, {9797, 7220},
+    {9806, 7221}, {9805, 7222}, {9750, 7223}, {9822, 7224}, {1522, 7225}, {9816, 7260}, {9749, 7227}, {9809, 7228},
+    {9823, 7229}, {9794, 7230}, {9737, 7231}, {2632, 7232}, {1401, 7233}, {9819, 7234}, {9793, 7235}, {9740, 7236},
+    {9795, 7237}, {9819, 7238}, {9803, 7239}, {9728, 7240}, {9729, 7241}, {9810, 7242}, {9796, 7243}, {9810, 7244},
+    {9733, 7246}, {9765, 7247}, {9767, 7248}, {9763, 7249}, {9777, 7251}, {9949, 7252}, {9778, 7264}, {9914, 7281},
+    {9763, 7254}, {9764, 7255}, {9773, 7256}, {1650, 7261}, {1239, 7265}, {2226, 7266}, {9843, 7267}, {2375, 7268},
+    {9761, 7269}, {9803, 7270}, {9790, 7271}, {9760, 7272}, {9789, 7273}, {9780, 7275}, {73, 7276}, {9763, 7277},
+    {9784, 7280}, {9939, 7282}, {9783, 7283}, {9772, 7284}, {9765, 7286}, {9784, 7287}, {9780, 7288}, {9734, 7289},
+    {9818, 7290}, {9789, 7291}, {9789, 7292}, {9821, 7293}, {9772, 7294}, {9747, 7295}, {9731, 7296}, {9827, 7297},
+    {9747, 7298}, {9747, 7299}, {164, 7300}, {9734, 7393}, {9758, 7301}, {9780, 7302}, {9741, 7303}, {9736, 7304},
+    {9739, 7305}, {9738, 7306}, {9740, 7393}, {9729, 7393}, {2741, 7308}, {9756, 7309}, {9757, 7310}, {9751, 7312},
+    {9745, 7316}, {332, 7313}, {9745, 7314}, {9747, 7315}, {9733, 7317}, {9746, 7318}, {9751, 7319}, {9748, 7320},
+    {9793, 7321}, {9753, 7322}, {9759, 7326}, {9761, 7323}, {9754, 7324}, {1580, 7325}, {9957, 7327}, {9968, 7328},
+    {9969, 7329}, {9959, 7330}, {9961, 7331}, {9953, 7332}, {9978, 7336}, {9979, 7340}, {9965, 7333}, {9954, 7334},
+    {9983, 7335}, {9954, 7337}, {9966, 7349}, {9983, 7338}, {9972, 7339}, {9968, 7332}, {9896, 7341}, {9952, 7342},
+    {9973, 7343}, {9903, 7344}, {9983, 7346}, {9957, 7347}, {9969, 7345}, {9975, 7351}, {9967, 7348}, {9971, 7351},
+    {9969, 7353}, {9980, 7352}, {9966, 7354}, {9973, 7354}, {9924, 7356}, {9880, 7350}, {9923, 7368}, {9928, 7360},
+    {9936, 7379}, {9933, 7371}, {9950, 7377}, {9921, 7355}, {9942, 7360}, {9931, 7352}, {9922, 7357}, {9939, 7362},
+    {9943, 7358}, {9943, 7372}, {9939, 7363}, {9940, 7358}, {9920, 7359}, {9949, 7359}, {9926, 7360}, {9940, 7375},
+    {9921, 7361}, {9951, 7366}, {9925, 7370}, {9932, 7376}, {9897, 7390}, {9940, 7369}, {9937, 7366}, {9903, 7364},
+    {9895, 7392}, {9910, 7403}, {9891, 7402}, {9889, 7415}, {9888, 7414}, {9743, 7290}, {9893, 7412}, {9915, 7384},
+    {9898, 7380}, {9916, 7365}, {9890, 7380}, {9894, 7378}, {9916, 7382}, {9895, 7386}, {9906, 7367}, {9870, 7373},
+    {9914, 7374}, {9888, 7381}, {9950, 7361}, {9867, 7383}, {9930, 7369}, {9949, 7361}, {9904, 7385}, {9964, 7387},
+    {9910, 7388}, {9905, 7389}, {9912, 7394}, {9915, 7395}, {9897, 7397}, {9917, 7406}, {9896, 7413}, {9905, 7396},
+    {9951, 7398}, {9946, 7399}, {9876, 7400}, {9870, 7404}, {9870, 7405}, {9865, 7407}, {9867, 7408}, {9935, 7409},
+    {1888, 7410}, {9866, 7411}, {9863, 7416}, {9867, 7419}, {1157, 7421}, {9937, 7422}, {9902, 7423}, {1265, 7424},
+    {9965, 7425}, {9895, 7427}, {9967, 7428}, {9930, 7430}, {9931, 7431}, {9872, 7432}, {9929, 7435}, {1586, 7436},
+    {9873, 7441}, {293, 7442}, {9876, 7443}, {9874, 7456}, {9861, 7487}, {16, 7444}, {9867, 7445}, {9977, 7447},
+    {9876, 7448}, {1805, 7449}, {1645, 7450}, {9882, 7451}, {9926, 7452}, {9981, 7453}, {9904, 7454}, {9886, 7455},
+    {10098, 7457}, {10093, 7458}, {10059, 7459}, {10076, 7460}, {10088, 7461}, {2474, 7462}, {10084, 7472}, {10088, 7481},
+    {10083, 7464}, {10034, 7465}, {1410, 7467}, {10048, 7469}, {10083, 7471}, {506, 7473}, {905, 7474}, {10073, 7526},
+    {9996, 7475}, {10111, 7477}, {10065, 7479}, {105, 7483}, {10081, 7484}, {10110, 7485}, {10082, 7486}, {10108, 7488},
+    {10098, 7490}, {10093, 7491}, {10081, 7492}, {10006, 7495}, {10007, 7496}, {10018, 7498}, {10009, 7499}, {841, 7500},
+    {10089, 7501}, {10079, 7502}, {1271, 7503}, {10063, 7504}, {10013, 7506}, {10014, 7508}, {10097, 7510}, {10005, 7513},
+    {2661, 7514}, {9994, 7515}, {10071, 7519}, {10036, 7520}, {9999, 7521}, {10100, 7522}, {10041, 7523}, {9984, 7524},
+    {10051, 7512}, {721, 7525}, {10051, 7512}, {10048, 7512}, {1676, 7527}, {10058, 7512}, {10056, 7528}, {10070, 7512},
+    {9990, 7529}, {10051, 7512}, {9991, 7530}, {10046, 7531}, {10056, 7512}, {10106, 7533}, {10073, 7512}, {10055, 7512},
+    {2797, 7535}, {10073, 7512}, {10056, 7512}, {10063, 7512}, {10107, 7536}, {10104, 7537}, {10105, 7539}, {10063, 7512},
+    {10170, 7540}, {10033, 7541}, {10111, 7542}, {10054, 7543}, {10036, 7545}, {10022, 7546}, {10029, 7547}, {10058, 7548},
+    {10023, 7550}, {10029, 7551}, {10028, 7552}, {10062, 7553}, {10045, 7555}, {10039, 7563}, {10037, 7562}, {10066, 7556},
+    {10033, 7557}, {10068, 7558}, {2082, 7559}, {994, 7560}, {10043, 7561}, {10001, 7564}, {857, 7565}, {10020, 7566},
+    {10027, 7567}, {1259, 7568}, {10038, 7569}, {1680, 7571}, {10080, 7572}, {10081, 7573}, {10031, 7574}, {10087, 7575},
+    {10029, 7576}, {10038, 7577}, {2491, 7579}, {10074, 7581}, {9999, 7582}, {10082, 7583}, {9990, 7584}, {1312, 7585},
+    {935, 7586}, {9992, 7587}, {9990, 7589}, {9985, 7590}, {9990, 7591}, {9990, 7592}, {10089, 7593}, {10179, 7594},
+    {10065, 7595}, {10058, 7596}, {10093, 7597}, {10068, 7598}, {10032, 7599}, {9988, 7600}, {10045, 7601}, {584, 7602},
+    {10029, 7603}, {10099, 7604}, {10000, 7605}, {10026, 7606}, {10102, 7607}, {10061, 7608}, {470, 7609}, {1264, 7610},
+    {10013, 7611}, {9995, 7613}, {10021, 7614}, {10020, 7615}, {10013, 7617}, {10004, 7618}, {10007, 7619}, {10001, 7620},
+    {10171, 7621}, {10208, 7623}, {10212, 7624}, {10221, 7625}, {10225, 7626}, {10172, 7628}, {10119, 7629}, {10236, 7631},
+    {10121, 7632}, {10239, 7634}, {10211, 7635}, {951, 7636}, {10221, 7637}, {10233, 7638}, {10193, 7639}, {10235, 7640},
+    {10213, 7641}, {10236, 7642}, {104, 7680}, {10208, 7781}, {10239, 7643}, {10209, 7645}, {10230, 7781}, {10134, 7646},
+    {10232, 7647}, {10231, 7649}, {10147, 7650}, {10236, 7651}, {10217, 7652}, {10239, 7653}, {10233, 7654}, {10235, 7655},
+    {10176, 7656}, {10188, 7657}, {10185, 7658}, {10136, 7659}, {10137, 7661}, {10177, 7662}, {10143, 7663}, {10197, 7664},
+    {10232, 7665}, {10181, 7666}, {10181, 7667}, {10180, 7668}, {10155, 7669}, {10189, 7670}, {10207, 7671}, {10191, 7672},
+    {2399, 7673}, {10133, 7674}, {10197, 7675}, {10222, 7677}, {10162, 7678}, {10198, 7679}, {1794, 7681}, {10126, 7682},
+    {10218, 7685}, {10197, 7686}, {10167, 7687}, {10186, 7688}, {10200, 7689}, {637, 7690}, {10185, 7691}, {10199, 7692},
+    {10172, 7693}, {10194, 7694}, {10116, 7696}, {10175, 7697}, {10145, 7698}, {10157, 7699}, {10232, 7700}, {10167, 7701},
+    {10145, 7702}, {10160, 7703}, {10183, 7704}, {10148, 7705}, {10171, 7706}, {10159, 7707}, {2169, 7709}, {10187, 7710},
+    {10153, 7711}, {10231, 7712}, {10155, 7713}, {2033, 7714}, {10158, 7751}, {10168, 7715}, {10147, 7717}, {10145, 7718},
+    {10149, 7720}, {10175, 7721}, {10150, 7722}, {10285, 7723}, {10162, 7724}, {10120, 7725}, {10166, 7726}, {10201, 7727},
+    {10158, 7728}, {1101, 7729}, {10153, 7730}, {10160, 7731}, {10153, 7732}, {10156, 7733}, {10160, 7734}, {10121, 7735},
+    {98, 7737}, {10125, 7738}, {10123, 7739}, {10211, 7740}, {2663, 7741}, {10122, 7742}, {10126, 7743}, {10115, 7745},
+    {10122, 7746}, {10299, 7747}, {10118, 7748}, {10119, 7749}, {704, 7808}, {10114, 7909}, {10121, 7750}, {10120, 7752},
+    {10121, 7753}, {10121, 7754}, {193, 7755}, {10115, 7756}, {10187, 7757}, {1902, 7758}, {10157, 7760}, {10119, 7761},
+    {10113, 7762}, {10119, 7763}, {2089, 7764}, {10132, 7765}, {10189, 7766}, {10232, 7767}, {10233, 7768}, {10126, 7769},
+    {10143, 7771}, {10142, 7772}, {10336, 7773}, {10342, 7774}, {10245, 7775}, {10352, 7776}, {10344, 7774}, {10348, 7777},
+    {10340, 7778}, {10363, 7779}, {10325, 7780}, {10289, 7782}, {10252, 7783}, {10295, 7784}, {10338, 7785}, {10255, 7787},
+    {10256, 7788}, {10354, 7791}, {10315, 7792}, {10356, 7793}, {10361, 7794}, {10360, 7795}, {10365, 7796}, {10364, 7797},
+    {10360, 7790}, {10266, 7799}, {10359, 7800}, {10367, 7801}, {10357, 7802}, {1129, 7803}, {10305, 7804}, {10363, 7805},
+    {10319, 7806}, {10365, 7790}, {10316, 7809}, {10274, 7810}, {10275, 7811}, {10270, 7812}, {10312, 7824}, {10359, 7814},
+    {10315, 7813}, {10316, 7815}, {10310, 7816}, {2487, 7817}, {10335, 7818}, {10311, 7813}, {10307, 7820}, {10312, 7821},
+    {10260, 7822}, {10261, 7823}, {10312, 7825}, {10251, 7826}, {10310, 7829}, {10311, 7831}, {10325, 7832}, {10331, 7833},
+    {10235, 7770}, {10306, 7834}, {10309, 7835}, {10343, 7836}, {10326, 7837}, {10331, 7838}, {10326, 7839}, {10300, 7840},
+    {10324, 7841}, {10314, 7845}, {10245, 7842}, {10360, 7843}, {10278, 7844}, {10287, 7846}, {10309, 7847}, {10364, 7848},
+    {48, 7849}, {10284, 7850}, {10343, 7852}, {10279, 7853}, {10272, 7854}, {2138, 7855}, {10284, 7856}, {10257, 7857},
+    {10357, 7858}, {10289, 7859}, {10291, 7860}, {10295, 7861}, {10290, 7862}, {10299, 7863}, {858, 7865}, {10302, 7866},
+    {10277, 7867}, {10413, 7868}, {10297, 7869}, {10301, 7870}, {1044, 7871}, {10285, 7872}, {10303, 7873}, {10287, 7874},
+    {10303, 7875}, {10290, 7876}, {10290, 7877}, {1206, 7878}, {10285, 7879}, {10489, 7880}, {10250, 7881}, {10257, 7882},
+    {10412, 7883}, {1634, 7936}, {10250, 8037}, {10250, 7884}, {10258, 7885}, {10249, 7886}, {10240, 7887}, {10245, 7888},
+    {10255, 7889}, {10245, 7890}, {10245, 7891}, {10240, 7892}, {10247, 7893}, {10287, 7896}, {10245, 7897}, {10246, 7898},
+    {10474, 7894}, {10258, 7900}, {10282, 7901}, {10263, 7902}, {10245, 7903}, {10266, 7904}, {10250, 7905}, {10254, 7906},
+    {10270, 7907}, {10271, 7908}, {10259, 7910}, {10267, 7911}, {10266, 7912}, {10470, 7913}, {10486, 7914}, {10485, 7915},
+    {10475, 7916}, {10476, 7917}, {10477, 7918}, {10489, 7919}, {10380, 7920}, {10489, 7921}, {10489, 7922}, {10467, 7923},
+    {10473, 7924}, {10493, 7925}, {10494, 7926}, {651, 7927}, {10409, 7928}, {10388, 7929}, {10492, 7930}, {10483, 7931},
+    {10492, 7932}, {10467, 7933}, {10276, 7840}, {10488, 7934}, {10495, 7935}, {10140, 7770}, {10494, 7937}, {10491, 7938},
+    {10394, 7939}, {10447, 7940}, {10445, 7941}, {1667, 7942}, {10438, 8035}, {10461, 7943}, {10438, 7944}, {10442, 7945},
+    {10266, 7894}, {482, 7946}, {10451, 7947}, {10445, 7948}, {10436, 7949}, {10410, 7950}, {10437, 7951}, {10445, 7952},
+    {10413, 7953}, {10462, 7955}, {2635, 7956}, {10417, 7957}, {10433, 7959}, {10476, 7960}, {10457, 7961}, {10460, 7962},
+    {10414, 7954}, {10463, 7964}, {10472, 7965}, {10457, 7966}, {2095, 7967}, {10470, 7970}, {10463, 7971}, {10369, 7972},
+    {10448, 7973}, {10441, 7974}, {10458, 7975}, {10445, 7976}, {10406, 7977}, {10418, 7978}, {10405, 7979}, {10394, 7980},
+    {10418, 7981}, {10418, 7982}, {10440, 7983}, {10441, 7984}, {10389, 7985}, {10408, 7986}, {10410, 7987}, {10445, 7989},
+    {10403, 7978}, {10406, 7990}, {10447, 7991}, {10425, 7992}, {10403, 7993}, {10400, 7978}, {10472, 7994}, {10380, 7995},
+    {10431, 7996}, {10406, 7997}, {10423, 7998}, {10403, 7999}, {10429, 8000}, {10410, 8001}, {10419, 8002}, {10372, 8003},
+    {1657, 8004}, {10470, 8005}, {10417, 8006}, {273, 8007}, {10426, 8008}, {10368, 8009}, {10375, 8010}, {10389, 8011},
+    {10382, 8012}, {10390, 8013}, {10468, 8014}, {2805, 8015}, {10426, 8016}, {10460, 8017}, {10377, 8018}, {1514, 8019},
+    {10383, 8020}, {1941, 8022}, {10451, 8023}, {10393, 8024}, {10388, 8025}, {10420, 8026}, {10383, 8027}, {10372, 8028},
+    {10379, 8029}, {10479, 8030}, {10443, 8031}, {10484, 8032}, {10447, 8033}, {10392, 8034}, {10371, 8036}, {2581, 8038},
+    {10390, 8039}, {10391, 8040}, {10398, 8041}, {10387, 8042}, {10377, 8043}, {1256, 8044}, {2639, 8045}, {425, 8046},
+    {2013, 8047}, {1105, 8048}, {152, 8049}, {10494, 8050}, {264, 8056}, {352, 8051}, {456, 8052}, {2564, 8053},
+    {2652, 8054}, {2758, 8055}, {57, 8057}, {2140, 8058}, {2255, 8059}, {10394, 8060}, {10601, 8061}, {10595, 8062},
+    {10599, 8063}, {10594, 8064}, {10500, 8065}, {10586, 8066}, {10610, 8067}, {10441, 7954}, {10596, 8070}, {10593, 8068},
+    {10547, 8069}, {926, 8071}, {1909, 8072}, {10607, 8073}, {10619, 8074}, {10579, 8075}, {10602, 8076}, {10603, 8077},
+    {10576, 8078}, {10595, 8079}, {10612, 8080}, {10620, 8081}, {10612, 8082}, {10571, 8083}, {10543, 8084}, {10609, 8085},
+    {10623, 8086}, {10621, 8088}, {10531, 8089}, {10528, 8090}, {10564, 8091}, {10617, 8092}, {10525, 8093}, {1310, 8094},
+    {10620, 8095}, {10615, 8097}, {10522, 8098}, {603, 8099}, {10581, 8100}, {10571, 8101}, {10577, 8102}, {10561, 8103},
+    {10527, 8104}, {10580, 8105}, {10525, 8107}, {10587, 8108}, {10614, 8109}, {10567, 8110}, {10612, 8111}, {10568, 8112},
+    {10541, 8113}, {10563, 8114}, {10517, 8115}, {10577, 8116}, {10507, 8117}, {10588, 8118}, {10505, 8119}, {10577, 8120},
+    {10587, 8121}, {10563, 8122}, {495, 8123}, {10589, 8124}, {10576, 8125}, {10581, 8126}, {10575, 8128}, {10585, 8136},
+    {10582, 8158}, {10587, 8137}, {10540, 8129}, {10552, 8130}, {10562, 8131}, {10682, 8132}, {10532, 8133}, {10539, 8134},
+    {10577, 8158}, {10588, 8158}, {10566, 8135}, {10542, 8138}, {10543, 8139}, {10542, 8140}, {10571, 8141}, {10513, 8142},
+    {10554, 8143}, {10532, 8145}, {10557, 8159}, {10546, 8146}, {10529, 8147}, {10546, 8144}, {10586, 8148}, {10549, 8149},
+    {10555, 8150}, {10542, 8151}, {1417, 8192}, {10507, 8152}, {10668, 8153}, {10506, 8154}, {10555, 8155}, {10597, 8156},
+    {10559, 8293}, {10528, 8131}, {10496, 8157}, {10549, 8160}, {10508, 8161}, {10507, 8162}, {10546, 8163}, {10518, 8164},
+    {10550, 8293}, {10500, 8293}, {10523, 8165}, {10548, 8141}, {10522, 8166}, {10680, 8167}, {10496, 8168}, {10514, 8169},
+    {10520, 8170}, {10501, 8171}, {10516, 8172}, {10500, 8148}, {10526, 8173}, {10527, 8174}, {10524, 8175}, {10523, 8176},
+    {10517, 8177}, {10565, 8178}, {10498, 8156}, {10726, 8179}, {10721, 8180}, {10730, 8181}, {10727, 8182}, {10685, 8183},
+    {10748, 8184}, {10727, 8185}, {10709, 8186}, {10726, 8187}, {10727, 8188}, {10725, 8189}, {10720, 8190}, {10639, 8191},
+    {10725, 8193}, {10744, 8194}, {10749, 8196}, {10508, 8177}, {10721, 8198}, {10739, 8206}, {10737, 8207}, {10749, 8199},
+    {10751, 8200}, {10737, 8201}, {10656, 8204}, {10657, 8205}, {10747, 8208}, {10744, 8209}, {10654, 8210}, {10737, 8212},
+    {10697, 8213}, {10658, 8214}, {10748, 8215}, {10689, 8216}, {536, 8217}, {10661, 8218}, {10696, 8219}, {2707, 8220},
+    {10649, 8202}, {10653, 8221}, {10718, 8222}, {10641, 8223}, {10715, 8224}, {2102, 8225}, {10647, 8226}, {2576, 8227},
+    {10703, 8262}, {10634, 8228}, {10691, 8229}, {1435, 8230}, {10699, 8232}, {10695, 8237}, {10715, 8240}, {10718, 8231},
+    {10718, 8233}, {10637, 8234}, {10713, 8235}, {10719, 8236}, {10719, 8238}, {10683, 8241}, {10719, 8242}, {1886, 8243},
+    {10716, 8278}, {10702, 8262}, {10686, 8244}, {10720, 8245}, {10655, 8246}, {10680, 8247}, {10670, 8248}, {10672, 8249},
+    {1547, 8250}, {10666, 8251}, {10677, 8252}, {10659, 8253}, {10670, 8254}, {10738, 8255}, {10668, 8256}, {10681, 8257},
+    {10644, 8258}, {10657, 8259}, {840, 8320}, {10660, 8421}, {10658, 8260}, {10659, 8263}, {1964, 8264}, {10658, 8272},
+    {10678, 8280}, {10678, 8281}, {10707, 8267}, {10657, 8268}, {10664, 8270}, {10724, 8271}, {10672, 8273}, {10720, 8274},
+    {10631, 8275}, {10810, 8276}, {10637, 8277}, {10640, 8279}, {10639, 8282}, {10629, 8283}, {10650, 8284}, {10632, 8285},
+    {10659, 8269}, {10730, 8286}, {10649, 8287}, {10658, 8269}, {10645, 8288}, {10634, 8290}, {10637, 8291}, {10673, 8269},
+    {10709, 8292}, {10736, 8294}, {10654, 8295}, {2287, 8296}, {10696, 8297}, {10740, 8298}, {10651, 8299}, {10643, 8300},
+    {10646, 8301}, {10678, 8269}, {10635, 8302}, {10646, 8303}, {10645, 8304}, {10683, 8269}, {10689, 8305}, {10672, 8267},
+    {10643, 8306}, {10654, 8310}, {10650, 8311}, {10647, 8321}, {10866, 8346}, {10845, 8312}, {10852, 8313}, {10861, 8314},
+    {10859, 8316}, {10867, 8322}, {10863, 8316}, {10853, 8335}, {10860, 8323}, {10692, 8202}, {10857, 8327}, {10876, 8336},
+    {10872, 8324}, {10856, 8334}, {10876, 8315}, {10870, 8317}, {10871, 8318}, {10855, 8319}, {10874, 8325}, {10873, 8324},
+    {10860, 8328}, {10850, 8331}, {10852, 8338}, {10865, 8348}, {10871, 8326}, {10863, 8329}, {10869, 8341}, {10874, 8340},
+    {10864, 8342}, {10870, 8337}, {10832, 8345}, {10826, 8339}, {10832, 8343}, {10777, 8330}, {2490, 8332}, {665, 8333},
+    {10827, 8344}, {10820, 8347}, {10823, 8349}, {10791, 8350}, {10792, 8351}, {10830, 8352}, {10821, 8353}, {10821, 8354},
+    {10841, 8355}, {10828, 8356}, {10772, 8357}, {10822, 8358}, {10844, 8359}, {10836, 8361}, {10844, 8362}, {10839, 8364},
+    {10816, 8365}, {10834, 8366}, {10840, 8367}, {10819, 8368}, {10843, 8373}, {10845, 8369}, {10837, 8370}, {10832, 8372},
+    {10836, 8374}, {10836, 8375}, {2098, 8376}, {10799, 8378}, {10872, 8379}, {10784, 8380}, {10806, 8381}, {10788, 8382},
+    {10847, 8413}, {10791, 8384}, {10786, 8385}, {10866, 8387}, {10790, 8388}, {10799, 8389}, {10814, 8390}, {10796, 8401},
+    {10838, 8413}, {10789, 8413}, {10799, 8392}, {10788, 8393}, {10788, 8394}, {10805, 8395}, {10812, 8396}, {10791, 8398},
+    {10791, 8399}, {10762, 8400}, {10838, 8402}, {10861, 8403}, {10792, 8404}, {600, 8405}, {10841, 8406}, {10806, 8407},
+    {10849, 8408}, {10800, 8409}, {10803, 8410}, {10852, 8411}, {10814, 8412}, {10761, 8414}, {10773, 8415}, {10757, 8416},
+    {10760, 8417}, {1542, 8418}, {10768, 8419}, {10766, 8420}, {10845, 8422}, {10856, 8423}, {10764, 8424}, {10756, 8425},
+    {10777, 8426}, {10779, 8427}, {10755, 8428}, {10763, 8429}, {10837, 8430}, {10752, 8431}, {10783, 8432}, {10753, 8433},
+    {10796, 8434}, {10756, 8437}, {10775, 8438}, {10769, 8439}, {10778, 8440}, {10829, 8441}, {10765, 8442}, {1628, 8443},
+    {1443, 8444}, {1087, 8446}, {10876, 8447}, {10774, 8448}, {158, 8449}, {2247, 8450}, {10771, 8451}, {946, 8452},
+    {10987, 8453}, {10985, 8454}, {10987, 8455}, {10980, 8456}, {10992, 8457}, {10982, 8458}, {10984, 8459}, {2762, 8460},
+    {10941, 8461}, {10977, 8462}, {10976, 8463}, {11006, 8464}, {10986, 8465}, {10989, 8465}, {10893, 8466}, {10991, 8467},
+    {10990, 8468}, {10997, 8469}, {10923, 8470}, {11005, 8471}, {10921, 8472}, {10999, 8473}, {10996, 8474}, {10995, 8475},
+    {10999, 8477}, {10998, 8478}, {10948, 8479}, {11003, 8480}, {10985, 8481}, {11005, 8484}, {11006, 8482}, {10945, 8483},
+    {10874, 8445}, {10981, 8476}, {10949, 8485}, {10960, 8486}, {10915, 8487}, {10960, 8489}, {10953, 8490}, {10964, 8491},
+    {199, 8492}, {10909, 8493}, {10920, 8494}, {1121, 8496}, {1228, 8497}, {10945, 8498}, {10972, 8499}, {10956, 8504},
+    {10971, 8508}, {10953, 8509}, {10955, 8500}, {10947, 8501}, {10997, 8476}, {10928, 8502}, {10891, 8503}, {10967, 8505},
+    {10966, 8506}, {10968, 8507}, {10972, 8510}, {10967, 8511}, {10975, 8512}, {10974, 8513}, {10962, 8515}, {10952, 8516},
+    {10957, 8517}, {10963, 8519}, {10968, 8520}, {10960, 8521}, {10943, 8522}, {10944, 8523}, {10932, 8524}, {11000, 8525},
+    {10929, 8526}, {10917, 8527}, {10906, 8528}, {10919, 8529}, {10951, 8530}, {10994, 8531}, {10924, 8533}, {10954, 8534},
+    {10914, 8535}, {10899, 8536}, {10913, 8537}, {10958, 8538}, {10935, 8541}, {10914, 8542}, {10961, 8543}, {10938, 8544},
+    {10930, 8545}, {10990, 8546}, {10965, 8547}, {10967, 8548}, {10978, 8549}, {10979, 8550}, {10933, 8551}, {10971, 8552},
+    {10926, 8553}, {10940, 8554}, {10930, 8555}, {10923, 8556}, {10883, 8557}, {10895, 8558}, {10974, 8560}, {10894, 8561},
+    {10972, 8562}, {10983, 8566}, {10962, 8568}, {265, 8569}, {10934, 8570}, {10894, 8571}, {10967, 8572}, {10897, 8575},
+    {10908, 8573}, {10883, 8576}, {10886, 8573}, {10859, 8577}, {10898, 8578}, {10958, 8579}, {10959, 8580}, {10906, 8581},
+    {10904, 8582}, {10896, 8583}, {2651, 8584}, {10906, 8585}, {10911, 8586}, {1723, 8587}, {10895, 8588}, {10916, 8547},
+    {10903, 8685}, {10892, 8589}, {10893, 8590}, {550, 8591}, {11118, 8592}, {10778, 8445}, {11125, 8593}, {11120, 8595},
+    {11108, 8603}, {11104, 8602}, {11127, 8596}, {11115, 8597}, {11113, 8598}, {11130, 8599}, {11059, 8600}, {11134, 8601},
+    {11057, 8605}, {11129, 8606}, {11134, 8607}, {11116, 8608}, {11131, 8610}, {11121, 8611}, {11124, 8612}, {11048, 8613},
+    {10899, 8685}, {11049, 8614}, {11120, 8615}, {11029, 8616}, {11109, 8617}, {11125, 8618}, {11134, 8619}, {11043, 8620},
+    {10978, 8559}, {11122, 8622}, {11076, 8623}, {11129, 8624}, {11121, 8625}, {11135, 8626}, {11045, 8627}, {11077, 8637},
+    {11035, 8628}, {11094, 8629}, {11073, 8630}, {11088, 8631}, {11090, 8632}, {11098, 8629}, {11083, 8633}, {11098, 8634},
+    {11102, 8635}, {11024, 8636}, {11051, 8638}, {11030, 8639}, {11086, 8640}, {11054, 8641}, {11100, 8642}, {11103, 8643},
+    {11103, 8644}, {11089, 8645}, {11101, 8647}, {11075, 8646}, {11095, 8648}, {11074, 8650}, {11021, 8651}, {11089, 8649},
+    {11110, 8661}, {11097, 8652}, {11067, 8653}, {11084, 8670}, {11079, 8660}, {11098, 8655}, {11047, 8654}, {11052, 8656},
+    {11046, 8672}, {11057, 8701}, {11052, 8698}, {11055, 8657}, {11043, 8658}, {11070, 8659}, {11044, 8662}, {11057, 8662},
+    {11048, 8664}, {11064, 8662}, {11090, 8670}, {11042, 8667}, {11046, 8668}, {11045, 8669}, {11194, 8663}, {11058, 8673},
+    {11041, 8678}, {11041, 8665}, {11061, 8666}, {11043, 8671}, {11057, 8674}, {11066, 8677}, {11059, 8700}, {11058, 8675},
+    {11058, 8676}, {11060, 8679}, {11057, 8680}, {11015, 8681}, {11012, 8682}, {11015, 8683}, {11018, 8684}, {11044, 8653},
+    {11017, 8686}, {11021, 8688}, {11016, 8690}, {11022, 8687}, {11009, 8689}, {11008, 8691}, {11011, 8692}, {11060, 8693},
+    {11013, 8694}, {11038, 8695}, {11057, 8696}, {11035, 8697}, {11010, 8699}, {11083, 8702}, {11122, 8703}, {11024, 8704},
+    {11026, 8705}, {11035, 8706}, {11028, 8707}, {11035, 8708}, {11019, 8709}, {11035, 8710}, {11023, 8711}, {896, 8712},
+    {11134, 8713}, {11019, 8714}, {11232, 8715}, {11239, 8716}, {11238, 8717}, {10887, 8559}, {11233, 8718}, {11239, 8719},
+    {11242, 8721}, {11197, 8722}, {11237, 8723}, {11145, 8725}, {11243, 8726}, {1587, 8728}, {11256, 8729}, {1155, 8730},
+    {11148, 8731}, {11149, 8732}, {11234, 8733}, {11151, 8734}, {11234, 8736}, {11263, 8738}, {11259, 8739}, {11252, 8740},
+    {11259, 8742}, {668, 8743}, {11183, 8744}, {11256, 8747}, {11159, 8748}, {325, 8749}, {11261, 8750}, {11255, 8751},
+    {11251, 8752}, {11250, 8753}, {11247, 8754}, {11223, 8755}, {11254, 8756}, {11226, 8758}, {11218, 8759}, {11217, 8760},
+    {11171, 8761}, {11218, 8763}, {11204, 8764}, {11203, 8767}, {101, 8768}, {11165, 8769}, {11247, 8770}, {11200, 8772},
+    {11152, 8773}, {11207, 8774}, {11208, 8775}, {11203, 8776}, {11200, 8777}, {11207, 8778}, {1662, 8779}, {39, 8780},
+    {11184, 8781}, {1419, 8782}, {11216, 8784}, {11229, 8785}, {11250, 8787}, {2657, 8788}, {638, 8789}, {11150, 8790},
+    {11222, 8800}, {11205, 8803}, {11211, 8802}, {11209, 8805}, {11225, 8807}, {11223, 8805}, {11215, 8809}, {11216, 8812},
+    {11167, 8815}, {11226, 8814}, {11191, 8819}, {11180, 8817}, {11223, 8802}, {11174, 8818}, {11172, 8823}, {11208, 8791},
+    {11209, 8793}, {11179, 8818}, {11171, 8794}, {11206, 8800}, {1218, 8795}, {11211, 8796}, {11185, 8817}, {11172, 8797},
+    {11186, 8817}, {1906, 8798}, {11213, 8799}, {11170, 8806}, {11215, 8808}, {11216, 8810}, {1439, 8811}, {11247, 8754},
+    {11217, 8813}, {11218, 8820}, {11219, 8821}, {11221, 8822}, {11178, 8825}, {11225, 8826}, {1681, 8827}, {11232, 8828},
+    {11186, 8829}, {11238, 8830}, {2224, 8831}, {11196, 8832}, {11226, 8833}, {11155, 8834}, {2023, 8835}, {11145, 8836},
+    {11147, 8837}, {11149, 8838}, {2419, 8839}, {11146, 8840}, {1591, 8841}, {11192, 8844}, {11165, 8845}, {11219, 8847},
+    {11142, 8848}, {11222, 8850}, {11245, 8852}, {11246, 8853}, {11221, 8854}, {11248, 8855}, {11322, 8856}, {11152, 8857},
+    {11250, 8859}, {11158, 8860}, {2329, 8861}, {11162, 8862}, {11156, 8865}, {11159, 8866}, {11166, 8867}, {11202, 8868},
+    {11203, 8869}, {2135, 8870}, {11158, 8871}, {11259, 8872}, {11171, 8873}, {1302, 8874}, {11261, 8875}, {11224, 8876},
+    {11168, 8877}, {11368, 8878}, {11336, 8880}, {2520, 8881}, {11321, 8882}, {11298, 8883}, {1558, 8884}, {11269, 8885},
+    {11324, 8888}, {11325, 8889}, {11356, 8890}, {11338, 8891}, {11364, 8892}, {11368, 8893}, {11362, 8894}, {11346, 8895},
+    {11222, 8824}, {11278, 8896}, {11344, 8897}, {11380, 8898}, {11390, 8899}, {11383, 8900}, {11283, 8901}, {476, 8902},
+    {11373, 8903}, {764, 8904}, {11361, 8905}, {11383, 8906}, {11385, 8908}, {11377, 8909}, {11370, 8910}, {11333, 8911},
+    {11382, 8912}, {11371, 8913}, {11375, 8915}, {11374, 8918}, {11301, 8916}, {11333, 8917}, {1526, 8919}, {11342, 8920},
+    {11342, 8921}, {11299, 8922}, {11332, 8923}, {11349, 8924}, {11330, 8925}, {11383, 8926}, {11357, 8927}, {11340, 8928},
+    {11281, 8929}, {11341, 8930}, {11309, 8931}, {11310, 8932}, {11285, 8933}, {11313, 8934}, {11353, 8935}, {11328, 8936},
+    {11289, 8937}, {11279, 8938}, {11346, 8939}, {2614, 8940}, {11358, 8941}, {11359, 8942}, {11351, 8943}, {11324, 8945},
+    {11342, 8946}, {11337, 8947}, {849, 8948}, {11269, 8949}, {11328, 8951}, {11316, 8952}, {11303, 8953}, {1856, 8954},
+    {11312, 8955}, {11318, 8956}, {11305, 8958}, {11307, 8959}, {733, 8960}, {11312, 8961}, {11337, 8962}, {1820, 8963},
+    {11297, 8964}, {11310, 8965}, {11340, 8966}, {11383, 8967}, {11281, 8968}, {11298, 8969}, {11348, 8932}, {1525, 8970},
+    {11279, 8971}, {11316, 8972}, {11318, 8973}, {2034, 8975}, {11369, 8976}, {11348, 8977}, {11375, 8978}, {11316, 8980},
+    {11272, 8981}, {11319, 8982}, {11305, 8983}, {11327, 8984}, {11314, 8985}, {11319, 8986}, {11319, 8988}, {11305, 8989},
+    {11272, 8990}, {1097, 8991}, {11277, 8992}, {11287, 8994}, {11265, 8995}, {11356, 8996}, {11266, 8997}, {11271, 8998},
+    {11268, 8999}, {11267, 9001}, {11264, 9002}, {312, 9003}, {11273, 9005}, {11187, 8824}, {11313, 9006}, {11349, 9007},
+    {11295, 9008}, {11265, 9010}, {11281, 9011}, {11265, 9013}, {11287, 9014}, {11286, 9015}, {11293, 9016}, {11285, 9017},
+    {11273, 9019}, {11387, 9020}, {11279, 9022}, {11298, 9023}, {11283, 9024}, {11280, 9025}, {11489, 9027}, {11393, 9028},
+    {83, 9029}, {635, 9030}, {11448, 9031}, {2370, 9088}, {11347, 8922}, {11511, 9189}, {11510, 9032}, {11499, 9033},
+    {11268, 8987}, {11377, 9009}, {11507, 9034}, {11490, 9035}, {11497, 9038}, {1640, 9036}, {11500, 9037}, {11440, 9039},
+    {11497, 9040}, {11497, 9041}, {11489, 9042}, {11406, 9043}, {1779, 9044}, {11407, 9045}, {11505, 9046}, {1858, 9047},
+    {2505, 9048}, {11490, 9056}, {11489, 9065}, {11513, 9049}, {11504, 9050}, {11508, 9051}, {11510, 9052}, {11515, 9053},
+    {11461, 9054}, {11425, 9055}, {1772, 9057}, {11517, 9058}, {11510, 9059}, {11457, 9060}, {11513, 9062}, {11418, 9063},
+    {11470, 9064}, {11463, 9066}, {1094, 9067}, {2054, 9068}, {11427, 9069}, {11458, 9072}, {11457, 9077}, {11477, 9070},
+    {11470, 9071}, {11411, 9073}, {11462, 9074}, {11481, 9076}, {11458, 9078}, {11465, 9079}, {11438, 9080}, {11439, 9081},
+    {11475, 9082}, {11441, 9083}, {11400, 9084}, {11484, 9085}, {11469, 9086}, {11407, 9087}, {11460, 9089}, {11458, 9090},
+    {11467, 9091}, {11468, 9092}, {11476, 9093}, {11467, 9094}, {2456, 9095}, {11467, 9096}, {11432, 9097}, {11457, 9098},
+    {11485, 9186}, {11462, 9069}, {11458, 9099}, {11431, 9100}, {11518, 9101}, {570, 9102}, {11461, 9103}, {11432, 9105},
+    {11476, 9186}, {11483, 9186}, {11447, 9106}, {11441, 9107}, {11432, 9108}, {11448, 9110}, {11434, 9111}, {11468, 9112},
+    {11438, 9113}, {11451, 9114}, {11509, 9115}, {11443, 9116}, {11454, 9117}, {11451, 9119}, {11448, 9120}, {11500, 9122},
+    {11446, 9123}, {11453, 9125}, {11453, 9126}, {11427, 9127}, {11447, 9128}, {11443, 9129}, {11435, 9130}, {11435, 9132},
+    {11395, 9133}, {11400, 9134}, {11401, 9135}, {11409, 9138}, {11286, 9009}, {11410, 9139}, {11413, 9140}, {11447, 9141},
+    {11404, 9142}, {11407, 9143}, {11407, 9144}, {11402, 9145}, {11392, 9146}, {11398, 9147}, {11422, 9148}, {11395, 9200},
+    {11402, 9149}, {11427, 9150}, {11310, 8987}, {11408, 9151}, {11460, 9153}, {11619, 9154}, {11409, 9155}, {11622, 9156},
+    {11638, 9157}, {11616, 9158}, {11634, 9159}, {11581, 9160}, {11629, 9161}, {11571, 9162}, {11623, 9163}, {11637, 9164},
+    {11440, 9121}, {11399, 9136}, {11408, 9152}, {11643, 9165}, {11562, 9166}, {11395, 9152}, {11563, 9167}, {11415, 9152},
+    {11622, 9168}, {11561, 9169}, {11616, 9170}, {11564, 9171}, {168, 9172}, {11634, 9173}, {11633, 9174}, {11644, 9175},
+    {11552, 9176}, {11636, 9177}, {11641, 9178}, {11549, 9180}, {2615, 9181}, {11629, 9182}, {11631, 9183}, {11546, 9184},
+    {11413, 9152}, {11394, 9152}, {11592, 9185}, {11591, 9187}, {11545, 9188}, {11585, 9190}, {11621, 9152}, {11606, 9191},
+    {11558, 9192}, {11598, 9193}, {11587, 9194}, {11591, 9196}, {11536, 9197}, {11591, 9198}, {11587, 9199}, {11608, 9202},
+    {11613, 9203}, {11615, 9204}, {2497, 9205}, {11607, 9206}, {11602, 9207}, {2684, 9208}, {1316, 9216}, {11603, 9317},
+    {11529, 9209}, {1211, 9211}, {11615, 9212}, {11590, 9213}, {11547, 9214}, {11611, 9215}, {11606, 9217}, {11604, 9218},
+    {11592, 9219}, {11608, 9221}, {11526, 9222}, {11581, 9223}, {11611, 9224}, {11525, 9225}, {11642, 9226}, {11556, 9227},
+    {11555, 9228}, {11575, 9245}, {11558, 9240}, {11571, 9229}, {11573, 9230}, {11579, 9231}, {11542, 9232}, {11559, 9233},
+    {1584, 9234}, {1966, 9235}, {11579, 9236}, {11560, 9237}, {11559, 9238}, {2311, 9239}, {11558, 9241}, {2156, 9242},
+    {11580, 9243}, {11568, 9244}, {11602, 9246}, {11521, 9247}, {11532, 9248}, {11581, 9249}, {11559, 9250}, {11529, 9251},
+    {11528, 9252}, {11527, 9253}, {11561, 9254}, {11561, 9255}, {11611, 9257}, {11622, 9258}, {11522, 9260}, {11562, 9261},
+    {11578, 9262}, {11611, 9263}, {11527, 9264}, {11536, 9265}, {335, 9266}, {11536, 9268}, {11621, 9269}, {11521, 9270},
+    {11522, 9272}, {11624, 9274}, {11603, 9275}, {11531, 9277}, {11528, 9278}, {11520, 9279}, {11605, 9280}, {625, 9281},
+    {11525, 9276}, {11632, 9282}, {11430, 9121}, {11415, 9136}, {1524, 9283}, {11633, 9284}, {11524, 9285}, {11549, 9286},
+    {11599, 9288}, {11561, 9289}, {11524, 9276}, {11525, 9290}, {11540, 9291}, {11548, 9292}, {2700, 9299}, {11528, 9309},
+    {11535, 9310}, {11545, 9311}, {11535, 9312}, {11536, 9313}, {2198, 9314}, {11757, 9315}, {11552, 9316}, {11748, 9318},
+    {11748, 9319}, {11651, 9320}, {11710, 9323}, {11760, 9324}, {11746, 9325}, {11746, 9326}, {11770, 9327}, {11755, 9328},
+    {11696, 9329}, {11769, 9330}, {11702, 9331}, {11730, 9332}, {11759, 9333}, {11663, 9334}, {11764, 9335}, {11725, 9336},
+    {11745, 9337}, {11668, 9338}, {11669, 9339}, {11746, 9340}, {11749, 9341}, {2450, 9342}, {11761, 9344}, {11718, 9345},
+    {11675, 9346}, {11760, 9348}, {11763, 9349}, {11684, 9350}, {11756, 9351}, {11680, 9352}, {11675, 9353}, {11682, 9354},
+    {11720, 9355}, {11735, 9356}, {11656, 9357}, {11713, 9358}, {11768, 9359}, {1193, 9360}, {11721, 9361}, {11689, 9362},
+    {11743, 9363}, {11691, 9364}, {11723, 9365}, {11693, 9366}, {11723, 9367}, {11720, 9368}, {11730, 9369}, {11713, 9376},
+    {11730, 9384}, {11730, 9385}, {11661, 9371}, {11735, 9372}, {11721, 9373}, {11691, 9374}, {11689, 9375}, {11691, 9377},
+    {11694, 9378}, {11675, 9379}, {1421, 9380}, {11681, 9382}, {11684, 9409}, {11693, 9383}, {2360, 9386}, {11685, 9387},
+    {11667, 9388}, {11834, 9389}, {11732, 9362}, {2196, 9390}, {11695, 9409}, {11682, 9409}, {11686, 9391}, {11680, 9392},
+    {11692, 9419}, {11701, 9393}, {11687, 9394}, {11707, 9395}, {11734, 9364}, {11653, 9396}, {11728, 9366}, {11711, 9397},
+    {11687, 9419}, {11690, 9419}, {2124, 9398}, {11704, 9399}, {11711, 9400}, {11658, 9401}, {11664, 9408}, {11652, 9416},
+    {11709, 9427}, {11648, 9417}, {11654, 9403}, {11654, 9405}, {11678, 9406}, {883, 9407}, {11659, 9434}, {11698, 9410},
+    {11700, 9427}, {11707, 9427}, {11648, 9411}, {11835, 9412}, {11695, 9413}, {11667, 9414}, {11650, 9434}, {11657, 9434},
+    {11763, 9334}, {11832, 9415}, {11649, 9418}, {11677, 9420}, {11833, 9422}, {11838, 9423}, {11665, 9424}, {11839, 9425},
+    {11672, 9426}, {11687, 9428}, {11836, 9429}, {11837, 9430}, {11686, 9431}, {11667, 9432}, {11668, 9451}, {11774, 9433},
+    {11720, 9381}, {11650, 9404}, {11764, 9421}, {11680, 9435}, {11876, 9436}, {11884, 9437}, {11876, 9438}, {11787, 9439},
+    {11903, 9440}, {11880, 9441}, {11889, 9442}, {11884, 9443}, {11856, 9444}, {11877, 9445}, {11853, 9446}, {1518, 9447},
+    {11901, 9448}, {11898, 9449}, {11896, 9450}, {11901, 9452}, {11903, 9453}, {11889, 9454}, {11846, 9455}, {11886, 9456},
+    {11886, 9457}, {1543, 9472}, {11808, 9458}, {11809, 9459}, {11847, 9460}, {11847, 9461}, {2025, 9462}, {11841, 9463},
+    {11901, 9573}, {11898, 9464}, {1015, 9465}, {11857, 9466}, {11805, 9467}, {1792, 9469}, {11855, 9470}, {11817, 9473},
+    {11895, 9573}, {11898, 9573}, {11855, 9474}, {11819, 9475}, {11844, 9476}, {11821, 9478}, {11852, 9480}, {11846, 9497},
+    {11824, 9481}, {11856, 9482}, {11856, 9484}, {11862, 9485}, {11846, 9486}, {11856, 9487}, {11788, 9488}, {11831, 9489},
+    {11850, 9490}, {11864, 9491}, {11854, 9492}, {1715, 9493}, {11870, 9494}, {11871, 9496}, {2786, 9498}, {11871, 9499},
+    {11853, 9500}, {11781, 9501}, {11823, 9502}, {11899, 9503}, {11813, 9505}, {11819, 9506}, {11830, 9507}, {11812, 9508},
+    {11846, 9509}, {11800, 9510}, {11811, 9511}, {11834, 9512}, {11949, 9513}, {11838, 9515}, {11839, 9516}, {11816, 9517},
+    {11814, 9519}, {11814, 9520}, {11814, 9521}, {1102, 9522}, {11825, 9559}, {11963, 9523}, {11808, 9536}, {11814, 9539},
+    {11813, 9543}, {11835, 9553}, {11808, 9557}, {11822, 9524}, {11832, 9559}, {11831, 9559}, {11866, 9525}, {11832, 9526},
+    {2790, 9527}, {11827, 9528}, {11814, 9530}, {11828, 9531}, {11858, 9532}, {11700, 9381}, {11781, 9533}, {11665, 9421},
+    {11806, 9534}, {11801, 9535}, {328, 9537}, {11779, 9538}, {11863, 9540}, {11825, 9541}, {11802, 9542}, {11889, 9544},
+    {10, 9545}, {11797, 9546}, {11891, 9548}, {11668, 9404}, {1713, 9549}, {11797, 9550}, {11783, 9551}, {11797, 9552},
+    {11807, 9554}, {11796, 9555}, {11797, 9556}, {11900, 9558}, {11793, 9560}, {11803, 9561}, {11798, 9562}, {11997, 9563},
+    {11869, 9529}, {12023, 9564}, {12005, 9565}, {11994, 9566}, {12008, 9567}, {12004, 9568}, {12006, 9570}, {12030, 9569},
+    {12008, 9571}, {12027, 9572}, {12005, 9574}, {12003, 9575}, {12027, 9576}, {12006, 9583}, {12025, 9577}, {12007, 9578},
+    {12029, 9578}, {12024, 9579}, {12025, 9580}, {12031, 9581}, {12003, 9582}, {12017, 9584}, {12016, 9585}, {12019, 9586},
+    {12021, 9587}, {12021, 9588}, {12026, 9589}, {12026, 9590}, {12022, 9591}, {11981, 9592}, {12020, 9578}, {11983, 9593},
+    {11979, 9594}, {11978, 9595}, {11981, 9596}, {11941, 9597}, {11932, 9600}, {11977, 9601}, {11996, 9602}, {2327, 9603},
+    {1323, 9604}, {11923, 9605}, {11992, 9606}, {11921, 9607}, {11999, 9608}, {11982, 9609}, {11950, 9610}, {11987, 9611},
+    {11915, 9612}, {11912, 9613}, {11913, 9614}, {11918, 9615}, {11984, 9616}, {11916, 9617}, {11992, 9618}, {12007, 9619},
+    {11996, 9620}, {11977, 9621}, {11990, 9622}, {12003, 9623}, {11977, 9624}, {11979, 9625}, {11981, 9632}, {11943, 9640},
+    {11941, 9641}, {11943, 9627}, {11971, 9628}, {11944, 9629}, {11953, 9630}, {11956, 9631}, {11957, 9633}, {12018, 9634},
+    {11977, 9635}, {11940, 9636}, {12017, 9637}, {11971, 9610}, {12022, 9638}, {11950, 9639}, {11945, 9642}, {11920, 9643},
+    {12090, 9644}, {12091, 9645}, {11956, 9646}, {11966, 9647}, {11947, 9648}, {11917, 9649}, {2589, 9650}, {11987, 9651},
+    {11953, 9652}, {355, 9654}, {11956, 9655}, {11990, 9656}, {11954, 9657}, {11964, 9658}, {11993, 9659}, {11961, 9660},
+    {11961, 9661}, {11955, 9662}, {11953, 9663}, {11963, 9664}, {11947, 9666}, {11796, 9529}, {11908, 9667}, {12002, 9668},
+    {1819, 9669}, {11921, 9670}, {11906, 9671}, {11961, 9672}, {12088, 9673}, {11906, 9674}, {11917, 9675}, {12009, 9676},
+    {11919, 9677}, {11918, 9678}, {11928, 9679}, {11929, 9680}, {11911, 9681}, {11918, 9682}, {11930, 9684}, {12020, 9685},
+    {11906, 9683}, {11983, 9686}, {2481, 9728}, {11928, 9829}, {1670, 9690}, {11911, 9691}, {11924, 9683}, {11943, 9694},
+    {11942, 9696}, {11919, 9697}, {11913, 9698}, {11975, 9699}, {11911, 9700}, {11923, 9701}, {12124, 9702}, {12036, 9704},
+    {12134, 9705}, {12136, 9706}, {12134, 9707}, {12143, 9708}, {12155, 9709}, {2671, 9710}, {12137, 9711}, {12136, 9712},
+    {12115, 9713}, {12045, 9714}, {12141, 9715}, {12047, 9716}, {12130, 9717}, {12146, 9718}, {12072, 9719}, {12156, 9729},
+    {12157, 9748}, {12144, 9720}, {12151, 9721}, {12147, 9722}, {12157, 9723}, {12102, 9724}, {12159, 9725}, {12152, 9726},
+    {12159, 9727}, {12098, 9730}, {12068, 9731}, {461, 9732}, {12151, 9733}, {12058, 9734}, {12100, 9735}, {12066, 9737},
+    {494, 9738}, {12102, 9741}, {12109, 9742}, {12109, 9743}, {12153, 9744}, {12110, 9745}, {12105, 9746}, {12102, 9747},
+    {1572, 9749}, {12074, 9750}, {12101, 9751}, {12124, 9752}, {12097, 9753}, {12122, 9754}, {12099, 9755}, {12113, 9756},
+    {12112, 9757}, {12040, 9758}, {12118, 9759}, {12125, 9760}, {12098, 9761}, {12044, 9762}, {12045, 9763}, {1944, 9764},
+    {1295, 9765}, {12116, 9766}, {12089, 9767}, {12117, 9768}, {12111, 9769}, {12067, 9770}, {12127, 9771}, {68, 9772},
+    {12093, 9773}, {12108, 9774}, {33, 9775}, {12113, 9776}, {12083, 9777}, {12071, 9778}, {413, 9779}, {12153, 9780},
+    {12065, 9781}, {424, 9782}, {12074, 9783}, {12074, 9784}, {12103, 9785}, {662, 9786}, {12077, 9823}, {520, 9787},
+    {12105, 9788}, {12106, 9789}, {12072, 9790}, {2753, 9791}, {12150, 9792}, {12078, 9793}, {12066, 9794}, {12075, 9795},
+    {12095, 9796}, {12218, 9797}, {1817, 9856}, {12085, 9957}, {12119, 9798}, {12130, 9799}, {12121, 9800}, {1146, 9801},
+    {12122, 9802}, {12038, 9804}, {12083, 9957}, {12092, 9957}, {12087, 9805}, {12124, 9806}, {12084, 9808}, {12077, 9810},
+    {12076, 9807}, {12053, 9809}, {12033, 9811}, {12046, 9812}, {12134, 9813}, {12136, 9814}, {12045, 9815}, {12041, 9816},
+    {12036, 9817}, {12083, 9824}, {12057, 9848}, {12045, 9819}, {12042, 9820}, {12063, 9822}, {12062, 9825}, {12032, 9826},
+    {12076, 9828}, {12033, 9830}, {12061, 9831}, {12063, 9832}, {12049, 9833}, {12056, 9834}, {12053, 9835}, {12056, 9836},
+    {12060, 9837}, {12158, 9838}, {12043, 9839}, {12161, 9840}, {12278, 9841}, {12256, 9842}, {12267, 9843}, {12223, 9844},
+    {12266, 9845}, {12275, 9846}, {12168, 9847}, {12169, 9849}, {12208, 9850}, {1268, 9851}, {12264, 9852}, {12259, 9853},
+    {12268, 9854}, {12174, 9855}, {12270, 9857}, {12259, 9858}, {12277, 9859}, {12279, 9860}, {12286, 9861}, {12180, 9862},
+    {12263, 9863}, {12182, 9864}, {12205, 9865}, {12231, 9869}, {12230, 9866}, {12279, 9867}, {12274, 9868}, {12227, 9870},
+    {12280, 9871}, {12283, 9872}, {12191, 9873}, {2475, 9874}, {12192, 9875}, {12228, 9876}, {1827, 9877}, {12246, 9878},
+    {12237, 9879}, {12227, 9880}, {12236, 9881}, {12225, 9882}, {12239, 9883}, {12225, 9884}, {12251, 9885}, {12202, 9886},
+    {12229, 9887}, {12255, 9888}, {12249, 9889}, {2802, 9890}, {12243, 9891}, {12225, 9906}, {12174, 9892}, {12231, 9893},
+    {12239, 9927}, {12255, 9894}, {12254, 9895}, {12160, 9896}, {12233, 9897}, {12242, 9898}, {12243, 9899}, {12164, 9900},
+    {12230, 9927}, {12244, 9927}, {12247, 9901}, {12212, 9902}, {12198, 9905}, {12346, 9904}, {12205, 9907}, {12203, 9908},
+    {12207, 9903}, {12185, 9909}, {12244, 9886}, {12198, 9911}, {12196, 9912}, {12203, 9913}, {12206, 9914}, {12347, 9915},
+    {12194, 9916}, {12200, 9917}, {12192, 9918}, {12193, 9919}, {12213, 9920}, {12221, 9921}, {12214, 9903}, {12192, 9922},
+    {12210, 9923}, {12196, 9924}, {12217, 9925}, {12212, 9926}, {12213, 9928}, {12216, 9929}, {12209, 9930}, {12209, 9931},
+    {12178, 9932}, {12175, 9933}, {12172, 9934}, {12171, 9935}, {12161, 9936}, {12168, 9937}, {12168, 9938}, {12167, 9939},
+    {12163, 9940}, {12269, 9941}, {1038, 9942}, {12171, 9943}, {12164, 9944}, {12181, 9945}, {12169, 9937}, {12183, 9946},
+    {12191, 9947}, {12160, 9948}, {12167, 9949}, {12179, 9950}, {12169, 9937}, {12171, 9937}, {2689, 9952}, {12191, 9953},
+    {12231, 9910}, {12182, 9954}, {12189, 9955}, {12190, 9956}, {12184, 9958}, {12177, 9959}, {12177, 9960}, {12287, 9961},
+    {12397, 9962}, {348, 9963}, {12401, 9964}, {12392, 9966}, {1384, 9968}, {1450, 9969}, {12394, 9970}, {1074, 9971},
+    {12412, 9972}, {12387, 9973}, {12393, 9974}, {12384, 9975}, {12336, 9976}, {12299, 9978}, {12392, 9979}, {2401, 9980},
+    {12409, 9982}, {12394, 9983}, {12396, 9984}, {12412, 9985}, {12413, 9986}, {12407, 10047}, {12384, 9987}, {12410, 9988},
+    {12399, 9989}, {12414, 9990}, {12333, 9991}, {1914, 9992}, {12407, 9993}, {12323, 9994}, {12394, 9995}, {12315, 9997},
+    {12393, 9998}, {12402, 9999}, {12318, 10000}, {12414, 10001}, {12371, 10002}, {12352, 10003}, {12359, 10004}, {12358, 10005},
+    {1907, 10008}, {12369, 10010}, {12363, 10011}, {12404, 10012}, {12327, 10015}, {12365, 10016}, {12357, 10035}, {12365, 10017},
+    {12383, 10018}, {12363, 10028}, {12366, 10019}, {12354, 10021}, {12362, 10020}, {12373, 10022}, {12357, 10023}, {12378, 10025},
+    {12356, 10024}, {12358, 10040}, {12354, 10038}, {12383, 10027}, {12381, 10026}, {12363, 10029}, {12377, 10033}, {12381, 10030},
+    {1658, 10031}, {1152, 10032}, {12371, 10034}, {957, 10037}, {12375, 10039}, {2809, 10042}, {12382, 10043}, {111, 10044},
+    {274, 10045}, {1930, 10048}, {1319, 10049}, {2251, 10050}, {12364, 10029}, {294, 10051}, {742, 10112}, {12321, 10213},
+    {12334, 10052}, {1250, 10053}, {12356, 10055}, {12324, 10056}, {12358, 10057}, {12329, 10059}, {12327, 10213}, {12328, 10213},
+    {12360, 10060}, {12320, 10061}, {12309, 10063}, {12351, 10064}, {12345, 10065}, {12212, 9910}, {12322, 10067}, {12314, 10069},
+    {12326, 10070}, {12368, 10071}, {12336, 10072}, {12396, 10024}, {12370, 10073}, {820, 10074}, {1131, 10075}, {12371, 10076},
+    {1453, 10077}, {12396, 10079}, {1016, 10080}, {12397, 10081}, {12386, 10083}, {12343, 10084}, {12384, 10085}, {12346, 10086},
+    {12382, 10087}, {12383, 10088}, {12293, 10090}, {877, 10091}, {12335, 10092}, {145, 10094}, {12349, 10095}, {12357, 10096},
+    {12372, 10078}, {12292, 10097}, {12294, 10098}, {12392, 10100}, {12342, 10101}, {479, 10103}, {12394, 10104}, {12395, 10105},
+    {12291, 10106}, {12312, 10107}, {12372, 10108}, {12288, 10109}, {12311, 10110}, {12344, 10111}, {2208, 10113}, {12343, 10114},
+    {12316, 10115}, {12314, 10116}, {12294, 10117}, {1733, 10118}, {12364, 10120}, {12290, 10122}, {12298, 10123}, {12317, 10124},
+    {12313, 10125}, {12304, 10126}, {12303, 10127}, {12461, 10128}, {12316, 10129}, {12311, 10130}, {12318, 10131}, {12417, 10132},
+    {12528, 10133}, {12535, 10135}, {12478, 10136}, {2361, 10137}, {12524, 10236}, {12517, 10138}, {12477, 10139}, {12503, 10140},
+    {12517, 10141}, {12542, 10142}, {12522, 10143}, {12428, 10144}, {12538, 10145}, {1691, 10146}, {1301, 10147}, {12433, 10148},
+    {12527, 10182}, {1089, 10149}, {12539, 10150}, {12536, 10151}, {12528, 10152}, {12438, 10153}, {12530, 10154}, {12533, 10156},
+    {12518, 10182}, {12533, 10182}, {12536, 10157}, {12543, 10158}, {1462, 10159}, {12449, 10160}, {12532, 10161}, {12446, 10163},
+    {938, 10164}, {12530, 10165}, {12543, 10166}, {12494, 10168}, {12502, 10169}, {12482, 10170}, {12518, 10152}, {12446, 10171},
+    {12447, 10173}, {114, 10174}, {12483, 10176}, {12445, 10177}, {2146, 10178}, {12456, 10179}, {12506, 10180}, {12423, 10181},
+    {12504, 10184}, {12531, 10185}, {12530, 10186}, {12462, 10188}, {1481, 10189}, {12463, 10190}, {12483, 10191}, {12481, 10192},
+    {12485, 10193}, {12508, 10194}, {12430, 10195}, {12507, 10196}, {12511, 10197}, {12498, 10354}, {12500, 10198}, {12510, 10199},
+    {12502, 10240}, {12507, 10200}, {12499, 10202}, {12420, 10203}, {12421, 10204}, {12337, 10078}, {12480, 10205}, {12539, 10206},
+    {12497, 10240}, {12465, 10207}, {12537, 10208}, {12459, 10209}, {12461, 10210}, {12602, 10212}, {12448, 10214}, {12487, 10215},
+    {12464, 10216}, {61, 10241}, {12448, 10340}, {12473, 10217}, {12473, 10218}, {12452, 10219}, {12478, 10220}, {12477, 10221},
+    {12533, 10222}, {12465, 10223}, {12478, 10224}, {968, 10225}, {12473, 10226}, {12448, 10227}, {12588, 10228}, {12455, 10229},
+    {12455, 10230}, {400, 10231}, {12502, 10234}, {12424, 10237}, {12477, 10238}, {12478, 10239}, {12466, 10242}, {12462, 10243},
+    {12462, 10244}, {12460, 10246}, {12511, 10247}, {12431, 10248}, {12429, 10249}, {12427, 10250}, {1946, 10251}, {2421, 10253},
+    {12438, 10254}, {12429, 10257}, {12426, 10250}, {12418, 10250}, {12436, 10258}, {12420, 10259}, {12424, 10260}, {12431, 10261},
+    {12600, 10262}, {12440, 10263}, {12447, 10264}, {12525, 10265}, {12419, 10267}, {12440, 10268}, {12440, 10269}, {12432, 10270},
+    {12531, 10271}, {12442, 10272}, {12495, 10273}, {2088, 10276}, {12419, 10305}, {12434, 10277}, {12427, 10278}, {12445, 10279},
+    {12443, 10280}, {12539, 10281}, {12486, 10282}, {12444, 10283}, {12443, 10284}, {12448, 10285}, {2488, 10286}, {1418, 10287},
+    {12651, 10288}, {1887, 10289}, {12548, 10290}, {12651, 10291}, {12604, 10292}, {12551, 10293}, {12653, 10294}, {12650, 10295},
+    {12670, 10296}, {12664, 10297}, {12648, 10298}, {12664, 10299}, {12668, 10304}, {12648, 10312}, {12660, 10313}, {12587, 10301},
+    {12621, 10302}, {1940, 10303}, {1432, 10306}, {12620, 10307}, {12564, 10308}, {1291, 10310}, {12666, 10311}, {12665, 10314},
+    {12616, 10315}, {12661, 10316}, {12651, 10317}, {12648, 10318}, {382, 10319}, {12670, 10320}, {12648, 10321}, {12573, 10322},
+    {12667, 10323}, {12667, 10324}, {12622, 10325}, {12616, 10326}, {12611, 10368}, {12623, 10482}, {12581, 10327}, {12628, 10328},
+    {12611, 10329}, {12663, 10330}, {12563, 10331}, {12613, 10332}, {12618, 10368}, {12561, 10333}, {12619, 10334}, {12628, 10335},
+    {12610, 10336}, {12609, 10337}, {12633, 10338}, {12624, 10369}, {12632, 10483}, {12636, 10339}, {12624, 10341}, {12627, 10342},
+    {12589, 10343}, {12630, 10344}, {12619, 10345}, {12635, 10369}, {12625, 10346}, {12645, 10347}, {12636, 10348}, {12626, 10349},
+    {12634, 10350}, {12624, 10370}, {12581, 10375}, {12582, 10373}, {12589, 10392}, {12638, 10370}, {12579, 10393}, {12564, 10351},
+    {12588, 10375}, {12583, 10352}, {12585, 10392}, {12586, 10393}, {12606, 10353}, {12717, 10355}, {12622, 10356}, {12556, 10358},
+    {12585, 10398}, {12576, 10357}, {12555, 10359}, {12577, 10360}, {12601, 10357}, {12553, 10361}, {12600, 10362}, {12632, 10363},
+    {12643, 10364}, {12634, 10365}, {12580, 10398}, {12641, 10366}, {12647, 10367}, {12588, 10398}, {12592, 10357}, {12644, 10371},
+    {12639, 10372}, {12640, 10374}, {12558, 10376}, {12642, 10377}, {12605, 10357}, {12554, 10378}, {12644, 10379}, {12564, 10381},
+    {12572, 10382}, {12627, 10383}, {12650, 10384}, {12552, 10385}, {12630, 10386}, {1668, 10387}, {12631, 10389}, {12573, 10390},
+    {12655, 10391}, {12574, 10394}, {12619, 10395}, {12658, 10396}, {12550, 10397}, {12731, 10399}, {676, 10400}, {12563, 10401},
+    {12575, 10402}, {12621, 10403}, {12664, 10404}, {12566, 10405}, {12569, 10406}, {12553, 10407}, {12614, 10408}, {12615, 10409},
+    {12577, 10411}, {12570, 10412}, {12769, 10415}, {12675, 10416}, {12781, 10418}, {12782, 10419}, {12770, 10420}, {12771, 10421},
+    {12782, 10422}, {12783, 10423}, {12721, 10424}, {12781, 10425}, {12685, 10426}, {748, 10427}, {12725, 10428}, {12688, 10429},
+    {12689, 10430}, {12712, 10431}, {12784, 10432}, {12747, 10433}, {12788, 10420}, {12784, 10434}, {12799, 10435}, {12771, 10436},
+    {12787, 10437}, {12778, 10438}, {12727, 10439}, {12786, 10442}, {12782, 10442}, {12711, 10443}, {12784, 10444}, {12796, 10446},
+    {12799, 10448}, {12757, 10449}, {830, 10450}, {12745, 10452}, {12746, 10453}, {12793, 10454}, {12738, 10455}, {12747, 10456},
+    {12762, 10457}, {12742, 10458}, {12738, 10459}, {448, 10460}, {12716, 10461}, {12766, 10462}, {12764, 10463}, {12693, 10464},
+    {12752, 10451}, {12720, 10465}, {12683, 10466}, {12680, 10467}, {12737, 10469}, {1579, 10470}, {12686, 10471}, {12687, 10472},
+    {790, 10473}, {12726, 10474}, {12761, 10480}, {12748, 10490}, {12760, 10475}, {12672, 10476}, {12751, 10477}, {12732, 10478},
+    {1652, 10481}, {331, 10485}, {12760, 10486}, {12746, 10451}, {12752, 10487}, {12735, 10488}, {12716, 10489}, {12722, 10491},
+    {12721, 10492}, {12721, 10493}, {12717, 10495}, {12698, 10496}, {12724, 10497}, {12797, 10498}, {12786, 10499}, {12717, 10502},
+    {12712, 10501}, {12858, 10503}, {12713, 10504}, {2426, 10505}, {12749, 10506}, {12730, 10507}, {12710, 10508}, {12687, 10509},
+    {12685, 10510}, {12710, 10511}, {12756, 10512}, {12732, 10513}, {12758, 10514}, {12721, 10515}, {12714, 10516}, {2016, 10517},
+    {12719, 10608}, {12769, 10518}, {12734, 10519}, {12775, 10520}, {1332, 10521}, {1395, 10522}, {12721, 10523}, {12732, 10524},
+    {12686, 10526}, {12682, 10527}, {12709, 10501}, {557, 10528}, {12679, 10529}, {12676, 10530}, {12773, 10531}, {12690, 10532},
+    {197, 10533}, {12775, 10534}, {2216, 10535}, {12672, 10536}, {12673, 10537}, {12692, 10538}, {12672, 10539}, {12681, 10540},
+    {12672, 10542}, {1986, 10543}, {12672, 10544}, {2181, 10545}, {12710, 10546}, {2310, 10547}, {12690, 10548}, {12859, 10549},
+    {12686, 10570}, {12683, 10550}, {12692, 10580}, {12905, 10551}, {12698, 10582}, {12907, 10552}, {12909, 10553}, {12805, 10554},
+    {12696, 10570}, {12694, 10570}, {12703, 10580}, {12690, 10580}, {12693, 10582}, {12696, 10582}, {12905, 10555}, {12909, 10556},
+    {12886, 10557}, {12926, 10558}, {12926, 10559}, {12901, 10560}, {12922, 10561}, {12898, 10564}, {12918, 10572}, {12918, 10573},
+    {2119, 10624}, {12898, 10563}, {12845, 10565}, {12927, 10567}, {12913, 10568}, {12905, 10576}, {12922, 10584}, {12922, 10585},
+    {12914, 10725}, {12912, 10574}, {12898, 10554}, {12926, 10575}, {12878, 10577}, {12874, 10578}, {12893, 10579}, {12696, 10538},
+    {12925, 10725}, {12912, 10725}, {12873, 10581}, {12873, 10583}, {12885, 10592}, {12877, 10600}, {12879, 10601}, {12822, 10587},
+    {12890, 10588}, {12871, 10589}, {12868, 10590}, {12888, 10591}, {12888, 10593}, {12808, 10594}, {12882, 10625}, {12894, 10739},
+    {12905, 10595}, {12888, 10596}, {12874, 10598}, {12894, 10606}, {12894, 10607}, {12840, 10599}, {12893, 10625}, {12893, 10602},
+    {12885, 10604}, {12881, 10605}, {12853, 10610}, {12836, 10611}, {1414, 10626}, {12836, 10727}, {12986, 10614}, {12854, 10616},
+    {12859, 10617}, {12842, 10620}, {12815, 10621}, {12801, 10622}, {12834, 10727}, {12847, 10727}, {2445, 10623}, {12805, 10627},
+    {12826, 10569}, {12860, 10603}, {12863, 10609}, {12872, 10612}, {12878, 10613}, {12879, 10615}, {12885, 10618}, {12886, 10619},
+    {12804, 10628}, {12886, 10629}, {12887, 10630}, {2269, 10631}, {12849, 10632}, {12885, 10633}, {12828, 10635}, {12807, 10636},
+    {12802, 10634}, {12842, 10637}, {12802, 10638}, {12825, 10640}, {12831, 10641}, {12867, 10642}, {12837, 10643}, {12815, 10644},
+    {12809, 10645}, {12814, 10646}, {12833, 10647}, {12818, 10648}, {13043, 10656}, {12820, 10634}, {13029, 10664}, {13031, 10665},
+    {2366, 10650}, {1385, 10651}, {13046, 10652}, {13028, 10653}, {12988, 10655}, {13025, 10657}, {13025, 10659}, {12937, 10660},
+    {13013, 10662}, {2407, 10663}, {13049, 10666}, {2546, 10667}, {13033, 10668}, {807, 10669}, {13025, 10670}, {13026, 10671},
+    {794, 10672}, {12981, 10673}, {13055, 10674}, {12971, 10675}, {13047, 10676}, {13025, 10677}, {12948, 10678}, {2071, 10679},
+    {13053, 10680}, {13044, 10681}, {12962, 10682}, {12963, 10684}, {13055, 10685}, {13038, 10687}, {13034, 10688}, {12959, 10689},
+    {12995, 10690}, {12961, 10691}, {12952, 10692}, {13004, 10693}, {13051, 10694}, {13003, 10695}, {738, 10696}, {13009, 10697},
+    {13006, 10698}, {12995, 10699}, {12994, 10701}, {12945, 10702}, {12997, 10703}, {13042, 10704}, {13018, 10705}, {13018, 10706},
+    {12995, 10708}, {13013, 10716}, {13015, 10717}, {13041, 10678}, {13017, 10710}, {12941, 10711}, {13005, 10712}, {13011, 10713},
+    {13010, 10714}, {13015, 10715}, {1298, 10718}, {13012, 10719}, {12972, 10721}, {354, 10752}, {12955, 10722}, {13055, 10723},
+    {12848, 10615}, {12854, 10613}, {12806, 10619}, {12804, 10618}, {12838, 10603}, {12868, 10569}, {12852, 10612}, {12832, 10609},
+    {12998, 10724}, {12962, 10726}, {13042, 10728}, {12972, 10729}, {12985, 10731}, {13003, 10732}, {12985, 10733}, {12991, 10734},
+    {12960, 10853}, {1931, 10735}, {12971, 10737}, {337, 10738}, {12987, 10741}, {13034, 10742}, {12980, 10743}, {12987, 10744},
+    {12971, 10853}, {12966, 10853}, {12967, 10745}, {13038, 10746}, {1433, 10747}, {13039, 10748}, {13036, 10749}, {12985, 10750},
+    {13012, 10700}, {12980, 10709}, {12987, 10751}, {12982, 10753}, {12969, 10754}, {12986, 10755}, {12986, 10756}, {12983, 10757},
+    {12984, 10758}, {12936, 10759}, {12936, 10760}, {12931, 10761}, {12938, 10762}, {12943, 10763}, {12949, 10764}, {12934, 10765},
+    {12935, 10766}, {12942, 10782}, {12959, 10768}, {12937, 10767}, {12932, 10769}, {12935, 10770}, {12929, 10771}, {12945, 10772},
+    {12959, 10773}, {12956, 10774}, {12957, 10775}, {12947, 10776}, {12955, 10777}, {12945, 10778}, {12958, 10779}, {12950, 10780},
+    {12944, 10781}, {12957, 10783}, {12949, 10784}, {12946, 10785}, {12947, 10786}, {368, 10787}, {13054, 10788}, {12955, 10789},
+    {13161, 10790}, {13057, 10793}, {13169, 10794}, {13059, 10795}, {13153, 10796}, {13152, 10797}, {737, 10798}, {13167, 10827},
+    {13154, 10799}, {13064, 10800}, {13065, 10801}, {13066, 10802}, {13067, 10803}, {13182, 10804}, {13069, 10805}, {13178, 10806},
+    {13161, 10807}, {13098, 10808}, {13099, 10809}, {13171, 10810}, {13152, 10811}, {13131, 10812}, {13176, 10813}, {13181, 10814},
+    {13183, 10815}, {13169, 10816}, {13091, 10817}, {1933, 10818}, {13183, 10819}, {13089, 10820}, {13177, 10821}, {13174, 10822},
+    {13086, 10823}, {2604, 10824}, {13093, 10825}, {13088, 10826}, {13089, 10828}, {13129, 10829}, {13081, 10830}, {13131, 10831},
+    {13147, 10834}, {13127, 10835}, {13127, 10836}, {1227, 10839}, {13079, 10840}, {13151, 10842}, {1313, 10843}, {13165, 10844},
+    {13146, 10845}, {1847, 10846}, {13137, 10847}, {13143, 10848}, {13144, 10849}, {13138, 10850}, {13128, 10851}, {13140, 10852},
+    {13130, 10837}, {13149, 10854}, {2304, 10855}, {13063, 10857}, {13009, 10709}, {13153, 10858}, {13149, 10859}, {13110, 10861},
+    {13111, 10862}, {2006, 10863}, {13110, 10864}, {13106, 10865}, {13091, 10866}, {13103, 10867}, {13094, 10868}, {13093, 10869},
+    {13118, 10872}, {13169, 10878}, {13018, 10700}, {13097, 10870}, {1192, 10871}, {13133, 10873}, {13114, 10875}, {13102, 10877},
+    {13117, 10879}, {13090, 10880}, {13123, 10837}, {13069, 10881}, {13118, 10882}, {13140, 10883}, {13167, 10884}, {13113, 10885},
+    {13093, 10832}, {13095, 10833}, {13120, 10860}, {13112, 10886}, {2464, 10887}, {13117, 10888}, {13116, 10889}, {13096, 10890},
+    {13096, 10891}, {13096, 10892}, {13110, 10894}, {13115, 10895}, {13111, 10896}, {744, 10897}, {13067, 10898}, {706, 10899},
+    {13070, 10900}, {13063, 10901}, {13155, 10902}, {13075, 10903}, {13065, 10904}, {13148, 10905}, {13065, 10906}, {13057, 10907},
+    {13110, 10908}, {13068, 10909}, {13242, 10910}, {13070, 10911}, {13065, 10912}, {13056, 10913}, {13166, 10914}, {13056, 10916},
+    {13169, 10917}, {13075, 10918}, {2086, 10919}, {13074, 10921}, {13080, 10922}, {13098, 10923}, {13056, 10924}, {13058, 10925},
+    {13086, 10926}, {13076, 10927}, {1007, 10929}, {13080, 10930}, {13084, 10931}, {13124, 10932}, {13062, 10933}, {13243, 10934},
+    {13294, 10935}, {13280, 10936}, {13188, 10937}, {13302, 10938}, {13282, 10939}, {13291, 10940}, {13192, 10941}, {13193, 10942},
+    {13295, 10945}, {1698, 10946}, {13307, 10947}, {13294, 10948}, {13300, 10950}, {344, 10952}, {13261, 10953}, {13225, 10955},
+    {13281, 10949}, {13301, 10956}, {13281, 10957}, {13206, 10959}, {13298, 10960}, {13293, 10962}, {13308, 10963}, {2314, 10964},
+    {13305, 10966}, {1866, 10968}, {1545, 10969}, {13296, 10970}, {13212, 10972}, {13304, 10973}, {13297, 10974}, {13295, 10949},
+    {13309, 10949}, {13294, 10949}, {13221, 10975}, {13263, 10976}, {13265, 10979}, {13251, 10987}, {13249, 10986}, {2039, 10980},
+    {13222, 10981}, {59, 10982}, {2412, 10984}, {13260, 10988}, {1937, 10989}, {13250, 10990}, {13253, 10991}, {13277, 10992},
+    {13259, 10985}, {13270, 10993}, {13276, 10994}, {13268, 10995}, {13140, 10833}, {13122, 10832}, {176, 10996}, {13090, 10860},
+    {661, 10997}, {13275, 10998}, {13272, 10999}, {13272, 11000}, {13266, 11001}, {13278, 11002}, {13266, 11003}, {13186, 11004},
+    {13262, 11005}, {13261, 11006}, {13268, 11007}, {13274, 11008}, {13277, 10985}, {13266, 11009}, {13281, 11010}, {13259, 11011},
+    {13237, 11012}, {13223, 11013}, {13222, 11014}, {13076, 10914}, {13370, 11015}, {13305, 11016}, {2744, 11017}, {13217, 11018},
+    {13217, 10977}, {2402, 11019}, {13216, 11020}, {13219, 11021}, {13234, 11022}, {13256, 11023}, {13222, 11024}, {13296, 11025},
+    {767, 11026}, {1253, 11027}, {13259, 11028}, {13225, 11030}, {13240, 11031}, {13229, 11032}, {13, 11033}, {13245, 11034},
+    {13224, 11035}, {13197, 11036}, {13289, 11037}, {13237, 11038}, {787, 11039}, {13295, 11040}, {2772, 11041}, {13270, 11042},
+    {13236, 11043}, {13225, 11044}, {13356, 11045}, {13236, 11046}, {13231, 11047}, {13186, 11048}, {13228, 11049}, {933, 11050},
+    {2428, 11052}, {13368, 11053}, {13369, 11055}, {13246, 11056}, {13374, 11057}, {13198, 11058}, {13375, 11059}, {13188, 11060},
+    {13196, 11061}, {13206, 11062}, {2623, 11063}, {13199, 11064}, {13186, 11065}, {13187, 11066}, {13209, 11072}, {13195, 11080},
+    {13189, 11090}, {13193, 11081}, {13186, 11068}, {13206, 11069}, {13296, 11070}, {13372, 11071}, {13205, 11073}, {13213, 11074},
+    {13199, 11090}, {13186, 11090}, {13300, 11075}, {13212, 11076}, {13201, 11077}, {13200, 11078}, {13306, 11079}, {13220, 11082},
+    {13193, 11083}, {13192, 11088}, {13201, 11102}, {13214, 11084}, {13415, 11086}, {13421, 11087}, {13432, 11089}, {2435, 11136},
+    {13435, 11091}, {13371, 11092}, {13434, 11093}, {13387, 11094}, {13437, 11096}, {13380, 11097}, {13435, 11098}, {13434, 11099},
+    {13421, 11237}, {13205, 11070}, {13439, 11100}, {13382, 11101}, {13387, 11103}, {13386, 11104}, {13342, 11105}, {13393, 11106},
+    {13412, 11237}, {13428, 11237}, {13377, 11107}, {13411, 11079}, {13385, 11108}, {13402, 11109}, {13381, 11110}, {13389, 11111},
+    {13390, 11112}, {13387, 11113}, {13386, 11114}, {13387, 11115}, {13322, 11116}, {13254, 10977}, {13406, 11132}, {13405, 11133},
+    {13383, 11126}, {13402, 11117}, {13376, 11118}, {13407, 11119}, {13400, 11120}, {727, 11121}, {13314, 11123}, {13236, 11028},
+    {13315, 11124}, {13312, 11125}, {13313, 11127}, {13401, 11128}, {13319, 11129}, {13403, 11130}, {13317, 11131}, {13343, 11135},
+    {13350, 11137}, {13346, 11138}, {13349, 11139}, {13405, 11115}, {13348, 11140}, {13353, 11141}, {13352, 11142}, {2528, 11143},
+    {13320, 11085}, {13333, 11095}, {13353, 11144}, {13355, 11146}, {13355, 11147}, {13348, 11150}, {13353, 11152}, {13431, 11153},
+    {13344, 11154}, {13345, 11155}, {13392, 11156}, {629, 11157}, {13346, 11158}, {13370, 11160}, {13344, 11161}, {13365, 11162},
+    {13369, 11163}, {13367, 11164}, {13362, 11165}, {13364, 11166}, {13374, 11167}, {13371, 11168}, {13370, 11169}, {13404, 11170},
+    {13364, 11172}, {13406, 11173}, {13335, 11174}, {1571, 11175}, {13313, 11176}, {13319, 11177}, {2094, 11178}, {13316, 11179},
+    {13393, 11180}, {13398, 11181}, {13342, 11182}, {13340, 11183}, {13397, 11185}, {13329, 11186}, {13358, 11187}, {759, 11188},
+    {13314, 11189}, {13341, 11190}, {13332, 11191}, {13338, 11192}, {13317, 11193}, {13335, 11194}, {13322, 11195}, {13349, 11196},
+    {13348, 11197}, {13332, 11198}, {13340, 11200}, {13336, 11243}, {13344, 11199}, {13545, 11201}, {13534, 11202}, {13547, 11203},
+    {13553, 11204}, {13537, 11205}, {13548, 11220}, {13545, 11206}, {13545, 11207}, {13490, 11210}, {13543, 11212}, {13540, 11214},
+    {13561, 11223}, {13547, 11231}, {13545, 11230}, {13551, 11224}, {1539, 11226}, {13493, 11227}, {763, 11228}, {13556, 11229},
+    {541, 11232}, {13552, 11233}, {13537, 11234}, {13516, 11235}, {13561, 11236}, {13562, 11238}, {13555, 11239}, {13561, 11240},
+    {1191, 11241}, {13558, 11242}, {414, 11244}, {2041, 11247}, {1063, 11264}, {13560, 11365}, {13468, 11249}, {13469, 11251},
+    {13470, 11252}, {13563, 11253}, {13472, 11254}, {13566, 11255}, {13566, 11365}, {13555, 11365}, {1334, 11256}, {1882, 11257},
+    {13519, 11258}, {13510, 11260}, {13545, 11262}, {13562, 11263}, {13427, 11095}, {13428, 11085}, {13507, 11265}, {13513, 11266},
+    {611, 11267}, {13560, 11268}, {2214, 11270}, {1219, 11271}, {13515, 11272}, {13508, 11273}, {13483, 11274}, {13535, 11275},
+    {13554, 11276}, {13533, 11277}, {13506, 11279}, {13533, 11280}, {13506, 11281}, {13448, 11282}, {13491, 11284}, {13530, 11285},
+    {13524, 11286}, {13527, 11287}, {13532, 11288}, {13521, 11289}, {13522, 11290}, {13506, 11292}, {13514, 11293}, {13519, 11294},
+    {13476, 11291}, {673, 11295}, {13444, 11296}, {13533, 11297}, {13505, 11298}, {13494, 11300}, {13478, 11301}, {13508, 11302},
+    {13490, 11303}, {13481, 11304}, {13474, 11305}, {13482, 11306}, {2439, 11307}, {13552, 11308}, {13497, 11312}, {13483, 11320},
+    {13481, 11321}, {458, 11311}, {13472, 11314}, {13478, 11315}, {13489, 11316}, {13497, 11334}, {2441, 11317}, {13483, 11318},
+    {13550, 11319}, {13489, 11322}, {13548, 11323}, {13527, 11325}, {13496, 11316}, {13484, 11326}, {1760, 11327}, {13499, 11329},
+    {13485, 11330}, {13493, 11331}, {13542, 11332}, {13486, 11333}, {13534, 11335}, {13535, 11336}, {13530, 11338}, {13537, 11339},
+    {1398, 11341}, {13459, 11342}, {13456, 11343}, {13460, 11344}, {13444, 11345}, {13450, 11346}, {754, 11347}, {1333, 11349},
+    {13522, 11350}, {13446, 11351}, {13520, 11352}, {13444, 11353}, {13548, 11354}, {13490, 11355}, {13440, 11356}, {13469, 11360},
+    {13463, 11368}, {13464, 11357}, {13461, 11358}, {13466, 11359}, {13468, 11361}, {13519, 11362}, {13558, 11363}, {13559, 11364},
+    {1223, 11366}, {13560, 11367}, {13453, 11369}, {13563, 11370}, {13449, 11371}, {13457, 11372}, {13677, 11374}, {983, 11375},
+    {13624, 11376}, {13685, 11378}, {13665, 11379}, {13631, 11380}, {13657, 11381}, {13678, 11382}, {13667, 11383}, {13579, 11384},
+    {13675, 11385}, {13664, 11386}, {13671, 11388}, {13668, 11389}, {13665, 11391}, {13609, 11392}, {818, 11394}, {13680, 11395},
+    {13463, 11343}, {13615, 11396}, {13669, 11397}, {13691, 11398}, {13638, 11399}, {13673, 11400}, {13679, 11401}, {2237, 11402},
+    {13668, 11403}, {13681, 11404}, {13689, 11405}, {13686, 11411}, {13647, 11410}, {13650, 11408}, {13592, 11409}, {13638, 11412},
+    {13598, 11413}, {13638, 11414}, {13596, 11415}, {13587, 11417}, {13662, 11418}, {2231, 11419}, {13659, 11420}, {13637, 11421},
+    {13640, 11422}, {13645, 11423}, {13513, 11291}, {2063, 11424}, {13589, 11425}, {13616, 11426}, {13637, 11428}, {13632, 11429},
+    {13577, 11430}, {13639, 11431}, {13654, 11432}, {1546, 11433}, {13622, 11434}, {13632, 11435}, {13570, 11436}, {13613, 11437},
+    {13567, 11373}, {13684, 11390}, {13607, 11416}, {13656, 11440}, {2429, 11442}, {13663, 11443}, {13627, 11444}, {2332, 11445},
+    {13657, 11446}, {13654, 11447}, {13649, 11448}, {13658, 11449}, {13691, 11450}, {13622, 11451}, {13608, 11452}, {13612, 11453},
+    {13612, 11454}, {13638, 11455}, {13606, 11456}, {13614, 11459}, {688, 11460}, {13629, 11462}, {13603, 11463}, {13607, 11464},
+    {13613, 11465}, {13602, 11466}, {13628, 11467}, {13584, 11469}, {13604, 11470}, {2065, 11471}, {13675, 11472}, {13672, 11473},
+    {13580, 11474}, {13626, 11475}, {13607, 11476}, {13617, 11484}, {13630, 11477}, {1649, 11478}, {13617, 11479}, {13574, 11480},
+    {13626, 11481}, {13660, 11482}, {13630, 11483}, {13662, 11485}, {13669, 11486}, {13658, 11487}, {13582, 11488}, {13629, 11489},
+    {13581, 11490}, {13590, 11491}, {13570, 11499}, {13583, 11492}, {13624, 11493}, {13650, 11494}, {13580, 11495}, {13576, 11497},
+    {13598, 11498}, {13617, 11500}, {13582, 11501}, {13615, 11502}, {13590, 11503}, {13640, 11504}, {13591, 11505}, {13584, 11509},
+    {13579, 11496}, {13596, 11506}, {13593, 11512}, {13593, 11507}, {13579, 11508}, {13589, 11514}, {13595, 11510}, {13593, 11515},
+    {13582, 11520}, {13583, 11533}, {13593, 11530}, {13586, 11511}, {13801, 11513}, {13802, 11516}, {2197, 11518}, {13821, 11521},
+    {13815, 11524}, {13800, 11534}, {13802, 11540}, {13802, 11519}, {13803, 11522}, {13823, 11523}, {13806, 11525}, {13792, 11526},
+    {1923, 11527}, {13711, 11528}, {497, 11529}, {13712, 11531}, {13598, 11496}, {13713, 11532}, {13714, 11535}, {306, 11536},
+    {1469, 11537}, {13793, 11538}, {1949, 11539}, {13799, 11541}, {2281, 11542}, {13668, 11373}, {13770, 11543}, {13663, 11416},
+    {13822, 11544}, {13719, 11545}, {1406, 11546}, {13811, 11547}, {13721, 11548}, {13722, 11550}, {13729, 11551}, {2458, 11552},
+    {13819, 11553}, {13726, 11554}, {64, 11555}, {13666, 11390}, {13733, 11556}, {13767, 11559}, {13766, 11560}, {13732, 11561},
+    {2716, 11562}, {13779, 11563}, {13773, 11564}, {13762, 11565}, {13738, 11566}, {13739, 11567}, {13774, 11568}, {13719, 11569},
+    {13798, 11517}, {13728, 11557}, {13771, 11570}, {2195, 11571}, {13761, 11572}, {13785, 11573}, {13776, 11574}, {13784, 11588},
+    {13710, 11575}, {13802, 11576}, {13764, 11577}, {13751, 11578}, {13768, 11579}, {1260, 11580}, {13787, 11574}, {13753, 11582},
+    {2676, 11583}, {564, 11584}, {13754, 11585}, {13790, 11586}, {13786, 11587}, {13703, 11589}, {13776, 11590}, {13701, 11591},
+    {13737, 11592}, {13738, 11593}, {13734, 11594}, {13735, 11595}, {13728, 11596}, {13766, 11597}, {13728, 11598}, {13730, 11599},
+    {13734, 11600}, {13733, 11601}, {13759, 11616}, {13740, 11635}, {13742, 11603}, {13758, 11604}, {13730, 11605}, {13738, 11606},
+    {13754, 11607}, {13757, 11608}, {13756, 11609}, {13745, 11610}, {2811, 11612}, {13759, 11613}, {13752, 11614}, {13786, 11615},
+    {1446, 11617}, {13787, 11618}, {13788, 11619}, {13756, 11620}, {13790, 11622}, {13791, 11623}, {1653, 11625}, {13700, 11626},
+    {13757, 11627}, {13713, 11628}, {13796, 11629}, {13718, 11630}, {1590, 11631}, {13706, 11634}, {13696, 11636}, {2773, 11637},
+    {13717, 11638}, {13777, 11639}, {13782, 11640}, {13699, 11641}, {13725, 11642}, {13925, 11643}, {13744, 11644}, {13809, 11645},
+    {13810, 11646}, {13725, 11648}, {13721, 11674}, {13716, 11647}, {13762, 11650}, {834, 11652}, {13724, 11653}, {13722, 11654},
+    {13720, 11655}, {13700, 11622}, {13712, 11656}, {13707, 11657}, {1577, 11658}, {13935, 11659}, {2213, 11660}, {13931, 11661},
+    {13942, 11662}, {13722, 11638}, {13943, 11664}, {13830, 11665}, {13938, 11666}, {13832, 11667}, {13927, 11670}, {13920, 11671},
+    {13906, 11672}, {13931, 11673}, {13866, 11676}, {13901, 11677}, {13765, 11557}, {2597, 11678}, {13926, 11679}, {952, 11681},
+    {13744, 11594}, {13946, 11683}, {13948, 11684}, {13938, 11735}, {13947, 11686}, {13929, 11687}, {13891, 11688}, {13935, 11696},
+    {13942, 11685}, {13945, 11704}, {13808, 11517}, {13892, 11705}, {13851, 11690}, {13904, 11698}, {13892, 11706}, {13888, 11707},
+    {13937, 11685}, {13895, 11692}, {13930, 11673}, {13908, 11700}, {13888, 11708}, {13900, 11709}, {13888, 11694}, {13890, 11697},
+    {13814, 11649}, {13866, 11695}, {13939, 11699}, {13913, 11701}, {13915, 11702}, {582, 11703}, {13902, 11730}, {13932, 11710},
+    {13838, 11711}, {13894, 11712}, {13929, 11713}, {13914, 11714}, {13908, 11715}, {13908, 11716}, {13912, 11730}, {13911, 11730},
+    {13911, 11717}, {13909, 11718}, {13911, 11719}, {13901, 11728}, {13863, 11736}, {13861, 11737}, {13863, 11721}, {13891, 11722},
+    {13849, 11723}, {13862, 11724}, {786, 11776}, {13861, 11725}, {13865, 11724}, {13863, 11726}, {13881, 11727}, {13856, 11729},
+    {13864, 11877}, {13859, 11731}, {13835, 11732}, {13871, 11733}, {13833, 11734}, {13874, 11738}, {14010, 11739}, {13875, 11740},
+    {13859, 11877}, {13870, 11877}, {13873, 11741}, {13875, 11742}, {13915, 11743}, {13881, 11744}, {13875, 11745}, {13825, 11746},
+    {13867, 11747}, {13844, 11748}, {13922, 11749}, {13846, 11750}, {13826, 11758}, {13839, 11751}, {13829, 11752}, {13854, 11753},
+    {13830, 11754}, {13830, 11755}, {13830, 11756}, {13844, 11759}, {2087, 11777}, {13847, 11760}, {13846, 11761}, {1194, 11778},
+    {13841, 11757}, {14011, 11762}, {13842, 11876}, {14008, 11763}, {13849, 11879}, {13833, 11765}, {13851, 11773}, {13849, 11772},
+    {1775, 11779}, {13828, 11743}, {13853, 11876}, {13840, 11876}, {13840, 11879}, {13855, 11879}, {1394, 11780}, {1126, 11781},
+    {13855, 11878}, {14050, 11767}, {14053, 11873}, {14061, 11768}, {14057, 11872}, {1978, 11782}, {2780, 11783}, {13831, 11749},
+    {13846, 11878}, {14054, 11878}, {14060, 11873}, {14051, 11873}, {14048, 11872}, {14063, 11872}, {14049, 11769}, {13840, 11757},
+    {14060, 11875}, {14064, 11770}, {14064, 11874}, {14079, 11771}, {13908, 11695}, {13696, 11649}, {14075, 11775}, {14066, 11784},
+    {14055, 11875}, {14058, 11875}, {14075, 11874}, {14070, 11874}, {13979, 11785}, {13980, 11786}, {14056, 11788}, {13982, 11789},
+    {14066, 11792}, {14023, 11805}, {13857, 11722}, {14029, 11790}, {14025, 11791}, {14032, 11793}, {14027, 11794}, {14044, 11795},
+    {13980, 11796}, {13991, 11797}, {14043, 11798}, {14070, 11799}, {14023, 11800}, {14016, 11801}, {14047, 11802}, {13952, 11803},
+    {13959, 11766}, {14021, 11804}, {14023, 11806}, {14041, 11807}, {13963, 11810}, {14046, 11811}, {14003, 11812}, {14037, 11813},
+    {14043, 11814}, {1248, 11815}, {14037, 11816}, {13965, 11818}, {14045, 11820}, {14044, 11822}, {14029, 11823}, {14011, 11825},
+    {14045, 11826}, {14013, 11827}, {13957, 11828}, {14075, 11829}, {2268, 11830}, {13987, 11859}, {14079, 11832}, {13987, 11833},
+    {14023, 11834}, {14024, 11835}, {14067, 11836}, {14014, 11837}, {13985, 11859}, {13994, 11859}, {13994, 11838}, {1565, 11839},
+    {13991, 11840}, {2056, 11841}, {14029, 11842}, {13984, 11843}, {13994, 11844}, {13987, 11845}, {14000, 11847}, {14012, 11848},
+    {14010, 11849}, {14012, 12018}, {13958, 11850}, {14042, 11851}, {14005, 11852}, {13999, 11853}, {13954, 11854}, {14003, 11855},
+    {14004, 11904}, {13963, 11856}, {13961, 11857}, {13963, 11858}, {2167, 11905}, {13954, 12004}, {13956, 11860}, {14058, 11861},
+    {14015, 11904}, {14138, 11862}, {13960, 11863}, {14038, 11864}, {13965, 12004}, {13967, 12004}, {13952, 11865}, {14036, 11867},
+    {13963, 11868}, {13954, 11888}, {13974, 11896}, {13974, 11897}, {13956, 11870}, {14068, 11871}, {2290, 11880}, {14031, 11881},
+    {14070, 11882}, {14029, 11883}, {13963, 11884}, {1623, 11885}, {13961, 11886}, {13974, 11887}, {13967, 11890}, {13973, 11892},
+    {14077, 11893}, {14020, 11894}, {13967, 11895}, {14195, 11898}, {14082, 11899}, {14083, 11901}, {14084, 11902}, {14178, 11903},
+    {13956, 11827}, {14195, 11906}, {14190, 11907}, {14204, 11908}, {14184, 11909}, {14128, 11910}, {14181, 11911}, {14134, 11912},
+    {14184, 11913}, {14176, 11914}, {14179, 11915}, {13999, 11812}, {14199, 11916}, {14068, 11766}, {14207, 11917}, {14203, 11918},
+    {14196, 11919}, {14195, 11920}, {14127, 11921}, {14179, 11922}, {14198, 11923}, {14198, 11924}, {14199, 11925}, {14205, 11926},
+    {14194, 11927}, {14203, 11928}, {14202, 11929}, {14201, 11930}, {14144, 11931}, {14151, 11932}, {14152, 11933}, {14156, 11934},
+    {14148, 11935}, {14154, 11936}, {14202, 11937}, {14145, 11938}, {14144, 11939}, {14159, 11940}, {2803, 11942}, {14099, 11943},
+    {14149, 11944}, {245, 11945}, {14147, 11946}, {1282, 11947}, {14195, 11948}, {14103, 11949}, {14153, 11951}, {14173, 11952},
+    {285, 11953}, {2345, 11954}, {253, 11955}, {2321, 11956}, {14090, 11957}, {1373, 11958}, {14164, 11959}, {14163, 11960},
+    {14131, 11961}, {14132, 11962}, {14171, 11963}, {14173, 11964}, {14148, 11965}, {14101, 11966}, {14182, 11967}, {14158, 11968},
+    {14158, 11969}, {14140, 11970}, {14087, 11972}, {14142, 11973}, {14085, 11974}, {14202, 11975}, {1983, 11976}, {14145, 11978},
+    {1614, 11979}, {897, 11980}, {14200, 11981}, {14147, 11982}, {14114, 11983}, {343, 12032}, {14116, 12133}, {735, 12033},
+    {14266, 11984}, {14198, 11985}, {14127, 11986}, {14112, 12000}, {14114, 12026}, {14160, 11988}, {14127, 12133}, {14114, 12133},
+    {14121, 12132}, {14117, 11989}, {14114, 11991}, {14128, 11992}, {14190, 11994}, {14138, 11995}, {14188, 11996}, {14088, 11997},
+    {14112, 12132}, {14126, 12132}, {14266, 11998}, {14135, 11999}, {14120, 12001}, {14171, 12003}, {14138, 12005}, {14120, 12006},
+    {2035, 12034}, {14123, 12135}, {14181, 12007}, {14143, 12008}, {14171, 12010}, {14097, 12011}, {14097, 12012}, {14081, 12013},
+    {14172, 12014}, {14091, 12015}, {14162, 12016}, {14186, 12017}, {14109, 12019}, {1696, 12021}, {14089, 12022}, {14094, 12023},
+    {14081, 12024}, {14106, 12025}, {14081, 12027}, {14252, 12028}, {1140, 12029}, {14195, 12030}, {14103, 12031}, {14099, 12035},
+    {14156, 12037}, {14157, 12038}, {14146, 12039}, {14147, 12040}, {14144, 12041}, {14088, 12042}, {14150, 12043}, {14098, 12044},
+    {14148, 12046}, {14092, 12048}, {14264, 12049}, {1109, 12050}, {14317, 12051}, {14317, 12052}, {14213, 12053}, {14307, 12054},
+    {14310, 12055}, {14316, 12056}, {14312, 12057}, {14262, 12059}, {14263, 12060}, {14305, 12061}, {1492, 12062}, {14311, 12063},
+    {14318, 12155}, {2646, 12064}, {14334, 12065}, {14310, 12067}, {14282, 12068}, {14304, 12069}, {14328, 12070}, {14325, 12071},
+    {14329, 12155}, {14324, 12155}, {14243, 12072}, {14324, 12073}, {14330, 12075}, {14328, 12076}, {14237, 12077}, {14273, 12078},
+    {14218, 12058}, {14239, 12079}, {14277, 12080}, {14276, 12081}, {292, 12082}, {14273, 12083}, {14233, 12084}, {14238, 12085},
+    {1709, 12086}, {492, 12087}, {14295, 12088}, {14286, 12090}, {14293, 12091}, {14279, 12096}, {14299, 12111}, {14275, 12113},
+    {14282, 12112}, {14230, 12092}, {14272, 12094}, {14254, 12095}, {14278, 12097}, {14275, 12098}, {2174, 12099}, {14219, 12100},
+    {14278, 12101}, {14301, 12102}, {14289, 12104}, {14223, 12107}, {650, 12108}, {14220, 12109}, {14296, 12110}, {14264, 12114},
+    {14298, 12115}, {2776, 12160}, {14299, 12261}, {14294, 12116}, {14294, 12117}, {14294, 12118}, {1374, 12120}, {14241, 12128},
+    {14253, 12148}, {14255, 12123}, {14290, 12261}, {14297, 12261}, {14248, 12125}, {14334, 12126}, {14335, 12127}, {14332, 12129},
+    {14248, 12130}, {14244, 12131}, {14247, 12137}, {14320, 12138}, {14255, 12139}, {14270, 12140}, {14226, 12141}, {14324, 12142},
+    {14287, 12143}, {14314, 12144}, {14315, 12145}, {14245, 12146}, {14258, 12147}, {14266, 12149}, {14246, 12150}, {14217, 12151},
+    {14266, 12152}, {14270, 12153}, {14268, 12154}, {14299, 12157}, {14310, 12159}, {14394, 12162}, {14259, 12163}, {14253, 12164},
+    {631, 12165}, {14309, 12166}, {14305, 12167}, {2616, 12170}, {14216, 12171}, {14228, 12172}, {14223, 12173}, {14214, 12175},
+    {14211, 12271}, {14209, 12176}, {14208, 12177}, {14318, 12178}, {14235, 12179}, {14320, 12181}, {535, 12183}, {14233, 12184},
+    {14218, 12271}, {14209, 12271}, {14211, 12185}, {14232, 12187}, {14217, 12188}, {14235, 12189}, {14272, 12190}, {14219, 12195},
+    {14436, 12197}, {14435, 12199}, {14432, 12200}, {14445, 12201}, {14461, 12208}, {14332, 12058}, {14455, 12216}, {14453, 12217},
+    {14376, 12203}, {14458, 12204}, {14434, 12205}, {14462, 12206}, {14462, 12207}, {14462, 12209}, {14453, 12210}, {14406, 12211},
+    {2471, 12212}, {14459, 12241}, {14454, 12214}, {14456, 12215}, {1272, 12218}, {14415, 12219}, {14461, 12220}, {14361, 12221},
+    {14457, 12241}, {14450, 12241}, {2743, 12222}, {14416, 12223}, {14425, 12224}, {14410, 12225}, {14430, 12226}, {14400, 12227},
+    {14298, 12156}, {14215, 12186}, {14331, 12193}, {14333, 12194}, {14335, 12196}, {14340, 12198}, {14365, 12213}, {14405, 12251},
+    {2619, 12288}, {14422, 12228}, {14445, 12229}, {14424, 12230}, {14406, 12240}, {14418, 12248}, {14403, 12251}, {14412, 12251},
+    {14415, 12389}, {14418, 12249}, {14420, 12232}, {14423, 12234}, {14413, 12235}, {1098, 12289}, {14372, 12233}, {14426, 12388},
+    {14406, 12389}, {14421, 12389}, {14433, 12236}, {14416, 12237}, {14522, 12238}, {14366, 12239}, {14424, 12388}, {14421, 12388},
+    {14368, 12242}, {14523, 12243}, {14384, 12244}, {14378, 12245}, {14405, 12246}, {14520, 12247}, {14521, 12250}, {14382, 12252},
+    {14526, 12253}, {14373, 12254}, {14356, 12255}, {14527, 12256}, {14524, 12257}, {14355, 12258}, {14380, 12259}, {14399, 12283},
+    {14417, 12260}, {14374, 12262}, {14375, 12263}, {14446, 12264}, {14385, 12265}, {14392, 12266}, {14393, 12267}, {14389, 12268},
+    {14425, 12270}, {14426, 12272}, {14427, 12273}, {14428, 12274}, {14439, 12275}, {14430, 12276}, {14437, 12277}, {14433, 12278},
+    {14340, 12279}, {14371, 12246}, {14352, 12280}, {14344, 12281}, {14346, 12282}, {14347, 12284}, {14341, 12285}, {14351, 12286},
+    {14422, 12290}, {14360, 12291}, {14336, 12292}, {14347, 12293}, {14359, 12294}, {14449, 12295}, {14381, 12296}, {14380, 12297},
+    {791, 12298}, {14414, 12300}, {14352, 12301}, {14412, 12302}, {14358, 12303}, {14360, 12304}, {14356, 12305}, {14401, 12306},
+    {14365, 12307}, {14420, 12308}, {14344, 12309}, {14348, 12310}, {594, 12311}, {14581, 12312}, {1402, 12313}, {14340, 12273},
+    {14433, 12198}, {14438, 12196}, {14570, 12314}, {14404, 12213}, {14411, 12233}, {14212, 12156}, {14437, 12194}, {14219, 12193},
+    {14567, 12316}, {14512, 12317}, {14575, 12319}, {14476, 12320}, {14477, 12321}, {14567, 12322}, {14561, 12323}, {14480, 12324},
+    {14589, 12325}, {14545, 12326}, {14567, 12328}, {14214, 12186}, {14583, 12329}, {14588, 12330}, {14579, 12331}, {14582, 12332},
+    {14573, 12333}, {14499, 12334}, {14581, 12335}, {14585, 12336}, {14576, 12337}, {14590, 12338}, {14572, 12339}, {14585, 12340},
+    {14542, 12341}, {14542, 12342}, {14528, 12343}, {14549, 12344}, {14544, 12345}, {14534, 12346}, {14538, 12347}, {14532, 12348},
+    {14504, 12349}, {14536, 12350}, {14542, 12351}, {14528, 12352}, {14532, 12353}, {14532, 12354}, {14471, 12355}, {14511, 12357},
+    {14474, 12359}, {14559, 12361}, {14553, 12362}, {14528, 12363}, {14489, 12364}, {14545, 12365}, {14532, 12366}, {14546, 12367},
+    {14556, 12369}, {14539, 12373}, {14557, 12381}, {14559, 12380}, {1868, 12374}, {1635, 12375}, {279, 12376}, {14543, 12377},
+    {911, 12378}, {14491, 12379}, {14535, 12384}, {14537, 12385}, {14505, 12386}, {14470, 12387}, {14512, 12390}, {14492, 12391},
+    {14518, 12393}, {14500, 12396}, {14511, 12397}, {1328, 12398}, {14487, 12399}, {14464, 12400}, {14502, 12401}, {14498, 12402},
+    {14582, 12403}, {14583, 12404}, {14542, 12405}, {43, 12406}, {14510, 12407}, {14570, 12408}, {14518, 12409}, {14519, 12410},
+    {14525, 12411}, {14525, 12412}, {14524, 12530}, {14562, 12413}, {14520, 12414}, {14510, 12415}, {14555, 12418}, {14525, 12419},
+    {14516, 12416}, {1281, 12420}, {14517, 12421}, {14564, 12422}, {1796, 12423}, {14518, 12424}, {14480, 12425}, {14546, 12426},
+    {14527, 12416}, {14476, 12427}, {14570, 12429}, {14464, 12430}, {14468, 12431}, {14468, 12432}, {14513, 12434}, {14465, 12435},
+    {14466, 12436}, {14486, 12444}, {14491, 12437}, {14508, 12439}, {14580, 12440}, {14543, 12441}, {14582, 12442}, {848, 12443},
+    {14495, 12445}, {14474, 12447}, {14480, 12448}, {14650, 12449}, {14586, 12450}, {14483, 12451}, {1246, 12452}, {518, 12453},
+    {14588, 12454}, {213, 12455}, {14472, 12457}, {14483, 12458}, {14478, 12504}, {14708, 12459}, {14711, 12460}, {14690, 12461},
+    {14598, 12464}, {14711, 12465}, {14600, 12466}, {14695, 12467}, {1626, 12468}, {14718, 12469}, {14676, 12470}, {14695, 12471},
+    {14693, 12472}, {14688, 12473}, {14645, 12474}, {14716, 12475}, {14693, 12476}, {14610, 12477}, {1475, 12478}, {316, 12479},
+    {2274, 12481}, {14689, 12482}, {14689, 12461}, {2273, 12483}, {14705, 12484}, {14698, 12461}, {14688, 12485}, {217, 12544},
+    {14711, 12645}, {14712, 12486}, {14618, 12488}, {14706, 12489}, {14630, 12490}, {14621, 12491}, {14676, 12492}, {14704, 12493},
+    {14718, 12645}, {14717, 12645}, {14705, 12494}, {703, 12495}, {14619, 12496}, {14616, 12497}, {14666, 12498}, {14668, 12499},
+    {14663, 12545}, {14659, 12659}, {14656, 12500}, {14634, 12501}, {14686, 12503}, {14636, 12505}, {14615, 12506}, {14666, 12507},
+    {14670, 12545}, {14658, 12508}, {14677, 12509}, {14680, 12510}, {14701, 12512}, {14674, 12513}, {14684, 12514}, {14683, 12515},
+    {14657, 12516}, {14605, 12517}, {14648, 12518}, {14595, 12519}, {14650, 12520}, {14686, 12521}, {14652, 12522}, {2602, 12546},
+    {14674, 12647}, {14654, 12523}, {14672, 12524}, {14714, 12526}, {14642, 12527}, {14627, 12528}, {14630, 12529}, {14660, 12532},
+    {702, 12533}, {14641, 12534}, {14645, 12535}, {14663, 12536}, {14707, 12537}, {14639, 12538}, {920, 12540}, {14705, 12541},
+    {14668, 12542}, {14625, 12547}, {14698, 12549}, {359, 12550}, {14699, 12552}, {14696, 12553}, {14625, 12554}, {14702, 12555},
+    {14636, 12543}, {14677, 12556}, {14643, 12557}, {14600, 12558}, {14636, 12559}, {14636, 12560}, {873, 12561}, {14597, 12562},
+    {14650, 12563}, {14649, 12565}, {14643, 12566}, {14641, 12567}, {14635, 12568}, {14615, 12569}, {14606, 12570}, {14613, 12571},
+    {14604, 12572}, {14692, 12574}, {14694, 12575}, {14611, 12576}, {14647, 12577}, {14594, 12578}, {14595, 12579}, {14594, 12580},
+    {14595, 12582}, {14621, 12583}, {14625, 12543}, {14620, 12584}, {1789, 12585}, {14619, 12586}, {2480, 12587}, {14705, 12588},
+    {14706, 12589}, {14608, 12590}, {14592, 12591}, {14634, 12592}, {14621, 12593}, {14623, 12594}, {14614, 12595}, {14616, 12596},
+    {14714, 12597}, {14657, 12598}, {14606, 12608}, {14616, 12636}, {14660, 12599}, {14624, 12600}, {14818, 12601}, {14814, 12602},
+    {14820, 12603}, {14812, 12604}, {14724, 12605}, {14810, 12606}, {14763, 12607}, {14820, 12609}, {14827, 12610}, {14806, 12611},
+    {14831, 12612}, {14818, 12613}, {14817, 12614}, {14818, 12615}, {14845, 12616}, {14818, 12617}, {14821, 12618}, {14846, 12619},
+    {14844, 12620}, {14842, 12621}, {14837, 12672}, {14845, 12786}, {14765, 12623}, {14836, 12624}, {14790, 12625}, {14843, 12626},
+    {14836, 12627}, {14827, 12628}, {14844, 12672}, {14832, 12629}, {14805, 12630}, {14837, 12627}, {14747, 12631}, {859, 12633},
+    {411, 12635}, {465, 12637}, {1913, 12638}, {14744, 12641}, {14795, 12643}, {14793, 12646}, {14842, 12648}, {2391, 12649},
+    {14748, 12651}, {189, 12652}, {2403, 12653}, {14759, 12654}, {14839, 12656}, {14834, 12627}, {1741, 12657}, {14761, 12660},
+    {1078, 12673}, {14795, 12772}, {14743, 12661}, {14740, 12662}, {2622, 12663}, {14794, 12665}, {14731, 12666}, {14728, 12667},
+    {14793, 12772}, {14786, 12772}, {416, 12668}, {89, 12669}, {14802, 12670}, {14772, 12671}, {14732, 12674}, {14824, 12676},
+    {14804, 12677}, {14793, 12678}, {14811, 12686}, {14804, 12679}, {14782, 12680}, {14721, 12681}, {14806, 12682}, {392, 12683},
+    {14843, 12684}, {1865, 12687}, {2145, 12690}, {14840, 12691}, {14754, 12692}, {14789, 12693}, {14771, 12694}, {14793, 12695},
+    {14756, 12696}, {14754, 12697}, {14765, 12698}, {14757, 12776}, {14756, 12699}, {14782, 12700}, {1528, 12701}, {14772, 12702},
+    {14786, 12671}, {14824, 12703}, {14756, 12698}, {14780, 12704}, {14779, 12705}, {14778, 12706}, {14772, 12707}, {14757, 12708},
+    {14727, 12709}, {14768, 12710}, {14777, 12711}, {14761, 12712}, {14779, 12713}, {14782, 12714}, {14768, 12715}, {14768, 12717},
+    {14769, 12693}, {14729, 12718}, {1174, 12719}, {1644, 12721}, {669, 12722}, {14727, 12723}, {1484, 12724}, {2386, 12725},
+    {14723, 12753}, {14815, 12727}, {14722, 12728}, {14723, 12729}, {1996, 12730}, {14802, 12731}, {14726, 12733}, {14773, 12734},
+    {14730, 12753}, {14721, 12753}, {14749, 12761}, {14830, 12737}, {14831, 12738}, {14794, 12739}, {14746, 12740}, {14730, 12742},
+    {14751, 12736}, {781, 12743}, {398, 12744}, {14785, 12745}, {14749, 12746}, {14750, 12747}, {2486, 12800}, {14742, 12901},
+    {14849, 12748}, {14960, 12750}, {14747, 12736}, {14958, 12751}, {14957, 12752}, {14954, 12754}, {14804, 12654}, {14962, 12755},
+    {14746, 12741}, {14944, 12757}, {14971, 12759}, {14737, 12741}, {14950, 12760}, {14972, 12762}, {420, 12763}, {14953, 12764},
+    {1365, 12765}, {14953, 12766}, {14747, 12741}, {14749, 12741}, {14948, 12767}, {14973, 12768}, {14966, 12769}, {14974, 12794},
+    {14865, 12770}, {14952, 12741}, {14964, 12771}, {14945, 12774}, {14923, 12777}, {14971, 12778}, {14739, 12741}, {14948, 12784},
+    {14960, 12792}, {14961, 12779}, {14954, 12780}, {14971, 12781}, {14963, 12782}, {14967, 12783}, {14965, 12785}, {14738, 12741},
+    {14967, 12787}, {14880, 12788}, {14921, 12789}, {14923, 12790}, {14925, 12791}, {14916, 12793}, {14925, 12795}, {14927, 12796},
+    {14915, 12797}, {14917, 12798}, {2012, 12801}, {14912, 12799}, {14915, 12802}, {14958, 12803}, {14943, 12804}, {14913, 12806},
+    {14925, 12900}, {14931, 12814}, {14929, 12815}, {14914, 12807}, {14903, 12808}, {14931, 12809}, {14922, 12810}, {14865, 12811},
+    {14916, 12900}, {14923, 12900}, {14941, 12812}, {14921, 12813}, {14946, 12816}, {14922, 12817}, {14922, 12818}, {14890, 12819},
+    {14890, 12820}, {14890, 12821}, {14902, 12822}, {547, 12823}, {14917, 12788}, {14884, 12914}, {14852, 12824}, {14885, 12825},
+    {14910, 12828}, {14909, 12832}, {14903, 12840}, {14901, 12841}, {14882, 12914}, {14895, 12914}, {14861, 12827}, {14887, 12829},
+    {14881, 12830}, {14884, 12808}, {14910, 12831}, {14905, 12833}, {14880, 12834}, {14909, 12835}, {14891, 12836}, {14892, 12837},
+    {14851, 12839}, {14889, 12842}, {14891, 12843}, {467, 12844}, {14858, 12845}, {14907, 12846}, {14870, 12847}, {14905, 12848},
+    {14910, 12873}, {14858, 12849}, {928, 12850}, {14859, 12887}, {14854, 12851}, {14854, 12852}, {14849, 12853}, {14873, 12854},
+    {14856, 12873}, {14855, 12873}, {14857, 12887}, {14850, 12887}, {14874, 12855}, {14893, 12856}, {14855, 12857}, {14849, 12858},
+    {14875, 12864}, {14850, 12895}, {14878, 12859}, {14858, 12866}, {14878, 12874}, {14878, 12875}, {14869, 12861}, {14856, 12862},
+    {14863, 12868}, {14873, 12876}, {14875, 12877}, {15087, 12869}, {15085, 12870}, {15087, 12871}, {15093, 12880}, {15083, 12888},
+    {14939, 12838}, {14976, 12865}, {14978, 12867}, {15081, 12889}, {15100, 12882}, {15080, 12890}, {15092, 12891}, {1466, 12928},
+    {15078, 12884}, {15090, 12892}, {15090, 12893}, {15076, 12881}, {15094, 12883}, {15083, 12896}, {15101, 12904}, {15103, 12905},
+    {15088, 13029}, {15086, 12898}, {15098, 12906}, {15098, 12907}, {15085, 12894}, {15059, 12897}, {15055, 12899}, {15053, 12902},
+    {15099, 13029}, {15094, 13029}, {15042, 12903}, {2647, 12908}, {2189, 12909}, {15050, 12910}, {2739, 12911}, {15007, 12912},
+    {15004, 12913}, {15005, 12915}, {15041, 12916}, {15042, 12917}, {15044, 12918}, {15092, 12919}, {15020, 12920}, {2674, 12921},
+    {15046, 12922}, {15069, 12923}, {14978, 12924}, {15065, 12925}, {15066, 12926}, {15062, 12927}, {15083, 12929}, {15041, 12930},
+    {15043, 12931}, {15031, 12932}, {14978, 12933}, {1143, 12934}, {15071, 12935}, {15066, 12936}, {15067, 12938}, {15039, 12939},
+    {15021, 12940}, {15029, 12941}, {15010, 12942}, {2001, 12943}, {15030, 12944}, {2317, 12945}, {15045, 13016}, {15046, 12946},
+    {15071, 13027}, {15047, 12947}, {15032, 12949}, {15020, 12957}, {15016, 12956}, {15053, 12950}, {15092, 12951}, {1452, 12952},
+    {81, 12953}, {15055, 12954}, {15012, 12955}, {15011, 12958}, {15080, 12960}, {79, 12962}, {15030, 12963}, {15037, 12964},
+    {15087, 12965}, {15010, 12966}, {14984, 12967}, {15030, 12968}, {15012, 12932}, {15019, 12976}, {15037, 12984}, {15026, 12969},
+    {15058, 13027}, {15032, 12970}, {1541, 12971}, {15033, 12972}, {15028, 12973}, {14995, 12974}, {15149, 12975}, {15040, 12927},
+    {15038, 12977}, {14998, 12978}, {14998, 12979}, {14998, 12981}, {15077, 12865}, {14852, 12838}, {14978, 12989}, {15079, 12867},
+    {14978, 12988}, {14984, 12982}, {931, 12983}, {14988, 12986}, {15082, 12987}, {15000, 12990}, {15084, 12991}, {14984, 12992},
+    {14981, 12993}, {14983, 12994}, {15000, 12995}, {15003, 12996}, {38, 12997}, {15091, 12999}, {1468, 13000}, {15092, 13001},
+    {15055, 13002}, {15052, 13004}, {15053, 13005}, {14994, 13006}, {14996, 13007}, {1654, 13008}, {15100, 13009}, {15047, 13010},
+    {15080, 12985}, {14993, 13011}, {1544, 13012}, {1487, 13013}, {768, 13014}, {15008, 13015}, {15215, 13017}, {15212, 13018},
+    {15216, 13019}, {15207, 13020}, {15109, 13021}, {15200, 13022}, {15112, 13023}, {15212, 13024}, {15213, 13025}, {15206, 13026},
+    {15158, 13028}, {15210, 13030}, {15231, 13031}, {15181, 13032}, {15145, 13033}, {15124, 13034}, {15205, 13035}, {15226, 13036},
+    {15229, 13037}, {15228, 13038}, {15169, 13039}, {15217, 13040}, {15231, 13041}, {15131, 13042}, {15229, 13043}, {15169, 13044},
+    {15134, 13045}, {15179, 13046}, {15169, 13047}, {15133, 13048}, {15183, 13049}, {15179, 13050}, {15221, 13051}, {15121, 13052},
+    {15219, 13053}, {15149, 13055}, {15168, 13056}, {15174, 13058}, {15186, 13060}, {15153, 13061}, {15194, 13062}, {15113, 13063},
+    {15156, 13068}, {15119, 13070}, {15189, 13071}, {2233, 13072}, {50, 13073}, {15117, 13074}, {15185, 13075}, {15186, 13076},
+    {15140, 13077}, {15176, 13078}, {15203, 13079}, {15184, 13080}, {1904, 13081}, {15166, 13082}, {1317, 13083}, {15167, 13084},
+    {15171, 13085}, {403, 13087}, {15173, 13090}, {855, 13091}, {15129, 13092}, {15157, 13094}, {15150, 13102}, {15150, 13103},
+    {15161, 13104}, {15147, 13112}, {15177, 13077}, {15145, 13113}, {15185, 13097}, {15164, 13098}, {15214, 13099}, {15156, 13100},
+    {918, 13101}, {15154, 13105}, {15157, 13106}, {15162, 13107}, {15196, 13108}, {15155, 13109}, {15198, 13110}, {15165, 13111},
+    {15328, 13114}, {15195, 13115}, {15126, 13116}, {317, 13117}, {15114, 13118}, {15110, 13119}, {15127, 13121}, {15206, 13122},
+    {15127, 13123}, {15208, 13124}, {15129, 13125}, {15184, 13126}, {15156, 13127}, {14996, 12985}, {15212, 13128}, {15191, 13129},
+    {15214, 13130}, {15220, 13023}, {1362, 13131}, {15114, 13132}, {15134, 13134}, {15130, 13135}, {15133, 13136}, {15202, 13021},
+    {15217, 13034}, {15133, 13137}, {15134, 13138}, {1942, 13141}, {15122, 13142}, {15141, 13143}, {15227, 13144}, {15228, 13145},
+    {15229, 13146}, {15230, 13147}, {15232, 13148}, {15326, 13149}, {15234, 13150}, {15345, 13151}, {15236, 13152}, {15350, 13153},
+    {15183, 13096}, {15123, 13139}, {15238, 13154}, {15342, 13156}, {15334, 13157}, {2521, 13158}, {15283, 13159}, {15335, 13160},
+    {15330, 13161}, {15343, 13162}, {2150, 13184}, {15332, 13285}, {15246, 13163}, {15247, 13164}, {15333, 13165}, {15331, 13168},
+    {15349, 13176}, {15351, 13177}, {15328, 13167}, {15279, 13170}, {15330, 13171}, {15354, 13172}, {15351, 13173}, {15349, 13174},
+    {15301, 13175}, {15259, 13178}, {15270, 13179}, {15343, 13180}, {15268, 13181}, {1912, 13182}, {15337, 13183}, {1430, 13185},
+    {15258, 13186}, {15358, 13187}, {15303, 13189}, {15267, 13190}, {15268, 13191}, {15263, 13194}, {15305, 13195}, {15298, 13196},
+    {15325, 13197}, {15310, 13198}, {15300, 13199}, {15303, 13200}, {15276, 13201}, {15298, 13202}, {596, 13203}, {15298, 13204},
+    {15253, 13205}, {15280, 13207}, {15342, 13208}, {15318, 13209}, {15322, 13210}, {15284, 13211}, {15285, 13213}, {15320, 13214},
+    {35, 13215}, {15324, 13216}, {15306, 13218}, {15326, 13226}, {15326, 13227}, {15332, 13219}, {15304, 13220}, {15304, 13221},
+    {15321, 13223}, {15322, 13224}, {15354, 13225}, {15355, 13228}, {15298, 13229}, {15299, 13230}, {15300, 13231}, {15270, 13232},
+    {15356, 13233}, {15264, 13234}, {15304, 13235}, {15264, 13236}, {15269, 13237}, {15289, 13238}, {15308, 13239}, {610, 13240},
+    {15309, 13241}, {15310, 13242}, {15349, 13243}, {15283, 13244}, {15339, 13245}, {15289, 13246}, {15264, 13247}, {15405, 13248},
+    {15293, 13249}, {15343, 13250}, {510, 13312}, {870, 13251}, {15321, 13252}, {15279, 13254}, {15235, 13255}, {15325, 13257},
+    {15287, 13413}, {1287, 13258}, {15276, 13264}, {15288, 13272}, {15237, 13273}, {15156, 13096}, {15254, 13260}, {15292, 13261},
+    {15294, 13413}, {15293, 13413}, {15326, 13262}, {15236, 13263}, {15236, 13265}, {15238, 13266}, {1320, 13267}, {15234, 13268},
+    {2607, 13269}, {15241, 13271}, {15256, 13274}, {15115, 13139}, {15235, 13313}, {15233, 13427}, {15280, 13275}, {15237, 13266},
+    {15236, 13276}, {15239, 13277}, {15347, 13278}, {311, 13314}, {15261, 13415}, {185, 13315}, {15245, 13279}, {1773, 13316},
+    {15322, 13253}, {15255, 13414}, {15259, 13409}, {15266, 13280}, {1552, 13317}, {15263, 13408}, {15470, 13281}, {15417, 13282},
+    {15261, 13414}, {15262, 13414}, {15250, 13409}, {15257, 13409}, {15460, 13408}, {15254, 13408}, {15472, 13283}, {15470, 13284},
+    {15470, 13286}, {15470, 13287}, {15368, 13288}, {15463, 13289}, {15471, 13290}, {15444, 13291}, {15480, 13292}, {15480, 13293},
+    {15463, 13294}, {15480, 13295}, {15459, 13297}, {15477, 13305}, {15479, 13304}, {2587, 13318}, {15459, 13298}, {15392, 13299},
+    {15477, 13411}, {15484, 13301}, {15432, 13302}, {15388, 13303}, {15471, 13319}, {15481, 13327}, {15483, 13326}, {15437, 13307},
+    {15484, 13411}, {15475, 13411}, {15484, 13308}, {15432, 13309}, {15439, 13310}, {15454, 13311}, {15448, 13328}, {15436, 13336},
+    {15432, 13337}, {15383, 13321}, {15449, 13322}, {15430, 13323}, {15451, 13324}, {15449, 13325}, {15451, 13329}, {15369, 13330},
+    {15453, 13412}, {15464, 13331}, {15447, 13332}, {15435, 13335}, {15453, 13343}, {15455, 13342}, {15400, 13338}, {15450, 13339},
+    {15445, 13334}, {15446, 13341}, {15440, 13344}, {15415, 13346}, {15394, 13347}, {1059, 13348}, {15429, 13303}, {15399, 13377},
+    {15452, 13334}, {15546, 13351}, {15412, 13353}, {15421, 13354}, {15381, 13357}, {15367, 13358}, {15404, 13377}, {15406, 13377},
+    {15366, 13359}, {1400, 13360}, {15455, 13361}, {15375, 13362}, {15468, 13363}, {15372, 13364}, {15360, 13365}, {15368, 13366},
+    {15434, 13367}, {1404, 13368}, {2223, 13369}, {713, 13370}, {2002, 13371}, {15477, 13372}, {1874, 13373}, {15478, 13374},
+    {15376, 13407}, {11, 13375}, {15382, 13376}, {15426, 13378}, {15427, 13379}, {15236, 13253}, {15424, 13380}, {15425, 13381},
+    {15386, 13407}, {15377, 13407}, {15384, 13382}, {15394, 13383}, {15486, 13384}, {15589, 13385}, {15590, 13386}, {15580, 13387},
+    {15595, 13388}, {481, 13389}, {15562, 13390}, {15567, 13391}, {15495, 13393}, {15610, 13394}, {15497, 13395}, {15476, 13288},
+    {15573, 13396}, {15537, 13397}, {15592, 13398}, {15501, 13399}, {15584, 13400}, {15568, 13401}, {15609, 13402}, {15600, 13403},
+    {15421, 13340}, {15425, 13345}, {15438, 13349}, {15439, 13350}, {15441, 13352}, {15447, 13355}, {15454, 13356}, {15607, 13405},
+    {15615, 13410}, {15601, 13416}, {15509, 13417}, {15589, 13418}, {979, 13419}, {1564, 13420}, {15606, 13421}, {15559, 13422},
+    {1422, 13423}, {15613, 13424}, {15602, 13425}, {15610, 13426}, {15613, 13428}, {15603, 13429}, {15524, 13430}, {15595, 13431},
+    {15566, 13432}, {15521, 13433}, {15556, 13434}, {15574, 13435}, {15581, 13436}, {15556, 13437}, {15555, 13438}, {15560, 13439},
+    {15567, 13440}, {15567, 13441}, {15555, 13442}, {15566, 13443}, {15603, 13444}, {15560, 13445}, {15601, 13446}, {15574, 13447},
+    {1128, 13448}, {15498, 13449}, {15554, 13450}, {15597, 13451}, {15559, 13452}, {15553, 13453}, {15503, 13454}, {685, 13455},
+    {15542, 13456}, {15574, 13457}, {15569, 13458}, {15570, 13459}, {15524, 13460}, {15588, 13461}, {15566, 13462}, {15580, 13463},
+    {15565, 13464}, {15572, 13465}, {15529, 13466}, {15531, 13467}, {15609, 13471}, {15515, 13473}, {15615, 13474}, {15535, 13475},
+    {15542, 13476}, {15547, 13477}, {15550, 13478}, {15494, 13479}, {15375, 13480}, {15530, 13481}, {15561, 13460}, {15535, 13482},
+    {15494, 13484}, {15523, 13485}, {15536, 13486}, {15520, 13487}, {15571, 13488}, {15572, 13489}, {889, 13490}, {15599, 13492},
+    {15574, 13493}, {15538, 13494}, {15532, 13495}, {15494, 13496}, {15540, 13497}, {15529, 13504}, {15547, 13512}, {15540, 13498},
+    {15582, 13499}, {15539, 13500}, {15509, 13501}, {17, 13502}, {15501, 13503}, {15549, 13506}, {15587, 13507}, {15504, 13509},
+    {15364, 13355}, {15408, 13352}, {15508, 13510}, {15366, 13356}, {15392, 13345}, {15398, 13340}, {15414, 13350}, {15412, 13349},
+    {15591, 13511}, {15570, 13513}, {1127, 13514}, {15542, 13515}, {15518, 13516}, {15518, 13517}, {15512, 13518}, {15538, 13519},
+    {15493, 13520}, {15495, 13521}, {15518, 13522}, {15489, 13523}, {2728, 13524}, {15602, 13525}, {1229, 13526}, {15532, 13528},
+    {15505, 13529}, {15489, 13530}, {2312, 13532}, {15554, 13533}, {2285, 13536}, {15512, 13538}, {15515, 13539}, {15502, 13540},
+    {15606, 13531}, {15517, 13541}, {15497, 13542}, {15726, 13543}, {15731, 13562}, {15727, 13565}, {1897, 13544}, {15731, 13545},
+    {593, 13546}, {15678, 13547}, {15722, 13549}, {15730, 13550}, {15704, 13551}, {15740, 13552}, {15702, 13553}, {15626, 13554},
+    {15665, 13555}, {15670, 13556}, {1521, 13557}, {15736, 13561}, {15738, 13564}, {15722, 13566}, {15715, 13568}, {15733, 13576},
+    {15735, 13577}, {15719, 13569}, {2736, 13570}, {15729, 13571}, {15638, 13572}, {2109, 13573}, {15740, 13575}, {15739, 13578},
+    {15730, 13574}, {15645, 13580}, {15646, 13581}, {15720, 13574}, {15680, 13582}, {15694, 13583}, {15699, 13584}, {15685, 13592},
+    {15690, 13585}, {15690, 13586}, {1476, 13587}, {15702, 13588}, {1367, 13589}, {15654, 13590}, {15681, 13591}, {15708, 13593},
+    {15705, 13594}, {15688, 13595}, {15707, 13596}, {15639, 13597}, {15684, 13598}, {15627, 13599}, {15624, 13600}, {15667, 13601},
+    {1717, 13602}, {15668, 13603}, {2264, 13604}, {15631, 13605}, {180, 13606}, {15684, 13608}, {996, 13609}, {15685, 13610},
+    {15672, 13611}, {15708, 13612}, {15688, 13613}, {15617, 13614}, {12, 13615}, {15699, 13617}, {15623, 13618}, {2512, 13619},
+    {15683, 13590}, {15678, 13620}, {15621, 13621}, {15680, 13623}, {156, 13624}, {15663, 13632}, {15663, 13658}, {15652, 13625},
+    {15684, 13626}, {15685, 13628}, {15686, 13629}, {15650, 13630}, {15688, 13631}, {837, 13633}, {15675, 13634}, {15673, 13635},
+    {15636, 13636}, {15649, 13637}, {15657, 13639}, {15661, 13640}, {15733, 13641}, {15652, 13642}, {15678, 13643}, {15675, 13644},
+    {15721, 13645}, {15651, 13646}, {15676, 13647}, {15672, 13648}, {814, 13649}, {15507, 13531}, {1822, 13650}, {15672, 13651},
+    {15661, 13652}, {15621, 13653}, {15732, 13554}, {15663, 13654}, {15619, 13655}, {15674, 13656}, {15658, 13657}, {15659, 13659},
+    {15706, 13661}, {485, 13663}, {853, 13664}, {15626, 13665}, {15629, 13666}, {15639, 13667}, {15675, 13668}, {15633, 13669},
+    {15673, 13670}, {15637, 13671}, {88, 13672}, {15720, 13673}, {15618, 13674}, {15641, 13675}, {15723, 13676}, {15626, 13677},
+    {15640, 13678}, {15620, 13679}, {15647, 13680}, {15640, 13681}, {1869, 13682}, {15645, 13683}, {15633, 13684}, {15637, 13685},
+    {15641, 13686}, {15643, 13687}, {15635, 13688}, {15638, 13689}, {15654, 13690}, {15638, 13691}, {15652, 13692}, {15635, 13693},
+    {15640, 13694}, {15627, 13695}, {15648, 13696}, {15854, 13697}, {15859, 13698}, {15845, 13706}, {15850, 13699}, {15748, 13700},
+    {15804, 13701}, {15850, 13702}, {15849, 13703}, {15856, 13704}, {15864, 13709}, {15846, 13725}, {15864, 13705}, {15840, 13707},
+    {15867, 13708}, {15760, 13710}, {15761, 13715}, {15863, 13716}, {15868, 13717}, {15847, 13718}, {15765, 13720}, {919, 13723},
+    {15866, 13724}, {1537, 13727}, {15848, 13729}, {15868, 13737}, {15864, 13736}, {15773, 13730}, {15775, 13731}, {15826, 13733},
+    {15863, 13822}, {15777, 13734}, {15778, 13735}, {15809, 13740}, {2465, 13741}, {15821, 13768}, {15781, 13742}, {15826, 13743},
+    {15870, 13822}, {15869, 13822}, {15864, 13744}, {15811, 13745}, {15809, 13746}, {15812, 13747}, {148, 13748}, {15817, 13750},
+    {15814, 13749}, {15790, 13752}, {15791, 13755}, {15827, 13756}, {15833, 13749}, {408, 13757}, {15832, 13784}, {15835, 13758},
+    {15849, 13730}, {78, 13759}, {15852, 13760}, {15834, 13761}, {15812, 13762}, {15824, 13770}, {15825, 13763}, {15747, 13764},
+    {15833, 13765}, {15817, 13767}, {15804, 13769}, {15827, 13771}, {15824, 13772}, {15816, 13773}, {15791, 13774}, {15786, 13775},
+    {15793, 13776}, {15780, 13777}, {15784, 13778}, {15782, 13779}, {15784, 13780}, {15782, 13781}, {15858, 13782}, {15788, 13783},
+    {15780, 13785}, {15789, 13789}, {15806, 13792}, {15786, 13800}, {15786, 13801}, {15823, 13793}, {15807, 13794}, {15796, 13795},
+    {15826, 13797}, {15779, 13798}, {15777, 13799}, {15777, 13808}, {15795, 13818}, {15794, 13802}, {2734, 13803}, {1916, 13804},
+    {15832, 13805}, {15843, 13806}, {15847, 13700}, {15805, 13824}, {15795, 13835}, {15803, 13834}, {15785, 13846}, {15766, 13855},
+    {15789, 13827}, {15756, 13807}, {15768, 13846}, {15846, 13811}, {15753, 13812}, {15757, 13813}, {15785, 13827}, {15773, 13815},
+    {15763, 13841}, {921, 13816}, {15824, 13817}, {15748, 13819}, {15757, 13820}, {15746, 13821}, {15745, 13823}, {15792, 13825},
+    {15748, 13826}, {15750, 13828}, {15771, 13829}, {15761, 13831}, {15822, 13833}, {15749, 13836}, {15775, 13837}, {15821, 13838},
+    {15810, 13839}, {924, 13840}, {15768, 13842}, {15775, 13843}, {15759, 13844}, {15779, 13845}, {15766, 13847}, {15766, 13848},
+    {15761, 13849}, {15987, 13850}, {15974, 13851}, {15981, 13852}, {15964, 13853}, {15984, 13854}, {15984, 13856}, {15757, 13841},
+    {643, 13857}, {15975, 13892}, {15958, 13858}, {15998, 13859}, {15998, 13860}, {15968, 13861}, {15954, 13862}, {15994, 13863},
+    {15981, 13892}, {15982, 13892}, {15994, 13864}, {15991, 13865}, {15971, 13872}, {15989, 13880}, {15991, 13881}, {15994, 13867},
+    {15998, 13868}, {15973, 13869}, {15930, 13870}, {15987, 13871}, {15985, 13873}, {15987, 13874}, {15988, 13875}, {1690, 13876},
+    {15990, 13877}, {15947, 13878}, {15897, 13882}, {15951, 13883}, {15941, 13879}, {15958, 13884}, {15993, 13885}, {15946, 13886},
+    {15997, 13905}, {15991, 13887}, {15966, 13888}, {15966, 13889}, {15894, 13890}, {15967, 13893}, {15945, 13901}, {15947, 13900},
+    {15988, 13905}, {15995, 13905}, {15999, 13894}, {15994, 13894}, {15936, 13895}, {15936, 13896}, {15953, 13879}, {15967, 13897},
+    {15965, 13898}, {15967, 13899}, {15940, 13902}, {15975, 13903}, {15956, 13904}, {15967, 13906}, {15944, 13907}, {15956, 13908},
+    {15961, 13909}, {15953, 13910}, {15958, 13911}, {2417, 13952}, {15920, 13912}, {15899, 13913}, {15912, 13914}, {15925, 13920},
+    {15905, 14053}, {15919, 13928}, {15918, 13929}, {15916, 13916}, {15928, 13917}, {15910, 13918}, {15933, 13919}, {16045, 13921},
+    {15912, 14053}, {15911, 14053}, {15933, 13923}, {15927, 13931}, {15925, 13930}, {15885, 13924}, {15911, 13925}, {15883, 13926},
+    {15934, 13927}, {15923, 13932}, {15908, 13933}, {15879, 13934}, {15924, 13935}, {15934, 13936}, {15934, 13937}, {15935, 13938},
+    {15926, 13939}, {15926, 13940}, {15926, 13941}, {15876, 13942}, {16059, 13943}, {15882, 13944}, {15882, 13945}, {15882, 13946},
+    {1880, 13953}, {15877, 14052}, {605, 13954}, {15881, 14055}, {15924, 13947}, {15896, 13948}, {15896, 13949}, {15877, 13950},
+    {15874, 14052}, {15887, 14052}, {15887, 14055}, {15872, 14055}, {15879, 13951}, {15897, 13955}, {15898, 13956}, {15898, 13957},
+    {15898, 13958}, {15878, 13968}, {15890, 13976}, {15890, 13977}, {15900, 13960}, {15888, 13961}, {15888, 13962}, {15886, 13963},
+    {15903, 13964}, {15895, 13965}, {15893, 13966}, {15895, 13967}, {15892, 13969}, {16106, 13970}, {16106, 13971}, {16102, 13972},
+    {16096, 13973}, {16097, 13974}, {16100, 13975}, {16097, 13978}, {16096, 13981}, {16010, 13983}, {16011, 13984}, {16012, 13985},
+    {16099, 13986}, {16103, 13987}, {16106, 13988}, {16117, 13989}, {1568, 13990}, {16120, 13992}, {16121, 13993}, {16119, 13994},
+    {16123, 13995}, {16127, 13996}, {16118, 13997}, {16114, 14047}, {16105, 13998}, {16067, 13999}, {16112, 14000}, {82, 14001},
+    {16033, 14002}, {16068, 14016}, {16113, 13997}, {16087, 14040}, {16065, 14004}, {16086, 14005}, {16084, 14006}, {2123, 14007},
+    {16127, 14036}, {16068, 14008}, {16073, 14009}, {16080, 14010}, {16078, 14012}, {480, 14014}, {2568, 14015}, {140, 14017},
+    {16118, 14036}, {16069, 14036}, {16064, 14018}, {16068, 14019}, {16068, 14020}, {1002, 14021}, {16046, 14022}, {622, 14025},
+    {16064, 14026}, {16067, 14027}, {16049, 14028}, {16065, 14030}, {16084, 14031}, {16052, 14032}, {16080, 14033}, {16066, 14034},
+    {16104, 14035}, {16083, 14037}, {16081, 14038}, {16084, 14039}, {16094, 14041}, {16103, 13994}, {16006, 14043}, {16084, 14044},
+    {16085, 14045}, {16050, 14048}, {16029, 14049}, {16046, 14050}, {16047, 14051}, {16045, 14054}, {16047, 14056}, {16037, 14057},
+    {2000, 14080}, {16019, 14059}, {1482, 14060}, {16056, 14061}, {248, 14062}, {16060, 14063}, {16016, 14064}, {16036, 14065},
+    {16040, 14181}, {16036, 14066}, {16038, 14067}, {2355, 14069}, {384, 14071}, {16083, 14072}, {16084, 14073}, {16085, 14074},
+    {16035, 14181}, {16046, 14181}, {16051, 14075}, {16057, 14076}, {2462, 14078}, {16088, 14079}, {16053, 14081}, {16050, 14085},
+    {16036, 14046}, {16053, 14086}, {16059, 14087}, {16103, 14088}, {16059, 14089}, {1871, 14090}, {16062, 14191}, {16061, 14091},
+    {2469, 14092}, {16011, 14093}, {16186, 14094}, {16001, 14095}, {16105, 14096}, {16187, 14097}, {16009, 14191}, {16004, 14191},
+    {16002, 14185}, {16013, 14098}, {16003, 14099}, {16108, 14100}, {1597, 14101}, {16012, 14192}, {16044, 14102}, {16013, 14103},
+    {16012, 14185}, {16003, 14185}, {16184, 14104}, {16079, 14105}, {16020, 14192}, {16006, 14192}, {16001, 14106}, {16040, 14107},
+    {16235, 14108}, {16122, 14109}, {16019, 14110}, {16019, 14111}, {16125, 14112}, {16025, 14113}, {16069, 14114}, {16133, 14115},
+    {16189, 14116}, {16233, 14117}, {16225, 14118}, {16138, 14119}, {16255, 14120}, {1425, 14121}, {16171, 14122}, {16227, 14123},
+    {16225, 14124}, {1595, 14125}, {16225, 14126}, {16150, 14127}, {502, 14128}, {16157, 14129}, {16197, 14130}, {16161, 14133},
+    {16205, 14134}, {16205, 14135}, {16204, 14154}, {16195, 14137}, {16218, 14138}, {16129, 14139}, {2253, 14141}, {711, 14143},
+    {16196, 14136}, {16226, 14112}, {16244, 14115}, {422, 14144}, {16224, 14109}, {2164, 14146}, {16197, 14148}, {16197, 14149},
+    {16207, 14136}, {16199, 14150}, {16217, 14151}, {16218, 14152}, {16218, 14153}, {16218, 14155}, {16246, 14119}, {2062, 14208},
+    {16213, 14309}, {1606, 14156}, {16198, 14133}, {16219, 14157}, {16184, 14158}, {16215, 14159}, {16243, 14127}, {16200, 14161},
+    {16220, 14309}, {16211, 14309}, {16210, 14162}, {16200, 14163}, {1028, 14164}, {16135, 14165}, {2362, 14166}, {16203, 14167},
+    {16294, 14168}, {16192, 14169}, {16178, 14170}, {16177, 14172}, {16161, 14173}, {16178, 14174}, {2010, 14175}, {16170, 14176},
+    {1290, 14177}, {16167, 14178}, {16199, 14179}, {16174, 14180}, {811, 14182}, {16201, 14183}, {2563, 14184}, {16174, 14187},
+    {16165, 14188}, {16246, 14189}, {16076, 14046}, {16166, 14190}, {16160, 14193}, {16166, 14194}, {16020, 14100}, {16177, 14209},
+    {16185, 14323}, {16233, 14196}, {16178, 14197}, {1802, 14198}, {2390, 14199}, {1076, 14200}, {1304, 14201}, {16184, 14209},
+    {272, 14202}, {16183, 14203}, {322, 14204}, {16184, 14205}, {2592, 14206}, {16181, 14207}, {1116, 14210}, {16182, 14211},
+    {16190, 14212}, {16218, 14214}, {16180, 14215}, {16189, 14216}, {16184, 14217}, {16171, 14219}, {1890, 14220}, {2742, 14221},
+    {16142, 14222}, {16138, 14223}, {16139, 14224}, {16143, 14225}, {16183, 14226}, {16233, 14227}, {16208, 14228}, {16132, 14229},
+    {16128, 14230}, {16152, 14231}, {16152, 14232}, {2147, 14233}, {16239, 14234}, {16202, 14235}, {16241, 14236}, {16151, 14238},
+    {16243, 14240}, {16131, 14241}, {16155, 14242}, {2656, 14243}, {423, 14244}, {16246, 14245}, {16153, 14246}, {16153, 14247},
+    {16157, 14248}, {16159, 14249}, {16164, 14250}, {16144, 14251}, {2132, 14252}, {16136, 14253}, {16137, 14255}, {16255, 14256},
+    {929, 14257}, {16360, 14258}, {16352, 14259}, {16372, 14260}, {2553, 14261}, {1633, 14262}, {16313, 14263}, {16318, 14265},
+    {16366, 14266}, {16366, 14267}, {16366, 14268}, {16379, 14269}, {16342, 14270}, {16359, 14271}, {16305, 14272}, {16382, 14273},
+    {16269, 14274}, {16270, 14275}, {2392, 14276}, {1292, 14277}, {1582, 14278}, {16356, 14279}, {16272, 14280}, {16334, 14281},
+    {397, 14282}, {16380, 14283}, {16358, 14284}, {16373, 14285}, {1771, 14286}, {644, 14288}, {998, 14289}, {16277, 14290},
+    {16371, 14291}, {16279, 14292}, {16369, 14293}, {16370, 14294}, {16376, 14296}, {16284, 14297}, {16367, 14304}, {16377, 14312},
+    {16379, 14313}, {415, 14300}, {2240, 14336}, {16379, 14301}, {16328, 14302}, {2569, 14303}, {16333, 14306}, {16335, 14307},
+    {16320, 14437}, {16320, 14308}, {16373, 14310}, {16326, 14311}, {16300, 14314}, {16279, 14315}, {16321, 14316}, {16321, 14317},
+    {16331, 14437}, {16326, 14437}, {16349, 14327}, {16350, 14319}, {16337, 14321}, {16338, 14322}, {16341, 14324}, {16346, 14326},
+    {16320, 14325}, {16345, 14328}, {16333, 14329}, {2378, 14330}, {16334, 14332}, {16343, 14325}, {16329, 14337}, {16347, 14345},
+    {16345, 14344}, {16260, 14334}, {16333, 14338}, {16295, 14346}, {16293, 14347}, {16288, 14339}, {16305, 14341}, {16291, 14349},
+    {16324, 14295}, {16289, 14348}, {16303, 14342}, {16327, 14343}, {16289, 14350}, {16278, 14351}, {16318, 14352}, {16318, 14353},
+    {118, 14354}, {16272, 14355}, {16442, 14356}, {16290, 14357}, {16269, 14358}, {16318, 14359}, {16314, 14360}, {16314, 14361},
+    {16301, 14455}, {16317, 14362}, {16319, 14363}, {16307, 14364}, {16302, 14368}, {16314, 14376}, {16314, 14377}, {16314, 14366},
+    {16292, 14455}, {16299, 14455}, {16352, 14367}, {16317, 14369}, {434, 14371}, {16257, 14372}, {16259, 14373}, {16261, 14374},
+    {16258, 14370}, {16260, 14406}, {16287, 14375}, {16286, 14378}, {16304, 14379}, {16261, 14370}, {16266, 14380}, {16302, 14381},
+    {16258, 14406}, {16271, 14406}, {16281, 14382}, {16283, 14383}, {16285, 14384}, {16373, 14385}, {16274, 14386}, {16278, 14387},
+    {16294, 14388}, {16270, 14389}, {16270, 14390}, {16380, 14391}, {16271, 14400}, {16485, 14408}, {16490, 14392}, {16486, 14393},
+    {16503, 14394}, {16493, 14395}, {16495, 14396}, {16483, 14397}, {16491, 14399}, {1574, 14464}, {16496, 14401}, {16499, 14402},
+    {16490, 14398}, {990, 14465}, {16495, 14565}, {16428, 14403}, {16498, 14564}, {16429, 14404}, {16490, 14407}, {16510, 14415},
+    {16274, 14385}, {16510, 14414}, {16486, 14565}, {16501, 14565}, {16509, 14564}, {16496, 14564}, {2620, 14466}, {1338, 14467},
+    {16506, 14567}, {288, 14468}, {16511, 14566}, {16463, 14410}, {16450, 14561}, {16454, 14411}, {16485, 14391}, {2650, 14469},
+    {16501, 14567}, {16504, 14567}, {16502, 14566}, {16453, 14566}, {16461, 14561}, {16448, 14561}, {202, 14470}, {16493, 14398},
+    {16457, 14560}, {16453, 14412}, {16460, 14563}, {16450, 14413}, {16475, 14416}, {16435, 14418}, {16308, 14343}, {16465, 14419},
+    {16448, 14560}, {16457, 14560}, {16455, 14563}, {16458, 14563}, {1785, 14420}, {16473, 14421}, {16463, 14422}, {16397, 14423},
+    {16440, 14424}, {16459, 14432}, {16361, 14295}, {16477, 14440}, {16479, 14441}, {1171, 14429}, {803, 14431}, {16479, 14434},
+    {16445, 14435}, {16446, 14436}, {16447, 14438}, {16448, 14439}, {16414, 14442}, {16438, 14443}, {1763, 14444}, {16261, 14367},
+    {16417, 14409}, {16418, 14445}, {16510, 14446}, {16433, 14447}, {16432, 14448}, {16420, 14450}, {16443, 14451}, {2242, 14452},
+    {16421, 14453}, {1554, 14454}, {16408, 14456}, {16459, 14457}, {16502, 14458}, {1697, 14459}, {16425, 14460}, {16391, 14461},
+    {16419, 14462}, {16490, 14463}, {16491, 14471}, {16443, 14472}, {16434, 14473}, {1870, 14474}, {16494, 14475}, {16495, 14478},
+    {16386, 14479}, {16392, 14481}, {16433, 14482}, {16443, 14483}, {16430, 14484}, {16388, 14485}, {16476, 14486}, {16424, 14487},
+    {16426, 14488}, {1816, 14489}, {16384, 14490}, {16404, 14491}, {16446, 14492}, {16396, 14493}, {16390, 14494}, {16406, 14495},
+    {16441, 14496}, {16385, 14497}, {16412, 14498}, {16397, 14499}, {16392, 14500}, {16436, 14501}, {16394, 14502}, {16434, 14503},
+    {16494, 14505}, {16469, 14506}, {16387, 14507}, {16430, 14508}, {16409, 14509}, {16501, 14510}, {2800, 14512}, {16425, 14513},
+    {16409, 14514}, {16401, 14515}, {16400, 14534}, {16392, 14517}, {16404, 14518}, {16452, 14519}, {16453, 14520}, {16607, 14521},
+    {16408, 14516}, {16629, 14522}, {16631, 14523}, {16515, 14524}, {16599, 14525}, {16517, 14526}, {16629, 14527}, {16626, 14528},
+    {16403, 14516}, {16621, 14529}, {16624, 14530}, {16619, 14531}, {16422, 14532}, {16611, 14533}, {16567, 14535}, {16637, 14536},
+    {16611, 14537}, {16638, 14538}, {16624, 14539}, {1797, 14540}, {1679, 14541}, {16530, 14543}, {2788, 14544}, {16553, 14545},
+    {16615, 14546}, {16609, 14547}, {16585, 14548}, {16636, 14549}, {16624, 14550}, {16631, 14551}, {2415, 14552}, {16544, 14553},
+    {16617, 14554}, {16624, 14556}, {16629, 14557}, {2561, 14558}, {16630, 14559}, {16454, 14409}, {16614, 14562}, {2154, 14568},
+    {16544, 14569}, {16594, 14571}, {16637, 14572}, {16590, 14573}, {16587, 14574}, {16593, 14575}, {16633, 14576}, {16595, 14577},
+    {16631, 14578}, {16582, 14579}, {1666, 14581}, {16584, 14583}, {16576, 14584}, {16581, 14585}, {2501, 14592}, {16591, 14693},
+    {16561, 14587}, {16576, 14589}, {16607, 14590}, {16597, 14591}, {16583, 14593}, {16578, 14594}, {16597, 14693}, {16582, 14693},
+    {16525, 14595}, {16587, 14596}, {16600, 14597}, {16595, 14599}, {16571, 14601}, {16594, 14602}, {16594, 14603}, {16589, 14604},
+    {16608, 14605}, {16564, 14606}, {1336, 14607}, {16580, 14608}, {16582, 14609}, {16548, 14611}, {16572, 14612}, {16573, 14613},
+    {16544, 14698}, {16545, 14614}, {16547, 14615}, {16551, 14616}, {16551, 14617}, {16565, 14619}, {2755, 14620}, {16560, 14624},
+    {16555, 14698}, {16550, 14698}, {16554, 14627}, {16622, 14622}, {16698, 14623}, {2627, 14625}, {634, 14626}, {16545, 14628},
+    {16521, 14629}, {16572, 14630}, {16560, 14631}, {16567, 14632}, {16573, 14633}, {16560, 14635}, {1342, 14637}, {16573, 14664},
+    {16561, 14638}, {16519, 14639}, {16603, 14640}, {16515, 14641}, {16522, 14642}, {16612, 14643}, {16571, 14664}, {16564, 14664},
+    {16523, 14644}, {16614, 14645}, {16615, 14646}, {450, 14647}, {2265, 14649}, {16616, 14651}, {16514, 14653}, {16527, 14655},
+    {1844, 14656}, {16564, 14657}, {16536, 14658}, {16621, 14659}, {16512, 14661}, {16623, 14662}, {2664, 14665}, {16625, 14666},
+    {1255, 14667}, {16584, 14669}, {16530, 14670}, {16529, 14671}, {658, 14672}, {72, 14673}, {1457, 14674}, {16591, 14675},
+    {1207, 14676}, {16588, 14678}, {16540, 14679}, {16521, 14680}, {16684, 14681}, {16532, 14682}, {16537, 14683}, {16637, 14684},
+    {16539, 14685}, {16527, 14686}, {16749, 14687}, {16643, 14688}, {16702, 14689}, {16753, 14690}, {16700, 14691}, {16745, 14695},
+    {16532, 14662}, {16743, 14696}, {16762, 14697}, {16725, 14699}, {16767, 14700}, {16723, 14701}, {16748, 14702}, {16747, 14703},
+    {16655, 14704}, {16682, 14707}, {16767, 14708}, {16765, 14709}, {16736, 14710}, {16715, 14711}, {16737, 14712}, {16740, 14713},
+    {296, 14715}, {16685, 14716}, {16748, 14717}, {1997, 14718}, {16760, 14719}, {16760, 14720}, {16545, 14608}, {16754, 14721},
+    {16755, 14722}, {16755, 14723}, {16744, 14725}, {16766, 14726}, {16716, 14727}, {16708, 14728}, {16717, 14729}, {16764, 14730},
+    {16707, 14731}, {16707, 14732}, {16725, 14733}, {16712, 14734}, {16709, 14735}, {16659, 14736}, {16734, 14737}, {16735, 14738},
+    {16755, 14739}, {16710, 14740}, {16710, 14741}, {16705, 14742}, {766, 14743}, {16735, 14834}, {16689, 14744}, {16746, 14746},
+    {16732, 14745}, {16652, 14747}, {16724, 14748}, {16728, 14749}, {16718, 14750}, {16733, 14745}, {16641, 14751}, {16712, 14752},
+    {1459, 14753}, {828, 14754}, {16719, 14755}, {16721, 14756}, {16712, 14757}, {1605, 14758}, {16690, 14768}, {16678, 14776},
+    {16678, 14777}, {16674, 14760}, {16687, 14762}, {16685, 14763}, {16687, 14764}, {987, 14765}, {16686, 14792}, {2706, 14766},
+    {16754, 14767}, {1409, 14769}, {2029, 14770}, {16688, 14771}, {16702, 14773}, {1023, 14774}, {16676, 14775}, {16696, 14778},
+    {16658, 14779}, {16698, 14780}, {16656, 14781}, {16693, 14784}, {16672, 14788}, {16701, 14783}, {2093, 14785}, {1990, 14786},
+    {16688, 14787}, {16674, 14790}, {16697, 14791}, {16684, 14794}, {16646, 14795}, {16696, 14784}, {16689, 14796}, {16691, 14797},
+    {16690, 14798}, {16733, 14799}, {16694, 14800}, {16684, 14801}, {1355, 14802}, {16651, 14803}, {16731, 14804}, {16728, 14805},
+    {16653, 14806}, {16734, 14807}, {16655, 14808}, {16649, 14809}, {16649, 14810}, {16645, 14811}, {16720, 14812}, {16671, 14813},
+    {16748, 14814}, {16727, 14815}, {16724, 14816}, {16646, 14817}, {16667, 14818}, {16665, 14819}, {16667, 14820}, {435, 14821},
+    {16666, 14822}, {16667, 14823}, {805, 14824}, {16659, 14825}, {16647, 14826}, {16669, 14827}, {16651, 14828}, {16648, 14829},
+    {2516, 14832}, {16763, 14833}, {16660, 14835}, {16664, 14840}, {16652, 14846}, {16666, 14836}, {16826, 14837}, {16868, 14838},
+    {16824, 14842}, {16870, 14848}, {16830, 14879}, {16720, 14744}, {16874, 14839}, {16865, 14841}, {705, 14843}, {16829, 14844},
+    {16818, 14845}, {16865, 14847}, {16778, 14850}, {16869, 14851}, {16865, 14852}, {16867, 14853}, {16864, 14854}, {16870, 14855},
+    {16810, 14856}, {16811, 14857}, {16892, 14858}, {16895, 14859}, {16788, 14860}, {16870, 14861}, {16881, 14862}, {16791, 14863},
+    {16792, 14864}, {16890, 14866}, {16800, 14867}, {16884, 14868}, {16872, 14869}, {16834, 14870}, {16874, 14871}, {16832, 14872},
+    {16895, 14873}, {16846, 14874}, {16846, 14875}, {16848, 14876}, {16891, 14877}, {16840, 14878}, {16852, 14881}, {16832, 14889},
+    {16844, 14888}, {16858, 14882}, {16885, 14883}, {16838, 14884}, {16832, 14885}, {16862, 14886}, {16881, 14887}, {16834, 14890},
+    {16778, 14891}, {16858, 14892}, {16858, 14893}, {16858, 14894}, {16875, 14895}, {16860, 14896}, {16861, 14897}, {16851, 14898},
+    {16870, 14899}, {16846, 14900}, {16846, 14901}, {16850, 14902}, {16847, 14912}, {16857, 14920}, {16804, 14921}, {16815, 14904},
+    {16811, 14905}, {16802, 14908}, {16814, 14926}, {16838, 14906}, {16813, 14907}, {16802, 14909}, {16825, 14910}, {16941, 14911},
+    {16824, 14913}, {16813, 14908}, {16787, 14914}, {16800, 14915}, {16848, 14916}, {16825, 14917}, {16827, 14918}, {16829, 14919},
+    {16955, 14922}, {16952, 14923}, {16821, 14924}, {16822, 14925}, {16773, 14927}, {16815, 14928}, {16809, 14929}, {16822, 14930},
+    {16813, 14931}, {16942, 14932}, {16813, 14933}, {16777, 14934}, {16772, 14935}, {16829, 14936}, {16780, 14937}, {16784, 14938},
+    {16791, 14944}, {16769, 14952}, {16771, 14953}, {16771, 14940}, {16794, 14941}, {16937, 14942}, {16803, 14906}, {16769, 14943},
+    {16771, 14945}, {16821, 14916}, {16773, 14946}, {16773, 14947}, {16769, 14948}, {16774, 14949}, {16795, 14950}, {16792, 14954},
+    {16796, 14955}, {16799, 14956}, {16772, 14957}, {16807, 14958}, {16782, 14959}, {16786, 14960}, {16782, 14961}, {16790, 14962},
+    {16781, 14963}, {16936, 14964}, {16996, 14965}, {17013, 14966}, {17005, 14967}, {16982, 14968}, {17022, 14969}, {17022, 14970},
+    {16950, 14971}, {16977, 14973}, {17019, 14974}, {16996, 14975}, {16992, 14977}, {16843, 14898}, {17012, 14985}, {17008, 14984},
+    {16999, 14979}, {17009, 14987}, {17011, 14986}, {17001, 14980}, {16964, 14981}, {17009, 14982}, {16962, 14983}, {17002, 14988},
+    {17002, 14989}, {17023, 14990}, {16981, 14991}, {16983, 14992}, {16968, 14993}, {16972, 14994}, {16972, 14995}, {17017, 14996},
+    {16979, 14997}, {16989, 14998}, {16915, 14999}, {16912, 15000}, {17012, 15001}, {16984, 15002}, {16984, 15003}, {17009, 15004},
+    {16789, 14951}, {16909, 14972}, {16987, 15005}, {16965, 15006}, {16976, 15007}, {17005, 15008}, {17004, 15009}, {16991, 15010},
+    {16967, 15011}, {16976, 15012}, {821, 15013}, {1527, 15014}, {2044, 15015}, {17000, 15016}, {16982, 15017}, {16899, 15018},
+    {16987, 15019}, {16981, 15021}, {16981, 15022}, {16988, 15023}, {16980, 15069}, {16927, 15024}, {16943, 15025}, {16944, 15026},
+    {16932, 15034}, {16941, 15027}, {16942, 15028}, {16983, 15023}, {16949, 15029}, {17069, 15030}, {16949, 15040}, {16943, 15048},
+    {16941, 15049}, {71, 15032}, {17008, 15033}, {16931, 15035}, {17015, 15036}, {17012, 15037}, {16949, 15038}, {16953, 15041},
+    {16939, 15042}, {17001, 15043}, {17006, 15044}, {16906, 15050}, {16930, 15051}, {16930, 15052}, {2334, 15054}, {16950, 15056},
+    {16995, 15057}, {453, 15058}, {16992, 15059}, {16947, 15060}, {1973, 15061}, {16942, 15062}, {16946, 15063}, {16938, 15064},
+    {16896, 15065}, {16916, 15066}, {16958, 15067}, {16897, 15068}, {16995, 15070}, {16907, 15071}, {16911, 15072}, {16896, 15218},
+    {16905, 15104}, {16903, 15073}, {16926, 15074}, {17068, 15075}, {16945, 15076}, {16923, 15077}, {16901, 15078}, {16922, 15079},
+    {16899, 15104}, {16902, 15088}, {16914, 15096}, {16924, 15097}, {16922, 15081}, {16915, 15083}, {16961, 15085}, {16911, 15086},
+    {16930, 15087}, {16915, 15089}, {16919, 15090}, {2502, 15093}, {2376, 15094}, {543, 15095}, {17136, 15098}, {17116, 15099},
+    {2524, 15101}, {17086, 15102}, {17124, 15103}, {17151, 15105}, {17085, 15106}, {17032, 15107}, {17075, 15108}, {17144, 15110},
+    {17132, 15118}, {17128, 15119}, {17135, 15111}, {17148, 15120}, {17012, 14972}, {17128, 15128}, {17140, 15129}, {17144, 15113},
+    {17146, 15115}, {2118, 15116}, {17096, 15121}, {17145, 15122}, {2066, 15123}, {17107, 15125}, {17144, 15122}, {17093, 15133},
+    {17149, 15222}, {17095, 15132}, {16769, 14951}, {17108, 15126}, {17146, 15127}, {17064, 15131}, {17100, 15134}, {17096, 15135},
+    {17140, 15222}, {17093, 15222}, {1263, 15137}, {17107, 15138}, {17106, 15139}, {2046, 15140}, {17037, 15141}, {17080, 15142},
+    {17042, 15114}, {17045, 15117}, {17062, 15130}, {17098, 15136}, {17100, 15172}, {342, 15143}, {17109, 15169}, {17084, 15144},
+    {17097, 15145}, {17119, 15146}, {1348, 15147}, {17078, 15148}, {17113, 15172}, {17108, 15172}, {17116, 15169}, {17107, 15169},
+    {17112, 15170}, {17092, 15150}, {17118, 15182}, {17151, 15151}, {17074, 15152}, {17149, 15154}, {692, 15155}, {17067, 15190},
+    {17107, 15170}, {17118, 15170}, {17064, 15182}, {17063, 15182}, {17101, 15136}, {985, 15157}, {17065, 15190}, {17058, 15190},
+    {17143, 15158}, {4, 15159}, {17071, 15186}, {17038, 15160}, {17085, 15161}, {17062, 15168}, {17074, 15176}, {17087, 15162},
+    {17086, 15163}, {17075, 15164}, {17062, 15186}, {17077, 15186}, {17028, 15165}, {17083, 15174}, {17028, 15175}, {17064, 15177},
+    {17064, 15178}, {17025, 15179}, {17067, 15180}, {17044, 15181}, {17040, 15184}, {17028, 15192}, {17024, 15193}, {17119, 15187},
+    {816, 15188}, {17116, 15189}, {17033, 15191}, {17031, 15194}, {17029, 15195}, {17131, 15197}, {17048, 15199}, {17054, 15200},
+    {2152, 15201}, {17108, 15202}, {17051, 15203}, {17052, 15204}, {17048, 15205}, {17024, 15207}, {17029, 15209}, {714, 15210},
+    {17050, 15211}, {1777, 15213}, {17064, 15215}, {17049, 15216}, {17145, 15217}, {17055, 15219}, {17060, 15220}, {17042, 15221},
+    {17039, 15223}, {17049, 15231}, {17046, 15224}, {17152, 15225}, {17262, 15226}, {17271, 15233}, {17264, 15235}, {17259, 15237},
+    {17250, 15239}, {17241, 15240}, {627, 15241}, {17257, 15242}, {17253, 15243}, {17238, 15244}, {17066, 15165}, {17250, 15245},
+    {17279, 15248}, {17235, 15249}, {17060, 15144}, {17273, 15250}, {17138, 15117}, {17143, 15114}, {17275, 15251}, {17091, 15130},
+    {17276, 15252}, {1745, 15253}, {17168, 15254}, {17279, 15255}, {17255, 15256}, {17278, 15257}, {17275, 15258}, {449, 15260},
+    {17173, 15261}, {210, 15262}, {17278, 15263}, {1026, 15264}, {17278, 15265}, {17260, 15266}, {1630, 15269}, {17276, 15270},
+    {17278, 15271}, {17185, 15272}, {17219, 15273}, {17278, 15274}, {17217, 15275}, {17265, 15277}, {17217, 15278}, {136, 15279},
+    {17216, 15281}, {17232, 15282}, {17222, 15283}, {17188, 15286}, {17189, 15287}, {17273, 15288}, {17235, 15289}, {17245, 15290},
+    {17218, 15291}, {17241, 15292}, {17158, 15293}, {17196, 15294}, {17175, 15295}, {1445, 15296}, {1860, 15297}, {17172, 15301},
+    {1173, 15302}, {17223, 15303}, {17239, 15305}, {17247, 15306}, {17243, 15307}, {1037, 15311}, {17161, 15312}, {937, 15313},
+    {17242, 15314}, {17244, 15315}, {17235, 15474}, {17254, 15316}, {561, 15317}, {17233, 15318}, {17235, 15319}, {17237, 15320},
+    {17239, 15360}, {17231, 15328}, {17241, 15336}, {17243, 15337}, {17197, 15323}, {17198, 15324}, {17181, 15326}, {17207, 15327},
+    {17246, 15360}, {17201, 15329}, {17192, 15330}, {17193, 15331}, {1423, 15332}, {17223, 15333}, {17188, 15334}, {17267, 15335},
+    {17195, 15338}, {17189, 15339}, {17191, 15340}, {17215, 15341}, {17186, 15342}, {17198, 15344}, {17186, 15349}, {17200, 15343},
+    {17184, 15345}, {17191, 15346}, {17212, 15348}, {17214, 15350}, {17214, 15351}, {17214, 15352}, {17240, 15353}, {17201, 15354},
+    {17203, 15355}, {17205, 15356}, {17212, 15357}, {17205, 15358}, {17207, 15359}, {17160, 15361}, {17164, 15362}, {847, 15363},
+    {17161, 15364}, {17172, 15365}, {17205, 15366}, {17158, 15367}, {17182, 15376}, {17162, 15384}, {17162, 15385}, {17179, 15369},
+    {17154, 15462}, {17177, 15371}, {17152, 15372}, {17325, 15373}, {17171, 15374}, {17159, 15375}, {17193, 15377}, {17155, 15378},
+    {17165, 15462}, {17152, 15462}, {17167, 15379}, {17156, 15353}, {17168, 15380}, {17172, 15381}, {17172, 15382}, {17164, 15383},
+    {960, 15386}, {17182, 15487}, {17354, 15387}, {17386, 15392}, {17397, 15397}, {17397, 15393}, {17391, 15401}, {17389, 15400},
+    {17383, 15487}, {17384, 15487}, {17365, 15389}, {17407, 15390}, {17401, 15391}, {17382, 15394}, {17377, 15395}, {17400, 15396},
+    {17397, 15398}, {17379, 15399}, {17357, 15402}, {17383, 15403}, {17377, 15404}, {1877, 15405}, {17396, 15432}, {17393, 15406},
+    {17350, 15407}, {17385, 15408}, {17348, 15409}, {17393, 15410}, {1177, 15411}, {17355, 15412}, {17407, 15432}, {17394, 15432},
+    {17264, 15370}, {17404, 15446}, {17353, 15413}, {17356, 15414}, {17354, 15415}, {17359, 15416}, {17402, 15417}, {17362, 15418},
+    {17402, 15446}, {17399, 15446}, {17362, 15419}, {17350, 15424}, {17373, 15455}, {17347, 15420}, {17369, 15426}, {17355, 15434},
+    {17353, 15435}, {17344, 15422}, {17371, 15423}, {17346, 15428}, {17366, 15436}, {17366, 15437}, {17331, 15427}, {17333, 15429},
+    {17372, 15430}, {17360, 15431}, {17360, 15433}, {17352, 15440}, {17372, 15448}, {17316, 15449}, {17331, 15442}, {17317, 15450},
+    {17319, 15451}, {544, 15488}, {17317, 15589}, {17333, 15444}, {17327, 15452}, {17325, 15453}, {17337, 15443}, {17317, 15445},
+    {17342, 15456}, {17322, 15464}, {17324, 15589}, {17315, 15589}, {17322, 15465}, {17341, 15458}, {17335, 15466}, {17333, 15467},
+    {17312, 15457}, {17328, 15459}, {17338, 15460}, {2574, 15461}, {17318, 15463}, {17388, 15469}, {17288, 15470}, {17368, 15471},
+    {1549, 15472}, {17330, 15473}, {17330, 15475}, {17330, 15476}, {17337, 15479}, {640, 15480}, {1885, 15481}, {2018, 15482},
+    {674, 15483}, {17321, 15484}, {17319, 15485}, {17381, 15489}, {17376, 15490}, {17304, 15491}, {17291, 15492}, {17286, 15493},
+    {17288, 15494}, {17284, 15496}, {17283, 15498}, {2017, 15499}, {17383, 15500}, {17362, 15502}, {17306, 15503}, {17286, 15504},
+    {17387, 15505}, {17388, 15506}, {17294, 15507}, {17364, 15508}, {17391, 15510}, {17392, 15511}, {17300, 15512}, {17338, 15513},
+    {17306, 15514}, {17305, 15515}, {17311, 15516}, {17301, 15517}, {2470, 15518}, {17300, 15519}, {17318, 15520}, {17305, 15522},
+    {17295, 15523}, {17309, 15524}, {17310, 15525}, {17313, 15526}, {17312, 15527}, {17173, 15370}, {17511, 15528}, {17512, 15529},
+    {17511, 15530}, {17500, 15531}, {17521, 15532}, {17510, 15533}, {17513, 15534}, {17509, 15535}, {1948, 15536}, {17416, 15537},
+    {17506, 15538}, {17529, 15539}, {17362, 15429}, {17360, 15427}, {17446, 15540}, {404, 15541}, {17477, 15543}, {17490, 15544},
+    {17504, 15545}, {17533, 15552}, {17527, 15560}, {17528, 15546}, {17515, 15547}, {17511, 15548}, {17428, 15549}, {17429, 15550},
+    {17509, 15551}, {17480, 15553}, {17525, 15554}, {2230, 15555}, {17526, 15556}, {1169, 15557}, {17440, 15558}, {17534, 15559},
+    {17522, 15561}, {17447, 15562}, {17511, 15563}, {17521, 15564}, {17434, 15565}, {17441, 15566}, {17486, 15567}, {17474, 15568},
+    {17472, 15569}, {17489, 15570}, {747, 15573}, {17446, 15575}, {17437, 15576}, {17479, 15577}, {17501, 15578}, {17525, 15579},
+    {17503, 15580}, {17523, 15581}, {17453, 15583}, {17483, 15584}, {17429, 15585}, {17503, 15586}, {17518, 15588}, {17416, 15590},
+    {1086, 15592}, {17496, 15593}, {17479, 15594}, {17432, 15595}, {17496, 15596}, {17496, 15597}, {17483, 15598}, {17510, 15599},
+    {17486, 15600}, {17490, 15601}, {17501, 15603}, {17493, 15603}, {17490, 15604}, {17504, 15605}, {17458, 15607}, {17446, 15615},
+    {17446, 15614}, {2444, 15608}, {17446, 15609}, {17448, 15610}, {17463, 15611}, {17443, 15612}, {17447, 15613}, {17481, 15616},
+    {17445, 15617}, {17445, 15618}, {17442, 15619}, {2225, 15620}, {17448, 15621}, {17440, 15622}, {17444, 15623}, {17442, 15624},
+    {17469, 15625}, {17441, 15632}, {17459, 15640}, {17457, 15641}, {2333, 15627}, {17463, 15726}, {228, 15628}, {17455, 15629},
+    {17465, 15630}, {17449, 15631}, {17409, 15633}, {17451, 15634}, {17471, 15726}, {17470, 15726}, {17429, 15635}, {17499, 15636},
+    {17424, 15637}, {17425, 15639}, {17460, 15616}, {17467, 15642}, {17509, 15643}, {17415, 15647}, {17437, 15648}, {17461, 15649},
+    {17439, 15650}, {17459, 15651}, {17495, 15652}, {17492, 15653}, {17437, 15655}, {17431, 15663}, {17429, 15662}, {17429, 15656},
+    {17408, 15657}, {17524, 15658}, {17433, 15659}, {17410, 15660}, {910, 15661}, {17438, 15664}, {462, 15665}, {1049, 15666},
+    {366, 15669}, {17437, 15670}, {17472, 15671}, {17434, 15673}, {17594, 15674}, {2675, 15675}, {17478, 15676}, {2057, 15677},
+    {17436, 15704}, {1960, 15679}, {17537, 15681}, {17644, 15682}, {17593, 15683}, {17540, 15687}, {17541, 15689}, {17647, 15690},
+    {17431, 15704}, {17434, 15704}, {17644, 15691}, {17661, 15693}, {17584, 15694}, {225, 15695}, {17647, 15696}, {17590, 15697},
+    {17510, 15644}, {17652, 15692}, {17635, 15698}, {973, 15699}, {17550, 15700}, {17639, 15701}, {17553, 15702}, {17655, 15703},
+    {17661, 15705}, {17663, 15706}, {17638, 15707}, {17657, 15708}, {17654, 15709}, {17643, 15710}, {17640, 15711}, {621, 15712},
+    {17563, 15713}, {17657, 15714}, {17651, 15715}, {17653, 15716}, {17644, 15717}, {17615, 15718}, {17614, 15719}, {17570, 15721},
+    {17610, 15722}, {17607, 15724}, {17607, 15725}, {17621, 15727}, {17603, 15728}, {17655, 15729}, {17612, 15730}, {17604, 15731},
+    {17652, 15732}, {17558, 15733}, {17624, 15734}, {17611, 15735}, {17648, 15736}, {17602, 15737}, {17646, 15738}, {17620, 15739},
+    {17622, 15740}, {17588, 15741}, {17629, 15742}, {17625, 15743}, {17603, 15744}, {17639, 15745}, {17613, 15746}, {17637, 15747},
+    {17602, 15749}, {1987, 15750}, {17619, 15843}, {17607, 15752}, {17613, 15757}, {17570, 15751}, {17601, 15753}, {17620, 15843},
+    {17722, 15754}, {17581, 15755}, {17579, 15756}, {17606, 15758}, {17576, 15759}, {17650, 15762}, {17575, 15763}, {17571, 15764},
+    {17568, 15766}, {17572, 15767}, {17572, 15768}, {17596, 15769}, {17552, 15770}, {17572, 15771}, {17572, 15772}, {17574, 15774},
+    {17619, 15776}, {17547, 15779}, {17597, 15780}, {17592, 15782}, {17592, 15783}, {17579, 15784}, {17542, 15785}, {17582, 15786},
+    {17577, 15787}, {17597, 15797}, {17586, 15788}, {17568, 15753}, {17599, 15789}, {17723, 15792}, {17591, 15793}, {17543, 15794},
+    {17550, 15795}, {17558, 15796}, {17596, 15798}, {17552, 15799}, {17593, 15800}, {1397, 15801}, {17629, 15802}, {17591, 15803},
+    {17548, 15805}, {17642, 15806}, {17643, 15807}, {17622, 15808}, {17645, 15809}, {17424, 15644}, {17545, 15810}, {17621, 15811},
+    {17565, 15812}, {17556, 15813}, {17650, 15814}, {17562, 15815}, {552, 15816}, {17652, 15817}, {17653, 15818}, {17557, 15819},
+    {17576, 15820}, {17548, 15821}, {17548, 15822}, {17659, 15692}, {17567, 15824}, {17601, 15825}, {17606, 15827}, {17720, 15828},
+    {17551, 15829}, {17565, 15830}, {17564, 15831}, {303, 15833}, {17783, 15834}, {17726, 15835}, {17727, 15836}, {17724, 15837},
+    {17671, 15838}, {17766, 15839}, {17673, 15840}, {17775, 15841}, {17675, 15842}, {17718, 15844}, {17763, 15845}, {17678, 15847},
+    {17679, 15848}, {17743, 15849}, {1589, 15850}, {17781, 15851}, {17789, 15852}, {17705, 15853}, {17710, 15854}, {17787, 15855},
+    {17686, 15856}, {17688, 15857}, {17790, 15858}, {17791, 15859}, {2658, 15860}, {17697, 15861}, {17778, 15862}, {663, 15863},
+    {1236, 15864}, {17784, 15865}, {17696, 15866}, {17740, 15867}, {17740, 15868}, {17751, 15869}, {17786, 15870}, {17746, 15871},
+    {17747, 15872}, {17732, 15873}, {17743, 15874}, {17735, 15875}, {17758, 15876}, {17667, 15877}, {17732, 15878}, {17752, 15879},
+    {17752, 15880}, {17753, 15881}, {17728, 15882}, {17689, 15883}, {17679, 15884}, {17757, 15885}, {17732, 15886}, {17685, 15887},
+    {17721, 15888}, {17765, 15889}, {17743, 15890}, {17737, 15891}, {17738, 15892}, {17744, 15893}, {17750, 15894}, {17696, 15895},
+    {17704, 15973}, {17719, 15896}, {17690, 15897}, {17706, 15898}, {17710, 15899}, {17703, 15900}, {17701, 15901}, {17707, 15895},
+    {17703, 15902}, {17680, 15903}, {17727, 15904}, {17696, 15905}, {17716, 15913}, {17725, 15906}, {1122, 15907}, {17716, 15942},
+    {17706, 15908}, {17712, 15909}, {17713, 15910}, {17718, 15912}, {17709, 15914}, {17837, 15915}, {17714, 15942}, {17727, 15942},
+    {2482, 15916}, {17726, 15945}, {17724, 15917}, {17682, 15918}, {17692, 15919}, {17700, 15888}, {17689, 15922}, {17674, 15923},
+    {17671, 15945}, {17672, 15945}, {17693, 15924}, {17712, 15925}, {17692, 15926}, {17690, 15927}, {17695, 15928}, {17851, 15930},
+    {17672, 15931}, {17691, 15932}, {17672, 15933}, {17903, 15934}, {17890, 15935}, {17903, 15936}, {17901, 15937}, {17903, 15938},
+    {17902, 15939}, {17891, 15940}, {17877, 15943}, {17919, 15944}, {17913, 15946}, {17913, 15947}, {17888, 15948}, {17889, 15949},
+    {17912, 15950}, {17907, 16000}, {17919, 16114}, {17866, 15951}, {17890, 15952}, {17779, 15856}, {17890, 15953}, {17906, 15954},
+    {17897, 15955}, {17914, 16000}, {17908, 15956}, {17906, 15957}, {17831, 15958}, {17911, 15959}, {17908, 15960}, {17733, 15866},
+    {17668, 15911}, {17770, 15920}, {17771, 15921}, {17681, 15929}, {17908, 15941}, {17860, 15961}, {17859, 15962}, {17916, 15963},
+    {17878, 15964}, {17878, 15965}, {17913, 15966}, {17866, 15967}, {17833, 15968}, {1210, 16001}, {17886, 15969}, {17905, 15970},
+    {17867, 16100}, {17858, 15971}, {17882, 15972}, {17882, 15974}, {17882, 15975}, {17887, 15976}, {17885, 15977}, {17887, 15978},
+    {17858, 16100}, {17865, 16100}, {17884, 15979}, {17865, 15980}, {17814, 15981}, {17871, 15982}, {17890, 15983}, {17875, 15984},
+    {17868, 15985}, {17823, 15986}, {17836, 15987}, {17821, 15988}, {17847, 15989}, {17841, 15990}, {17846, 15991}, {17817, 15992},
+    {17834, 15993}, {17864, 15994}, {17866, 15995}, {17848, 15996}, {17811, 15997}, {17824, 15998}, {17853, 15999}, {17808, 16002},
+    {17852, 16003}, {17853, 16004}, {17847, 16005}, {17846, 16006}, {17900, 16007}, {17901, 16008}, {17843, 16009}, {17833, 16013},
+    {17793, 16014}, {17887, 16015}, {17810, 16016}, {17854, 16017}, {17804, 16018}, {17809, 16019}, {17794, 16027}, {17807, 16020},
+    {17811, 16021}, {17847, 16022}, {17794, 16023}, {17794, 16024}, {17797, 16025}, {17797, 16026}, {17798, 16028}, {17796, 16030},
+    {17816, 16031}, {17818, 16032}, {17908, 16034}, {17834, 16035}, {17844, 15994}, {17910, 16036}, {17911, 16037}, {17846, 15995},
+    {17815, 16038}, {17818, 16039}, {17862, 16040}, {17917, 16041}, {17918, 16042}, {17804, 16043}, {18015, 16044}, {18028, 16045},
+    {17976, 16047}, {17923, 16048}, {17924, 16050}, {18033, 16051}, {17980, 16053}, {18025, 16054}, {18023, 16055}, {18042, 16056},
+    {18005, 16057}, {18047, 16058}, {18019, 16059}, {2518, 16060}, {17684, 15920}, {18002, 16061}, {18016, 16062}, {17686, 15921},
+    {18045, 16064}, {17876, 15968}, {18039, 16072}, {18040, 16063}, {18043, 16065}, {18040, 16066}, {18021, 16068}, {17992, 16069},
+    {18037, 16070}, {17668, 15929}, {17704, 15911}, {18037, 16071}, {18033, 16073}, {18035, 16074}, {17914, 15941}, {17874, 15961},
+    {18036, 16075}, {18047, 16076}, {18027, 16077}, {17952, 16078}, {17994, 16079}, {18001, 16080}, {17934, 16081}, {18043, 16082},
+    {17813, 16029}, {18032, 16067}, {17951, 16086}, {17995, 16087}, {17959, 16089}, {17990, 16090}, {18038, 16091}, {17962, 16092},
+    {2643, 16093}, {17963, 16094}, {17991, 16095}, {17989, 16096}, {17991, 16097}, {17998, 16098}, {18011, 16099}, {18009, 16101},
+    {18011, 16102}, {18013, 16103}, {1497, 16128}, {18005, 16229}, {18000, 16104}, {1581, 16129}, {18009, 16228}, {18034, 16106},
+    {18002, 16107}, {17997, 16110}, {18003, 16229}, {18012, 16229}, {17997, 16112}, {17958, 16120}, {18000, 16228}, {18015, 16228},
+    {17958, 16121}, {17960, 16109}, {17964, 16111}, {17964, 16113}, {17961, 16115}, {17973, 16116}, {2396, 16130}, {17961, 16231},
+    {2351, 16117}, {17954, 16118}, {17957, 16119}, {17955, 16131}, {17978, 16156}, {17981, 16132}, {17967, 16231}, {17952, 16231},
+    {17975, 16140}, {17974, 16141}, {17981, 16123}, {17952, 16124}, {17959, 16134}, {17969, 16142}, {17971, 16143}, {18008, 16126},
+    {412, 16127}, {17963, 16144}, {17981, 16152}, {17983, 16153}, {982, 16135}, {17975, 16136}, {17935, 16137}, {17936, 16146},
+    {17981, 16226}, {17924, 16154}, {17920, 16155}, {17943, 16139}, {222, 16145}, {18022, 16147}, {17939, 16148}, {18026, 16149},
+    {17972, 16226}, {17979, 16226}, {17945, 16151}, {17931, 16159}, {17929, 16158}, {18030, 16160}, {17949, 16162}, {17943, 16170},
+    {17941, 16171}, {17926, 16163}, {17924, 16126}, {17964, 16164}, {17951, 16165}, {17949, 16166}, {17944, 16167}, {17945, 16168},
+    {17937, 16169}, {17936, 16222}, {17938, 16173}, {17934, 16174}, {17953, 16175}, {17938, 16176}, {18163, 16177}, {18142, 16178},
+    {17944, 16172}, {18159, 16179}, {18152, 16180}, {18156, 16181}, {18156, 16182}, {18054, 16183}, {18055, 16185}, {18098, 16186},
+    {17939, 16172}, {18173, 16187}, {18168, 16188}, {261, 16189}, {18175, 16190}, {18131, 16191}, {18061, 16193}, {18100, 16194},
+    {18154, 16195}, {18174, 16196}, {17821, 16029}, {18022, 16067}, {18160, 16197}, {18167, 16198}, {18172, 16200}, {18162, 16202},
+    {18095, 16203}, {2178, 16204}, {18159, 16205}, {18147, 16206}, {18119, 16207}, {18162, 16208}, {18162, 16209}, {18165, 16210},
+    {1959, 16211}, {18163, 16212}, {18153, 16213}, {18084, 16214}, {18161, 16215}, {18175, 16216}, {18119, 16217}, {18118, 16219},
+    {18124, 16220}, {18131, 16221}, {18170, 16223}, {18119, 16224}, {18132, 16225}, {18167, 16227}, {18116, 16230}, {18116, 16232},
+    {2555, 16234}, {18112, 16235}, {18113, 16236}, {18120, 16237}, {18114, 16238}, {2219, 16240}, {18118, 16242}, {18116, 16244},
+    {18059, 16245}, {18056, 16247}, {18057, 16248}, {18100, 16249}, {18134, 16250}, {18138, 16251}, {18132, 16252}, {18124, 16253},
+    {18112, 16254}, {18132, 16256}, {18049, 16257}, {18126, 16258}, {1405, 16259}, {1675, 16260}, {18126, 16261}, {18145, 16262},
+    {18130, 16263}, {18089, 16264}, {18090, 16265}, {18086, 16266}, {2049, 16267}, {18116, 16268}, {18117, 16271}, {18087, 16273},
+    {18072, 16274}, {18092, 16275}, {18087, 16276}, {18123, 16278}, {18067, 16280}, {18083, 16281}, {18108, 16288}, {18088, 16296},
+    {18105, 16282}, {18109, 16283}, {18061, 16285}, {18087, 16286}, {18081, 16287}, {18110, 16289}, {18110, 16290}, {18110, 16291},
+    {18103, 16292}, {18102, 16293}, {18089, 16294}, {18052, 16295}, {18097, 16297}, {18098, 16298}, {18097, 16299}, {271, 16301},
+    {18149, 16302}, {18144, 16303}, {18063, 16304}, {18109, 16305}, {18108, 16306}, {18049, 16307}, {18057, 16308}, {18068, 16309},
+    {18141, 16310}, {18074, 16311}, {18060, 16312}, {18053, 16313}, {18099, 16314}, {18098, 16315}, {18074, 16316}, {18074, 16317},
+    {574, 16318}, {18096, 16266}, {18092, 16319}, {18048, 16320}, {18048, 16321}, {18074, 16322}, {18088, 16323}, {18060, 16324},
+    {18065, 16347}, {18060, 16325}, {18077, 16326}, {18062, 16336}, {18074, 16344}, {18074, 16345}, {18065, 16328}, {18283, 16329},
+    {18072, 16347}, {18071, 16347}, {18290, 16330}, {18223, 16331}, {18280, 16332}, {18284, 16333}, {18284, 16334}, {18281, 16335},
+    {93, 16384}, {18278, 16485}, {18275, 16337}, {18272, 16338}, {18231, 16340}, {18277, 16341}, {18300, 16342}, {18254, 16343},
+    {18284, 16485}, {18273, 16485}, {18303, 16346}, {18252, 16348}, {18272, 16349}, {18272, 16350}, {18220, 16351}, {18277, 16353},
+    {18292, 16339}, {18302, 16361}, {18302, 16360}, {18287, 16355}, {18260, 16354}, {18263, 16354}, {18285, 16356}, {18292, 16357},
+    {18248, 16358}, {18248, 16359}, {18257, 16362}, {18300, 16363}, {18249, 16364}, {18240, 16365}, {18261, 16366}, {18255, 16367},
+    {18252, 16368}, {18246, 16369}, {18265, 16370}, {18292, 16371}, {18241, 16372}, {18271, 16374}, {18249, 16382}, {18251, 16383},
+    {18263, 16375}, {18245, 16376}, {18265, 16377}, {18240, 16378}, {18201, 16379}, {18247, 16385}, {18257, 16393}, {18259, 16392},
+    {18279, 16381}, {18253, 16386}, {18277, 16387}, {18256, 16388}, {18265, 16389}, {18254, 16390}, {18273, 16391}, {18258, 16394},
+    {18212, 16395}, {18212, 16396}, {18209, 16397}, {18216, 16398}, {18220, 16399}, {18220, 16400}, {18211, 16401}, {18362, 16402},
+    {18211, 16403}, {18209, 16404}, {18211, 16405}, {190, 16406}, {18218, 16499}, {402, 16407}, {18223, 16498}, {18190, 16408},
+    {18214, 16409}, {18214, 16410}, {18239, 16411}, {18237, 16412}, {18213, 16499}, {18216, 16499}, {18214, 16498}, {18229, 16498},
+    {18239, 16413}, {18236, 16414}, {18224, 16415}, {18224, 16416}, {18216, 16418}, {18236, 16426}, {18232, 16427}, {18230, 16419},
+    {18230, 16420}, {18230, 16421}, {18196, 16422}, {18181, 16423}, {18185, 16424}, {18187, 16425}, {18189, 16428}, {18190, 16429},
+    {18190, 16430}, {18190, 16431}, {18187, 16432}, {18187, 16433}, {18188, 16434}, {18262, 16436}, {18285, 16437}, {18187, 16438},
+    {380, 16439}, {18224, 16441}, {18181, 16442}, {18183, 16443}, {18254, 16444}, {18188, 16449}, {18182, 16450}, {18295, 16451},
+    {2291, 16452}, {18184, 16453}, {18199, 16454}, {18203, 16455}, {18202, 16456}, {18194, 16457}, {18189, 16458}, {1766, 16460},
+    {18302, 16461}, {18195, 16462}, {18404, 16463}, {438, 16464}, {491, 16465}, {18360, 16466}, {18307, 16467}, {1158, 16468},
+    {2442, 16469}, {18422, 16470}, {18303, 16339}, {18422, 16471}, {18407, 16472}, {18402, 16473}, {18407, 16474}, {18428, 16475},
+    {18411, 16477}, {18409, 16478}, {18404, 16479}, {18402, 16480}, {18403, 16481}, {18422, 16482}, {18431, 16483}, {18419, 16484},
+    {18400, 16486}, {18416, 16487}, {18416, 16488}, {18423, 16489}, {18402, 16490}, {18431, 16491}, {18410, 16492}, {18412, 16493},
+    {242, 16495}, {18419, 16496}, {18416, 16497}, {18372, 16500}, {18414, 16502}, {18410, 16503}, {18368, 16504}, {18378, 16505},
+    {18378, 16506}, {18381, 16507}, {18388, 16508}, {18378, 16509}, {269, 16510}, {483, 16511}, {18381, 16512}, {18388, 16513},
+    {18308, 16514}, {18399, 16516}, {18347, 16518}, {18368, 16519}, {18380, 16520}, {18350, 16521}, {18378, 16522}, {18387, 16523},
+    {18353, 16524}, {1762, 16525}, {18387, 16526}, {18397, 16527}, {18375, 16528}, {18384, 16529}, {2316, 16531}, {18358, 16532},
+    {18393, 16533}, {18391, 16534}, {18378, 16535}, {18405, 16536}, {18383, 16537}, {1151, 16538}, {18310, 16539}, {18365, 16540},
+    {18380, 16541}, {18380, 16542}, {18368, 16543}, {18344, 16545}, {18345, 16546}, {18343, 16547}, {18336, 16548}, {18344, 16549},
+    {18348, 16550}, {18363, 16551}, {18342, 16552}, {18340, 16553}, {18336, 16554}, {18344, 16555}, {18351, 16556}, {18364, 16557},
+    {18363, 16558}, {18361, 16559}, {18363, 16560}, {18409, 16562}, {18315, 16563}, {18352, 16564}, {18412, 16565}, {18359, 16547},
+    {18361, 16566}, {1103, 16567}, {18354, 16568}, {18490, 16569}, {18362, 16570}, {18404, 16572}, {18362, 16573}, {18313, 16574},
+    {18361, 16594}, {18314, 16575}, {18316, 16576}, {18312, 16577}, {18316, 16578}, {18319, 16579}, {18325, 16581}, {18319, 16589},
+    {18352, 16594}, {18367, 16594}, {18317, 16588}, {18307, 16583}, {18385, 16584}, {18313, 16585}, {18334, 16586}, {18353, 16587},
+    {18306, 16590}, {18416, 16591}, {18306, 16592}, {18305, 16593}, {18304, 16595}, {475, 16596}, {460, 16640}, {18333, 16741},
+    {18331, 16597}, {18329, 16598}, {18308, 16599}, {18343, 16600}, {18317, 16601}, {18426, 16602}, {18427, 16603}, {18327, 16604},
+    {18325, 16605}, {18327, 16606}, {18373, 16607}, {18491, 16608}, {1873, 16609}, {18525, 16610}, {18539, 16611}, {18538, 16613},
+    {18551, 16617}, {18415, 16500}, {18438, 16618}, {18549, 16619}, {18442, 16622}, {18553, 16624}, {18539, 16632}, {18537, 16633},
+    {18440, 16620}, {2714, 16626}, {18484, 16627}, {18447, 16628}, {932, 16629}, {553, 16630}, {18558, 16631}, {18552, 16634},
+    {18558, 16755}, {18476, 16635}, {18455, 16636}, {18503, 16638}, {18457, 16639}, {18501, 16642}, {351, 16644}, {18500, 16645},
+    {18547, 16641}, {508, 16646}, {18470, 16647}, {18552, 16648}, {18551, 16649}, {18548, 16650}, {18510, 16651}, {18504, 16652},
+    {18557, 16641}, {18456, 16653}, {18506, 16654}, {1107, 16656}, {18462, 16657}, {18496, 16658}, {18511, 16659}, {18508, 16660},
+    {18502, 16661}, {18526, 16662}, {964, 16663}, {18501, 16664}, {18510, 16665}, {18496, 16666}, {18526, 16667}, {18452, 16668},
+    {18505, 16669}, {18498, 16670}, {18517, 16671}, {18527, 16672}, {18483, 16673}, {18496, 16674}, {18508, 16675}, {18515, 16676},
+    {18520, 16677}, {18519, 16678}, {18534, 16679}, {18510, 16680}, {2126, 16681}, {18433, 16682}, {18514, 16683}, {18514, 16684},
+    {18509, 16685}, {18528, 16686}, {18484, 16687}, {18555, 16688}, {18491, 16690}, {18481, 16695}, {18618, 16691}, {18472, 16692},
+    {18474, 16693}, {1004, 16694}, {18472, 16723}, {18453, 16697}, {18469, 16698}, {18479, 16693}, {417, 16699}, {18467, 16700},
+    {18510, 16701}, {18619, 16702}, {18493, 16703}, {18447, 16704}, {18469, 16705}, {18471, 16706}, {18487, 16707}, {18471, 16708},
+    {18442, 16709}, {18491, 16710}, {18495, 16711}, {1999, 16712}, {18491, 16713}, {18438, 16714}, {18495, 16715}, {18485, 16716},
+    {18487, 16717}, {18478, 16718}, {18481, 16719}, {18486, 16720}, {18509, 16721}, {18449, 16722}, {18444, 16724}, {18489, 16726},
+    {18488, 16727}, {18438, 16728}, {18438, 16729}, {18457, 16730}, {18484, 16731}, {18532, 16620}, {18456, 16732}, {18541, 16734},
+    {18461, 16735}, {18454, 16736}, {426, 16737}, {360, 16738}, {18544, 16739}, {1162, 16740}, {18463, 16742}, {18546, 16743},
+    {18450, 16744}, {18510, 16745}, {2720, 16746}, {18458, 16747}, {2144, 16749}, {224, 16750}, {18473, 16751}, {18436, 16752},
+    {18471, 16753}, {18452, 16754}, {18496, 16756}, {18555, 16757}, {18556, 16758}, {18445, 16760}, {18462, 16761}, {18658, 16762},
+    {18504, 16696}, {18531, 16725}, {18557, 16759}, {18622, 16764}, {18565, 16765}, {18566, 16766}, {18567, 16767}, {1892, 16768},
+    {18610, 16769}, {2301, 16770}, {18611, 16771}, {2353, 16772}, {18572, 16773}, {18615, 16774}, {1234, 16775}, {249, 16776},
+    {18669, 16777}, {18613, 16779}, {18686, 16780}, {18577, 16781}, {18579, 16782}, {18635, 16783}, {85, 16784}, {18676, 16885},
+    {1922, 16785}, {18631, 16786}, {18595, 16787}, {18586, 16789}, {18593, 16790}, {18598, 16793}, {18674, 16885}, {18687, 16885},
+    {1057, 16794}, {18684, 16895}, {18628, 16795}, {18636, 16796}, {18632, 16797}, {18647, 16798}, {18634, 16799}, {18639, 16800},
+    {18629, 16895}, {18678, 16895}, {18589, 16801}, {18625, 16802}, {18624, 16803}, {18625, 16804}, {18644, 16805}, {18675, 16806},
+    {18649, 16807}, {18651, 16808}, {18630, 16809}, {18650, 16810}, {18646, 16811}, {18612, 16812}, {18655, 16813}, {18652, 16814},
+    {18596, 16815}, {1742, 16816}, {18610, 16817}, {18589, 16818}, {18606, 16819}, {18603, 16820}, {18586, 16821}, {18600, 16822},
+    {18650, 16853}, {18613, 16823}, {18606, 16831}, {18595, 16824}, {18592, 16825}, {18623, 16826}, {18624, 16811}, {18733, 16827},
+    {18647, 16853}, {18650, 16853}, {18634, 16815}, {18679, 16828}, {18577, 16829}, {18619, 16830}, {18597, 16832}, {18597, 16833},
+    {18641, 16812}, {18573, 16834}, {18616, 16835}, {18620, 16836}, {18619, 16837}, {18596, 16839}, {18608, 16847}, {18620, 16846},
+    {18747, 16840}, {18615, 16841}, {18611, 16842}, {18614, 17010}, {18648, 16805}, {18615, 16843}, {18612, 16844}, {18576, 16849},
+    {18618, 16896}, {18564, 16857}, {18562, 16856}, {18580, 16850}, {18451, 16725}, {18475, 16696}, {18614, 16851}, {18662, 16759},
+    {18613, 16896}, {18567, 16852}, {1180, 16897}, {1767, 16898}, {18565, 16854}, {18583, 16855}, {18584, 16858}, {18567, 16859},
+    {18570, 16996}, {18735, 16860}, {18575, 16999}, {18587, 16861}, {18591, 16862}, {18582, 16899}, {18676, 16781}, {18578, 17009},
+    {18565, 16996}, {18568, 16996}, {18566, 16999}, {18581, 16999}, {18578, 16864}, {18577, 16899}, {18576, 16865}, {18581, 16866},
+    {18564, 16845}, {18682, 16863}, {18750, 16867}, {18570, 16868}, {18592, 16869}, {18801, 16870}, {18803, 16871}, {18793, 16872},
+    {18785, 16873}, {18790, 17014}, {18813, 16874}, {18768, 16875}, {18813, 16876}, {18786, 16877}, {18807, 16878}, {18764, 16879},
+    {18792, 16900}, {18810, 16880}, {18791, 16881}, {18801, 16889}, {18814, 16882}, {18795, 16883}, {18758, 16884}, {18807, 16886},
+    {18789, 16900}, {18802, 16887}, {18807, 16888}, {18803, 16890}, {18809, 16891}, {18719, 16892}, {18767, 16893}, {18763, 16894},
+    {18754, 16901}, {18766, 17015}, {18762, 16902}, {18775, 16903}, {18704, 16904}, {18752, 16905}, {18783, 16906}, {18688, 16907},
+    {18765, 16901}, {1496, 16908}, {18755, 16912}, {18773, 16920}, {18775, 16921}, {18783, 16910}, {18758, 16911}, {18715, 16913},
+    {18767, 17001}, {18792, 16914}, {18764, 16915}, {18764, 16916}, {18789, 16917}, {18767, 16918}, {18761, 16919}, {18772, 16922},
+    {18758, 17001}, {18773, 17001}, {18773, 16923}, {18724, 16924}, {18730, 16925}, {18737, 16926}, {18861, 16927}, {18728, 16928},
+    {18742, 16929}, {18860, 16930}, {18741, 16931}, {18712, 16932}, {18724, 16933}, {18721, 16934}, {18744, 16935}, {18863, 16936},
+    {141, 16937}, {18764, 16924}, {681, 16938}, {18744, 16939}, {18727, 16940}, {18862, 16941}, {18750, 16942}, {18725, 16943},
+    {18733, 16972}, {18857, 16944}, {18737, 16975}, {18879, 16945}, {18742, 16946}, {18745, 16947}, {18777, 16948}, {18778, 16949},
+    {18724, 16972}, {18731, 16972}, {18744, 16975}, {18743, 16975}, {18729, 16950}, {18739, 16951}, {18729, 16952}, {466, 16953},
+    {18733, 16954}, {18708, 16955}, {18749, 16956}, {18696, 16957}, {18791, 16863}, {18701, 16958}, {18696, 16959}, {18696, 16960},
+    {18716, 16961}, {18742, 16962}, {18718, 16963}, {18740, 16964}, {18690, 16965}, {18692, 16966}, {18714, 17138}, {18732, 16967},
+    {18688, 16968}, {18703, 17024}, {18578, 16845}, {18688, 16969}, {1803, 16970}, {18711, 16971}, {824, 16973}, {1183, 16974},
+    {18756, 16892}, {18694, 17024}, {18712, 16976}, {18705, 16977}, {18809, 16978}, {1461, 16979}, {2381, 16980}, {18705, 16981},
+    {18696, 16982}, {18859, 16983}, {18812, 16984}, {695, 16985}, {2560, 16986}, {18712, 16987}, {18814, 16988}, {18714, 16989},
+    {18921, 16990}, {18915, 16991}, {18938, 16992}, {18917, 16993}, {18937, 16994}, {18936, 16997}, {18898, 16998}, {18917, 17000},
+    {18919, 17002}, {18942, 17003}, {18943, 17004}, {18939, 17005}, {18930, 17025}, {18942, 17139}, {18941, 17006}, {18916, 17007},
+    {18869, 17008}, {18940, 17011}, {18885, 17012}, {18927, 17013}, {18941, 17025}, {18921, 17016}, {18927, 17017}, {18852, 17018},
+    {2410, 17019}, {18934, 17020}, {18891, 17021}, {18885, 17022}, {18895, 17023}, {18852, 17026}, {18887, 17027}, {2787, 17028},
+    {18883, 17029}, {18893, 17030}, {1834, 17031}, {939, 17033}, {18933, 17034}, {18911, 17035}, {18907, 17036}, {18883, 17037},
+    {18927, 17038}, {18885, 17039}, {18887, 17040}, {18900, 17041}, {18886, 17043}, {18898, 17051}, {18898, 17050}, {18829, 17044},
+    {18890, 17046}, {18910, 17054}, {18910, 17055}, {18892, 17048}, {18932, 17047}, {18935, 17047}, {18892, 17049}, {18859, 17052},
+    {18881, 17026}, {18857, 17053}, {18859, 17056}, {18844, 17057}, {18864, 17058}, {18864, 17059}, {18869, 17060}, {18856, 17061},
+    {18874, 17063}, {18862, 17071}, {18862, 17070}, {18860, 17065}, {18855, 17066}, {18857, 17067}, {18859, 17068}, {18852, 17069},
+    {18872, 17072}, {18897, 17022}, {18872, 17073}, {18871, 17074}, {19002, 17075}, {18879, 17076}, {18877, 17077}, {18879, 17078},
+    {2768, 17079}, {18865, 17081}, {18867, 17082}, {18869, 17083}, {18863, 17088}, {18873, 17096}, {18875, 17097}, {19003, 17085},
+    {18870, 17106}, {18821, 17086}, {18825, 17087}, {18827, 17089}, {18829, 17090}, {18823, 17091}, {2593, 17093}, {18825, 17094},
+    {18865, 17106}, {18876, 17106}, {988, 17095}, {18828, 17098}, {18816, 17099}, {18816, 17100}, {2584, 17101}, {18816, 17102},
+    {18820, 17103}, {18820, 17104}, {18817, 17105}, {18843, 17107}, {18858, 17108}, {18819, 17109}, {18855, 17110}, {18854, 17111},
+    {18836, 17112}, {18825, 17120}, {18843, 17128}, {18836, 17113}, {18842, 17114}, {18836, 17115}, {19057, 17116}, {18990, 17117},
+    {19055, 17118}, {19062, 17119}, {18987, 17121}, {19032, 17122}, {19068, 17123}, {19068, 17124}, {2357, 17125}, {1284, 17126},
+    {18954, 17127}, {19054, 17129}, {19027, 17130}, {19042, 17132}, {19046, 17133}, {2531, 17134}, {18959, 17135}, {18987, 17136},
+    {19061, 17137}, {19047, 17140}, {19046, 17141}, {19066, 17142}, {19063, 17143}, {18967, 17144}, {18976, 17146}, {19060, 17147},
+    {19048, 17148}, {19010, 17149}, {19050, 17150}, {19008, 17151}, {19012, 17153}, {19029, 17154}, {18978, 17155}, {19009, 17156},
+    {19011, 17157}, {19015, 17158}, {18973, 17159}, {19014, 17160}, {19008, 17161}, {18975, 17162}, {19012, 17163}, {19013, 17164},
+    {19036, 17165}, {18973, 17166}, {19038, 17167}, {19031, 17169}, {19030, 17170}, {18958, 17171}, {19008, 17172}, {19029, 17174},
+    {19039, 17175}, {19000, 17176}, {19001, 17177}, {19002, 17178}, {221, 17179}, {19031, 17180}, {19027, 17181}, {19025, 17182},
+    {19039, 17183}, {18949, 17184}, {18980, 17185}, {19009, 17186}, {19065, 17187}, {18991, 17190}, {18998, 17191}, {19117, 17192},
+    {18984, 17193}, {18990, 17194}, {18985, 17195}, {18977, 17241}, {1471, 17197}, {1656, 17198}, {18981, 17199}, {18980, 17200},
+    {19063, 17201}, {18961, 17202}, {18976, 17195}, {452, 17203}, {19003, 17204}, {18959, 17205}, {19002, 17206}, {19002, 17207},
+    {19005, 17208}, {19005, 17209}, {18982, 17210}, {18953, 17211}, {19002, 17212}, {18951, 17213}, {18989, 17214}, {18991, 17215},
+    {18996, 17216}, {18994, 17217}, {18998, 17218}, {18989, 17219}, {19116, 17220}, {18992, 17221}, {18958, 17222}, {19041, 17224},
+    {869, 17225}, {19032, 17226}, {18958, 17227}, {18955, 17228}, {19037, 17229}, {18999, 17230}, {18956, 17231}, {19050, 17232},
+    {18944, 17233}, {19031, 17234}, {18944, 17235}, {19060, 17135}, {18971, 17236}, {18947, 17237}, {18989, 17238}, {18974, 17239},
+    {18951, 17248}, {18961, 17256}, {18972, 17257}, {18954, 17242}, {18981, 17243}, {18966, 17244}, {18960, 17245}, {18958, 17246},
+    {18977, 17247}, {18962, 17249}, {19128, 17250}, {19015, 17155}, {19176, 17251}, {19180, 17252}, {19180, 17253}, {19161, 17254},
+    {19182, 17255}, {19171, 17258}, {19188, 17259}, {19157, 17260}, {19199, 17261}, {19193, 17262}, {19171, 17263}, {19196, 17265},
+    {19176, 17273}, {19189, 17272}, {19196, 17266}, {19194, 17267}, {19197, 17394}, {19095, 17268}, {19196, 17269}, {19185, 17270},
+    {19189, 17280}, {19176, 17271}, {19121, 17274}, {19182, 17275}, {19137, 17276}, {19186, 17277}, {19105, 17278}, {19144, 17279},
+    {19196, 17280}, {19148, 17281}, {19148, 17282}, {19100, 17284}, {19101, 17285}, {19151, 17283}, {19148, 17286}, {19185, 17287},
+    {19163, 17288}, {19141, 17289}, {19162, 17290}, {19137, 17291}, {19102, 17292}, {19142, 17293}, {19164, 17294}, {19155, 17295},
+    {19176, 17296}, {19159, 17297}, {19154, 17298}, {19145, 17299}, {19094, 17300}, {19159, 17301}, {19157, 17302}, {19159, 17303},
+    {19159, 17304}, {19119, 17305}, {19117, 17306}, {19118, 17307}, {19106, 17308}, {19107, 17309}, {19106, 17310}, {19106, 17311},
+    {19135, 17312}, {19090, 17313}, {19131, 17314}, {19129, 17315}, {19107, 17316}, {19129, 17317}, {19104, 17318}, {19245, 17319},
+    {19126, 17320}, {19111, 17321}, {19123, 17322}, {19080, 17323}, {19116, 17324}, {19116, 17325}, {19124, 17308}, {19259, 17326},
+    {19076, 17328}, {19112, 17329}, {19112, 17330}, {19116, 17332}, {19128, 17340}, {19077, 17341}, {19088, 17334}, {19076, 17342},
+    {19072, 17343}, {19094, 17335}, {19129, 17336}, {19079, 17337}, {19124, 17338}, {19096, 17339}, {19096, 17344}, {19120, 17345},
+    {19076, 17346}, {19076, 17347}, {19103, 17348}, {19101, 17349}, {19103, 17350}, {19112, 17351}, {19084, 17352}, {19084, 17353},
+    {19256, 17354}, {19257, 17355}, {19109, 17356}, {19087, 17357}, {19081, 17358}, {19106, 17359}, {19082, 17360}, {19082, 17361},
+    {19140, 17268}, {19301, 17362}, {19319, 17363}, {19289, 17364}, {19207, 17365}, {657, 17366}, {19305, 17367}, {19322, 17369},
+    {19194, 17259}, {19285, 17370}, {19302, 17371}, {19142, 17278}, {19212, 17372}, {19325, 17373}, {19307, 17374}, {1738, 17375},
+    {19306, 17377}, {19313, 17378}, {19327, 17379}, {19324, 17380}, {19319, 17381}, {19297, 17382}, {1483, 17384}, {19316, 17385},
+    {19162, 17327}, {19244, 17386}, {19223, 17389}, {2241, 17390}, {19306, 17393}, {19317, 17395}, {19232, 17396}, {19268, 17397},
+    {19314, 17398}, {19305, 17399}, {19306, 17400}, {19306, 17401}, {19265, 17402}, {19279, 17403}, {19277, 17404}, {19324, 17405},
+    {19266, 17406}, {19280, 17407}, {19271, 17408}, {19266, 17409}, {19319, 17410}, {19292, 17411}, {19294, 17412}, {19274, 17413},
+    {19315, 17414}, {19289, 17415}, {19264, 17417}, {19270, 17418}, {19289, 17529}, {19295, 17420}, {19291, 17421}, {19265, 17422},
+    {19281, 17419}, {19305, 17423}, {19267, 17424}, {19303, 17425}, {19292, 17426}, {19272, 17427}, {19282, 17430}, {19287, 17431},
+    {19288, 17419}, {19236, 17432}, {19274, 17433}, {1035, 17434}, {19280, 17435}, {19237, 17436}, {361, 17437}, {19244, 17438},
+    {19242, 17439}, {780, 17440}, {19242, 17442}, {19233, 17443}, {19324, 17444}, {19252, 17445}, {299, 17447}, {19244, 17448},
+    {19236, 17449}, {19232, 17450}, {19263, 17451}, {19234, 17452}, {19278, 17454}, {31, 17455}, {19233, 17456}, {19239, 17457},
+    {1095, 17458}, {19263, 17459}, {19259, 17460}, {19250, 17461}, {19262, 17479}, {19308, 17462}, {19250, 17463}, {19249, 17464},
+    {19250, 17465}, {19252, 17466}, {19247, 17467}, {19261, 17461}, {19248, 17468}, {19262, 17469}, {19300, 17470}, {19250, 17471},
+    {19263, 17472}, {19221, 17473}, {19223, 17474}, {19299, 17475}, {19222, 17476}, {19282, 17477}, {19305, 17478}, {19280, 17480},
+    {19225, 17488}, {19211, 17496}, {19209, 17497}, {19278, 17432}, {19386, 17482}, {19248, 17484}, {19313, 17485}, {19273, 17486},
+    {19226, 17487}, {19228, 17489}, {19219, 17490}, {19240, 17491}, {19214, 17492}, {19076, 17327}, {19214, 17493}, {19223, 17494},
+    {19221, 17495}, {19223, 17498}, {19216, 17499}, {19329, 17500}, {19384, 17501}, {19432, 17502}, {19447, 17503}, {19368, 17504},
+    {831, 17505}, {19388, 17506}, {19416, 17507}, {19429, 17508}, {19453, 17511}, {19439, 17512}, {19429, 17513}, {19431, 17514},
+    {19454, 17515}, {19425, 17516}, {1791, 17517}, {1774, 17518}, {19408, 17519}, {19428, 17520}, {19428, 17521}, {19346, 17522},
+    {19310, 17483}, {19347, 17523}, {19445, 17525}, {19402, 17526}, {19441, 17527}, {19373, 17528}, {1165, 17530}, {19434, 17531},
+    {2544, 17536}, {19448, 17637}, {1536, 17532}, {19440, 17533}, {19444, 17534}, {19444, 17535}, {19358, 17538}, {1279, 17539},
+    {19392, 17542}, {19406, 17543}, {19411, 17552}, {19445, 17637}, {19397, 17560}, {19402, 17544}, {19364, 17545}, {2173, 17546},
+    {19414, 17547}, {2344, 17548}, {19403, 17549}, {19412, 17551}, {19368, 17554}, {19347, 17555}, {19396, 17556}, {19394, 17557},
+    {19401, 17558}, {19401, 17559}, {19374, 17561}, {19420, 17562}, {19376, 17564}, {19339, 17565}, {19420, 17566}, {19418, 17567},
+    {19409, 17568}, {19343, 17569}, {19416, 17571}, {19341, 17572}, {19421, 17573}, {19331, 17574}, {19386, 17575}, {19422, 17576},
+    {19427, 17577}, {19420, 17578}, {19423, 17579}, {615, 17580}, {19415, 17581}, {19365, 17582}, {19384, 17583}, {19375, 17584},
+    {19373, 17585}, {19374, 17586}, {19360, 17587}, {19398, 17589}, {19362, 17590}, {19366, 17591}, {19362, 17592}, {19385, 17593},
+    {19364, 17594}, {19404, 17595}, {19447, 17596}, {19362, 17597}, {19514, 17599}, {19368, 17600}, {19360, 17605}, {19370, 17602},
+    {488, 17664}, {19387, 17765}, {19386, 17603}, {19436, 17604}, {19388, 17765}, {19437, 17607}, {1178, 17608}, {19383, 17610},
+    {19375, 17611}, {19329, 17612}, {19378, 17613}, {19347, 17614}, {19338, 17615}, {19345, 17616}, {19500, 17617}, {19388, 17618},
+    {19340, 17620}, {19337, 17621}, {19421, 17622}, {19341, 17623}, {19328, 17624}, {19329, 17625}, {19333, 17626}, {19343, 17627},
+    {19372, 17628}, {19339, 17629}, {19356, 17630}, {2735, 17665}, {19353, 17764}, {19220, 17483}, {19552, 17631}, {19351, 17632},
+    {19350, 17633}, {19354, 17634}, {19358, 17635}, {19333, 17636}, {19351, 17638}, {441, 17639}, {19337, 17640}, {19392, 17641},
+    {880, 17644}, {19393, 17646}, {2283, 17647}, {19336, 17648}, {19453, 17649}, {19344, 17651}, {19347, 17654}, {19560, 17655},
+    {19575, 17656}, {19496, 17657}, {19462, 17658}, {599, 17659}, {1604, 17660}, {863, 17666}, {19504, 17661}, {19576, 17662},
+    {19407, 17598}, {19417, 17609}, {19558, 17767}, {19583, 17663}, {19469, 17667}, {974, 17668}, {99, 17669}, {868, 17670},
+    {19470, 17672}, {19471, 17674}, {19553, 17767}, {19564, 17767}, {2139, 17676}, {19472, 17677}, {19581, 17680}, {19476, 17681},
+    {19569, 17682}, {2792, 17683}, {19575, 17782}, {1730, 17684}, {19552, 17685}, {19562, 17687}, {19582, 17695}, {19582, 17694},
+    {19561, 17689}, {19484, 17690}, {1712, 17691}, {19485, 17692}, {19486, 17693}, {19565, 17697}, {19583, 17680}, {19527, 17705},
+    {19525, 17704}, {19480, 17698}, {19526, 17699}, {19533, 17700}, {19534, 17701}, {19528, 17702}, {19531, 17703}, {19496, 17706},
+    {19527, 17707}, {19524, 17708}, {19522, 17709}, {19525, 17756}, {19548, 17711}, {19567, 17712}, {19548, 17713}, {19548, 17714},
+    {19533, 17710}, {19546, 17715}, {19541, 17716}, {19549, 17734}, {1080, 17717}, {19542, 17744}, {19540, 17718}, {19538, 17719},
+    {19524, 17710}, {19541, 17738}, {19548, 17716}, {19533, 17728}, {19548, 17744}, {19537, 17744}, {19495, 17736}, {19493, 17737},
+    {19549, 17720}, {19497, 17722}, {19504, 17723}, {19629, 17724}, {19510, 17725}, {19505, 17726}, {19481, 17727}, {19500, 17729},
+    {19540, 17720}, {19488, 17730}, {19495, 17731}, {19491, 17732}, {19488, 17733}, {19533, 17739}, {19517, 17740}, {19472, 17741},
+    {19516, 17742}, {19517, 17743}, {19495, 17745}, {19467, 17746}, {19489, 17747}, {19465, 17748}, {19516, 17749}, {19505, 17750},
+    {19507, 17751}, {19459, 17753}, {19507, 17754}, {19500, 17760}, {19512, 17768}, {19464, 17755}, {19468, 17757}, {19466, 17758},
+    {19461, 17792}, {19468, 17906}, {19457, 17759}, {19459, 17761}, {19388, 17609}, {19378, 17598}, {19461, 17762}, {19462, 17763},
+    {19471, 17792}, {19485, 17766}, {19628, 17769}, {19485, 17776}, {19479, 17784}, {19477, 17785}, {19456, 17778}, {19475, 17786},
+    {19473, 17787}, {19640, 17772}, {19641, 17773}, {19487, 17774}, {19475, 17775}, {19493, 17779}, {19477, 17780}, {19470, 17781},
+    {19482, 17789}, {19479, 17783}, {1339, 17793}, {19688, 17788}, {19691, 17790}, {19692, 17791}, {19682, 17795}, {19710, 17796},
+    {19508, 17735}, {19547, 17752}, {19680, 17777}, {19486, 17892}, {19594, 17794}, {19665, 17797}, {19682, 17798}, {19662, 17799},
+    {19708, 17800}, {19681, 17808}, {19683, 17892}, {19692, 17892}, {19699, 17816}, {19708, 17801}, {19709, 17802}, {19684, 17803},
+    {19639, 17804}, {19617, 17805}, {19622, 17806}, {19689, 17807}, {19649, 17809}, {19700, 17810}, {19656, 17811}, {19663, 17812},
+    {19657, 17813}, {19664, 17814}, {19593, 17815}, {19659, 17817}, {19663, 17818}, {19650, 17819}, {19602, 17820}, {1621, 17821},
+    {19656, 17912}, {19699, 17822}, {19651, 17823}, {19676, 17824}, {19656, 17832}, {19673, 17825}, {19677, 17826}, {19677, 17827},
+    {19651, 17912}, {19662, 17912}, {19635, 17828}, {19676, 17829}, {19677, 17830}, {19667, 17831}, {19659, 17840}, {19677, 17848},
+    {19679, 17849}, {19669, 17834}, {19624, 17835}, {19624, 17836}, {19627, 17837}, {19624, 17838}, {19616, 17839}, {19637, 17841},
+    {19608, 17842}, {19621, 17843}, {19642, 17844}, {19605, 17845}, {19622, 17846}, {19616, 17847}, {19622, 17850}, {19641, 17865},
+    {19633, 17851}, {19642, 17852}, {19647, 17853}, {19633, 17855}, {19638, 17839}, {19634, 17856}, {19632, 17858}, {19631, 17859},
+    {19640, 17851}, {19757, 17860}, {19639, 17861}, {19636, 17862}, {19601, 17872}, {19587, 17880}, {19585, 17881}, {19664, 17828},
+    {19609, 17874}, {19595, 17882}, {19593, 17883}, {19591, 17867}, {19588, 17868}, {19613, 17870}, {19614, 17871}, {19594, 17876},
+    {19605, 17877}, {1100, 17878}, {173, 17879}, {19601, 17884}, {19603, 17885}, {19821, 17886}, {19769, 17888}, {19659, 17831},
+    {19819, 17889}, {19700, 17794}, {19825, 17890}, {19801, 17891}, {19460, 17752}, {19827, 17893}, {19797, 17894}, {19813, 17895},
+    {19811, 17896}, {19838, 17897}, {19793, 17898}, {19835, 17899}, {19791, 17900}, {19839, 17901}, {19808, 17905}, {19828, 17913},
+    {19466, 17777}, {19837, 17902}, {19519, 17735}, {19814, 17903}, {19785, 17904}, {19834, 17907}, {19818, 17909}, {19831, 17914},
+    {19816, 17915}, {2573, 17916}, {19826, 17919}, {19831, 17920}, {2151, 17922}, {19835, 17925}, {2187, 17926}, {19749, 17927},
+    {19633, 17854}, {19589, 17857}, {19590, 17863}, {19604, 17869}, {19603, 17873}, {19705, 17875}, {19780, 17921}, {19780, 17928},
+    {19787, 17929}, {19784, 17930}, {19786, 17931}, {19780, 17932}, {19785, 17933}, {19795, 17934}, {19830, 17935}, {19806, 17936},
+    {19828, 17937}, {19827, 17938}, {19779, 17939}, {19804, 17940}, {19784, 17948}, {19801, 17941}, {19800, 17942}, {19801, 17943},
+    {19799, 17944}, {19727, 17945}, {19781, 17946}, {19816, 17947}, {19797, 17949}, {19715, 17950}, {19770, 17951}, {19794, 17953},
+    {19796, 17954}, {19807, 17955}, {19755, 18001}, {19758, 17956}, {135, 17957}, {19746, 17984}, {19764, 17958}, {19764, 17960},
+    {19753, 17961}, {19798, 17955}, {19770, 17964}, {19733, 17965}, {19744, 17984}, {19757, 17984}, {19750, 17966}, {19744, 17967},
+    {19774, 17968}, {19729, 17969}, {19746, 17970}, {19898, 17971}, {19771, 17972}, {19769, 17973}, {19771, 17974}, {19795, 17975},
+    {19774, 17976}, {19774, 17977}, {19774, 17978}, {19899, 17980}, {19896, 17981}, {19747, 17956}, {19771, 17979}, {19768, 17982},
+    {19717, 17983}, {19759, 17985}, {19755, 17986}, {19756, 17987}, {19775, 17988}, {19724, 17989}, {19723, 17990}, {19724, 17991},
+    {19727, 17992}, {19725, 17993}, {19727, 17994}, {19727, 17995}, {19713, 17996}, {19723, 17997}, {19736, 17998}, {19764, 17999},
+    {19736, 18000}, {19736, 18002}, {19760, 17975}, {19897, 18003}, {19760, 18005}, {19717, 18006}, {19718, 18007}, {19718, 18016},
+    {19730, 18024}, {19730, 18025}, {19752, 18009}, {19726, 18010}, {19726, 18011}, {19735, 18012}, {19733, 18013}, {19735, 18014},
+    {19813, 17875}, {19903, 18017}, {19929, 18018}, {19955, 18019}, {19965, 18020}, {19944, 18021}, {19940, 18023}, {19924, 18027},
+    {19962, 18028}, {19962, 18029}, {19783, 17944}, {19919, 18031}, {19941, 18032}, {19943, 18033}, {19965, 18034}, {19963, 18035},
+    {19603, 17863}, {19586, 17869}, {19620, 17854}, {19625, 17857}, {19822, 17921}, {19942, 18036}, {19589, 17873}, {19913, 18037},
+    {19939, 18038}, {19948, 18039}, {19910, 18040}, {19953, 18041}, {19955, 18042}, {19954, 18043}, {19879, 18044}, {19959, 18045},
+    {19822, 18004}, {19839, 18015}, {19956, 18046}, {19908, 18047}, {19915, 18048}, {19912, 18049}, {19904, 18050}, {19925, 18051},
+    {19960, 18052}, {19908, 18053}, {1020, 18056}, {19918, 18057}, {19928, 18058}, {19907, 18059}, {19915, 18060}, {710, 18062},
+    {19918, 18155}, {19890, 18063}, {19948, 18064}, {19931, 18065}, {19855, 18066}, {19908, 18067}, {19924, 18068}, {1335, 18069},
+    {19929, 18155}, {19924, 18155}, {19896, 18070}, {19927, 18071}, {19925, 18072}, {19912, 18073}, {19939, 18074}, {19913, 18075},
+    {19844, 18076}, {19920, 18077}, {2122, 18078}, {19873, 18171}, {19888, 18079}, {19877, 18080}, {19878, 18081}, {19910, 18082},
+    {19875, 18083}, {19900, 18084}, {19879, 18171}, {19880, 18171}, {19862, 18085}, {19877, 18086}, {19877, 18087}, {19878, 18088},
+    {19893, 18089}, {19896, 18090}, {19882, 18091}, {19951, 18092}, {19926, 18093}, {19898, 18094}, {19892, 18095}, {19845, 18096},
+    {195, 18097}, {46, 18098}, {2270, 18099}, {19892, 18101}, {19881, 18102}, {19890, 18103}, {19894, 18104}, {19937, 18105},
+    {19854, 18106}, {614, 18107}, {19901, 18089}, {19939, 18108}, {19841, 18109}, {19842, 18110}, {19892, 18112}, {19842, 18113},
+    {19871, 18114}, {19849, 18122}, {19846, 18115}, {19860, 18118}, {19859, 18119}, {19955, 18120}, {19856, 18121}, {19866, 18124},
+    {19842, 18125}, {19880, 18126}, {19854, 18127}, {19876, 18128}, {19867, 18129}, {19862, 18130}, {19853, 18131}, {20013, 18132},
+    {19852, 18133}, {20062, 18134}, {20079, 18135}, {20077, 18136}, {20030, 18137}, {20076, 18138}, {20077, 18139}, {20071, 18141},
+    {20016, 18142}, {1148, 18143}, {19979, 18145}, {20077, 18146}, {19936, 18015}, {19732, 18004}, {20076, 18147}, {19982, 18148},
+    {20067, 18149}, {20011, 18150}, {760, 18151}, {20008, 18152}, {19879, 18085}, {19987, 18153}, {20014, 18154}, {20090, 18156},
+    {20093, 18157}, {19922, 18047}, {20068, 18158}, {20021, 18159}, {19926, 18050}, {20082, 18160}, {20082, 18161}, {19889, 18085},
+    {20082, 18162}, {20087, 18163}, {20078, 18164}, {20019, 18165}, {20005, 18166}, {20043, 18167}, {20050, 18168}, {19983, 18169},
+    {19861, 18111}, {20067, 18140}, {20003, 18170}, {20090, 18172}, {20050, 18173}, {20050, 18174}, {20063, 18175}, {20039, 18176},
+    {20035, 18177}, {20036, 18288}, {20035, 18179}, {20078, 18180}, {20063, 18181}, {20054, 18182}, {20063, 18183}, {20061, 18184},
+    {20042, 18178}, {20063, 18185}, {20072, 18186}, {20054, 18187}, {20043, 18192}, {20061, 18200}, {20050, 18188}, {717, 18189},
+    {20039, 18178}, {20045, 18190}, {20009, 18191}, {20010, 18193}, {20006, 18194}, {20015, 18195}, {20022, 18196}, {20141, 18197},
+    {20061, 18280}, {577, 18198}, {20007, 18291}, {19990, 18199}, {20031, 18201}, {20025, 18202}, {20045, 18203}, {20046, 18204},
+    {20052, 18280}, {20059, 18280}, {20014, 18291}, {20013, 18291}, {20026, 18205}, {20020, 18206}, {20007, 18207}, {19978, 18208},
+    {20027, 18209}, {20030, 18210}, {20023, 18211}, {19972, 18212}, {20155, 18213}, {20010, 18214}, {20026, 18215}, {19990, 18216},
+    {19983, 18217}, {19978, 18218}, {19983, 18219}, {19969, 18220}, {20024, 18221}, {19997, 18222}, {19998, 18223}, {19994, 18224},
+    {19969, 18225}, {20014, 18212}, {20022, 18204}, {20021, 18203}, {19998, 18226}, {19992, 18227}, {19986, 18228}, {19998, 18246},
+    {20009, 18229}, {19989, 18220}, {19971, 18230}, {19981, 18231}, {19986, 18232}, {19976, 18233}, {19997, 18228}, {19987, 18234},
+    {19987, 18235}, {20152, 18236}, {19991, 18237}, {19988, 18238}, {20196, 18240}, {20185, 18241}, {20213, 18242}, {20219, 18243},
+    {20182, 18244}, {20199, 18245}, {1115, 18304}, {20194, 18248}, {20173, 18249}, {20222, 18250}, {20223, 18251}, {20221, 18252},
+    {20204, 18405}, {20223, 18253}, {20220, 18254}, {20210, 18255}, {20210, 18256}, {20215, 18257}, {20206, 18258}, {20032, 18170},
+    {20199, 18405}, {20202, 18405}, {20147, 18259}, {20204, 18260}, {20223, 18261}, {20172, 18262}, {20016, 18194}, {20177, 18263},
+    {20220, 18264}, {20169, 18265}, {19865, 18111}, {20091, 18140}, {20218, 18266}, {20178, 18267}, {20178, 18268}, {20187, 18269},
+    {20214, 18270}, {20167, 18271}, {20190, 18274}, {20209, 18275}, {20162, 18276}, {20162, 18277}, {20204, 18278}, {20185, 18279},
+    {20199, 18239}, {20108, 18247}, {20139, 18272}, {20140, 18273}, {20187, 18281}, {20176, 18282}, {20180, 18283}, {956, 18284},
+    {20174, 18286}, {20182, 18287}, {20173, 18289}, {20114, 18290}, {486, 18292}, {20133, 18293}, {20200, 18294}, {20203, 18296},
+    {20217, 18297}, {20123, 18298}, {20129, 18299}, {20149, 18300}, {20133, 18301}, {20134, 18303}, {20169, 18305}, {827, 18306},
+    {20131, 18308}, {20138, 18309}, {20172, 18310}, {20140, 18311}, {20112, 18312}, {20132, 18313}, {20152, 18314}, {20134, 18315},
+    {20129, 18316}, {20206, 18317}, {20128, 18318}, {20148, 18319}, {20104, 18320}, {20139, 18321}, {20157, 18322}, {20192, 18323},
+    {20153, 18324}, {20136, 18325}, {20146, 18326}, {20140, 18327}, {20157, 18328}, {20116, 18329}, {20158, 18330}, {20108, 18331},
+    {20113, 18336}, {20098, 18344}, {20111, 18332}, {20105, 18333}, {20103, 18334}, {20101, 18335}, {20120, 18337}, {20146, 18338},
+    {20122, 18339}, {20166, 18340}, {20121, 18341}, {20127, 18342}, {20122, 18343}, {20125, 18395}, {20127, 18346}, {20118, 18348},
+    {20117, 18345}, {20112, 18349}, {20160, 18351}, {20107, 18352}, {20120, 18354}, {20110, 18355}, {20222, 18356}, {20165, 18357},
+    {20124, 18345}, {20282, 18359}, {20324, 18360}, {20331, 18361}, {20328, 18362}, {20330, 18363}, {1156, 18364}, {20342, 18366},
+    {20323, 18367}, {20312, 18369}, {20326, 18370}, {20347, 18371}, {20333, 18379}, {20322, 18372}, {20236, 18373}, {20279, 18374},
+    {20320, 18375}, {20326, 18376}, {20341, 18377}, {20344, 18378}, {20349, 18380}, {20344, 18381}, {20244, 18382}, {20348, 18383},
+    {20325, 18384}, {20296, 18385}, {20341, 18386}, {1262, 18387}, {20212, 18247}, {20328, 18388}, {20182, 18273}, {20180, 18272},
+    {20250, 18389}, {2542, 18390}, {20251, 18391}, {20343, 18392}, {20341, 18393}, {20343, 18394}, {301, 18432}, {20295, 18397},
+    {20288, 18533}, {30, 18398}, {20215, 18239}, {20261, 18399}, {20345, 18400}, {20297, 18401}, {20240, 18402}, {20312, 18403},
+    {20299, 18533}, {20294, 18533}, {20339, 18404}, {20288, 18406}, {20337, 18407}, {20315, 18408}, {20293, 18409}, {20319, 18410},
+    {20255, 18396}, {2051, 18411}, {20274, 18412}, {20314, 18413}, {20319, 18414}, {20305, 18415}, {20279, 18417}, {20311, 18418},
+    {20304, 18419}, {20306, 18420}, {20225, 18421}, {20313, 18422}, {20311, 18423}, {20308, 18424}, {20270, 18425}, {20274, 18428},
+    {20253, 18429}, {20270, 18430}, {237, 18431}, {170, 18433}, {20278, 18434}, {20265, 18435}, {20410, 18436}, {20294, 18437},
+    {20263, 18439}, {20263, 18441}, {20263, 18451}, {20244, 18443}, {20280, 18444}, {20280, 18445}, {1061, 18446}, {20260, 18448},
+    {20238, 18449}, {20281, 18450}, {20283, 18452}, {20282, 18453}, {1850, 18454}, {20257, 18456}, {20279, 18458}, {20256, 18459},
+    {1995, 18460}, {20312, 18461}, {20230, 18462}, {20276, 18463}, {20326, 18464}, {20327, 18465}, {1458, 18466}, {20277, 18467},
+    {1806, 18468}, {20319, 18469}, {20287, 18470}, {20239, 18471}, {20312, 18472}, {20323, 18473}, {20283, 18474}, {20325, 18475},
+    {20316, 18476}, {20327, 18477}, {54, 18478}, {20233, 18479}, {20228, 18480}, {20237, 18481}, {20248, 18482}, {20310, 18484},
+    {20239, 18485}, {20235, 18486}, {20272, 18487}, {20271, 18488}, {20254, 18489}, {20224, 18490}, {556, 18491}, {20297, 18492},
+    {20241, 18493}, {20252, 18494}, {20253, 18495}, {20249, 18496}, {239, 18497}, {20344, 18498}, {20291, 18499}, {2691, 18560},
+    {20245, 18661}, {20408, 18501}, {20240, 18502}, {20295, 18503}, {20231, 18505}, {20237, 18508}, {20358, 18507}, {20359, 18509},
+    {20460, 18506}, {1091, 18561}, {20457, 18660}, {20403, 18511}, {20449, 18512}, {20460, 18506}, {20472, 18513}, {20385, 18514},
+    {20407, 18515}, {20455, 18516}, {20452, 18517}, {20450, 18519}, {20474, 18520}, {20292, 18396}, {20452, 18521}, {20373, 18522},
+    {20396, 18523}, {20473, 18524}, {20464, 18525}, {20479, 18526}, {20474, 18527}, {20457, 18528}, {20400, 18529}, {20388, 18530},
+    {20459, 18532}, {20419, 18535}, {20259, 18437}, {20377, 18536}, {20417, 18537}, {20428, 18538}, {20429, 18539}, {20293, 18415},
+    {20425, 18540}, {20420, 18542}, {20393, 18543}, {20394, 18545}, {20418, 18547}, {1176, 18548}, {20467, 18549}, {20420, 18550},
+    {20347, 18500}, {20468, 18518}, {20425, 18534}, {20423, 18551}, {20420, 18552}, {20436, 18553}, {2079, 18554}, {20416, 18562},
+    {20436, 18570}, {20432, 18571}, {20405, 18558}, {20435, 18559}, {20434, 18563}, {549, 18564}, {2168, 18568}, {251, 18569},
+    {290, 18573}, {20438, 18574}, {20435, 18590}, {20428, 18534}, {1381, 18575}, {20358, 18576}, {20446, 18578}, {20439, 18580},
+    {20436, 18581}, {20392, 18582}, {20392, 18583}, {20395, 18584}, {947, 18585}, {1186, 18587}, {346, 18588}, {20392, 18589},
+    {20396, 18591}, {20396, 18592}, {20422, 18593}, {20477, 18594}, {20390, 18595}, {20384, 18596}, {20399, 18597}, {20415, 18598},
+    {1147, 18599}, {20395, 18600}, {20370, 18601}, {20384, 18602}, {20413, 18608}, {20407, 18616}, {20408, 18603}, {20409, 18604},
+    {20384, 18605}, {20525, 18606}, {20363, 18607}, {20411, 18609}, {20388, 18610}, {20400, 18618}, {20401, 18611}, {20395, 18613},
+    {20413, 18621}, {20415, 18620}, {20355, 18614}, {20403, 18615}, {20396, 18624}, {20408, 18632}, {20361, 18617}, {20362, 18619},
+    {20362, 18622}, {20362, 18623}, {20365, 18625}, {20365, 18626}, {20354, 18628}, {20357, 18629}, {20383, 18630}, {20403, 18631},
+    {20377, 18633}, {20401, 18634}, {20353, 18635}, {20376, 18636}, {20383, 18802}, {1556, 18637}, {20382, 18638}, {20357, 18639},
+    {20371, 18688}, {20524, 18640}, {20377, 18641}, {20374, 18642}, {20361, 18643}, {20388, 18644}, {20360, 18645}, {20386, 18646},
+    {20378, 18688}, {20363, 18647}, {20599, 18648}, {2443, 18689}, {20594, 18649}, {20568, 18650}, {20579, 18651}, {20577, 18652},
+    {20578, 18788}, {20580, 18653}, {20564, 18654}, {20578, 18655}, {20607, 18656}, {20451, 18500}, {20585, 18664}, {20582, 18657},
+    {20589, 18788}, {20576, 18788}, {20559, 18658}, {20581, 18659}, {20583, 18662}, {20602, 18663}, {20607, 18665}, {20604, 18667},
+    {20592, 18668}, {20592, 18669}, {20593, 18670}, {20450, 18518}, {20595, 18671}, {20597, 18672}, {20559, 18675}, {20418, 18553},
+    {20554, 18676}, {20557, 18800}, {20563, 18677}, {20595, 18678}, {20550, 18679}, {20550, 18680}, {20545, 18681}, {20546, 18691},
+    {20372, 18627}, {20593, 18666}, {20510, 18673}, {20511, 18674}, {20549, 18690}, {20566, 18699}, {20566, 18698}, {20573, 18683},
+    {20572, 18684}, {20560, 18685}, {203, 18692}, {20567, 18686}, {20556, 18690}, {20561, 18687}, {20552, 18693}, {20497, 18694},
+    {20567, 18785}, {20553, 18695}, {20577, 18696}, {20564, 18697}, {20520, 18700}, {20527, 18701}, {20523, 18702}, {20520, 18703},
+    {20574, 18785}, {20573, 18785}, {20512, 18704}, {20550, 18705}, {20551, 18706}, {20519, 18707}, {20541, 18708}, {20501, 18709},
+    {20543, 18710}, {20498, 18711}, {20518, 18712}, {20538, 18713}, {20534, 18714}, {20491, 18715}, {20539, 18716}, {20588, 18717},
+    {20567, 18718}, {20521, 18720}, {20539, 18728}, {20537, 18729}, {20522, 18721}, {20480, 18722}, {20490, 18723}, {20490, 18724},
+    {20493, 18725}, {20666, 18726}, {20488, 18727}, {1289, 18730}, {20484, 18767}, {20484, 18731}, {20482, 18732}, {20493, 18733},
+    {20485, 18783}, {20484, 18734}, {20504, 18735}, {20504, 18736}, {20495, 18767}, {20482, 18767}, {20523, 18737}, {20484, 18733},
+    {20481, 18738}, {20483, 18739}, {20505, 18740}, {20497, 18741}, {20504, 18742}, {20496, 18756}, {20503, 18743}, {20494, 18744},
+    {20652, 18745}, {20501, 18746}, {20492, 18747}, {20655, 18748}, {20499, 18742}, {20484, 18718}, {20700, 18749}, {20714, 18750},
+    {20727, 18752}, {20705, 18760}, {20718, 18751}, {20710, 18753}, {20704, 18754}, {20715, 18816}, {20512, 18714}, {20711, 18930},
+    {20707, 18755}, {20711, 18757}, {20730, 18931}, {20731, 18758}, {20728, 18759}, {20706, 18816}, {20728, 18762}, {20734, 18763},
+    {20721, 18928}, {20718, 18817}, {20729, 18818}, {20720, 18764}, {20725, 18765}, {20727, 18766}, {20550, 18674}, {20548, 18673},
+    {20534, 18704}, {20729, 18817}, {20720, 18818}, {20724, 18768}, {20680, 18769}, {20680, 18770}, {20684, 18771}, {20682, 18772},
+    {20677, 18819}, {20685, 18929}, {20379, 18627}, {20581, 18666}, {20681, 18773}, {20673, 18774}, {20672, 18934}, {20680, 18820},
+    {20684, 18819}, {1673, 18821}, {20629, 18775}, {20693, 18776}, {20619, 18779}, {20695, 18780}, {20532, 18705}, {20675, 18820},
+    {20720, 18761}, {20685, 18912}, {20701, 18781}, {20660, 18782}, {20699, 18784}, {20697, 18786}, {20676, 18787}, {20711, 18789},
+    {20683, 18912}, {20676, 18912}, {20685, 18790}, {20703, 18791}, {20693, 18792}, {20695, 18793}, {20686, 18794}, {20689, 18795},
+    {20683, 18796}, {20639, 18797}, {20650, 18798}, {20650, 18799}, {20653, 18801}, {20655, 18803}, {20662, 18804}, {20781, 18805},
+    {20660, 18806}, {20670, 18807}, {20722, 18808}, {20647, 18810}, {20642, 18811}, {20645, 18932}, {20641, 18813}, {20688, 18815},
+    {20653, 18822}, {20715, 18823}, {20668, 18824}, {20666, 18825}, {20657, 18826}, {20641, 18827}, {20664, 18828}, {20664, 18829},
+    {20644, 18822}, {20651, 18830}, {20614, 18831}, {20654, 18832}, {20655, 18833}, {20611, 18834}, {20662, 18835}, {20662, 18836},
+    {20657, 18837}, {20622, 18838}, {20616, 18839}, {20611, 18840}, {20623, 18922}, {20710, 18841}, {20620, 18842}, {20635, 18843},
+    {20780, 18844}, {20713, 18845}, {2129, 18846}, {20618, 18840}, {20661, 18847}, {20613, 18848}, {20638, 18849}, {20618, 18857},
+    {20615, 18850}, {20632, 18851}, {20632, 18877}, {20608, 18853}, {20627, 18861}, {20625, 18860}, {20637, 18854}, {20685, 18855},
+    {20618, 18856}, {20626, 18858}, {20617, 18859}, {20783, 18862}, {20793, 18863}, {20624, 18864}, {20623, 18865}, {20777, 18866},
+    {20641, 18868}, {20619, 18869}, {20851, 18870}, {1440, 18871}, {20838, 18898}, {20821, 18872}, {20863, 18873}, {20859, 18874},
+    {20838, 18878}, {20851, 18879}, {20838, 18880}, {20809, 18881}, {20833, 18898}, {20844, 18898}, {20858, 18882}, {20855, 18883},
+    {20846, 18884}, {20787, 18885}, {20843, 18886}, {20813, 18887}, {20862, 18888}, {20822, 18889}, {20822, 18890}, {20816, 18891},
+    {20811, 18892}, {20807, 18893}, {20856, 18894}, {20827, 18895}, {20854, 18896}, {20807, 18897}, {2084, 18944}, {20828, 18900},
+    {20813, 19045}, {20846, 18901}, {20710, 18761}, {20831, 18902}, {20824, 18903}, {20828, 18904}, {20828, 18905}, {20805, 18906},
+    {20804, 19045}, {20811, 19045}, {20840, 18907}, {20823, 18908}, {20836, 18909}, {20808, 18910}, {20808, 18911}, {1725, 18945},
+    {20733, 18867}, {20751, 18875}, {20753, 18876}, {20779, 18899}, {20831, 19044}, {20801, 18913}, {20784, 18914}, {20763, 18915},
+    {20776, 18916}, {20776, 18917}, {20861, 18918}, {20795, 18919}, {20822, 19044}, {20773, 19044}, {20758, 18920}, {20769, 18921},
+    {20798, 18923}, {20753, 18924}, {20770, 18925}, {20789, 18926}, {20799, 18927}, {20793, 18933}, {20768, 18935}, {20795, 18936},
+    {20794, 18937}, {20770, 18938}, {20744, 18939}, {20780, 18940}, {20742, 18941}, {20826, 18942}, {20789, 18943}, {20789, 18946},
+    {20796, 18947}, {20788, 19057}, {20751, 18948}, {20747, 18949}, {20738, 18950}, {20750, 19060}, {20748, 18951}, {20761, 18952},
+    {20791, 18947}, {20909, 18953}, {20788, 18955}, {20756, 18956}, {20749, 18950}, {20820, 18957}, {20739, 18958}, {20739, 18960},
+    {20755, 18968}, {20753, 18969}, {2678, 18961}, {20965, 18962}, {20813, 18963}, {20856, 18964}, {20774, 18965}, {20767, 18966},
+    {867, 18970}, {20766, 18971}, {20754, 18972}, {20758, 18973}, {20749, 18974}, {20752, 18975}, {20866, 18976}, {20973, 18977},
+    {20982, 18979}, {20962, 18987}, {20962, 18986}, {20925, 18980}, {20971, 18981}, {20975, 18982}, {2547, 18983}, {20913, 18984},
+    {20964, 18985}, {20965, 18988}, {20987, 19052}, {20910, 18989}, {20987, 18990}, {20991, 18991}, {20978, 19010}, {20896, 18993},
+    {20962, 19063}, {20982, 18992}, {20989, 19052}, {20897, 18994}, {20974, 19063}, {20892, 18995}, {112, 18996}, {20984, 18997},
+    {20987, 18998}, {20977, 18992}, {20971, 18999}, {20949, 19003}, {20933, 19004}, {20951, 19005}, {20963, 19063}, {20941, 19006},
+    {20774, 18913}, {2061, 19007}, {20929, 19008}, {2341, 19011}, {20852, 18875}, {20833, 18867}, {20820, 18899}, {20854, 18876},
+    {20939, 19012}, {20943, 19013}, {20930, 19186}, {20958, 19014}, {20980, 19015}, {20935, 19016}, {20933, 19017}, {20928, 19018},
+    {20956, 19019}, {20934, 19072}, {20958, 19020}, {2430, 19021}, {20931, 19022}, {20956, 19023}, {20956, 19024}, {20935, 19025},
+    {20740, 18942}, {20929, 19072}, {20970, 19026}, {20930, 19027}, {20959, 19028}, {20945, 19029}, {20946, 19030}, {20944, 19032},
+    {20900, 19031}, {20943, 19033}, {20880, 19034}, {20868, 19035}, {20927, 19036}, {20911, 19037}, {20907, 19038}, {20898, 19073},
+    {20910, 19187}, {20988, 19039}, {20935, 19040}, {1639, 19042}, {20923, 19043}, {20920, 19046}, {182, 19047}, {20909, 19073},
+    {20922, 19048}, {20940, 19049}, {20941, 19051}, {1493, 19053}, {20942, 19054}, {20926, 19055}, {20920, 19056}, {20921, 19058},
+    {20919, 19059}, {20874, 19061}, {20898, 19062}, {20898, 19064}, {20913, 19065}, {20914, 19066}, {20868, 19067}, {20956, 19068},
+    {20916, 19069}, {20917, 19070}, {20869, 19071}, {1368, 19074}, {20866, 19175}, {20885, 19075}, {20920, 19076}, {20865, 19077},
+    {20866, 19078}, {20913, 19079}, {20865, 19080}, {20866, 19088}, {20877, 19175}, {20864, 19175}, {20886, 19096}, {20890, 19081},
+    {20895, 19082}, {20870, 19083}, {21037, 19084}, {20940, 19085}, {20904, 19086}, {20876, 19087}, {20876, 19089}, {20878, 19090},
+    {20900, 19091}, {20887, 19092}, {20885, 19093}, {20880, 19094}, {20877, 19104}, {21094, 19112}, {21094, 19113}, {21049, 19097},
+    {21098, 19098}, {21100, 19099}, {21095, 19100}, {21091, 19182}, {21088, 19101}, {21089, 19102}, {21118, 19106}, {21098, 19114},
+    {21098, 19115}, {21116, 19107}, {21102, 19100}, {21070, 19108}, {21119, 19109}, {1655, 19110}, {365, 19111}, {21102, 19116},
+    {20908, 19071}, {21106, 19139}, {21111, 19138}, {21118, 19117}, {21111, 19118}, {21102, 19119}, {21043, 19120}, {21105, 19121},
+    {21104, 19139}, {21117, 19139}, {21118, 19138}, {21116, 19138}, {21065, 19122}, {21064, 19137}, {21071, 19125}, {21067, 19126},
+    {21056, 19123}, {21056, 19127}, {21011, 19128}, {21060, 19129}, {21058, 19130}, {21071, 19131}, {21083, 19145}, {21058, 19132},
+    {21067, 19123}, {21101, 19133}, {20903, 19059}, {21086, 19134}, {20905, 19067}, {21062, 19131}, {21063, 19135}, {21072, 19136},
+    {21097, 19140}, {21081, 19141}, {20937, 19031}, {21066, 19142}, {21086, 19150}, {21075, 19143}, {21064, 19144}, {21091, 19146},
+    {21072, 19147}, {21079, 19148}, {20870, 19068}, {21076, 19149}, {21038, 19151}, {21030, 19152}, {21034, 19154}, {21036, 19155},
+    {21108, 19103}, {21028, 19124}, {21058, 19153}, {21031, 19200}, {21027, 19314}, {21029, 19156}, {21053, 19157}, {21178, 19158},
+    {21029, 19159}, {21052, 19160}, {21164, 19161}, {21038, 19200}, {2506, 19201}, {21025, 19168}, {21043, 19176}, {21041, 19177},
+    {21041, 19300}, {21053, 19163}, {21028, 19164}, {21167, 19165}, {20999, 19166}, {21037, 19167}, {21039, 19169}, {20996, 19170},
+    {21048, 19300}, {21047, 19300}, {21032, 19171}, {21032, 19172}, {21047, 19173}, {21044, 19174}, {20996, 19178}, {21001, 19179},
+    {21008, 19180}, {21166, 19181}, {21007, 19183}, {21014, 19184}, {21161, 19185}, {21012, 19188}, {21046, 19189}, {20999, 19190},
+    {20992, 19191}, {21022, 19192}, {21160, 19193}, {1494, 19202}, {653, 19203}, {21022, 19194}, {20997, 19195}, {21163, 19196},
+    {21007, 19303}, {21020, 19197}, {21008, 19302}, {21003, 19198}, {21162, 19199}, {21170, 19204}, {21171, 19205}, {21016, 19206},
+    {20998, 19303}, {21013, 19303}, {21018, 19302}, {21009, 19302}, {21001, 19208}, {21010, 19209}, {21015, 19210}, {21236, 19211},
+    {21079, 19213}, {21061, 19214}, {21168, 19215}, {21131, 19216}, {21208, 19217}, {21246, 19218}, {21172, 19219}, {21219, 19220},
+    {21237, 19221}, {1755, 19222}, {21222, 19224}, {21245, 19225}, {2558, 19226}, {21006, 19211}, {21217, 19227}, {21239, 19228},
+    {21241, 19229}, {21240, 19230}, {21229, 19231}, {21245, 19232}, {21147, 19233}, {21234, 19234}, {21224, 19235}, {21245, 19236},
+    {21238, 19237}, {21189, 19238}, {21153, 19239}, {21207, 19240}, {21207, 19241}, {21194, 19242}, {21186, 19243}, {21187, 19244},
+    {21192, 19245}, {21212, 19246}, {21238, 19247}, {21185, 19248}, {21057, 19124}, {21187, 19249}, {21186, 19250}, {21031, 19153},
+    {21187, 19251}, {21195, 19252}, {21185, 19253}, {21211, 19254}, {21010, 19178}, {21186, 19255}, {21213, 19256}, {21129, 19257},
+    {21201, 19258}, {21226, 19259}, {21112, 19103}, {21208, 19260}, {21189, 19264}, {21215, 19272}, {21200, 19261}, {21221, 19262},
+    {21121, 19263}, {21202, 19265}, {21181, 19266}, {21211, 19267}, {21196, 19268}, {21242, 19269}, {2737, 19270}, {21185, 19271},
+    {21186, 19273}, {21241, 19274}, {21162, 19275}, {21164, 19276}, {21155, 19277}, {21245, 19279}, {21161, 19280}, {21181, 19281},
+    {21141, 19282}, {21152, 19283}, {21156, 19284}, {21155, 19285}, {302, 19286}, {21198, 19287}, {21136, 19288}, {21182, 19289},
+    {21227, 19290}, {21180, 19291}, {21159, 19292}, {21230, 19293}, {2645, 19294}, {21177, 19295}, {21181, 19296}, {21156, 19297},
+    {21293, 19298}, {21165, 19301}, {1859, 19304}, {2723, 19306}, {21126, 19307}, {21166, 19308}, {21166, 19309}, {1309, 19328},
+    {21181, 19429}, {21165, 19312}, {21127, 19320}, {21125, 19321}, {21133, 19311}, {642, 19315}, {21143, 19316}, {21179, 19317},
+    {21172, 19429}, {21179, 19429}, {21222, 19318}, {21132, 19319}, {21147, 19322}, {21292, 19323}, {21146, 19324}, {21173, 19325},
+    {21126, 19326}, {21204, 19327}, {1068, 19330}, {21121, 19331}, {21147, 19332}, {21145, 19333}, {21137, 19447}, {589, 19334},
+    {21149, 19335}, {21136, 19336}, {21154, 19337}, {21246, 19338}, {21189, 19339}, {21136, 19333}, {21356, 19340}, {21354, 19341},
+    {21345, 19342}, {21358, 19343}, {21365, 19344}, {21290, 19345}, {21370, 19348}, {21350, 19349}, {2715, 19351}, {21356, 19442},
+    {21351, 19352}, {21326, 19353}, {21363, 19354}, {21344, 19355}, {21323, 19356}, {21368, 19357}, {21354, 19442}, {21351, 19442},
+    {21369, 19359}, {21347, 19360}, {21319, 19361}, {21357, 19362}, {21317, 19363}, {21370, 19365}, {21358, 19366}, {21368, 19367},
+    {1947, 19369}, {21354, 19370}, {21312, 19371}, {21355, 19349}, {21280, 19372}, {21281, 19373}, {21272, 19375}, {167, 19377},
+    {21335, 19378}, {21371, 19379}, {21285, 19380}, {406, 19381}, {21323, 19382}, {2807, 19383}, {21287, 19384}, {1863, 19385},
+    {21338, 19387}, {21318, 19388}, {21327, 19389}, {21312, 19390}, {21292, 19391}, {21343, 19392}, {21341, 19393}, {21313, 19394},
+    {21341, 19395}, {21320, 19396}, {21256, 19397}, {21299, 19399}, {21262, 19400}, {21339, 19401}, {21343, 19402}, {21330, 19403},
+    {1853, 19405}, {21304, 19406}, {21312, 19408}, {7, 19456}, {21252, 19410}, {21311, 19411}, {21370, 19412}, {21293, 19413},
+    {21259, 19350}, {21333, 19557}, {21308, 19409}, {21307, 19416}, {21330, 19557}, {21297, 19421}, {1513, 19414}, {1646, 19415},
+    {21287, 19418}, {21317, 19419}, {21295, 19420}, {21292, 19422}, {21300, 19423}, {21321, 19424}, {21284, 19425}, {21282, 19426},
+    {21293, 19457}, {21285, 19571}, {21283, 19427}, {21298, 19428}, {21303, 19430}, {810, 19431}, {21331, 19432}, {21259, 19433},
+    {21284, 19457}, {21307, 19434}, {21356, 19435}, {21284, 19436}, {21290, 19437}, {21275, 19438}, {21340, 19439}, {21301, 19440},
+    {21305, 19458}, {21302, 19475}, {21250, 19441}, {21346, 19443}, {21337, 19444}, {21258, 19445}, {21260, 19446}, {21251, 19448},
+    {21254, 19449}, {2726, 19450}, {2424, 19451}, {21255, 19452}, {21265, 19454}, {21261, 19455}, {21253, 19459}, {21253, 19460},
+    {21260, 19461}, {21252, 19575}, {21275, 19463}, {21273, 19464}, {21277, 19465}, {1603, 19466}, {21324, 19467}, {21325, 19468},
+    {21255, 19461}, {21259, 19473}, {21269, 19474}, {21253, 19475}, {21370, 19477}, {21278, 19478}, {21266, 19479}, {21282, 19480},
+    {21258, 19481}, {21258, 19482}, {21479, 19483}, {21470, 19487}, {21494, 19488}, {21494, 19489}, {838, 19490}, {21380, 19491},
+    {21466, 19492}, {21480, 19493}, {21437, 19494}, {21485, 19495}, {21462, 19497}, {21502, 19498}, {21460, 19499}, {21479, 19500},
+    {21477, 19501}, {21472, 19502}, {21478, 19503}, {21499, 19504}, {21479, 19506}, {21451, 19507}, {21502, 19508}, {21502, 19509},
+    {21497, 19510}, {21491, 19511}, {21490, 19512}, {21490, 19513}, {21480, 19514}, {21442, 19515}, {21493, 19516}, {21495, 19517},
+    {21454, 19518}, {21502, 19519}, {21462, 19520}, {21462, 19521}, {21450, 19522}, {21357, 19350}, {21452, 19523}, {21343, 19409},
+    {21443, 19698}, {21452, 19524}, {21444, 19525}, {21444, 19526}, {21471, 19527}, {21490, 19528}, {21466, 19529}, {21488, 19530},
+    {21447, 19584}, {21470, 19531}, {21443, 19536}, {21461, 19544}, {21466, 19532}, {21469, 19534}, {21470, 19535}, {21469, 19538},
+    {21454, 19584}, {21463, 19539}, {21457, 19540}, {21448, 19541}, {21459, 19542}, {21454, 19543}, {21307, 19423}, {21472, 19545},
+    {21493, 19505}, {21458, 19537}, {21421, 19546}, {21427, 19552}, {21413, 19560}, {21415, 19561}, {21419, 19548}, {21425, 19549},
+    {21401, 19550}, {21427, 19551}, {21399, 19553}, {21437, 19554}, {21397, 19555}, {21408, 19556}, {21412, 19558}, {21411, 19559},
+    {21437, 19562}, {21392, 19563}, {21437, 19564}, {21439, 19565}, {21435, 19566}, {21426, 19585}, {21438, 19699}, {21385, 19567},
+    {21411, 19568}, {21421, 19569}, {21382, 19570}, {21422, 19572}, {21422, 19573}, {21437, 19585}, {1354, 19586}, {2342, 19587},
+    {21437, 19687}, {21437, 19574}, {21438, 19686}, {21389, 19576}, {21398, 19588}, {21378, 19596}, {21391, 19577}, {21384, 19578},
+    {21428, 19687}, {21435, 19687}, {21385, 19686}, {21380, 19686}, {21404, 19579}, {21430, 19580}, {21406, 19581}, {21428, 19582},
+    {21383, 19583}, {21381, 19589}, {21383, 19590}, {21562, 19591}, {21390, 19592}, {21404, 19593}, {21379, 19600}, {21397, 19608},
+    {21399, 19609}, {21395, 19595}, {21404, 19597}, {21405, 19598}, {21395, 19599}, {21398, 19601}, {21390, 19602}, {21412, 19603},
+    {21384, 19604}, {21410, 19605}, {21392, 19606}, {21608, 19607}, {21603, 19610}, {21615, 19688}, {2338, 19611}, {2511, 19612},
+    {21606, 19613}, {21606, 19614}, {21625, 19615}, {21588, 19616}, {21610, 19610}, {21624, 19617}, {21387, 19599}, {21603, 19618},
+    {21604, 19710}, {21607, 19619}, {21614, 19620}, {21626, 19670}, {21606, 19621}, {21580, 19622}, {21524, 19623}, {845, 19624},
+    {21615, 19710}, {21602, 19710}, {21625, 19620}, {21619, 19625}, {21617, 19626}, {21619, 19627}, {21620, 19628}, {21608, 19629},
+    {21620, 19661}, {21570, 19630}, {21610, 19631}, {21568, 19632}, {21581, 19634}, {21585, 19636}, {21571, 19644}, {21569, 19645},
+    {21631, 19661}, {21618, 19661}, {21625, 19637}, {21577, 19638}, {21592, 19639}, {21580, 19647}, {21573, 19640}, {21618, 19641},
+    {21594, 19642}, {21594, 19643}, {21473, 19505}, {21444, 19537}, {21571, 19646}, {21614, 19648}, {21599, 19649}, {21612, 19650},
+    {21594, 19651}, {21575, 19652}, {21585, 19660}, {21598, 19653}, {21585, 19654}, {21586, 19655}, {21586, 19657}, {21591, 19658},
+    {21536, 19633}, {21540, 19656}, {21541, 19659}, {21578, 19662}, {21600, 19663}, {21545, 19664}, {21547, 19665}, {21546, 19666},
+    {21530, 19667}, {21544, 19668}, {21557, 19669}, {21549, 19677}, {21538, 19671}, {21523, 19672}, {21539, 19673}, {21564, 19681},
+    {21544, 19689}, {21561, 19674}, {21567, 19675}, {21563, 19676}, {21554, 19712}, {21566, 19826}, {21513, 19678}, {21561, 19679},
+    {21546, 19682}, {21566, 19690}, {21555, 19680}, {21508, 19683}, {21565, 19712}, {21544, 19684}, {21544, 19685}, {21505, 19691},
+    {21547, 19692}, {21525, 19693}, {21566, 19694}, {21516, 19695}, {21521, 19696}, {21507, 19704}, {21519, 19697}, {21560, 19700},
+    {21510, 19701}, {21531, 19703}, {21517, 19711}, {21506, 19702}, {21534, 19713}, {21514, 19721}, {21514, 19720}, {21615, 19706},
+    {21579, 19707}, {21618, 19708}, {21577, 19709}, {21521, 19714}, {49, 19715}, {21520, 19716}, {21528, 19717}, {21532, 19718},
+    {21513, 19719}, {21524, 19722}, {21574, 19723}, {21528, 19724}, {21527, 19725}, {21524, 19726}, {21742, 19727}, {21742, 19728},
+    {21750, 19729}, {21724, 19730}, {21744, 19731}, {21722, 19732}, {21743, 19733}, {21740, 19734}, {21734, 19736}, {21680, 19737},
+    {21643, 19738}, {21715, 19739}, {21524, 19706}, {21731, 19740}, {21756, 19744}, {21736, 19752}, {21752, 19741}, {21672, 19742},
+    {1629, 19743}, {21651, 19745}, {21707, 19746}, {21755, 19747}, {21676, 19748}, {21758, 19749}, {21756, 19750}, {21748, 19751},
+    {21744, 19753}, {21743, 19754}, {21746, 19755}, {21745, 19756}, {21739, 19757}, {21759, 19758}, {21717, 19759}, {21757, 19760},
+    {21756, 19761}, {21706, 19762}, {21719, 19763}, {21697, 19771}, {21710, 19764}, {21573, 19633}, {2702, 19765}, {21697, 19766},
+    {21698, 19767}, {1486, 19769}, {21727, 19772}, {21747, 19773}, {21702, 19774}, {21702, 19775}, {21697, 19776}, {21716, 19777},
+    {21582, 19659}, {21697, 19778}, {21720, 19779}, {21577, 19656}, {21724, 19780}, {21724, 19781}, {21644, 19782}, {21687, 19783},
+    {21706, 19784}, {21715, 19785}, {21712, 19786}, {21719, 19789}, {21716, 19790}, {1108, 19840}, {21684, 19792}, {21651, 19793},
+    {21748, 19735}, {21716, 19768}, {21668, 19787}, {21693, 19788}, {21669, 19791}, {21669, 19941}, {21664, 19794}, {21692, 19796},
+    {21672, 19804}, {21684, 19805}, {21666, 19797}, {21645, 19798}, {21667, 19941}, {21676, 19941}, {21694, 19799}, {2069, 19841},
+    {21685, 19940}, {607, 19842}, {21686, 19943}, {21678, 19800}, {21694, 19801}, {21687, 19802}, {21678, 19803}, {21805, 19806},
+    {21692, 19940}, {21683, 19940}, {21681, 19943}, {21692, 19943}, {21687, 19807}, {21684, 19808}, {21636, 19809}, {21643, 19810},
+    {21819, 19811}, {21648, 19812}, {21691, 19813}, {21640, 19814}, {21653, 19815}, {21632, 19816}, {21637, 19817}, {21658, 19818},
+    {21632, 19819}, {21663, 19820}, {21807, 19821}, {216, 19843}, {21634, 19824}, {21654, 19832}, {21654, 19833}, {21656, 19823},
+    {21644, 19942}, {21639, 19825}, {21806, 19827}, {21674, 19828}, {21634, 19829}, {21634, 19830}, {21651, 19831}, {21642, 19834},
+    {21639, 19942}, {21642, 19942}, {21801, 19835}, {21641, 19836}, {21668, 19837}, {21649, 19838}, {21647, 19844}, {21657, 19852},
+    {21659, 19853}, {1551, 19845}, {21860, 19936}, {21859, 19846}, {21882, 19847}, {21799, 19848}, {21809, 19849}, {21772, 19850},
+    {21862, 19851}, {21885, 19854}, {21871, 19936}, {21858, 19936}, {21794, 19855}, {21883, 19856}, {21858, 19857}, {21823, 19858},
+    {21801, 19859}, {21873, 19860}, {21884, 19861}, {21885, 19862}, {21881, 19863}, {21878, 19864}, {21878, 19865}, {21865, 19866},
+    {21828, 19867}, {21864, 19868}, {134, 19869}, {21887, 19870}, {21839, 19871}, {21840, 19872}, {21828, 19880}, {21837, 19873},
+    {21884, 19960}, {21882, 19874}, {21832, 19875}, {21845, 19876}, {21839, 19884}, {21824, 19877}, {21670, 19788}, {21827, 19878},
+    {21879, 19960}, {21882, 19960}, {21824, 19879}, {21833, 19882}, {21650, 19809}, {21827, 19883}, {21807, 19885}, {21852, 19886},
+    {21711, 19787}, {21849, 19887}, {21755, 19735}, {21721, 19768}, {21851, 19888}, {21853, 19889}, {21680, 19791}, {21817, 19892},
+    {374, 19893}, {21846, 19894}, {21761, 19895}, {21767, 19897}, {21851, 19898}, {21846, 19899}, {21803, 19900}, {21807, 19901},
+    {21844, 19881}, {21850, 19891}, {1910, 19902}, {21880, 19903}, {21800, 19904}, {21804, 19905}, {21804, 19906}, {21830, 19907},
+    {21794, 19908}, {21843, 19891}, {21874, 19909}, {21833, 19911}, {21781, 19912}, {21806, 19913}, {21795, 19920}, {21823, 19924},
+    {21831, 19891}, {21792, 19934}, {21795, 19914}, {21815, 19922}, {21841, 19915}, {21773, 19916}, {21821, 19917}, {21798, 19921},
+    {21810, 19929}, {21823, 19918}, {21847, 19919}, {21848, 19923}, {1480, 19925}, {21859, 19927}, {21856, 19928}, {21812, 19930},
+    {21816, 19931}, {21863, 19932}, {21818, 19933}, {21804, 19935}, {21851, 19938}, {21821, 19944}, {21773, 19945}, {21783, 19953},
+    {21761, 19961}, {21774, 19946}, {21767, 19947}, {21789, 19948}, {21813, 19949}, {21791, 19950}, {21811, 19951}, {21847, 19952},
+    {21771, 19954}, {21788, 19956}, {21777, 19957}, {21787, 19958}, {21788, 19959}, {21770, 19962}, {21781, 19963}, {21775, 19964},
+    {21778, 19965}, {21783, 19966}, {21994, 20082}, {21995, 19967}, {21992, 19969}, {21984, 19970}, {21894, 19971}, {878, 19972},
+    {21790, 19968}, {21976, 19973}, {21990, 19974}, {22011, 19975}, {21997, 19983}, {21986, 19976}, {21901, 19977}, {1570, 19978},
+    {21993, 19968}, {21989, 19980}, {21988, 19981}, {21989, 19984}, {2027, 19985}, {2764, 19986}, {2176, 19988}, {22006, 19970},
+    {22006, 19989}, {22012, 19990}, {22010, 19991}, {22005, 19992}, {22013, 20074}, {21988, 19993}, {21959, 19994}, {22004, 19995},
+    {22004, 19996}, {22002, 19997}, {22005, 20076}, {22012, 19992}, {1396, 19999}, {21964, 20000}, {21962, 20001}, {21965, 20048},
+    {22013, 19998}, {21957, 20002}, {22014, 20090}, {21973, 20004}, {21967, 20012}, {21965, 20013}, {21953, 20005}, {21976, 20006},
+    {22004, 19998}, {21964, 20002}, {21961, 20090}, {21956, 20090}, {21889, 20007}, {21983, 20008}, {21978, 20009}, {22000, 20010},
+    {21979, 20011}, {21977, 20014}, {21855, 19881}, {21980, 20015}, {21978, 20016}, {21983, 20017}, {21943, 20019}, {21963, 20020},
+    {21990, 20021}, {21975, 20022}, {21972, 20023}, {21960, 20024}, {21985, 20025}, {21963, 20026}, {21919, 20027}, {21930, 20028},
+    {21969, 20018}, {21930, 20029}, {21930, 20030}, {21956, 20031}, {21913, 20032}, {21929, 20033}, {21946, 20034}, {21934, 20042},
+    {21923, 20035}, {21925, 20036}, {21927, 20037}, {21946, 20210}, {21945, 20038}, {21947, 20039}, {21949, 20040}, {21950, 20041},
+    {21934, 20096}, {21925, 20043}, {22061, 20044}, {21925, 20049}, {21951, 20057}, {21949, 20056}, {21928, 20050}, {21948, 20058},
+    {21945, 20096}, {21944, 20059}, {22075, 20047}, {22072, 20051}, {21940, 20052}, {21940, 20053}, {21892, 20054}, {21949, 20055},
+    {21901, 20060}, {21910, 20064}, {21890, 20072}, {21903, 20061}, {2038, 20097}, {21894, 20196}, {21892, 20062}, {21903, 20063},
+    {21896, 20065}, {21998, 20066}, {21936, 20067}, {21919, 20068}, {21903, 20196}, {21888, 20196}, {21888, 20069}, {21908, 20077},
+    {21917, 20070}, {21918, 20071}, {21893, 20073}, {22062, 20075}, {22078, 20078}, {21965, 20079}, {21902, 20080}, {21924, 20081},
+    {21911, 20083}, {21909, 20084}, {21904, 20085}, {21908, 20086}, {22134, 20087}, {22059, 20088}, {22121, 20089}, {22113, 20091},
+    {22124, 20092}, {22064, 20093}, {430, 20098}, {22122, 20199}, {22097, 20094}, {22113, 20095}, {22114, 20099}, {22134, 20107},
+    {22139, 20100}, {22143, 20101}, {22120, 20199}, {22117, 20199}, {21908, 20066}, {22139, 20102}, {22142, 20104}, {22131, 20105},
+    {22120, 20112}, {22140, 20120}, {22136, 20121}, {22134, 20109}, {22089, 20110}, {22091, 20111}, {22090, 20113}, {22095, 20114},
+    {22100, 20116}, {22134, 20117}, {22087, 20118}, {22104, 20119}, {22131, 20122}, {22083, 20123}, {22081, 20124}, {22105, 20125},
+    {22096, 20126}, {22104, 20204}, {22109, 20127}, {22110, 20128}, {22097, 20130}, {22098, 20131}, {21921, 20031}, {22096, 20133},
+    {22107, 20126}, {22095, 20134}, {22032, 20135}, {22102, 20136}, {21906, 20054}, {22058, 20137}, {22070, 20144}, {22050, 20152},
+    {22050, 20153}, {22069, 20146}, {21957, 20018}, {22062, 20154}, {22063, 20155}, {22053, 20141}, {22054, 20142}, {22072, 20145},
+    {22073, 20147}, {22071, 20151}, {22112, 20156}, {22066, 20157}, {22068, 20158}, {22030, 20173}, {22108, 20160}, {22122, 20161},
+    {22037, 20103}, {22084, 20106}, {22081, 20115}, {22098, 20129}, {22052, 20132}, {22054, 20138}, {22068, 20143}, {22071, 20148},
+    {22101, 20149}, {22103, 20150}, {22123, 20162}, {1911, 20163}, {22025, 20164}, {22103, 20165}, {22126, 20166}, {22041, 20167},
+    {22019, 20159}, {22016, 20168}, {22042, 20170}, {22034, 20171}, {22019, 20174}, {22029, 20175}, {22039, 20176}, {22036, 20177},
+    {22026, 20159}, {22036, 20178}, {22041, 20179}, {2609, 20180}, {22025, 20181}, {22026, 20182}, {22039, 20183}, {22254, 20184},
+    {22238, 20185}, {1578, 20186}, {22262, 20187}, {22252, 20188}, {22206, 20189}, {22240, 20190}, {22241, 20191}, {22249, 20192},
+    {22247, 20193}, {22269, 20194}, {22229, 20195}, {22271, 20197}, {22227, 20198}, {22249, 20200}, {22196, 20201}, {22250, 20202},
+    {22265, 20203}, {22266, 20205}, {22268, 20206}, {22163, 20207}, {22247, 20208}, {22241, 20209}, {22217, 20211}, {22268, 20212},
+    {22256, 20213}, {22263, 20214}, {22217, 20215}, {22171, 20216}, {22265, 20217}, {545, 20218}, {22183, 20219}, {22180, 20220},
+    {22175, 20221}, {1980, 20223}, {2530, 20224}, {22176, 20225}, {22270, 20226}, {22220, 20227}, {22169, 20228}, {22180, 20229},
+    {22225, 20230}, {22217, 20231}, {22227, 20232}, {22263, 20233}, {22237, 20234}, {22261, 20235}, {719, 20237}, {22239, 20238},
+    {22259, 20239}, {22189, 20240}, {22217, 20241}, {22165, 20242}, {22192, 20243}, {22232, 20245}, {22235, 20246}, {22232, 20247},
+    {22231, 20249}, {22212, 20252}, {22247, 20253}, {22228, 20254}, {22216, 20256}, {22236, 20264}, {22233, 20265}, {22229, 20257},
+    {22231, 20258}, {22185, 20259}, {22195, 20260}, {22189, 20262}, {22199, 20263}, {22130, 20103}, {373, 20266}, {22189, 20267},
+    {22190, 20268}, {22179, 20270}, {22202, 20271}, {22317, 20272}, {22020, 20150}, {22066, 20149}, {22218, 20273}, {22164, 20275},
+    {22101, 20115}, {22084, 20129}, {22178, 20276}, {22122, 20106}, {22077, 20143}, {22055, 20148}, {22089, 20132}, {22064, 20138},
+    {22207, 20277}, {22184, 20285}, {22201, 20278}, {22158, 20280}, {22199, 20281}, {22186, 20282}, {1426, 20283}, {22228, 20284},
+    {22224, 20248}, {22178, 20269}, {22154, 20286}, {22200, 20287}, {22253, 20288}, {22193, 20289}, {22194, 20290}, {22148, 20291},
+    {22196, 20292}, {22187, 20293}, {22196, 20315}, {1364, 20352}, {22192, 20453}, {22189, 20295}, {22150, 20303}, {22150, 20302},
+    {22160, 20296}, {22153, 20297}, {22155, 20298}, {22157, 20299}, {22164, 20300}, {22316, 20301}, {22151, 20304}, {22149, 20305},
+    {22168, 20306}, {22195, 20307}, {22169, 20308}, {22172, 20309}, {22148, 20310}, {22161, 20311}, {22174, 20313}, {22150, 20314},
+    {1593, 20316}, {2533, 20317}, {22259, 20318}, {22171, 20320}, {22145, 20321}, {157, 20322}, {22167, 20324}, {166, 20326},
+    {22221, 20328}, {22157, 20329}, {22211, 20330}, {22208, 20331}, {1814, 20332}, {22164, 20333}, {22214, 20334}, {22162, 20335},
+    {22161, 20336}, {22213, 20337}, {22274, 20338}, {124, 20339}, {22275, 20340}, {22363, 20341}, {22379, 20342}, {22332, 20343},
+    {1848, 20345}, {22333, 20346}, {22385, 20353}, {22395, 20356}, {26, 20354}, {22373, 20455}, {22283, 20348}, {1036, 20349},
+    {22284, 20350}, {22327, 20351}, {22324, 20355}, {22371, 20357}, {22388, 20360}, {700, 20361}, {22396, 20362}, {22394, 20363},
+    {22396, 20478}, {2779, 20365}, {22343, 20366}, {22391, 20367}, {22376, 20368}, {22396, 20376}, {22389, 20369}, {22396, 20370},
+    {22389, 20364}, {22389, 20371}, {22385, 20372}, {2052, 20374}, {22356, 20375}, {22398, 20377}, {22306, 20378}, {22297, 20379},
+    {22399, 20364}, {22352, 20380}, {22339, 20381}, {22386, 20348}, {1677, 20382}, {22393, 20383}, {22392, 20384}, {22340, 20385},
+    {22344, 20411}, {22351, 20386}, {2248, 20387}, {22315, 20388}, {22387, 20389}, {22339, 20390}, {22292, 20391}, {22358, 20392},
+    {22366, 20395}, {22283, 20396}, {22362, 20397}, {22380, 20398}, {22362, 20399}, {22343, 20400}, {22353, 20408}, {22366, 20401},
+    {22375, 20402}, {22349, 20403}, {22214, 20248}, {22196, 20269}, {22351, 20404}, {22185, 20291}, {22331, 20406}, {22332, 20407},
+    {22360, 20409}, {22359, 20410}, {63, 20412}, {22277, 20413}, {22308, 20414}, {22322, 20415}, {22301, 20416}, {22318, 20417},
+    {22316, 20418}, {22326, 20419}, {22297, 20420}, {22314, 20421}, {367, 20423}, {22332, 20424}, {22294, 20425}, {22346, 20426},
+    {22319, 20427}, {22308, 20428}, {22306, 20429}, {22330, 20430}, {22288, 20431}, {22308, 20432}, {22286, 20433}, {22332, 20434},
+    {22330, 20435}, {22325, 20480}, {22333, 20594}, {22328, 20436}, {22316, 20437}, {22278, 20438}, {22318, 20439}, {22276, 20440},
+    {22275, 20441}, {22332, 20480}, {22313, 20442}, {22315, 20443}, {22320, 20444}, {22292, 20445}, {22334, 20446}, {22294, 20447},
+    {22332, 20448}, {22295, 20449}, {22330, 20450}, {22283, 20451}, {22328, 20452}, {22278, 20454}, {22299, 20464}, {22285, 20472},
+    {22277, 20456}, {22303, 20457}, {22283, 20458}, {22273, 20459}, {22299, 20460}, {22274, 20461}, {22299, 20462}, {22273, 20463},
+    {22313, 20465}, {22300, 20466}, {22288, 20467}, {22295, 20468}, {22292, 20469}, {22290, 20470}, {22301, 20481}, {22293, 20595},
+    {22341, 20471}, {22501, 20473}, {22504, 20474}, {22505, 20475}, {22509, 20476}, {22511, 20477}, {22292, 20481}, {22518, 20479},
+    {22443, 20482}, {22508, 20483}, {22496, 20484}, {22496, 20485}, {22500, 20486}, {22500, 20487}, {22527, 20488}, {22482, 20489},
+    {22522, 20490}, {22496, 20491}, {22500, 20492}, {22478, 20493}, {22502, 20494}, {22476, 20495}, {22527, 20496}, {22502, 20497},
+    {22459, 20498}, {22472, 20499}, {22518, 20500}, {22507, 20501}, {22525, 20509}, {22514, 20502}, {22511, 20503}, {22466, 20504},
+    {22515, 20505}, {22508, 20506}, {22527, 20507}, {22476, 20508}, {22480, 20512}, {22468, 20520}, {22464, 20521}, {22487, 20514},
+    {22465, 20522}, {22467, 20523}, {22492, 20513}, {22518, 20515}, {22465, 20516}, {22467, 20517}, {22466, 20518}, {22467, 20519},
+    {22465, 20524}, {22492, 20525}, {22511, 20526}, {22469, 20527}, {22509, 20528}, {22471, 20529}, {22465, 20530}, {22494, 20532},
+    {22491, 20533}, {22482, 20534}, {22482, 20535}, {22482, 20536}, {22406, 20537}, {22483, 20538}, {22441, 20539}, {22432, 20540},
+    {22440, 20558}, {22442, 20541}, {22442, 20542}, {22453, 20543}, {22424, 20544}, {22460, 20545}, {22422, 20546}, {22443, 20540},
+    {22453, 20531}, {22436, 20547}, {22457, 20548}, {22443, 20556}, {22436, 20549}, {22460, 20560}, {22440, 20568}, {22452, 20569},
+    {22452, 20552}, {22460, 20553}, {22456, 20554}, {22439, 20555}, {22458, 20557}, {22409, 20559}, {22457, 20561}, {22442, 20562},
+    {22461, 20570}, {22450, 20563}, {22451, 20564}, {22441, 20565}, {262, 20566}, {22444, 20576}, {22456, 20584}, {22404, 20585},
+    {22462, 20571}, {22422, 20572}, {22422, 20573}, {22411, 20574}, {22409, 20575}, {22420, 20577}, {22455, 20578}, {22429, 20579},
+    {1845, 20608}, {22411, 20709}, {22586, 20580}, {22406, 20581}, {22406, 20582}, {22406, 20583}, {22404, 20586}, {22446, 20587},
+    {22409, 20709}, {22402, 20709}, {22425, 20588}, {22427, 20589}, {22427, 20590}, {22405, 20591}, {22440, 20592}, {22421, 20593},
+    {22418, 20596}, {22409, 20597}, {22572, 20598}, {22415, 20599}, {22435, 20600}, {22422, 20601}, {22422, 20602}, {22417, 20603},
+    {22636, 20604}, {22634, 20605}, {22637, 20723}, {22633, 20606}, {22625, 20607}, {22624, 20720}, {22627, 20611}, {22649, 20612},
+    {22629, 20609}, {22632, 20610}, {22609, 20613}, {22651, 20614}, {22607, 20615}, {22629, 20616}, {22605, 20617}, {22648, 20618},
+    {22636, 20609}, {22627, 20610}, {22652, 20619}, {22651, 20620}, {22626, 20621}, {22600, 20622}, {22643, 20623}, {22641, 20624},
+    {22644, 20625}, {22596, 20626}, {22642, 20627}, {22639, 20628}, {22649, 20636}, {22646, 20629}, {22612, 20630}, {22654, 20631},
+    {22601, 20632}, {22603, 20633}, {22602, 20634}, {22614, 20635}, {22649, 20637}, {22602, 20638}, {22619, 20639}, {22646, 20640},
+    {22599, 20641}, {22623, 20642}, {22643, 20643}, {22598, 20644}, {22598, 20645}, {22482, 20531}, {22593, 20646}, {22596, 20647},
+    {22638, 20648}, {22617, 20649}, {22619, 20650}, {22618, 20651}, {22622, 20652}, {22622, 20653}, {22622, 20654}, {1759, 20655},
+    {22617, 20682}, {22587, 20656}, {2697, 20657}, {22588, 20658}, {22535, 20659}, {22532, 20661}, {22618, 20662}, {22569, 20663},
+    {22608, 20682}, {22623, 20682}, {22570, 20664}, {22572, 20665}, {22595, 20666}, {22654, 20667}, {22571, 20668}, {22575, 20669},
+    {22562, 20670}, {22566, 20671}, {22566, 20672}, {22585, 20673}, {22548, 20674}, {22584, 20675}, {22563, 20676}, {22567, 20677},
+    {22586, 20850}, {22565, 20678}, {22611, 20679}, {523, 20680}, {22560, 20681}, {22538, 20683}, {22589, 20684}, {22591, 20685},
+    {22574, 20736}, {22582, 20686}, {22617, 20687}, {160, 20689}, {22574, 20690}, {22532, 20691}, {22620, 20692}, {22571, 20693},
+    {22585, 20736}, {22628, 20694}, {22586, 20695}, {22537, 20696}, {22538, 20697}, {22540, 20698}, {22541, 20699}, {22539, 20700},
+    {22549, 20701}, {22584, 20702}, {22556, 20703}, {22557, 20704}, {22581, 20705}, {22528, 20706}, {22532, 20707}, {22531, 20708},
+    {22528, 20711}, {22534, 20712}, {22553, 20851}, {22555, 20714}, {22529, 20715}, {22569, 20716}, {22531, 20717}, {22567, 20718},
+    {22545, 20737}, {22539, 20719}, {22559, 20721}, {22564, 20722}, {22536, 20724}, {22536, 20725}, {22654, 20726}, {2801, 20727},
+    {22552, 20737}, {22597, 20728}, {22766, 20729}, {22760, 20730}, {22767, 20848}, {345, 20739}, {22758, 20731}, {22752, 20732},
+    {22755, 20738}, {22763, 20740}, {22756, 20838}, {22759, 20854}, {22783, 20741}, {22761, 20749}, {22763, 20748}, {22779, 20734},
+    {22762, 20738}, {22754, 20740}, {22767, 20838}, {22754, 20838}, {22754, 20735}, {22719, 20742}, {22776, 20743}, {22780, 20744},
+    {22780, 20745}, {22781, 20746}, {22756, 20747}, {22709, 20750}, {22763, 20752}, {22781, 20760}, {22783, 20761}, {22766, 20754},
+    {22778, 20762}, {22778, 20763}, {22693, 20755}, {22682, 20756}, {22728, 20757}, {22729, 20758}, {22731, 20764}, {22735, 20765},
+    {22726, 20766}, {22722, 20844}, {22725, 20767}, {22726, 20769}, {22749, 20770}, {22658, 20771}, {22667, 20772}, {22664, 20773},
+    {22721, 20766}, {22751, 20774}, {22747, 20775}, {22748, 20776}, {22749, 20777}, {22729, 20784}, {22747, 20792}, {22745, 20793},
+    {22741, 20780}, {22696, 20781}, {22696, 20782}, {22699, 20783}, {22696, 20785}, {22708, 20787}, {22679, 20788}, {22692, 20789},
+    {22691, 20790}, {22688, 20791}, {22693, 20795}, {22716, 20796}, {22829, 20797}, {22714, 20798}, {22714, 20799}, {22714, 20800},
+    {22727, 20759}, {22700, 20768}, {22739, 20778}, {22688, 20786}, {22708, 20794}, {22695, 20802}, {22705, 20810}, {22717, 20811},
+    {22707, 20803}, {22704, 20804}, {22661, 20805}, {22750, 20806}, {2243, 20807}, {22710, 20808}, {22665, 20809}, {22663, 20812},
+    {22671, 20813}, {22668, 20814}, {22676, 20815}, {22766, 20816}, {22741, 20817}, {22687, 20818}, {22683, 20819}, {22678, 20820},
+    {22673, 20821}, {22683, 20822}, {22685, 20823}, {22660, 20824}, {22678, 20825}, {22665, 20832}, {22683, 20840}, {22681, 20841},
+    {22666, 20827}, {22688, 20828}, {22890, 20829}, {22890, 20830}, {22893, 20831}, {22896, 20833}, {22874, 20834}, {22893, 20835},
+    {22895, 20836}, {22886, 20837}, {22887, 20839}, {22883, 20842}, {22886, 20978}, {22881, 20843}, {22898, 20845}, {2371, 20846},
+    {22890, 20864}, {22900, 20847}, {22861, 20849}, {22887, 20852}, {22881, 20853}, {22882, 20865}, {22896, 20873}, {22829, 20880},
+    {22885, 20864}, {1992, 20855}, {22905, 20857}, {22809, 20858}, {22911, 20843}, {22810, 20859}, {22817, 20860}, {22898, 20861},
+    {22900, 20862}, {22907, 20863}, {22815, 20867}, {22911, 20868}, {22869, 20869}, {22871, 20870}, {2299, 20871}, {22809, 20872},
+    {22820, 20874}, {223, 20875}, {22861, 20876}, {22855, 20877}, {22813, 20878}, {22876, 20879}, {22874, 20881}, {22851, 20882},
+    {22855, 20883}, {978, 20884}, {22872, 20885}, {22898, 20886}, {22853, 20887}, {22855, 20888}, {22878, 20889}, {2794, 20890},
+    {2105, 20891}, {22833, 20893}, {22834, 20894}, {22877, 20895}, {22798, 20896}, {22837, 20897}, {22796, 20898}, {22797, 20899},
+    {22683, 20815}, {22840, 20900}, {22861, 20901}, {22885, 20902}, {22740, 20768}, {22864, 20903}, {22868, 20904}, {22867, 20905},
+    {22864, 20906}, {22864, 20907}, {22835, 20908}, {22814, 20909}, {22838, 20910}, {22851, 20911}, {22656, 20806}, {22839, 20912},
+    {22729, 20778}, {22709, 20786}, {22743, 20759}, {22837, 20913}, {22908, 20914}, {22818, 20915}, {22718, 20794}, {22817, 20916},
+    {22703, 20805}, {22818, 20917}, {22820, 20918}, {22897, 20919}, {22803, 20920}, {22678, 20812}, {22819, 20921}, {22844, 20928},
+    {22824, 20936}, {22841, 20922}, {22847, 20923}, {22843, 20924}, {22834, 20925}, {22846, 20943}, {1660, 20926}, {22818, 20929},
+    {22792, 20930}, {22835, 20931}, {22833, 20932}, {22836, 20933}, {22845, 20925}, {1686, 20934}, {22881, 20937}, {22886, 20938},
+    {22844, 20939}, {22827, 20944}, {22784, 20945}, {22798, 20946}, {22803, 20947}, {22789, 20955}, {22794, 20948}, {22799, 20949},
+    {22806, 20950}, {22957, 20951}, {22841, 20952}, {22793, 20953}, {22810, 20960}, {22798, 20968}, {22787, 20954}, {22809, 20962},
+    {22795, 20970}, {22793, 20971}, {22833, 20957}, {22785, 20958}, {22786, 20961}, {22806, 20969}, {22810, 20959}, {22815, 20963},
+    {22813, 20964}, {22815, 20965}, {22814, 20966}, {22803, 20967}, {23013, 20972}, {22801, 20973}, {22804, 20974}, {22792, 20975},
+    {22818, 20976}, {22794, 20977}, {22816, 20979}, {23020, 20980}, {23018, 20981}, {23013, 20992}, {23021, 21106}, {1619, 20982},
+    {23020, 20983}, {23035, 20984}, {22951, 20985}, {23013, 20986}, {23011, 20987}, {23020, 20992}, {23038, 20988}, {22993, 20989},
+    {23035, 20990}, {22991, 20991}, {23013, 20993}, {23015, 20994}, {2721, 20995}, {23026, 21094}, {23010, 20996}, {22984, 20997},
+    {23027, 20998}, {23025, 20999}, {23028, 21000}, {22980, 21001}, {23024, 21094}, {23037, 21094}, {23026, 21002}, {23023, 21008},
+    {23033, 21016}, {23030, 21003}, {23039, 21004}, {22997, 21005}, {22999, 21006}, {22986, 21007}, {22991, 21009}, {22988, 21011},
+    {22976, 21012}, {22976, 21013}, {22977, 21014}, {22979, 21015}, {22981, 21017}, {23007, 21020}, {22794, 20972}, {23002, 21021},
+    {22997, 21022}, {23005, 21100}, {22979, 21023}, {23011, 21024}, {22998, 21025}, {22998, 21026}, {22993, 21027}, {22962, 21029},
+    {23004, 21022}, {22950, 21037}, {22950, 21036}, {22957, 21030}, {22956, 21031}, {22944, 21032}, {934, 21033}, {22973, 21034},
+    {22951, 21068}, {22933, 21035}, {22944, 21038}, {22948, 21039}, {22947, 21040}, {22951, 21041}, {22948, 21042}, {22996, 21045},
+    {22958, 21068}, {22957, 21068}, {22970, 21046}, {22946, 21047}, {22920, 21048}, {22957, 21049}, {22915, 21050}, {22964, 21051},
+    {22977, 21010}, {22958, 21018}, {22959, 21019}, {22964, 21043}, {22994, 21044}, {22965, 21052}, {22916, 21053}, {22974, 21054},
+    {22924, 21055}, {23001, 21056}, {23012, 21057}, {22932, 21059}, {22912, 21067}, {22925, 21066}, {22942, 21060}, {22964, 21061},
+    {22917, 21062}, {22919, 21063}, {22942, 21064}, {23098, 21065}, {22941, 21069}, {1431, 21120}, {22930, 21221}, {22936, 21070},
+    {22942, 21071}, {22928, 21235}, {22935, 21072}, {22933, 21073}, {22935, 21074}, {22944, 21075}, {22941, 21221}, {22928, 21221},
+    {22936, 21121}, {23157, 21076}, {23159, 21077}, {23149, 21078}, {23149, 21079}, {23140, 21122}, {23148, 21232}, {23139, 21080},
+    {22931, 21121}, {23162, 21081}, {23079, 21082}, {23136, 21083}, {23167, 21084}, {23151, 21122}, {23072, 21085}, {23121, 21086},
+    {23137, 21087}, {23138, 21088}, {23158, 21096}, {23163, 21089}, {23165, 21090}, {23165, 21091}, {23156, 21123}, {23164, 21233},
+    {23158, 21092}, {23152, 21093}, {23159, 21238}, {23156, 21095}, {23157, 21097}, {23108, 21098}, {23167, 21123}, {23119, 21099},
+    {23163, 21124}, {23115, 21101}, {23106, 21125}, {23118, 21239}, {23117, 21102}, {23119, 21103}, {23104, 21104}, {23105, 21105},
+    {23154, 21124}, {23107, 21107}, {23117, 21125}, {23109, 21108}, {23107, 21109}, {23111, 21110}, {23130, 21236}, {23148, 21098},
+    {23118, 21126}, {23132, 21111}, {23130, 21112}, {23125, 21127}, {23133, 21237}, {1120, 21128}, {23126, 21229}, {1828, 21129},
+    {23129, 21126}, {23128, 21113}, {23102, 21114}, {23132, 21127}, {23136, 21115}, {23086, 21116}, {23121, 21229}, {23132, 21229},
+    {23131, 21228}, {22967, 21044}, {23091, 21136}, {23077, 21144}, {22996, 21018}, {23082, 21117}, {23108, 21118}, {22998, 21019},
+    {23122, 21228}, {23129, 21228}, {2740, 21119}, {551, 21130}, {23095, 21132}, {23110, 21133}, {283, 21134}, {22913, 21057},
+    {23076, 21135}, {22946, 21043}, {22997, 21010}, {23154, 21137}, {22956, 21053}, {23099, 21138}, {23097, 21139}, {23103, 21140},
+    {23096, 21141}, {23159, 21142}, {23101, 21143}, {23073, 21145}, {23055, 21146}, {23054, 21148}, {23078, 21149}, {23090, 21150},
+    {23089, 21151}, {23095, 21152}, {23074, 21154}, {23097, 21155}, {23128, 21156}, {23046, 21157}, {23091, 21158}, {23137, 21159},
+    {23090, 21160}, {23090, 21161}, {23085, 21162}, {23040, 21163}, {23060, 21164}, {23058, 21165}, {23138, 21166}, {23129, 21167},
+    {23050, 21168}, {23055, 21169}, {23042, 21170}, {120, 21171}, {23122, 21172}, {23046, 21173}, {23070, 21174}, {23092, 21175},
+    {23064, 21176}, {23090, 21177}, {23055, 21178}, {1315, 21179}, {23068, 21180}, {23152, 21182}, {23153, 21183}, {490, 21184},
+    {1124, 21187}, {23046, 21188}, {23084, 21189}, {23156, 21190}, {1699, 21191}, {23119, 21192}, {23064, 21193}, {23064, 21194},
+    {23050, 21195}, {23077, 21196}, {23055, 21197}, {23059, 21199}, {23049, 21200}, {601, 21201}, {23073, 21202}, {23168, 21203},
+    {774, 21204}, {23279, 21205}, {23276, 21206}, {23274, 21207}, {23269, 21248}, {23277, 21362}, {23285, 21208}, {23267, 21209},
+    {23290, 21210}, {23207, 21211}, {23264, 21212}, {23268, 21213}, {23276, 21248}, {23268, 21214}, {23249, 21215}, {23291, 21216},
+    {23269, 21217}, {23290, 21218}, {23292, 21219}, {23292, 21220}, {23290, 21223}, {23292, 21224}, {23287, 21249}, {23283, 21363},
+    {23280, 21225}, {23281, 21226}, {1598, 21230}, {23272, 21231}, {23234, 21234}, {23285, 21240}, {23294, 21249}, {23287, 21241},
+    {23247, 21242}, {23240, 21243}, {23193, 21244}, {23233, 21245}, {2222, 21247}, {23249, 21250}, {23289, 21251}, {23207, 21252},
+    {23239, 21253}, {23235, 21254}, {23238, 21365}, {23257, 21256}, {23242, 21257}, {23235, 21258}, {23253, 21260}, {23257, 21261},
+    {23242, 21255}, {23259, 21262}, {23261, 21263}, {23274, 21264}, {23255, 21265}, {23272, 21266}, {23249, 21267}, {23250, 21268},
+    {23237, 21255}, {23262, 21270}, {23250, 21271}, {23254, 21272}, {23245, 21273}, {23248, 21274}, {23291, 21275}, {23288, 21276},
+    {23223, 21277}, {23210, 21278}, {23210, 21279}, {24, 21282}, {23208, 21283}, {23208, 21284}, {23227, 21286}, {23242, 21288},
+    {23231, 21289}, {23244, 21290}, {23245, 21291}, {23225, 21293}, {23247, 21294}, {23203, 21295}, {23204, 21296}, {23250, 21297},
+    {23236, 21227}, {23204, 21269}, {356, 21298}, {51, 21300}, {23207, 21301}, {23179, 21302}, {23253, 21303}, {23254, 21305},
+    {23277, 21306}, {23220, 21307}, {23200, 21309}, {995, 21310}, {1203, 21312}, {23260, 21313}, {23261, 21314}, {23354, 21315},
+    {23221, 21339}, {23269, 21316}, {23231, 21318}, {23183, 21319}, {23184, 21328}, {23218, 21339}, {23172, 21336}, {23181, 21320},
+    {23185, 21322}, {23225, 21323}, {23180, 21324}, {23168, 21325}, {23175, 21326}, {23198, 21327}, {23249, 21329}, {23219, 21330},
+    {23170, 21332}, {23194, 21333}, {2535, 21334}, {23279, 21335}, {23170, 21337}, {23171, 21338}, {23169, 21341}, {23190, 21342},
+    {23197, 21343}, {23169, 21344}, {23244, 21345}, {437, 21347}, {23171, 21348}, {23206, 21349}, {23290, 21350}, {23198, 21351},
+    {23238, 21352}, {23293, 21353}, {23178, 21354}, {23179, 21355}, {23390, 21356}, {23401, 21357}, {23403, 21358}, {23402, 21359},
+    {23414, 21360}, {23385, 21361}, {23402, 21364}, {632, 21366}, {2352, 21367}, {23404, 21368}, {23399, 21369}, {23306, 21371},
+    {23345, 21372}, {23399, 21373}, {23422, 21374}, {23331, 21375}, {23419, 21376}, {23419, 21377}, {23394, 21378}, {23359, 21379},
+    {23420, 21381}, {23392, 21382}, {1651, 21383}, {23370, 21384}, {23415, 21385}, {23417, 21386}, {23415, 21387}, {23402, 21388},
+    {23365, 21389}, {23407, 21390}, {23363, 21391}, {23411, 21392}, {23404, 21393}, {23416, 21401}, {23369, 21394}, {23375, 21395},
+    {23373, 21396}, {23376, 21397}, {23419, 21398}, {23377, 21399}, {23381, 21400}, {23416, 21402}, {23365, 21403}, {23367, 21404},
+    {23365, 21405}, {23384, 21406}, {23411, 21407}, {23385, 21408}, {23365, 21409}, {23388, 21410}, {23325, 21411}, {23365, 21412},
+    {23405, 21413}, {23384, 21414}, {23388, 21415}, {23228, 21314}, {23387, 21416}, {23308, 21417}, {23309, 21418}, {23389, 21419},
+    {23376, 21420}, {23377, 21421}, {23272, 21227}, {23241, 21269}, {23381, 21422}, {23379, 21423}, {23369, 21424}, {23393, 21425},
+    {23371, 21426}, {23327, 21427}, {23326, 21428}, {23341, 21429}, {23350, 21430}, {23330, 21438}, {23343, 21431}, {23367, 21432},
+    {23410, 21433}, {23335, 21434}, {23331, 21435}, {23342, 21436}, {23333, 21437}, {23334, 21439}, {23348, 21440}, {23312, 21441},
+    {23333, 21442}, {23335, 21443}, {23345, 21444}, {23355, 21445}, {23357, 21446}, {23332, 21447}, {23350, 21448}, {23348, 21449},
+    {23348, 21450}, {23343, 21451}, {23298, 21452}, {23338, 21453}, {23350, 21454}, {23306, 21455}, {23302, 21456}, {23312, 21457},
+    {23353, 21458}, {23308, 21459}, {23296, 21460}, {23303, 21461}, {23296, 21462}, {23327, 21463}, {23469, 21464}, {23302, 21465},
+    {23325, 21466}, {23468, 21467}, {23300, 21468}, {23320, 21469}, {23320, 21470}, {23321, 21471}, {23323, 21472}, {23325, 21473},
+    {23322, 21474}, {23298, 21475}, {23336, 21476}, {23308, 21477}, {23334, 21478}, {23327, 21479}, {23317, 21480}, {23318, 21481},
+    {23309, 21482}, {23312, 21483}, {23537, 21484}, {23516, 21485}, {23529, 21486}, {162, 21504}, {23524, 21605}, {23546, 21487},
+    {23521, 21488}, {23509, 21489}, {23551, 21490}, {23545, 21491}, {23437, 21492}, {23505, 21493}, {23535, 21605}, {23522, 21605},
+    {23521, 21494}, {23523, 21495}, {23541, 21503}, {23546, 21496}, {23537, 21497}, {23547, 21498}, {23549, 21499}, {23524, 21500},
+    {23541, 21501}, {23535, 21502}, {23491, 21505}, {23542, 21506}, {23542, 21507}, {23537, 21508}, {23499, 21509}, {23497, 21510},
+    {23499, 21511}, {23449, 21512}, {23489, 21513}, {23500, 21514}, {23501, 21515}, {23497, 21516}, {23516, 21517}, {23542, 21518},
+    {23489, 21519}, {23540, 21492}, {23491, 21520}, {23490, 21521}, {23491, 21522}, {23489, 21523}, {23492, 21525}, {23512, 21526},
+    {23512, 21527}, {23489, 21528}, {23532, 21529}, {23513, 21530}, {23312, 21456}, {23504, 21531}, {23512, 21532}, {23516, 21533},
+    {23499, 21534}, {23510, 21535}, {23496, 21537}, {23516, 21545}, {23512, 21544}, {23521, 21539}, {23499, 21540}, {23476, 21541},
+    {23469, 21542}, {23479, 21543}, {23451, 21546}, {23473, 21547}, {23357, 21440}, {23449, 21548}, {23468, 21549}, {23481, 21550},
+    {23597, 21551}, {23458, 21552}, {23463, 21553}, {23457, 21555}, {23483, 21556}, {23438, 21557}, {23462, 21558}, {23436, 21559},
+    {23485, 21538}, {23476, 21554}, {23435, 21560}, {23483, 21561}, {23460, 21568}, {23472, 21576}, {23472, 21562}, {23429, 21563},
+    {23477, 21564}, {23470, 21569}, {23482, 21577}, {23479, 21565}, {23473, 21566}, {23439, 21567}, {23442, 21570}, {23485, 21571},
+    {23447, 21572}, {23435, 21573}, {23441, 21574}, {23481, 21575}, {23443, 21578}, {23479, 21579}, {23430, 21580}, {23454, 21581},
+    {23476, 21582}, {23448, 21583}, {23474, 21584}, {23450, 21585}, {23472, 21586}, {23451, 21587}, {23449, 21588}, {23450, 21589},
+    {23450, 21590}, {23426, 21591}, {23464, 21592}, {23436, 21593}, {23462, 21594}, {23441, 21595}, {23432, 21596}, {23596, 21597},
+    {23447, 21598}, {23438, 21599}, {23599, 21600}, {23441, 21601}, {23435, 21602}, {23644, 21603}, {23664, 21604}, {23642, 21606},
+    {23657, 21607}, {23667, 21608}, {23639, 21609}, {23677, 21610}, {23637, 21611}, {23636, 21612}, {23672, 21613}, {23672, 21614},
+    {23676, 21616}, {23656, 21624}, {23668, 21625}, {1793, 21617}, {2296, 21619}, {23569, 21620}, {23570, 21621}, {23593, 21622},
+    {23674, 21623}, {23676, 21626}, {23667, 21627}, {2540, 21628}, {23575, 21629}, {23623, 21630}, {23671, 21631}, {23584, 21632},
+    {23678, 21633}, {23666, 21634}, {23670, 21635}, {23661, 21636}, {23664, 21637}, {23679, 21638}, {23631, 21639}, {23632, 21648},
+    {23620, 21656}, {23629, 21640}, {23583, 21641}, {263, 21642}, {23625, 21644}, {23635, 21645}, {23671, 21646}, {23645, 21647},
+    {23669, 21649}, {1510, 21650}, {23620, 21652}, {23640, 21653}, {2254, 21654}, {23624, 21655}, {23598, 21657}, {23573, 21658},
+    {23646, 21659}, {23640, 21660}, {23639, 21661}, {23638, 21662}, {23642, 21663}, {23460, 21538}, {23646, 21664}, {23621, 21665},
+    {23640, 21666}, {23639, 21667}, {23629, 21668}, {23653, 21669}, {23631, 21670}, {23651, 21671}, {23650, 21672}, {23632, 21673},
+    {23629, 21680}, {23591, 21688}, {23592, 21674}, {23486, 21554}, {23596, 21675}, {23596, 21676}, {23607, 21677}, {23578, 21678},
+    {23602, 21679}, {23586, 21681}, {23596, 21682}, {23610, 21683}, {23573, 21684}, {23590, 21685}, {1752, 21686}, {23628, 21689},
+    {23570, 21690}, {23584, 21691}, {23613, 21696}, {23607, 21704}, {23608, 21692}, {23584, 21698}, {23604, 21706}, {23600, 21707},
+    {23562, 21694}, {23608, 21695}, {23589, 21697}, {23615, 21705}, {23600, 21699}, {23601, 21700}, {23603, 21701}, {23605, 21702},
+    {23604, 21703}, {23605, 21708}, {23556, 21709}, {23614, 21710}, {23574, 21711}, {23574, 21712}, {23565, 21713}, {23566, 21714},
+    {23554, 21715}, {23554, 21716}, {23554, 21717}, {23554, 21718}, {23559, 21719}, {23557, 21720}, {23558, 21721}, {23665, 21722},
+    {23669, 21723}, {23577, 21724}, {23569, 21725}, {23576, 21760}, {23568, 21874}, {23775, 21726}, {23791, 21727}, {23792, 21728},
+    {23780, 21736}, {23789, 21729}, {23787, 21730}, {23571, 21760}, {201, 21761}, {23776, 21731}, {23777, 21732}, {23796, 21733},
+    {23783, 21860}, {23692, 21734}, {23693, 21735}, {23732, 21737}, {23779, 21738}, {23807, 21739}, {23802, 21740}, {23796, 21762},
+    {23790, 21860}, {23789, 21860}, {23804, 21872}, {23794, 21741}, {23798, 21742}, {23798, 21743}, {23807, 21744}, {23807, 21762},
+    {23765, 21745}, {23767, 21746}, {23757, 21747}, {23757, 21748}, {23748, 21763}, {23570, 21723}, {23756, 21873}, {23747, 21749},
+    {23770, 21750}, {23687, 21751}, {23749, 21752}, {23749, 21753}, {23759, 21763}, {23748, 21878}, {23769, 21754}, {23770, 21755},
+    {23756, 21764}, {23787, 21757}, {23745, 21758}, {23747, 21759}, {23798, 21734}, {23772, 21765}, {23760, 21766}, {23792, 21735},
+    {23751, 21764}, {23760, 21767}, {23765, 21768}, {23765, 21769}, {23764, 21880}, {23800, 21733}, {2302, 21771}, {23725, 21773},
+    {23596, 21709}, {23772, 21770}, {23725, 21774}, {23716, 21775}, {23713, 21870}, {23724, 21885}, {23718, 21776}, {23712, 21777},
+    {23719, 21856}, {23767, 21770}, {23572, 21715}, {23727, 21775}, {23720, 21870}, {23719, 21870}, {1875, 21779}, {23757, 21780},
+    {23723, 21778}, {23697, 21781}, {23713, 21782}, {23786, 21783}, {23787, 21784}, {23735, 21785}, {23738, 21786}, {23743, 21787},
+    {23714, 21778}, {23739, 21788}, {23568, 21722}, {23741, 21789}, {23743, 21790}, {23728, 21791}, {23733, 21792}, {23727, 21793},
+    {23766, 21756}, {23683, 21794}, {23721, 21795}, {23681, 21796}, {23728, 21797}, {23700, 21798}, {23742, 21799}, {23702, 21800},
+    {23740, 21801}, {23739, 21802}, {23691, 21803}, {23700, 21808}, {23680, 21816}, {23681, 21804}, {23710, 21805}, {23760, 21820},
+    {23683, 21806}, {23705, 21809}, {23709, 21810}, {23728, 21811}, {23709, 21812}, {23711, 21813}, {23686, 21814}, {23795, 21815},
+    {23681, 21818}, {860, 21819}, {894, 21821}, {23797, 21822}, {23721, 21823}, {23705, 21824}, {23746, 21825}, {1077, 21826},
+    {23690, 21827}, {23717, 21828}, {23702, 21829}, {23804, 21831}, {1534, 21832}, {23704, 21834}, {23692, 21835}, {23807, 21836},
+    {23853, 21837}, {23867, 21838}, {23916, 21839}, {23906, 21840}, {23915, 21842}, {23921, 21843}, {23897, 21844}, {23923, 21845},
+    {23895, 21846}, {341, 21849}, {1831, 21850}, {23918, 21851}, {23818, 21852}, {1379, 21853}, {23819, 21854}, {23820, 21855},
+    {357, 21857}, {23906, 21858}, {23930, 21859}, {23888, 21861}, {23908, 21862}, {23886, 21863}, {23927, 21864}, {23933, 21865},
+    {23935, 21866}, {23910, 21867}, {23929, 21868}, {1042, 21869}, {23853, 21871}, {23915, 21875}, {23833, 21876}, {23840, 21877},
+    {23925, 21879}, {23925, 21881}, {23928, 21882}, {23838, 21883}, {23915, 21884}, {23935, 21886}, {23882, 21887}, {23882, 21888},
+    {23885, 21889}, {23931, 21890}, {23883, 21891}, {23892, 21892}, {23872, 21900}, {23873, 21893}, {23878, 21895}, {23902, 21896},
+    {23924, 21897}, {23896, 21898}, {23922, 21899}, {23854, 21902}, {23855, 21903}, {23874, 21904}, {23892, 21905}, {23878, 21906},
+    {23916, 21907}, {23903, 21908}, {23901, 21909}, {23896, 21910}, {23902, 21911}, {23891, 21912}, {23886, 21914}, {23908, 21915},
+    {23895, 21916}, {23893, 21917}, {23888, 21918}, {23892, 21919}, {23849, 21920}, {23851, 21921}, {23863, 21922}, {23835, 21923},
+    {23854, 21924}, {23854, 21925}, {23744, 21756}, {23849, 21926}, {23830, 21927}, {23870, 21928}, {23870, 21929}, {23842, 21930},
+    {23844, 21931}, {23867, 21982}, {23860, 21933}, {23868, 21934}, {23868, 21935}, {23847, 21936}, {23818, 21937}, {23842, 21938},
+    {23844, 21913}, {23855, 21932}, {23816, 21939}, {23862, 21940}, {23851, 21941}, {23869, 21949}, {23858, 21942}, {23861, 21944},
+    {23862, 21945}, {23846, 21932}, {23812, 21946}, {23866, 21947}, {23823, 21948}, {23817, 21950}, {23824, 21951}, {23819, 21952},
+    {23830, 21953}, {23865, 21954}, {23818, 21955}, {23835, 21957}, {23821, 21965}, {23823, 21964}, {23811, 21958}, {23833, 21959},
+    {23857, 21960}, {23835, 21961}, {23855, 21962}, {23813, 21963}, {23853, 21966}, {23832, 21967}, {23836, 21968}, {23835, 21969},
+    {23813, 21970}, {23848, 21971}, {23829, 21972}, {23831, 21973}, {23827, 21974}, {23834, 22016}, {23830, 22130}, {23841, 21975},
+    {23819, 21976}, {24053, 21977}, {24030, 21978}, {24054, 21979}, {24054, 21980}, {23829, 22016}, {1920, 22017}, {2783, 22018},
+    {24037, 22116}, {24021, 21981}, {24038, 22119}, {24037, 21983}, {24062, 21984}, {24042, 21992}, {24039, 21985}, {24032, 21986},
+    {24044, 22116}, {24035, 22116}, {24033, 22119}, {24044, 22119}, {24036, 21987}, {24014, 21988}, {24038, 21989}, {24012, 21990},
+    {24063, 21991}, {24061, 21993}, {24063, 21994}, {23981, 21995}, {24057, 21996}, {24053, 21997}, {24040, 22000}, {24060, 22008},
+    {24056, 22009}, {24050, 21999}, {24042, 22001}, {24000, 22002}, {24020, 22003}, {24062, 22004}, {24012, 22005}, {24010, 22006},
+    {24005, 22019}, {24013, 22129}, {1787, 22020}, {24006, 22113}, {1507, 22007}, {24004, 22010}, {24004, 22011}, {24031, 22012},
+    {24012, 22019}, {24050, 22013}, {24012, 22113}, {24001, 22113}, {24026, 22014}, {24001, 22015}, {24025, 22021}, {24024, 22132},
+    {24016, 22022}, {24000, 22023}, {24042, 22024}, {23990, 22025}, {1810, 22026}, {24022, 22127}, {24017, 22027}, {24019, 22028},
+    {24027, 22022}, {24021, 22029}, {24018, 22030}, {24010, 22031}, {24028, 22127}, {24017, 22127}, {24032, 22032}, {23988, 22033},
+    {23966, 22034}, {23979, 22036}, {23882, 21913}, {23991, 22038}, {23969, 22046}, {23971, 22047}, {23959, 22039}, {23975, 22040},
+    {23853, 21946}, {23998, 22048}, {23978, 22056}, {23975, 22041}, {23952, 22042}, {23972, 22043}, {23972, 22044}, {23969, 22045},
+    {24002, 22035}, {23948, 22049}, {23993, 22050}, {23946, 22051}, {23992, 22052}, {23973, 22053}, {23999, 22061}, {23984, 22054},
+    {23987, 22055}, {23984, 22057}, {23940, 22058}, {23988, 22059}, {23989, 22060}, {23941, 22062}, {23958, 22063}, {23996, 22064},
+    {23951, 22065}, {23949, 22066}, {23944, 22067}, {23992, 22068}, {23940, 22069}, {23961, 22070}, {23947, 22078}, {23940, 22071},
+    {23985, 22072}, {23937, 22073}, {23938, 22080}, {23958, 22088}, {23962, 22074}, {23962, 22075}, {23964, 22076}, {23955, 22095},
+    {23959, 22077}, {23974, 22079}, {23956, 22081}, {23945, 22082}, {23963, 22090}, {23956, 22083}, {23969, 22084}, {23947, 22085},
+    {23966, 22077}, {24181, 22086}, {24158, 22087}, {24182, 22089}, {24182, 22091}, {24155, 22092}, {24171, 22093}, {24180, 22096},
+    {24160, 22104}, {24161, 22094}, {24150, 22097}, {24164, 22098}, {24185, 22099}, {24171, 22107}, {24164, 22100}, {24188, 22102},
+    {24168, 22110}, {24180, 22111}, {24163, 22112}, {24181, 22120}, {24183, 22121}, {24110, 22105}, {1093, 22106}, {24161, 22108},
+    {24137, 22109}, {24188, 22114}, {24176, 22115}, {24183, 22117}, {477, 22118}, {24168, 22124}, {1700, 22125}, {24097, 22128},
+    {24092, 22131}, {24180, 22133}, {24100, 22134}, {24176, 22135}, {24148, 22136}, {24097, 22137}, {24189, 22138}, {24089, 22139},
+    {24134, 22140}, {24135, 22141}, {24137, 22142}, {24149, 22143}, {24155, 22144}, {24156, 22145}, {24133, 22146}, {24081, 22147},
+    {722, 22148}, {24142, 22149}, {24131, 22150}, {24110, 22151}, {24138, 22152}, {24158, 22153}, {24154, 22154}, {24129, 22155},
+    {24156, 22156}, {24078, 22157}, {1346, 22158}, {24117, 22159}, {24169, 22160}, {23975, 22035}, {24153, 22161}, {24066, 22162},
+    {24121, 22164}, {24148, 22165}, {24148, 22166}, {24143, 22167}, {24162, 22168}, {24138, 22169}, {24145, 22170}, {24186, 22172},
+    {881, 22173}, {2503, 22174}, {24110, 22177}, {24118, 22178}, {1054, 22179}, {24131, 22181}, {24097, 22182}, {24107, 22183},
+    {23983, 22058}, {24109, 22184}, {24116, 22185}, {24103, 22186}, {24103, 22187}, {24101, 22188}, {24126, 22190}, {23980, 22062},
+    {659, 22191}, {24106, 22193}, {24081, 22194}, {24097, 22195}, {24098, 22196}, {24118, 22204}, {24122, 22197}, {24113, 22198},
+    {24124, 22199}, {24125, 22200}, {24115, 22201}, {24070, 22202}, {24111, 22203}, {24105, 22205}, {24110, 22206}, {24065, 22207},
+    {24077, 22208}, {24155, 22209}, {24071, 22210}, {24077, 22211}, {24123, 22212}, {24075, 22213}, {24084, 22214}, {24064, 22222},
+    {24065, 22215}, {24071, 22216}, {24067, 22217}, {24070, 22386}, {24065, 22219}, {24091, 22220}, {24111, 22221}, {24069, 22223},
+    {24074, 22272}, {24109, 22224}, {24092, 22225}, {24180, 22226}, {24091, 22227}, {24089, 22229}, {24067, 22230}, {487, 22231},
+    {24069, 22272}, {24103, 22232}, {24087, 22233}, {24072, 22240}, {24092, 22248}, {24085, 22234}, {24078, 22235}, {24076, 22236},
+    {24090, 22237}, {24287, 22238}, {24286, 22239}, {24310, 22241}, {24310, 22242}, {24294, 22243}, {24299, 22244}, {24299, 22245},
+    {24297, 22246}, {24289, 22247}, {24288, 22387}, {24246, 22249}, {24296, 22250}, {24295, 22251}, {24292, 22252}, {24318, 22253},
+    {24296, 22273}, {24209, 22254}, {24210, 22255}, {24233, 22256}, {24305, 22257}, {24315, 22258}, {24307, 22260}, {24313, 22261},
+    {24291, 22273}, {24307, 22262}, {1201, 22263}, {24305, 22264}, {187, 22265}, {2036, 22266}, {24224, 22267}, {266, 22268},
+    {24318, 22269}, {24297, 22270}, {139, 22271}, {24305, 22276}, {24299, 22277}, {1308, 22278}, {2369, 22279}, {24224, 22280},
+    {24219, 22281}, {24216, 22282}, {24282, 22288}, {24278, 22293}, {1412, 22285}, {1145, 22286}, {24266, 22379}, {24231, 22289},
+    {24285, 22290}, {24309, 22291}, {24256, 22292}, {24260, 22294}, {24256, 22295}, {24256, 22296}, {24260, 22297}, {24302, 22298},
+    {24262, 22299}, {24300, 22300}, {24273, 22301}, {24245, 22302}, {24283, 22303}, {24281, 22304}, {24279, 22305}, {2236, 22307},
+    {24280, 22308}, {24275, 22309}, {24278, 22310}, {24261, 22311}, {24275, 22312}, {24196, 22313}, {24255, 22314}, {24239, 22316},
+    {24107, 22201}, {24245, 22317}, {2163, 22318}, {24230, 22319}, {24259, 22320}, {2611, 22321}, {24318, 22322}, {24234, 22323},
+    {24230, 22287}, {24242, 22324}, {24216, 22325}, {24252, 22326}, {24214, 22327}, {24225, 22328}, {24248, 22329}, {24365, 22330},
+    {24211, 22333}, {24234, 22334}, {1436, 22335}, {24270, 22336}, {24230, 22337}, {24251, 22338}, {24245, 22339}, {24297, 22340},
+    {24253, 22341}, {24254, 22342}, {24242, 22343}, {24246, 22344}, {24245, 22345}, {24204, 22347}, {24245, 22348}, {24249, 22349},
+    {24243, 22350}, {24244, 22351}, {24210, 22352}, {24205, 22353}, {24215, 22354}, {24251, 22355}, {24206, 22356}, {24206, 22357},
+    {24201, 22358}, {24205, 22359}, {24199, 22360}, {24193, 22361}, {24216, 22362}, {24195, 22363}, {24198, 22364}, {24221, 22365},
+    {24364, 22366}, {24202, 22367}, {24222, 22368}, {24218, 22369}, {24193, 22370}, {24220, 22371}, {24221, 22372}, {24222, 22373},
+    {24211, 22374}, {24215, 22375}, {24205, 22376}, {24229, 22377}, {24207, 22378}, {24227, 22380}, {24317, 22381}, {24323, 22382},
+    {24382, 22383}, {24427, 22384}, {24431, 22385}, {24418, 22388}, {24422, 22389}, {24422, 22390}, {24447, 22391}, {24402, 22392},
+    {24442, 22393}, {24443, 22394}, {24197, 22374}, {24399, 22395}, {24442, 22396}, {24442, 22397}, {24445, 22398}, {2648, 22399},
+    {24340, 22400}, {24394, 22401}, {24440, 22402}, {24365, 22403}, {24438, 22404}, {24432, 22405}, {24439, 22516}, {24430, 22407},
+    {24443, 22406}, {24385, 22408}, {24434, 22409}, {24422, 22381}, {24346, 22410}, {24388, 22411}, {24395, 22412}, {24392, 22413},
+    {24434, 22406}, {24394, 22414}, {24384, 22415}, {24392, 22416}, {24396, 22417}, {24411, 22418}, {24390, 22419}, {24388, 22420},
+    {24228, 22343}, {24386, 22421}, {24397, 22422}, {24389, 22500}, {24384, 22423}, {24266, 22287}, {24388, 22424}, {24430, 22425},
+    {24390, 22426}, {24428, 22427}, {24388, 22422}, {24413, 22428}, {24414, 22429}, {24401, 22431}, {24402, 22432}, {24420, 22434},
+    {24392, 22435}, {24392, 22436}, {24416, 22437}, {24373, 22438}, {24375, 22439}, {24365, 22440}, {24363, 22441}, {24374, 22442},
+    {24345, 22443}, {24371, 22444}, {24435, 22445}, {24367, 22446}, {24225, 22339}, {24354, 22447}, {24359, 22448}, {24355, 22449},
+    {24402, 22430}, {24356, 22433}, {24357, 22450}, {24380, 22451}, {24493, 22452}, {24354, 22454}, {24374, 22462}, {24374, 22463},
+    {24425, 22455}, {24373, 22456}, {24358, 22457}, {24329, 22458}, {24378, 22459}, {473, 22460}, {24367, 22461}, {24323, 22464},
+    {24377, 22489}, {24374, 22465}, {24374, 22466}, {24369, 22467}, {24410, 22468}, {24324, 22469}, {24331, 22470}, {24328, 22471},
+    {24368, 22489}, {24383, 22489}, {24330, 22472}, {24330, 22473}, {24338, 22474}, {24376, 22475}, {24348, 22476}, {24374, 22477},
+    {24373, 22478}, {24351, 22479}, {24345, 22480}, {24429, 22481}, {24404, 22482}, {24321, 22483}, {24345, 22484}, {24340, 22485},
+    {24347, 22486}, {24321, 22487}, {24361, 22488}, {24323, 22490}, {24359, 22491}, {24348, 22492}, {24340, 22493}, {24356, 22494},
+    {24328, 22495}, {24328, 22496}, {24341, 22497}, {24332, 22498}, {24492, 22499}, {24504, 22501}, {24550, 22502}, {24557, 22503},
+    {24558, 22504}, {24552, 22505}, {24556, 22506}, {24544, 22507}, {24544, 22508}, {762, 22528}, {24574, 22509}, {24529, 22510},
+    {24555, 22629}, {24546, 22511}, {24574, 22512}, {24574, 22513}, {24545, 22514}, {24524, 22515}, {24544, 22517}, {24572, 22518},
+    {24546, 22629}, {24553, 22629}, {24573, 22519}, {24567, 22521}, {24563, 22522}, {24566, 22643}, {24560, 22523}, {24527, 22524},
+    {24570, 22529}, {24530, 22525}, {24573, 22526}, {24535, 22527}, {24528, 22530}, {24570, 22531}, {24525, 22532}, {24527, 22533},
+    {24565, 22529}, {24518, 22534}, {24541, 22535}, {24565, 22536}, {24512, 22537}, {24516, 22538}, {24515, 22539}, {24523, 22540},
+    {24513, 22541}, {24539, 22542}, {24514, 22543}, {24541, 22544}, {24541, 22545}, {24539, 22546}, {24518, 22547}, {24553, 22548},
+    {24515, 22549}, {24534, 22550}, {24534, 22551}, {24521, 22552}, {24548, 22553}, {24520, 22554}, {24530, 22555}, {24522, 22556},
+    {24544, 22557}, {24500, 22558}, {24388, 22430}, {24393, 22433}, {24478, 22559}, {24492, 22560}, {24492, 22561}, {24503, 22562},
+    {24474, 22563}, {24498, 22564}, {24494, 22565}, {24483, 22566}, {24483, 22568}, {24480, 22569}, {24483, 22571}, {24481, 22572},
+    {24563, 22520}, {24500, 22567}, {24501, 22570}, {24508, 22573}, {24461, 22574}, {24487, 22575}, {24506, 22576}, {24506, 22577},
+    {24485, 22578}, {24456, 22579}, {24494, 22580}, {24488, 22581}, {24451, 22582}, {24496, 22583}, {24501, 22584}, {24503, 22585},
+    {24457, 22586}, {844, 22589}, {2055, 22590}, {24545, 22591}, {24509, 22592}, {24461, 22593}, {24542, 22594}, {583, 22596},
+    {24465, 22597}, {24505, 22598}, {24551, 22599}, {24530, 22600}, {24460, 22601}, {24451, 22602}, {24448, 22603}, {24450, 22604},
+    {24473, 22605}, {24497, 22606}, {24452, 22607}, {24472, 22608}, {24479, 22609}, {24564, 22610}, {24475, 22612}, {24473, 22613},
+    {24452, 22614}, {24487, 22615}, {24461, 22616}, {24468, 22618}, {24468, 22619}, {24483, 22621}, {1622, 22622}, {24573, 22623},
+    {24481, 22624}, {24465, 22625}, {24634, 22626}, {24635, 22627}, {24679, 22628}, {24682, 22630}, {24687, 22631}, {24683, 22632},
+    {24680, 22633}, {24680, 22634}, {24699, 22635}, {24662, 22636}, {24702, 22637}, {24703, 22638}, {24659, 22639}, {24678, 22640},
+    {24678, 22641}, {24673, 22642}, {24693, 22644}, {24703, 22645}, {24697, 22646}, {24672, 22647}, {24699, 22648}, {24689, 22649},
+    {24649, 22650}, {24700, 22651}, {24683, 22652}, {24628, 22653}, {2128, 22655}, {24686, 22656}, {24644, 22657}, {24695, 22658},
+    {24693, 22659}, {24688, 22660}, {24692, 22661}, {24648, 22662}, {24648, 22663}, {24662, 22664}, {24700, 22665}, {24655, 22666},
+    {24653, 22667}, {24648, 22668}, {24696, 22669}, {24668, 22670}, {24668, 22671}, {24644, 22672}, {24642, 22673}, {24645, 22752},
+    {24653, 22674}, {24668, 22675}, {24687, 22676}, {24668, 22677}, {24668, 22678}, {24666, 22679}, {24661, 22680}, {24669, 22762},
+    {24644, 22674}, {24680, 22681}, {24652, 22682}, {24652, 22683}, {24677, 22684}, {24655, 22685}, {24668, 22680}, {24649, 22686},
+    {24511, 22570}, {1399, 22687}, {24555, 22520}, {24506, 22567}, {24668, 22778}, {2148, 22688}, {24609, 22725}, {24604, 22689},
+    {24618, 22690}, {24631, 22691}, {24609, 22699}, {24622, 22692}, {24663, 22778}, {24666, 22778}, {24616, 22725}, {24615, 22725},
+    {24636, 22693}, {24598, 22694}, {24609, 22695}, {24611, 22696}, {24610, 22697}, {24762, 22698}, {24639, 22704}, {24617, 22712},
+    {24619, 22713}, {24638, 22701}, {24632, 22702}, {24639, 22749}, {753, 22705}, {142, 22706}, {24667, 22707}, {24627, 22708},
+    {24627, 22703}, {24578, 22709}, {24628, 22740}, {24624, 22710}, {24633, 22743}, {24621, 22711}, {24582, 22719}, {24587, 22714},
+    {24634, 22703}, {24636, 22715}, {24639, 22740}, {24626, 22740}, {24624, 22743}, {24639, 22743}, {24592, 22716}, {24592, 22717},
+    {24597, 22718}, {24632, 22720}, {24583, 22721}, {24627, 22722}, {24579, 22723}, {24604, 22724}, {24584, 22732}, {24601, 22726},
+    {24600, 22727}, {24601, 22728}, {24599, 22729}, {24618, 22730}, {24600, 22731}, {24581, 22736}, {24607, 22744}, {24592, 22733},
+    {24596, 22734}, {24597, 22735}, {24604, 22784}, {24596, 22898}, {24818, 22737}, {24797, 22738}, {24814, 22739}, {24795, 22741},
+    {24817, 22742}, {24819, 22745}, {24599, 22784}, {24792, 22746}, {24806, 22747}, {24827, 22753}, {24813, 22761}, {24802, 22748},
+    {24830, 22756}, {24810, 22764}, {24810, 22765}, {24784, 22751}, {24830, 22754}, {24803, 22755}, {24821, 22763}, {24826, 22757},
+    {24779, 22758}, {24827, 22759}, {24804, 22768}, {24816, 22776}, {24817, 22760}, {1829, 22767}, {24813, 22769}, {24773, 22770},
+    {24731, 22771}, {24732, 22772}, {24743, 22773}, {24816, 22774}, {24822, 22775}, {24773, 22777}, {24830, 22779}, {24790, 22780},
+    {24583, 22729}, {24790, 22781}, {24778, 22782}, {24778, 22783}, {24789, 22785}, {24824, 22786}, {24796, 22787}, {24775, 22788},
+    {24773, 22789}, {24792, 22790}, {24819, 22791}, {24793, 22792}, {24794, 22793}, {24816, 22794}, {24795, 22795}, {24793, 22796},
+    {24796, 22797}, {24797, 22798}, {24756, 22799}, {24580, 22707}, {24793, 22800}, {24716, 22801}, {24796, 22802}, {24779, 22803},
+    {24724, 22804}, {24704, 22805}, {24705, 22806}, {2746, 22807}, {24795, 22808}, {800, 22811}, {24777, 22812}, {24801, 22813},
+    {24767, 22814}, {24747, 22816}, {24754, 22817}, {24877, 22818}, {592, 22819}, {24739, 22821}, {24759, 22822}, {175, 22823},
+    {24737, 22824}, {24773, 22825}, {24737, 22826}, {24756, 22827}, {24742, 22828}, {24742, 22829}, {24761, 22830}, {24723, 22831},
+    {24761, 22832}, {24763, 22835}, {2137, 22836}, {1901, 22838}, {2538, 22839}, {24737, 22841}, {24767, 22842}, {24738, 22843},
+    {24717, 22844}, {24743, 22845}, {24814, 22846}, {24752, 22847}, {24767, 22848}, {24764, 22849}, {24758, 22850}, {24793, 22852},
+    {24800, 22853}, {1939, 22854}, {24795, 22855}, {24707, 22856}, {24755, 22857}, {24804, 22858}, {1935, 22859}, {24752, 22860},
+    {24724, 22861}, {24766, 22862}, {24726, 22863}, {24764, 22864}, {24720, 22865}, {24761, 22866}, {24716, 22867}, {24704, 22868},
+    {24711, 22869}, {24708, 22870}, {24708, 22871}, {24735, 22872}, {24754, 22873}, {24730, 22874}, {784, 22875}, {2708, 22876},
+    {24714, 22877}, {24778, 22878}, {24734, 22879}, {24710, 22880}, {24748, 22881}, {24704, 22882}, {24746, 22883}, {24728, 22884},
+    {24734, 22885}, {24721, 23026}, {24724, 22886}, {24712, 22887}, {24738, 22888}, {24714, 22889}, {24736, 22890}, {24926, 22891},
+    {24729, 22912}, {24950, 22892}, {24950, 22893}, {24939, 22894}, {24945, 22895}, {24921, 22896}, {24947, 22897}, {24919, 22899},
+    {24720, 22912}, {24954, 22900}, {24917, 22901}, {24934, 22902}, {24915, 22903}, {24931, 22904}, {24956, 22913}, {24936, 22921},
+    {24953, 22905}, {24931, 22906}, {24951, 22907}, {24957, 22908}, {24959, 22909}, {24934, 22910}, {24953, 22911}, {24931, 22914},
+    {24903, 22915}, {24946, 22916}, {24946, 22917}, {24949, 22918}, {24946, 22919}, {24948, 22920}, {24907, 23032}, {24859, 22923},
+    {24959, 22922}, {24903, 22924}, {24906, 22925}, {24911, 22926}, {24907, 22927}, {24909, 22928}, {24916, 22929}, {24837, 22930},
+    {24950, 22922}, {24898, 22931}, {24898, 22932}, {24898, 22933}, {24898, 22934}, {24898, 22935}, {24925, 22936}, {24944, 22937},
+    {24900, 22938}, {24926, 22939}, {24902, 22940}, {24940, 22941}, {24896, 22942}, {24938, 22943}, {24925, 22944}, {24900, 22945},
+    {24853, 22946}, {24934, 22947}, {24916, 22948}, {24905, 22949}, {24923, 22957}, {24916, 22950}, {24909, 22951}, {24928, 22952},
+    {24877, 22953}, {24882, 22954}, {24861, 22955}, {24878, 22956}, {24886, 22960}, {24866, 22968}, {24866, 22969}, {24885, 22962},
+    {24879, 22970}, {24877, 22971}, {24895, 22961}, {24851, 22963}, {24870, 22964}, {24870, 22965}, {24865, 22966}, {24894, 22967},
+    {24894, 22972}, {24865, 22973}, {24844, 22974}, {24864, 22975}, {24842, 22976}, {24866, 22977}, {24866, 22978}, {24920, 22979},
+    {24880, 22980}, {24888, 22981}, {24887, 22982}, {24885, 22983}, {24887, 22984}, {24881, 22985}, {24846, 22986}, {24849, 22987},
+    {24892, 22988}, {24848, 22989}, {24890, 22990}, {24840, 22991}, {24853, 22992}, {24845, 23000}, {24834, 22993}, {24862, 22995},
+    {24842, 23003}, {24842, 23002}, {24842, 22997}, {24862, 22998}, {24858, 22999}, {24832, 23001}, {24859, 23004}, {24874, 23005},
+    {24856, 23006}, {24837, 23008}, {24863, 23016}, {24848, 23007}, {24853, 23009}, {24847, 23010}, {1472, 23011}, {24846, 23013},
+    {24858, 23021}, {24858, 23020}, {24864, 23014}, {25076, 23015}, {25076, 23017}, {25068, 23018}, {25068, 23019}, {25079, 23022},
+    {25050, 23023}, {25074, 23024}, {1060, 23040}, {25062, 23141}, {25008, 23025}, {25056, 23027}, {25060, 23028}, {25060, 23029},
+    {25082, 23030}, {25040, 23031}, {25068, 23141}, {25057, 23141}, {25083, 23033}, {25081, 23034}, {25084, 23035}, {25056, 23036},
+    {25035, 23037}, {25080, 23038}, {25085, 23039}, {25060, 23041}, {25013, 23042}, {25069, 23043}, {25029, 23044}, {25072, 23045},
+    {25076, 23046}, {25075, 23047}, {25072, 23048}, {25078, 23049}, {25033, 23160}, {25037, 23051}, {25037, 23052}, {25036, 23167},
+    {25025, 23050}, {25028, 23053}, {25031, 23054}, {25053, 23055}, {25077, 23056}, {25055, 23057}, {25075, 23058}, {25049, 23059},
+    {25032, 23050}, {25039, 23053}, {25073, 23060}, {25028, 23061}, {25048, 23062}, {25055, 23063}, {25030, 23064}, {25068, 23065},
+    {25055, 23066}, {25053, 23067}, {24836, 22979}, {25048, 23068}, {25064, 23069}, {25046, 23070}, {25035, 23072}, {25053, 23080},
+    {25042, 23071}, {25032, 23073}, {25058, 23074}, {25045, 23075}, {25047, 23076}, {25006, 23077}, {25010, 23078}, {24989, 23079},
+    {25006, 23081}, {25015, 23082}, {24986, 23083}, {25003, 23084}, {25011, 23085}, {24983, 23086}, {24994, 23087}, {24994, 23088},
+    {24997, 23089}, {25016, 23090}, {24978, 23091}, {24997, 23092}, {24999, 23093}, {25022, 23094}, {25018, 23095}, {25018, 23096},
+    {25018, 23097}, {25023, 23098}, {25021, 23099}, {25023, 23100}, {25047, 23101}, {25015, 23103}, {25005, 23104}, {24965, 23105},
+    {25007, 23106}, {24963, 23107}, {25012, 23109}, {25054, 23111}, {1416, 23112}, {25018, 23113}, {25056, 23114}, {24975, 23115},
+    {24973, 23116}, {1620, 23117}, {24961, 23118}, {25060, 23119}, {24976, 23120}, {24979, 23121}, {24969, 23122}, {24975, 23123},
+    {24986, 23124}, {24991, 23125}, {24962, 23126}, {25069, 23127}, {24987, 23129}, {24990, 23130}, {2206, 23131}, {25035, 23132},
+    {24983, 23133}, {24986, 23134}, {24991, 23135}, {24987, 23136}, {25078, 23137}, {950, 23139}, {24963, 23140}, {24999, 23142},
+    {25081, 23143}, {1202, 23144}, {24991, 23145}, {24981, 23146}, {24983, 23147}, {24974, 23148}, {24977, 23149}, {24987, 23150},
+    {25088, 23151}, {25199, 23154}, {25197, 23155}, {2182, 23157}, {25145, 23158}, {25185, 23159}, {25196, 23161}, {25197, 23162},
+    {25193, 23163}, {25197, 23164}, {25191, 23165}, {25213, 23166}, {25189, 23166}, {25169, 23169}, {25211, 23170}, {25167, 23171},
+    {25210, 23172}, {25210, 23173}, {25198, 23166}, {25213, 23174}, {25134, 23175}, {25211, 23176}, {25215, 23177}, {25206, 23178},
+    {25202, 23288}, {25193, 23179}, {25189, 23166}, {25156, 23180}, {25201, 23181}, {25206, 23182}, {25197, 23183}, {25201, 23178},
+    {25138, 23184}, {25120, 23185}, {25115, 23186}, {25159, 23187}, {25175, 23188}, {25211, 23189}, {25166, 23190}, {25166, 23191},
+    {25161, 23192}, {25207, 23193}, {25159, 23194}, {25176, 23200}, {25164, 23208}, {25157, 23195}, {25155, 23196}, {25153, 23197},
+    {25180, 23198}, {25199, 23199}, {25157, 23201}, {25163, 23202}, {1811, 23203}, {25097, 23204}, {25178, 23205}, {25178, 23206},
+    {25154, 23209}, {25192, 23210}, {25171, 23211}, {25169, 23212}, {25172, 23213}, {25089, 23214}, {25177, 23215}, {25177, 23216},
+    {25164, 23217}, {25164, 23218}, {25119, 23219}, {25132, 23220}, {25143, 23221}, {25209, 23222}, {25125, 23223}, {25113, 23224},
+    {25129, 23225}, {25146, 23232}, {25134, 23240}, {25123, 23226}, {25163, 23227}, {25206, 23228}, {25123, 23229}, {25127, 23230},
+    {25130, 23231}, {1274, 23233}, {218, 23234}, {25168, 23235}, {25195, 23236}, {25143, 23237}, {25193, 23238}, {25137, 23239},
+    {25199, 23241}, {25196, 23243}, {25175, 23246}, {25186, 23248}, {25130, 23223}, {25137, 23249}, {25140, 23251}, {25140, 23252},
+    {2633, 23255}, {25180, 23256}, {25181, 23257}, {25188, 23258}, {25139, 23259}, {25113, 23262}, {2698, 23296}, {310, 23263},
+    {25102, 23397}, {25100, 23264}, {25104, 23265}, {25146, 23266}, {25106, 23267}, {25099, 23397}, {25144, 23268}, {25094, 23269},
+    {25094, 23270}, {25113, 23271}, {25140, 23272}, {25112, 23273}, {25172, 23274}, {2014, 23275}, {25088, 23276}, {25109, 23277},
+    {25119, 23278}, {25118, 23280}, {25104, 23281}, {25117, 23282}, {25104, 23283}, {25105, 23284}, {25207, 23285}, {1465, 23286},
+    {25110, 23287}, {25110, 23289}, {25274, 23291}, {503, 23292}, {25210, 23294}, {25109, 23295}, {25107, 23297}, {25102, 23298},
+    {25121, 23299}, {25099, 23300}, {25320, 23301}, {25321, 23302}, {25312, 23304}, {25305, 23305}, {2757, 23307}, {25321, 23308},
+    {25313, 23309}, {25320, 23310}, {25319, 23420}, {25229, 23311}, {25312, 23312}, {25318, 23313}, {25329, 23314}, {25337, 23392},
+    {25334, 23315}, {25315, 23310}, {25338, 23316}, {25331, 23318}, {25250, 23319}, {25340, 23320}, {25336, 23314}, {25331, 23321},
+    {25328, 23317}, {25328, 23322}, {25330, 23323}, {25330, 23324}, {25322, 23325}, {25280, 23326}, {25300, 23327}, {25342, 23328},
+    {25240, 23329}, {25286, 23330}, {25293, 23331}, {25294, 23332}, {25288, 23333}, {25294, 23334}, {25283, 23335}, {25232, 23337},
+    {25294, 23338}, {25285, 23339}, {25286, 23340}, {25280, 23341}, {25281, 23342}, {25304, 23343}, {25311, 23362}, {25299, 23344},
+    {25307, 23345}, {25305, 23346}, {25284, 23347}, {25318, 23348}, {25294, 23349}, {1242, 23350}, {25343, 23317}, {25306, 23344},
+    {25319, 23303}, {25300, 23336}, {25306, 23379}, {2019, 23351}, {25278, 23352}, {25312, 23353}, {25262, 23354}, {25339, 23355},
+    {25255, 23356}, {25261, 23357}, {25301, 23379}, {25304, 23379}, {25263, 23358}, {25270, 23359}, {25257, 23360}, {25256, 23361},
+    {25276, 23363}, {25238, 23364}, {25278, 23365}, {25236, 23366}, {1729, 23368}, {25272, 23369}, {25234, 23370}, {25294, 23371},
+    {25232, 23372}, {25278, 23373}, {25251, 23376}, {25269, 23384}, {25274, 23374}, {25279, 23375}, {25254, 23377}, {25389, 23378},
+    {25302, 23380}, {25325, 23381}, {25270, 23382}, {25264, 23383}, {25279, 23385}, {25313, 23386}, {25273, 23387}, {25268, 23388},
+    {25269, 23389}, {25265, 23390}, {25279, 23391}, {25231, 23393}, {25232, 23394}, {25220, 23402}, {25229, 23395}, {25224, 23396},
+    {25224, 23398}, {25243, 23399}, {25270, 23400}, {25246, 23401}, {25221, 23403}, {25221, 23404}, {25228, 23424}, {25220, 23538},
+    {25246, 23405}, {25240, 23406}, {25247, 23539}, {25222, 23407}, {25257, 23408}, {25242, 23409}, {25223, 23424}, {25227, 23410},
+    {25235, 23425}, {25254, 23411}, {25239, 23412}, {25246, 23413}, {25234, 23414}, {25238, 23415}, {25229, 23416}, {25232, 23417},
+    {25242, 23425}, {25345, 23418}, {25400, 23419}, {25453, 23421}, {25453, 23422}, {25440, 23423}, {25455, 23426}, {25452, 23427},
+    {25442, 23429}, {25442, 23430}, {25442, 23431}, {25356, 23432}, {25444, 23433}, {25445, 23434}, {25468, 23435}, {25404, 23436},
+    {25440, 23440}, {25460, 23448}, {25456, 23449}, {25466, 23438}, {25442, 23439}, {25416, 23441}, {25453, 23442}, {25413, 23443},
+    {25371, 23444}, {25382, 23445}, {25459, 23446}, {25463, 23447}, {25466, 23450}, {25422, 23451}, {25422, 23452}, {25425, 23453},
+    {25468, 23454}, {25424, 23455}, {25430, 23456}, {25465, 23457}, {25418, 23458}, {1783, 23459}, {25384, 23460}, {25462, 23461},
+    {25412, 23462}, {25361, 23463}, {25335, 23303}, {25306, 23336}, {25410, 23464}, {25410, 23465}, {25437, 23466}, {25456, 23467},
+    {25412, 23468}, {25355, 23469}, {25431, 23470}, {25408, 23471}, {25451, 23472}, {25432, 23473}, {25439, 23474}, {25436, 23475},
+    {25460, 23428}, {25380, 23476}, {25401, 23477}, {25344, 23478}, {25429, 23479}, {25429, 23480}, {25432, 23481}, {25441, 23482},
+    {25419, 23483}, {25396, 23484}, {25392, 23488}, {25380, 23496}, {25376, 23497}, {25390, 23486}, {25397, 23487}, {25517, 23489},
+    {25378, 23490}, {25383, 23491}, {25377, 23492}, {25400, 23493}, {25379, 23494}, {25379, 23495}, {25383, 23498}, {25390, 23552},
+    {25402, 23666}, {25357, 23499}, {25405, 23500}, {25382, 23504}, {25394, 23512}, {25407, 23501}, {25394, 23502}, {25401, 23552},
+    {25398, 23503}, {25394, 23505}, {25385, 23506}, {25396, 23507}, {25395, 23508}, {25385, 23509}, {25345, 23510}, {25387, 23511},
+    {25407, 23513}, {25358, 23514}, {25366, 23515}, {25403, 23516}, {25361, 23517}, {25401, 23518}, {25437, 23519}, {25357, 23520},
+    {25344, 23521}, {25345, 23522}, {25349, 23523}, {25353, 23524}, {25347, 23525}, {25349, 23526}, {25372, 23527}, {25375, 23528},
+    {25364, 23529}, {25373, 23530}, {25375, 23531}, {25350, 23532}, {25369, 23533}, {25369, 23534}, {25367, 23535}, {25354, 23536},
+    {25381, 23537}, {25359, 23540}, {25369, 23541}, {25363, 23542}, {25365, 23543}, {25356, 23544}, {25582, 23545}, {25580, 23546},
+    {25578, 23547}, {25581, 23667}, {25577, 23548}, {25569, 23549}, {25568, 23664}, {25577, 23550}, {25571, 23551}, {25573, 23555},
+    {25573, 23553}, {25576, 23554}, {25596, 23556}, {25599, 23557}, {25588, 23558}, {25596, 23559}, {25592, 23560}, {25575, 23561},
+    {25580, 23553}, {25571, 23554}, {25594, 23562}, {25597, 23563}, {25572, 23564}, {25525, 23565}, {25542, 23566}, {25582, 23567},
+    {25582, 23568}, {1719, 23571}, {25576, 23572}, {25538, 23573}, {25502, 23574}, {25584, 23576}, {25556, 23577}, {2158, 23578},
+    {25505, 23579}, {25496, 23580}, {25549, 23581}, {25549, 23582}, {25536, 23583}, {25545, 23584}, {25555, 23585}, {25591, 23586},
+    {25565, 23587}, {25589, 23588}, {25467, 23428}, {25419, 23476}, {512, 23589}, {25550, 23590}, {25538, 23591}, {25542, 23592},
+    {25565, 23593}, {25536, 23594}, {25557, 23595}, {25567, 23596}, {25553, 23597}, {1508, 23599}, {25543, 23600}, {25579, 23601},
+    {25525, 23602}, {25526, 23603}, {25485, 23604}, {25558, 23605}, {25552, 23606}, {25567, 23607}, {25566, 23608}, {25554, 23609},
+    {25558, 23610}, {25549, 23611}, {25552, 23612}, {25519, 23613}, {25525, 23614}, {25501, 23615}, {25527, 23616}, {25499, 23617},
+    {25599, 23618}, {25507, 23619}, {25518, 23620}, {25507, 23621}, {25511, 23622}, {25493, 23623}, {25517, 23624}, {25509, 23625},
+    {25510, 23626}, {25524, 23627}, {25504, 23629}, {25509, 23630}, {25485, 23631}, {25511, 23632}, {25483, 23633}, {25482, 23634},
+    {25506, 23635}, {25506, 23636}, {25526, 23637}, {25518, 23638}, {25476, 23639}, {25512, 23640}, {25474, 23641}, {25517, 23642},
+    {25472, 23643}, {25485, 23644}, {25534, 23645}, {25484, 23646}, {25489, 23648}, {25475, 23656}, {25484, 23647}, {25485, 23649},
+    {25492, 23650}, {25645, 23651}, {25527, 23652}, {25479, 23653}, {25497, 23654}, {25483, 23662}, {25476, 23655}, {25501, 23657},
+    {25520, 23658}, {25501, 23659}, {25474, 23660}, {25516, 23661}, {25497, 23663}, {25479, 23668}, {25489, 23676}, {25491, 23677},
+    {25482, 23670}, {25502, 23678}, {25502, 23679}, {25487, 23671}, {25507, 23672}, {25494, 23673}, {25494, 23674}, {25489, 23675},
+    {25710, 23680}, {25718, 23681}, {25692, 23682}, {25712, 23683}, {25690, 23684}, {25699, 23686}, {25697, 23687}, {25699, 23688},
+    {25684, 23689}, {25698, 23690}, {25727, 23696}, {25719, 23704}, {25720, 23691}, {25696, 23698}, {25716, 23706}, {25712, 23707},
+    {25703, 23700}, {25713, 23708}, {25715, 23709}, {1809, 23694}, {25633, 23695}, {25704, 23697}, {25666, 23699}, {25717, 23701},
+    {25721, 23787}, {25719, 23702}, {25678, 23703}, {25682, 23705}, {25725, 23710}, {25678, 23711}, {25679, 23712}, {25686, 23713},
+    {25712, 23787}, {25727, 23787}, {25611, 23714}, {25533, 23627}, {25683, 23715}, {25719, 23716}, {25666, 23717}, {25666, 23718},
+    {25669, 23719}, {25666, 23720}, {25668, 23721}, {25679, 23722}, {25691, 23768}, {25669, 23723}, {25709, 23724}, {25688, 23725},
+    {25692, 23726}, {25691, 23727}, {25705, 23728}, {25670, 23722}, {25689, 23729}, {25674, 23730}, {25694, 23738}, {25683, 23731},
+    {25606, 23685}, {25680, 23732}, {25679, 23733}, {25616, 23734}, {25677, 23735}, {25696, 23736}, {25645, 23737}, {25653, 23739},
+    {25629, 23740}, {25640, 23741}, {25644, 23742}, {25643, 23743}, {25645, 23744}, {25647, 23745}, {25633, 23746}, {25661, 23747},
+    {25621, 23748}, {25632, 23749}, {25636, 23750}, {25635, 23751}, {25658, 23752}, {25615, 23753}, {25658, 23754}, {25658, 23755},
+    {25661, 23756}, {25658, 23758}, {25634, 23759}, {2343, 23760}, {1813, 23761}, {25687, 23762}, {25607, 23763}, {25655, 23764},
+    {25696, 23765}, {25640, 23766}, {25603, 23767}, {25648, 23769}, {25659, 23770}, {25649, 23771}, {25611, 23772}, {25618, 23773},
+    {25613, 23774}, {25606, 23775}, {25610, 23776}, {25614, 23777}, {25621, 23778}, {25608, 23779}, {25607, 23780}, {25629, 23781},
+    {25653, 23782}, {25631, 23783}, {25651, 23784}, {25687, 23785}, {1119, 23786}, {25649, 23788}, {25711, 23789}, {25625, 23790},
+    {25626, 23791}, {25623, 23792}, {25717, 23793}, {25718, 23794}, {25631, 23796}, {25623, 23798}, {25613, 23799}, {509, 23800},
+    {25619, 23801}, {25623, 23802}, {25613, 23805}, {25842, 23806}, {25851, 23808}, {2670, 23809}, {25820, 23810}, {25847, 23811},
+    {25824, 23812}, {25832, 23813}, {25836, 23814}, {25607, 23792}, {25850, 23815}, {25829, 23816}, {25838, 23817}, {25833, 23821},
+    {25827, 23822}, {25829, 23823}, {25852, 23824}, {25855, 23825}, {25745, 23826}, {25768, 23827}, {25853, 23828}, {25853, 23829},
+    {25840, 23830}, {62, 23831}, {25750, 23832}, {91, 23834}, {25827, 23835}, {25799, 23836}, {25753, 23837}, {25844, 23839},
+    {25844, 23840}, {25839, 23841}, {25794, 23842}, {25834, 23843}, {25840, 23844}, {25699, 23685}, {25812, 23845}, {25854, 23846},
+    {25814, 23847}, {25852, 23848}, {25793, 23849}, {25803, 23850}, {25805, 23851}, {25812, 23852}, {25799, 23853}, {25747, 23856},
+    {25770, 23857}, {25797, 23858}, {25795, 23859}, {25822, 23860}, {25841, 23861}, {25819, 23862}, {25839, 23863}, {25823, 23864},
+    {25792, 23872}, {25812, 23880}, {25821, 23865}, {25819, 23866}, {25817, 23867}, {25796, 23868}, {25831, 23869}, {25805, 23870},
+    {25828, 23803}, {25801, 23871}, {25828, 23873}, {25809, 23874}, {25811, 23875}, {25809, 23876}, {25804, 23877}, {25759, 23878},
+    {25781, 23879}, {25769, 23881}, {25776, 23882}, {25901, 23883}, {25776, 23884}, {25754, 23885}, {25773, 23886}, {25775, 23887},
+    {25766, 23888}, {25915, 23889}, {25843, 23890}, {25775, 23891}, {25762, 23892}, {25767, 23893}, {25763, 23894}, {25761, 23895},
+    {25787, 23896}, {25743, 23897}, {25765, 23898}, {25741, 23899}, {25740, 23900}, {25786, 23901}, {25767, 23904}, {25777, 23912},
+    {25790, 23902}, {25816, 23903}, {25827, 23905}, {25780, 23906}, {25778, 23907}, {25785, 23908}, {25780, 23909}, {25781, 23910},
+    {25732, 23911}, {25790, 23913}, {25750, 23914}, {25750, 23915}, {25729, 23916}, {25739, 23917}, {25741, 23918}, {25748, 23919},
+    {25734, 23920}, {25732, 23921}, {25732, 23922}, {25759, 23923}, {25778, 23924}, {25754, 23925}, {25734, 23926}, {25755, 23927},
+    {25749, 23928}, {25735, 23929}, {25771, 23930}, {25758, 23931}, {25758, 23932}, {25753, 23933}, {25747, 23934}, {25737, 23935},
+    {25903, 23936}, {25744, 23937}, {25743, 23938}, {25902, 23939}, {25750, 23940}, {25750, 23941}, {25750, 23942}, {25967, 23943},
+    {25965, 23944}, {25967, 23945}, {25729, 23928}, {25960, 23946}, {25980, 23947}, {25942, 23948}, {25982, 23949}, {25940, 23950},
+    {25961, 23951}, {25955, 23952}, {25957, 23953}, {25980, 23954}, {25983, 23955}, {25954, 23956}, {25933, 23957}, {25982, 23958},
+    {2703, 23959}, {25957, 23960}, {25772, 23911}, {25968, 23961}, {25926, 23962}, {25966, 23963}, {25966, 23964}, {25977, 23965},
+    {25973, 24050}, {25971, 23966}, {25973, 23967}, {25964, 23968}, {25935, 23969}, {25941, 23970}, {25981, 23971}, {25928, 23972},
+    {25980, 24050}, {25971, 24050}, {25932, 23973}, {25931, 23974}, {25933, 23975}, {25935, 23976}, {25921, 23977}, {25875, 23978},
+    {25935, 23979}, {25922, 23980}, {25614, 23803}, {25927, 23981}, {25923, 23982}, {25946, 23983}, {25968, 23984}, {25947, 23985},
+    {25945, 23986}, {25948, 23987}, {25949, 23988}, {25947, 23989}, {25950, 23991}, {25950, 23992}, {25950, 23993}, {25931, 23994},
+    {25958, 23995}, {25943, 23996}, {25950, 23997}, {25938, 23998}, {25942, 23999}, {25933, 24000}, {25936, 24001}, {25906, 24003},
+    {25894, 24011}, {25894, 24010}, {25923, 24004}, {25882, 24005}, {25906, 24006}, {25906, 24007}, {25895, 24008}, {25917, 24009},
+    {25877, 24012}, {25919, 24013}, {25873, 24014}, {25892, 24015}, {25891, 24016}, {26029, 24017}, {25912, 24018}, {25913, 24019},
+    {25911, 24020}, {25914, 24021}, {25890, 24022}, {25864, 24023}, {25900, 24024}, {25862, 24025}, {25861, 24026}, {25906, 24027},
+    {25903, 24032}, {25913, 24040}, {25910, 24028}, {25919, 24029}, {25871, 24030}, {25872, 24033}, {25860, 24041}, {25868, 24031},
+    {25864, 24034}, {25864, 24035}, {25883, 24036}, {25910, 24037}, {25886, 24038}, {25860, 24039}, {25880, 24042}, {25906, 24043},
+    {25882, 24044}, {25904, 24045}, {25884, 24046}, {25856, 24047}, {25898, 24048}, {25858, 24049}, {25896, 24051}, {25868, 24052},
+    {25894, 24053}, {25873, 24054}, {25875, 24055}, {25874, 24056}, {25874, 24057}, {25866, 24058}, {25888, 24059}, {26101, 24060},
+    {26077, 24061}, {26088, 24062}, {26103, 24063}, {26024, 24064}, {26093, 24065}, {26100, 24066}, {26021, 24067}, {26086, 24068},
+    {26110, 24069}, {26068, 24070}, {26104, 24071}, {26066, 24072}, {26081, 24073}, {26107, 24074}, {26063, 24075}, {26085, 24076},
+    {26061, 24077}, {26060, 24078}, {26080, 24079}, {26080, 24080}, {26057, 24081}, {26083, 24082}, {26093, 24083}, {1825, 24084},
+    {26103, 24085}, {26101, 24086}, {26088, 24087}, {26051, 24088}, {26089, 24089}, {26090, 24090}, {1326, 24091}, {26092, 24093},
+    {125, 24094}, {26010, 24095}, {26063, 24096}, {26071, 24098}, {97, 24099}, {26071, 24100}, {26064, 24101}, {26015, 24102},
+    {26051, 24103}, {26104, 24104}, {25895, 24020}, {26076, 24105}, {26003, 24106}, {327, 24107}, {26078, 24108}, {25888, 24004},
+    {26062, 24109}, {26028, 24111}, {26007, 24112}, {26048, 24113}, {26054, 24114}, {26069, 24115}, {2508, 24116}, {26078, 24118},
+    {26054, 24119}, {1638, 24120}, {25993, 24122}, {26065, 24123}, {26076, 24124}, {26077, 24125}, {26073, 24126}, {26063, 24127},
+    {902, 24128}, {26076, 24129}, {26068, 24130}, {26043, 24132}, {25990, 24133}, {26067, 24134}, {26071, 24135}, {26074, 24136},
+    {26106, 24137}, {26020, 24138}, {26037, 24154}, {26021, 24146}, {26019, 24140}, {26170, 24139}, {26016, 24141}, {26025, 24142},
+    {26035, 24143}, {26007, 24144}, {26045, 24145}, {26005, 24147}, {26059, 24148}, {26003, 24149}, {26019, 24150}, {26044, 24151},
+    {26024, 24159}, {26041, 24152}, {26042, 24153}, {26017, 24155}, {26156, 24156}, {26042, 24157}, {26047, 24158}, {26033, 24160},
+    {127, 24161}, {26071, 24162}, {26082, 24163}, {26038, 24164}, {26030, 24165}, {25988, 24166}, {26024, 24167}, {25985, 24168},
+    {26027, 24169}, {26047, 24170}, {25994, 24171}, {25994, 24172}, {25997, 24173}, {25985, 24174}, {25995, 24175}, {25997, 24176},
+    {26004, 24177}, {25991, 24178}, {26067, 24179}, {26090, 24181}, {25998, 24182}, {25986, 24183}, {25986, 24184}, {26010, 24185},
+    {26032, 24186}, {25988, 24187}, {26030, 24188}, {26099, 24189}, {26000, 24190}, {26026, 24191}, {26007, 24192}, {26003, 24193},
+    {25994, 24194}, {26159, 24195}, {25999, 24196}, {26108, 24197}, {26003, 24198}, {26003, 24220}, {25995, 24199}, {26204, 24200},
+    {26223, 24201}, {26221, 24202}, {26216, 24203}, {143, 24204}, {26119, 24205}, {26199, 24206}, {26215, 24207}, {26160, 24208},
+    {2103, 24211}, {26123, 24212}, {26166, 24213}, {26125, 24214}, {26164, 24215}, {26127, 24216}, {26128, 24217}, {1613, 24218},
+    {26129, 24219}, {26152, 24221}, {26230, 24222}, {26234, 24223}, {147, 24225}, {1099, 24226}, {26133, 24227}, {26156, 24228},
+    {26157, 24229}, {26209, 24232}, {26219, 24237}, {26228, 24233}, {26228, 24234}, {26223, 24235}, {26178, 24236}, {26218, 24238},
+    {26234, 24239}, {26190, 24240}, {26186, 24241}, {26193, 24242}, {26188, 24243}, {26021, 24160}, {26148, 24244}, {26192, 24246},
+    {26140, 24247}, {26178, 24248}, {26177, 24249}, {26184, 24250}, {26182, 24251}, {26200, 24252}, {26227, 24253}, {1972, 24254},
+    {26184, 24256}, {26176, 24257}, {977, 24260}, {26196, 24261}, {26204, 24262}, {26200, 24263}, {26183, 24264}, {26202, 24265},
+    {26159, 24258}, {26200, 24266}, {26206, 24267}, {26203, 24320}, {26199, 24434}, {26180, 24268}, {26203, 24269}, {26208, 24271},
+    {26158, 24272}, {26163, 24273}, {26149, 24281}, {26194, 24320}, {26154, 24274}, {901, 24275}, {26139, 24276}, {26155, 24277},
+    {26164, 24278}, {26144, 24286}, {26145, 24279}, {26227, 24280}, {26159, 24282}, {26157, 24288}, {26155, 24318}, {26174, 24283},
+    {26190, 24284}, {26229, 24285}, {26174, 24287}, {26168, 24289}, {26167, 24290}, {26173, 24291}, {26171, 24292}, {26150, 24293},
+    {26121, 24294}, {26147, 24295}, {26200, 24296}, {26211, 24297}, {26164, 24298}, {26162, 24299}, {26169, 24300}, {26163, 24301},
+    {26167, 24302}, {26122, 24435}, {26210, 24303}, {26201, 24304}, {26122, 24305}, {26127, 24306}, {26114, 24307}, {26167, 24308},
+    {26174, 24321}, {26119, 24309}, {26136, 24311}, {26124, 24319}, {26117, 24310}, {26120, 24312}, {26112, 24313}, {26116, 24314},
+    {26121, 24321}, {26114, 24315}, {26141, 24316}, {26118, 24322}, {26130, 24330}, {26130, 24331}, {1344, 24324}, {26115, 24325},
+    {26151, 24326}, {26233, 24327}, {26176, 24328}, {26142, 24329}, {26133, 24332}, {26134, 24333}, {26128, 24334}, {26129, 24335},
+    {26351, 24336}, {26354, 24337}, {26333, 24338}, {26359, 24339}, {26347, 24341}, {26353, 24342}, {2117, 24343}, {26354, 24344},
+    {26328, 24345}, {26339, 24346}, {26337, 24347}, {26340, 24348}, {26338, 24349}, {26343, 24350}, {965, 24352}, {26254, 24353},
+    {26320, 24354}, {26367, 24355}, {26280, 24356}, {26259, 24357}, {26286, 24358}, {26363, 24359}, {26367, 24360}, {26354, 24361},
+    {26349, 24362}, {26309, 24363}, {26352, 24364}, {26356, 24365}, {26355, 24366}, {26196, 24258}, {26363, 24367}, {26353, 24368},
+    {26315, 24369}, {26322, 24370}, {26317, 24371}, {26364, 24372}, {26314, 24373}, {26327, 24374}, {26305, 24382}, {26318, 24375},
+    {26359, 24376}, {26311, 24377}, {26328, 24384}, {26316, 24392}, {26309, 24378}, {26310, 24379}, {26333, 24380}, {26242, 24381},
+    {26331, 24383}, {26306, 24385}, {26271, 24386}, {26249, 24387}, {26321, 24388}, {26332, 24389}, {26333, 24390}, {26329, 24391},
+    {26356, 24351}, {2679, 24393}, {26296, 24394}, {26342, 24395}, {26324, 24396}, {26241, 24397}, {26322, 24398}, {26324, 24399},
+    {26282, 24562}, {26269, 24400}, {26295, 24401}, {26289, 24402}, {2309, 24403}, {26295, 24404}, {26287, 24405}, {26284, 24406},
+    {26335, 24448}, {26292, 24407}, {26274, 24408}, {26274, 24409}, {26274, 24410}, {26274, 24411}, {26274, 24412}, {26301, 24413},
+    {26326, 24448}, {26256, 24414}, {26277, 24415}, {1052, 24416}, {26322, 24417}, {26252, 24418}, {26298, 24419}, {26351, 24420},
+    {26291, 24421}, {26297, 24422}, {26290, 24423}, {26281, 24424}, {26292, 24425}, {26295, 24426}, {26285, 24427}, {26413, 24428},
+    {728, 24430}, {26283, 24431}, {26303, 24432}, {26337, 24433}, {26247, 24436}, {26253, 24437}, {26255, 24438}, {26262, 24439},
+    {26249, 24440}, {26343, 24441}, {26322, 24442}, {26242, 24443}, {26265, 24444}, {26412, 24445}, {26245, 24446}, {26245, 24447},
+    {26244, 24563}, {1299, 24450}, {26352, 24451}, {26286, 24452}, {26268, 24453}, {26313, 24454}, {26247, 24455}, {26282, 24456},
+    {26252, 24449}, {26267, 24457}, {26268, 24458}, {26256, 24459}, {26256, 24460}, {26259, 24461}, {26256, 24462}, {26311, 24464},
+    {26247, 24449}, {26267, 24465}, {26262, 24466}, {26472, 24467}, {26474, 24468}, {26458, 24469}, {26472, 24470}, {26485, 24471},
+    {26479, 24479}, {26464, 24472}, {26495, 24473}, {26451, 24474}, {26470, 24475}, {26470, 24476}, {26465, 24477}, {26410, 24478},
+    {26484, 24480}, {26491, 24481}, {26488, 24482}, {26490, 24483}, {26491, 24484}, {26489, 24485}, {26468, 24486}, {26439, 24487},
+    {26477, 24488}, {26484, 24489}, {26484, 24490}, {26299, 24407}, {26479, 24491}, {26434, 24492}, {26474, 24493}, {26399, 24494},
+    {26394, 24495}, {26447, 24496}, {26443, 24497}, {26438, 24498}, {26398, 24499}, {26432, 24500}, {26447, 24501}, {26444, 24502},
+    {26438, 24503}, {26387, 24504}, {26366, 24351}, {26447, 24505}, {26434, 24506}, {26439, 24507}, {26435, 24508}, {26443, 24509},
+    {26433, 24510}, {26459, 24511}, {26434, 24512}, {26461, 24513}, {26377, 24514}, {26449, 24515}, {26460, 24516}, {26461, 24517},
+    {26470, 24463}, {26457, 24518}, {26471, 24519}, {26455, 24520}, {26440, 24528}, {26460, 24536}, {26453, 24521}, {26466, 24522},
+    {26448, 24523}, {26445, 24529}, {26407, 24537}, {26408, 24524}, {26488, 24525}, {26406, 24526}, {26413, 24527}, {26414, 24530},
+    {26408, 24531}, {26493, 24532}, {26413, 24533}, {26400, 24534}, {26401, 24535}, {26405, 24538}, {26405, 24539}, {26406, 24540},
+    {26420, 24541}, {26428, 24542}, {26382, 24543}, {26431, 24544}, {26428, 24546}, {26400, 24547}, {121, 24548}, {26427, 24549},
+    {26425, 24550}, {652, 24552}, {26455, 24553}, {26374, 24554}, {26420, 24555}, {26465, 24556}, {26418, 24557}, {26418, 24558},
+    {26413, 24559}, {26368, 24560}, {26388, 24561}, {26459, 24565}, {26375, 24566}, {26378, 24567}, {26383, 24568}, {26379, 24569},
+    {26460, 24570}, {26370, 24571}, {26375, 24572}, {26374, 24574}, {26398, 24575}, {1473, 24576}, {785, 24577}, {26475, 24578},
+    {26419, 24579}, {26371, 24580}, {26452, 24581}, {26453, 24582}, {26389, 24583}, {26392, 24584}, {26399, 24585}, {26395, 24586},
+    {26392, 24587}, {26392, 24588}, {26379, 24589}, {26406, 24590}, {26382, 24591}, {26491, 24592}, {26438, 24593}, {26387, 24594},
+    {26391, 24595}, {26394, 24596}, {26598, 24597}, {26605, 24598}, {26604, 24599}, {26602, 24600}, {26605, 24683}, {26601, 24602},
+    {26597, 24601}, {26599, 24603}, {26618, 24604}, {26581, 24605}, {26623, 24606}, {26623, 24607}, {26578, 24608}, {26595, 24609},
+    {26604, 24601}, {26593, 24610}, {26623, 24611}, {26594, 24612}, {26573, 24613}, {26599, 24614}, {26623, 24615}, {26598, 24616},
+    {26555, 24617}, {26595, 24618}, {26567, 24619}, {26610, 24620}, {26610, 24621}, {26613, 24622}, {26613, 24623}, {26614, 24624},
+    {26603, 24626}, {26622, 24627}, {26429, 24541}, {26569, 24628}, {26571, 24629}, {26570, 24630}, {26574, 24631}, {26581, 24632},
+    {26506, 24633}, {26562, 24634}, {26255, 24463}, {26585, 24635}, {26502, 24636}, {26567, 24637}, {26565, 24638}, {26567, 24639},
+    {26564, 24640}, {26584, 24641}, {26584, 24642}, {26589, 24643}, {26567, 24644}, {26603, 24645}, {26561, 24646}, {26601, 24647},
+    {26564, 24625}, {26585, 24648}, {26583, 24649}, {26570, 24650}, {26597, 24651}, {26575, 24652}, {375, 24704}, {26589, 24805},
+    {26592, 24653}, {26548, 24654}, {26548, 24655}, {26550, 24656}, {26524, 24657}, {26543, 24658}, {26587, 24805}, {26580, 24805},
+    {26541, 24659}, {26536, 24660}, {26540, 24661}, {26528, 24662}, {26528, 24663}, {26529, 24664}, {26531, 24665}, {26533, 24666},
+    {26559, 24672}, {26537, 24680}, {26539, 24681}, {26576, 24668}, {26558, 24669}, {26535, 24670}, {26507, 24671}, {26530, 24673},
+    {26504, 24674}, {26547, 24675}, {26543, 24676}, {26669, 24677}, {26548, 24678}, {26549, 24679}, {26500, 24682}, {26510, 24684},
+    {26518, 24685}, {26556, 24686}, {26513, 24687}, {26553, 24688}, {26552, 24689}, {26503, 24690}, {26520, 24691}, {26508, 24699},
+    {26501, 24692}, {26498, 24693}, {26522, 24694}, {26544, 24695}, {26500, 24696}, {26542, 24697}, {26502, 24698}, {26540, 24700},
+    {26527, 24701}, {26525, 24702}, {26520, 24703}, {26526, 24705}, {26515, 24706}, {26725, 24707}, {26513, 24708}, {26504, 24709},
+    {26671, 24710}, {26515, 24711}, {26505, 24712}, {26529, 24713}, {26507, 24714}, {26716, 24715}, {26715, 24716}, {26737, 24717},
+    {26739, 24718}, {26728, 24719}, {26748, 24720}, {26709, 24721}, {26751, 24722}, {26707, 24723}, {26722, 24724}, {26506, 24707},
+    {26746, 24725}, {26704, 24726}, {26724, 24727}, {26702, 24728}, {26540, 24682}, {26748, 24729}, {26748, 24730}, {913, 24733},
+    {26720, 24734}, {26698, 24735}, {26646, 24736}, {26748, 24737}, {26731, 24738}, {26676, 24739}, {26656, 24740}, {26750, 24741},
+    {26741, 24742}, {26742, 24743}, {26736, 24744}, {26661, 24745}, {26693, 24746}, {26696, 24747}, {26697, 24748}, {26701, 24749},
+    {26698, 24750}, {26698, 24751}, {26709, 24752}, {26744, 24753}, {26716, 24754}, {26665, 24755}, {26694, 24757}, {1217, 24758},
+    {26693, 24759}, {26693, 24760}, {26605, 24625}, {26700, 24761}, {26692, 24779}, {1083, 24762}, {2427, 24763}, {26713, 24764},
+    {26719, 24765}, {26717, 24766}, {26717, 24768}, {26695, 24761}, {26717, 24769}, {26716, 24946}, {26550, 24668}, {26700, 24770},
+    {26708, 24832}, {26627, 24771}, {26719, 24772}, {26718, 24774}, {26713, 24775}, {26631, 24776}, {26715, 24777}, {26710, 24778},
+    {26719, 24832}, {26667, 24780}, {26671, 24781}, {26744, 24782}, {26745, 24783}, {26657, 24784}, {26668, 24785}, {26669, 24786},
+    {26665, 24787}, {1961, 24788}, {26696, 24789}, {26646, 24790}, {26660, 24791}, {26737, 24792}, {2763, 24794}, {26659, 24796},
+    {26681, 24797}, {177, 24798}, {26667, 24799}, {26657, 24800}, {26683, 24801}, {26658, 24802}, {26685, 24803}, {26685, 24804},
+    {26683, 24806}, {26662, 24807}, {26633, 24808}, {26659, 24809}, {26722, 24810}, {26684, 24811}, {26675, 24812}, {26672, 24813},
+    {26674, 24814}, {26717, 24815}, {340, 24816}, {26683, 24817}, {26673, 24818}, {26635, 24819}, {26642, 24820}, {26637, 24821},
+    {26647, 24822}, {26683, 24823}, {26638, 24824}, {26638, 24825}, {26633, 24826}, {26637, 24827}, {26631, 24828}, {26625, 24829},
+    {26655, 24830}, {26626, 24831}, {26629, 24833}, {26652, 24834}, {26797, 24835}, {26644, 24836}, {26653, 24837}, {26655, 24838},
+    {26630, 24839}, {26649, 24840}, {26654, 24841}, {26643, 24842}, {26645, 24844}, {26639, 24845}, {26659, 24846}, {26633, 24847},
+    {26657, 24848}, {26755, 24850}, {26814, 24851}, {26859, 24852}, {26863, 24853}, {26850, 24854}, {26854, 24855}, {26851, 24856},
+    {26878, 24857}, {26833, 24858}, {26875, 24859}, {26852, 24860}, {26830, 24861}, {26873, 24862}, {26875, 24863}, {26874, 24864},
+    {2460, 24865}, {26773, 24866}, {26825, 24867}, {26873, 24868}, {26786, 24869}, {26871, 24870}, {26867, 24871}, {26870, 24922},
+    {26874, 24872}, {26861, 24873}, {26816, 24874}, {26829, 24875}, {26779, 24876}, {26823, 24877}, {26826, 24878}, {26831, 24879},
+    {26869, 24872}, {26827, 24880}, {26819, 24881}, {26825, 24882}, {26819, 24883}, {26842, 24884}, {26821, 24885}, {26821, 24886},
+    {26821, 24887}, {26828, 24888}, {26820, 24906}, {26847, 24889}, {26821, 24890}, {26861, 24891}, {26823, 24892}, {26859, 24893},
+    {26844, 24894}, {26823, 24888}, {26845, 24895}, {26832, 24897}, {26833, 24898}, {26851, 24900}, {26825, 24901}, {26827, 24902},
+    {26853, 24843}, {26751, 24849}, {26835, 24896}, {26788, 24899}, {26782, 24903}, {26806, 24904}, {26806, 24905}, {26794, 24907},
+    {26794, 24908}, {26805, 24909}, {26776, 24910}, {26813, 24911}, {26864, 24912}, {26798, 24913}, {26789, 24914}, {26790, 24915},
+    {26784, 24916}, {26788, 24917}, {26787, 24918}, {26925, 24919}, {26787, 24928}, {26805, 24936}, {26807, 24937}, {26862, 24921},
+    {26804, 24923}, {26789, 24924}, {26760, 24925}, {26805, 24926}, {26851, 24927}, {26815, 24929}, {26802, 24930}, {26807, 24931},
+    {26803, 24932}, {26801, 24933}, {26795, 24934}, {26815, 24935}, {26773, 24938}, {26813, 24939}, {26812, 24940}, {26768, 24941},
+    {26768, 24942}, {26854, 24943}, {26845, 24944}, {26758, 24945}, {26752, 24947}, {26767, 24948}, {26756, 24949}, {26776, 24950},
+    {26802, 24951}, {26778, 24952}, {26800, 24953}, {26773, 24954}, {26783, 24955}, {26796, 24956}, {26752, 24957}, {26752, 24958},
+    {26781, 24959}, {26756, 24960}, {26924, 24961}, {26818, 24962}, {26780, 24963}, {26771, 24964}, {26768, 24965}, {26770, 24966},
+    {26774, 24967}, {26774, 24968}, {26774, 24969}, {1047, 24970}, {26979, 25071}, {26998, 24971}, {26969, 24972}, {26986, 24973},
+    {26982, 24974}, {26982, 24975}, {27001, 24976}, {26964, 24977}, {26986, 25071}, {26977, 25071}, {27000, 24978}, {26980, 24979},
+    {26981, 24980}, {27007, 24982}, {27003, 24983}, {26994, 24984}, {27006, 25066}, {27000, 24985}, {27000, 24986}, {26986, 24987},
+    {26949, 24988}, {26991, 24989}, {26984, 24990}, {27005, 24984}, {26946, 24991}, {26997, 24992}, {26999, 24993}, {26958, 24994},
+    {26965, 24995}, {27005, 24996}, {26952, 24997}, {26956, 24998}, {26854, 24849}, {26955, 24999}, {26947, 25000}, {26953, 25001},
+    {26947, 25002}, {26970, 25003}, {26949, 25004}, {26949, 25005}, {26947, 25006}, {26974, 25007}, {26993, 25008}, {26971, 25009},
+    {26827, 24896}, {26824, 24899}, {26634, 24843}, {26974, 25010}, {26974, 25011}, {26945, 25012}, {26988, 25013}, {26944, 25014},
+    {26970, 25015}, {26946, 25016}, {26984, 25017}, {26956, 25018}, {26982, 25019}, {26964, 25020}, {26964, 25021}, {26959, 25022},
+    {26996, 24981}, {26978, 25023}, {26954, 25024}, {26966, 25025}, {26923, 25026}, {26917, 25027}, {26922, 25028}, {26927, 25029},
+    {26913, 25030}, {26921, 25031}, {26919, 25032}, {26937, 25033}, {26900, 25034}, {26936, 25035}, {26912, 25036}, {26912, 25037},
+    {26915, 25038}, {26894, 25039}, {26918, 25040}, {26912, 25041}, {26891, 25042}, {26936, 25043}, {26917, 25044}, {26888, 25045},
+    {26933, 25046}, {26940, 25048}, {26932, 25049}, {26928, 25050}, {26927, 25051}, {26930, 25052}, {26929, 25053}, {26981, 25055},
+    {26976, 25057}, {26971, 25058}, {26902, 25059}, {26903, 25061}, {26896, 25062}, {26981, 25063}, {26937, 25064}, {26885, 25065},
+    {26887, 25067}, {26985, 25068}, {26910, 25070}, {26905, 25072}, {1189, 25073}, {26988, 25074}, {26930, 25075}, {26880, 25076},
+    {26965, 25077}, {26910, 25079}, {26910, 25080}, {26996, 25082}, {26959, 25083}, {26904, 25084}, {26910, 25085}, {26909, 25086},
+    {26896, 25087}, {26944, 25089}, {26910, 25090}, {1506, 25091}, {27004, 25092}, {26914, 25093}, {26896, 25094}, {26949, 25095},
+    {27008, 25096}, {27067, 25097}, {27116, 25098}, {27127, 25099}, {27116, 25100}, {27134, 25102}, {27110, 25103}, {27110, 25104},
+    {27129, 25105}, {27092, 25106}, {27128, 25107}, {2091, 25108}, {27129, 25109}, {27087, 25110}, {27130, 25111}, {27130, 25112},
+    {27133, 25113}, {27133, 25114}, {27134, 25115}, {27126, 25117}, {27120, 25118}, {27131, 25119}, {27127, 25197}, {2494, 25121},
+    {27037, 25122}, {27121, 25123}, {27087, 25124}, {27090, 25125}, {27133, 25126}, {27122, 25119}, {27095, 25127}, {27083, 25128},
+    {27089, 25129}, {27129, 25130}, {27091, 25131}, {27127, 25132}, {27027, 25133}, {27087, 25134}, {27074, 25135}, {27079, 25136},
+    {27075, 25137}, {27054, 25138}, {1048, 25139}, {27029, 25140}, {27093, 25141}, {27103, 25142}, {27101, 25143}, {27072, 25144},
+    {27115, 25145}, {27073, 25146}, {27004, 24981}, {37, 25147}, {27113, 25148}, {27089, 25149}, {27089, 25150}, {26929, 25027},
+    {27088, 25151}, {27089, 25152}, {26933, 25030}, {27080, 25154}, {2277, 25155}, {27015, 25156}, {27103, 25157}, {27088, 25158},
+    {27013, 25101}, {27122, 25116}, {27044, 25153}, {27061, 25159}, {27037, 25160}, {27063, 25161}, {27035, 25162}, {862, 25164},
+    {27057, 25165}, {27033, 25166}, {27079, 25167}, {410, 25169}, {27081, 25170}, {999, 25171}, {27082, 25172}, {991, 25173},
+    {1352, 25174}, {1950, 25176}, {27083, 25177}, {27126, 25178}, {27048, 25179}, {1895, 25182}, {27086, 25183}, {27087, 25184},
+    {27114, 25185}, {27069, 25186}, {27063, 25187}, {27069, 25188}, {27071, 25189}, {27046, 25190}, {27065, 25191}, {27117, 25192},
+    {27069, 25193}, {27056, 25194}, {27057, 25195}, {27061, 25196}, {2113, 25198}, {27048, 25199}, {27101, 25200}, {27108, 25201},
+    {27070, 25202}, {27098, 25203}, {27016, 25204}, {27096, 25205}, {27014, 25206}, {27102, 25208}, {27008, 25209}, {708, 25216},
+    {27015, 25317}, {27091, 25211}, {27023, 25212}, {27010, 25213}, {27015, 25214}, {27011, 25215}, {27057, 25217}, {27009, 25218},
+    {27022, 25317}, {27021, 25317}, {27010, 25219}, {27030, 25227}, {27035, 25220}, {27030, 25221}, {27021, 25222}, {27009, 25223},
+    {27049, 25224}, {27036, 25225}, {27024, 25226}, {27031, 25228}, {27022, 25230}, {27044, 25231}, {27031, 25232}, {27029, 25233},
+    {27024, 25234}, {27135, 25235}, {27194, 25236}, {27253, 25237}, {27242, 25238}, {27193, 25239}, {2777, 25240}, {27140, 25241},
+    {27226, 25242}, {27240, 25243}, {27197, 25244}, {27245, 25245}, {27239, 25246}, {27233, 25247}, {27256, 25248}, {27235, 25249},
+    {1682, 25250}, {27149, 25251}, {27217, 25252}, {27233, 25253}, {27178, 25254}, {27214, 25255}, {27260, 25256}, {27233, 25264},
+    {27251, 25272}, {27260, 25257}, {1051, 25258}, {27158, 25259}, {27208, 25260}, {27106, 25101}, {27254, 25261}, {27171, 25262},
+    {27246, 25263}, {27204, 25265}, {27255, 25266}, {27253, 25267}, {27248, 25268}, {27173, 25269}, {27205, 25270}, {27208, 25271},
+    {27080, 25153}, {27209, 25273}, {27213, 25274}, {27108, 25116}, {27215, 25275}, {27213, 25276}, {27215, 25277}, {27208, 25279},
+    {27228, 25280}, {2288, 25281}, {27177, 25282}, {27152, 25283}, {27205, 25284}, {27205, 25285}, {27208, 25286}, {27211, 25287},
+    {27201, 25288}, {27227, 25289}, {27202, 25290}, {27229, 25291}, {27229, 25292}, {27227, 25293}, {27226, 25295}, {27202, 25296},
+    {27240, 25297}, {27212, 25298}, {27238, 25299}, {27220, 25300}, {27218, 25301}, {27221, 25458}, {2162, 25303}, {27211, 25304},
+    {27229, 25344}, {27167, 25305}, {27201, 25306}, {21, 25307}, {27202, 25308}, {27164, 25309}, {27178, 25310}, {27263, 25311},
+    {27220, 25344}, {27177, 25312}, {27187, 25313}, {27159, 25314}, {27197, 25315}, {27157, 25316}, {27249, 25318}, {27177, 25319},
+    {27172, 25320}, {27173, 25321}, {27169, 25322}, {27172, 25323}, {27150, 25324}, {27193, 25325}, {27195, 25326}, {27194, 25327},
+    {27169, 25328}, {27145, 25329}, {27196, 25330}, {27184, 25331}, {27191, 25332}, {27187, 25333}, {27184, 25334}, {27140, 25335},
+    {27188, 25336}, {27189, 25337}, {27141, 25338}, {27234, 25339}, {27225, 25340}, {27146, 25341}, {27148, 25342}, {27139, 25343},
+    {1360, 25346}, {27155, 25347}, {27189, 25348}, {27243, 25349}, {27187, 25350}, {27139, 25351}, {27164, 25360}, {27144, 25368},
+    {27180, 25338}, {27161, 25352}, {27138, 25353}, {27181, 25354}, {27166, 25355}, {27214, 25357}, {27163, 25358}, {27167, 25359},
+    {27154, 25443}, {27173, 25362}, {27151, 25363}, {27145, 25364}, {27160, 25365}, {27152, 25366}, {27156, 25367}, {27379, 25369},
+    {27158, 25361}, {27374, 25370}, {84, 25372}, {27382, 25373}, {27356, 25374}, {27268, 25375}, {27327, 25376}, {27363, 25377},
+    {27153, 25361}, {27374, 25378}, {27363, 25379}, {27367, 25380}, {27363, 25381}, {27183, 25335}, {27360, 25382}, {27362, 25385},
+    {27386, 25386}, {2810, 25387}, {27317, 25388}, {27380, 25389}, {27387, 25390}, {27384, 25391}, {27386, 25392}, {1560, 25393},
+    {27285, 25394}, {27391, 25395}, {27388, 25396}, {27333, 25398}, {27381, 25399}, {27374, 25408}, {27386, 25416}, {27383, 25400},
+    {2681, 25402}, {27371, 25403}, {27390, 25404}, {27298, 25405}, {27336, 25406}, {27351, 25407}, {27272, 25409}, {27385, 25410},
+    {27347, 25411}, {27356, 25412}, {27332, 25413}, {27330, 25414}, {27333, 25586}, {27311, 25415}, {27274, 25417}, {27359, 25418},
+    {27380, 25383}, {27332, 25397}, {27341, 25472}, {27355, 25419}, {27350, 25420}, {27328, 25421}, {27370, 25422}, {27357, 25423},
+    {27359, 25424}, {27350, 25425}, {27332, 25472}, {27350, 25426}, {27342, 25427}, {27364, 25428}, {27336, 25429}, {27362, 25430},
+    {27326, 25431}, {27269, 25432}, {27310, 25433}, {27304, 25434}, {27303, 25435}, {27302, 25436}, {27306, 25437}, {27310, 25438},
+    {27317, 25439}, {27304, 25440}, {27309, 25441}, {27303, 25442}, {27297, 25444}, {27320, 25445}, {27299, 25446}, {2666, 25447},
+    {27341, 25448}, {27281, 25449}, {27297, 25450}, {27370, 25451}, {27345, 25452}, {27368, 25453}, {27325, 25454}, {27325, 25455},
+    {27312, 25456}, {27350, 25457}, {27362, 25459}, {27319, 25460}, {27315, 25461}, {27326, 25462}, {27366, 25463}, {27320, 25464},
+    {27319, 25465}, {27316, 25466}, {27278, 25467}, {27361, 25468}, {27352, 25469}, {27277, 25470}, {27277, 25471}, {27264, 25473},
+    {27282, 25474}, {27320, 25475}, {27267, 25476}, {27265, 25477}, {27268, 25478}, {27295, 25479}, {27315, 25480}, {27270, 25481},
+    {27270, 25482}, {27265, 25483}, {27376, 25484}, {27339, 25485}, {27292, 25486}, {27290, 25487}, {27281, 25488}, {27381, 25489},
+    {27340, 25490}, {27289, 25491}, {27281, 25492}, {27292, 25493}, {27284, 25494}, {27282, 25495}, {27285, 25578}, {27284, 25497},
+    {27293, 25496}, {27507, 25498}, {27436, 25499}, {27500, 25500}, {27500, 25501}, {27489, 25503}, {27499, 25504}, {304, 25506},
+    {27284, 25496}, {27506, 25507}, {27480, 25508}, {27400, 25509}, {27500, 25510}, {27492, 25511}, {27488, 25512}, {27519, 25513},
+    {27490, 25514}, {27406, 25515}, {27445, 25516}, {27518, 25517}, {27512, 25518}, {27511, 25519}, {27411, 25520}, {27438, 25521},
+    {27491, 25522}, {27512, 25523}, {27512, 25524}, {548, 25527}, {27500, 25528}, {27462, 25529}, {27418, 25530}, {27419, 25531},
+    {27430, 25532}, {27507, 25533}, {27391, 25383}, {27370, 25397}, {27511, 25534}, {27514, 25535}, {27461, 25536}, {27471, 25537},
+    {27465, 25538}, {27472, 25539}, {27467, 25540}, {1722, 25541}, {27429, 25542}, {27513, 25543}, {27465, 25544}, {27410, 25545},
+    {27461, 25546}, {27467, 25547}, {27508, 25548}, {27458, 25549}, {27487, 25552}, {27465, 25560}, {27462, 25550}, {27477, 25551},
+    {27487, 25553}, {27481, 25554}, {27456, 25555}, {27483, 25556}, {27486, 25557}, {27461, 25558}, {27418, 25559}, {27485, 25561},
+    {27479, 25562}, {27473, 25563}, {27464, 25564}, {27475, 25565}, {27476, 25566}, {27477, 25567}, {27428, 25568}, {27438, 25569},
+    {27446, 25570}, {27420, 25571}, {27440, 25572}, {27417, 25573}, {27433, 25574}, {27424, 25575}, {27431, 25714}, {27426, 25576},
+    {27435, 25600}, {27450, 25577}, {27408, 25579}, {27428, 25580}, {27406, 25581}, {27451, 25582}, {27448, 25583}, {27440, 25584},
+    {27426, 25600}, {27455, 25585}, {27452, 25587}, {27396, 25588}, {27398, 25589}, {27438, 25590}, {27438, 25591}, {27394, 25592},
+    {27434, 25593}, {27434, 25594}, {27407, 25595}, {27405, 25596}, {27408, 25597}, {27451, 25598}, {27409, 25599}, {27395, 25601},
+    {27401, 25602}, {27394, 25603}, {27417, 25604}, {27396, 25605}, {27422, 25607}, {27402, 25615}, {27402, 25614}, {27420, 25608},
+    {27439, 25609}, {27420, 25610}, {27421, 25611}, {27392, 25612}, {27434, 25613}, {27394, 25616}, {27432, 25617}, {27431, 25618},
+    {27405, 25619}, {27407, 25620}, {27428, 25621}, {27400, 25622}, {27400, 25623}, {27413, 25624}, {27415, 25625}, {27625, 25626},
+    {1592, 25627}, {27626, 25628}, {27616, 25726}, {27626, 25629}, {27637, 25630}, {27430, 25584}, {27608, 25631}, {27644, 25632},
+    {27616, 25633}, {27435, 25588}, {27627, 25726}, {27622, 25726}, {27617, 25634}, {27618, 25636}, {27620, 25637}, {27642, 25684},
+    {27631, 25638}, {27644, 25639}, {27644, 25640}, {27623, 25641}, {27468, 25568}, {27594, 25642}, {27618, 25643}, {27619, 25644},
+    {27622, 25638}, {27590, 25645}, {27633, 25646}, {27635, 25647}, {27634, 25648}, {27635, 25649}, {27633, 25650}, {27628, 25651},
+    {27647, 25652}, {27605, 25653}, {27597, 25654}, {27607, 25655}, {27643, 25656}, {27601, 25657}, {27641, 25658}, {27593, 25659},
+    {27585, 25660}, {27584, 25679}, {27589, 25662}, {27590, 25663}, {27585, 25665}, {27614, 25666}, {27585, 25667}, {27628, 25668},
+    {27636, 25635}, {27592, 25661}, {27604, 25664}, {27584, 25669}, {27590, 25670}, {27625, 25671}, {27610, 25672}, {27607, 25673},
+    {27605, 25674}, {27587, 25661}, {27592, 25675}, {27619, 25676}, {27593, 25677}, {27600, 25678}, {27600, 25680}, {27571, 25681},
+    {27550, 25682}, {27574, 25683}, {27558, 25685}, {27562, 25686}, {27562, 25688}, {27570, 25689}, {2578, 25690}, {27566, 25691},
+    {27555, 25692}, {27572, 25693}, {27594, 25694}, {27633, 25695}, {27554, 25696}, {27556, 25697}, {27563, 25698}, {27599, 25699},
+    {27627, 25700}, {27580, 25701}, {27578, 25702}, {27569, 25703}, {27568, 25704}, {27576, 25705}, {27580, 25706}, {27562, 25707},
+    {27573, 25708}, {2363, 25709}, {27582, 25710}, {27523, 25712}, {27571, 25713}, {27564, 25715}, {27576, 25723}, {27529, 25716},
+    {27535, 25719}, {27527, 25720}, {27533, 25721}, {27579, 25722}, {27531, 25724}, {27540, 25728}, {27520, 25736}, {27521, 25725},
+    {27588, 25727}, {27626, 25729}, {27544, 25730}, {27541, 25731}, {27550, 25732}, {27630, 25733}, {27605, 25734}, {27550, 25735},
+    {27544, 25737}, {27543, 25738}, {27635, 25739}, {27636, 25740}, {27599, 25741}, {27544, 25742}, {27550, 25743}, {27549, 25744},
+    {1032, 25746}, {27533, 25747}, {27557, 25748}, {27643, 25749}, {27538, 25751}, {27538, 25752}, {27588, 25754}, {27546, 25755},
+    {27753, 25756}, {27754, 25757}, {27756, 25758}, {27750, 25759}, {27754, 25760}, {27758, 25761}, {27765, 25762}, {27752, 25763},
+    {27656, 25764}, {27699, 25765}, {27748, 25766}, {27746, 25767}, {27753, 25768}, {1024, 25769}, {27703, 25771}, {27755, 25772},
+    {27750, 25773}, {27771, 25774}, {27775, 25775}, {27773, 25776}, {27751, 25777}, {27723, 25778}, {27745, 25779}, {27721, 25780},
+    {27693, 25781}, {27773, 25782}, {27760, 25783}, {27578, 25693}, {27761, 25784}, {27765, 25785}, {27765, 25786}, {27766, 25787},
+    {27613, 25664}, {27685, 25789}, {27640, 25635}, {27716, 25790}, {27723, 25791}, {27720, 25792}, {27722, 25793}, {27723, 25794},
+    {27727, 25795}, {27713, 25970}, {27717, 25796}, {27715, 25797}, {27742, 25798}, {27761, 25799}, {27739, 25800}, {2112, 25857},
+    {27716, 25788}, {27718, 25856}, {27729, 25956}, {612, 25801}, {27699, 25802}, {27755, 25803}, {27739, 25804}, {27660, 25805},
+    {27730, 25806}, {27712, 25856}, {27736, 25956}, {27735, 25956}, {27734, 25807}, {27730, 25808}, {27721, 25809}, {27732, 25810},
+    {27731, 25811}, {27721, 25812}, {27745, 25813}, {27723, 25814}, {27679, 25815}, {74, 25817}, {27701, 25818}, {27677, 25819},
+    {27715, 25820}, {27675, 25821}, {27691, 25822}, {27700, 25824}, {27680, 25832}, {27681, 25823}, {27682, 25825}, {27705, 25826},
+    {27821, 25827}, {27723, 25828}, {27766, 25829}, {27683, 25830}, {27687, 25831}, {27690, 25833}, {27754, 25834}, {27700, 25835},
+    {27707, 25836}, {27704, 25837}, {27706, 25838}, {27658, 25839}, {27704, 25840}, {27685, 25841}, {27711, 25849}, {27696, 25842},
+    {27700, 25843}, {27700, 25844}, {27695, 25845}, {27650, 25846}, {27690, 25847}, {27697, 25848}, {27657, 25850}, {27648, 25858},
+    {27656, 25968}, {27658, 25851}, {27660, 25852}, {27651, 25969}, {27674, 25853}, {27701, 25854}, {27654, 25855}, {27659, 25858},
+    {27655, 25859}, {27679, 25860}, {27698, 25861}, {27651, 25862}, {27658, 25863}, {27678, 25864}, {27674, 25865}, {27649, 25866},
+    {27662, 25859}, {27676, 25867}, {27764, 25868}, {27727, 25869}, {27672, 25870}, {27678, 25871}, {27677, 25872}, {27664, 25873},
+    {27665, 25874}, {27671, 25876}, {27669, 25877}, {27671, 25878}, {27775, 25879}, {27883, 25880}, {27880, 25881}, {27895, 25882},
+    {27816, 25883}, {27782, 25884}, {27837, 25885}, {27878, 25886}, {27875, 25887}, {27886, 25888}, {27874, 25889}, {27874, 25890},
+    {27901, 25891}, {27856, 25892}, {27876, 25893}, {27874, 25894}, {27853, 25895}, {27902, 25896}, {369, 25897}, {27796, 25898},
+    {27850, 25899}, {27896, 25900}, {27821, 25901}, {27894, 25902}, {27894, 25903}, {27881, 25904}, {27844, 25905}, {27880, 25906},
+    {27815, 25907}, {27899, 25908}, {27757, 25788}, {27884, 25909}, {27903, 25910}, {27852, 25911}, {27851, 25912}, {27848, 25913},
+    {27814, 25915}, {27805, 25916}, {27846, 25917}, {27840, 25918}, {27855, 25919}, {27892, 25920}, {27865, 25921}, {27867, 25922},
+    {27877, 25875}, {27840, 25914}, {27869, 25924}, {27863, 25932}, {27861, 25933}, {27865, 25925}, {27840, 25926}, {27801, 25927},
+    {27856, 25928}, {27864, 25929}, {27868, 25930}, {27851, 25931}, {27862, 25934}, {27860, 25935}, {27858, 25936}, {27861, 26098},
+    {27869, 25984}, {27872, 25937}, {27822, 25938}, {27827, 25939}, {27813, 25947}, {27818, 25940}, {27809, 25941}, {27819, 25942},
+    {27860, 25984}, {27820, 25943}, {27835, 25944}, {27814, 25945}, {27813, 25946}, {27839, 25948}, {27795, 25949}, {27833, 25950},
+    {27793, 25951}, {27808, 25952}, {27812, 25953}, {27790, 25954}, {27814, 25955}, {27788, 25957}, {27886, 25958}, {27824, 25959},
+    {27839, 25960}, {27836, 25961}, {27830, 25962}, {27836, 25963}, {27828, 25964}, {27824, 25965}, {27823, 25966}, {27826, 25967},
+    {27835, 25971}, {27825, 25972}, {27787, 25973}, {27794, 25974}, {27789, 25975}, {27789, 25976}, {27787, 25977}, {27798, 25978},
+    {27833, 25979}, {27795, 25980}, {27789, 25981}, {27783, 25982}, {27777, 25983}, {27800, 25985}, {27779, 25986}, {27779, 25987},
+    {27783, 25988}, {27790, 25989}, {27802, 26103}, {27805, 25990}, {27805, 25991}, {27796, 25992}, {27795, 26106}, {27804, 25993},
+    {27796, 25994}, {27801, 25989}, {27792, 25995}, {27791, 25996}, {27794, 25997}, {27807, 25992}, {27803, 25998}, {27793, 25999},
+    {28011, 26000}, {28018, 26001}, {28013, 26002}, {28008, 26003}, {28023, 26004}, {27944, 26005}, {28013, 26006}, {28020, 26007},
+    {27941, 26008}, {27955, 26009}, {28015, 26010}, {28002, 26011}, {28007, 26012}, {28003, 26013}, {28028, 26014}, {27919, 26015},
+    {1056, 26016}, {27920, 26017}, {28005, 26018}, {28029, 26019}, {28028, 26020}, {372, 26021}, {28022, 26022}, {28000, 26023},
+    {28024, 26024}, {1133, 26025}, {28024, 26026}, {27938, 26027}, {2099, 26029}, {28013, 26030}, {27973, 26031}, {27931, 26032},
+    {28025, 26033}, {28019, 26034}, {27656, 25875}, {27862, 25914}, {891, 26035}, {27934, 26036}, {27968, 26037}, {27982, 26038},
+    {27931, 26039}, {27969, 26040}, {27939, 26041}, {27934, 26042}, {42, 26044}, {27985, 26045}, {28025, 26046}, {27943, 26047},
+    {1575, 26048}, {27944, 26049}, {27923, 26050}, {27920, 26051}, {27999, 26052}, {254, 26112}, {27981, 26213}, {27978, 26053},
+    {27989, 26054}, {27999, 26055}, {27993, 26056}, {27968, 26057}, {27995, 26058}, {27994, 26060}, {27972, 26213}, {27979, 26213},
+    {27970, 26061}, {28008, 26062}, {27980, 26063}, {28006, 26064}, {27988, 26065}, {27986, 26066}, {27997, 26113}, {27989, 26227},
+    {28000, 26067}, {27950, 26068}, {27955, 26069}, {27941, 26077}, {27946, 26070}, {1464, 26072}, {27988, 26113}, {27937, 26073},
+    {27947, 26074}, {27949, 26075}, {27956, 26076}, {27943, 26078}, {27943, 26079}, {27941, 26080}, {27960, 26081}, {27922, 26082},
+    {27962, 26083}, {27984, 26084}, {28011, 26085}, {27964, 26086}, {27962, 26087}, {27953, 26088}, {2259, 26089}, {27989, 26091},
+    {28012, 26092}, {27954, 26093}, {27958, 26094}, {27954, 26095}, {27945, 26096}, {27956, 26097}, {27962, 26100}, {27953, 26101},
+    {27952, 26102}, {27953, 26104}, {27913, 26105}, {27912, 26224}, {27915, 26107}, {28005, 26109}, {27912, 26110}, {27913, 26111},
+    {27904, 26114}, {27911, 26115}, {27930, 26116}, {27957, 26117}, {27935, 26118}, {27907, 26120}, {27929, 26121}, {286, 26122},
+    {27915, 26114}, {2153, 26124}, {2356, 26126}, {1954, 26130}, {28014, 26131}, {27989, 26132}, {2588, 26134}, {1727, 26135},
+    {28016, 26136}, {27979, 26137}, {27976, 26138}, {27926, 26139}, {27933, 26140}, {27934, 26141}, {27928, 26142}, {28024, 26143},
+    {27971, 26144}, {27925, 26145}, {27925, 26146}, {27928, 26147}, {27926, 26149}, {20, 26150}, {28031, 26151}, {28090, 26152},
+    {28033, 26153}, {28140, 26154}, {28035, 26155}, {28157, 26156}, {28037, 26157}, {28092, 26158}, {28149, 26160}, {28143, 26168},
+    {28141, 26169}, {28042, 26161}, {28081, 26162}, {28130, 26163}, {28132, 26164}, {28139, 26165}, {28155, 26166}, {28111, 26167},
+    {28154, 26170}, {28154, 26171}, {28157, 26172}, {28135, 26173}, {28144, 26174}, {28153, 26175}, {28131, 26176}, {28103, 26177},
+    {28141, 26178}, {28101, 26179}, {28148, 26180}, {28136, 26181}, {28098, 26182}, {28138, 26183}, {28096, 26184}, {954, 26185},
+    {28064, 26186}, {28059, 26187}, {28118, 26188}, {28067, 26189}, {2347, 26191}, {28112, 26192}, {28154, 26193}, {28070, 26194},
+    {28061, 26195}, {28109, 26196}, {28096, 26197}, {28097, 26198}, {28101, 26199}, {308, 26201}, {28120, 26202}, {28146, 26203},
+    {28078, 26204}, {28123, 26205}, {28143, 26206}, {28122, 26207}, {28122, 26208}, {28125, 26209}, {19, 26211}, {28096, 26212},
+    {28138, 26214}, {28086, 26215}, {28120, 26216}, {28108, 26217}, {28134, 26218}, {28110, 26219}, {28132, 26220}, {28092, 26221},
+    {28039, 26222}, {28112, 26223}, {28118, 26225}, {28069, 26226}, {28062, 26228}, {28086, 26229}, {28086, 26230}, {28074, 26231},
+    {28074, 26232}, {378, 26234}, {28102, 26235}, {28056, 26236}, {28070, 26237}, {28147, 26238}, {28144, 26239}, {28078, 26240},
+    {28069, 26241}, {28070, 26242}, {28064, 26243}, {28074, 26244}, {28094, 26245}, {28095, 26246}, {28093, 26247}, {28064, 26248},
+    {28043, 26249}, {28065, 26250}, {28041, 26251}, {28089, 26252}, {28074, 26256}, {28094, 26264}, {28083, 26253}, {28084, 26255},
+    {28072, 26257}, {1065, 26258}, {376, 26260}, {28073, 26261}, {28033, 26262}, {28127, 26263}, {28046, 26265}, {28046, 26266},
+    {28049, 26267}, {28092, 26268}, {28048, 26269}, {28133, 26270}, {28124, 26271}, {28041, 26272}, {28033, 26273}, {28044, 26274},
+    {28037, 26275}, {28063, 26276}, {28083, 26277}, {28057, 26278}, {28081, 26279}, {28032, 26280}, {28036, 26281}, {28078, 26282},
+    {28038, 26283}, {28076, 26284}, {28058, 26285}, {28060, 26286}, {28051, 26333}, {28055, 26288}, {28051, 26289}, {28054, 26304},
+    {28055, 26287}, {28058, 26290}, {1706, 26291}, {28158, 26292}, {28064, 26293}, {28270, 26294}, {28219, 26295}, {28269, 26297},
+    {28062, 26287}, {28053, 26290}, {28279, 26298}, {2003, 26299}, {28272, 26300}, {28250, 26301}, {28269, 26302}, {28271, 26303},
+    {28262, 26305}, {28258, 26306}, {28281, 26307}, {28198, 26308}, {28172, 26309}, {28242, 26310}, {28256, 26311}, {28285, 26320},
+    {28279, 26328}, {28280, 26312}, {28257, 26313}, {28236, 26314}, {28281, 26315}, {28207, 26316}, {28275, 26317}, {28286, 26318},
+    {28275, 26319}, {28279, 26321}, {28277, 26323}, {28271, 26324}, {1428, 26325}, {28188, 26326}, {28199, 26327}, {28272, 26329},
+    {28278, 26330}, {28229, 26331}, {28239, 26332}, {28235, 26334}, {28238, 26482}, {28232, 26335}, {28232, 26336}, {28200, 26338},
+    {28226, 26368}, {28179, 26339}, {28228, 26340}, {28226, 26341}, {28233, 26342}, {2414, 26344}, {28227, 26345}, {28231, 26346},
+    {28237, 26368}, {28250, 26483}, {28230, 26347}, {28268, 26348}, {28255, 26349}, {28253, 26350}, {28248, 26351}, {28248, 26353},
+    {28238, 26369}, {28236, 26354}, {1266, 26355}, {28240, 26356}, {28241, 26357}, {28196, 26358}, {28239, 26359}, {28258, 26360},
+    {28249, 26369}, {28243, 26361}, {28256, 26362}, {28207, 26363}, {28208, 26370}, {28196, 26378}, {28205, 26364}, {1376, 26365},
+    {28229, 26366}, {28185, 26367}, {28201, 26371}, {28275, 26372}, {28197, 26373}, {28223, 26374}, {28179, 26375}, {28217, 26376},
+    {28177, 26377}, {28193, 26379}, {28223, 26380}, {28194, 26381}, {28173, 26382}, {28199, 26383}, {1899, 26384}, {28244, 26385},
+    {28170, 26386}, {28216, 26387}, {28269, 26388}, {28258, 26389}, {28220, 26390}, {28211, 26391}, {28208, 26392}, {28210, 26393},
+    {28263, 26394}, {28219, 26395}, {28214, 26396}, {28171, 26397}, {28175, 26398}, {1925, 26400}, {28182, 26401}, {28220, 26402},
+    {28260, 26403}, {115, 26404}, {28261, 26405}, {28217, 26406}, {28169, 26407}, {28242, 26408}, {29, 26409}, {28232, 26358},
+    {28265, 26410}, {28213, 26411}, {28165, 26412}, {28246, 26413}, {28269, 26414}, {28244, 26415}, {28161, 26416}, {28185, 26417},
+    {28180, 26418}, {1807, 26419}, {28274, 26420}, {28204, 26421}, {28186, 26422}, {28239, 26423}, {28185, 26424}, {28163, 26425},
+    {28199, 26426}, {28174, 26427}, {28196, 26428}, {28179, 26429}, {28169, 26430}, {28193, 26431}, {28171, 26432}, {28383, 26433},
+    {314, 26434}, {28289, 26435}, {28381, 26436}, {28397, 26437}, {28350, 26438}, {2685, 26439}, {28293, 26440}, {28377, 26441},
+    {28393, 26442}, {28338, 26443}, {28374, 26444}, {28388, 26445}, {28409, 26448}, {28395, 26456}, {28388, 26446}, {28391, 26447},
+    {28388, 26449}, {28404, 26450}, {28407, 26451}, {28413, 26452}, {28334, 26453}, {28400, 26454}, {28409, 26457}, {28387, 26458},
+    {626, 26459}, {28323, 26460}, {28415, 26461}, {28402, 26462}, {28407, 26463}, {28403, 26464}, {1705, 26465}, {28318, 26466},
+    {28352, 26467}, {28366, 26468}, {28315, 26469}, {2047, 26470}, {28322, 26471}, {28358, 26472}, {28353, 26473}, {28363, 26474},
+    {28361, 26476}, {28371, 26477}, {2328, 26478}, {2026, 26479}, {28328, 26480}, {28406, 26481}, {28356, 26484}, {28305, 26485},
+    {28310, 26486}, {28360, 26487}, {28359, 26488}, {28356, 26489}, {28382, 26490}, {940, 26492}, {28357, 26493}, {28397, 26494},
+    {28339, 26495}, {28373, 26496}, {28370, 26497}, {28354, 26498}, {28392, 26499}, {28371, 26500}, {28369, 26501}, {28372, 26502},
+    {28289, 26503}, {28377, 26504}, {28372, 26505}, {28373, 26506}, {28369, 26507}, {28329, 26508}, {28330, 26509}, {28326, 26510},
+    {28414, 26511}, {28320, 26512}, {28335, 26513}, {28332, 26514}, {28326, 26515}, {28327, 26516}, {28322, 26517}, {28325, 26596},
+    {28333, 26518}, {28321, 26519}, {28351, 26520}, {28322, 26521}, {28301, 26522}, {28336, 26510}, {28327, 26523}, {28299, 26524},
+    {28324, 26518}, {28347, 26525}, {28324, 26528}, {28336, 26536}, {28337, 26526}, {28343, 26527}, {28341, 26529}, {28328, 26530},
+    {28291, 26531}, {28329, 26532}, {28336, 26533}, {28342, 26534}, {28289, 26535}, {28297, 26581}, {28301, 26537}, {28301, 26538},
+    {28300, 26585}, {28315, 26540}, {28342, 26541}, {28295, 26542}, {28296, 26535}, {28312, 26543}, {28339, 26544}, {28288, 26545},
+    {28292, 26539}, {28299, 26546}, {28289, 26547}, {28315, 26548}, {28290, 26549}, {28317, 26550}, {28361, 26551}, {28305, 26552},
+    {28303, 26539}, {28316, 26553}, {28317, 26554}, {28313, 26555}, {28307, 26556}, {28305, 26557}, {28307, 26558}, {28304, 26559},
+    {28303, 26560}, {28461, 26561}, {28307, 26562}, {28386, 26450}, {28305, 26563}, {28300, 26564}, {28510, 26565}, {28534, 26566},
+    {28528, 26567}, {28507, 26568}, {28520, 26569}, {28533, 26570}, {28504, 26571}, {28517, 26572}, {28502, 26573}, {28542, 26574},
+    {28542, 26575}, {28542, 26578}, {28522, 26586}, {28522, 26587}, {28522, 26577}, {28542, 26579}, {28538, 26580}, {28513, 26582},
+    {28540, 26583}, {28538, 26584}, {28540, 26588}, {28531, 26738}, {28486, 26589}, {28532, 26590}, {28521, 26592}, {28539, 26600},
+    {28535, 26624}, {28532, 26591}, {28539, 26593}, {28529, 26594}, {28491, 26595}, {28498, 26597}, {28493, 26598}, {28492, 26599},
+    {28542, 26624}, {28496, 26601}, {28538, 26602}, {28498, 26603}, {28536, 26604}, {28493, 26605}, {28487, 26606}, {28481, 26607},
+    {28504, 26608}, {28483, 26609}, {28483, 26610}, {28481, 26611}, {28508, 26612}, {28527, 26613}, {28485, 26614}, {28525, 26615},
+    {28509, 26616}, {28486, 26625}, {28498, 26633}, {28511, 26617}, {28505, 26618}, {28497, 26619}, {28496, 26736}, {28505, 26620},
+    {28504, 26626}, {28499, 26621}, {28501, 26622}, {28492, 26623}, {28463, 26627}, {28458, 26628}, {28465, 26629}, {28589, 26630},
+    {28499, 26626}, {28454, 26631}, {28458, 26632}, {28462, 26634}, {28469, 26635}, {28456, 26636}, {28461, 26637}, {28455, 26638},
+    {28449, 26639}, {28472, 26640}, {28451, 26641}, {28535, 26642}, {28459, 26643}, {28449, 26644}, {28479, 26645}, {28479, 26647},
+    {28475, 26648}, {28478, 26731}, {1230, 26650}, {28502, 26651}, {28424, 26652}, {28470, 26653}, {28515, 26654}, {691, 26655},
+    {28466, 26649}, {28506, 26656}, {28420, 26657}, {28466, 26658}, {28519, 26659}, {28516, 26660}, {28474, 26661}, {28425, 26662},
+    {28477, 26649}, {28426, 26663}, {28428, 26664}, {28439, 26666}, {28432, 26667}, {28474, 26668}, {28429, 26669}, {28431, 26670},
+    {28422, 26671}, {28430, 26672}, {28496, 26673}, {28430, 26674}, {28440, 26675}, {28466, 26676}, {28421, 26677}, {28423, 26678},
+    {28446, 26679}, {28436, 26680}, {2692, 26681}, {28489, 26682}, {28433, 26683}, {28495, 26684}, {839, 26685}, {28534, 26686},
+    {28456, 26687}, {28438, 26688}, {28483, 26689}, {1599, 26690}, {684, 26691}, {28538, 26692}, {28452, 26693}, {28434, 26694},
+    {28487, 26695}, {28433, 26697}, {28427, 26698}, {734, 26699}, {28644, 26700}, {28652, 26701}, {28547, 26702}, {28606, 26703},
+    {28651, 26704}, {28655, 26705}, {28642, 26706}, {28594, 26707}, {28652, 26708}, {28643, 26709}, {28640, 26710}, {28642, 26711},
+    {2795, 26712}, {28557, 26713}, {28625, 26714}, {28641, 26715}, {28586, 26716}, {28561, 26718}, {28584, 26719}, {28669, 26720},
+    {28669, 26721}, {28656, 26722}, {28664, 26723}, {28664, 26724}, {28651, 26725}, {28614, 26726}, {28654, 26727}, {28571, 26728},
+    {28582, 26729}, {28659, 26730}, {28663, 26732}, {28666, 26733}, {28622, 26734}, {28616, 26735}, {28623, 26866}, {28581, 26737},
+    {28611, 26752}, {28572, 26739}, {28617, 26740}, {28609, 26741}, {28620, 26742}, {28661, 26743}, {28613, 26744}, {28638, 26753},
+    {28618, 26752}, {28618, 26761}, {28615, 26745}, {28618, 26746}, {28638, 26747}, {28634, 26748}, {28609, 26749}, {28636, 26750},
+    {28614, 26754}, {28626, 26762}, {28626, 26763}, {2606, 26756}, {28611, 26757}, {28647, 26758}, {28601, 26759}, {28544, 26760},
+    {28638, 26764}, {28629, 26765}, {28630, 26766}, {28624, 26767}, {28625, 26768}, {28591, 26769}, {28594, 26770}, {28573, 26771},
+    {28599, 26772}, {28587, 26774}, {28593, 26775}, {1370, 26776}, {28594, 26777}, {28568, 26778}, {28579, 26779}, {28577, 26780},
+    {28580, 26781}, {28578, 26782}, {28583, 26783}, {1965, 26785}, {28622, 26786}, {28560, 26787}, {28607, 26788}, {28648, 26789},
+    {28627, 26790}, {28654, 26791}, {28603, 26792}, {28607, 26793}, {28594, 26794}, {28589, 26795}, {28549, 26796}, {28592, 26797},
+    {28596, 26798}, {28595, 26799}, {28603, 26800}, {28593, 26801}, {28555, 26802}, {28562, 26803}, {28557, 26804}, {28604, 26805},
+    {28554, 26806}, {28567, 26807}, {28545, 26815}, {28558, 26808}, {28599, 26809}, {28551, 26810}, {28568, 26816}, {28556, 26824},
+    {28549, 26811}, {28550, 26812}, {28573, 26813}, {28717, 26814}, {28548, 26817}, {28547, 26818}, {28716, 26819}, {28619, 26820},
+    {28566, 26821}, {28573, 26822}, {28574, 26823}, {28568, 26825}, {2194, 26826}, {28663, 26827}, {28583, 26828}, {28567, 26829},
+    {28608, 26830}, {28565, 26831}, {28565, 26832}, {28564, 26994}, {28765, 26833}, {28791, 26834}, {28785, 26835}, {2188, 26836},
+    {28596, 26784}, {28572, 26880}, {28791, 26837}, {28783, 26838}, {28780, 26839}, {28788, 26840}, {1842, 26841}, {28681, 26842},
+    {28757, 26843}, {28567, 26880}, {28773, 26844}, {28726, 26845}, {28776, 26846}, {28768, 26847}, {28772, 26848}, {28770, 26849},
+    {28797, 26850}, {28792, 26851}, {28775, 26852}, {28728, 26853}, {1532, 26855}, {28770, 26856}, {28744, 26857}, {28697, 26858},
+    {28799, 26859}, {28789, 26860}, {28791, 26861}, {28782, 26862}, {28785, 26863}, {28703, 26864}, {28698, 26865}, {28746, 26867},
+    {28753, 26868}, {28686, 26869}, {28746, 26870}, {28748, 26871}, {28743, 26881}, {28739, 26995}, {861, 26872}, {28713, 26873},
+    {28789, 26874}, {28741, 26875}, {28694, 26876}, {28766, 26877}, {28750, 26881}, {28785, 26878}, {28738, 26879}, {28763, 26882},
+    {28761, 26883}, {28763, 26884}, {28762, 26885}, {28767, 26886}, {28753, 26887}, {28685, 26888}, {28765, 26889}, {28752, 26890},
+    {28753, 26891}, {28757, 26892}, {28771, 26893}, {28752, 26894}, {28749, 26896}, {28711, 26904}, {28712, 26895}, {28726, 26897},
+    {28700, 26898}, {28719, 26899}, {28717, 26900}, {28712, 26901}, {28797, 26902}, {28717, 26903}, {28741, 26887}, {28704, 26905},
+    {28705, 26906}, {28709, 26907}, {28706, 26908}, {28706, 26909}, {28733, 26910}, {28688, 26911}, {28708, 26912}, {28732, 26913},
+    {28732, 26914}, {28711, 26915}, {28682, 26916}, {28706, 26917}, {28759, 26918}, {28770, 26919}, {28727, 26920}, {28723, 26921},
+    {28734, 26922}, {28774, 26923}, {28728, 26924}, {28727, 26925}, {28724, 26926}, {28686, 26927}, {28763, 26928}, {28679, 26929},
+    {28682, 26930}, {28687, 26931}, {28683, 26932}, {28675, 26933}, {28678, 26934}, {28674, 26935}, {28697, 26936}, {28676, 26937},
+    {28758, 26938}, {28680, 26939}, {28679, 26940}, {28676, 26941}, {28702, 26942}, {28718, 26943}, {28698, 26944}, {28679, 26945},
+    {28689, 26953}, {28702, 26946}, {28606, 26784}, {28711, 26947}, {28695, 26948}, {28680, 26949}, {28700, 26957}, {28795, 26840},
+    {28693, 26950}, {28743, 26951}, {28699, 26952}, {28694, 26954}, {28907, 26955}, {28911, 26956}, {28856, 26958}, {28902, 26959},
+    {28909, 26960}, {28910, 26961}, {28904, 26962}, {28910, 26963}, {28899, 26964}, {28916, 26965}, {28899, 26966}, {28896, 26967},
+    {28917, 26968}, {28813, 26969}, {28852, 26970}, {28897, 26971}, {28923, 26972}, {28918, 26973}, {28909, 26974}, {898, 26975},
+    {2682, 26977}, {28922, 26978}, {28920, 26979}, {28921, 26980}, {28911, 26982}, {28911, 26983}, {28838, 26984}, {28915, 26986},
+    {28830, 26987}, {28912, 26989}, {28884, 26990}, {885, 26991}, {28827, 26992}, {28871, 26993}, {128, 26997}, {28887, 26998},
+    {28923, 26999}, {28837, 27000}, {28878, 27001}, {443, 27002}, {28839, 27003}, {28871, 27005}, {28893, 27006}, {229, 27007},
+    {2, 27009}, {28842, 27010}, {28843, 27011}, {28822, 27012}, {28895, 27014}, {28873, 27022}, {28875, 27023}, {28866, 27015},
+    {28809, 27016}, {28881, 27017}, {28892, 27018}, {28893, 27019}, {28889, 27020}, {28882, 27021}, {28882, 27024}, {28877, 27025},
+    {28896, 27026}, {28852, 27027}, {28830, 27028}, {28844, 27029}, {28849, 27030}, {28835, 27038}, {28844, 27031}, {28850, 27032},
+    {28824, 27033}, {28835, 27034}, {28834, 27035}, {28837, 27036}, {28918, 27039}, {28840, 27040}, {28839, 27041}, {28836, 27042},
+    {28862, 27043}, {28852, 27044}, {28860, 27045}, {28856, 27046}, {28884, 27010}, {28839, 27047}, {28858, 27048}, {28886, 27011},
+    {2078, 27049}, {28886, 27050}, {28808, 27051}, {28854, 27052}, {28899, 27053}, {1235, 27055}, {28890, 27056}, {28897, 27057},
+    {28857, 27058}, {28852, 27059}, {28853, 27060}, {28849, 27061}, {28812, 27062}, {28800, 27063}, {28888, 27064}, {28860, 27065},
+    {28810, 27066}, {28823, 27072}, {28801, 27080}, {28814, 27067}, {28806, 27068}, {1624, 27069}, {28883, 27070}, {28815, 27071},
+    {28805, 27073}, {28807, 27074}, {28830, 27075}, {28801, 27076}, {28801, 27077}, {28831, 27078}, {2761, 27084}, {28913, 27085},
+    {2037, 27088}, {28914, 27089}, {28915, 27090}, {28878, 27091}, {28827, 27092}, {28831, 27093}, {28818, 27094}, {28922, 26965},
+    {2796, 27095}, {28920, 27096}, {28927, 26968}, {28838, 27097}, {28820, 27098}, {28865, 27099}, {28870, 27100}, {608, 27102},
+    {28925, 27103}, {2201, 27104}, {28825, 27105}, {150, 27106}, {28826, 27107}, {2709, 27108}, {28928, 27109}, {29034, 27110},
+    {29034, 27111}, {29034, 27112}, {1067, 27113}, {28932, 27114}, {29018, 27115}, {29032, 27116}, {28989, 27117}, {29031, 27118},
+    {29053, 27119}, {29013, 27120}, {29055, 27121}, {29011, 27122}, {28983, 27123}, {29053, 27124}, {29025, 27125}, {29055, 27126},
+    {29026, 27127}, {29005, 27128}, {29031, 27129}, {29050, 27130}, {29050, 27131}, {29029, 27132}, {29000, 27133}, {29036, 27134},
+    {2252, 27136}, {28953, 27137}, {28960, 27138}, {116, 27139}, {29044, 27141}, {29032, 27142}, {2731, 27143}, {28957, 27144},
+    {28964, 27145}, {29041, 27146}, {29001, 27147}, {28996, 27148}, {29005, 27150}, {29015, 27151}, {2008, 27152}, {29003, 27153},
+    {29009, 27154}, {29049, 27155}, {29011, 27156}, {29047, 27157}, {28998, 27159}, {29022, 27160}, {2485, 27161}, {28997, 27162},
+    {28995, 27163}, {29022, 27164}, {29041, 27165}, {29019, 27166}, {2605, 27167}, {28976, 27168}, {29038, 27169}, {29020, 27170},
+    {28937, 27171}, {28999, 27172}, {29034, 27173}, {29019, 27174}, {29010, 27175}, {29014, 27176}, {775, 27178}, {29005, 27179},
+    {29029, 27180}, {28987, 27181}, {28988, 27182}, {28935, 27183}, {29008, 27184}, {29014, 27185}, {28965, 27186}, {29051, 27187},
+    {28967, 27188}, {28966, 27189}, {28970, 27190}, {28974, 27191}, {28981, 27192}, {28968, 27193}, {28988, 27194}, {28950, 27195},
+    {28961, 27196}, {28963, 27197}, {28962, 27198}, {28963, 27199}, {28961, 27200}, {28960, 27203}, {28964, 27204}, {1519, 27205},
+    {28980, 27206}, {28988, 27207}, {28984, 27208}, {28967, 27209}, {28986, 27210}, {1470, 27211}, {29014, 27212}, {28936, 27213},
+    {28982, 27214}, {29027, 27215}, {28980, 27216}, {28980, 27217}, {28975, 27218}, {28930, 27219}, {28970, 27220}, {28977, 27221},
+    {28943, 27222}, {28946, 27223}, {28989, 27224}, {28951, 27225}, {28987, 27226}, {28939, 27227}, {28948, 27232}, {28928, 27240},
+    {28929, 27228}, {28982, 27229}, {28932, 27230}, {28953, 27233}, {28939, 27241}, {28932, 27231}, {2498, 27235}, {28954, 27236},
+    {28976, 27237}, {29040, 27238}, {28959, 27239}, {28957, 27242}, {28956, 27244}, {28928, 27245}, {28970, 27246}, {28930, 27247},
+    {28968, 27248}, {28945, 27249}, {28946, 27250}, {29156, 27251}, {2293, 27252}, {28943, 27253}, {28963, 27254}, {28950, 27255},
+    {28950, 27256}, {28945, 27257}, {29162, 27258}, {29169, 27259}, {29102, 27260}, {29060, 27261}, {29119, 27262}, {29160, 27263},
+    {29166, 27264}, {29164, 27265}, {29156, 27266}, {29156, 27267}, {1617, 27269}, {29068, 27270}, {29138, 27271}, {29152, 27272},
+    {29109, 27273}, {29135, 27274}, {29183, 27275}, {29152, 27280}, {29172, 27288}, {29181, 27276}, {29168, 27277}, {29176, 27278},
+    {2209, 27279}, {29079, 27281}, {29127, 27282}, {29175, 27283}, {29088, 27284}, {29124, 27286}, {29170, 27287}, {29167, 27296},
+    {29177, 27304}, {29174, 27289}, {29135, 27290}, {29141, 27291}, {29181, 27292}, {29143, 27293}, {29179, 27294}, {29131, 27295},
+    {29129, 27297}, {29129, 27299}, {29121, 27300}, {29120, 27351}, {29127, 27302}, {29150, 27303}, {29059, 27305}, {29147, 27306},
+    {29128, 27301}, {29167, 27307}, {29146, 27308}, {29146, 27309}, {29149, 27310}, {671, 27312}, {29120, 27313}, {29162, 27314},
+    {29123, 27301}, {29110, 27315}, {29145, 27316}, {29143, 27317}, {29130, 27318}, {29157, 27319}, {29135, 27320}, {29145, 27321},
+    {29139, 27322}, {29141, 27323}, {29132, 27324}, {29103, 27325}, {1276, 27327}, {29109, 27328}, {29085, 27329}, {29123, 27330},
+    {29124, 27331}, {29183, 27332}, {29096, 27333}, {29102, 27334}, {29101, 27335}, {29129, 27336}, {29168, 27337}, {29093, 27338},
+    {29093, 27339}, {29096, 27340}, {29089, 27342}, {29115, 27343}, {2653, 27344}, {641, 27346}, {29092, 27347}, {29070, 27348},
+    {29138, 27349}, {949, 27352}, {29095, 27353}, {29067, 27354}, {29141, 27355}, {326, 27356}, {29142, 27357}, {29064, 27358},
+    {29110, 27359}, {29155, 27360}, {278, 27362}, {29102, 27363}, {29060, 27364}, {29149, 27365}, {29104, 27366}, {29104, 27367},
+    {29075, 27368}, {28937, 27251}, {29118, 27369}, {29078, 27370}, {29069, 27371}, {29067, 27372}, {29078, 27373}, {29113, 27374},
+    {29075, 27375}, {1258, 27377}, {29084, 27378}, {29110, 27379}, {29162, 27380}, {250, 27382}, {29087, 27383}, {29107, 27384},
+    {29165, 27385}, {29082, 27386}, {29104, 27387}, {29083, 27388}, {29082, 27389}, {29085, 27390}, {29082, 27391}, {29084, 27392},
+    {29079, 27393}, {29075, 27507}, {29123, 27394}, {29087, 27395}, {29179, 27396}, {29126, 27397}, {29075, 27398}, {29073, 27399},
+    {29086, 27393}, {29183, 27401}, {29242, 27402}, {29295, 27403}, {29291, 27404}, {29286, 27405}, {1424, 27407}, {29296, 27408},
+    {29274, 27409}, {29190, 27410}, {2434, 27412}, {29301, 27413}, {29234, 27414}, {29292, 27415}, {29284, 27416}, {29284, 27417},
+    {923, 27420}, {29304, 27421}, {29266, 27422}, {29198, 27423}, {29199, 27424}, {29226, 27425}, {29311, 27426}, {29307, 27427},
+    {29302, 27428}, {29307, 27430}, {29281, 27431}, {2349, 27432}, {29297, 27433}, {29229, 27434}, {29303, 27435}, {29293, 27436},
+    {29253, 27437}, {29295, 27438}, {29251, 27439}, {29213, 27440}, {29220, 27441}, {29297, 27442}, {29257, 27443}, {29252, 27444},
+    {29260, 27445}, {29258, 27446}, {29253, 27447}, {29261, 27461}, {29223, 27448}, {29202, 27449}, {29255, 27450}, {29251, 27451},
+    {29262, 27452}, {29299, 27453}, {29260, 27447}, {29251, 27454}, {29276, 27456}, {29256, 27464}, {29273, 27455}, {29268, 27457},
+    {29276, 27458}, {29272, 27459}, {29255, 27460}, {29274, 27462}, {29250, 27463}, {29288, 27465}, {29267, 27466}, {29265, 27467},
+    {29268, 27468}, {29278, 27469}, {29266, 27470}, {29270, 27471}, {29261, 27472}, {29264, 27473}, {29215, 27474}, {29231, 27475},
+    {29232, 27476}, {29220, 27484}, {29229, 27477}, {29210, 27478}, {29224, 27479}, {29237, 27488}, {29231, 27496}, {29216, 27480},
+    {29217, 27481}, {29240, 27482}, {29357, 27483}, {29223, 27485}, {29246, 27486}, {29356, 27487}, {29300, 27489}, {29226, 27490},
+    {29241, 27491}, {29242, 27492}, {29244, 27493}, {29267, 27494}, {29294, 27495}, {29243, 27497}, {29247, 27498}, {29234, 27499},
+    {29191, 27500}, {29229, 27501}, {29231, 27502}, {29234, 27503}, {29239, 27504}, {29243, 27506}, {29233, 27508}, {29194, 27509},
+    {29188, 27505}, {29201, 27510}, {29196, 27511}, {29199, 27512}, {29206, 27513}, {29359, 27514}, {29197, 27515}, {29204, 27516},
+    {29358, 27517}, {29210, 27518}, {29237, 27519}, {29190, 27520}, {29191, 27521}, {29189, 27522}, {29191, 27523}, {29269, 27524},
+    {29205, 27525}, {29208, 27526}, {29209, 27527}, {29213, 27528}, {29227, 27529}, {29211, 27530}, {29188, 27536}, {29200, 27544},
+    {29201, 27531}, {29197, 27532}, {29221, 27533}, {29200, 27534}, {29204, 27535}, {29203, 27537}, {29252, 27538}, {29210, 27539},
+    {29421, 27540}, {29422, 27541}, {29416, 27542}, {29417, 27543}, {29415, 27545}, {29434, 27546}, {29397, 27547}, {29439, 27548},
+    {29366, 27549}, {29416, 27550}, {29415, 27551}, {29412, 27552}, {29438, 27553}, {29428, 27554}, {29436, 27555}, {29432, 27556},
+    {29415, 27557}, {29434, 27558}, {29410, 27559}, {29384, 27560}, {29427, 27561}, {29425, 27562}, {29428, 27563}, {29380, 27564},
+    {29426, 27565}, {29423, 27568}, {29433, 27576}, {29430, 27566}, {29338, 27567}, {29380, 27569}, {29387, 27570}, {29384, 27571},
+    {29386, 27572}, {29388, 27573}, {29389, 27574}, {29331, 27577}, {29391, 27578}, {29378, 27579}, {29383, 27580}, {29379, 27581},
+    {29332, 27582}, {29397, 27583}, {29400, 27584}, {29401, 27585}, {29405, 27586}, {29364, 27587}, {29327, 27588}, {29395, 27589},
+    {29401, 27590}, {29415, 27591}, {29399, 27592}, {29384, 27600}, {29404, 27608}, {29397, 27593}, {1232, 27595}, {29385, 27596},
+    {29409, 27597}, {29375, 27598}, {1000, 27601}, {29364, 27602}, {29342, 27603}, {29378, 27604}, {29379, 27605}, {29438, 27606},
+    {29355, 27607}, {29359, 27609}, {29346, 27610}, {29372, 27611}, {29350, 27612}, {29374, 27613}, {29332, 27614}, {29368, 27615},
+    {29330, 27616}, {29428, 27617}, {29391, 27618}, {29418, 27619}, {29374, 27620}, {29350, 27621}, {29324, 27622}, {29344, 27623},
+    {29322, 27624}, {29359, 27625}, {29230, 27505}, {29399, 27627}, {29355, 27628}, {29401, 27629}, {47, 27631}, {29358, 27632},
+    {29316, 27633}, {29404, 27634}, {318, 27637}, {29353, 27638}, {29313, 27639}, {29407, 27640}, {29326, 27641}, {29326, 27642},
+    {29379, 27575}, {29400, 27644}, {29318, 27645}, {6, 27646}, {29412, 27647}, {29370, 27648}, {29320, 27649}, {29405, 27650},
+    {29416, 27651}, {29395, 27652}, {29316, 27653}, {29314, 27654}, {29321, 27655}, {876, 27657}, {29337, 27658}, {29361, 27659},
+    {29423, 27660}, {1952, 27661}, {29428, 27662}, {29354, 27663}, {29336, 27664}, {29389, 27665}, {29341, 27666}, {29335, 27667},
+    {29329, 27668}, {29320, 27669}, {29331, 27670}, {825, 27671}, {29437, 27672}, {29345, 27673}, {29329, 27674}, {29498, 27675},
+    {29534, 27676}, {29548, 27677}, {29553, 27680}, {29539, 27688}, {29548, 27678}, {2142, 27679}, {29446, 27681}, {29528, 27682},
+    {29542, 27683}, {29491, 27684}, {29566, 27685}, {29524, 27686}, {29543, 27687}, {29541, 27689}, {29536, 27690}, {29493, 27691},
+    {29557, 27692}, {29560, 27693}, {29561, 27694}, {29565, 27695}, {29567, 27696}, {29565, 27697}, {29567, 27698}, {29560, 27700},
+    {29548, 27701}, {572, 27702}, {29465, 27703}, {29472, 27704}, {29557, 27705}, {29557, 27706}, {29560, 27707}, {29563, 27708},
+    {29553, 27709}, {29515, 27710}, {29522, 27711}, {29517, 27712}, {29517, 27713}, {29515, 27714}, {29514, 27716}, {29522, 27717},
+    {29560, 27718}, {29532, 27719}, {29558, 27720}, {29508, 27721}, {29506, 27722}, {29509, 27890}, {560, 27724}, {29531, 27725},
+    {29517, 27776}, {29551, 27726}, {29489, 27727}, {1092, 27728}, {29490, 27729}, {29548, 27730}, {29530, 27731}, {29455, 27732},
+    {29508, 27776}, {29529, 27733}, {29507, 27734}, {29543, 27735}, {29517, 27736}, {29541, 27737}, {29441, 27738}, {29529, 27739},
+    {29524, 27740}, {29525, 27741}, {29521, 27742}, {29492, 27743}, {29470, 27744}, {29481, 27745}, {29483, 27746}, {29482, 27747},
+    {29489, 27748}, {29465, 27749}, {29484, 27750}, {29472, 27751}, {29479, 27752}, {29475, 27753}, {29472, 27754}, {29476, 27756},
+    {29477, 27757}, {29522, 27759}, {29403, 27575}, {29545, 27760}, {29498, 27761}, {29500, 27762}, {29491, 27763}, {966, 27765},
+    {29475, 27766}, {29445, 27767}, {29531, 27768}, {29443, 27769}, {29491, 27770}, {29484, 27777}, {29496, 27785}, {29449, 27771},
+    {29492, 27755}, {29493, 27758}, {29458, 27772}, {29501, 27773}, {29454, 27774}, {29534, 27778}, {29451, 27779}, {29455, 27780},
+    {29442, 27895}, {2695, 27783}, {29470, 27784}, {29492, 27786}, {29548, 27787}, {29527, 27788}, {29451, 27789}, {29446, 27790},
+    {29446, 27781}, {29467, 27791}, {29471, 27792}, {29467, 27793}, {29464, 27794}, {29456, 27795}, {29465, 27797}, {29443, 27798},
+    {29441, 27781}, {2694, 27799}, {29506, 27800}, {29468, 27801}, {29459, 27802}, {29456, 27803}, {29459, 27804}, {971, 27805},
+    {29566, 27806}, {29462, 27807}, {29675, 27808}, {29669, 27809}, {29660, 27810}, {29674, 27811}, {29687, 27812}, {29665, 27820},
+    {29678, 27813}, {655, 27815}, {29692, 27816}, {29653, 27817}, {29579, 27818}, {29671, 27819}, {29694, 27821}, {29603, 27822},
+    {29648, 27823}, {29668, 27824}, {29668, 27825}, {29692, 27826}, {29690, 27827}, {29685, 27828}, {29693, 27846}, {29591, 27829},
+    {29602, 27830}, {29687, 27831}, {29683, 27832}, {29694, 27833}, {29672, 27834}, {29692, 27828}, {29634, 27835}, {29685, 27836},
+    {29687, 27837}, {29646, 27838}, {29646, 27839}, {29654, 27840}, {29692, 27841}, {29648, 27842}, {29690, 27843}, {29606, 27844},
+    {29597, 27845}, {29638, 27847}, {29632, 27848}, {29647, 27849}, {29646, 27850}, {29634, 27851}, {29638, 27852}, {29661, 27853},
+    {29632, 27854}, {29681, 27809}, {29653, 27855}, {29663, 27856}, {29657, 27857}, {29632, 27858}, {29659, 27859}, {2438, 27860},
+    {29621, 27861}, {29673, 27862}, {29657, 27863}, {29570, 27864}, {29625, 27865}, {29568, 27866}, {29653, 27867}, {29653, 27868},
+    {29656, 27869}, {29630, 27870}, {29573, 27871}, {29614, 27872}, {29608, 27873}, {29607, 27874}, {29689, 27875}, {29446, 27795},
+    {29601, 27876}, {29612, 27877}, {29613, 27878}, {29609, 27879}, {29640, 27880}, {29683, 27881}, {29604, 27882}, {29602, 27883},
+    {29609, 27884}, {29625, 27885}, {29503, 27755}, {29500, 27758}, {29585, 27886}, {29604, 27887}, {29624, 27888}, {29631, 27889},
+    {29606, 27891}, {29580, 27892}, {29631, 27893}, {29629, 27894}, {29624, 27896}, {29655, 27897}, {29666, 27898}, {29623, 27899},
+    {29619, 27900}, {29630, 27901}, {29660, 27902}, {29671, 27903}, {29616, 27904}, {29622, 27905}, {29573, 27906}, {29583, 27907},
+    {29579, 27908}, {29582, 28023}, {29576, 27910}, {29582, 27911}, {29569, 28026}, {798, 27913}, {29675, 27914}, {29619, 27915},
+    {29570, 27909}, {29577, 27912}, {29571, 27916}, {29652, 27917}, {29653, 27918}, {29598, 27921}, {29643, 27922}, {29640, 27923},
+    {29581, 27909}, {29568, 27912}, {29575, 27924}, {29568, 27925}, {29685, 27926}, {29644, 27927}, {2552, 27928}, {29593, 27929},
+    {29591, 27930}, {29689, 27932}, {29632, 27933}, {29588, 27935}, {29577, 27936}, {1245, 27937}, {29601, 27938}, {418, 27940},
+    {29585, 27941}, {29807, 27942}, {2409, 27945}, {1244, 27946}, {29703, 27947}, {29795, 27948}, {29793, 27949}, {29795, 27950},
+    {29792, 27980}, {29745, 27951}, {29797, 27983}, {29708, 27952}, {29751, 27953}, {29792, 27954}, {29798, 27955}, {29812, 27956},
+    {29803, 27980}, {29798, 27980}, {29804, 27983}, {29795, 27983}, {29815, 27957}, {29821, 27958}, {29823, 27959}, {29798, 27960},
+    {29817, 27961}, {29795, 27962}, {29765, 27963}, {29808, 27964}, {29812, 27965}, {29811, 27966}, {29809, 27967}, {29803, 27968},
+    {29823, 27969}, {29812, 27947}, {29781, 27970}, {29821, 27971}, {29731, 27972}, {29726, 27973}, {29771, 27974}, {29775, 27975},
+    {29762, 27976}, {29714, 27977}, {29772, 27978}, {29763, 27979}, {29760, 27981}, {29762, 27982}, {353, 27985}, {29785, 27986},
+    {29809, 27987}, {29743, 27988}, {2040, 27990}, {29744, 27991}, {29707, 27992}, {29788, 27993}, {29786, 27994}, {29777, 27995},
+    {29780, 27996}, {29777, 27997}, {29751, 27998}, {29772, 27999}, {29798, 28000}, {29777, 28001}, {29779, 28002}, {29778, 28003},
+    {29703, 28004}, {29758, 28006}, {29701, 28007}, {29733, 28008}, {29736, 28009}, {29737, 28010}, {29741, 28011}, {29729, 28012},
+    {29739, 28013}, {1517, 28015}, {578, 28017}, {362, 28018}, {29766, 28019}, {29720, 28020}, {29734, 28021}, {29811, 28022},
+    {1324, 28025}, {29758, 28027}, {29716, 28028}, {29772, 28029}, {29773, 28030}, {2425, 28032}, {29713, 28034}, {29756, 28036},
+    {1832, 28038}, {29711, 28039}, {29733, 28040}, {29735, 28041}, {529, 28043}, {29735, 28044}, {29707, 28045}, {29781, 28046},
+    {29752, 28047}, {29752, 28048}, {29739, 28049}, {29702, 28050}, {29742, 28051}, {29787, 28052}, {29798, 28053}, {29752, 28054},
+    {29744, 28055}, {29748, 28056}, {29715, 28057}, {29710, 28058}, {29703, 28059}, {29709, 28060}, {29711, 28061}, {29718, 28062},
+    {29705, 28063}, {2624, 28065}, {29799, 28066}, {29702, 28068}, {29702, 28069}, {172, 28071}, {29802, 28072}, {29748, 28073},
+    {29698, 28074}, {29783, 28075}, {29696, 28076}, {29696, 28077}, {29726, 28079}, {29726, 28080}, {29697, 28081}, {29740, 28082},
+    {29696, 28083}, {29723, 28084}, {29721, 28085}, {29714, 28087}, {29718, 28088}, {29714, 28089}, {29705, 28090}, {29716, 28091},
+    {1139, 28093}, {29704, 28094}, {29730, 28095}, {29822, 28096}, {29716, 28097}, {29939, 28098}, {29868, 28099}, {29880, 28100},
+    {29926, 28101}, {29931, 28103}, {29937, 28104}, {558, 28105}, {2141, 28106}, {29830, 28107}, {29912, 28108}, {29926, 28109},
+    {29875, 28110}, {29834, 28111}, {29873, 28112}, {29878, 28113}, {29928, 28114}, {29927, 28115}, {29924, 28116}, {29950, 28117},
+    {29950, 28118}, {29926, 28119}, {29900, 28120}, {29920, 28121}, {29898, 28122}, {29939, 28123}, {29945, 28124}, {29942, 28125},
+    {29942, 28126}, {29856, 28128}, {29950, 28129}, {29941, 28130}, {29942, 28131}, {29936, 28132}, {1293, 28134}, {29931, 28135},
+    {29951, 28136}, {29857, 28137}, {29895, 28138}, {29901, 28139}, {29903, 28140}, {29910, 28141}, {29897, 28142}, {29890, 28143},
+    {29894, 28144}, {29890, 28145}, {29913, 28146}, {29892, 28147}, {29912, 28148}, {29938, 28149}, {29893, 28150}, {29895, 28151},
+    {29918, 28152}, {29893, 28153}, {29933, 28154}, {29912, 28155}, {29916, 28156}, {29915, 28157}, {29913, 28159}, {29891, 28160},
+    {1908, 28161}, {29917, 28162}, {29911, 28163}, {29908, 28164}, {29908, 28165}, {29903, 28166}, {29922, 28167}, {29898, 28168},
+    {29905, 28169}, {29865, 28170}, {29864, 28281}, {29867, 28173}, {29873, 28174}, {29849, 28175}, {29875, 28176}, {29847, 28177},
+    {29856, 28171}, {29856, 28178}, {29857, 28179}, {29876, 28180}, {2791, 28181}, {29900, 28182}, {29842, 28183}, {29856, 28184},
+    {29867, 28171}, {29941, 28185}, {29876, 28186}, {29884, 28187}, {2583, 28189}, {29863, 28190}, {29835, 28191}, {29909, 28192},
+    {29858, 28193}, {29832, 28194}, {29874, 28195}, {29874, 28196}, {29877, 28197}, {29926, 28198}, {29880, 28199}, {1857, 28201},
+    {29866, 28202}, {29824, 28203}, {29920, 28204}, {29845, 28205}, {29885, 28206}, {29832, 28207}, {29836, 28208}, {29835, 28209},
+    {29832, 28210}, {29832, 28211}, {29851, 28212}, {29878, 28213}, {29854, 28214}, {29838, 28215}, {29826, 28216}, {29874, 28217},
+    {29824, 28218}, {29853, 28224}, {29847, 28232}, {29848, 28219}, {29851, 28220}, {29855, 28221}, {29841, 28222}, {29848, 28223},
+    {29836, 28225}, {29862, 28226}, {29838, 28227}, {29860, 28228}, {29843, 28230}, {29834, 28231}, {882, 28233}, {29850, 28234},
+    {30062, 28235}, {30058, 28236}, {30065, 28237}, {30060, 28238}, {30014, 28239}, {30048, 28240}, {30063, 28241}, {30060, 28242},
+    {30054, 28243}, {30054, 28245}, {30078, 28246}, {2261, 28247}, {2215, 28248}, {29963, 28249}, {30035, 28250}, {30051, 28251},
+    {30004, 28252}, {1918, 28253}, {29967, 28254}, {30031, 28255}, {30079, 28256}, {29992, 28257}, {30077, 28258}, {30075, 28259},
+    {30074, 28262}, {30050, 28263}, {1926, 28264}, {30072, 28266}, {30060, 28267}, {2297, 28268}, {2081, 28270}, {30061, 28271},
+    {30021, 28272}, {29979, 28273}, {30067, 28275}, {30057, 28276}, {29829, 28222}, {2509, 28277}, {30075, 28278}, {30065, 28279},
+    {30027, 28280}, {30034, 28282}, {30029, 28283}, {30022, 28284}, {30026, 28285}, {30030, 28286}, {30037, 28287}, {30024, 28288},
+    {30023, 28290}, {30045, 28291}, {528, 28292}, {30021, 28294}, {30047, 28295}, {2080, 28296}, {30019, 28297}, {30041, 28298},
+    {30065, 28299}, {29880, 28180}, {30043, 28300}, {30063, 28301}, {30062, 28302}, {30044, 28303}, {30017, 28304}, {30035, 28312},
+    {30044, 28305}, {30006, 28306}, {29965, 28307}, {2015, 28308}, {30008, 28309}, {30044, 28310}, {30036, 28311}, {1114, 28313},
+    {30011, 28314}, {30051, 28315}, {30035, 28316}, {29956, 28317}, {30032, 28319}, {30004, 28320}, {822, 28321}, {30075, 28323},
+    {30018, 28324}, {30073, 28325}, {29985, 28326}, {29995, 28327}, {29993, 28329}, {30003, 28330}, {2724, 28331}, {2680, 28332},
+    {30024, 28333}, {29974, 28334}, {29988, 28335}, {30065, 28336}, {29986, 28337}, {29986, 28338}, {30068, 28340}, {30031, 28341},
+    {30014, 28342}, {30014, 28343}, {29985, 28344}, {29964, 28345}, {29984, 28346}, {2115, 28347}, {30037, 28348}, {29961, 28349},
+    {30009, 28350}, {30050, 28351}, {29958, 28352}, {30004, 28353}, {29993, 28354}, {30011, 28362}, {30004, 28355}, {620, 28356},
+    {30046, 28357}, {29952, 28358}, {29966, 28359}, {30043, 28360}, {29974, 28361}, {30012, 28363}, {29967, 28364}, {29965, 28365},
+    {29960, 28366}, {30045, 28367}, {29965, 28368}, {29952, 28369}, {29953, 28370}, {29957, 28371}, {29955, 28372}, {29977, 28373},
+    {30001, 28374}, {29979, 28375}, {29999, 28376}, {30027, 28377}, {29975, 28378}, {29978, 28379}, {29983, 28380}, {29979, 28381},
+    {29954, 28382}, {29992, 28383}, {29971, 28384}, {29969, 28385}, {29972, 28386}, {29967, 28387}, {29987, 28388}, {29974, 28389},
+    {29974, 28390}, {29969, 28391}, {30185, 28392}, {30186, 28393}, {30189, 28395}, {30190, 28396}, {30088, 28398}, {30131, 28399},
+    {30181, 28400}, {30181, 28401}, {30184, 28402}, {2389, 28403}, {30095, 28404}, {30159, 28405}, {30207, 28406}, {30120, 28407},
+    {30176, 28408}, {30155, 28409}, {30200, 28410}, {30200, 28411}, {30206, 28412}, {30193, 28530}, {30113, 28413}, {30201, 28414},
+    {30201, 28416}, {30196, 28415}, {30197, 28417}, {30193, 28418}, {30153, 28419}, {30154, 28420}, {30157, 28422}, {30158, 28423},
+    {30192, 28416}, {30147, 28425}, {30170, 28426}, {30086, 28427}, {30195, 28428}, {30169, 28429}, {30170, 28430}, {30128, 28431},
+    {30091, 28432}, {30172, 28433}, {30170, 28434}, {30161, 28435}, {30145, 28436}, {30185, 28437}, {30172, 28438}, {30160, 28439},
+    {30167, 28440}, {30165, 28441}, {30159, 28442}, {30179, 28443}, {30153, 28444}, {30177, 28445}, {30143, 28446}, {30202, 28447},
+    {30182, 28394}, {30178, 28397}, {30150, 28421}, {30146, 28424}, {30127, 28448}, {30123, 28449}, {30118, 28450}, {30113, 28451},
+    {30123, 28452}, {30125, 28453}, {30132, 28454}, {30119, 28455}, {30153, 28456}, {30192, 28457}, {30117, 28458}, {30117, 28459},
+    {30120, 28460}, {30196, 28461}, {30122, 28462}, {30137, 28463}, {30138, 28464}, {30140, 28465}, {30140, 28466}, {30112, 28467},
+    {30090, 28468}, {30114, 28469}, {30088, 28470}, {30124, 28471}, {30085, 28472}, {30128, 28473}, {30132, 28474}, {30131, 28475},
+    {30174, 28476}, {30181, 28477}, {30094, 28478}, {30088, 28479}, {30087, 28480}, {30093, 28481}, {30093, 28482}, {30084, 28544},
+    {30092, 28658}, {30184, 28483}, {30163, 28484}, {30084, 28485}, {30082, 28486}, {30089, 28487}, {30189, 28488}, {30095, 28544},
+    {30164, 28489}, {30081, 28490}, {30105, 28491}, {30100, 28492}, {298, 28493}, {30194, 28494}, {30153, 28495}, {30097, 28496},
+    {30081, 28497}, {30121, 28498}, {30108, 28499}, {30096, 28500}, {30103, 28501}, {30101, 28503}, {30095, 28504}, {1505, 28505},
+    {30099, 28507}, {30089, 28508}, {1648, 28509}, {0, 28510}, {30206, 28511}, {30112, 28512}, {30318, 28513}, {30267, 28514},
+    {30311, 28515}, {30317, 28516}, {30315, 28517}, {30326, 28518}, {30297, 28519}, {30323, 28520}, {30216, 28521}, {879, 28522},
+    {30217, 28523}, {30308, 28524}, {30308, 28525}, {30335, 28526}, {30290, 28527}, {30330, 28528}, {30314, 28529}, {2382, 28531},
+    {30250, 28532}, {186, 28533}, {30334, 28535}, {30310, 28536}, {2116, 28537}, {30332, 28539}, {30304, 28540}, {2669, 28541},
+    {30320, 28542}, {30328, 28543}, {30231, 28545}, {30242, 28546}, {2625, 28548}, {30317, 28549}, {30277, 28550}, {30235, 28551},
+    {2211, 28552}, {30236, 28553}, {30274, 28554}, {30320, 28555}, {30245, 28556}, {30287, 28558}, {30293, 28559}, {2750, 28560},
+    {30160, 28421}, {30164, 28424}, {30192, 28394}, {30196, 28397}, {1270, 28562}, {30294, 28563}, {30332, 28564}, {30244, 28565},
+    {30239, 28566}, {30275, 28567}, {30286, 28568}, {30275, 28569}, {30279, 28570}, {77, 28572}, {30302, 28573}, {30324, 28574},
+    {30252, 28575}, {30297, 28576}, {30321, 28577}, {30276, 28578}, {30296, 28579}, {30303, 28580}, {1125, 28582}, {30278, 28583},
+    {30316, 28584}, {30260, 28585}, {30298, 28586}, {30274, 28587}, {30312, 28588}, {30284, 28589}, {30310, 28590}, {30266, 28591},
+    {30209, 28592}, {30290, 28593}, {30292, 28594}, {30299, 28595}, {30304, 28596}, {30260, 28597}, {30260, 28598}, {30252, 28599},
+    {30252, 28600}, {715, 28602}, {30276, 28603}, {30234, 28604}, {30248, 28605}, {30333, 28606}, {30322, 28607}, {30252, 28608},
+    {30243, 28609}, {30240, 28610}, {30242, 28611}, {30248, 28612}, {30240, 28613}, {30241, 28614}, {30271, 28615}, {30242, 28616},
+    {30221, 28617}, {30247, 28618}, {30219, 28619}, {30267, 28620}, {30244, 28624}, {30256, 28632}, {30257, 28621}, {30262, 28623},
+    {30254, 28625}, {3, 28626}, {2325, 28628}, {30255, 28629}, {30211, 28630}, {30301, 28631}, {30256, 28633}, {30256, 28634},
+    {30227, 28635}, {30270, 28636}, {30230, 28637}, {30307, 28638}, {30302, 28639}, {30219, 28640}, {30223, 28641}, {30210, 28642},
+    {30215, 28643}, {30237, 28644}, {30261, 28645}, {30239, 28646}, {30259, 28647}, {30210, 28648}, {30234, 28649}, {30256, 28650},
+    {30212, 28651}, {30254, 28652}, {30236, 28653}, {30234, 28654}, {30237, 28786}, {30233, 28655}, {30225, 28656}, {30224, 28787},
+    {30229, 28672}, {30232, 28673}, {569, 28657}, {30332, 28659}, {30242, 28660}, {30224, 28661}, {30277, 28662}, {30447, 28664},
+    {30236, 28672}, {30227, 28673}, {30453, 28665}, {324, 28666}, {30454, 28667}, {30428, 28668}, {30447, 28669}, {30445, 28670},
+    {30440, 28671}, {30444, 28674}, {30459, 28675}, {30372, 28676}, {30346, 28677}, {30420, 28678}, {30434, 28679}, {30463, 28688},
+    {30441, 28696}, {30438, 28680}, {30463, 28682}, {30437, 28683}, {1294, 28684}, {30354, 28685}, {30377, 28686}, {30458, 28687},
+    {30460, 28689}, {30451, 28690}, {30457, 28691}, {30449, 28692}, {30456, 28693}, {30448, 28775}, {30450, 28694}, {30450, 28695},
+    {30366, 28698}, {30373, 28699}, {30414, 28700}, {30408, 28701}, {30451, 28693}, {30407, 28702}, {1974, 28704}, {30413, 28705},
+    {30413, 28706}, {30404, 28707}, {30412, 28753}, {30428, 28708}, {30454, 28709}, {30401, 28710}, {30403, 28711}, {30402, 28712},
+    {30402, 28714}, {30415, 28707}, {30426, 28715}, {2711, 28716}, {30406, 28717}, {30427, 28718}, {30421, 28719}, {30400, 28720},
+    {30443, 28721}, {30424, 28722}, {30441, 28723}, {30425, 28724}, {30410, 28725}, {30429, 28733}, {30418, 28726}, {1826, 28727},
+    {30396, 28728}, {30434, 28729}, {30416, 28730}, {30341, 28731}, {30383, 28732}, {30389, 28734}, {30365, 28735}, {30391, 28736},
+    {30363, 28737}, {30379, 28738}, {30377, 28739}, {30388, 28740}, {30359, 28741}, {30397, 28742}, {1160, 28743}, {30410, 28744},
+    {30356, 28745}, {30370, 28746}, {30455, 28747}, {30452, 28748}, {30378, 28749}, {30393, 28750}, {30394, 28751}, {30396, 28752},
+    {30441, 28754}, {30385, 28755}, {30396, 28756}, {30397, 28757}, {30393, 28758}, {1977, 28760}, {30380, 28761}, {30342, 28762},
+    {30426, 28763}, {571, 28764}, {30427, 28765}, {30339, 28766}, {30387, 28767}, {30436, 28768}, {1750, 28769}, {30431, 28770},
+    {30399, 28771}, {30351, 28772}, {30424, 28773}, {30435, 28774}, {30430, 28776}, {30347, 28777}, {30351, 28778}, {30338, 28779},
+    {2571, 28780}, {30440, 28781}, {30390, 28782}, {30340, 28783}, {30417, 28784}, {30339, 28785}, {30361, 28788}, {30385, 28789},
+    {30363, 28790}, {30383, 28791}, {30366, 28792}, {30342, 28793}, {30380, 28794}, {30336, 28795}, {30378, 28796}, {2271, 28797},
+    {30454, 28798}, {30376, 28799}, {30358, 28800}, {30403, 28801}, {1993, 28802}, {30458, 28803}, {30371, 28804}, {30355, 28805},
+    {30404, 28806}, {30368, 28807}, {30574, 28808}, {30579, 28816}, {30565, 28824}, {30570, 28809}, {30555, 28810}, {30571, 28811},
+    {30580, 28817}, {30560, 28825}, {30561, 28812}, {788, 28814}, {30589, 28815}, {30549, 28818}, {30475, 28819}, {30476, 28820},
+    {30519, 28821}, {30478, 28822}, {30479, 28823}, {30564, 28826}, {30590, 28827}, {986, 28828}, {30482, 28829}, {30582, 28831},
+    {30586, 28832}, {194, 28833}, {30485, 28834}, {30584, 28835}, {30401, 28719}, {30584, 28836}, {30545, 28838}, {30588, 28840},
+    {30580, 28841}, {30569, 28848}, {30587, 28856}, {30585, 28857}, {30572, 28850}, {30584, 28858}, {30532, 28859}, {2585, 28844},
+    {30587, 28845}, {30545, 28846}, {30547, 28847}, {30503, 28849}, {1894, 28851}, {30504, 28852}, {30582, 28853}, {30532, 28854},
+    {30528, 28873}, {30481, 28855}, {30486, 28860}, {30536, 28861}, {30535, 28862}, {30532, 28863}, {30558, 28864}, {30558, 28865},
+    {30539, 28873}, {30534, 28873}, {30534, 28866}, {30572, 28867}, {30528, 28868}, {30570, 28869}, {30552, 28870}, {30552, 28871},
+    {30539, 28872}, {30566, 28874}, {30542, 28875}, {2404, 28876}, {30523, 28877}, {30563, 28878}, {30547, 28879}, {30468, 28880},
+    {30527, 28881}, {30586, 28882}, {30511, 28883}, {30507, 28884}, {30502, 28885}, {30507, 28887}, {30513, 28888}, {2238, 28889},
+    {875, 28891}, {30534, 28892}, {30488, 28893}, {30502, 28894}, {30579, 28895}, {30509, 28896}, {30577, 28897}, {236, 28898},
+    {30499, 28899}, {30521, 28900}, {30481, 28901}, {30523, 28902}, {30479, 28903}, {30545, 28904}, {1285, 28905}, {30546, 28906},
+    {30569, 28907}, {30522, 28908}, {30524, 28909}, {30515, 28910}, {30573, 28911}, {30525, 28912}, {1200, 28916}, {30509, 28917},
+    {30469, 28918}, {30555, 28919}, {30515, 28921}, {30505, 28922}, {1072, 28923}, {2545, 28924}, {30523, 28926}, {30565, 28927},
+    {30483, 28929}, {30526, 28930}, {30479, 28931}, {30476, 28933}, {30480, 28934}, {484, 28935}, {30464, 28936}, {30472, 28937},
+    {30476, 28938}, {30491, 28939}, {30470, 28940}, {1392, 28941}, {30570, 28942}, {30545, 28943}, {30473, 28944}, {30468, 28945},
+    {30469, 28946}, {30465, 28947}, {30538, 28948}, {30484, 28949}, {30491, 28950}, {30488, 28951}, {30490, 28952}, {2683, 28954},
+    {30480, 28955}, {30488, 28956}, {1073, 28958}, {30467, 28959}, {30503, 28960}, {30585, 28961}, {30495, 28962}, {30485, 28963},
+    {30489, 28964}, {30483, 28965}, {30485, 28966}, {30476, 28967}, {30703, 28968}, {30692, 28969}, {30700, 28970}, {30649, 28971},
+    {30689, 28972}, {30700, 28973}, {30701, 28974}, {30697, 28975}, {30695, 28977}, {30717, 28978}, {2423, 28979}, {30691, 28980},
+    {30688, 28981}, {30708, 28982}, {30605, 28983}, {30644, 28984}, {30689, 28985}, {30718, 28986}, {730, 28989}, {30694, 28990},
+    {30668, 28991}, {30612, 28992}, {836, 28993}, {30613, 28994}, {30614, 28995}, {30637, 28996}, {30711, 28997}, {30707, 28998},
+    {30718, 28999}, {30706, 29000}, {30706, 29001}, {30701, 29002}, {30656, 29003}, {30676, 29004}, {30619, 29005}, {30663, 29006},
+    {30662, 29007}, {30666, 29008}, {30629, 29009}, {30620, 29010}, {30665, 29011}, {30657, 29012}, {30668, 29013}, {30661, 29015},
+    {30687, 29016}, {2258, 29017}, {30614, 29018}, {30664, 29019}, {30663, 29020}, {30660, 29021}, {30686, 29022}, {30603, 29023},
+    {30679, 29024}, {30682, 29025}, {30687, 29026}, {30683, 29027}, {30681, 29028}, {30659, 29029}, {30695, 29030}, {30669, 29031},
+    {30693, 29032}, {30676, 29033}, {30664, 29034}, {30690, 29035}, {30666, 29036}, {30688, 29037}, {30638, 29038}, {30638, 29039},
+    {30712, 29041}, {30630, 29042}, {30625, 29043}, {30635, 29044}, {30637, 29045}, {30644, 29046}, {30631, 29047}, {30614, 29048},
+    {30628, 29049}, {30649, 29056}, {30635, 29064}, {30628, 29050}, {30624, 29051}, {30624, 29052}, {30627, 29053}, {30606, 29054},
+    {30630, 29055}, {30653, 29057}, {30653, 29058}, {30652, 29169}, {804, 29061}, {30636, 29062}, {30598, 29063}, {30682, 29065},
+    {30644, 29059}, {30689, 29066}, {30649, 29067}, {30642, 29069}, {30634, 29070}, {1491, 29071}, {30640, 29072}, {30612, 29073},
+    {30655, 29059}, {30654, 29074}, {30614, 29075}, {30652, 29076}, {30692, 29077}, {30687, 29078}, {30601, 29080}, {30611, 29081},
+    {1110, 29082}, {30599, 29083}, {30621, 29084}, {30645, 29085}, {30623, 29086}, {30643, 29087}, {30600, 29088}, {30592, 29089},
+    {30596, 29090}, {30595, 29091}, {30622, 29092}, {30664, 29093}, {30614, 29094}, {30592, 29095}, {30634, 29096}, {30621, 29097},
+    {30623, 29098}, {30614, 29099}, {30615, 29100}, {30719, 28982}, {30611, 29101}, {30618, 29102}, {30614, 29148}, {30608, 29103},
+    {30608, 29104}, {30835, 29105}, {30814, 29106}, {30838, 29107}, {30829, 29108}, {30613, 29102}, {30827, 29109}, {30783, 29111},
+    {30819, 29112}, {30830, 29113}, {30819, 29114}, {30823, 29115}, {30730, 29116}, {30769, 29117}, {30818, 29118}, {30820, 29119},
+    {30827, 29120}, {30817, 29121}, {30847, 29122}, {2766, 29125}, {30821, 29126}, {30797, 29127}, {30739, 29128}, {2525, 29130},
+    {30816, 29131}, {30794, 29132}, {30742, 29133}, {30834, 29134}, {30838, 29135}, {30839, 29136}, {30837, 29137}, {30837, 29139},
+    {30835, 29140}, {30834, 29143}, {30826, 29144}, {196, 29145}, {30833, 29146}, {30799, 29147}, {30747, 29150}, {30791, 29151},
+    {30794, 29152}, {30799, 29153}, {30795, 29154}, {30748, 29155}, {30786, 29156}, {30785, 29157}, {30786, 29158}, {30788, 29159},
+    {30789, 29160}, {30787, 29161}, {30787, 29163}, {30785, 29164}, {30785, 29166}, {30815, 29167}, {30786, 29168}, {30829, 29170},
+    {30791, 29171}, {30784, 29172}, {30826, 29173}, {30813, 29174}, {30815, 29175}, {30806, 29176}, {209, 29177}, {30777, 29178},
+    {471, 29180}, {30720, 29181}, {30814, 29182}, {1688, 29184}, {30792, 29185}, {30818, 29186}, {30782, 29187}, {30801, 29188},
+    {30767, 29189}, {30785, 29191}, {970, 29192}, {30786, 29193}, {30841, 29194}, {30753, 29195}, {30763, 29196}, {30761, 29197},
+    {2756, 29200}, {30771, 29201}, {30743, 29202}, {30793, 29203}, {30767, 29204}, {30757, 29205}, {30796, 29206}, {1499, 29207},
+    {30760, 29208}, {30752, 29209}, {30756, 29210}, {30755, 29211}, {30782, 29212}, {240, 29214}, {30758, 29215}, {30732, 29216},
+    {30804, 29217}, {30753, 29218}, {30729, 29219}, {30780, 29220}, {30768, 29221}, {30775, 29222}, {2499, 29224}, {30766, 29225},
+    {30724, 29226}, {30812, 29227}, {30770, 29228}, {30762, 29229}, {30720, 29230}, {30740, 29231}, {30782, 29232}, {30818, 29233},
+    {30809, 29234}, {30730, 29235}, {30732, 29236}, {30723, 29237}, {30729, 29238}, {30727, 29239}, {30746, 29240}, {30773, 29241},
+    {30751, 29242}, {30828, 29243}, {30807, 29244}, {30720, 29245}, {30726, 29246}, {30741, 29247}, {30750, 29248}, {30726, 29249},
+    {30764, 29250}, {30720, 29251}, {30762, 29252}, {30745, 29253}, {30723, 29254}, {30759, 29255}, {30733, 29256}, {30757, 29257},
+    {30741, 29258}, {30741, 29259}, {30748, 29312}, {30740, 29426}, {30958, 29260}, {30952, 29261}, {30947, 29313}, {30959, 29427},
+    {740, 29262}, {30853, 29263}, {30743, 29312}, {30937, 29264}, {30953, 29265}, {30898, 29266}, {30954, 29313}, {1823, 29268},
+    {30973, 29269}, {30933, 29270}, {30859, 29271}, {30951, 29272}, {30974, 29273}, {30883, 29274}, {30928, 29275}, {30974, 29276},
+    {30947, 29280}, {30965, 29288}, {30970, 29277}, {30868, 29278}, {30895, 29279}, {30968, 29281}, {30974, 29282}, {30973, 29283},
+    {30967, 29284}, {30963, 29285}, {30970, 29314}, {30966, 29424}, {30960, 29286}, {30966, 29287}, {30913, 29315}, {30921, 29425},
+    {30922, 29289}, {30927, 29290}, {30965, 29314}, {30913, 29291}, {30932, 29292}, {30967, 29293}, {30920, 29315}, {30916, 29294},
+    {2340, 29295}, {30890, 29296}, {30964, 29297}, {30914, 29298}, {30868, 29299}, {30912, 29300}, {30916, 29301}, {30958, 29302},
+    {30918, 29303}, {30956, 29304}, {30938, 29305}, {30938, 29306}, {30917, 29307}, {30952, 29308}, {30924, 29309}, {1862, 29310},
+    {30905, 29311}, {30949, 29316}, {30933, 29317}, {30854, 29318}, {30855, 29319}, {30939, 29320}, {30934, 29321}, {30891, 29322},
+    {30895, 29323}, {908, 29324}, {30914, 29325}, {30876, 29326}, {30890, 29327}, {30975, 29328}, {30918, 29329}, {30973, 29330},
+    {30886, 29331}, {30880, 29332}, {30895, 29333}, {30885, 29334}, {30883, 29335}, {30910, 29336}, {30865, 29337}, {30907, 29338},
+    {30911, 29339}, {30933, 29291}, {30885, 29340}, {30861, 29341}, {30887, 29342}, {30859, 29343}, {200, 29344}, {30933, 29345},
+    {30857, 29346}, {30905, 29347}, {30946, 29348}, {30854, 29349}, {30900, 29350}, {30889, 29351}, {30907, 29359}, {30900, 29352},
+    {96, 29353}, {30942, 29354}, {30848, 29355}, {30862, 29356}, {30939, 29357}, {1454, 29358}, {30946, 29360}, {30908, 29361},
+    {30858, 29362}, {30943, 29363}, {2630, 29365}, {30950, 29366}, {30941, 29367}, {30855, 29368}, {30877, 29369}, {30901, 29370},
+    {30879, 29371}, {30899, 29372}, {30851, 29373}, {30849, 29374}, {30849, 29376}, {30879, 29377}, {1707, 29380}, {30853, 29381},
+    {30893, 29382}, {30963, 29383}, {30854, 29384}, {30864, 29385}, {30872, 29386}, {30876, 29387}, {30859, 29388}, {30870, 29389},
+    {698, 29390}, {192, 29392}, {30879, 29393}, {30869, 29394}, {30870, 29395}, {30861, 29396}, {30864, 29397}, {31091, 29398},
+    {30977, 29400}, {31084, 29402}, {31084, 29403}, {31082, 29405}, {31082, 29406}, {31036, 29408}, {31074, 29409}, {153, 29410},
+    {30984, 29411}, {31078, 29413}, {31102, 29414}, {2406, 29415}, {2232, 29417}, {31103, 29418}, {31059, 29419}, {30989, 29420},
+    {31072, 29421}, {31072, 29422}, {31103, 29429}, {31077, 29430}, {2111, 29431}, {30994, 29432}, {31017, 29433}, {31098, 29434},
+    {31100, 29435}, {31091, 29436}, {31096, 29438}, {31084, 29439}, {2713, 29440}, {31094, 29441}, {31086, 29442}, {31044, 29443},
+    {31080, 29444}, {31042, 29445}, {31089, 29447}, {31083, 29448}, {672, 29449}, {31054, 29450}, {31054, 29451}, {31057, 29452},
+    {31100, 29453}, {31056, 29454}, {1800, 29455}, {31013, 29456}, {31097, 29457}, {31049, 29458}, {30994, 29459}, {31066, 29460},
+    {31093, 29461}, {31046, 29462}, {31049, 29463}, {31043, 29464}, {1209, 29466}, {31066, 29467}, {31088, 29468}, {31024, 29469},
+    {31025, 29470}, {30984, 29471}, {31069, 29472}, {31069, 29473}, {31056, 29474}, {30988, 29475}, {31058, 29476}, {31069, 29477},
+    {31063, 29478}, {31057, 29479}, {31048, 29480}, {31059, 29481}, {31049, 29482}, {31073, 29483}, {31060, 29484}, {31016, 29485},
+    {31023, 29486}, {31020, 29487}, {31020, 29488}, {31019, 29491}, {31025, 29492}, {2704, 29493}, {31011, 29494}, {31017, 29495},
+    {31011, 29496}, {31034, 29497}, {31013, 29498}, {609, 29499}, {31051, 29500}, {30995, 29501}, {31011, 29502}, {31092, 29503},
+    {31009, 29504}, {31039, 29505}, {31010, 29506}, {30989, 29507}, {31015, 29508}, {31034, 29509}, {31034, 29510}, {31013, 29511},
+    {30984, 29512}, {31020, 29513}, {30982, 29514}, {31028, 29515}, {31017, 29520}, {31035, 29528}, {31028, 29516}, {30977, 29517},
+    {31025, 29518}, {30994, 29521}, {30982, 29529}, {30987, 29519}, {895, 29523}, {30999, 29524}, {31035, 29525}, {31077, 29526},
+    {30984, 29527}, {30984, 29530}, {30983, 29532}, {31005, 29533}, {31029, 29534}, {31007, 29535}, {31027, 29536}, {30980, 29537},
+    {30981, 29538}, {30996, 29539}, {2064, 29540}, {30981, 29541}, {31021, 29542}, {31000, 29543}, {31004, 29544}, {31003, 29545},
+    {31000, 29546}, {31000, 29547}, {2348, 29549}, {31097, 29550}, {31013, 29551}, {30997, 29552}, {31046, 29553}, {31010, 29554},
+    {30992, 29555}, {30989, 29556}, {31207, 29564}, {31208, 29557}, {31207, 29558}, {31213, 29559}, {2638, 29560}, {31108, 29561},
+    {31194, 29562}, {31208, 29563}, {31165, 29565}, {31191, 29567}, {31207, 29568}, {31224, 29569}, {31212, 29577}, {31205, 29570},
+    {31202, 29571}, {31226, 29572}, {31184, 29573}, {31204, 29574}, {31182, 29575}, {31228, 29576}, {31228, 29578}, {31226, 29580},
+    {31228, 29581}, {31223, 29582}, {31219, 29692}, {31218, 29583}, {31209, 29584}, {31158, 29585}, {31208, 29586}, {31170, 29587},
+    {31221, 29588}, {31230, 29582}, {31223, 29589}, {31182, 29590}, {1765, 29592}, {31189, 29593}, {31229, 29594}, {31139, 29595},
+    {31178, 29596}, {31178, 29597}, {31189, 29598}, {31224, 29599}, {31196, 29600}, {31180, 29601}, {31172, 29602}, {31168, 29603},
+    {31199, 29604}, {31170, 29605}, {2732, 29607}, {31194, 29608}, {31216, 29609}, {31152, 29610}, {31153, 29611}, {31112, 29612},
+    {31197, 29613}, {31197, 29614}, {31184, 29615}, {31158, 29616}, {31117, 29617}, {31190, 29618}, {31184, 29619}, {31199, 29620},
+    {31188, 29622}, {31176, 29623}, {914, 29624}, {755, 29626}, {31177, 29627}, {31201, 29628}, {31167, 29629}, {1984, 29631},
+    {31156, 29632}, {31134, 29633}, {31170, 29634}, {1134, 29635}, {31171, 29636}, {31131, 29637}, {31147, 29638}, {31228, 29639},
+    {1821, 29641}, {31155, 29642}, {31127, 29643}, {31177, 29644}, {31140, 29645}, {31140, 29646}, {31167, 29647}, {31122, 29648},
+    {31162, 29649}, {31137, 29650}, {31167, 29651}, {31138, 29652}, {31117, 29653}, {31143, 29654}, {507, 29656}, {31136, 29657},
+    {31114, 29658}, {31190, 29659}, {1429, 29661}, {31004, 29539}, {31139, 29662}, {31111, 29663}, {31193, 29664}, {31150, 29665},
+    {31108, 29666}, {31159, 29667}, {31157, 29668}, {31152, 29669}, {31147, 29670}, {31167, 29671}, {31114, 29672}, {31114, 29673},
+    {31117, 29674}, {31115, 29676}, {31121, 29677}, {633, 29678}, {1601, 29679}, {31206, 29680}, {1693, 29681}, {1130, 29682},
+    {31112, 29683}, {31110, 29684}, {2631, 29686}, {31184, 29687}, {31118, 29688}, {1104, 29690}, {31113, 29691}, {31107, 29693},
+    {31133, 29694}, {31189, 29695}, {31125, 29696}, {31130, 29697}, {31130, 29698}, {31130, 29699}, {31135, 29700}, {31133, 29701},
+    {31135, 29702}, {31109, 29712}, {31135, 29720}, {31133, 29721}, {31113, 29704}, {31140, 29705}, {31121, 29706}, {806, 29707},
+    {2649, 29709}, {31113, 29710}, {31137, 29711}, {31231, 29713}, {31232, 29714}, {31291, 29715}, {31340, 29716}, {31338, 29717},
+    {31329, 29718}, {31339, 29719}, {31337, 29722}, {31348, 29723}, {31319, 29724}, {31357, 29725}, {31343, 29726}, {31333, 29727},
+    {31335, 29728}, {31358, 29729}, {31329, 29730}, {1455, 29732}, {31355, 29733}, {31311, 29734}, {31249, 29735}, {1478, 29736},
+    {31250, 29737}, {31308, 29738}, {31354, 29739}, {31279, 29740}, {31352, 29741}, {31352, 29742}, {1233, 29745}, {31340, 29746},
+    {31302, 29747}, {31258, 29748}, {31265, 29749}, {31260, 29750}, {31347, 29752}, {31345, 29753}, {31340, 29754}, {31359, 29755},
+    {31317, 29756}, {1989, 29757}, {1967, 29759}, {31266, 29760}, {31356, 29761}, {31306, 29762}, {31263, 29763}, {31270, 29764},
+    {31261, 29765}, {31303, 29767}, {31325, 29768}, {2278, 29769}, {31300, 29770}, {31300, 29771}, {31317, 29774}, {31277, 29775},
+    {31301, 29776}, {31324, 29777}, {31261, 29778}, {31327, 29779}, {31325, 29780}, {31241, 29782}, {31313, 29783}, {31324, 29784},
+    {31325, 29785}, {31321, 29786}, {1567, 29788}, {31288, 29789}, {31235, 29790}, {31316, 29791}, {31314, 29792}, {31321, 29793},
+    {31293, 29794}, {31236, 29795}, {31313, 29796}, {31273, 29797}, {31268, 29798}, {31353, 29800}, {31265, 29801}, {31274, 29803},
+    {31282, 29804}, {1641, 29805}, {31357, 29806}, {31277, 29807}, {31347, 29808}, {31279, 29809}, {31266, 29810}, {31271, 29811},
+    {31267, 29812}, {31348, 29813}, {31274, 29814}, {31312, 29815}, {31339, 29816}, {31292, 29817}, {31290, 29818}, {31281, 29819},
+    {31291, 29820}, {31289, 29821}, {31289, 29823}, {31281, 29824}, {31280, 29939}, {2234, 29826}, {31324, 29827}, {31288, 29828},
+    {31288, 29825}, {31280, 29829}, {31280, 29831}, {31252, 29832}, {321, 29833}, {1585, 29835}, {2175, 29836}, {31329, 29837},
+    {31283, 29825}, {31293, 29838}, {31245, 29839}, {31326, 29840}, {31232, 29841}, {31240, 29842}, {31244, 29843}, {31259, 29844},
+    {31238, 29845}, {31338, 29846}, {31313, 29847}, {31318, 29848}, {31240, 29849}, {1303, 29850}, {31342, 29851}, {31280, 29852},
+    {31262, 29853}, {31307, 29854}, {31260, 29855}, {31260, 29856}, {31348, 29858}, {31311, 29859}, {31256, 29860}, {31262, 29861},
+    {31261, 29862}, {31353, 29863}, {31296, 29864}, {31253, 29865}, {31253, 29866}, {31256, 29867}, {31248, 29868}, {31248, 29869},
+    {31475, 29870}, {31454, 29871}, {31478, 29872}, {31469, 29873}, {31467, 29874}, {31478, 29875}, {31449, 29876}, {31475, 29877},
+    {31469, 29878}, {31463, 29879}, {31370, 29880}, {31409, 29881}, {31414, 29882}, {31464, 29883}, {31463, 29884}, {31460, 29885},
+    {31486, 29886}, {31461, 29887}, {31437, 29888}, {31480, 29889}, {31484, 29890}, {31483, 29891}, {31475, 29892}, {31481, 29893},
+    {31475, 29894}, {31466, 29895}, {31477, 29896}, {31428, 29897}, {31474, 29898}, {31471, 29904}, {31481, 29912}, {31478, 29899},
+    {31439, 29901}, {31445, 29902}, {2385, 29903}, {31394, 29905}, {31385, 29906}, {31434, 29907}, {31434, 29908}, {31432, 29910},
+    {31432, 29911}, {31451, 29913}, {31478, 29914}, {31454, 29915}, {1647, 29916}, {31403, 29917}, {31426, 29918}, {31426, 29919},
+    {31424, 29921}, {31424, 29922}, {31427, 29923}, {31470, 29924}, {31430, 29925}, {31369, 29926}, {31441, 29927}, {31452, 29928},
+    {31453, 29929}, {31449, 29930}, {31416, 29931}, {31363, 29932}, {31445, 29933}, {31439, 29934}, {31459, 29935}, {31433, 29936},
+    {31457, 29937}, {31456, 29938}, {31406, 29940}, {31411, 29941}, {31397, 29949}, {31402, 29942}, {31393, 29943}, {31403, 29944},
+    {31405, 29945}, {31412, 29946}, {31399, 29947}, {31404, 29948}, {31396, 29950}, {31435, 29951}, {31478, 29952}, {31395, 29953},
+    {31399, 29954}, {31402, 29955}, {1144, 29956}, {31440, 29957}, {31374, 29958}, {31420, 29959}, {31465, 29960}, {31409, 29961},
+    {31419, 29962}, {31417, 29964}, {31395, 29965}, {1768, 29966}, {31415, 29968}, {31405, 29969}, {110, 29970}, {31456, 29971},
+    {31422, 29972}, {31417, 29973}, {31411, 29974}, {31419, 29975}, {31409, 29976}, {31374, 29977}, {31374, 29978}, {31367, 29980},
+    {31373, 29981}, {31460, 29982}, {31455, 29983}, {31368, 29984}, {31374, 29985}, {31373, 29986}, {31465, 29987}, {31440, 29988},
+    {31365, 29989}, {31365, 29990}, {31368, 29991}, {31371, 29992}, {31361, 29993}, {31381, 29994}, {31391, 29995}, {31383, 29996},
+    {31389, 29997}, {31391, 29998}, {31366, 29999}, {31385, 30000}, {31384, 30001}, {31372, 30002}, {31398, 30003}, {31374, 30004},
+    {31396, 30005}, {1979, 30007}, {31484, 30009}, {31431, 30010}, {31377, 30012}, {31371, 30013}, {1839, 30014}, {31589, 30015},
+    {31599, 30016}, {1378, 30017}, {1981, 30019}, {31490, 30020}, {31545, 30021}, {31585, 30022}, {31595, 30023}, {31593, 30025},
+    {31603, 30026}, {799, 30027}, {31538, 30028}, {31596, 30029}, {1962, 30030}, {31536, 30032}, {31598, 30033}, {31589, 30034},
+    {31590, 30035}, {31584, 30036}, {31584, 30038}, {31588, 30039}, {144, 30040}, {31614, 30041}, {31590, 30042}, {31564, 30043},
+    {31584, 30044}, {31562, 30045}, {31609, 30047}, {31587, 30048}, {575, 30049}, {31606, 30050}, {31606, 30051}, {31593, 30052},
+    {31556, 30053}, {31592, 30054}, {22, 30055}, {31517, 30056}, {31553, 30057}, {31601, 30058}, {31514, 30059}, {31556, 30060},
+    {31564, 30061}, {31560, 30062}, {31575, 30063}, {31562, 30064}, {1489, 30065}, {31526, 30066}, {31608, 30067}, {31558, 30068},
+    {31507, 30069}, {31556, 30070}, {31556, 30071}, {31583, 30072}, {31602, 30073}, {31578, 30074}, {31553, 30075}, {31583, 30076},
+    {31554, 30077}, {31597, 30078}, {31559, 30079}, {31595, 30080}, {31579, 30081}, {31556, 30082}, {31568, 30090}, {31569, 30083},
+    {31590, 30084}, {31572, 30085}, {31561, 30086}, {31579, 30094}, {31572, 30087}, {1349, 30089}, {31562, 30091}, {31584, 30092},
+    {31552, 30093}, {31534, 30096}, {31542, 30097}, {2379, 30098}, {31530, 30099}, {31535, 30100}, {31521, 30101}, {31539, 30102},
+    {31511, 30103}, {31522, 30104}, {31522, 30105}, {31525, 30106}, {1830, 30107}, {31564, 30108}, {31505, 30109}, {31521, 30110},
+    {31594, 30111}, {31502, 30112}, {31548, 30113}, {31521, 30114}, {31539, 30122}, {31548, 30115}, {31497, 30116}, {31545, 30117},
+    {31530, 30118}, {31550, 30126}, {31539, 30119}, {31541, 30120}, {31541, 30121}, {31548, 30123}, {31540, 30169}, {31499, 30124},
+    {31506, 30125}, {31661, 30127}, {1583, 30129}, {31510, 30130}, {31548, 30131}, {31543, 30123}, {31588, 30132}, {31499, 30133},
+    {31497, 30134}, {31508, 30135}, {31543, 30136}, {31517, 30137}, {31503, 30138}, {31493, 30139}, {31495, 30140}, {31518, 30141},
+    {31489, 30142}, {1756, 30144}, {31515, 30145}, {31535, 30146}, {31601, 30147}, {31602, 30148}, {31561, 30149}, {31514, 30150},
+    {31516, 30151}, {31507, 30152}, {2432, 30154}, {31491, 30155}, {31527, 30156}, {31609, 30157}, {2101, 30158}, {31610, 30159},
+    {31524, 30160}, {31506, 30161}, {31559, 30162}, {31515, 30163}, {31505, 30164}, {31722, 30165}, {31729, 30166}, {31724, 30167},
+    {31722, 30168}, {31722, 30170}, {31733, 30171}, {31704, 30172}, {31740, 30173}, {1970, 30175}, {31741, 30176}, {31701, 30177},
+    {31627, 30178}, {31736, 30179}, {31698, 30180}, {31717, 30181}, {31719, 30182}, {31742, 30183}, {2621, 30185}, {31717, 30186},
+    {31693, 30187}, {31635, 30188}, {463, 30190}, {31712, 30191}, {31690, 30192}, {31638, 30193}, {646, 30195}, {31639, 30196},
+    {31734, 30197}, {31734, 30198}, {31721, 30199}, {31684, 30200}, {31720, 30201}, {31736, 30202}, {31728, 30203}, {31738, 30204},
+    {31694, 30205}, {31694, 30207}, {31702, 30208}, {1318, 30209}, {31740, 30210}, {31646, 30211}, {31680, 30212}, {31695, 30213},
+    {31692, 30214}, {31686, 30215}, {31635, 30218}, {31695, 30219}, {31541, 30101}, {31682, 30220}, {31687, 30221}, {31683, 30222},
+    {31636, 30223}, {2727, 30224}, {31690, 30225}, {31710, 30226}, {31700, 30227}, {31708, 30228}, {31667, 30229}, {31630, 30230},
+    {1495, 30232}, {31707, 30233}, {31705, 30234}, {31704, 30237}, {31692, 30238}, {2637, 30239}, {31708, 30240}, {31700, 30241},
+    {31701, 30242}, {31699, 30243}, {2808, 30245}, {31677, 30246}, {31713, 30247}, {31697, 30248}, {31738, 30249}, {31663, 30250},
+    {31661, 30251}, {31661, 30253}, {31659, 30254}, {31670, 30255}, {31641, 30256}, {31667, 30257}, {31654, 30258}, {31654, 30259},
+    {31663, 30261}, {31653, 30262}, {31655, 30263}, {31678, 30264}, {31649, 30265}, {2395, 30267}, {31675, 30268}, {31631, 30269},
+    {31697, 30270}, {31673, 30271}, {31648, 30272}, {31789, 30273}, {31726, 30274}, {31664, 30275}, {31673, 30277}, {31651, 30278},
+    {1533, 30279}, {2598, 30280}, {31704, 30281}, {31622, 30282}, {31668, 30283}, {31713, 30284}, {31708, 30285}, {31719, 30286},
+    {31716, 30287}, {31674, 30288}, {31625, 30289}, {31626, 30290}, {31628, 30291}, {31628, 30292}, {31632, 30293}, {31674, 30294},
+    {31634, 30295}, {31672, 30296}, {31629, 30297}, {31623, 30298}, {31620, 30299}, {31620, 30300}, {31702, 30302}, {31624, 30303},
+    {31623, 30304}, {31620, 30305}, {31646, 30306}, {1141, 30308}, {31621, 30309}, {31660, 30310}, {31732, 30311}, {31632, 30312},
+    {31640, 30313}, {31644, 30314}, {31627, 30315}, {31638, 30316}, {31647, 30317}, {31637, 30318}, {31639, 30319}, {31630, 30320},
+    {31633, 30321}, {31627, 30322}, {31838, 30323}, {31849, 30324}, {31851, 30325}, {31850, 30326}, {31857, 30327}, {31833, 30328},
+    {31852, 30329}, {31840, 30330}, {31847, 30331}, {31845, 30333}, {31871, 30334}, {945, 30335}, {31849, 30336}, {31843, 30337},
+    {31840, 30338}, {31840, 30339}, {31843, 30340}, {31822, 30341}, {31846, 30342}, {31869, 30343}, {31869, 30344}, {31868, 30459},
+    {31860, 30345}, {31863, 30347}, {31853, 30348}, {31813, 30349}, {31855, 30350}, {31811, 30351}, {31864, 30352}, {31856, 30353},
+    {31871, 30345}, {2532, 30355}, {31851, 30356}, {31871, 30357}, {31777, 30358}, {31830, 30359}, {31868, 30360}, {31823, 30361},
+    {31821, 30362}, {31816, 30363}, {31773, 30364}, {31821, 30365}, {241, 30367}, {31837, 30368}, {31861, 30369}, {31787, 30370},
+    {31832, 30371}, {31858, 30372}, {31813, 30373}, {31815, 30374}, {31838, 30375}, {31839, 30376}, {31837, 30377}, {31808, 30378},
+    {31851, 30379}, {31809, 30380}, {31827, 30381}, {31833, 30382}, {31847, 30383}, {31831, 30384}, {31816, 30385}, {31836, 30393},
+    {31829, 30386}, {31828, 30387}, {31829, 30388}, {31780, 30389}, {31790, 30390}, {31798, 30391}, {31772, 30392}, {31792, 30394},
+    {31770, 30395}, {31785, 30397}, {31795, 30398}, {907, 30399}, {31788, 30400}, {31780, 30401}, {31776, 30402}, {31807, 30403},
+    {31778, 30404}, {31860, 30405}, {31786, 30406}, {31801, 30407}, {31802, 30408}, {31804, 30409}, {31804, 30411}, {31776, 30412},
+    {809, 30413}, {1005, 30414}, {31829, 30415}, {31753, 30416}, {31801, 30417}, {31842, 30418}, {2354, 30419}, {31833, 30420},
+    {31749, 30421}, {31797, 30422}, {31846, 30423}, {31795, 30424}, {31793, 30425}, {31792, 30428}, {31764, 30429}, {184, 30430},
+    {31758, 30432}, {31766, 30433}, {2641, 30434}, {1637, 30436}, {31767, 30437}, {31803, 30438}, {31845, 30439}, {31753, 30441},
+    {31763, 30442}, {2483, 30443}, {31757, 30444}, {31751, 30445}, {31745, 30446}, {31768, 30447}, {31747, 30448}, {31752, 30449},
+    {31744, 30450}, {31748, 30451}, {31747, 30452}, {31774, 30453}, {31772, 30455}, {31744, 30456}, {2712, 30457}, {31770, 30460},
+    {31746, 30461}, {2210, 30462}, {31768, 30463}, {31756, 30464}, {31782, 30465}, {31758, 30466}, {31780, 30467}, {31763, 30468},
+    {31753, 30469}, {31777, 30470}, {31755, 30471}, {31967, 30472}, {31983, 30473}, {31981, 30474}, {1701, 30477}, {31981, 30480},
+    {31934, 30481}, {31820, 30389}, {31877, 30483}, {31932, 30484}, {31933, 30486}, {31981, 30487}, {31973, 30488}, {31882, 30489},
+    {31921, 30490}, {31955, 30491}, {31993, 30492}, {31995, 30493}, {31952, 30494}, {31972, 30495}, {31972, 30496}, {31993, 30497},
+    {31995, 30498}, {31997, 30499}, {31998, 30500}, {31973, 30501}, {31930, 30502}, {31991, 30505}, {31981, 30506}, {654, 30507},
+    {1672, 30508}, {31898, 30509}, {31940, 30510}, {31986, 30511}, {31911, 30512}, {31995, 30513}, {31985, 30514}, {31947, 30515},
+    {31954, 30516}, {31949, 30517}, {31897, 30518}, {31937, 30519}, {31948, 30520}, {31949, 30521}, {31945, 30522}, {31943, 30524},
+    {31965, 30525}, {953, 30526}, {32, 30528}, {31966, 30529}, {31988, 30530}, {31916, 30531}, {31944, 30532}, {31936, 30533},
+    {31936, 30535}, {31940, 30536}, {783, 30537}, {31921, 30538}, {2454, 30539}, {31959, 30540}, {31965, 30541}, {31967, 30542},
+    {31942, 30543}, {31961, 30544}, {338, 30547}, {31939, 30548}, {31975, 30549}, {31929, 30550}, {2202, 30551}, {31930, 30552},
+    {31957, 30553}, {31955, 30554}, {31960, 30556}, {31952, 30557}, {31962, 30558}, {1511, 30559}, {31913, 30560}, {31914, 30561},
+    {31910, 30562}, {31905, 30563}, {31915, 30564}, {31942, 30565}, {31997, 30566}, {31910, 30567}, {31904, 30568}, {31918, 30569},
+    {892, 30571}, {31948, 30572}, {31890, 30573}, {31904, 30574}, {31989, 30575}, {1187, 30576}, {31952, 30577}, {31886, 30578},
+    {31932, 30579}, {31977, 30580}, {31920, 30562}, {31956, 30581}, {31983, 30582}, {31928, 30583}, {31928, 30584}, {31960, 30586},
+    {31971, 30587}, {31962, 30588}, {31969, 30589}, {31922, 30590}, {31924, 30591}, {31931, 30592}, {31967, 30593}, {31962, 30594},
+    {405, 30595}, {31969, 30596}, {31933, 30597}, {31885, 30598}, {31966, 30599}, {31875, 30600}, {31881, 30601}, {31927, 30602},
+    {31879, 30603}, {31896, 30608}, {31884, 30616}, {31877, 30604}, {1240, 30606}, {31959, 30607}, {31883, 30609}, {31873, 30610},
+    {31903, 30611}, {1311, 30615}, {31877, 30617}, {31917, 30618}, {31987, 30619}, {31950, 30620}, {31888, 30621}, {31903, 30622},
+    {31900, 30623}, {31894, 30624}, {1674, 30625}, {31993, 30626}, {31994, 30627}, {31937, 30628}, {58, 30630}, {31880, 30631},
+    {31906, 30632}, {31998, 30633}, {31898, 30634}, {32110, 30635}, {909, 30636}, {32001, 30637}, {32093, 30638}, {32109, 30639},
+    {32062, 30640}, {1764, 30641}, {32005, 30642}, {32089, 30643}, {32105, 30644}, {32050, 30645}, {32108, 30646}, {32100, 30647},
+    {32096, 30648}, {32127, 30649}, {32098, 30650}, {32107, 30651}, {32097, 30652}, {32123, 30653}, {32098, 30654}, {32125, 30655},
+    {32041, 30656}, {32113, 30657}, {745, 30658}, {32021, 30659}, {32022, 30660}, {32045, 30661}, {32118, 30662}, {32112, 30663},
+    {32127, 30664}, {32116, 30665}, {32104, 30666}, {32066, 30667}, {32106, 30668}, {32064, 30669}, {32026, 30670}, {32068, 30671},
+    {32075, 30672}, {32072, 30673}, {32074, 30674}, {32081, 30675}, {32121, 30676}, {32076, 30677}, {32064, 30678}, {32071, 30679},
+    {32068, 30680}, {32068, 30681}, {137, 30683}, {32044, 30684}, {32072, 30685}, {32064, 30686}, {32074, 30687}, {32094, 30688},
+    {32090, 30689}, {32065, 30690}, {32092, 30691}, {2075, 30693}, {32081, 30694}, {32091, 30695}, {32083, 30696}, {32089, 30697},
+    {32083, 30698}, {32074, 30699}, {32085, 30700}, {32059, 30701}, {32006, 30702}, {32083, 30703}, {32087, 30704}, {32090, 30705},
+    {2365, 30706}, {32064, 30707}, {32047, 30708}, {32045, 30709}, {32048, 30710}, {32027, 30711}, {32049, 30712}, {32050, 30713},
+    {32024, 30714}, {32035, 30715}, {32033, 30716}, {32036, 30717}, {32113, 30718}, {32041, 30719}, {32036, 30720}, {32037, 30721},
+    {32033, 30722}, {32106, 30723}, {32052, 30724}, {1070, 30725}, {32082, 30726}, {32012, 30727}, {32058, 30728}, {32111, 30729},
+    {442, 30731}, {32034, 30732}, {32008, 30733}, {32088, 30734}, {32099, 30735}, {32063, 30736}, {32053, 30737}, {32051, 30738},
+    {32051, 30740}, {32049, 30741}, {32095, 30743}, {32090, 30744}, {32091, 30745}, {32007, 30746}, {32089, 30747}, {32001, 30748},
+    {32000, 30749}, {32008, 30750}, {32093, 30751}, {32013, 30752}, {313, 30753}, {32105, 30754}, {32053, 30755}, {32005, 30756},
+    {32086, 30757}, {1711, 30758}, {32109, 30759}, {32049, 30760}, {32001, 30761}, {32074, 30762}, {32075, 30763}, {32023, 30764},
+    {32073, 30765}, {32017, 30766}, {32079, 30767}, {32019, 30768}, {32030, 30769}, {32019, 30770}, {32023, 30771}, {32020, 30772},
+    {32020, 30773}, {32015, 30774}, {32034, 30775}, {32010, 30776}, {1757, 30778}, {32127, 30779}, {32238, 30780}, {32238, 30781},
+    {32184, 30783}, {32230, 30784}, {2782, 30787}, {32132, 30788}, {32191, 30789}, {32227, 30790}, {32233, 30791}, {32231, 30792},
+    {32137, 30794}, {32176, 30795}, {32139, 30797}, {32182, 30798}, {32227, 30799}, {32231, 30800}, {32234, 30801}, {32254, 30802},
+    {32254, 30803}, {32252, 30805}, {32252, 30806}, {32231, 30807}, {32202, 30808}, {32226, 30809}, {32249, 30810}, {32247, 30811},
+    {32252, 30813}, {32244, 30814}, {32240, 30815}, {32239, 30816}, {32242, 30817}, {656, 30819}, {32234, 30820}, {32192, 30821},
+    {32160, 30822}, {32155, 30823}, {32199, 30824}, {32202, 30825}, {32207, 30826}, {32203, 30827}, {1003, 30829}, {32210, 30830},
+    {32248, 30831}, {32168, 30832}, {32204, 30833}, {32196, 30834}, {32192, 30835}, {32223, 30836}, {32194, 30837}, {32203, 30838},
+    {32193, 30839}, {32219, 30840}, {32194, 30841}, {32221, 30842}, {32199, 30843}, {32235, 30844}, {32222, 30845}, {32222, 30846},
+    {32217, 30847}, {32204, 30848}, {32230, 30849}, {32209, 30850}, {32211, 30851}, {32210, 30852}, {32210, 30854}, {32202, 30855},
+    {573, 30856}, {32209, 30857}, {32175, 30858}, {32175, 30860}, {32171, 30861}, {32162, 30862}, {32174, 30972}, {32169, 30863},
+    {32179, 30864}, {32151, 30865}, {32189, 30866}, {32149, 30867}, {1689, 30869}, {32173, 30862}, {32191, 30870}, {32147, 30871},
+    {32205, 30872}, {32186, 30873}, {32144, 30874}, {32187, 30875}, {32185, 30876}, {32188, 30877}, {32167, 30878}, {32139, 30879},
+    {32190, 30880}, {32190, 30881}, {32185, 30882}, {32135, 30883}, {32183, 30884}, {32168, 30885}, {32188, 30893}, {32181, 30886},
+    {32180, 30887}, {32181, 30888}, {32142, 30891}, {32150, 30892}, {709, 30894}, {32134, 30895}, {32138, 30896}, {32142, 30897},
+    {32149, 30898}, {32136, 30899}, {32211, 30900}, {32143, 30901}, {32130, 30902}, {32135, 30903}, {32131, 30904}, {32129, 30906},
+    {32155, 30907}, {1758, 30908}, {1269, 30909}, {32240, 30910}, {32174, 30911}, {32156, 30912}, {32201, 30913}, {32155, 30915},
+    {32129, 30916}, {519, 30917}, {2203, 30919}, {32130, 30920}, {32168, 30921}, {32248, 30922}, {32195, 30923}, {32159, 30924},
+    {32132, 30889}, {32146, 30925}, {32151, 30926}, {32147, 30927}, {32155, 30928}, {32145, 30929}, {32363, 30930}, {32370, 30931},
+    {32365, 30932}, {32364, 30934}, {32368, 30935}, {2565, 30936}, {32362, 30937}, {32370, 30938}, {32344, 30939}, {32380, 30940},
+    {32342, 30941}, {32357, 30943}, {32383, 30944}, {287, 30945}, {32355, 30947}, {32377, 30948}, {211, 30949}, {174, 30951},
+    {32363, 30952}, {32353, 30953}, {32379, 30954}, {32354, 30955}, {32381, 30956}, {32297, 30957}, {32369, 30958}, {32303, 30959},
+    {32371, 30960}, {32377, 30961}, {32375, 30962}, {32321, 30964}, {32281, 30965}, {32288, 30966}, {32373, 30967}, {32373, 30968},
+    {32376, 30969}, {32286, 30970}, {32293, 30971}, {32335, 30973}, {32339, 30974}, {32345, 30975}, {32317, 30976}, {32260, 30978},
+    {32346, 30979}, {32378, 30980}, {32292, 30981}, {1197, 30982}, {32322, 30983}, {32294, 30985}, {32298, 30986}, {32299, 30987},
+    {32297, 30988}, {32381, 30990}, {32301, 30991}, {32300, 30992}, {32292, 30993}, {1924, 30995}, {32319, 30996}, {32275, 30997},
+    {32333, 30998}, {32299, 30999}, {32289, 31000}, {32309, 31001}, {32319, 31002}, {32313, 31003}, {32288, 31004}, {32315, 31005},
+    {32304, 31006}, {32312, 31007}, {32365, 31008}, {32317, 31009}, {32304, 31010}, {32305, 31011}, {32309, 31012}, {32307, 31014},
+    {32297, 31015}, {1267, 31016}, {32311, 31017}, {32308, 31018}, {32354, 31020}, {32345, 31021}, {32266, 31022}, {32266, 31023},
+    {500, 31026}, {32274, 31027}, {32312, 31028}, {32361, 31029}, {2183, 31030}, {32362, 31031}, {32363, 31032}, {32342, 31033},
+    {32259, 31034}, {32263, 31035}, {32266, 31036}, {32286, 31037}, {32286, 31038}, {32257, 31039}, {32300, 31040}, {32256, 31041},
+    {32335, 31042}, {32275, 31043}, {32274, 31044}, {32278, 31045}, {32377, 31046}, {32320, 31047}, {32277, 31048}, {32277, 31049},
+    {32280, 31050}, {32273, 31052}, {32172, 30889}, {32267, 31053}, {927, 31054}, {32442, 31055}, {32484, 31056}, {32491, 31057},
+    {32488, 31058}, {32490, 31059}, {32447, 31060}, {32483, 31061}, {32494, 31062}, {32483, 31063}, {32487, 31064}, {32485, 31065},
+    {32260, 31019}, {32511, 31066}, {32467, 31067}, {32505, 31068}, {32465, 31069}, {32480, 31070}, {32484, 31071}, {32462, 31072},
+    {32486, 31073}, {32460, 31074}, {32506, 31075}, {32506, 31076}, {32428, 31078}, {32498, 31079}, {32509, 31080}, {32503, 31081},
+    {32497, 31082}, {32488, 31083}, {32499, 31084}, {32450, 31085}, {32496, 31086}, {32493, 31088}, {32455, 31096}, {32456, 31087},
+    {32460, 31089}, {32460, 31090}, {32471, 31091}, {32506, 31092}, {32466, 31093}, {32413, 31094}, {32461, 31095}, {32454, 31098},
+    {32478, 31099}, {1500, 31100}, {32452, 31101}, {32472, 31102}, {32498, 31103}, {32474, 31104}, {32496, 31105}, {32432, 31106},
+    {32395, 31107}, {32477, 31109}, {32455, 31110}, {2384, 31111}, {32475, 31112}, {32449, 31113}, {32489, 31114}, {32451, 31115},
+    {32487, 31116}, {32476, 31117}, {32468, 31118}, {32464, 31119}, {32463, 31120}, {32466, 31121}, {32388, 31122}, {32474, 31123},
+    {32436, 31124}, {32414, 31125}, {32425, 31126}, {32427, 31127}, {32426, 31128}, {32427, 31129}, {32431, 31130}, {32418, 31209},
+    {32422, 31131}, {32420, 31132}, {32420, 31133}, {32447, 31134}, {32402, 31135}, {32442, 31136}, {32417, 31137}, {32447, 31138},
+    {32417, 31131}, {32491, 31140}, {32439, 31141}, {32442, 31142}, {32447, 31143}, {32443, 31144}, {32470, 31145}, {32493, 31146},
+    {32438, 31147}, {32432, 31148}, {32447, 31149}, {32437, 31150}, {32435, 31151}, {1836, 31154}, {32425, 31155}, {32385, 31156},
+    {32479, 31157}, {720, 31159}, {32404, 31160}, {32446, 31161}, {32482, 31162}, {32390, 31163}, {32394, 31164}, {32395, 31165},
+    {32393, 31166}, {32393, 31168}, {32391, 31169}, {32390, 31172}, {32414, 31173}, {2159, 31174}, {32389, 31175}, {32387, 31176},
+    {32471, 31178}, {32395, 31179}, {32390, 31180}, {32411, 31181}, {32415, 31182}, {32456, 31183}, {32406, 31184}, {32413, 31185},
+    {32414, 31186}, {32408, 31187}, {32274, 31019}, {32409, 31188}, {32407, 31189}, {32407, 31191}, {32405, 31192}, {32405, 31194},
+    {32403, 31195}, {32398, 31196}, {32417, 31197}, {32395, 31198}, {32622, 31199}, {32622, 31200}, {32625, 31201}, {32604, 31202},
+    {32624, 31203}, {32608, 31204}, {32616, 31205}, {32573, 31207}, {32520, 31208}, {769, 31210}, {32521, 31211}, {32522, 31212},
+    {32561, 31213}, {32621, 31214}, {464, 31215}, {32525, 31216}, {32637, 31217}, {32592, 31218}, {32637, 31219}, {32610, 31220},
+    {32589, 31221}, {32638, 31222}, {32587, 31223}, {32609, 31224}, {32611, 31225}, {32638, 31226}, {32627, 31227}, {32580, 31228},
+    {32628, 31229}, {32628, 31230}, {1046, 31233}, {32616, 31234}, {32578, 31235}, {32542, 31236}, {32549, 31237}, {32580, 31238},
+    {32587, 31239}, {32584, 31240}, {32586, 31241}, {32549, 31242}, {32540, 31243}, {32585, 31244}, {32576, 31245}, {32591, 31246},
+    {32581, 31247}, {32579, 31248}, {32578, 31251}, {32602, 31252}, {948, 31253}, {32533, 31254}, {32597, 31255}, {32607, 31256},
+    {32605, 31257}, {1257, 31259}, {32521, 31261}, {32593, 31262}, {32604, 31263}, {32605, 31264}, {32601, 31265}, {32599, 31267},
+    {32589, 31268}, {2276, 31269}, {1018, 31271}, {32607, 31272}, {32597, 31273}, {32518, 31274}, {32600, 31275}, {32589, 31276},
+    {32593, 31278}, {32553, 31279}, {32544, 31280}, {32552, 31298}, {32638, 31281}, {32544, 31282}, {967, 31283}, {32582, 31284},
+    {32536, 31285}, {32550, 31286}, {32555, 31280}, {32627, 31287}, {319, 31289}, {32574, 31290}, {32532, 31291}, {32588, 31292},
+    {1383, 31294}, {32569, 31295}, {32529, 31296}, {32591, 31297}, {1172, 31299}, {32592, 31300}, {32564, 31301}, {32572, 31302},
+    {1413, 31303}, {32595, 31304}, {1878, 31305}, {32596, 31306}, {32522, 31307}, {32568, 31308}, {32621, 31309}, {1019, 31310},
+    {32600, 31311}, {389, 31313}, {32557, 31314}, {32517, 31315}, {32603, 31316}, {32618, 31228}, {32614, 31317}, {32568, 31318},
+    {32554, 31319}, {32512, 31320}, {32523, 31321}, {32521, 31322}, {32524, 31323}, {32611, 31325}, {32606, 31326}, {32512, 31327},
+    {32520, 31328}, {32520, 31330}, {32540, 31331}, {1106, 31332}, {32617, 31333}, {32592, 31334}, {32517, 31335}, {32517, 31336},
+    {32520, 31337}, {1778, 31339}, {1247, 31340}, {32622, 31341}, {32512, 31343}, {32516, 31344}, {1934, 31345}, {32587, 31346},
+    {32535, 31347}, {2179, 31349}, {32519, 31350}, {32555, 31351}, {32629, 31352}, {1855, 31354}, {32514, 31355}, {32552, 31356},
+    {32632, 31357}, {32579, 31358}, {32543, 31359}, {32530, 31360}, {32535, 31361}, {32531, 31362}, {32580, 31363}, {32538, 31364},
+    {32745, 31365}, {32746, 31366}, {32748, 31367}, {32643, 31368}, {32702, 31369}, {1408, 31371}, {513, 31372}, {32645, 31373},
+    {32729, 31374}, {32745, 31375}, {32690, 31376}, {32743, 31377}, {32741, 31378}, {32760, 31379}, {32723, 31380}, {32761, 31381},
+    {32654, 31382}, {32693, 31383}, {32766, 31384}, {32760, 31385}, {32759, 31386}, {32764, 31387}, {32736, 31388}, {32714, 31389},
+    {32738, 31390}, {32712, 31391}, {32765, 31392}, {32759, 31393}, {1548, 31395}, {32672, 31396}, {32766, 31397}, {32678, 31398},
+    {32760, 31399}, {32759, 31400}, {32756, 31401}, {32718, 31402}, {32667, 31404}, {32711, 31405}, {32665, 31406}, {32705, 31407},
+    {32716, 31408}, {32717, 31409}, {32713, 31410}, {2031, 31411}, {32680, 31412}, {32758, 31413}, {32708, 31414}, {32657, 31415},
+    {757, 31417}, {32713, 31418}, {32707, 31419}, {32709, 31420}, {32732, 31421}, {32735, 31422}, {32734, 31423}, {32710, 31424},
+    {32748, 31425}, {32704, 31426}, {32746, 31427}, {32694, 31428}, {32653, 31429}, {32726, 31430}, {32720, 31431}, {32735, 31432},
+    {32699, 31433}, {32646, 31434}, {1012, 31436}, {32713, 31437}, {32737, 31438}, {32703, 31439}, {32687, 31441}, {32693, 31442},
+    {2507, 31443}, {32706, 31444}, {32761, 31445}, {32673, 31446}, {32683, 31447}, {32675, 31448}, {32681, 31449}, {1557, 31450},
+    {32712, 31451}, {32713, 31452}, {32752, 31453}, {32715, 31454}, {32758, 31455}, {32759, 31456}, {32683, 31457}, {32719, 31458},
+    {32746, 31459}, {1261, 31461}, {32677, 31462}, {32653, 31463}, {32723, 31464}, {1559, 31466}, {32672, 31467}, {32650, 31468},
+    {32726, 31469}, {32727, 31470}, {32738, 31471}, {32729, 31472}, {32736, 31473}, {32731, 31474}, {32742, 31475}, {32691, 31476},
+    {32695, 31477}, {32698, 31478}, {32645, 31479}, {32655, 31480}, {32649, 31481}, {32656, 31482}, {32651, 31483}, {2745, 31485},
+    {32640, 31486}, {32648, 31487}, {32743, 31488}, {32722, 31489}, {2479, 31491}, {32745, 31492}, {32720, 31493}, {32654, 31494},
+    {32642, 31495}, {2319, 31496}, {32749, 31497}, {1955, 31498}, {32750, 31499}, {32688, 31500}, {32670, 31501}, {32715, 31502},
+    {32663, 31503}, {32669, 31504}, {32657, 31505}, {32667, 31506}, {32669, 31507}, {32644, 31508}, {32663, 31509}, {32668, 31510},
+    {32660, 31511}, {32705, 31512}, {32665, 31513}, {32660, 31514}, {32661, 31515}, {32657, 31516}, {32879, 31518}, {32885, 31519},
+    {1615, 31520}, {32770, 31521}, {32825, 31522}, {32874, 31523}, {32876, 31524}, {32867, 31525}, {32872, 31527}, {32892, 31528},
+    {1039, 31529}, {32819, 31530}, {32879, 31531}, {32866, 31532}, {32871, 31533}, {32867, 31534}, {32820, 31535}, {32874, 31536},
+    {32889, 31537}, {32890, 31538}, {32892, 31539}, {32892, 31540}, {32864, 31541}, {32842, 31542}, {32866, 31543}, {32840, 31544},
+    {32887, 31545}, {32877, 31546}, {32837, 31547}, {32879, 31548}, {32835, 31549}, {32883, 31550}, {32881, 31551}, {32890, 31553},
+    {32846, 31554}, {32894, 31555}, {32844, 31556}, {32849, 31557}, {32835, 31565}, {32844, 31558}, {32840, 31559}, {32840, 31560},
+    {32859, 31561}, {32886, 31562}, {32862, 31563}, {32836, 31566}, {32856, 31567}, {1928, 31568}, {32834, 31569}, {32858, 31570},
+    {32880, 31571}, {32836, 31572}, {32878, 31573}, {32861, 31574}, {32839, 31575}, {32875, 31576}, {32833, 31577}, {32873, 31578},
+    {32835, 31579}, {32871, 31580}, {32850, 31581}, {32850, 31582}, {32853, 31583}, {32850, 31584}, {32852, 31585}, {32811, 31730},
+    {32863, 31616}, {32815, 31586}, {32813, 31587}, {32889, 31589}, {32801, 31590}, {32812, 31591}, {32813, 31592}, {32809, 31593},
+    {32854, 31616}, {32840, 31594}, {32883, 31595}, {32804, 31596}, {32802, 31597}, {32809, 31598}, {32803, 31599}, {32801, 31600},
+    {2705, 31603}, {32827, 31604}, {32783, 31605}, {32849, 31606}, {32828, 31607}, {32828, 31608}, {32827, 31611}, {32801, 31612},
+    {1090, 31613}, {32854, 31614}, {32877, 31615}, {32822, 31617}, {32816, 31618}, {32831, 31619}, {32865, 31620}, {32825, 31621},
+    {32820, 31622}, {32821, 31623}, {32817, 31624}, {32782, 31625}, {32782, 31626}, {32780, 31628}, {32780, 31629}, {32791, 31630},
+    {32826, 31631}, {32786, 31632}, {32777, 31633}, {32775, 31634}, {32775, 31636}, {32773, 31637}, {32849, 31640}, {32777, 31641},
+    {32772, 31642}, {32773, 31643}, {32769, 31644}, {32880, 31645}, {32843, 31646}, {32882, 31647}, {32841, 31648}, {32785, 31649},
+    {32795, 31650}, {1225, 31652}, {32912, 31653}, {32974, 31654}, {33020, 31655}, {32937, 31656}, {546, 31657}, {32916, 31658},
+    {32844, 31651}, {32970, 31659}, {32834, 31651}, {32845, 31651}, {32832, 31651}, {32835, 31651}, {32838, 31651}, {32833, 31651},
+    {32836, 31651}, {32839, 31651}, {32954, 31651}, {32837, 31651}, {32952, 31651}, {32955, 31651}, {32958, 31651}, {32953, 31651},
+    {32956, 31651}, {32959, 31651}, {32946, 31651}, {32957, 31651}, {32944, 31651}, {32947, 31651}, {32950, 31651}, {32945, 31651},
+    {32948, 31651}, {32951, 31651}, {33016, 31660}, {32949, 31651}, {32941, 31661}, {2300, 31662}, {32920, 31663}, {32931, 31664},
+    {32922, 31665}, {32929, 31666}, {1540, 31668}, {32934, 31669}, {33016, 31670}, {33019, 31671}, {33009, 31672}, {32928, 31673},
+    {32923, 31674}, {32920, 31675}, {32966, 31676}, {32971, 31678}, {32977, 31679}, {1358, 31680}, {32924, 31681}, {32962, 31682},
+    {32914, 31683}, {32972, 31684}, {32963, 31685}, {32960, 31686}, {32962, 31687}, {32919, 31688}, {32971, 31689}, {32943, 31690},
+    {32906, 31691}, {32991, 31692}, {32987, 31693}, {32982, 31694}, {32986, 31695}, {32986, 31696}, {32984, 31698}, {32990, 31699},
+    {32985, 31744}, {32977, 31858}, {1864, 31700}, {32955, 31701}, {32985, 31702}, {32979, 31703}, {32977, 31705}, {32971, 31706},
+    {32976, 31744}, {647, 31707}, {1215, 31709}, {1776, 31710}, {32960, 31711}, {32926, 31712}, {32940, 31713}, {33017, 31714},
+    {32929, 31715}, {32939, 31716}, {32941, 31717}, {32948, 31718}, {32935, 31719}, {32969, 31720}, {33008, 31721}, {33009, 31722},
+    {32937, 31723}, {2455, 31724}, {32973, 31725}, {32913, 31726}, {32929, 31727}, {33002, 31728}, {32959, 31729}, {32957, 31731},
+    {32979, 31733}, {33006, 31734}, {32955, 31735}, {32959, 31736}, {32946, 31737}, {32984, 31738}, {32995, 31739}, {32948, 31740},
+    {32946, 31741}, {32953, 31742}, {32947, 31743}, {32945, 31745}, {32940, 31746}, {32959, 31747}, {32917, 31748}, {32908, 31749},
+    {32908, 31750}, {32919, 31751}, {32954, 31752}, {32914, 31753}, {32898, 31754}, {32902, 31755}, {33001, 31756}, {32976, 31757},
+    {32977, 31758}, {32905, 31759}, {32900, 31760}, {32901, 31761}, {32897, 31762}, {32900, 31763}, {32942, 31764}, {32921, 31765},
+    {32923, 31766}, {32922, 31767}, {32912, 31768}, {32920, 31769}, {32924, 31770}, {32907, 31771}, {32918, 31772}, {33018, 31773},
+    {32961, 31774}, {32914, 31775}, {32914, 31776}, {32912, 31778}, {32912, 31779}, {33139, 31780}, {33118, 31781}, {33142, 31782},
+    {1027, 31783}, {33027, 31784}, {33130, 31785}, {33130, 31786}, {33128, 31788}, {33128, 31789}, {33147, 31790}, {33110, 31791},
+    {33150, 31792}, {33073, 31793}, {33129, 31794}, {33124, 31795}, {33125, 31796}, {33121, 31797}, {33040, 31798}, {33067, 31799},
+    {33149, 31800}, {33127, 31801}, {33099, 31802}, {33121, 31803}, {33097, 31804}, {33096, 31805}, {33142, 31806}, {33131, 31808},
+    {33149, 31816}, {33138, 31807}, {33145, 31809}, {33139, 31810}, {33141, 31811}, {33132, 31812}, {33103, 31813}, {33092, 31814},
+    {33100, 31815}, {33059, 31817}, {33054, 31818}, {33099, 31819}, {33103, 31820}, {33090, 31821}, {433, 31822}, {33064, 31823},
+    {33142, 31824}, {33092, 31825}, {33041, 31826}, {33097, 31827}, {33091, 31828}, {33089, 31830}, {33115, 31831}, {2793, 31832},
+    {33119, 31834}, {33093, 31835}, {2644, 31836}, {33032, 31837}, {33110, 31838}, {33105, 31839}, {33115, 31840}, {33107, 31841},
+    {33113, 31842}, {33110, 31843}, {33110, 31844}, {33119, 31846}, {33109, 31847}, {33084, 31848}, {33031, 31849}, {33104, 31850},
+    {33110, 31851}, {33061, 31852}, {33089, 31853}, {33144, 31854}, {33069, 31855}, {33069, 31856}, {33056, 31857}, {33059, 31859},
+    {33065, 31860}, {33069, 31861}, {33063, 31862}, {33071, 31863}, {33061, 31864}, {33063, 31865}, {33086, 31866}, {33057, 31867},
+    {33066, 31868}, {33086, 31869}, {33082, 31870}, {33057, 31871}, {33084, 31872}, {33134, 31873}, {33072, 31874}, {33110, 31875},
+    {2191, 31876}, {2667, 31878}, {2217, 31879}, {33111, 31880}, {33078, 31881}, {739, 31883}, {33074, 31884}, {33065, 31885},
+    {33197, 31886}, {33072, 31887}, {33071, 31888}, {33196, 31889}, {33070, 31890}, {33025, 31891}, {33074, 31892}, {33038, 31893},
+    {33032, 31894}, {33039, 31973}, {33024, 31896}, {33032, 31897}, {33032, 31899}, {33052, 31900}, {989, 31901}, {33129, 31902},
+    {33027, 31895}, {33104, 31903}, {33029, 31904}, {33029, 31905}, {33032, 31906}, {215, 31907}, {33134, 31908}, {33072, 31909},
+    {33034, 31895}, {33054, 31910}, {33099, 31911}, {33047, 31912}, {33053, 31913}, {33050, 31914}, {33050, 31915}, {33142, 31917},
+    {33101, 31918}, {33053, 31919}, {33047, 31920}, {33146, 31922}, {33089, 31923}, {33042, 31924}, {33044, 31925}, {33051, 31926},
+    {33041, 31927}, {33261, 31928}, {33209, 31931}, {33249, 31932}, {33157, 31933}, {33212, 31934}, {33213, 31935}, {33239, 31936},
+    {33255, 31937}, {33272, 31938}, {33260, 31946}, {33253, 31939}, {33165, 31940}, {33204, 31941}, {865, 31943}, {33275, 31944},
+    {33231, 31945}, {33169, 31947}, {33277, 31949}, {33255, 31950}, {5, 31951}, {33275, 31953}, {33249, 31954}, {1006, 31955},
+    {2420, 31957}, {33196, 31958}, {33266, 31959}, {2107, 31961}, {542, 31963}, {33260, 31964}, {33222, 31965}, {33178, 31966},
+    {2718, 31968}, {33268, 31970}, {33256, 31971}, {333, 31972}, {33181, 31974}, {33188, 31975}, {33264, 31976}, {33236, 31977},
+    {33278, 31978}, {33238, 31979}, {33276, 31980}, {371, 31981}, {33188, 31982}, {33183, 31983}, {33219, 31984}, {33225, 31985},
+    {33223, 31986}, {2517, 31988}, {33193, 31989}, {33269, 31990}, {33221, 31991}, {33174, 31992}, {2165, 31995}, {33219, 31996},
+    {33217, 31997}, {33199, 31999}, {33162, 32000}, {33246, 32002}, {33222, 32003}, {1347, 32004}, {33244, 32006}, {33216, 32007},
+    {930, 32008}, {33205, 32009}, {33164, 32010}, {33241, 32011}, {33233, 32012}, {33244, 32013}, {33210, 32014}, {33153, 32015},
+    {33234, 32016}, {33236, 32017}, {33243, 32018}, {854, 32019}, {33215, 32020}, {2032, 32023}, {33204, 32024}, {33182, 32025},
+    {33218, 32026}, {33190, 32027}, {33194, 32028}, {33198, 32029}, {33205, 32030}, {33192, 32031}, {1531, 32032}, {33224, 32033},
+    {33174, 32034}, {33188, 32035}, {33265, 32036}, {33186, 32037}, {33186, 32038}, {33213, 32039}, {33168, 32040}, {33188, 32041},
+    {33259, 32042}, {33207, 32043}, {33235, 32045}, {33262, 32046}, {33237, 32047}, {33260, 32048}, {33209, 32049}, {33201, 32050},
+    {33212, 32051}, {33242, 32052}, {33249, 32053}, {33244, 32054}, {33255, 32055}, {33200, 32056}, {33206, 32057}, {33157, 32058},
+    {900, 32060}, {33173, 32061}, {33213, 32062}, {33251, 32063}, {33246, 32065}, {33152, 32066}, {33167, 32067}, {33164, 32068},
+    {33158, 32069}, {33159, 32070}, {33157, 32071}, {33176, 32072}, {33203, 32073}, {33177, 32074}, {531, 32075}, {33262, 32076},
+    {33200, 32077}, {33182, 32078}, {33227, 32079}, {505, 32080}, {33268, 32081}, {33178, 32083}, {33154, 32084}, {391, 32085},
+    {33177, 32086}, {33175, 32087}, {2539, 32089}, {33273, 32090}, {33216, 32091}, {33182, 32092}, {33222, 32093}, {33176, 32094},
+    {151, 32096}, {1530, 32097}, {33278, 32098}, {2043, 32099}, {33279, 32100}, {33280, 32101}, {33339, 32102}, {133, 32103},
+    {33282, 32104}, {33388, 32106}, {33392, 32107}, {976, 32108}, {33386, 32110}, {33394, 32111}, {1390, 32112}, {1350, 32113},
+    {33287, 32114}, {916, 32115}, {33288, 32116}, {1029, 32117}, {33289, 32118}, {33365, 32119}, {33381, 32120}, {33334, 32121},
+    {33335, 32122}, {33387, 32123}, {33382, 32124}, {33403, 32125}, {33407, 32126}, {33320, 32128}, {33398, 32129}, {872, 32130},
+    {33300, 32131}, {2594, 32133}, {33301, 32134}, {33324, 32135}, {33394, 32136}, {511, 32138}, {2298, 32140}, {33388, 32141},
+    {33350, 32142}, {33306, 32143}, {33313, 32144}, {33401, 32145}, {33319, 32146}, {33403, 32147}, {33398, 32148}, {33355, 32149},
+    {33359, 32150}, {33304, 32151}, {33350, 32152}, {33316, 32153}, {33311, 32154}, {33352, 32155}, {33358, 32156}, {33357, 32157},
+    {33351, 32158}, {33349, 32159}, {1982, 32161}, {33323, 32162}, {33395, 32163}, {33347, 32164}, {33300, 32165}, {33345, 32166},
+    {33375, 32167}, {33329, 32169}, {33288, 32170}, {33373, 32171}, {33373, 32172}, {33360, 32173}, {33334, 32174}, {33293, 32175},
+    {33366, 32176}, {33360, 32177}, {33375, 32178}, {33365, 32179}, {33363, 32180}, {33358, 32181}, {33377, 32182}, {33355, 32183},
+    {33326, 32184}, {33326, 32185}, {33329, 32186}, {33308, 32187}, {33328, 32188}, {33312, 32189}, {33320, 32190}, {33405, 32191},
+    {33325, 32192}, {33341, 32193}, {33301, 32194}, {33312, 32195}, {33316, 32196}, {33315, 32197}, {33323, 32198}, {33313, 32199},
+    {33339, 32200}, {33314, 32201}, {33341, 32202}, {33341, 32203}, {33339, 32204}, {33339, 32206}, {33337, 32207}, {33316, 32208},
+    {33287, 32209}, {33325, 32210}, {33332, 32211}, {33332, 32212}, {33327, 32213}, {33282, 32214}, {33322, 32215}, {33328, 32216},
+    {33300, 32217}, {33342, 32218}, {33302, 32219}, {33340, 32220}, {33339, 32221}, {33291, 32222}, {33300, 32224}, {33280, 32232},
+    {33281, 32223}, {33292, 32225}, {33284, 32226}, {33387, 32227}, {33366, 32228}, {33283, 32229}, {33287, 32230}, {33290, 32231},
+    {648, 32233}, {33392, 32234}, {33326, 32235}, {33308, 32236}, {33353, 32237}, {33297, 32238}, {33307, 32239}, {33305, 32241},
+    {33283, 32242}, {282, 32243}, {33309, 32244}, {33303, 32245}, {33300, 32246}, {33300, 32247}, {2601, 32249}, {33404, 32250},
+    {33314, 32251}, {33296, 32252}, {33349, 32253}, {33408, 32254}, {33467, 32255}, {33516, 32256}, {33514, 32257}, {33505, 32258},
+    {33504, 32259}, {33512, 32260}, {33506, 32261}, {33510, 32262}, {33506, 32263}, {33529, 32264}, {33508, 32265}, {33513, 32266},
+    {33507, 32267}, {33515, 32268}, {33505, 32269}, {33424, 32270}, {33451, 32271}, {33532, 32272}, {33530, 32273}, {33521, 32274},
+    {2765, 32275}, {33429, 32276}, {1009, 32277}, {33430, 32278}, {33453, 32279}, {33533, 32280}, {33433, 32288}, {33434, 32291},
+    {33435, 32290}, {33436, 32293}, {33437, 32292}, {33438, 32295}, {33439, 32294}, {33440, 32297}, {33441, 32296}, {33442, 32299},
+    {33443, 32298}, {33444, 32301}, {33445, 32300}, {33446, 32303}, {33447, 32302}, {33448, 32305}, {33449, 32304}, {33450, 32307},
+    {33451, 32306}, {33452, 32309}, {33453, 32308}, {33454, 32311}, {33455, 32310}, {33456, 32313}, {33457, 32312}, {33458, 32315},
+    {307, 32282}, {33479, 32283}, {33515, 32284}, {33461, 32285}, {765, 32287}, {33474, 32289}, {33512, 32314}, {33464, 32316},
+    {2640, 32318}, {33465, 32319}, {1055, 32320}, {33466, 32321}, {33467, 32323}, {33414, 32324}, {33415, 32325}, {33499, 32326},
+    {113, 32327}, {33471, 32328}, {33472, 32329}, {33531, 32330}, {33452, 32331}, {33452, 32332}, {33476, 32334}, {33535, 32335},
+    {33478, 32336}, {33533, 32337}, {33446, 32338}, {33440, 32339}, {33455, 32340}, {33483, 32341}, {33526, 32342}, {2510, 32343},
+    {33485, 32344}, {33425, 32345}, {33441, 32346}, {33514, 32347}, {33460, 32348}, {33468, 32349}, {33420, 32350}, {33466, 32351},
+    {33447, 32352}, {33457, 32360}, {33470, 32353}, {1754, 32355}, {33506, 32356}, {33468, 32357}, {33460, 32358}, {33460, 32359},
+    {1720, 32364}, {33448, 32365}, {33410, 32366}, {33502, 32367}, {33509, 32368}, {33413, 32369}, {33416, 32370}, {33417, 32371},
+    {33421, 32372}, {2411, 32373}, {33508, 32374}, {33509, 32375}, {33500, 32376}, {336, 32378}, {33427, 32379}, {33463, 32380},
+    {33513, 32381}, {33423, 32382}, {33413, 32383}, {1938, 32384}, {33516, 32385}, {33458, 32386}, {33408, 32387}, {33493, 32388},
+    {2136, 32389}, {33520, 32390}, {33454, 32391}, {33436, 32392}, {33481, 32393}, {33425, 32394}, {33435, 32395}, {33437, 32396},
+    {33412, 32397}, {33431, 32398}, {33436, 32399}, {33428, 32400}, {33424, 32401}, {33423, 32402}, {33426, 32403}, {33476, 32404},
+    {33434, 32405}, {2067, 32406}, {33536, 32407}, {33537, 32408}, {33592, 32409}, {33645, 32410}, {33645, 32411}, {33632, 32412},
+    {33641, 32413}, {33651, 32414}, {33623, 32415}, {33661, 32416}, {33621, 32417}, {33585, 32418}, {33641, 32419}, {33636, 32420},
+    {33637, 32421}, {33633, 32422}, {729, 32423}, {33552, 32424}, {33652, 32425}, {33660, 32426}, {33654, 32427}, {33658, 32428},
+    {33662, 32429}, {33637, 32430}, {33656, 32431}, {1088, 32433}, {33661, 32434}, {33655, 32435}, {33663, 32436}, {33653, 32437},
+    {33655, 32438}, {33646, 32439}, {33649, 32440}, {33567, 32441}, {33562, 32442}, {33615, 32443}, {33611, 32444}, {33606, 32445},
+    {2467, 32446}, {33572, 32447}, {33611, 32448}, {33609, 32449}, {33620, 32450}, {33655, 32451}, {33629, 32452}, {33630, 32453},
+    {33652, 32454}, {33607, 32455}, {33605, 32456}, {33600, 32457}, {33557, 32458}, {33621, 32459}, {33624, 32460}, {33625, 32461},
+    {33629, 32462}, {33550, 32463}, {33616, 32464}, {832, 32465}, {33590, 32466}, {33640, 32467}, {33622, 32468}, {33539, 32469},
+    {2749, 32471}, {33614, 32472}, {33636, 32473}, {33596, 32474}, {33543, 32475}, {33627, 32476}, {33617, 32477}, {33583, 32478},
+    {33583, 32480}, {33581, 32481}, {33603, 32483}, {33662, 32484}, {33663, 32485}, {33571, 32486}, {33661, 32487}, {33581, 32488},
+    {33580, 32489}, {33572, 32490}, {33649, 32491}, {33577, 32492}, {736, 32493}, {33613, 32494}, {33553, 32495}, {33569, 32496},
+    {33642, 32497}, {1749, 32498}, {33617, 32499}, {33549, 32500}, {33597, 32501}, {33646, 32502}, {33647, 32503}, {33587, 32504},
+    {33645, 32505}, {33597, 32506}, {33635, 32507}, {33599, 32508}, {33586, 32509}, {33591, 32510}, {33587, 32511}, {33636, 32512},
+    {33594, 32513}, {33545, 32514}, {33546, 32515}, {33548, 32516}, {33635, 32517}, {33630, 32518}, {2785, 32519}, {2220, 32523},
+    {33537, 32524}, {33551, 32526}, {33548, 32527}, {33536, 32529}, {33537, 32530}, {33543, 32532}, {33566, 32533}, {33709, 32534},
+    {33585, 32535}, {33537, 32536}, {33536, 32544}, {33556, 32552}, {33565, 32537}, {33615, 32538}, {33555, 32539}, {33561, 32540},
+    {33557, 32541}, {2070, 32543}, {33659, 32545}, {33571, 32546}, {33555, 32547}, {33604, 32548}, {1237, 32550}, {33547, 32551},
+    {33758, 32553}, {33666, 32554}, {33721, 32555}, {33761, 32556}, {33760, 32557}, {33768, 32558}, {1988, 32559}, {33671, 32560},
+    {33714, 32561}, {33772, 32562}, {1843, 32563}, {33674, 32564}, {33748, 32565}, {33762, 32566}, {33719, 32567}, {33771, 32568},
+    {33556, 32528}, {33557, 32531}, {33761, 32569}, {33680, 32570}, {33707, 32571}, {1305, 32572}, {33682, 32573}, {33683, 32574},
+    {33760, 32575}, {33738, 32576}, {33789, 32577}, {33791, 32578}, {33782, 32579}, {1138, 32580}, {33689, 32581}, {33781, 32583},
+    {33775, 32584}, {291, 32585}, {33778, 32586}, {33778, 32587}, {33776, 32589}, {33776, 32590}, {33696, 32593}, {33691, 32594},
+    {33741, 32597}, {33751, 32598}, {2514, 32599}, {33738, 32601}, {33738, 32602}, {2457, 32604}, {33702, 32605}, {33737, 32606},
+    {33735, 32607}, {33754, 32608}, {33781, 32609}, {33759, 32610}, {1736, 32612}, {33708, 32613}, {33687, 32614}, {33739, 32615},
+    {33729, 32616}, {256, 32618}, {33732, 32619}, {33774, 32620}, {33714, 32621}, {33750, 32623}, {33754, 32624}, {2284, 32625},
+    {33717, 32626}, {33752, 32627}, {33752, 32628}, {33750, 32630}, {33750, 32631}, {165, 32633}, {33722, 32634}, {33764, 32635},
+    {33746, 32636}, {33671, 32637}, {1438, 32638}, {33726, 32639}, {33760, 32640}, {33710, 32641}, {33787, 32642}, {55, 32644},
+    {33709, 32646}, {33719, 32647}, {1190, 32648}, {33790, 32649}, {33696, 32650}, {33711, 32651}, {33708, 32652}, {33702, 32653},
+    {1664, 32655}, {33725, 32656}, {33685, 32657}, {33739, 32658}, {33705, 32659}, {33699, 32660}, {33701, 32661}, {33724, 32662},
+    {33727, 32663}, {33745, 32664}, {33768, 32665}, {2053, 32666}, {33747, 32667}, {2447, 32668}, {33748, 32669}, {33674, 32670},
+    {33720, 32671}, {33773, 32672}, {1199, 32673}, {33752, 32674}, {2331, 32675}, {33753, 32676}, {33669, 32677}, {33717, 32678},
+    {33766, 32679}, {33714, 32681}, {33706, 32682}, {690, 32683}, {33759, 32684}, {33754, 32685}, {33679, 32686}, {33675, 32687},
+    {33670, 32688}, {33665, 32689}, {33675, 32690}, {33677, 32691}, {33684, 32692}, {33671, 32693}, {2551, 32695}, {33693, 32696},
+    {33717, 32697}, {33771, 32698}, {33563, 32528}, {33560, 32531}, {1818, 32700}, {33666, 32701}, {33666, 32702}, {33675, 32704},
+    {33665, 32705}, {694, 32707}, {33776, 32708}, {33739, 32709}, {33779, 32710}, {33742, 32711}, {1815, 32714}, {563, 32716},
+    {2161, 32717}, {33781, 32718}, {1132, 32720}, {33688, 32721}, {33688, 32722}, {33686, 32724}, {33686, 32725}, {2449, 32728},
+    {1444, 32730}, {1112, 32732}, {33678, 32733}, {33700, 32734}, {33788, 32735}, {33789, 32736}, {33732, 32737}, {33681, 32738},
+    {33897, 32739}, {33892, 32740}, {33794, 32741}, {33849, 32742}, {1969, 32744}, {2149, 32746}, {33796, 32747}, {33855, 32748},
+    {33897, 32751}, {33907, 32752}, {496, 32753}, {33800, 32754}, {33843, 32755}, {33802, 32756}, {33841, 32757}, {33890, 32758},
+    {33892, 32759}, {33899, 32760}, {33807, 32761}, {33834, 32762}, {2451, 32763}, {33809, 32764}, {33869, 32765}, {33917, 32766},
+    {33838, 32767}, {33904, 32768}, {33912, 32769}, {586, 32771}, {33891, 32772}, {33863, 32773}, {33817, 32774}, {33919, 32775},
+    {33909, 32776}, {1382, 32777}, {33820, 32778}, {33858, 32779}, {33904, 32780}, {33829, 32781}, {2262, 32782}, {33824, 32783},
+    {33918, 32784}, {33868, 32785}, {33817, 32786}, {33857, 32787}, {33867, 32788}, {33869, 32789}, {33876, 32790}, {33863, 32791},
+    {33868, 32792}, {33860, 32793}, {33856, 32794}, {33887, 32795}, {33858, 32796}, {33812, 32797}, {33866, 32798}, {33840, 32799},
+    {33803, 32800}, {33885, 32801}, {33863, 32802}, {33899, 32803}, {33857, 32804}, {33897, 32805}, {33805, 32806}, {33885, 32807},
+    {33872, 32808}, {33873, 32809}, {33877, 32810}, {33881, 32811}, {33875, 32812}, {33883, 32813}, {33873, 32814}, {33835, 32815},
+    {33842, 32816}, {33837, 32817}, {33830, 32818}, {33834, 32819}, {33838, 32820}, {33845, 32821}, {33832, 32822}, {33830, 32823},
+    {33830, 32824}, {33849, 32825}, {33812, 32826}, {33848, 32827}, {33849, 32828}, {33809, 32829}, {33828, 32830}, {33848, 32831},
+    {33855, 32832}, {33896, 32833}, {33846, 32834}, {2453, 32835}, {33876, 32836}, {33802, 32837}, {33848, 32838}, {33901, 32839},
+    {2339, 32841}, {33836, 32842}, {33798, 32843}, {33882, 32844}, {33889, 32845}, {33849, 32846}, {33843, 32847}, {33841, 32848},
+    {33893, 32850}, {33797, 32851}, {33796, 32852}, {33804, 32853}, {1594, 32855}, {33815, 32856}, {33851, 32857}, {33893, 32858},
+    {2668, 32859}, {33894, 32860}, {33848, 32861}, {33798, 32862}, {33875, 32863}, {33872, 32864}, {33806, 32865}, {33878, 32866},
+    {33800, 32867}, {33799, 32868}, {33796, 32869}, {33822, 32870}, {33867, 32871}, {33815, 32872}, {33865, 32873}, {33809, 32874},
+    {1509, 32875}, {33909, 32876}, {33833, 32877}, {33817, 32878}, {33858, 32879}, {2554, 32881}, {1708, 32883}, {33913, 32884},
+    {33856, 32885}, {2466, 32886}, {34, 32887}, {132, 32888}, {2249, 32889}, {102, 32890}, {2459, 32891}, {2559, 32892},
+    {997, 32893}, {1600, 32894}, {801, 32895}, {893, 32896}, {232, 32897}, {334, 32898}, {2599, 32899}, {533, 32900},
+    {129, 32901}, {1504, 32902}, {1608, 32903}, {1716, 32904}, {992, 32905}, {1096, 32906}, {1205, 32907}, {1307, 32908},
+    {2205, 32909}, {2326, 32910}, {2418, 32911}, {33812, 32913}, {33800, 32914}, {1824, 32915}, {33810, 32917}, {33802, 32918},
+    {1498, 32919}, {1740, 32921}, {14, 32923}, {1153, 32924}, {33919, 32925}, {33920, 32926}, {33979, 32927}, {2751, 32929},
+    {936, 32930}, {33922, 32931}, {34022, 32932}, {34026, 32933}, {1627, 32934}, {33925, 32935}, {2687, 32936}, {33926, 32937},
+    {34008, 32938}, {34022, 32939}, {33971, 32940}, {1340, 32941}, {33930, 32942}, {2377, 32944}, {34047, 32945}, {34003, 32946},
+    {33933, 32947}, {33972, 32948}, {34026, 32949}, {34020, 32950}, {33998, 32951}, {34041, 32952}, {34043, 32953}, {34042, 32954},
+    {33941, 32956}, {33964, 32957}, {34034, 32958}, {34038, 32959}, {34038, 32961}, {34030, 32962}, {2595, 32963}, {33947, 32964},
+    {33958, 32965}, {34035, 32966}, {34039, 32967}, {34042, 32968}, {399, 32970}, {1618, 32971}, {33952, 32972}, {33998, 32974},
+    {34006, 32975}, {1361, 32976}, {33945, 32977}, {33985, 32978}, {1953, 32980}, {34001, 32981}, {34041, 32982}, {33959, 32983},
+    {2308, 32985}, {34012, 32986}, {34038, 32987}, {33962, 32988}, {33937, 32989}, {33993, 32990}, {33988, 32991}, {33989, 32992},
+    {33985, 32993}, {33930, 32994}, {34004, 32995}, {34011, 32996}, {34008, 32997}, {34010, 32998}, {33973, 32999}, {33932, 33000},
+    {925, 33002}, {595, 33003}, {33975, 33004}, {34023, 33005}, {34007, 33006}, {33920, 33007}, {34005, 33008}, {34003, 33009},
+    {33998, 33010}, {34017, 33011}, {33995, 33012}, {33984, 33013}, {34043, 33014}, {33964, 33015}, {33962, 33016}, {33953, 33017},
+    {2489, 33019}, {34047, 33020}, {33955, 33021}, {34045, 33022}, {33965, 33023}, {33952, 33024}, {33953, 33025}, {33957, 33026},
+    {34038, 33028}, {33960, 33029}, {34036, 33030}, {33962, 33031}, {33977, 33032}, {33978, 33033}, {33980, 33034}, {2398, 33035},
+    {34003, 33036}, {33931, 33037}, {33979, 33038}, {34028, 33039}, {1185, 33041}, {33970, 33042}, {33974, 33043}, {33970, 33044},
+    {33961, 33045}, {33972, 33046}, {33971, 33047}, {33961, 33048}, {33921, 33049}, {33963, 33050}, {33983, 33051}, {34017, 33052},
+    {34008, 33053}, {33933, 33054}, {33933, 33055}, {33920, 33056}, {34022, 33057}, {34013, 33058}, {527, 33060}, {33948, 33061},
+    {33974, 33062}, {34026, 33063}, {33924, 33065}, {33944, 33066}, {309, 33067}, {34029, 33068}, {34004, 33069}, {33930, 33070},
+    {33950, 33071}, {33940, 33072}, {33948, 33073}, {1737, 33074}, {34035, 33075}, {34036, 33076}, {33999, 33077}, {34038, 33078},
+    {33997, 33079}, {33986, 33080}, {33948, 33081}, {34042, 33082}, {33985, 33083}, {1331, 33085}, {33928, 33086}, {33954, 33087},
+    {34046, 33088}, {2121, 33090}, {33931, 33091}, {34143, 33092}, {34049, 33093}, {34050, 33094}, {34105, 33095}, {34052, 33096},
+    {34111, 33097}, {34054, 33098}, {34109, 33099}, {34150, 33100}, {34144, 33101}, {34159, 33102}, {34059, 33103}, {34102, 33104},
+    {34147, 33105}, {34151, 33106}, {34154, 33107}, {1163, 33108}, {34064, 33109}, {34146, 33112}, {34172, 33113}, {34170, 33114},
+    {34173, 33266}, {34169, 33115}, {34161, 33116}, {34160, 33267}, {34165, 33117}, {34166, 33118}, {34155, 33120}, {34174, 33121},
+    {34165, 33152}, {34168, 33153}, {34121, 33122}, {34123, 33123}, {34122, 33124}, {34085, 33125}, {34076, 33126}, {34114, 33127},
+    {34172, 33152}, {34163, 33153}, {34119, 33128}, {146, 33130}, {34142, 33131}, {34164, 33132}, {34092, 33133}, {34114, 33135},
+    {34116, 33119}, {34138, 33136}, {18, 33137}, {34095, 33138}, {34058, 33139}, {34059, 33140}, {34135, 33141}, {2090, 33143},
+    {34099, 33144}, {34062, 33145}, {431, 33147}, {34113, 33148}, {34153, 33149}, {34103, 33150}, {34050, 33151}, {34140, 33154},
+    {2473, 33155}, {34106, 33156}, {1420, 33158}, {2477, 33159}, {34132, 33160}, {34120, 33161}, {34146, 33162}, {34122, 33163},
+    {34144, 33164}, {2436, 33166}, {34094, 33167}, {34094, 33168}, {34087, 33170}, {34093, 33171}, {34081, 33172}, {34091, 33173},
+    {179, 33174}, {34118, 33175}, {34089, 33176}, {34087, 33177}, {34092, 33179}, {34084, 33180}, {2212, 33182}, {34094, 33183},
+    {34082, 33184}, {34086, 33185}, {34109, 33186}, {34080, 33187}, {723, 33189}, {34128, 33190}, {34155, 33191}, {34103, 33192},
+    {34108, 33194}, {34080, 33195}, {300, 33196}, {34159, 33197}, {34099, 33198}, {2186, 33200}, {34098, 33201}, {34102, 33202},
+    {34108, 33203}, {34100, 33204}, {1017, 33206}, {34095, 33207}, {34051, 33208}, {34141, 33209}, {732, 33211}, {34090, 33212},
+    {34048, 33213}, {34144, 33214}, {34063, 33216}, {34061, 33217}, {34147, 33219}, {34142, 33220}, {34059, 33221}, {34063, 33222},
+    {34050, 33223}, {34055, 33225}, {34077, 33226}, {1488, 33227}, {34128, 33228}, {34062, 33229}, {34053, 33230}, {34054, 33231},
+    {34048, 33232}, {2077, 33233}, {34159, 33234}, {944, 33236}, {850, 33238}, {34052, 33239}, {34094, 33240}, {34162, 33241},
+    {2659, 33243}, {2358, 33245}, {34055, 33246}, {34091, 33247}, {34165, 33248}, {34072, 33249}, {34072, 33250}, {1576, 33252},
+    {34168, 33253}, {34086, 33254}, {34068, 33255}, {34113, 33256}, {34118, 33257}, {34072, 33258}, {34071, 33259}, {34068, 33260},
+    {34286, 33261}, {34286, 33263}, {34294, 33264}, {1872, 33265}, {34278, 33269}, {34282, 33270}, {34239, 33271}, {34275, 33272},
+    {1550, 33274}, {34183, 33275}, {34157, 33119}, {697, 33276}, {34184, 33277}, {2367, 33281}, {34284, 33283}, {34276, 33284},
+    {34286, 33285}, {34274, 33286}, {34274, 33290}, {34298, 33291}, {244, 33292}, {1314, 33293}, {34191, 33294}, {34255, 33295},
+    {34303, 33296}, {34216, 33297}, {1788, 33298}, {34195, 33299}, {1694, 33302}, {34196, 33303}, {34299, 33304}, {34297, 33305},
+    {1529, 33307}, {34199, 33308}, {2239, 33309}, {34200, 33310}, {34246, 33311}, {34292, 33312}, {34209, 33313}, {890, 33314},
+    {34204, 33315}, {576, 33317}, {34281, 33318}, {34241, 33319}, {34207, 33320}, {34202, 33321}, {34244, 33322}, {34253, 33324},
+    {34263, 33325}, {2660, 33326}, {34206, 33327}, {34240, 33328}, {1835, 33330}, {34258, 33331}, {34296, 33332}, {34216, 33333},
+    {52, 33335}, {34269, 33336}, {34293, 33337}, {34219, 33338}, {34198, 33339}, {34248, 33340}, {34247, 33341}, {34244, 33342},
+    {34270, 33343}, {34187, 33344}, {34263, 33345}, {34266, 33346}, {34271, 33347}, {34267, 33348}, {34230, 33349}, {34189, 33350},
+    {1448, 33351}, {34232, 33352}, {34263, 33353}, {34261, 33354}, {34248, 33355}, {34275, 33356}, {34249, 33357}, {34238, 33358},
+    {34181, 33359}, {34222, 33360}, {34216, 33361}, {34215, 33362}, {34297, 33363}, {34209, 33364}, {34303, 33365}, {34211, 33366},
+    {34222, 33367}, {34211, 33368}, {34215, 33369}, {34288, 33370}, {34222, 33371}, {34213, 33372}, {34214, 33373}, {34208, 33374},
+    {34218, 33375}, {34238, 33376}, {34234, 33377}, {34209, 33378}, {34236, 33379}, {34235, 33380}, {34209, 33381}, {34185, 33382},
+    {34211, 33383}, {34183, 33384}, {34265, 33385}, {34272, 33386}, {1050, 33388}, {34223, 33389}, {34179, 33390}, {34269, 33391},
+    {34225, 33393}, {34219, 33394}, {432, 33395}, {34272, 33396}, {34267, 33397}, {34183, 33398}, {34189, 33399}, {34276, 33400},
+    {34271, 33401}, {34268, 33402}, {34178, 33403}, {34183, 33405}, {34205, 33406}, {1732, 33407}, {1062, 33409}, {34206, 33410},
+    {34228, 33411}, {34284, 33412}, {34285, 33413}, {34260, 33414}, {34287, 33415}, {34250, 33416}, {34207, 33417}, {34203, 33418},
+    {34198, 33419}, {34292, 33420}, {34255, 33421}, {34294, 33422}, {34253, 33423}, {815, 33425}, {34188, 33426}, {34214, 33427},
+    {34298, 33428}, {2437, 33431}, {34299, 33432}, {34194, 33459}, {34194, 33460}, {34192, 33462}, {34192, 33463}, {602, 33468},
+    {2263, 33469}, {34304, 33470}, {1045, 33473}, {34363, 33474}, {34407, 33475}, {1356, 33477}, {2374, 33479}, {34423, 33480},
+    {34395, 33481}, {34309, 33482}, {44, 33484}, {34409, 33486}, {34419, 33487}, {915, 33488}, {34312, 33489}, {34355, 33490},
+    {34405, 33491}, {34431, 33492}, {34387, 33493}, {34425, 33494}, {34385, 33495}, {80, 33496}, {34319, 33497}, {34346, 33498},
+    {34420, 33499}, {34428, 33500}, {34428, 33501}, {2617, 33503}, {34324, 33504}, {34378, 33505}, {34424, 33506}, {34349, 33507},
+    {1224, 33510}, {34422, 33511}, {34422, 33512}, {34330, 33514}, {34337, 33515}, {34419, 33517}, {34409, 33518}, {1991, 33519},
+    {34417, 33521}, {34411, 33522}, {2068, 33523}, {34336, 33524}, {34331, 33525}, {34380, 33526}, {34378, 33527}, {34369, 33528},
+    {34341, 33529}, {34332, 33530}, {34377, 33531}, {34369, 33532}, {34380, 33533}, {2696, 33534}, {34346, 33535}, {2408, 33538},
+    {34399, 33539}, {34419, 33540}, {34349, 33541}, {34379, 33542}, {34369, 33543}, {34395, 33544}, {34370, 33545}, {34397, 33546},
+    {2110, 33547}, {34355, 33548}, {34411, 33549}, {34395, 33550}, {34316, 33551}, {34359, 33553}, {34306, 33554}, {34361, 33555},
+    {34304, 33556}, {34389, 33557}, {34389, 33558}, {34392, 33559}, {34366, 33560}, {34309, 33561}, {34368, 33562}, {34427, 33563},
+    {34348, 33564}, {34346, 33565}, {34337, 33566}, {370, 33568}, {34353, 33569}, {34329, 33570}, {34375, 33571}, {34418, 33573},
+    {34348, 33574}, {34339, 33575}, {34336, 33576}, {34338, 33577}, {34339, 33578}, {34337, 33579}, {34364, 33580}, {34319, 33581},
+    {34341, 33582}, {623, 33583}, {34386, 33584}, {34316, 33585}, {34362, 33586}, {34415, 33587}, {1804, 33588}, {34390, 33589},
+    {34360, 33591}, {34348, 33592}, {922, 33593}, {34359, 33594}, {34357, 33595}, {1322, 33597}, {34395, 33598}, {34406, 33599},
+    {34360, 33600}, {34404, 33601}, {34362, 33602}, {2335, 33604}, {381, 33605}, {34400, 33606}, {1369, 33607}, {34401, 33608},
+    {34402, 33609}, {34393, 33610}, {386, 33611}, {34404, 33612}, {34314, 33614}, {34322, 33615}, {2446, 33616}, {34312, 33618},
+    {34332, 33619}, {716, 33620}, {526, 33621}, {34409, 33622}, {1678, 33623}, {34410, 33624}, {2022, 33625}, {34411, 33626},
+    {34355, 33627}, {34307, 33628}, {34388, 33629}, {1403, 33630}, {34415, 33631}, {34351, 33632}, {34335, 33633}, {34376, 33634},
+    {499, 33636}, {34377, 33637}, {34347, 33638}, {34331, 33639}, {34308, 33648}, {34320, 33656}, {34321, 33640}, {34342, 33641},
+    {34324, 33642}, {34313, 33649}, {34331, 33657}, {34324, 33643}, {34320, 33644}, {34326, 33645}, {34537, 33778}, {34540, 33646},
+    {34529, 33664}, {34544, 33647}, {34522, 33650}, {34546, 33651}, {34520, 33652}, {75, 33653}, {34440, 33654}, {34483, 33655},
+    {34536, 33664}, {34543, 33658}, {34532, 33660}, {34552, 33661}, {1377, 33662}, {34531, 33663}, {34529, 33665}, {1142, 33667},
+    {34447, 33668}, {34448, 33669}, {34475, 33670}, {683, 33672}, {34450, 33673}, {34556, 33675}, {34528, 33676}, {1951, 33677},
+    {34453, 33678}, {34476, 33679}, {1441, 33681}, {34553, 33684}, {34551, 33685}, {34538, 33686}, {34501, 33687}, {34543, 33688},
+    {34553, 33690}, {34547, 33691}, {34468, 33692}, {34554, 33693}, {34458, 33694}, {34500, 33695}, {980, 33697}, {34503, 33698},
+    {34509, 33699}, {34462, 33700}, {34496, 33701}, {34460, 33703}, {34498, 33704}, {34497, 33705}, {34498, 33706}, {34500, 33707},
+    {566, 33709}, {34475, 33710}, {34454, 33711}, {34499, 33712}, {34497, 33713}, {34479, 33715}, {34442, 33716}, {34443, 33718},
+    {34519, 33719}, {34441, 33720}, {34513, 33721}, {34522, 33723}, {34498, 33724}, {2397, 33725}, {34520, 33727}, {34508, 33728},
+    {1321, 33729}, {34524, 33730}, {34516, 33731}, {1932, 33732}, {34491, 33733}, {34531, 33734}, {34515, 33735}, {34436, 33736},
+    {34513, 33737}, {34479, 33738}, {34497, 33740}, {34552, 33741}, {34477, 33742}, {34477, 33743}, {34464, 33744}, {1748, 33746},
+    {34473, 33749}, {34483, 33750}, {779, 33751}, {34471, 33754}, {34493, 33755}, {2468, 33756}, {34479, 33757}, {34469, 33758},
+    {1273, 33760}, {34488, 33761}, {34450, 33762}, {34510, 33763}, {34511, 33764}, {34538, 33765}, {34495, 33766}, {34491, 33767},
+    {34486, 33768}, {34490, 33769}, {34490, 33770}, {34540, 33772}, {34482, 33773}, {34520, 33774}, {34531, 33775}, {1182, 33777},
+    {429, 33780}, {34528, 33782}, {34494, 33783}, {34534, 33784}, {34488, 33785}, {34480, 33786}, {34480, 33787}, {276, 33790},
+    {34452, 33791}, {34494, 33792}, {34530, 33793}, {1795, 33795}, {2372, 33797}, {34438, 33798}, {34442, 33799}, {670, 33801},
+    {1286, 33803}, {34449, 33804}, {34489, 33805}, {34535, 33806}, {255, 33808}, {34439, 33810}, {34461, 33811}, {2280, 33812},
+    {34538, 33813}, {34513, 33814}, {34434, 33815}, {34434, 33816}, {34542, 33818}, {34517, 33819}, {34463, 33821}, {34437, 33822},
+    {2719, 33823}, {34461, 33825}, {34439, 33826}, {686, 33827}, {34548, 33828}, {34511, 33829}, {34456, 33830}, {34462, 33831},
+    {34461, 33832}, {34553, 33833}, {34496, 33834}, {34453, 33835}, {34453, 33836}, {34456, 33837}, {587, 33838}, {34558, 33839},
+    {1386, 33841}, {34458, 33842}, {34670, 33843}, {34666, 33844}, {34673, 33845}, {34668, 33846}, {385, 33847}, {34564, 33848},
+    {34650, 33849}, {34664, 33850}, {34621, 33851}, {34568, 33852}, {34611, 33853}, {34570, 33854}, {34609, 33855}, {34658, 33856},
+    {34660, 33857}, {34667, 33858}, {34575, 33859}, {34602, 33860}, {34687, 33861}, {34683, 33862}, {34678, 33863}, {34606, 33864},
+    {34672, 33865}, {34687, 33866}, {34684, 33867}, {34678, 33868}, {34679, 33869}, {34677, 33870}, {34664, 33871}, {34627, 33872},
+    {34665, 33873}, {267, 33874}, {34590, 33875}, {34672, 33877}, {34644, 33878}, {1434, 33879}, {34639, 33880}, {34637, 33881},
+    {347, 33883}, {34595, 33884}, {34590, 33885}, {34624, 33886}, {580, 33887}, {34598, 33888}, {34599, 33889}, {34578, 33890},
+    {34631, 33891}, {34629, 33892}, {34628, 33895}, {34648, 33896}, {568, 33897}, {1254, 33898}, {34605, 33899}, {555, 33900},
+    {34606, 33901}, {34672, 33902}, {34654, 33903}, {34571, 33904}, {95, 33905}, {34610, 33906}, {2323, 33907}, {34611, 33908},
+    {34651, 33910}, {34625, 33911}, {515, 33912}, {69, 33914}, {34643, 33915}, {34649, 33916}, {34653, 33917}, {34647, 33918},
+    {1216, 33921}, {34618, 33923}, {34561, 33924}, {34643, 33927}, {34633, 33928}, {2672, 33929}, {34640, 33931}, {34640, 33932},
+    {2207, 33934}, {34624, 33935}, {34607, 33936}, {34605, 33937}, {34608, 33938}, {34587, 33939}, {34609, 33940}, {1010, 33942},
+    {34630, 33943}, {34685, 33944}, {34605, 33945}, {34599, 33946}, {1343, 33948}, {34622, 33949}, {34580, 33950}, {34636, 33951},
+    {34600, 33953}, {34592, 33954}, {1780, 33955}, {34639, 33956}, {34622, 33957}, {34622, 33958}, {34620, 33960}, {34620, 33961},
+    {2476, 33963}, {34644, 33964}, {34570, 33965}, {34616, 33966}, {34669, 33967}, {1168, 33968}, {34648, 33969}, {34566, 33970},
+    {34612, 33971}, {34657, 33972}, {1753, 33974}, {34611, 33976}, {34601, 33977}, {1363, 33978}, {34660, 33979}, {34618, 33980},
+    {34569, 33981}, {34570, 33982}, {34572, 33983}, {1391, 33985}, {34583, 33986}, {34619, 33987}, {34661, 33988}, {1884, 33989},
+    {34662, 33990}, {419, 33991}, {34663, 33992}, {34615, 33993}, {34567, 33994}, {34640, 33995}, {2177, 33996}, {34667, 33997},
+    {468, 33998}, {34668, 33999}, {34610, 34000}, {34560, 34001}, {34645, 34002}, {34591, 34004}, {34565, 34005}, {1903, 34006},
+    {34674, 34007}, {34633, 34008}, {34586, 34009}, {34588, 34010}, {34579, 34011}, {34578, 34012}, {34582, 34013}, {34578, 34014},
+    {34569, 34015}, {34580, 34016}, {1956, 34018}, {34568, 34019}, {34594, 34020}, {34686, 34021}, {1243, 34023}, {34577, 34024},
+    {34799, 34025}, {34788, 34027}, {34796, 34028}, {1516, 34030}, {34691, 34031}, {34750, 34032}, {34693, 34033}, {34748, 34034},
+    {1867, 34037}, {2577, 34039}, {1879, 34040}, {34695, 34041}, {1968, 34043}, {34790, 34044}, {34790, 34045}, {34788, 34047},
+    {34788, 34048}, {2289, 34051}, {645, 34053}, {1084, 34055}, {34808, 34056}, {34770, 34057}, {34702, 34058}, {904, 34060},
+    {34811, 34061}, {34767, 34062}, {34705, 34063}, {34706, 34065}, {34791, 34066}, {34763, 34067}, {34814, 34068}, {34814, 34069},
+    {34809, 34070}, {34796, 34071}, {34758, 34072}, {34801, 34073}, {34803, 34074}, {34802, 34075}, {34754, 34076}, {34800, 34077},
+    {34797, 34080}, {34759, 34088}, {34760, 34078}, {34764, 34079}, {34764, 34081}, {34775, 34082}, {34810, 34083}, {34770, 34084},
+    {2730, 34086}, {34727, 34087}, {34706, 34089}, {34759, 34090}, {34757, 34091}, {34766, 34093}, {34754, 34094}, {874, 34096},
+    {1958, 34097}, {34733, 34098}, {1181, 34100}, {34752, 34101}, {34752, 34102}, {2484, 34104}, {34736, 34105}, {34772, 34107},
+    {34780, 34108}, {34776, 34109}, {34759, 34110}, {34778, 34111}, {34700, 34112}, {34770, 34113}, {34744, 34114}, {34691, 34115},
+    {34746, 34116}, {34689, 34117}, {34694, 34119}, {34776, 34120}, {34750, 34121}, {34693, 34122}, {34752, 34123}, {34811, 34124},
+    {34732, 34125}, {34730, 34126}, {34721, 34127}, {797, 34129}, {34757, 34130}, {34723, 34131}, {34729, 34132}, {60, 34133},
+    {34760, 34134}, {34761, 34135}, {34800, 34136}, {34763, 34137}, {34806, 34138}, {34723, 34139}, {34721, 34140}, {34721, 34142},
+    {34751, 34143}, {34795, 34145}, {34743, 34146}, {678, 34148}, {34727, 34149}, {34699, 34150}, {34773, 34151}, {34739, 34152},
+    {34745, 34153}, {1841, 34154}, {34776, 34155}, {34694, 34156}, {34740, 34157}, {34785, 34158}, {34738, 34160}, {34738, 34161},
+    {34736, 34163}, {34736, 34164}, {34778, 34166}, {34692, 34167}, {34701, 34169}, {34711, 34170}, {1840, 34171}, {993, 34172},
+    {34788, 34173}, {34746, 34174}, {34696, 34175}, {34781, 34176}, {34701, 34177}, {34695, 34178}, {34794, 34179}, {34769, 34180},
+    {1751, 34181}, {34796, 34182}, {34797, 34185}, {34772, 34186}, {34799, 34187}, {34762, 34188}, {34708, 34189}, {34716, 34190},
+    {34716, 34192}, {34688, 34193}, {86, 34194}, {34767, 34197}, {34707, 34198}, {34712, 34201}, {34700, 34202}, {2380, 34203},
+    {34711, 34205}, {34709, 34206}, {2580, 34208}, {34811, 34209}, {34713, 34210}, {34707, 34211}, {581, 34212}, {34814, 34213},
+    {34705, 34214}, {34927, 34215}, {34927, 34217}, {34925, 34218}, {1149, 34220}, {34819, 34221}, {34907, 34222}, {34923, 34223},
+    {34876, 34224}, {1069, 34225}, {34823, 34226}, {34903, 34227}, {34919, 34228}, {34864, 34229}, {886, 34231}, {34865, 34233},
+    {34921, 34234}, {34916, 34235}, {34917, 34236}, {34913, 34237}, {699, 34239}, {34916, 34240}, {34894, 34241}, {34834, 34242},
+    {2618, 34243}, {34835, 34244}, {2492, 34245}, {34836, 34246}, {34890, 34247}, {34936, 34248}, {34861, 34249}, {396, 34250},
+    {34840, 34251}, {34886, 34252}, {34932, 34253}, {34849, 34254}, {34844, 34255}, {34855, 34256}, {34928, 34257}, {34934, 34258},
+    {34885, 34259}, {34884, 34260}, {34892, 34261}, {34888, 34262}, {34903, 34263}, {34890, 34264}, {2586, 34266}, {34888, 34267},
+    {34888, 34268}, {34893, 34270}, {34887, 34271}, {1692, 34273}, {34858, 34274}, {34833, 34275}, {2770, 34277}, {284, 34278},
+    {34860, 34279}, {34888, 34280}, {34880, 34281}, {34881, 34282}, {34911, 34283}, {2320, 34286}, {1208, 34288}, {34885, 34289},
+    {34925, 34290}, {34867, 34291}, {1380, 34293}, {1184, 34295}, {34906, 34296}, {34906, 34297}, {34828, 34300}, {34898, 34301},
+    {34818, 34302}, {34908, 34303}, {1683, 34305}, {34874, 34306}, {34901, 34307}, {34899, 34308}, {34904, 34310}, {34896, 34311},
+    {2200, 34313}, {34906, 34314}, {34862, 34315}, {34858, 34316}, {34865, 34317}, {34860, 34318}, {2636, 34320}, {34884, 34321},
+    {34943, 34322}, {34851, 34323}, {34856, 34325}, {34876, 34326}, {409, 34327}, {34931, 34328}, {34863, 34329}, {1562, 34331},
+    {34862, 34332}, {34850, 34333}, {34856, 34334}, {34848, 34335}, {819, 34337}, {34875, 34338}, {34831, 34339}, {34897, 34340},
+    {856, 34342}, {34854, 34343}, {34828, 34344}, {34900, 34345}, {34875, 34347}, {34873, 34348}, {34903, 34350}, {34914, 34351},
+    {34871, 34352}, {34867, 34353}, {34878, 34354}, {34867, 34356}, {34857, 34357}, {2582, 34358}, {1555, 34360}, {984, 34362},
+    {34858, 34363}, {34816, 34364}, {34912, 34365}, {305, 34367}, {2336, 34369}, {34837, 34370}, {34877, 34371}, {34915, 34372},
+    {34826, 34373}, {34826, 34374}, {2324, 34376}, {34918, 34377}, {34872, 34378}, {34822, 34379}, {34899, 34380}, {34896, 34381},
+    {34830, 34382}, {34821, 34383}, {34822, 34384}, {34816, 34385}, {34816, 34387}, {34820, 34388}, {2504, 34389}, {34836, 34391},
+    {34844, 34392}, {34889, 34393}, {34833, 34394}, {122, 34396}, {34933, 34397}, {2596, 34398}, {34934, 34399}, {2526, 34403},
+    {34834, 34405}, {34838, 34406}, {34844, 34407}, {34836, 34408}, {34836, 34412}, {34824, 34413}, {138, 34414}, {34834, 34416},
+    {34826, 34417}, {2570, 34418}, {329, 34419}, {34832, 34420}, {35060, 34421}, {35038, 34422}, {35062, 34423}, {35036, 34424},
+    {35051, 34425}, {35057, 34426}, {35033, 34427}, {35059, 34428}, {35031, 34429}, {35069, 34430}, {35029, 34431}, {35040, 34432},
+    {35044, 34433}, {35043, 34434}, {35051, 34435}, {35041, 34436}, {35067, 34437}, {35042, 34438}, {35069, 34439}, {1731, 34441},
+    {34963, 34442}, {35057, 34443}, {35067, 34444}, {34988, 34445}, {35058, 34446}, {106, 34449}, {35069, 34451}, {35063, 34452},
+    {2125, 34454}, {34976, 34455}, {35070, 34456}, {35061, 34457}, {35062, 34458}, {35056, 34459}, {34975, 34460}, {34970, 34461},
+    {2387, 34462}, {34977, 34463}, {183, 34464}, {34978, 34465}, {34979, 34466}, {34974, 34467}, {131, 34468}, {34981, 34469},
+    {2784, 34470}, {34982, 34471}, {35064, 34472}, {35014, 34473}, {34963, 34474}, {212, 34476}, {34960, 34477}, {35022, 34478},
+    {2781, 34480}, {393, 34481}, {34988, 34482}, {1561, 34483}, {34989, 34484}, {35019, 34485}, {35009, 34486}, {35029, 34487},
+    {35039, 34488}, {34994, 34489}, {34953, 34490}, {35035, 34492}, {35009, 34493}, {2767, 34494}, {34956, 34495}, {35026, 34496},
+    {1905, 34498}, {35020, 34499}, {35046, 34500}, {35002, 34501}, {35038, 34502}, {35026, 34503}, {35032, 34504}, {35024, 34505},
+    {35007, 34506}, {35066, 34507}, {34991, 34508}, {34989, 34509}, {2229, 34512}, {34999, 34513}, {34971, 34514}, {35013, 34515},
+    {35068, 34516}, {34978, 34517}, {2463, 34518}, {35016, 34519}, {2519, 34521}, {2537, 34522}, {35017, 34523}, {2028, 34524},
+    {35018, 34525}, {35057, 34526}, {34985, 34527}, {34979, 34528}, {34977, 34529}, {35023, 34531}, {35050, 34532}, {35007, 34533},
+    {35005, 34534}, {34998, 34536}, {35002, 34537}, {1161, 34539}, {35055, 34540}, {34995, 34541}, {1415, 34543}, {34994, 34544},
+    {34998, 34545}, {35004, 34546}, {34996, 34547}, {280, 34549}, {34991, 34550}, {34947, 34551}, {35037, 34552}, {689, 34554},
+    {34986, 34555}, {34944, 34556}, {35040, 34557}, {35041, 34559}, {35032, 34560}, {34957, 34561}, {34957, 34562}, {34944, 34563},
+    {34953, 34565}, {34963, 34566}, {1769, 34567}, {823, 34569}, {1159, 34571}, {34972, 34572}, {34998, 34573}, {35050, 34574},
+    {1196, 34576}, {34975, 34577}, {34995, 34578}, {35053, 34579}, {1288, 34580}, {35054, 34581}, {34992, 34582}, {34974, 34583},
+    {35019, 34584}, {35016, 34585}, {34966, 34586}, {34973, 34587}, {34974, 34588}, {34968, 34589}, {34962, 34591}, {34966, 34592},
+    {35011, 34593}, {34975, 34594}, {205, 34596}, {35067, 34597}, {1881, 34600}, {35014, 34601}, {34968, 34602}, {34971, 34603},
+    {34961, 34604}, {35183, 34607}, {35189, 34608}, {539, 34609}, {35175, 34612}, {35181, 34613}, {35076, 34614}, {35135, 34615},
+    {35078, 34616}, {35133, 34617}, {2256, 34619}, {35181, 34620}, {35175, 34621}, {35120, 34622}, {35182, 34623}, {35126, 34625},
+    {35176, 34626}, {35175, 34627}, {35172, 34628}, {35198, 34629}, {76, 34631}, {35089, 34632}, {35112, 34633}, {35197, 34634},
+    {35195, 34635}, {35093, 34637}, {35116, 34638}, {35117, 34640}, {35197, 34641}, {35107, 34642}, {35199, 34643}, {35188, 34645},
+    {35176, 34646}, {772, 34647}, {35186, 34649}, {35178, 34650}, {1359, 34651}, {35194, 34652}, {35150, 34653}, {1971, 34654},
+    {35105, 34655}, {35197, 34656}, {35149, 34657}, {35102, 34658}, {35147, 34659}, {35145, 34660}, {35144, 34664}, {35164, 34665},
+    {1166, 34666}, {35142, 34669}, {35166, 34670}, {795, 34671}, {35150, 34672}, {35138, 34673}, {1188, 34675}, {35161, 34676},
+    {35185, 34677}, {35119, 34678}, {35120, 34679}, {35083, 34680}, {35164, 34681}, {35162, 34682}, {35153, 34683}, {35163, 34684},
+    {35161, 34685}, {35085, 34687}, {35165, 34688}, {35129, 34689}, {35072, 34690}, {2073, 34692}, {1341, 34694}, {35073, 34696},
+    {35161, 34697}, {35079, 34698}, {35163, 34699}, {35153, 34700}, {35119, 34701}, {35119, 34703}, {35117, 34704}, {35117, 34707},
+    {35115, 34708}, {35126, 34709}, {35097, 34710}, {35123, 34711}, {35110, 34712}, {35110, 34713}, {35129, 34714}, {35092, 34715},
+    {35128, 34716}, {35106, 34717}, {35130, 34718}, {35088, 34719}, {35108, 34720}, {35086, 34721}, {35176, 34722}, {35126, 34723},
+    {35133, 34724}, {35134, 34725}, {35128, 34726}, {455, 34728}, {35181, 34729}, {35133, 34730}, {35161, 34731}, {35168, 34732},
+    {35169, 34734}, {35129, 34735}, {35165, 34737}, {35172, 34738}, {35121, 34739}, {35081, 34740}, {35076, 34741}, {169, 34742},
+    {35170, 34743}, {1337, 34745}, {2246, 34747}, {525, 34748}, {35171, 34749}, {606, 34751}, {2337, 34753}, {35088, 34754},
+    {35130, 34755}, {35174, 34756}, {35175, 34758}, {35154, 34759}, {1, 34762}, {1573, 34764}, {35155, 34765}, {35087, 34766},
+    {35153, 34767}, {35081, 34768}, {2130, 34769}, {35181, 34770}, {35072, 34771}, {35072, 34772}, {35184, 34774}, {35147, 34775},
+    {35101, 34777}, {35079, 34778}, {2106, 34779}, {35150, 34780}, {35088, 34781}, {35148, 34782}, {35090, 34783}, {1025, 34784},
+    {35192, 34785}, {35100, 34786}, {35092, 34787}, {35092, 34789}, {35080, 34790}, {247, 34791}, {35197, 34792}, {35140, 34793},
+    {257, 34795}, {2543, 34798}, {1388, 34800}, {35199, 34801}, {35258, 34802}, {35300, 34803}, {35308, 34804}, {1011, 34805},
+    {35203, 34806}, {35297, 34807}, {35307, 34808}, {35260, 34809}, {35298, 34810}, {35208, 34812}, {35251, 34813}, {35248, 34815},
+    {35310, 34816}, {35254, 34817}, {35304, 34818}, {35297, 34820}, {35323, 34821}, {459, 34822}, {35327, 34824}, {35301, 34825},
+    {1278, 34826}, {323, 34827}, {35218, 34828}, {35276, 34829}, {35322, 34830}, {35247, 34831}, {35320, 34832}, {35320, 34833},
+    {35319, 34837}, {35309, 34838}, {1111, 34839}, {35317, 34841}, {35311, 34842}, {2083, 34843}, {130, 34845}, {35304, 34846},
+    {35266, 34847}, {35230, 34848}, {35231, 34849}, {35226, 34850}, {35279, 34851}, {35275, 34852}, {35270, 34853}, {35230, 34854},
+    {35264, 34855}, {35238, 34856}, {35229, 34857}, {1451, 34859}, {35240, 34861}, {35219, 34862}, {35216, 34863}, {35278, 34864},
+    {35266, 34865}, {35266, 34866}, {35220, 34868}, {35274, 34869}, {1389, 34870}, {35248, 34871}, {1563, 34872}, {35249, 34873},
+    {35208, 34875}, {35286, 34876}, {35252, 34877}, {35215, 34878}, {35254, 34879}, {35213, 34880}, {35286, 34881}, {35280, 34882},
+    {35295, 34883}, {534, 34885}, {35259, 34886}, {35289, 34887}, {35283, 34888}, {1031, 34889}, {35262, 34890}, {35263, 34891},
+    {35322, 34892}, {35265, 34893}, {35320, 34894}, {35245, 34895}, {35243, 34896}, {35243, 34898}, {35241, 34899}, {35325, 34901},
+    {35245, 34902}, {25, 34904}, {35261, 34905}, {35221, 34906}, {35275, 34907}, {35241, 34908}, {35235, 34909}, {35232, 34910},
+    {35232, 34911}, {35262, 34913}, {35262, 34914}, {35304, 34916}, {35254, 34917}, {35259, 34919}, {35233, 34920}, {198, 34921},
+    {777, 34922}, {35286, 34923}, {35208, 34924}, {35254, 34925}, {35299, 34926}, {35263, 34927}, {35253, 34928}, {35292, 34929},
+    {35303, 34930}, {962, 34931}, {35294, 34932}, {35295, 34935}, {35290, 34936}, {35297, 34937}, {35288, 34938}, {35206, 34939},
+    {35210, 34940}, {35200, 34941}, {35208, 34942}, {35202, 34943}, {35206, 34944}, {35202, 34945}, {35225, 34946}, {35204, 34947},
+    {35209, 34948}, {35203, 34949}, {35205, 34950}, {35228, 34951}, {35231, 34952}, {35231, 34953}, {35229, 34954}, {35200, 34955},
+    {35243, 34956}, {35201, 34957}, {35318, 34958}, {35277, 34959}, {35222, 34960}, {35216, 34961}, {35231, 34962}, {35323, 34964},
+    {35270, 34965}, {1781, 34966}, {35325, 34967}, {35326, 34968}, {35269, 34969}, {2120, 34970}, {35328, 34971}, {35422, 34972},
+    {35436, 34973}, {35385, 34974}, {1280, 34976}, {1117, 34980}, {35435, 34983}, {35441, 34984}, {1889, 34985}, {1001, 34986},
+    {35334, 34987}, {35335, 34990}, {35378, 34991}, {35337, 34992}, {35376, 34993}, {1366, 34995}, {35438, 34996}, {35426, 34997},
+    {1079, 34998}, {35341, 34999}, {35424, 35000}, {35424, 35001}, {35344, 35003}, {35371, 35004}, {35346, 35005}, {35369, 35006},
+    {1808, 35008}, {35374, 35009}, {35440, 35010}, {35448, 35011}, {35448, 35012}, {2759, 35014}, {35352, 35015}, {289, 35019},
+    {35353, 35020}, {35360, 35021}, {35454, 35022}, {2193, 35024}, {35366, 35025}, {35448, 35026}, {35358, 35027}, {35365, 35028},
+    {1684, 35029}, {35360, 35030}, {35361, 35031}, {35352, 35032}, {35363, 35033}, {35358, 35034}, {35403, 35035}, {35401, 35036},
+    {35401, 35038}, {35399, 35039}, {1195, 35042}, {35421, 35043}, {35445, 35044}, {35371, 35045}, {35401, 35046}, {35395, 35047},
+    {35392, 35048}, {35392, 35049}, {35422, 35051}, {35422, 35052}, {35421, 35055}, {35399, 35056}, {243, 35057}, {2180, 35058},
+    {35380, 35059}, {35434, 35060}, {35416, 35061}, {35341, 35062}, {35384, 35063}, {35331, 35064}, {2004, 35065}, {35386, 35066},
+    {377, 35068}, {35387, 35069}, {35388, 35070}, {35335, 35071}, {35419, 35072}, {35409, 35073}, {35392, 35074}, {35451, 35075},
+    {1030, 35077}, {1695, 35079}, {35394, 35080}, {35449, 35081}, {1876, 35082}, {35396, 35083}, {259, 35084}, {35397, 35085},
+    {35353, 35086}, {35369, 35087}, {35442, 35088}, {2579, 35090}, {35443, 35091}, {35375, 35092}, {394, 35094}, {707, 35095},
+    {35403, 35096}, {682, 35097}, {35404, 35098}, {35368, 35099}, {35360, 35100}, {35370, 35101}, {35390, 35102}, {35409, 35103},
+    {35432, 35104}, {35388, 35106}, {35360, 35107}, {1553, 35108}, {35439, 35109}, {35379, 35110}, {35378, 35111}, {35382, 35112},
+    {35388, 35113}, {35380, 35114}, {35419, 35115}, {35430, 35116}, {35379, 35117}, {35377, 35118}, {2771, 35121}, {35371, 35122},
+    {35391, 35123}, {35425, 35124}, {35416, 35125}, {35334, 35126}, {598, 35127}, {35428, 35128}, {2059, 35130}, {2199, 35131},
+    {35429, 35132}, {1249, 35133}, {35430, 35134}, {35421, 35135}, {35341, 35136}, {35411, 35137}, {35343, 35138}, {35409, 35139},
+    {35337, 35140}, {35332, 35141}, {35333, 35142}, {35329, 35143}, {35402, 35144}, {35348, 35145}, {35355, 35146}, {35352, 35147},
+    {35354, 35148}, {35344, 35149}, {35352, 35150}, {35356, 35151}, {35339, 35152}, {35350, 35153}, {616, 35154}, {35450, 35155},
+    {35364, 35156}, {35346, 35157}, {35399, 35158}, {613, 35159}, {35454, 35160}, {234, 35162}, {746, 35163}, {35455, 35164},
+    {2127, 35166}, {35572, 35167}, {35550, 35168}, {35458, 35169}, {35565, 35172}, {35563, 35173}, {1735, 35176}, {871, 35177},
+    {35461, 35178}, {108, 35179}, {35462, 35180}, {35517, 35182}, {35565, 35183}, {852, 35185}, {35564, 35186}, {35556, 35187},
+    {624, 35188}, {35467, 35189}, {917, 35190}, {35468, 35191}, {35469, 35193}, {35508, 35194}, {35562, 35195}, {35582, 35196},
+    {884, 35198}, {955, 35200}, {35473, 35201}, {35496, 35202}, {35475, 35204}, {35502, 35205}, {2009, 35206}, {35477, 35207},
+    {2007, 35209}, {1490, 35210}, {35478, 35211}, {94, 35212}, {35479, 35213}, {35581, 35214}, {35575, 35215}, {35583, 35216},
+    {35573, 35217}, {35571, 35219}, {35561, 35220}, {2799, 35221}, {35492, 35222}, {35578, 35223}, {35525, 35224}, {35535, 35225},
+    {35527, 35226}, {35533, 35227}, {35530, 35228}, {35530, 35229}, {171, 35232}, {35538, 35233}, {35576, 35234}, {35496, 35235},
+    {40, 35236}, {35497, 35237}, {1064, 35239}, {154, 35241}, {478, 35242}, {35498, 35243}, {35473, 35244}, {35529, 35245},
+    {2267, 35246}, {35501, 35247}, {675, 35250}, {35502, 35251}, {1852, 35253}, {2104, 35255}, {35547, 35256}, {35567, 35257},
+    {35505, 35258}, {35506, 35260}, {35465, 35261}, {379, 35264}, {2710, 35266}, {35470, 35267}, {35536, 35268}, {35468, 35269},
+    {35538, 35270}, {1957, 35271}, {35512, 35272}, {35543, 35273}, {35541, 35274}, {35515, 35276}, {35462, 35277}, {35463, 35278},
+    {35547, 35279}, {35461, 35280}, {35493, 35281}, {1008, 35282}, {35521, 35283}, {35495, 35284}, {35501, 35285}, {35499, 35287},
+    {35505, 35288}, {2642, 35289}, {35526, 35290}, {35581, 35291}, {90, 35293}, {770, 35296}, {677, 35298}, {35528, 35299},
+    {35571, 35300}, {35530, 35301}, {35569, 35302}, {35532, 35303}, {35575, 35304}, {35488, 35305}, {35494, 35306}, {35509, 35307},
+    {35537, 35308}, {35560, 35309}, {35517, 35310}, {35517, 35311}, {35504, 35312}, {35564, 35313}, {35506, 35314}, {35505, 35315},
+    {35506, 35316}, {35508, 35317}, {1625, 35319}, {35503, 35320}, {35459, 35321}, {35549, 35322}, {2286, 35324}, {504, 35327},
+    {35505, 35329}, {35499, 35330}, {1371, 35331}, {35461, 35332}, {35471, 35333}, {522, 35336}, {2143, 35338}, {35554, 35339},
+    {35545, 35340}, {35550, 35342}, {35456, 35343}, {260, 35345}, {2266, 35347}, {1538, 35348}, {35558, 35349}, {35549, 35350},
+    {35469, 35351}, {1231, 35354}, {35561, 35355}, {107, 35356}, {35562, 35357}, {1477, 35359}, {679, 35362}, {972, 35364},
+    {35537, 35365}, {35465, 35366}, {35543, 35367}, {35467, 35368}, {35457, 35369}, {35487, 35370}, {35569, 35372}, {35528, 35373},
+    {35529, 35374}, {35473, 35375}, {35535, 35376}, {35475, 35377}, {35474, 35378}, {35478, 35379}, {35478, 35381}, {35470, 35382},
+    {726, 35383}, {65, 35385}, {350, 35389}, {35579, 35390}, {35526, 35391}, {163, 35393}, {2673, 35395}, {35474, 35398},
+    {35466, 35399}, {1387, 35400}, {1786, 35401}, {35583, 35402}, {35584, 35405}, {35643, 35406}, {35586, 35407}, {35641, 35408},
+    {270, 35410}, {35681, 35411}, {35691, 35412}, {2227, 35413}, {35590, 35414}, {35591, 35415}, {35634, 35416}, {35593, 35417},
+    {35632, 35418}, {1123, 35420}, {35633, 35421}, {35689, 35422}, {35683, 35423}, {35681, 35424}, {2306, 35426}, {35599, 35427},
+    {2322, 35431}, {35600, 35432}, {532, 35433}, {35601, 35434}, {1345, 35435}, {35602, 35436}, {35660, 35437}, {35706, 35438},
+    {35631, 35439}, {1034, 35440}, {35606, 35441}, {35656, 35442}, {35702, 35443}, {35619, 35444}, {35610, 35445}, {35617, 35446},
+    {35698, 35447}, {35700, 35448}, {35707, 35449}, {35696, 35451}, {35668, 35452}, {2257, 35453}, {35663, 35456}, {35661, 35457},
+    {35609, 35459}, {35649, 35460}, {1718, 35463}, {35621, 35464}, {35622, 35465}, {35613, 35466}, {1501, 35470}, {35624, 35471},
+    {35603, 35472}, {87, 35474}, {1915, 35476}, {35626, 35480}, {35601, 35481}, {35628, 35482}, {35607, 35483}, {35659, 35484},
+    {35649, 35485}, {1743, 35486}, {35632, 35487}, {35633, 35488}, {35592, 35489}, {35635, 35490}, {35598, 35491}, {35599, 35492},
+    {35667, 35493}, {35673, 35494}, {35671, 35495}, {712, 35499}, {35641, 35500}, {35668, 35503}, {35668, 35504}, {9, 35507},
+    {1883, 35508}, {35644, 35509}, {2575, 35510}, {35645, 35511}, {35588, 35513}, {35674, 35514}, {1569, 35516}, {1963, 35517},
+    {35648, 35518}, {2804, 35519}, {35649, 35520}, {35650, 35522}, {35705, 35523}, {35617, 35524}, {35627, 35525}, {489, 35527},
+    {390, 35529}, {2717, 35531}, {41, 35533}, {35634, 35534}, {35608, 35535}, {35656, 35536}, {2350, 35538}, {35645, 35539},
+    {35605, 35540}, {35659, 35541}, {2405, 35542}, {35660, 35543}, {35602, 35544}, {35616, 35545}, {35701, 35546}, {35646, 35547},
+    {35646, 35548}, {35639, 35550}, {35645, 35551}, {35668, 35552}, {35695, 35553}, {590, 35555}, {1998, 35556}, {35670, 35557},
+    {1252, 35559}, {35671, 35560}, {1994, 35563}, {35672, 35564}, {2235, 35565}, {35673, 35566}, {35680, 35567}, {35646, 35568},
+    {1283, 35570}, {2690, 35571}, {35676, 35572}, {1929, 35573}, {35677, 35574}, {35678, 35575}, {35685, 35576}, {35589, 35577},
+    {35599, 35578}, {1744, 35580}, {35591, 35581}, {35597, 35582}, {428, 35585}, {2400, 35587}, {35684, 35588}, {35679, 35589},
+    {358, 35592}, {2478, 35594}, {207, 35595}, {35686, 35596}, {35677, 35597}, {35597, 35598}, {35590, 35603}, {35614, 35604},
+    {383, 35605}, {35588, 35607}, {35608, 35608}, {2042, 35609}, {2556, 35611}, {35609, 35612}, {35633, 35613}, {35695, 35614},
+    {35605, 35615}, {35615, 35616}, {35656, 35617}, {35606, 35618}, {2413, 35619}, {35700, 35620}, {639, 35623}, {1212, 35625},
+    {1460, 35627}, {565, 35629}, {35701, 35630}, {35660, 35631}, {126, 35634}, {567, 35636}, {724, 35637}, {35703, 35638},
+    {35650, 35639}, {35612, 35640}, {35648, 35642}, {35614, 35643}, {1306, 35646}, {35708, 35647}, {796, 35651}, {35709, 35652},
+    {35652, 35653}, {35601, 35654}, {35823, 35655}, {35823, 35657}, {35821, 35658}, {35820, 35661}, {35824, 35662}, {2513, 35663},
+    {35775, 35664}, {35811, 35665}, {35719, 35666}, {35762, 35667}, {2629, 35669}, {2496, 35674}, {35721, 35675}, {204, 35679},
+    {35722, 35680}, {35761, 35681}, {35724, 35682}, {35767, 35683}, {1747, 35685}, {812, 35687}, {35726, 35688}, {35818, 35689},
+    {35838, 35690}, {35828, 35691}, {35836, 35692}, {35837, 35693}, {35835, 35694}, {35733, 35696}, {35756, 35697}, {252, 35698},
+    {35735, 35699}, {1135, 35702}, {2600, 35704}, {35736, 35705}, {963, 35706}, {35737, 35707}, {2536, 35710}, {35744, 35711},
+    {35838, 35712}, {35750, 35713}, {35832, 35714}, {35835, 35715}, {35825, 35716}, {981, 35717}, {35744, 35718}, {2747, 35720},
+    {2662, 35723}, {1704, 35725}, {35745, 35727}, {35736, 35728}, {35747, 35729}, {35742, 35730}, {35743, 35731}, {35779, 35732},
+    {1728, 35734}, {1456, 35738}, {35751, 35739}, {942, 35740}, {35752, 35741}, {35753, 35742}, {35728, 35743}, {2346, 35746},
+    {2100, 35748}, {2448, 35749}, {35755, 35750}, {1179, 35754}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+};
+TURBO_DLL extern const size_t EMOJI_NAMES_EN_TRIE_SIZE = 35840;
+
+TURBO_DLL extern const DoubleArrayUnit EMOJI_ALIAS_NAMES_EN_TRIE[] = {
+    {59, -1}, {41, 0}, {50, 1}, {52, 2}, {52, 1}, {42, 4}, {65, 17}, {20, 118},
+    {38, 24}, {263, 77}, {47, 24}, {466, 88}, {590, 81}, {1, 77}, {660, 3}, {136, 65},
+    {671, 5}, {100, 1}, {256, 77}, {483, 65}, {476, 77}, {440, 65}, {670, 8}, {366, 67},
+    {56, 1}, {489, 67}, {328, 77}, {426, 65}, {668, 10}, {362, 67}, {297, 77}, {461, 65},
+    {706, 6}, {108, 74}, {525, 83}, {39, 72}, {315, 74}, {655, 7}, {540, 83}, {866, 35},
+    {241, 75}, {258, 74}, {483, 74}, {734, 122}, {232, 74}, {336, 74}, {759, 83}, {259, 75},
+    {366, 74}, {725, 125}, {446, 69}, {206, 75}, {394, 69}, {257, 75}, {129, 75}, {449, 74},
+    {685, 124}, {695, 112}, {384, 69}, {288, 75}, {52, 74}, {746, 83}, {609, 69}, {382, 75},
+    {2, 1}, {122, 1}, {193, 1}, {120, 1}, {184, 1}, {91, 1}, {145, 1}, {161, 1},
+    {25, 1}, {671, 105}, {69, 1}, {90, 1}, {223, 1}, {123, 1}, {226, 1}, {224, 1},
+    {11, 1}, {54, 1}, {661, 104}, {71, 1}, {664, 106}, {319, 96}, {830, 33}, {795, 60},
+    {126, 1}, {183, 1}, {353, 1}, {166, 1}, {304, 1}, {321, 1}, {322, 1}, {131, 1},
+    {85, 75}, {169, 64}, {572, 80}, {662, 116}, {656, 107}, {921, 13}, {313, 64}, {969, 128},
+    {39, 72}, {57, 72}, {32, 72}, {13, 72}, {386, 64}, {210, 72}, {541, 80}, {165, 64},
+    {75, 72}, {652, 116}, {178, 64}, {927, 190}, {1, 72}, {248, 72}, {88, 1}, {252, 72},
+    {140, 64}, {825, 107}, {72, 72}, {169, 72}, {74, 72}, {92, 72}, {522, 80}, {665, 107},
+    {56, 76}, {484, 79}, {337, 68}, {214, 78}, {924, 184}, {487, 79}, {822, 44}, {177, 78},
+    {712, 119}, {455, 79}, {174, 78}, {129, 78}, {467, 79}, {132, 78}, {164, 78}, {423, 79},
+    {507, 78}, {696, 117}, {416, 79}, {694, 123}, {842, 40}, {279, 79}, {975, 182}, {151, 78},
+    {854, 40}, {675, 117}, {823, 44}, {654, 119}, {812, 44}, {692, 117}, {838, 40}, {641, 119},
+    {348, 66}, {894, 51}, {970, 181}, {339, 70}, {327, 66}, {837, 51}, {210, 76}, {129, 76},
+    {300, 66}, {209, 76}, {194, 76}, {380, 70}, {969, 179}, {874, 51}, {452, 66}, {300, 66},
+    {960, 170}, {357, 76}, {295, 76}, {201, 76}, {962, 169}, {199, 76}, {241, 76}, {905, 166},
+    {227, 76}, {497, 95}, {660, 109}, {958, 131}, {837, 51}, {663, 109}, {1, 76}, {707, 109},
+    {427, 71}, {942, 138}, {588, 89}, {526, 91}, {396, 71}, {578, 89}, {351, 71}, {514, 91},
+    {436, 71}, {738, 91}, {827, 123}, {896, 142}, {1109, 97}, {458, 68}, {605, 71}, {555, 91},
+    {942, 135}, {499, 68}, {615, 89}, {625, 91}, {275, 71}, {1076, 111}, {547, 89}, {578, 68},
+    {562, 89}, {611, 68}, {1144, 114}, {460, 89}, {1083, 135}, {629, 68}, {582, 89}, {456, 89},
+    {884, 54}, {386, 70}, {989, 167}, {396, 70}, {495, 70}, {919, 141}, {392, 95}, {938, 139},
+    {898, 141}, {409, 70}, {643, 95}, {635, 95}, {579, 95}, {1139, 120}, {874, 54}, {1135, 15},
+    {520, 95}, {960, 167}, {618, 70}, {947, 139}, {839, 54}, {280, 70}, {916, 151}, {280, 70},
+    {275, 70}, {983, 151}, {391, 70}, {1121, 15}, {455, 70}, {495, 70}, {924, 151}, {569, 70},
+    {540, 90}, {919, 177}, {747, 90}, {1035, 102}, {746, 90}, {652, 92}, {699, 92}, {723, 92},
+    {399, 90}, {533, 90}, {554, 90}, {1141, 29}, {754, 90}, {759, 90}, {706, 90}, {567, 90},
+    {869, 63}, {707, 90}, {892, 63}, {971, 177}, {569, 90}, {710, 90}, {628, 90}, {1062, 23},
+    {744, 90}, {870, 63}, {822, 63}, {820, 63}, {1001, 48}, {769, 48}, {792, 48}, {873, 63},
+    {674, 93}, {515, 94}, {807, 45}, {876, 94}, {721, 93}, {803, 45}, {1003, 26}, {690, 94},
+    {712, 93}, {679, 93}, {697, 94}, {595, 94}, {493, 93}, {642, 94}, {676, 93}, {799, 26},
+    {560, 94}, {800, 45}, {437, 93}, {682, 93}, {584, 93}, {808, 45}, {627, 93}, {473, 93},
+    {856, 41}, {826, 45}, {1005, 26}, {1007, 26}, {1007, 26}, {1151, 160}, {1060, 164}, {860, 45},
+    {541, 92}, {1136, 168}, {644, 59}, {661, 59}, {658, 59}, {1095, 175}, {962, 178}, {867, 59},
+    {966, 178}, {775, 36}, {994, 30}, {812, 36}, {873, 59}, {868, 59}, {876, 59}, {885, 36},
+    {857, 36}, {1147, 130}, {855, 59}, {887, 59}, {865, 59}, {800, 36}, {807, 36}, {804, 36},
+    {847, 36}, {1004, 30}, {1013, 30}, {1003, 30}, {1123, 102}, {402, 92}, {641, 92}, {1107, 168},
+    {849, 53}, {994, 18}, {1004, 9}, {785, 41}, {789, 47}, {1129, 198}, {1019, 9}, {1070, 212},
+    {975, 9}, {1138, 163}, {860, 47}, {812, 41}, {838, 53}, {771, 41}, {835, 53}, {852, 47},
+    {768, 47}, {843, 47}, {954, 149}, {1008, 18}, {854, 53}, {850, 53}, {787, 53}, {831, 41},
+    {784, 53}, {959, 149}, {1000, 18}, {948, 149}, {342, 171}, {1051, 245}, {1055, 247}, {1064, 248},
+    {783, 42}, {924, 19}, {974, 133}, {1018, 20}, {926, 19}, {771, 42}, {970, 133}, {932, 129},
+    {984, 129}, {988, 129}, {1138, 25}, {1243, 253}, {785, 42}, {781, 42}, {770, 42}, {770, 42},
+    {1080, 209}, {775, 42}, {900, 144}, {954, 42}, {947, 42}, {969, 133}, {780, 42}, {962, 129},
+    {1032, 252}, {1147, 25}, {917, 144}, {1257, 228}, {909, 129}, {1058, 209}, {898, 144}, {1061, 209},
+    {782, 55}, {922, 31}, {976, 137}, {1164, 233}, {998, 55}, {1102, 174}, {952, 140}, {1273, 223},
+    {782, 55}, {1018, 20}, {1023, 20}, {935, 137}, {1127, 31}, {1277, 219}, {992, 55}, {1100, 174},
+    {973, 20}, {987, 137}, {928, 140}, {996, 20}, {941, 137}, {929, 137}, {947, 140}, {1226, 11},
+    {958, 55}, {1026, 205}, {952, 140}, {914, 20}, {953, 140}, {1144, 250}, {1081, 205}, {918, 31},
+    {1082, 143}, {956, 146}, {1074, 192}, {925, 27}, {916, 27}, {945, 146}, {1031, 192}, {1120, 27},
+    {952, 143}, {944, 146}, {909, 21}, {1140, 21}, {1114, 21}, {1140, 21}, {1094, 50}, {902, 146},
+    {1112, 50}, {1114, 50}, {910, 143}, {1028, 200}, {924, 21}, {932, 143}, {920, 21}, {1354, 300},
+    {1259, 250}, {1114, 50}, {1032, 200}, {912, 21}, {1091, 50}, {1336, 306}, {913, 27}, {1034, 192},
+    {1120, 108}, {1151, 108}, {1089, 58}, {1366, 311}, {1149, 108}, {1097, 52}, {1108, 52}, {1256, 225},
+    {1179, 264}, {1116, 52}, {1249, 225}, {1031, 196}, {1147, 108}, {1255, 227}, {1105, 58}, {1039, 196},
+    {1305, 349}, {1256, 185}, {1089, 58}, {1107, 58}, {1089, 58}, {1101, 58}, {1139, 108}, {1342, 264},
+    {1250, 227}, {1052, 196}, {1281, 230}, {1211, 196}, {1118, 52}, {1055, 52}, {1027, 196}, {1118, 52},
+    {1117, 62}, {1083, 221}, {1248, 206}, {1148, 255}, {1030, 217}, {1099, 62}, {1218, 210}, {1113, 62},
+    {1356, 235}, {1217, 210}, {1106, 217}, {1111, 217}, {1089, 62}, {1210, 217}, {1045, 62}, {1042, 242},
+    {1065, 217}, {1352, 278}, {1061, 221}, {1069, 217}, {1079, 221}, {1221, 210}, {1152, 211}, {1109, 62},
+    {1064, 221}, {1066, 221}, {1316, 310}, {1063, 221}, {1464, 310}, {1355, 278}, {1051, 242}, {1165, 211},
+    {1060, 215}, {1173, 222}, {1229, 194}, {1234, 197}, {1341, 308}, {1267, 222}, {1254, 256}, {1394, 320},
+    {1279, 222}, {1045, 206}, {1269, 222}, {1218, 197}, {1076, 215}, {1057, 215}, {1034, 206}, {1504, 236},
+    {1060, 215}, {1058, 215}, {1406, 240}, {1073, 206}, {1086, 215}, {1272, 222}, {1081, 215}, {1038, 215},
+    {1259, 194}, {1418, 289}, {1289, 308}, {1081, 215}, {1255, 222}, {1521, 299}, {1224, 194}, {1243, 194},
+    {1253, 214}, {1245, 216}, {1227, 216}, {1340, 266}, {1258, 214}, {1201, 207}, {1227, 216}, {1241, 216},
+    {1201, 207}, {1200, 207}, {1357, 276}, {1401, 276}, {1213, 207}, {1270, 214}, {879, 12}, {1276, 214},
+    {1254, 214}, {1227, 214}, {1472, 98}, {1265, 214}, {1225, 214}, {1529, 304}, {1381, 271}, {1311, 276},
+    {1392, 271}, {1517, 304}, {1041, 255}, {1265, 216}, {1093, 255}, {1217, 216}, {1229, 216}, {1179, 266},
+    {1246, 199}, {1189, 199}, {1201, 195}, {1186, 195}, {1156, 256}, {1188, 199}, {1236, 199}, {1435, 126},
+    {1173, 256}, {1198, 195}, {1178, 195}, {1192, 199}, {1432, 38}, {1210, 195}, {1306, 320}, {1338, 199},
+    {1171, 265}, {1521, 110}, {1166, 256}, {1444, 110}, {1391, 265}, {1156, 256}, {1272, 199}, {1164, 256},
+    {1206, 195}, {1208, 195}, {1376, 265}, {1166, 256}, {1382, 265}, {1211, 195}, {1192, 195}, {1484, 34},
+    {1208, 201}, {1201, 201}, {1181, 258}, {1154, 258}, {1181, 258}, {1352, 280}, {1354, 280}, {1492, 46},
+    {1363, 262}, {1153, 260}, {1152, 258}, {1158, 260}, {1364, 262}, {1198, 201}, {1200, 201}, {1374, 260},
+    {1439, 61}, {1211, 201}, {1391, 269}, {1169, 268}, {465, 14}, {1155, 201}, {1214, 201}, {1166, 201},
+    {1165, 269}, {1172, 258}, {1349, 280}, {1383, 268}, {1169, 260}, {1173, 268}, {1183, 269}, {885, 16},
+    {1331, 270}, {1390, 270}, {1347, 273}, {1346, 277}, {1446, 22}, {1325, 296}, {1401, 273}, {1350, 277},
+    {1437, 28}, {1389, 277}, {1349, 273}, {1326, 296}, {1385, 273}, {1377, 270}, {1476, 32}, {1315, 296},
+    {1281, 292}, {1323, 270}, {1373, 263}, {1355, 277}, {1407, 277}, {1449, 37}, {171, 147}, {1405, 270},
+    {1387, 261}, {1343, 261}, {1324, 296}, {1500, 43}, {1502, 49}, {1369, 292}, {1391, 261}, {1466, 292},
+    {1346, 288}, {1375, 288}, {1357, 297}, {1281, 307}, {1487, 56}, {1315, 307}, {1362, 288}, {1475, 57},
+    {1335, 297}, {1324, 302}, {1321, 302}, {1331, 307}, {1369, 288}, {1319, 302}, {1327, 297}, {1333, 302},
+    {1511, 298}, {1501, 153}, {1321, 297}, {1535, 295}, {1467, 302}, {1318, 297}, {1515, 295}, {1348, 288},
+    {1533, 298}, {1491, 157}, {1360, 288}, {1527, 295}, {1527, 298}, {1500, 145}, {1374, 262}, {1329, 307},
+    {1281, 350}, {1285, 234}, {1365, 263}, {1503, 99}, {1499, 113}, {1291, 350}, {1371, 263}, {1311, 234},
+    {1292, 350}, {1498, 159}, {1361, 263}, {1452, 155}, {1303, 234}, {1311, 350}, {1520, 301}, {1529, 301},
+    {1484, 301}, {1307, 234}, {1464, 136}, {1500, 73}, {1480, 82}, {1480, 100}, {1483, 127}, {1455, 84},
+    {1447, 186}, {1475, 191}, {1435, 189}, {1502, 155}, {1487, 155}, {1594, 322}, {1535, 323}, {1455, 324},
+    {1300, 291}, {1450, 202}, {1517, 291}, {1469, 121}, {1446, 327}, {1447, 332}, {1446, 333}, {1526, 334},
+    {1454, 338}, {1595, 340}, {1469, 287}, {1449, 334}, {1495, 282}, {1444, 334}, {1496, 283}, {1460, 281},
+    {1593, 274}, {1460, 272}, {1458, 339}, {1471, 173}, {1504, 291}, {1463, 340}, {1409, 161}, {1416, 224},
+    {1515, 291}, {1431, 238}, {1506, 291}, {1516, 287}, {1460, 339}, {1411, 238}, {1515, 291}, {1522, 291},
+    {1511, 165}, {1499, 188}, {1465, 244}, {1491, 352}, {1489, 364}, {1488, 352}, {1410, 373}, {1434, 372},
+    {1598, 366}, {1520, 374}, {1523, 376}, {1424, 148}, {1457, 165}, {1437, 158}, {1494, 366}, {1529, 356},
+    {1438, 362}, {1418, 188}, {1424, 152}, {1424, 152}, {1408, 244}, {1450, 338}, {1473, 367}, {1495, 366},
+    {1433, 367}, {1428, 369}, {1534, 368}, {1651, 344}, {1597, 336}, {1552, 329}, {781, 86}, {1615, 319},
+    {1461, 283}, {1638, 343}, {1638, 342}, {1641, 341}, {1633, 341}, {1658, 331}, {1592, 283}, {1577, 335},
+    {1632, 343}, {1656, 305}, {1650, 313}, {1650, 309}, {1424, 374}, {1641, 309}, {1618, 290}, {1557, 335},
+    {1500, 121}, {1601, 293}, {1635, 305}, {1614, 134}, {1617, 154}, {1567, 156}, {1658, 313}, {1634, 342},
+    {946, 312}, {1654, 313}, {1641, 309}, {1640, 309}, {1605, 363}, {1631, 375}, {1638, 331}, {1425, 202},
+    {1603, 365}, {1567, 355}, {1621, 355}, {1614, 329}, {1625, 384}, {1621, 389}, {1649, 399}, {1605, 398},
+    {1639, 329}, {1543, 401}, {1601, 397}, {1575, 397}, {1662, 416}, {1580, 424}, {1606, 399}, {1622, 406},
+    {1615, 365}, {1585, 286}, {1600, 398}, {1419, 368}, {1626, 368}, {1590, 285}, {1615, 365}, {1591, 87},
+    {1599, 303}, {1604, 397}, {1617, 396}, {1618, 397}, {1619, 406}, {1539, 396}, {1600, 397}, {1435, 374},
+    {1594, 403}, {1659, 404}, {1580, 420}, {1574, 430}, {1614, 440}, {1583, 284}, {1538, 314}, {1637, 315},
+    {1598, 294}, {1603, 404}, {1627, 316}, {1542, 330}, {1587, 294}, {1553, 345}, {1544, 347}, {1543, 353},
+    {1556, 346}, {1561, 371}, {1555, 378}, {1593, 430}, {1540, 387}, {1573, 420}, {1611, 435}, {1570, 430},
+    {1566, 425}, {1636, 314}, {1579, 426}, {1541, 284}, {1562, 358}, {1563, 425}, {1555, 346}, {1541, 354},
+    {1623, 443}, {1761, 432}, {1554, 360}, {1657, 101}, {1563, 103}, {1659, 115}, {1663, 132}, {1782, 150},
+    {1646, 443}, {1783, 162}, {1776, 172}, {1770, 326}, {1774, 328}, {1672, 257}, {1765, 275}, {1712, 176},
+    {1772, 180}, {1773, 226}, {1768, 241}, {1678, 183}, {1777, 392}, {1785, 393}, {1737, 407}, {1687, 412},
+    {1790, 390}, {1773, 172}, {1699, 386}, {1737, 405}, {1790, 418}, {1560, 432}, {1688, 433}, {1556, 360},
+    {1554, 115}, {1742, 391}, {1732, 427}, {1609, 403}, {1703, 437}, {1701, 436}, {1750, 438}, {1694, 434},
+    {1749, 442}, {1750, 444}, {1731, 427}, {1728, 422}, {1737, 456}, {1568, 440}, {1730, 444}, {1779, 469},
+    {1788, 391}, {1738, 449}, {1770, 437}, {1739, 434}, {1675, 453}, {1702, 457}, {1732, 370}, {1598, 440},
+    {1770, 379}, {1691, 436}, {1732, 377}, {1768, 187}, {1666, 208}, {1736, 193}, {1671, 231}, {1669, 243},
+    {1753, 466}, {1672, 463}, {1702, 203}, {1790, 229}, {1850, 232}, {1696, 410}, {1709, 246}, {1704, 414},
+    {1707, 254}, {1705, 402}, {1851, 402}, {1558, 115}, {1773, 132}, {1741, 249}, {1763, 183}, {1709, 451},
+    {1848, 452}, {1757, 463}, {1724, 478}, {1721, 417}, {1766, 447}, {1710, 385}, {1665, 388}, {1668, 417},
+    {1712, 475}, {1754, 468}, {1706, 183}, {1688, 414}, {1684, 466}, {1691, 470}, {1670, 458}, {1718, 452},
+    {1705, 448}, {1722, 220}, {1722, 455}, {1702, 428}, {1677, 459}, {1665, 460}, {1679, 461}, {1676, 461},
+    {1667, 239}, {1678, 251}, {1693, 204}, {738, 259}, {1672, 348}, {1716, 455}, {1776, 213}, {1674, 480},
+    {1694, 481}, {1696, 428}, {1670, 484}, {1702, 455}, {1685, 492}, {1672, 428}, {1669, 502}, {1687, 218},
+    {1690, 237}, {1698, 394}, {1681, 409}, {1904, 267}, {1796, 279}, {1894, 317}, {1800, 318}, {1892, 321},
+    {1841, 351}, {1897, 325}, {1900, 421}, {1844, 431}, {1891, 482}, {1909, 494}, {1908, 498}, {1869, 499},
+    {1917, 500}, {1687, 460}, {1916, 501}, {1904, 512}, {1907, 517}, {1864, 519}, {1910, 524}, {1817, 526},
+    {1911, 535}, {1917, 476}, {1897, 473}, {1828, 464}, {1856, 465}, {1818, 462}, {1694, 204}, {1819, 489},
+    {1867, 486}, {1817, 485}, {1823, 511}, {1915, 508}, {1831, 516}, {1862, 523}, {1864, 522}, {1674, 460},
+    {1863, 509}, {1866, 531}, {1802, 528}, {1900, 532}, {1806, 530}, {1883, 537}, {1894, 318}, {1804, 536},
+    {1861, 539}, {1878, 513}, {1877, 400}, {1825, 413}, {1871, 415}, {1873, 544}, {1861, 415}, {1917, 557},
+    {1833, 560}, {1863, 556}, {1749, 220}, {1852, 561}, {1794, 539}, {1906, 279}, {1848, 566}, {1832, 564},
+    {1831, 571}, {1882, 516}, {1872, 528}, {1844, 556}, {1896, 446}, {1747, 448}, {1804, 450}, {1831, 556},
+    {1855, 567}, {1827, 441}, {1803, 454}, {1849, 479}, {1827, 495}, {1915, 526}, {1837, 491}, {1796, 510},
+    {1838, 505}, {120, 357}, {1826, 441}, {1842, 441}, {1813, 467}, {1880, 474}, {1846, 563}, {1872, 558},
+    {1801, 553}, {1804, 359}, {1320, 361}, {1822, 527}, {1793, 542}, {1864, 381}, {1808, 382}, {1808, 383},
+    {981, 445}, {1894, 279}, {1876, 509}, {1792, 408}, {634, 515}, {1833, 567}, {1814, 602}, {1916, 604},
+    {1835, 525}, {1885, 507}, {1798, 514}, {1812, 472}, {1820, 395}, {1802, 514}, {1826, 487}, {1802, 514},
+    {1803, 490}, {1816, 493}, {2031, 504}, {2030, 411}, {570, 419}, {1801, 514}, {2019, 576}, {2012, 580},
+    {1794, 514}, {2011, 591}, {2020, 589}, {1797, 514}, {2036, 595}, {2028, 592}, {2042, 596}, {2039, 423},
+    {1961, 549}, {1965, 554}, {2041, 552}, {2044, 565}, {1817, 472}, {2043, 572}, {2043, 429}, {2027, 603},
+    {2030, 593}, {2037, 518}, {2021, 521}, {2016, 533}, {1987, 606}, {1997, 605}, {2040, 521}, {1966, 545},
+    {1996, 578}, {1951, 577}, {1990, 582}, {1939, 547}, {1993, 555}, {1985, 583}, {1987, 546}, {1941, 545},
+    {1969, 518}, {1944, 605}, {2023, 521}, {2015, 575}, {2012, 568}, {2002, 583}, {2036, 533}, {1987, 583},
+    {1984, 574}, {1989, 439}, {1997, 583}, {1992, 574}, {2011, 608}, {2010, 614}, {1802, 395}, {2007, 593},
+    {2011, 609}, {1932, 613}, {1980, 630}, {2013, 621}, {1984, 619}, {2012, 618}, {2010, 619}, {1965, 617},
+    {1808, 507}, {1906, 525}, {2040, 545}, {1963, 611}, {2010, 609}, {1959, 638}, {1867, 525}, {1973, 637},
+    {1979, 610}, {1956, 633}, {1956, 585}, {1978, 632}, {2106, 584}, {1976, 588}, {2036, 581}, {1979, 640},
+    {1953, 610}, {1957, 632}, {1973, 641}, {1956, 619}, {1972, 654}, {1958, 653}, {2107, 657}, {1959, 662},
+    {1968, 663}, {1978, 661}, {1967, 534}, {1970, 543}, {1843, 507}, {1861, 525}, {670, 550}, {1964, 635},
+    {1979, 629}, {2016, 631}, {1981, 626}, {1937, 612}, {1927, 650}, {1932, 643}, {1943, 642}, {1941, 644},
+    {1971, 616}, {1927, 665}, {2002, 651}, {1932, 649}, {1922, 668}, {2141, 488}, {1951, 624}, {2159, 607},
+    {2158, 670}, {2136, 664}, {1980, 626}, {1931, 665}, {1939, 616}, {2148, 659}, {2147, 669}, {1948, 624},
+    {1977, 623}, {1924, 655}, {1951, 628}, {1949, 636}, {2042, 503}, {1997, 634}, {2044, 579}, {2130, 600},
+    {1926, 636}, {2062, 672}, {2164, 658}, {2165, 667}, {2151, 598}, {2154, 673}, {2153, 598}, {2091, 685},
+    {1928, 634}, {2066, 689}, {1999, 636}, {2167, 695}, {1920, 636}, {2146, 667}, {1993, 636}, {1948, 634},
+    {2163, 678}, {1931, 628}, {2161, 658}, {2153, 684}, {2170, 678}, {2131, 681}, {2124, 692}, {2123, 587},
+    {2161, 674}, {2175, 682}, {2166, 679}, {2127, 675}, {2174, 674}, {2118, 586}, {2136, 541}, {2160, 674},
+    {2125, 691}, {2118, 529}, {2137, 645}, {2128, 646}, {2134, 666}, {2119, 529}, {2140, 704}, {2126, 691},
+    {2048, 705}, {2172, 674}, {2120, 679}, {2052, 710}, {2066, 679}, {2073, 675}, {2103, 727}, {2170, 682},
+    {2082, 716}, {2169, 730}, {1927, 655}, {2116, 688}, {2101, 701}, {2132, 586}, {2084, 716}, {2087, 706},
+    {2142, 599}, {2080, 718}, {2091, 712}, {2091, 725}, {2098, 722}, {2103, 683}, {2081, 687}, {2101, 722},
+    {2086, 677}, {2097, 698}, {844, 471}, {2099, 717}, {2104, 719}, {2092, 713}, {2092, 714}, {2056, 709},
+    {2059, 715}, {2072, 477}, {2051, 735}, {2062, 709}, {2075, 548}, {2106, 715}, {968, 483}, {2074, 538},
+    {2114, 702}, {1933, 579}, {2099, 715}, {2121, 696}, {2073, 735}, {2116, 697}, {2148, 715}, {2004, 623},
+    {2097, 707}, {1931, 503}, {2057, 570}, {2116, 648}, {2124, 652}, {2055, 707}, {2118, 734}, {2118, 738},
+    {2123, 742}, {2120, 746}, {2075, 690}, {2078, 496}, {2057, 736}, {2116, 599}, {2063, 741}, {2065, 744},
+    {2274, 749}, {2133, 599}, {904, 551}, {2278, 622}, {2062, 707}, {2282, 506}, {2180, 520}, {2279, 737},
+    {2119, 599}, {2118, 599}, {2280, 743}, {2273, 748}, {2278, 753}, {2049, 570}, {195, 562}, {2277, 768},
+    {2119, 703}, {2138, 724}, {2159, 540}, {2283, 559}, {2275, 770}, {2279, 798}, {2282, 799}, {2216, 794},
+    {2296, 792}, {2299, 788}, {1080, 569}, {2301, 794}, {2286, 559}, {2287, 723}, {2275, 792}, {2302, 726},
+    {2288, 731}, {2300, 728}, {2294, 732}, {2302, 720}, {2242, 573}, {2243, 573}, {2202, 750}, {2246, 597},
+    {2255, 751}, {2255, 601}, {2212, 573}, {2251, 794}, {2252, 751}, {2248, 625}, {2216, 627}, {2256, 594},
+    {2247, 752}, {2218, 615}, {2219, 620}, {2198, 639}, {2248, 647}, {2222, 656}, {944, 676}, {2223, 680},
+    {2186, 686}, {329, 693}, {483, 769}, {2225, 863}, {2246, 699}, {2240, 700}, {2264, 708}, {2260, 711},
+    {2281, 721}, {2270, 729}, {2178, 733}, {2264, 739}, {2248, 740}, {2249, 745}, {2180, 764}, {2252, 763},
+    {1288, 754}, {2298, 755}, {2216, 756}, {2296, 757}, {2204, 758}, {1191, 771}, {2253, 752}, {2225, 848},
+    {2182, 747}, {2220, 759}, {2226, 760}, {963, 761}, {2228, 762}, {2249, 766}, {2210, 767}, {2218, 772},
+    {2209, 773}, {2208, 774}, {2225, 781}, {2224, 779}, {2258, 775}, {2235, 776}, {2163, 703}, {2214, 821},
+    {2231, 786}, {2211, 796}, {2216, 789}, {2106, 724}, {2081, 703}, {2179, 778}, {2269, 795}, {1104, 780},
+    {920, 782}, {2181, 832}, {2191, 783}, {2270, 785}, {2185, 787}, {2278, 800}, {2183, 747}, {2190, 812},
+    {2194, 790}, {2281, 801}, {2190, 817}, {2228, 791}, {2179, 793}, {2180, 797}, {2194, 802}, {2280, 540},
+    {2260, 820}, {2290, 803}, {2291, 805}, {2292, 804}, {2296, 814}, {2297, 823}, {2206, 806}, {2201, 807},
+    {896, 809}, {2195, 844}, {2192, 895}, {1046, 810}, {2245, 811}, {2399, 818}, {2401, 819}, {2404, 818},
+    {2413, 813}, {1190, 815}, {2413, 816}, {2309, 822}, {2418, 824}, {2419, 825}, {140, 826}, {2407, 883},
+    {2248, 765}, {2264, 777}, {2270, 838}, {2274, 784}, {2293, 808}, {2400, 884}, {2424, 827}, {2316, 828},
+    {2409, 833}, {2400, 840}, {2357, 834}, {2431, 855}, {2400, 835}, {2422, 836}, {2420, 837}, {2421, 862},
+    {688, 829}, {2417, 867}, {2410, 872}, {2330, 839}, {2417, 834}, {391, 847}, {2408, 841}, {2342, 850},
+    {2350, 836}, {2424, 843}, {2427, 845}, {2377, 858}, {2417, 859}, {2372, 857}, {2384, 854}, {2390, 842},
+    {2376, 831}, {2385, 846}, {2382, 849}, {2374, 851}, {2395, 852}, {2347, 865}, {2372, 866}, {2369, 860},
+    {2304, 864}, {2389, 884}, {2379, 880}, {2304, 886}, {2305, 861}, {2397, 868}, {2380, 870}, {2355, 878},
+    {2392, 869}, {2427, 871}, {2343, 882}, {2342, 874}, {2362, 894}, {2359, 882}, {2342, 889}, {2340, 891},
+    {2350, 890}, {2380, 893}, {642, 896}, {2340, 963}, {2384, 869}, {2382, 873}, {2320, 879}, {2357, 892},
+    {2394, 853}, {2385, 897}, {2352, 875}, {659, 905}, {2386, 876}, {2343, 898}, {2353, 917}, {2352, 877},
+    {2352, 875}, {2354, 899}, {2354, 915}, {2277, 838}, {2402, 919}, {2253, 808}, {865, 900}, {2220, 777},
+    {2366, 983}, {2188, 784}, {2357, 875}, {2199, 808}, {2363, 973}, {2401, 881}, {2307, 901}, {2322, 885},
+    {2316, 887}, {2316, 885}, {2321, 888}, {2326, 904}, {2399, 908}, {2325, 902}, {2407, 921}, {2408, 903},
+    {2355, 923}, {2409, 906}, {2335, 907}, {2335, 909}, {2309, 910}, {2216, 765}, {2329, 912}, {2305, 926},
+    {2305, 911}, {2304, 913}, {2490, 914}, {2309, 916}, {2377, 853}, {2418, 928}, {674, 936}, {2377, 865},
+    {2332, 957}, {2422, 918}, {2322, 920}, {2326, 925}, {2325, 922}, {2325, 924}, {2374, 927}, {2329, 930},
+    {2331, 959}, {366, 931}, {2326, 932}, {10, 933}, {2404, 923}, {2535, 960}, {2525, 1003}, {1272, 934},
+    {2305, 929}, {2530, 1004}, {2494, 935}, {2522, 937}, {2548, 938}, {2534, 953}, {2482, 939}, {2518, 940},
+    {825, 941}, {2533, 942}, {2443, 943}, {2559, 944}, {2531, 945}, {2556, 946}, {742, 947}, {2545, 1006},
+    {2449, 1018}, {2533, 961}, {2382, 929}, {2534, 976}, {2555, 948}, {2543, 949}, {2545, 950}, {881, 951},
+    {2541, 952}, {2457, 954}, {2499, 956}, {2499, 962}, {2503, 970}, {2461, 964}, {2557, 978}, {2467, 965},
+    {2537, 955}, {2471, 985}, {2472, 958}, {2503, 979}, {2547, 966}, {2504, 968}, {2519, 969}, {2525, 974},
+    {2517, 971}, {588, 1024}, {2443, 1117}, {2515, 972}, {2517, 975}, {2516, 992}, {2486, 1020}, {2534, 977},
+    {2465, 955}, {2490, 980}, {2493, 993}, {2519, 1009}, {2506, 982}, {2477, 984}, {2464, 986}, {2470, 987},
+    {2499, 988}, {2497, 972}, {1211, 1025}, {2477, 1106}, {2559, 989}, {2502, 990}, {2534, 961}, {2504, 991},
+    {2537, 943}, {2511, 967}, {2532, 981}, {2454, 994}, {2506, 995}, {2494, 997}, {2449, 999}, {2474, 1019},
+    {2483, 1001}, {2464, 998}, {2470, 1000}, {2516, 1020}, {2504, 965}, {1309, 1005}, {2464, 1007}, {2468, 1026},
+    {2544, 964}, {2469, 1037}, {2493, 1043}, {2469, 1023}, {2437, 1010}, {2438, 981}, {2485, 1027}, {2480, 1045},
+    {2479, 990}, {2432, 1041}, {2445, 1011}, {2448, 1015}, {2534, 1012}, {2436, 1013}, {2450, 1014}, {2514, 1016},
+    {2537, 1017}, {2448, 1015}, {2654, 1021}, {2616, 1022}, {2462, 1028}, {2436, 1029}, {2516, 1087}, {2461, 1065},
+    {2461, 1030}, {2617, 1031}, {2460, 1032}, {2455, 1033}, {2450, 1078}, {2448, 967}, {2461, 1034}, {2442, 1036},
+    {531, 1038}, {2440, 1029}, {2470, 1039}, {2450, 1040}, {2449, 1042}, {2458, 1034}, {2456, 1044}, {2444, 1046},
+    {2555, 964}, {2458, 1047}, {2503, 965}, {2685, 1048}, {2618, 1045}, {2666, 1049}, {2438, 1034}, {2620, 1050},
+    {2507, 996}, {2513, 1002}, {2521, 1008}, {2621, 1051}, {1266, 1052}, {2665, 1145}, {2656, 1109}, {2608, 1053},
+    {269, 1054}, {2666, 1094}, {2659, 1055}, {2573, 1056}, {2613, 1057}, {2602, 1058}, {2577, 1059}, {2600, 1060},
+    {2657, 1061}, {2635, 1062}, {2660, 1063}, {2633, 1064}, {2686, 1066}, {2667, 1067}, {2667, 1068}, {2636, 1069},
+    {2593, 1070}, {147, 1071}, {2670, 1125}, {2626, 1072}, {2596, 1073}, {2624, 1074}, {2593, 1075}, {2629, 1076},
+    {2596, 1077}, {2598, 1079}, {2648, 1080}, {2601, 1081}, {2648, 1083}, {2654, 1088}, {2674, 1146}, {285, 1084},
+    {2631, 1113}, {2625, 1085}, {2654, 1086}, {1260, 1152}, {2652, 1253}, {2630, 1225}, {2650, 1230}, {2664, 1089},
+    {2616, 1090}, {2654, 1114}, {2650, 1253}, {2645, 1091}, {2619, 1092}, {2567, 1093}, {2623, 1095}, {2593, 1096},
+    {2625, 1108}, {2680, 1097}, {2612, 1098}, {2594, 1100}, {2586, 1102}, {2606, 1101}, {2579, 1105}, {2683, 1069},
+    {2649, 1082}, {2630, 1075}, {2612, 1119}, {2611, 1099}, {2640, 1079}, {2593, 1099}, {2607, 1115}, {2639, 1103},
+    {2594, 1104}, {2612, 1107}, {2573, 1110}, {2572, 1120}, {2662, 1149}, {2570, 1111}, {2668, 1112}, {2610, 1121},
+    {2613, 1130}, {2618, 1131}, {2653, 1116}, {2621, 1118}, {2621, 1122}, {2491, 1002}, {2574, 1123}, {2568, 1124},
+    {2656, 1056}, {2571, 1126}, {2491, 1008}, {2565, 1127}, {2565, 1128}, {1158, 1153}, {2567, 1252}, {2494, 996},
+    {2568, 1224}, {2613, 1132}, {2667, 1133}, {2560, 1154}, {2587, 1157}, {2591, 1159}, {2786, 1165}, {2582, 1168},
+    {2588, 1171}, {2564, 1134}, {2677, 1135}, {2585, 1136}, {2651, 1082}, {2582, 1137}, {2636, 1077}, {2573, 1154},
+    {2627, 1139}, {2574, 1140}, {2684, 1141}, {2584, 1142}, {2572, 1143}, {2577, 1155}, {2796, 1180}, {2791, 1156},
+    {2780, 1214}, {2793, 1147}, {2637, 1136}, {2796, 1150}, {336, 1151}, {2802, 1158}, {2789, 1160}, {2786, 1161},
+    {2796, 1162}, {2801, 1163}, {2797, 1166}, {2794, 1167}, {2809, 1169}, {2769, 1170}, {2796, 1172}, {2815, 1184},
+    {2803, 1215}, {2811, 1173}, {2794, 1174}, {2716, 1200}, {2802, 1186}, {2761, 1190}, {2775, 1202}, {2768, 1187},
+    {2758, 1185}, {2773, 1206}, {2719, 1175}, {2726, 1176}, {2727, 1191}, {744, 1199}, {2759, 1226}, {2729, 1177},
+    {2778, 1178}, {2776, 1179}, {2710, 1181}, {2762, 1206}, {2809, 1173}, {2721, 1185}, {2802, 1182}, {2801, 1183},
+    {2762, 1188}, {2773, 1189}, {2737, 1201}, {2752, 1192}, {2778, 1194}, {2701, 1210}, {2762, 1205}, {2691, 1207},
+    {2772, 1197}, {2747, 1195}, {2776, 1196}, {2693, 1198}, {2725, 1208}, {2811, 1211}, {2737, 1167}, {2731, 1203},
+    {2730, 1204}, {2733, 1209}, {2737, 1212}, {2729, 1216}, {2720, 1228}, {2874, 1213}, {2760, 1217}, {2728, 1220},
+    {2725, 1222}, {287, 1280}, {2807, 1375}, {2794, 1215}, {527, 1218}, {2779, 1196}, {2722, 1219}, {2737, 1221},
+    {2780, 1193}, {2735, 1243}, {2721, 1223}, {2743, 1232}, {2725, 1240}, {2736, 1227}, {2721, 1229}, {2745, 1231},
+    {2724, 1235}, {2735, 1241}, {2750, 1233}, {2741, 1234}, {2690, 1237}, {2722, 1243}, {2782, 1238}, {2875, 1239},
+    {2731, 1242}, {2694, 1244}, {2694, 1245}, {2703, 1247}, {2744, 1248}, {2697, 1249}, {2742, 1250}, {2712, 1251},
+    {2712, 1255}, {2690, 1256}, {2798, 1257}, {2693, 1251}, {2691, 1258}, {2762, 1274}, {2725, 1223}, {2718, 1264},
+    {2709, 1276}, {2717, 1259}, {2693, 1260}, {2715, 1261}, {2711, 1262}, {2704, 1263}, {2711, 1265}, {2711, 1275},
+    {2812, 1266}, {2697, 1267}, {2705, 1281}, {2710, 1338}, {2872, 1268}, {2924, 1282}, {2912, 1305}, {2879, 1270},
+    {2876, 1279}, {2915, 1283}, {2919, 1288}, {2825, 1302}, {2864, 1300}, {2827, 1298}, {2766, 1195}, {2828, 1285},
+    {2916, 1296}, {2940, 1303}, {402, 1284}, {2942, 1377}, {247, 1286}, {2778, 1193}, {2776, 1193}, {2856, 1369},
+    {2780, 1236}, {2788, 1246}, {2912, 1269}, {2857, 1271}, {2889, 1290}, {2940, 1306}, {2913, 1272}, {2939, 1273},
+    {2888, 1277}, {2848, 1301}, {2933, 1278}, {2854, 1292}, {2855, 1294}, {2941, 1287}, {1081, 1289}, {2897, 1293},
+    {2851, 1291}, {2852, 1295}, {289, 1297}, {2847, 1299}, {2937, 1312}, {2900, 1319}, {2893, 1316}, {2885, 1329},
+    {2846, 1304}, {2882, 1308}, {2910, 1313}, {2881, 1335}, {2934, 1291}, {2909, 1307}, {2889, 1308}, {2906, 1314},
+    {2827, 1332}, {2906, 1330}, {2920, 1315}, {2872, 1333}, {2904, 1309}, {2909, 1310}, {2915, 1320}, {2897, 1327},
+    {2866, 1332}, {2902, 1344}, {2863, 1401}, {2851, 1400}, {2937, 1393}, {2871, 1389}, {2871, 1311}, {2940, 1317},
+    {2928, 1287}, {2857, 1341}, {3002, 1321}, {2839, 1325}, {2893, 1287}, {2860, 1318}, {2854, 1322}, {2852, 1323},
+    {2859, 1324}, {2834, 1326}, {2894, 1328}, {2905, 1310}, {2940, 1269}, {2899, 1330}, {2895, 1331}, {2883, 1287},
+    {2865, 1336}, {2851, 1342}, {2849, 1334}, {2899, 1337}, {635, 1339}, {2876, 1340}, {2870, 1340}, {343, 1408},
+    {2853, 1492}, {2903, 1486}, {2871, 1343}, {2864, 1345}, {2868, 1346}, {2898, 1332}, {3003, 1347}, {2705, 1246},
+    {2862, 1348}, {2875, 1351}, {2859, 1349}, {2898, 1350}, {2878, 1352}, {2877, 1353}, {2839, 1355}, {2873, 1356},
+    {2824, 1357}, {2828, 1358}, {917, 1409}, {2846, 1491}, {2820, 1365}, {2882, 1370}, {2926, 1374}, {2824, 1376},
+    {2825, 1360}, {2830, 1332}, {2847, 1381}, {2818, 1396}, {2838, 1359}, {2690, 1236}, {2829, 1363}, {2838, 1363},
+    {2883, 1362}, {2847, 1372}, {2825, 1361}, {2884, 1364}, {3067, 1378}, {3046, 1405}, {3041, 1367}, {306, 1410},
+    {2994, 1368}, {2995, 1371}, {2992, 1373}, {2993, 1379}, {2998, 1380}, {2999, 1380}, {2996, 1382}, {2997, 1383},
+    {2986, 1384}, {2987, 1385}, {2984, 1386}, {3071, 1387}, {3047, 1388}, {3060, 1390}, {3044, 1391}, {2819, 1360},
+    {3040, 1511}, {3068, 1392}, {3069, 1395}, {3066, 1397}, {1101, 1398}, {3043, 1511}, {3054, 1399}, {3012, 1402},
+    {3058, 1403}, {2983, 1404}, {3056, 1411}, {3046, 1420}, {3022, 1407}, {3014, 1412}, {3020, 1413}, {3009, 1414},
+    {2974, 1416}, {2975, 1422}, {2981, 1415}, {3009, 1419}, {3011, 1435}, {3023, 1417}, {2963, 1421}, {3012, 1423},
+    {3039, 1424}, {2946, 1425}, {2974, 1426}, {3059, 1427}, {3020, 1429}, {3018, 1428}, {2993, 1434}, {3048, 1511},
+    {2994, 1430}, {2953, 1432}, {3015, 1436}, {3050, 1440}, {3027, 1470}, {3039, 1431}, {3031, 1433}, {3021, 1437},
+    {668, 1438}, {3034, 1439}, {40, 1441}, {1216, 1442}, {3004, 1443}, {3023, 1444}, {414, 1445}, {898, 1447},
+    {3006, 1448}, {122, 1451}, {2949, 1452}, {2987, 1453}, {2972, 1454}, {2986, 1455}, {2982, 1456}, {2981, 1457},
+    {3015, 1458}, {2982, 1459}, {2984, 1460}, {3056, 1461}, {3019, 1472}, {3020, 1502}, {3021, 1462}, {2982, 1463},
+    {3023, 1465}, {2981, 1466}, {3025, 1467}, {2948, 1468}, {3007, 1471}, {2983, 1473}, {3004, 1474}, {2991, 1476},
+    {1138, 1536}, {584, 1477}, {3000, 1637}, {2992, 1637}, {2990, 1478}, {3006, 1479}, {2994, 1480}, {3044, 1481},
+    {3045, 1482}, {2959, 1483}, {322, 1484}, {2946, 1485}, {3037, 1487}, {2946, 1480}, {2949, 1488}, {2952, 1489},
+    {741, 1537}, {2953, 1615}, {2964, 1490}, {2976, 1637}, {2969, 1493}, {163, 1494}, {92, 1538}, {3055, 1611},
+    {3018, 1497}, {2966, 1498}, {736, 1539}, {2948, 1617}, {3061, 1499}, {2974, 1500}, {638, 1501}, {3010, 1503},
+    {2968, 1504}, {1115, 1505}, {2970, 1506}, {3171, 1507}, {2961, 1508}, {2957, 1509}, {3075, 1512}, {2957, 1468},
+    {2960, 1510}, {3168, 1510}, {1058, 1513}, {109, 1514}, {855, 1515}, {1042, 1540}, {3190, 1619}, {3077, 1613},
+    {827, 1516}, {155, 1517}, {3175, 1510}, {3161, 1518}, {3187, 1519}, {3180, 1521}, {3181, 1522}, {3083, 1524},
+    {3195, 1525}, {3149, 1527}, {3186, 1526}, {3147, 1528}, {3195, 1530}, {448, 1531}, {3170, 1532}, {3192, 1533},
+    {3176, 1535}, {3191, 1541}, {3187, 1577}, {3105, 1542}, {82, 1543}, {3197, 1544}, {3194, 1545}, {3102, 1546},
+    {3109, 1556}, {3143, 1547}, {3099, 1548}, {3096, 1549}, {3107, 1560}, {3144, 1550}, {3146, 1551}, {3151, 1553},
+    {3145, 1553}, {3149, 1554}, {115, 1555}, {3091, 1558}, {3114, 1559}, {3166, 1561}, {3186, 1562}, {3141, 1564},
+    {3147, 1563}, {3167, 1565}, {3159, 1566}, {3165, 1567}, {3157, 1568}, {3160, 1569}, {3084, 1570}, {3085, 1571},
+    {3175, 1572}, {3148, 1600}, {3163, 1644}, {456, 1573}, {3145, 1647}, {3167, 1574}, {3164, 1575}, {3169, 1578},
+    {3184, 1563}, {3184, 1576}, {3191, 1576}, {3190, 1576}, {3189, 1576}, {3188, 1576}, {3171, 1576}, {3170, 1576},
+    {3169, 1576}, {3168, 1576}, {3135, 1579}, {3145, 1580}, {3106, 1581}, {3182, 1584}, {3183, 1596}, {3105, 1582},
+    {3134, 1583}, {3164, 1585}, {3118, 1586}, {3131, 1589}, {3115, 1602}, {3086, 1608}, {3076, 1618}, {3094, 1587},
+    {3094, 1588}, {3080, 1590}, {3084, 1591}, {3164, 1592}, {443, 1593}, {3072, 1595}, {666, 1597}, {3081, 1598},
+    {3258, 1599}, {1048, 1601}, {1221, 1604}, {3126, 1605}, {3076, 1606}, {3103, 1607}, {3077, 1609}, {3081, 1610},
+    {3182, 1612}, {3120, 1616}, {3100, 1620}, {3185, 1621}, {3102, 1622}, {3088, 1632}, {3188, 1660}, {3135, 1579},
+    {3089, 1623}, {3077, 1625}, {3090, 1624}, {3111, 1626}, {3259, 1627}, {3193, 1628}, {3086, 1629}, {17, 1630},
+    {562, 1631}, {899, 1633}, {3091, 1634}, {3088, 1635}, {3101, 1636}, {3256, 1638}, {3087, 1639}, {3303, 1640},
+    {3307, 1641}, {3288, 1643}, {95, 1645}, {3250, 1664}, {3209, 1682}, {3300, 1648}, {867, 1649}, {3284, 1650},
+    {3321, 1651}, {3164, 1559}, {3307, 1652}, {3252, 1653}, {3215, 1654}, {3313, 1655}, {3301, 1656}, {3326, 1658},
+    {3205, 1642}, {3276, 1661}, {3317, 1662}, {3323, 1665}, {3222, 1666}, {3300, 1667}, {3312, 1668}, {3316, 1669},
+    {3228, 1670}, {3312, 1671}, {3310, 1673}, {997, 1674}, {3326, 1728}, {3269, 1675}, {3264, 1676}, {3281, 1677},
+    {3280, 1679}, {681, 1680}, {3277, 1681}, {3275, 1726}, {3295, 1683}, {3320, 1684}, {3218, 1685}, {3270, 1686},
+    {3270, 1688}, {1326, 1689}, {3316, 1696}, {3244, 1712}, {3269, 1690}, {969, 1693}, {3292, 1784}, {3265, 1744},
+    {3279, 1691}, {3266, 1692}, {3269, 1694}, {675, 1695}, {3284, 1786}, {3264, 1691}, {3281, 1740}, {258, 1697},
+    {1314, 1698}, {3288, 1729}, {3256, 1773}, {3280, 1699}, {3301, 1700}, {3273, 1701}, {3299, 1702}, {3298, 1703},
+    {3290, 1704}, {3263, 1706}, {3244, 1707}, {3240, 1721}, {3244, 1708}, {3242, 1709}, {724, 1710}, {3267, 1692},
+    {3233, 1739}, {3250, 1711}, {928, 1713}, {3253, 1730}, {3271, 1749}, {1065, 1714}, {3239, 1715}, {3239, 1716},
+    {3236, 1717}, {3232, 1718}, {3236, 1719}, {384, 1720}, {3316, 1723}, {3279, 1724}, {333, 1725}, {3253, 1752},
+    {1303, 1727}, {3237, 1731}, {693, 1732}, {439, 1792}, {3305, 1887}, {3310, 1733}, {3252, 1734}, {3247, 1735},
+    {3248, 1736}, {1002, 1793}, {3252, 1877}, {3254, 1737}, {3303, 1738}, {3242, 1742}, {3256, 1743}, {3386, 1745},
+    {3218, 1746}, {295, 1794}, {3206, 1882}, {3245, 1735}, {3288, 1747}, {3209, 1750}, {3207, 1751}, {3426, 1753},
+    {3207, 1748}, {3304, 1666}, {3200, 1754}, {3208, 1755}, {3245, 1761}, {3296, 1642}, {235, 1756}, {3206, 1757},
+    {3318, 1759}, {405, 1760}, {3226, 1764}, {3227, 1765}, {3210, 1748}, {3213, 1777}, {3326, 1766}, {3222, 1767},
+    {3206, 1758}, {3427, 1768}, {3426, 1770}, {3378, 1771}, {3436, 1790}, {3432, 1781}, {3437, 1774}, {3436, 1772},
+    {3439, 1775}, {3428, 1778}, {3216, 1758}, {3453, 1779}, {3445, 1780}, {3451, 1782}, {3449, 1783}, {3373, 1785},
+    {3305, 1788}, {3207, 1762}, {3321, 1763}, {3331, 1769}, {3449, 1787}, {3398, 1789}, {3354, 1791}, {3356, 1795},
+    {3433, 1797}, {3453, 1798}, {3359, 1799}, {3410, 1801}, {3355, 1802}, {1059, 1803}, {3397, 1880}, {3363, 1804},
+    {3364, 1805}, {648, 1806}, {3365, 1807}, {3400, 1808}, {3397, 1809}, {3421, 1810}, {3402, 1811}, {3397, 1812},
+    {3350, 1813}, {3351, 1814}, {3394, 1855}, {3377, 1816}, {3414, 1818}, {3392, 1819}, {3380, 1820}, {3399, 1821},
+    {3419, 1815}, {484, 1822}, {3433, 1857}, {3414, 1823}, {1208, 1824}, {3419, 1902}, {358, 1825}, {3408, 1860},
+    {3413, 1826}, {219, 1827}, {3412, 1856}, {3417, 1900}, {3414, 1829}, {3372, 1830}, {3366, 1832}, {3365, 1833},
+    {3410, 1828}, {3387, 1834}, {3355, 1836}, {3377, 1842}, {3419, 1828}, {3374, 1837}, {3383, 1838}, {3364, 1839},
+    {752, 1840}, {3372, 1841}, {3364, 1843}, {517, 1844}, {3229, 1762}, {3403, 1845}, {3398, 1815}, {859, 1846},
+    {3364, 1847}, {1270, 1848}, {3405, 1849}, {3362, 1851}, {3366, 1850}, {3366, 1852}, {3361, 1859}, {3372, 1850},
+    {3360, 1861}, {3285, 1788}, {3227, 1788}, {3339, 1853}, {3338, 1854}, {3514, 1858}, {3390, 1862}, {317, 1863},
+    {3335, 1864}, {3427, 1865}, {3384, 1866}, {3386, 1867}, {3428, 1868}, {3331, 1869}, {3425, 1870}, {3416, 1871},
+    {3215, 1788}, {3432, 1791}, {3340, 1872}, {3336, 1873}, {3423, 1868}, {1220, 1874}, {3335, 1875}, {3334, 1876},
+    {3337, 1878}, {3340, 1879}, {3356, 1881}, {3338, 1883}, {3328, 1884}, {3208, 1788}, {3430, 1769}, {3208, 1763},
+    {3330, 1886}, {3358, 1888}, {3352, 1889}, {135, 1890}, {3356, 1891}, {3380, 1867}, {3336, 1903}, {3328, 1892},
+    {3351, 1893}, {3383, 1854}, {3347, 1895}, {3356, 1896}, {3351, 1897}, {848, 1898}, {3350, 1899}, {3450, 1914},
+    {3359, 1901}, {3452, 1904}, {3386, 1866}, {3341, 1905}, {496, 1906}, {3397, 1907}, {3572, 1908}, {3558, 1909},
+    {3357, 1894}, {3554, 1910}, {3581, 1911}, {3560, 1912}, {3556, 1913}, {3561, 1915}, {3556, 1918}, {3538, 1919},
+    {3553, 1920}, {3536, 1921}, {3573, 1922}, {3475, 1966}, {3568, 1923}, {3558, 1924}, {3571, 1925}, {3578, 1926},
+    {3559, 1917}, {3568, 1927}, {3572, 1928}, {3526, 1979}, {3552, 1917}, {3581, 1929}, {3561, 1948}, {3329, 1894},
+    {3573, 1930}, {3566, 1936}, {3563, 1917}, {3486, 1949}, {1243, 1931}, {3579, 1923}, {3474, 1932}, {3556, 1917},
+    {3535, 1933}, {3527, 1934}, {3534, 1935}, {3521, 1937}, {3578, 1947}, {3494, 1938}, {934, 1939}, {1129, 1940},
+    {3540, 1942}, {267, 1943}, {3545, 1944}, {3472, 1945}, {3499, 1946}, {3523, 1950}, {3492, 1951}, {3570, 1952},
+    {3476, 1953}, {1086, 1954}, {3521, 1955}, {3542, 1984}, {3566, 2046}, {3530, 2045}, {3542, 1956}, {3508, 1957},
+    {3532, 1958}, {3510, 1959}, {3536, 1960}, {51, 1961}, {3559, 2038}, {3530, 1962}, {3528, 1981}, {3515, 1963},
+    {3555, 1964}, {3517, 1965}, {3536, 1967}, {3531, 1968}, {3502, 1969}, {3568, 1970}, {3505, 1971}, {3483, 1972},
+    {1225, 1974}, {3504, 1975}, {3516, 1976}, {3475, 1985}, {3498, 1997}, {3534, 1978}, {3498, 1982}, {3506, 1986},
+    {3490, 1983}, {3505, 2014}, {3505, 1987}, {3506, 1988}, {3517, 1989}, {3642, 1990}, {3510, 1991}, {3519, 1992},
+    {3488, 1983}, {3506, 1993}, {3558, 1994}, {3559, 1995}, {1166, 2048}, {3456, 1996}, {431, 1998}, {3550, 2000},
+    {3519, 2149}, {3501, 2149}, {3513, 2001}, {3482, 2002}, {987, 2049}, {3468, 2127}, {3460, 2003}, {3483, 2004},
+    {3480, 2005}, {3467, 2006}, {3540, 2007}, {3464, 2011}, {3473, 2008}, {3472, 2009}, {311, 2010}, {3528, 2012},
+    {3571, 2013}, {3459, 2149}, {3485, 2015}, {3484, 2016}, {3512, 2001}, {3481, 2017}, {3533, 2018}, {3643, 2019},
+    {3466, 2020}, {3693, 2021}, {3641, 2022}, {3523, 2023}, {418, 2024}, {3520, 2025}, {3492, 2026}, {3474, 2027},
+    {3525, 1973}, {3554, 1999}, {3581, 2028}, {3485, 2029}, {3488, 2030}, {3588, 2031}, {3589, 2032}, {3644, 2033},
+    {3672, 2034}, {1224, 2035}, {3592, 2036}, {475, 2037}, {74, 2039}, {3687, 2040}, {3632, 2041}, {3693, 2050},
+    {3667, 2108}, {3684, 2043}, {3598, 2047}, {3599, 2051}, {3660, 2053}, {3704, 2054}, {3700, 2055}, {3649, 2056},
+    {3709, 2076}, {3606, 2064}, {3611, 2057}, {3706, 2058}, {3614, 2059}, {3615, 2060}, {3648, 2061}, {3651, 2096},
+    {3711, 2052}, {3653, 2100}, {3659, 2111}, {3612, 2063}, {22, 2065}, {3623, 2067}, {3649, 2068}, {3603, 2069},
+    {3678, 2070}, {3669, 2071}, {3696, 2073}, {3678, 2078}, {3592, 2074}, {3691, 2075}, {3690, 2077}, {3675, 2079},
+    {3624, 2052}, {3639, 2080}, {916, 2088}, {3670, 2125}, {3642, 2145}, {3669, 2081}, {3682, 2109}, {3666, 2082},
+    {186, 2083}, {3659, 2084}, {3624, 2085}, {3620, 2107}, {3629, 2086}, {3679, 2125}, {3612, 2087}, {3632, 2089},
+    {3634, 2090}, {3653, 2072}, {3637, 2091}, {3655, 2092}, {3629, 2093}, {3699, 2094}, {3658, 2095}, {3640, 2097},
+    {3646, 2099}, {3645, 2101}, {3619, 2102}, {3638, 2103}, {3639, 2104}, {3623, 2105}, {1192, 2106}, {290, 2110},
+    {3616, 2112}, {3644, 2113}, {3692, 2114}, {473, 2115}, {3639, 2117}, {3638, 2118}, {3681, 2120}, {263, 2121},
+    {3633, 2122}, {3635, 2123}, {3619, 2064}, {3492, 1973}, {3626, 2124}, {3589, 2128}, {3600, 2129}, {3673, 2130},
+    {3677, 2131}, {3594, 2132}, {3596, 2133}, {3665, 2134}, {3461, 1999}, {3492, 1973}, {3608, 2135}, {3671, 2136},
+    {3688, 2131}, {3668, 2137}, {3669, 2139}, {3600, 2144}, {3584, 2175}, {3600, 2140}, {983, 2142}, {3587, 2143},
+    {3662, 2141}, {3587, 2146}, {3600, 2147}, {3584, 2148}, {3648, 2150}, {3610, 2151}, {3697, 2051}, {3651, 2072},
+    {3701, 2141}, {3709, 2152}, {3594, 2153}, {3678, 2072}, {3700, 2064}, {3653, 2154}, {3712, 2155}, {3711, 2057},
+    {3660, 2098}, {3679, 2126}, {3771, 2156}, {3768, 2157}, {3815, 2158}, {3813, 2176}, {3819, 2181}, {3819, 2207},
+    {3719, 2160}, {3720, 2161}, {3721, 2162}, {3722, 2163}, {3723, 2164}, {3724, 2165}, {3725, 2166}, {3726, 2167},
+    {3727, 2168}, {3728, 2169}, {3729, 2170}, {3838, 2171}, {3830, 2172}, {3827, 2173}, {3835, 2174}, {3756, 2177},
+    {3784, 2178}, {3833, 2179}, {3824, 2182}, {3833, 2183}, {3745, 2184}, {3740, 2185}, {3826, 2186}, {3837, 2187},
+    {3783, 2188}, {3838, 2189}, {3781, 2190}, {3778, 2191}, {3748, 2192}, {1139, 2194}, {3832, 2195}, {3785, 2196},
+    {3830, 2197}, {3754, 2198}, {3788, 2199}, {3827, 2200}, {3747, 2203}, {3807, 2205}, {3805, 2204}, {3802, 2204},
+    {3735, 2201}, {1325, 2206}, {864, 2208}, {3764, 2209}, {3724, 2210}, {3802, 2211}, {3804, 2212}, {3715, 2213},
+    {3758, 2201}, {3805, 2214}, {3812, 2215}, {3794, 2217}, {1277, 2220}, {3810, 2221}, {707, 2224}, {3774, 2226},
+    {3783, 2193}, {3776, 2202}, {3792, 2227}, {3765, 2228}, {3751, 2229}, {3759, 2230}, {3838, 2231}, {462, 2232},
+    {3749, 2233}, {3837, 2234}, {3784, 2235}, {173, 2236}, {210, 2237}, {985, 2238}, {3756, 2239}, {308, 2240},
+    {3769, 2241}, {1258, 2242}, {3766, 2287}, {3767, 2244}, {3775, 2245}, {3770, 2246}, {3767, 2247}, {3759, 2250},
+    {3765, 2251}, {3760, 2267}, {3761, 2252}, {3712, 2253}, {3802, 2254}, {3715, 2261}, {3810, 2255}, {3811, 2256},
+    {3747, 2243}, {3715, 2257}, {3746, 2243}, {3735, 2259}, {3586, 2126}, {3625, 2098}, {3754, 2243}, {3814, 2260},
+    {3767, 2243}, {3723, 2262}, {3721, 2263}, {3795, 2265}, {3764, 2243}, {3792, 2266}, {3714, 2268}, {579, 2271},
+    {3820, 2272}, {3748, 2243}, {3779, 2193}, {3743, 2273}, {3761, 2275}, {493, 2276}, {3770, 2243}, {3740, 2277},
+    {3824, 2279}, {3715, 2280}, {3818, 2209}, {3723, 2282}, {3779, 2284}, {3800, 2202}, {3730, 2285}, {3732, 2288},
+    {3738, 2283}, {3727, 2289}, {3743, 2298}, {302, 2286}, {3732, 2294}, {250, 2295}, {3958, 2299}, {3896, 2300},
+    {3932, 2301}, {3739, 2283}, {3902, 2302}, {943, 2303}, {3948, 2304}, {3743, 2283}, {3728, 2283}, {3737, 2283},
+    {3949, 2283}, {3742, 2283}, {3943, 2305}, {3956, 2306}, {3936, 2307}, {3950, 2308}, {3960, 2310}, {3889, 2311},
+    {3894, 2312}, {3922, 2313}, {3936, 2314}, {3855, 2315}, {3938, 2317}, {3883, 2318}, {103, 2319}, {3858, 2320},
+    {3886, 2321}, {3861, 2322}, {3862, 2323}, {442, 2324}, {3912, 2325}, {3946, 2326}, {3957, 2327}, {3966, 2328},
+    {3959, 2329}, {3869, 2331}, {1291, 2332}, {3959, 2425}, {3962, 2333}, {3927, 2334}, {3922, 2336}, {3904, 2352},
+    {3927, 2335}, {3870, 2337}, {3915, 2338}, {3917, 2339}, {3923, 2340}, {3913, 2341}, {3881, 2342}, {3882, 2343},
+    {3935, 2344}, {3906, 2345}, {3933, 2346}, {3860, 2348}, {3918, 2349}, {3906, 2350}, {3898, 2351}, {822, 2362},
+    {3842, 2353}, {3841, 2353}, {3840, 2353}, {3844, 2353}, {3846, 2354}, {3849, 2355}, {3853, 2356}, {3855, 2357},
+    {3872, 2399}, {567, 2363}, {3893, 2353}, {3878, 2364}, {3900, 2355}, {3895, 2354}, {3904, 2357}, {3902, 2356},
+    {3953, 2358}, {3955, 2359}, {3957, 2360}, {3959, 2361}, {3915, 2365}, {3916, 2366}, {3880, 2367}, {3873, 2368},
+    {3908, 2359}, {3906, 2358}, {3912, 2361}, {3910, 2360}, {136, 2369}, {3875, 2370}, {3875, 2371}, {3899, 2372},
+    {3895, 2373}, {3888, 2374}, {3872, 2375}, {3892, 2376}, {3846, 2377}, {3903, 2378}, {3931, 2379}, {3892, 2381},
+    {3891, 2383}, {3842, 2387}, {3862, 2388}, {3900, 2389}, {3848, 2390}, {3898, 2391}, {191, 2392}, {3845, 2393},
+    {3896, 2394}, {372, 2395}, {3847, 2396}, {3856, 2397}, {526, 2398}, {3920, 2400}, {3921, 2401}, {3926, 2402},
+    {3846, 2403}, {800, 2405}, {3940, 2320}, {3870, 2406}, {3844, 2410}, {3863, 2411}, {3847, 2412}, {3881, 2414},
+    {3934, 2384}, {3950, 2404}, {3956, 2413}, {4063, 2415}, {3870, 2416}, {1111, 2432}, {3865, 2533}, {3861, 2417},
+    {3962, 2419}, {547, 2420}, {3905, 2421}, {3850, 2423}, {3849, 2424}, {3873, 2426}, {3967, 2427}, {347, 2428},
+    {4080, 2429}, {4025, 2430}, {4030, 2431}, {4087, 2433}, {4064, 2434}, {4083, 2435}, {64, 2436}, {4083, 2437},
+    {4071, 2529}, {4072, 2438}, {4088, 2439}, {4089, 2529}, {605, 2440}, {4065, 2441}, {4074, 2442}, {4094, 2444},
+    {4084, 2445}, {4070, 2446}, {4093, 2447}, {4070, 2448}, {4066, 2450}, {4084, 2451}, {4002, 2452}, {4085, 2453},
+    {3994, 2454}, {4073, 2455}, {4006, 2456}, {4074, 2458}, {172, 2459}, {4081, 2460}, {4093, 2464}, {4044, 2469},
+    {4032, 2465}, {4045, 2487}, {4036, 2462}, {4047, 2463}, {4048, 2466}, {4045, 2468}, {4088, 2470}, {4058, 2473},
+    {808, 2474}, {4046, 2475}, {4046, 2476}, {3985, 2477}, {4041, 2478}, {4062, 2479}, {3989, 2480}, {893, 2481},
+    {4060, 2482}, {4063, 2483}, {4054, 2484}, {4061, 2485}, {4053, 2488}, {4060, 2489}, {4062, 2491}, {373, 2492},
+    {3925, 2404}, {4048, 2494}, {4040, 2495}, {4054, 2496}, {4069, 2497}, {4062, 2498}, {4028, 2500}, {753, 2501},
+    {4060, 2503}, {3849, 2384}, {4055, 2505}, {4031, 2508}, {4032, 2509}, {4017, 2510}, {4013, 2510}, {4007, 2511},
+    {4000, 2523}, {4008, 2512}, {4000, 2514}, {4009, 2515}, {4006, 2510}, {4041, 2516}, {4080, 2517}, {4014, 2518},
+    {4084, 2520}, {4085, 2522}, {4048, 2524}, {3982, 2528}, {4021, 2540}, {3880, 2384}, {4029, 2525}, {3868, 2413},
+    {3979, 2526}, {41, 2560}, {4022, 2648}, {4071, 2427}, {4016, 2661}, {4015, 2661}, {4020, 2634}, {4057, 2633},
+    {3989, 2530}, {3983, 2531}, {3988, 2532}, {3991, 2535}, {3980, 2544}, {3971, 2554}, {1213, 2536}, {3976, 2561},
+    {3981, 2620}, {843, 2562}, {3976, 2663}, {3974, 2538}, {4049, 2539}, {3996, 2541}, {532, 2542}, {3971, 2543},
+    {4044, 2519}, {4018, 2527}, {3997, 2545}, {1007, 2563}, {3994, 2662}, {4014, 2546}, {4018, 2527}, {4004, 2527},
+    {4082, 2547}, {3986, 2548}, {4027, 2527}, {3999, 2549}, {3969, 2550}, {3995, 2551}, {3975, 2552}, {3977, 2527},
+    {3978, 2553}, {3993, 2662}, {4019, 2527}, {3998, 2555}, {3982, 2556}, {3983, 2557}, {3999, 2558}, {4094, 2559},
+    {4000, 2564}, {4204, 2565}, {222, 2566}, {4196, 2649}, {727, 2567}, {4152, 2568}, {4200, 2569}, {200, 2570},
+    {4192, 2571}, {4101, 2572}, {4156, 2574}, {151, 2575}, {612, 2576}, {45, 2578}, {4157, 2579}, {4196, 2580},
+    {4203, 2581}, {4217, 2582}, {4219, 2580}, {4203, 2583}, {4109, 2584}, {4110, 2585}, {4200, 2592}, {4215, 2622},
+    {4213, 2586}, {429, 2587}, {4136, 2588}, {4223, 2589}, {529, 2590}, {4213, 2591}, {4197, 2594}, {4213, 2595},
+    {4220, 2597}, {4204, 2599}, {4201, 2600}, {4207, 2602}, {4218, 2603}, {4200, 2608}, {4201, 2612}, {4217, 2604},
+    {4218, 2605}, {4168, 2606}, {4123, 2607}, {4120, 2609}, {4161, 2610}, {4172, 2611}, {4170, 2613}, {4175, 2614},
+    {4162, 2615}, {4114, 2617}, {4214, 2618}, {956, 2621}, {4213, 2624}, {130, 2626}, {4164, 2628}, {4163, 2631},
+    {4180, 2627}, {4175, 2629}, {4117, 2630}, {4179, 2632}, {4161, 2635}, {4191, 2636}, {4179, 2673}, {4187, 2638},
+    {4186, 2640}, {4153, 2641}, {4181, 2642}, {4162, 2682}, {4169, 2643}, {4179, 2669}, {4158, 2644}, {327, 2652},
+    {4190, 2645}, {862, 2646}, {4160, 2647}, {4140, 2650}, {4125, 2651}, {4012, 2519}, {4145, 2654}, {4128, 2655},
+    {4137, 2656}, {4220, 2657}, {4141, 2658}, {4138, 2659}, {4117, 2660}, {4133, 2664}, {4137, 2665}, {4132, 2666},
+    {4212, 2668}, {4140, 2670}, {4137, 2671}, {4203, 2672}, {4158, 2688}, {4155, 2711}, {4135, 2674}, {4156, 2675},
+    {4130, 2676}, {4156, 2678}, {895, 2679}, {4103, 2680}, {398, 2681}, {4186, 2636}, {4195, 2683}, {4186, 2685},
+    {4149, 2637}, {4150, 2686}, {4198, 2687}, {4147, 2689}, {4196, 2690}, {4158, 2691}, {4110, 2692}, {4101, 2693},
+    {4107, 2704}, {4105, 2708}, {4104, 2714}, {4114, 2719}, {4125, 2694}, {4107, 2695}, {4114, 2696}, {4127, 2697},
+    {4182, 2698}, {4110, 2700}, {4122, 2717}, {521, 2699}, {4106, 2701}, {4113, 2702}, {4120, 2703}, {4168, 2705},
+    {4103, 2706}, {4103, 2707}, {4112, 2709}, {4098, 2710}, {4121, 2712}, {4097, 2713}, {625, 2715}, {4111, 2691},
+    {4163, 2718}, {4161, 2720}, {4166, 2721}, {4116, 2722}, {4108, 2723}, {4326, 2724}, {94, 2725}, {4122, 2728},
+    {4218, 2718}, {4333, 2730}, {4226, 2731}, {957, 2732}, {4325, 2733}, {4331, 2735}, {4233, 2736}, {4272, 2738},
+    {4333, 2739}, {4324, 2740}, {4279, 2741}, {4305, 2742}, {785, 2743}, {4304, 2744}, {0, 2745}, {4303, 2746},
+    {4336, 2748}, {4320, 2749}, {4270, 2750}, {602, 2751}, {4349, 2752}, {474, 2753}, {4268, 2754}, {4323, 2755},
+    {4331, 2734}, {4342, 2756}, {4259, 2757}, {4328, 2758}, {4291, 2759}, {97, 2816}, {4329, 2917}, {4329, 2907},
+    {4320, 2734}, {4289, 2761}, {4250, 2757}, {4261, 2762}, {4297, 2763}, {4349, 2764}, {24, 2765}, {4249, 2766},
+    {4254, 2768}, {4343, 2734}, {4294, 2776}, {4298, 2767}, {4309, 2769}, {4242, 2770}, {4335, 2734}, {4301, 2771},
+    {4312, 2772}, {4288, 2774}, {4299, 2775}, {4318, 2777}, {4273, 2778}, {4274, 2779}, {4319, 2784}, {4309, 2785},
+    {4304, 2801}, {4312, 2781}, {320, 2817}, {4310, 2916}, {4280, 2783}, {4176, 2637}, {4326, 2786}, {4313, 2804},
+    {4225, 2787}, {4230, 2789}, {4314, 2790}, {4299, 2791}, {4229, 2792}, {4271, 2793}, {4289, 2794}, {4410, 2795},
+    {4272, 2796}, {4279, 2797}, {4292, 2799}, {216, 2800}, {4273, 2802}, {4259, 2803}, {4265, 2805}, {4296, 2806},
+    {4280, 2808}, {4304, 2811}, {4305, 2813}, {4279, 2814}, {4276, 2815}, {1257, 2818}, {4287, 2819}, {4284, 2820},
+    {4267, 2773}, {4297, 2807}, {4258, 2809}, {4302, 2810}, {731, 2821}, {1077, 2822}, {4310, 2823}, {4260, 2824},
+    {1090, 2826}, {4287, 2829}, {4313, 2830}, {4229, 2831}, {4264, 2832}, {4274, 2833}, {942, 2834}, {585, 2835},
+    {4275, 2934}, {4281, 2848}, {4319, 2864}, {4239, 2836}, {4248, 2837}, {4225, 2838}, {360, 2841}, {4230, 2940},
+    {4286, 2809}, {4328, 2906}, {4277, 2840}, {1056, 2842}, {4234, 2943}, {4310, 2843}, {1150, 2844}, {1267, 2845},
+    {4234, 2839}, {4253, 2846}, {4252, 2847}, {4232, 2839}, {4228, 2849}, {4298, 2850}, {4337, 2851}, {554, 2853},
+    {4252, 2854}, {4339, 2855}, {4224, 2856}, {4249, 2881}, {4301, 2939}, {4255, 2935}, {4247, 2839}, {4251, 2858},
+    {4411, 2857}, {4251, 2859}, {4347, 2860}, {4227, 2839}, {4449, 2861}, {4240, 2862}, {4292, 2863}, {1050, 2865},
+    {4251, 2867}, {4444, 2877}, {1171, 2868}, {4414, 2869}, {4251, 2857}, {4458, 2870}, {4457, 2871}, {4452, 2873},
+    {4476, 2874}, {4475, 2875}, {4479, 2876}, {4454, 2878}, {4452, 2879}, {4456, 2880}, {4477, 2882}, {829, 2883},
+    {4394, 2884}, {4369, 2885}, {254, 2886}, {4475, 2887}, {339, 2944}, {4449, 3045}, {4474, 2888}, {4396, 2889},
+    {4397, 2890}, {4461, 2891}, {4387, 2892}, {4479, 2893}, {4474, 2896}, {4466, 2897}, {4381, 2898}, {4235, 2860},
+    {4464, 2900}, {4463, 2901}, {4473, 3045}, {4384, 2902}, {4420, 2904}, {4421, 2905}, {4476, 2908}, {110, 2945},
+    {4433, 3044}, {4426, 2909}, {4472, 2910}, {4392, 2911}, {4281, 2807}, {4291, 2773}, {4268, 2810}, {4393, 2912},
+    {774, 2920}, {4422, 2913}, {4426, 2914}, {4396, 2915}, {4418, 2918}, {4398, 2919}, {4399, 2921}, {4400, 2922},
+    {4438, 2909}, {4445, 2923}, {4360, 2924}, {4460, 2925}, {4404, 2928}, {226, 2936}, {4441, 2927}, {4364, 2929},
+    {4365, 2930}, {4442, 2931}, {4409, 2932}, {4438, 2933}, {4234, 2906}, {565, 2937}, {4353, 2938}, {4412, 2941},
+    {889, 2942}, {4413, 2946}, {4414, 2947}, {4448, 2948}, {4402, 2949}, {4382, 2950}, {4391, 2951}, {1177, 2952},
+    {313, 2953}, {425, 2954}, {1307, 2955}, {909, 2956}, {1091, 2957}, {592, 2958}, {783, 2959}, {1188, 2960},
+    {158, 2961}, {1254, 2962}, {4386, 2963}, {4384, 2964}, {4384, 2965}, {4377, 2966}, {4423, 2967}, {4373, 2968},
+    {4391, 2969}, {4387, 2970}, {4396, 2971}, {4431, 2972}, {265, 2973}, {4458, 2974}, {4399, 2971}, {4400, 2975},
+    {4456, 2976}, {4400, 2977}, {4462, 2978}, {4390, 2979}, {751, 2980}, {4387, 3008}, {4404, 3058}, {4355, 2982},
+    {4394, 2983}, {4409, 2984}, {6, 2985}, {4449, 2986}, {4400, 2987}, {4445, 2992}, {1194, 3000}, {4409, 3009},
+    {4353, 3069}, {4359, 2990}, {4352, 2991}, {4362, 2989}, {454, 2995}, {4371, 3066}, {4460, 2996}, {4364, 2997},
+    {4436, 2998}, {4463, 2999}, {4398, 3001}, {4379, 3002}, {4368, 3003}, {4391, 3005}, {279, 3007}, {4375, 3010},
+    {4362, 2988}, {4366, 3011}, {4538, 3012}, {4370, 3013}, {4478, 3014}, {4360, 2988}, {4378, 3016}, {4481, 3017},
+    {994, 3018}, {4582, 3022}, {4537, 3024}, {4583, 3046}, {4592, 3040}, {4596, 3042}, {4354, 2988}, {4359, 2988},
+    {4359, 2988}, {4585, 3052}, {4591, 3048}, {4588, 3062}, {4534, 3057}, {4577, 3026}, {4603, 3027}, {4597, 3028},
+    {4605, 3048}, {4558, 3029}, {4592, 3030}, {4583, 3031}, {4599, 3032}, {4599, 3033}, {4600, 3034}, {4596, 3035},
+    {4504, 3036}, {4598, 3037}, {990, 3038}, {1068, 3039}, {4512, 3041}, {4591, 3043}, {676, 3047}, {4518, 3049},
+    {4593, 3050}, {4510, 3051}, {4511, 3053}, {4564, 3054}, {1153, 3056}, {4507, 3059}, {4544, 3060}, {4567, 3063},
+    {604, 3064}, {4544, 3065}, {4511, 3067}, {4564, 3072}, {4556, 3081}, {4558, 3086}, {4553, 3085}, {4555, 3089},
+    {4570, 3087}, {4527, 3068}, {4490, 3070}, {4570, 3071}, {4559, 3087}, {4488, 3073}, {4545, 3074}, {4494, 3076},
+    {4556, 3088}, {4572, 3078}, {4534, 3079}, {4566, 3080}, {4536, 3082}, {4557, 3084}, {4558, 3090}, {4574, 3091},
+    {4569, 3092}, {4578, 3093}, {4575, 3094}, {4543, 3095}, {4544, 3096}, {4530, 3097}, {4509, 3098}, {861, 3099},
+    {4601, 3100}, {4548, 3101}, {460, 3103}, {4524, 3194}, {4551, 3104}, {296, 3105}, {1228, 3106}, {4521, 3108},
+    {4519, 3109}, {4527, 3110}, {4526, 3111}, {4499, 3112}, {4571, 3088}, {1165, 3113}, {4537, 3115}, {4522, 3116},
+    {4522, 3117}, {4586, 3118}, {4542, 3119}, {4585, 3120}, {4564, 3121}, {4490, 3122}, {4588, 3123}, {4530, 3124},
+    {4523, 3125}, {153, 3126}, {125, 3127}, {4540, 3128}, {4520, 3129}, {4537, 3130}, {4573, 3131}, {4530, 3132},
+    {4539, 3133}, {4560, 3136}, {4562, 3137}, {4564, 3138}, {4573, 3139}, {618, 3146}, {4562, 3140}, {793, 3149},
+    {4577, 3136}, {4560, 3141}, {4582, 3138}, {4579, 3137}, {704, 3148}, {4561, 3142}, {1174, 3151}, {4566, 3143},
+    {47, 3150}, {4567, 3152}, {230, 3161}, {4564, 3153}, {1151, 3160}, {4565, 3154}, {594, 3163}, {4554, 3155},
+    {766, 3162}, {4480, 3144}, {4559, 3147}, {791, 3156}, {761, 3157}, {4503, 3158}, {4505, 3159}, {4510, 3134},
+    {4497, 3165}, {4547, 3166}, {4517, 3167}, {4510, 3168}, {4550, 3169}, {4497, 3170}, {4509, 3134}, {4490, 3171},
+    {4510, 3134}, {4500, 3172}, {4718, 3173}, {561, 3174}, {4725, 3175}, {4710, 3176}, {415, 3200}, {4714, 3301},
+    {4727, 3281}, {4708, 3177}, {4697, 3178}, {4709, 3179}, {4717, 3180}, {4719, 3181}, {4715, 3183}, {4713, 3184},
+    {4707, 3186}, {4690, 3187}, {4622, 3189}, {4623, 3190}, {4624, 3191}, {4735, 3192}, {931, 3201}, {4626, 3272},
+    {4724, 3195}, {4711, 3196}, {4731, 3197}, {4681, 3198}, {196, 3202}, {4708, 3303}, {4731, 3199}, {4725, 3204},
+    {4734, 3206}, {4727, 3207}, {809, 3208}, {4639, 3210}, {4677, 3211}, {4635, 3212}, {4690, 3213}, {573, 3214},
+    {4714, 3203}, {4674, 3307}, {4701, 3216}, {4645, 3217}, {4646, 3218}, {4686, 3219}, {4698, 3220}, {4625, 3221},
+    {4677, 3224}, {4674, 3227}, {4675, 3223}, {4720, 3225}, {4618, 3226}, {4684, 3220}, {4693, 3229}, {4616, 3230},
+    {4716, 3231}, {4698, 3232}, {4700, 3233}, {4675, 3220}, {4697, 3234}, {4690, 3235}, {4688, 3236}, {4689, 3237},
+    {4666, 3238}, {4702, 3239}, {55, 3240}, {4683, 3241}, {4669, 3242}, {4694, 3243}, {4700, 3245}, {4649, 3246},
+    {4645, 3247}, {4655, 3248}, {4649, 3249}, {4653, 3250}, {4662, 3251}, {4647, 3252}, {4642, 3253}, {4664, 3254},
+    {4630, 3255}, {4642, 3257}, {4654, 3258}, {4684, 3259}, {4640, 3203}, {4644, 3260}, {4642, 3261}, {4687, 3262},
+    {4714, 3264}, {4645, 3265}, {4621, 3266}, {4713, 3267}, {4658, 3268}, {4641, 3269}, {4644, 3270}, {4706, 3273},
+    {4707, 3274}, {4660, 3275}, {4654, 3276}, {4710, 3277}, {911, 3278}, {4655, 3280}, {4650, 3282}, {297, 3283},
+    {587, 3284}, {4655, 3285}, {4623, 3286}, {4608, 3292}, {4622, 3287}, {4624, 3288}, {4611, 3289}, {4703, 3290},
+    {4616, 3291}, {93, 3293}, {4711, 3294}, {4634, 3295}, {697, 3328}, {4615, 3429}, {4714, 3296}, {4715, 3297},
+    {789, 3298}, {4623, 3299}, {4658, 3300}, {4619, 3302}, {4618, 3304}, {4627, 3308}, {4628, 3309}, {4614, 3306},
+    {4608, 3310}, {718, 3311}, {4625, 3329}, {4611, 3334}, {4628, 3335}, {4634, 3334}, {4633, 3338}, {4622, 3346},
+    {4631, 3343}, {4633, 3312}, {4639, 3313}, {4631, 3314}, {4677, 3315}, {4839, 3316}, {4845, 3317}, {4854, 3319},
+    {4793, 3320}, {4839, 3322}, {4799, 3323}, {4742, 3324}, {4834, 3325}, {4847, 3327}, {4858, 3330}, {4835, 3332},
+    {4863, 3345}, {4842, 3333}, {409, 3336}, {4832, 3337}, {4843, 3339}, {4842, 3340}, {4778, 3341}, {4857, 3342},
+    {4851, 3344}, {4812, 3347}, {4861, 3348}, {4783, 3349}, {4630, 3343}, {4855, 3350}, {1204, 3351}, {4859, 3352},
+    {4857, 3353}, {4806, 3355}, {4762, 3357}, {4769, 3358}, {4774, 3360}, {1317, 3361}, {4765, 3362}, {4766, 3366},
+    {4842, 3367}, {4800, 3370}, {4816, 3368}, {4812, 3369}, {4766, 3371}, {1263, 3372}, {111, 3373}, {4802, 3374},
+    {4814, 3375}, {4820, 3376}, {4776, 3378}, {4800, 3379}, {4803, 3381}, {4813, 3382}, {4808, 3383}, {4756, 3384},
+    {4807, 3385}, {4747, 3386}, {4828, 3387}, {4824, 3388}, {4817, 3389}, {4801, 3390}, {4830, 3391}, {4817, 3392},
+    {4812, 3393}, {4793, 3394}, {4794, 3395}, {4814, 3396}, {4835, 3397}, {4824, 3398}, {4827, 3399}, {4830, 3400},
+    {4801, 3401}, {4768, 3402}, {4788, 3404}, {4778, 3406}, {4789, 3407}, {4761, 3408}, {4798, 3409}, {4808, 3410},
+    {4851, 3411}, {4770, 3412}, {4772, 3413}, {4792, 3453}, {4855, 3414}, {48, 3456}, {4783, 3557}, {4853, 3415},
+    {4799, 3416}, {1009, 3417}, {4784, 3418}, {4840, 3419}, {4793, 3420}, {4922, 3421}, {621, 3422}, {4792, 3424},
+    {1052, 3426}, {4844, 3427}, {4747, 3428}, {4786, 3430}, {4799, 3431}, {4742, 3432}, {4826, 3433}, {4771, 3395},
+    {4740, 3434}, {4793, 3435}, {4795, 3436}, {4923, 3437}, {4780, 3438}, {4779, 3439}, {4833, 3440}, {4750, 3441},
+    {4920, 3442}, {4835, 3443}, {4737, 3444}, {4828, 3445}, {4755, 3446}, {4742, 3447}, {4744, 3448}, {4921, 3449},
+    {4744, 3451}, {4843, 3454}, {600, 3455}, {4822, 3457}, {4845, 3458}, {4820, 3459}, {4847, 3460}, {4766, 3461},
+    {4764, 3487}, {4766, 3462}, {4780, 3463}, {4803, 3362}, {4767, 3464}, {4752, 3465}, {4754, 3466}, {4739, 3467},
+    {4746, 3468}, {4757, 3469}, {4772, 3470}, {4750, 3471}, {4861, 3472}, {4759, 3473}, {4759, 3474}, {4961, 3476},
+    {4966, 3477}, {4982, 3478}, {4871, 3479}, {4973, 3480}, {4988, 3481}, {4984, 3482}, {4948, 3483}, {4984, 3484},
+    {4960, 3485}, {4878, 3488}, {1010, 3496}, {4879, 3489}, {4880, 3490}, {4991, 3491}, {4983, 3492}, {4911, 3495},
+    {4961, 3493}, {4979, 3497}, {1087, 3498}, {4936, 3500}, {4975, 3520}, {4991, 3528}, {4989, 3542}, {4897, 3537},
+    {4989, 3501}, {1092, 3502}, {4893, 3503}, {4983, 3504}, {4976, 3505}, {4896, 3506}, {4950, 3507}, {4942, 3509},
+    {4928, 3511}, {4989, 3493}, {4929, 3512}, {4895, 3513}, {4902, 3514}, {4930, 3516}, {4904, 3518}, {4940, 3519},
+    {4880, 3521}, {4907, 3522}, {509, 3530}, {4937, 3523}, {4955, 3526}, {4953, 3527}, {4899, 3529}, {4913, 3531},
+    {4940, 3524}, {4947, 3532}, {4955, 3533}, {4916, 3535}, {4917, 3536}, {4954, 3538}, {4968, 3539}, {4957, 3540},
+    {4921, 3541}, {4864, 3543}, {4964, 3544}, {1241, 3584}, {4946, 3685}, {4871, 3545}, {4929, 3524}, {4961, 3546},
+    {4952, 3547}, {201, 3548}, {516, 3549}, {4909, 3550}, {4897, 3551}, {4909, 3552}, {4899, 3553}, {4902, 3555},
+    {1310, 3556}, {4915, 3558}, {4904, 3559}, {4936, 3560}, {4937, 3561}, {4885, 3562}, {4920, 3563}, {4940, 3564},
+    {4898, 3565}, {1313, 3566}, {4921, 3568}, {4971, 3569}, {108, 3570}, {4919, 3572}, {4919, 3573}, {4913, 3574},
+    {1001, 3575}, {817, 3585}, {4916, 3684}, {4972, 3576}, {4962, 3586}, {4963, 3608}, {54, 3587}, {4923, 3686},
+    {927, 3577}, {59, 3578}, {4909, 3579}, {4966, 3580}, {4967, 3582}, {4925, 3583}, {897, 3590}, {4919, 3591},
+    {4927, 3593}, {67, 3594}, {4885, 3595}, {4886, 3596}, {4887, 3597}, {4876, 3600}, {5050, 3601}, {341, 3602},
+    {4891, 3603}, {4917, 3604}, {4867, 3605}, {4894, 3616}, {4888, 3619}, {4879, 3630}, {4875, 3635}, {4868, 3607},
+    {553, 3609}, {4880, 3708}, {4891, 3610}, {4871, 3612}, {4980, 3613}, {4869, 3617}, {4882, 3618}, {4882, 3620},
+    {4984, 3621}, {1054, 3622}, {4879, 3624}, {1206, 3625}, {4883, 3626}, {4888, 3644}, {5086, 3627}, {4994, 3628},
+    {5084, 3629}, {5093, 3631}, {5105, 3633}, {609, 3634}, {5091, 3671}, {5100, 3637}, {5002, 3638}, {5076, 3640},
+    {4942, 3567}, {4987, 3632}, {5094, 3636}, {5096, 3641}, {5005, 3643}, {5096, 3645}, {5100, 3646}, {5112, 3647},
+    {5070, 3648}, {5088, 3649}, {5095, 3650}, {5117, 3651}, {5066, 3652}, {5092, 3653}, {5106, 3654}, {5095, 3636},
+    {5016, 3656}, {270, 3657}, {5109, 3659}, {5108, 3661}, {5109, 3674}, {5097, 3662}, {5022, 3663}, {5023, 3664},
+    {5061, 3665}, {5025, 3666}, {5068, 3667}, {5116, 3668}, {5057, 3669}, {388, 3670}, {5056, 3672}, {5059, 3673},
+    {1073, 3675}, {5075, 3676}, {5111, 3677}, {5067, 3678}, {5086, 3680}, {5084, 3681}, {5014, 3696}, {5070, 3682},
+    {207, 3683}, {595, 3687}, {5057, 3689}, {5068, 3690}, {760, 3691}, {5063, 3692}, {838, 3693}, {796, 3694},
+    {1133, 3695}, {5085, 3697}, {5042, 3698}, {5087, 3699}, {121, 3700}, {5077, 3702}, {5045, 3703}, {5046, 3704},
+    {5058, 3705}, {1020, 3706}, {5095, 3707}, {5049, 3710}, {937, 3711}, {26, 3713}, {721, 3714}, {5064, 3715},
+    {5071, 3716}, {5076, 3717}, {5075, 3718}, {4996, 3730}, {4997, 3731}, {5114, 3732}, {5031, 3733}, {1094, 3734},
+    {4935, 3632}, {4934, 3632}, {5030, 3735}, {5020, 3736}, {5034, 3737}, {5032, 3738}, {5035, 3742}, {1045, 3739},
+    {5063, 3741}, {5028, 3743}, {5065, 3744}, {5048, 3745}, {5068, 3746}, {5030, 3747}, {5032, 3749}, {5026, 3745},
+    {5024, 3750}, {5050, 3752}, {5025, 3753}, {5077, 3755}, {5055, 3756}, {349, 3757}, {5053, 3753}, {5000, 3759},
+    {5041, 3760}, {5052, 3751}, {5052, 3776}, {5032, 3776}, {5043, 3781}, {4924, 3567}, {5036, 3791}, {5051, 3790},
+    {5012, 3761}, {5001, 3762}, {4993, 3792}, {5013, 3763}, {39, 3766}, {5017, 3767}, {5098, 3768}, {426, 3769},
+    {5003, 3765}, {4995, 3770}, {5004, 3792}, {5001, 3771}, {5049, 3751}, {5110, 3656}, {5012, 3792}, {5079, 3772},
+    {4995, 3773}, {5040, 3775}, {5042, 3781}, {5001, 3765}, {5009, 3777}, {5008, 3779}, {754, 3780}, {5070, 3782},
+    {5105, 3778}, {884, 3783}, {5071, 3785}, {5110, 3786}, {5011, 3787}, {5019, 3788}, {5004, 3789}, {5012, 3788},
+    {5016, 3793}, {5001, 3794}, {5019, 3800}, {5015, 3795}, {5120, 3796}, {5228, 3797}, {5233, 3797}, {5216, 3798},
+    {5218, 3799}, {5236, 3801}, {5223, 3802}, {5221, 3803}, {5217, 3804}, {5220, 3805}, {5203, 3806}, {5217, 3807},
+    {955, 3808}, {5238, 3809}, {5135, 3812}, {5162, 3813}, {5137, 3815}, {5246, 3816}, {380, 3817}, {1014, 3818},
+    {5243, 3819}, {5140, 3821}, {5232, 3822}, {5165, 3823}, {5191, 3825}, {5145, 3826}, {5241, 3827}, {5246, 3828},
+    {5243, 3832}, {5225, 3836}, {5239, 3829}, {5157, 3830}, {5192, 3831}, {5197, 3840}, {5187, 3868}, {833, 3833},
+    {5155, 3834}, {5150, 3835}, {5157, 3837}, {5202, 3838}, {5159, 3839}, {5213, 3841}, {1124, 3842}, {5208, 3843},
+    {982, 3844}, {5187, 3845}, {5235, 3846}, {5143, 3847}, {5199, 3848}, {5196, 3849}, {5209, 3850}, {964, 3851},
+    {323, 3852}, {5208, 3853}, {5185, 3854}, {5171, 3856}, {170, 3857}, {5184, 3859}, {5223, 3796}, {9, 3860},
+    {5207, 3863}, {5132, 3864}, {5224, 3865}, {5184, 3866}, {5201, 3867}, {5202, 3870}, {5220, 3871}, {5208, 3872},
+    {5181, 3873}, {5212, 3839}, {5201, 3874}, {5183, 3875}, {387, 3876}, {5155, 3877}, {5185, 3878}, {5149, 3879},
+    {5148, 3880}, {5162, 3883}, {5164, 3884}, {5155, 3884}, {5245, 3885}, {331, 3886}, {5143, 3887}, {5235, 3888},
+    {5232, 3889}, {98, 3896}, {5233, 3890}, {1242, 3899}, {5238, 3891}, {5011, 3778}, {1043, 3898}, {5197, 3892},
+    {5198, 3894}, {5221, 3796}, {5199, 3897}, {5200, 3901}, {5201, 3903}, {5202, 3905}, {5203, 3907}, {5204, 3909},
+    {5205, 3911}, {5177, 3928}, {5172, 3926}, {5178, 3919}, {5169, 3913}, {5210, 3914}, {5167, 3917}, {5222, 3918},
+    {5170, 3920}, {5214, 3921}, {5181, 3922}, {5124, 3923}, {5217, 3924}, {5123, 3925}, {5130, 3927}, {5130, 3929},
+    {5126, 3930}, {5212, 3932}, {5176, 3933}, {5148, 3935}, {5146, 3936}, {5144, 3937}, {5126, 3938}, {5133, 3939},
+    {5207, 3940}, {5122, 3941}, {5124, 3942}, {5136, 3943}, {5122, 3944}, {5142, 3945}, {240, 3946}, {692, 3947},
+    {447, 3948}, {5149, 3949}, {1306, 3951}, {5145, 3952}, {5161, 3953}, {5123, 3954}, {5136, 3955}, {5141, 3957},
+    {5141, 3958}, {5139, 3968}, {5244, 4012}, {5129, 3959}, {5144, 3941}, {5147, 3960}, {5131, 3961}, {1108, 3963},
+    {5362, 3964}, {5249, 3965}, {5351, 3966}, {5344, 3969}, {5339, 3970}, {188, 3971}, {1051, 3972}, {5350, 3973},
+    {5359, 3974}, {5365, 3981}, {5353, 3987}, {5257, 3975}, {5348, 3976}, {5344, 3977}, {5358, 3978}, {5373, 3979},
+    {5262, 3980}, {5350, 3982}, {5264, 3983}, {5315, 3984}, {5325, 3985}, {5372, 3986}, {5370, 3988}, {5350, 3989},
+    {5321, 3990}, {5293, 3991}, {686, 3992}, {5369, 3993}, {5368, 3995}, {1122, 3996}, {5375, 3997}, {5360, 3998},
+    {5362, 3999}, {5368, 4000}, {5371, 4001}, {5370, 4002}, {5327, 4003}, {5272, 4004}, {5329, 4005}, {5278, 4006},
+    {5322, 4007}, {5441, 4008}, {5330, 4009}, {5368, 4010}, {915, 4011}, {5339, 4013}, {5320, 4014}, {232, 4015},
+    {5290, 4016}, {5336, 4017}, {5319, 4018}, {5293, 4019}, {5361, 4020}, {5319, 4021}, {5337, 4022}, {5350, 3983},
+    {5297, 4023}, {5298, 4024}, {5262, 4025}, {5319, 4026}, {5302, 4027}, {5315, 4029}, {5328, 4030}, {5333, 4033},
+    {5329, 4034}, {5321, 4035}, {5341, 4036}, {5321, 4037}, {5252, 4038}, {5311, 4039}, {5370, 4040}, {116, 4042},
+    {5371, 4043}, {5286, 4045}, {763, 4046}, {730, 4047}, {5291, 4049}, {5287, 4050}, {5302, 4051}, {5296, 4052},
+    {5288, 4053}, {5307, 4054}, {5363, 4055}, {5295, 4056}, {5288, 4058}, {5285, 4059}, {5281, 4061}, {5282, 4060},
+    {5309, 4062}, {5285, 4064}, {5286, 4092}, {5280, 4063}, {5286, 4065}, {5306, 4066}, {5282, 4067}, {5335, 4068},
+    {5296, 4069}, {5347, 4070}, {5344, 4071}, {5339, 4072}, {5301, 4073}, {5341, 4074}, {407, 4075}, {5292, 4076},
+    {5292, 4077}, {5435, 4078}, {5260, 4079}, {5257, 4080}, {5251, 4081}, {5337, 4083}, {5277, 4084}, {5343, 4085},
+    {5350, 4086}, {5304, 4087}, {5265, 4088}, {5260, 4089}, {5253, 4090}, {5355, 4091}, {5250, 4093}, {5260, 4095},
+    {5248, 4096}, {5267, 4097}, {303, 4098}, {5359, 4099}, {5361, 4100}, {99, 4102}, {818, 4103}, {5267, 4104},
+    {5267, 4195}, {5273, 4105}, {5260, 4106}, {5258, 4107}, {5370, 4108}, {5274, 4111}, {5257, 4112}, {5281, 4113},
+    {977, 4114}, {5501, 4115}, {5494, 4116}, {5270, 4195}, {5484, 4117}, {5415, 4118}, {5406, 4119}, {5440, 4120},
+    {5272, 4195}, {5408, 4121}, {5445, 4122}, {5447, 4123}, {5455, 4124}, {5441, 4125}, {5457, 4126}, {5458, 4127},
+    {5405, 4128}, {479, 4129}, {241, 4130}, {5465, 4131}, {5452, 4132}, {5398, 4133}, {5454, 4134}, {5448, 4135},
+    {5444, 4167}, {1076, 4136}, {5440, 4137}, {5465, 4138}, {5460, 4139}, {5463, 4140}, {5470, 4141}, {5390, 4142},
+    {228, 4143}, {5429, 4144}, {5465, 4145}, {5442, 4146}, {5457, 4147}, {5434, 4148}, {5464, 4150}, {5436, 4151},
+    {5468, 4152}, {5450, 4154}, {5439, 4155}, {5417, 4156}, {5440, 4167}, {5409, 4159}, {5445, 4161}, {5491, 4163},
+    {5423, 4164}, {5435, 4165}, {1302, 4166}, {5439, 4168}, {5495, 4169}, {5423, 4170}, {5483, 4172}, {5435, 4173},
+    {5411, 4162}, {436, 4174}, {5425, 4175}, {169, 4177}, {5384, 4178}, {5416, 4162}, {5464, 4179}, {5419, 4180},
+    {5437, 4181}, {5433, 4182}, {5425, 4184}, {1030, 4185}, {5471, 4187}, {1093, 4188}, {5472, 4189}, {839, 4190},
+    {5467, 4191}, {5379, 4192}, {5465, 4193}, {5380, 4194}, {5469, 4196}, {5431, 4197}, {5402, 4198}, {5378, 4199},
+    {5419, 4162}, {5457, 4200}, {5379, 4201}, {5390, 4202}, {5391, 4203}, {841, 4204}, {5377, 4205}, {5422, 4206},
+    {5441, 4157}, {5455, 4171}, {5461, 4176}, {5468, 4183}, {5448, 4207}, {5398, 4208}, {5455, 4209}, {1019, 4210},
+    {5380, 4211}, {5401, 4212}, {5415, 4213}, {5402, 4214}, {5385, 4215}, {5401, 4216}, {513, 4217}, {70, 4219},
+    {66, 4220}, {5403, 4221}, {5447, 4222}, {5393, 4224}, {5387, 4241}, {5504, 4223}, {5563, 4225}, {5620, 4227},
+    {5610, 4228}, {5617, 4229}, {5614, 4230}, {5511, 4231}, {5627, 4232}, {63, 4234}, {5609, 4235}, {5625, 4236},
+    {746, 4237}, {5613, 4238}, {5608, 4239}, {5615, 4240}, {5614, 4242}, {5520, 4243}, {157, 4244}, {5616, 4245},
+    {544, 4246}, {5600, 4247}, {5523, 4248}, {549, 4249}, {5550, 4251}, {5607, 4256}, {5602, 4270}, {5603, 4252},
+    {5614, 4253}, {1300, 4255}, {5621, 4257}, {5629, 4258}, {581, 4259}, {43, 4260}, {5624, 4261}, {5623, 4262},
+    {5627, 4263}, {1102, 4264}, {5536, 4265}, {5587, 4266}, {5575, 4268}, {5539, 4269}, {5580, 4271}, {5626, 4272},
+    {5624, 4254}, {5532, 4275}, {5580, 4276}, {5581, 4277}, {5580, 4278}, {5583, 4279}, {5595, 4281}, {5581, 4282},
+    {699, 4283}, {1223, 4284}, {5569, 4285}, {5574, 4286}, {770, 4287}, {5595, 4288}, {797, 4352}, {5592, 4453},
+    {5572, 4290}, {5554, 4291}, {5513, 4293}, {5518, 4294}, {5519, 4295}, {5570, 4298}, {5559, 4299}, {5608, 4254},
+    {5560, 4300}, {5561, 4301}, {5582, 4303}, {5586, 4306}, {5564, 4307}, {5565, 4308}, {5595, 4309}, {5581, 4311},
+    {5538, 4312}, {5545, 4314}, {5552, 4315}, {5542, 4316}, {5415, 4171}, {5408, 4157}, {5418, 4183}, {5413, 4176},
+    {5531, 4317}, {5528, 4320}, {5550, 4321}, {5536, 4322}, {5562, 4323}, {5550, 4324}, {5538, 4325}, {5522, 4326},
+    {5620, 4327}, {5563, 4329}, {5565, 4330}, {5611, 4331}, {50, 4332}, {5559, 4333}, {5558, 4334}, {5614, 4335},
+    {627, 4336}, {5556, 4338}, {5612, 4340}, {78, 4353}, {5591, 4425}, {5592, 4424}, {5562, 4231}, {5510, 4341},
+    {5573, 4318}, {5567, 4342}, {1233, 4343}, {5555, 4344}, {5552, 4345}, {5604, 4346}, {5565, 4348}, {5516, 4354},
+    {5525, 4367}, {5510, 4349}, {1006, 4350}, {5504, 4351}, {5509, 4355}, {1154, 4356}, {5562, 4357}, {5513, 4358},
+    {5597, 4359}, {5530, 4360}, {5520, 4361}, {5557, 4362}, {5512, 4363}, {5514, 4364}, {5591, 4365}, {5533, 4366},
+    {268, 4368}, {5529, 4469}, {5534, 4370}, {5505, 4371}, {5534, 4372}, {5522, 4373}, {397, 4374}, {34, 4375},
+    {5582, 4376}, {975, 4377}, {5531, 4378}, {5506, 4379}, {5581, 4380}, {5690, 4382}, {5570, 4383}, {5532, 4385},
+    {5532, 4386}, {5530, 4387}, {5512, 4388}, {5523, 4389}, {5630, 4390}, {5523, 4391}, {5730, 4394}, {5735, 4395},
+    {5734, 4397}, {5694, 4401}, {501, 4402}, {5740, 4403}, {5748, 4405}, {1290, 4406}, {1128, 4407}, {5748, 4408},
+    {5740, 4410}, {1328, 4411}, {5728, 4415}, {5752, 4416}, {5731, 4417}, {5714, 4418}, {5646, 4419}, {5648, 4420},
+    {5649, 4421}, {5747, 4422}, {5756, 4426}, {5728, 4427}, {5706, 4428}, {5747, 4429}, {5746, 4430}, {1184, 4432},
+    {5748, 4433}, {381, 4434}, {5756, 4435}, {5752, 4439}, {628, 4436}, {5758, 4437}, {5754, 4438}, {5747, 4440},
+    {5759, 4449}, {5750, 4468}, {5658, 4441}, {5700, 4442}, {5696, 4446}, {382, 4443}, {5701, 4444}, {5696, 4447},
+    {5719, 4448}, {5701, 4450}, {5700, 4451}, {5728, 4419}, {5727, 4452}, {5726, 4474}, {5709, 4454}, {5698, 4455},
+    {5696, 4458}, {5708, 4470}, {5745, 4466}, {5702, 4456}, {5717, 4457}, {5543, 4318}, {5698, 4459}, {5725, 4464},
+    {5703, 4475}, {5646, 4461}, {463, 4462}, {5716, 4465}, {5719, 4467}, {5687, 4471}, {5719, 4472}, {5709, 4473},
+    {5719, 4476}, {209, 4480}, {5705, 4581}, {5718, 4477}, {5694, 4479}, {5695, 4482}, {984, 4483}, {5721, 4581},
+    {5687, 4484}, {5677, 4485}, {5818, 4487}, {5667, 4486}, {5674, 4488}, {5758, 4489}, {5687, 4490}, {5682, 4491},
+    {687, 4492}, {5672, 4585}, {5691, 4550}, {5673, 4493}, {5669, 4494}, {5672, 4495}, {5751, 4496}, {5670, 4497},
+    {5667, 4498}, {5685, 4499}, {5739, 4500}, {5694, 4501}, {5665, 4502}, {5685, 4503}, {5642, 4505}, {1067, 4506},
+    {5718, 4507}, {748, 4508}, {5741, 4509}, {5639, 4512}, {385, 4513}, {5685, 4514}, {5669, 4585}, {5722, 4515},
+    {5672, 4516}, {480, 4517}, {5680, 4518}, {5679, 4519}, {5691, 4520}, {5632, 4521}, {5653, 4522}, {5729, 4523},
+    {5654, 4524}, {5647, 4525}, {5654, 4526}, {156, 4528}, {5734, 4529}, {227, 4530}, {5725, 4531}, {1070, 4532},
+    {5641, 4561}, {5633, 4533}, {5656, 4535}, {5684, 4537}, {5634, 4538}, {5741, 4539}, {5660, 4540}, {5632, 4541},
+    {5662, 4542}, {5661, 4545}, {5659, 4546}, {823, 4547}, {5659, 4549}, {5655, 4552}, {5749, 4553}, {5652, 4554},
+    {5819, 4555}, {5656, 4556}, {5671, 4557}, {5663, 4558}, {5661, 4559}, {368, 4560}, {5640, 4562}, {991, 4563},
+    {5646, 4565}, {15, 4566}, {5663, 4567}, {5642, 4568}, {5643, 4569}, {5873, 4570}, {5879, 4571}, {5764, 4572},
+    {5863, 4574}, {5766, 4575}, {5767, 4576}, {5768, 4578}, {5769, 4580}, {1146, 4583}, {995, 4584}, {683, 4586},
+    {679, 4587}, {301, 4588}, {248, 4589}, {194, 4590}, {141, 4591}, {466, 4592}, {5857, 4593}, {5856, 4594},
+    {5886, 4595}, {5842, 4596}, {1167, 4597}, {5812, 4598}, {5775, 4599}, {5886, 4600}, {842, 4601}, {5872, 4602},
+    {5800, 4603}, {1106, 4604}, {5863, 4605}, {5883, 4606}, {5882, 4607}, {5875, 4608}, {5783, 4609}, {5876, 4610},
+    {5873, 4611}, {5792, 4612}, {5887, 4613}, {5875, 4614}, {5865, 4615}, {5790, 4616}, {5886, 4617}, {5839, 4636},
+    {5886, 4618}, {5838, 4619}, {5785, 4620}, {5852, 4621}, {5827, 4625}, {5831, 4627}, {5843, 4628}, {5879, 4629},
+    {5830, 4630}, {5835, 4631}, {5830, 4632}, {5837, 4633}, {851, 4634}, {5832, 4635}, {5780, 4637}, {5851, 4638},
+    {5828, 4640}, {631, 4641}, {5840, 4642}, {5847, 4643}, {5840, 4644}, {5841, 4647}, {5846, 4648}, {5855, 4649},
+    {5773, 4650}, {703, 4651}, {5836, 4652}, {5852, 4653}, {5845, 4654}, {5847, 4655}, {1269, 4656}, {5850, 4657},
+    {459, 4658}, {5844, 4695}, {5812, 4660}, {5807, 4661}, {5806, 4662}, {5881, 4663}, {5804, 4664}, {5829, 4665},
+    {5792, 4667}, {5813, 4668}, {5805, 4670}, {5804, 4671}, {5807, 4672}, {5817, 4673}, {5823, 4674}, {5806, 4675},
+    {5855, 4659}, {5803, 4676}, {5839, 4677}, {5796, 4678}, {5841, 4679}, {5822, 4680}, {5856, 4682}, {5764, 4683},
+    {5814, 4685}, {5787, 4686}, {304, 4688}, {5846, 4689}, {5760, 4690}, {543, 4691}, {5779, 4692}, {5806, 4693},
+    {5787, 4694}, {936, 4696}, {756, 4697}, {5840, 4659}, {5879, 4698}, {6014, 4699}, {992, 4700}, {5921, 4701},
+    {5954, 4702}, {6011, 4703}, {5925, 4704}, {5968, 4705}, {5962, 4706}, {5952, 4707}, {5931, 4708}, {857, 4709},
+    {5934, 4710}, {5938, 4712}, {5990, 4713}, {5972, 4716}, {5974, 4717}, {6009, 4718}, {5934, 4719}, {5947, 4720},
+    {6075, 4721}, {5967, 4722}, {5994, 4723}, {5946, 4724}, {5921, 4725}, {5938, 4726}, {5941, 4727}, {5921, 4728},
+    {5924, 4729}, {5770, 4698}, {5937, 4730}, {5893, 4731}, {5990, 4732}, {5937, 4733}, {5942, 4734}, {506, 4735},
+    {5931, 4736}, {5986, 4737}, {5987, 4738}, {1327, 4739}, {5899, 4740}, {249, 4741}, {5971, 4743}, {5968, 4744},
+    {5908, 4746}, {5933, 4747}, {5914, 4748}, {6010, 4749}, {5922, 4750}, {6014, 4751}, {965, 4752}, {5918, 4753},
+    {6072, 4754}, {6125, 4755}, {6122, 4756}, {932, 4757}, {6114, 4758}, {6120, 4759}, {6131, 4760}, {1075, 4763},
+    {6121, 4761}, {804, 4764}, {6143, 4768}, {6124, 4779}, {6118, 4761}, {6119, 4784}, {6096, 4767}, {6135, 4769},
+    {6132, 4770}, {6113, 4771}, {7, 4772}, {6132, 4773}, {6125, 4761}, {6091, 4774}, {6132, 4775}, {6115, 4768},
+    {5766, 4681}, {5995, 4745}, {5984, 4681}, {5985, 4681}, {5770, 4681}, {5814, 4681}, {5987, 4681}, {5779, 4681},
+    {5955, 4681}, {5986, 4681}, {5955, 4681}, {5952, 4681}, {5978, 4681}, {5981, 4681}, {5817, 4681}, {5921, 4681},
+    {5812, 4681}, {5923, 4681}, {5889, 4681}, {5934, 4681}, {6062, 4681}, {5902, 4681}, {6009, 4681}, {5766, 4681},
+    {5811, 4681}, {6131, 4777}, {6061, 4778}, {5924, 4681}, {6141, 4780}, {6041, 4781}, {1168, 4782}, {6131, 4783},
+    {404, 4785}, {6049, 4786}, {6126, 4787}, {6055, 4788}, {6124, 4789}, {6129, 4790}, {6143, 4791}, {6049, 4792},
+    {6093, 4800}, {6096, 4820}, {6092, 4795}, {6099, 4796}, {6056, 4797}, {6092, 4798}, {6032, 4799}, {6085, 4802},
+    {6104, 4803}, {6039, 4804}, {6036, 4805}, {6090, 4806}, {6064, 4807}, {1131, 4809}, {6111, 4810}, {6086, 4811},
+    {6098, 4796}, {6124, 4812}, {1312, 4813}, {6097, 4814}, {1016, 4815}, {6087, 4816}, {6028, 4817}, {44, 4818},
+    {6029, 4819}, {873, 4864}, {6097, 4965}, {6104, 4965}, {6089, 4821}, {13, 4822}, {6085, 4832}, {6089, 4837},
+    {6097, 4856}, {6079, 4823}, {6139, 4824}, {6050, 4825}, {6069, 4827}, {6086, 4828}, {6052, 4829}, {958, 4865},
+    {6049, 4964}, {6090, 4830}, {6107, 4965}, {6036, 4831}, {6079, 4834}, {720, 4866}, {6052, 4967}, {6078, 4836},
+    {221, 4838}, {6054, 4839}, {6122, 4840}, {6077, 4841}, {177, 4867}, {6075, 4966}, {6079, 4842}, {1078, 4844},
+    {338, 4846}, {6101, 4848}, {6072, 4849}, {6103, 4850}, {5898, 4745}, {6061, 4851}, {6060, 4851}, {6109, 4852},
+    {6072, 4853}, {6117, 4854}, {6106, 4855}, {6113, 4857}, {6025, 4858}, {6033, 4859}, {6044, 4860}, {6017, 4862},
+    {6074, 4851}, {6020, 4863}, {6120, 4868}, {6099, 4869}, {6069, 4851}, {6122, 4870}, {6021, 4872}, {6018, 4873},
+    {6045, 4874}, {6016, 4875}, {6090, 4876}, {6046, 4877}, {6061, 4881}, {6131, 4882}, {6019, 4883}, {6045, 4884},
+    {1299, 4885}, {6134, 4886}, {5714, 4681}, {6040, 4887}, {6082, 4888}, {6083, 4889}, {6030, 4890}, {546, 4891},
+    {6081, 4990}, {6086, 4892}, {6040, 4894}, {6032, 4895}, {6027, 4897}, {6247, 4898}, {6261, 4899}, {6246, 4900},
+    {259, 4901}, {6257, 4903}, {6235, 4905}, {30, 4906}, {6149, 4908}, {6204, 4909}, {6248, 4910}, {6247, 4911},
+    {6252, 4912}, {6264, 4928}, {6250, 4951}, {6248, 4914}, {6243, 4915}, {6196, 4918}, {6241, 4919}, {6186, 4920},
+    {449, 4922}, {6264, 4923}, {6184, 4924}, {300, 4925}, {6258, 4926}, {6268, 4927}, {6165, 4929}, {6259, 4930},
+    {6189, 4931}, {6250, 4932}, {6179, 4933}, {6213, 4934}, {6248, 4935}, {6261, 4938}, {6253, 4939}, {6268, 4941},
+    {6262, 4943}, {6227, 4944}, {451, 4945}, {6177, 4946}, {6178, 4947}, {6179, 4948}, {6215, 4949}, {315, 4950},
+    {292, 4952}, {988, 4953}, {6175, 4954}, {6218, 4955}, {523, 4956}, {1229, 4957}, {6173, 4958}, {6209, 4959},
+    {6216, 4960}, {6223, 4961}, {6222, 4962}, {6216, 4963}, {6222, 4968}, {645, 4992}, {6221, 5093}, {6236, 4969},
+    {6210, 4970}, {6236, 4971}, {6239, 4972}, {6251, 4973}, {6226, 4974}, {6210, 4975}, {6199, 4976}, {6146, 4977},
+    {6217, 4978}, {6202, 4979}, {6239, 4981}, {6222, 4982}, {6205, 4983}, {6234, 4985}, {6207, 4986}, {1193, 4988},
+    {1028, 4989}, {6184, 4991}, {6199, 4993}, {6183, 4995}, {6191, 4996}, {6236, 4970}, {6212, 4997}, {6271, 4998},
+    {6179, 4999}, {6178, 5000}, {6185, 5001}, {6203, 5003}, {6204, 5004}, {6183, 5006}, {6177, 5007}, {6221, 5008},
+    {6203, 5009}, {6261, 5010}, {6180, 5011}, {6179, 5012}, {6195, 5013}, {6227, 5014}, {6254, 5015}, {6192, 5017},
+    {6153, 5018}, {6180, 5019}, {6205, 5020}, {6189, 5021}, {6234, 5024}, {6194, 5026}, {6190, 5027}, {6237, 5028},
+    {6240, 5030}, {6163, 5031}, {6147, 5032}, {6159, 5033}, {6155, 5034}, {6239, 5035}, {464, 5036}, {6153, 5037},
+    {6238, 5029}, {6156, 5038}, {6226, 5039}, {6171, 5040}, {6250, 5041}, {6156, 5043}, {6195, 5044}, {6231, 5047},
+    {6172, 5048}, {6167, 5050}, {6150, 5048}, {6219, 5051}, {6174, 5052}, {6171, 5053}, {1025, 5054}, {6170, 5083},
+    {637, 5055}, {1261, 5056}, {6166, 5057}, {6145, 5058}, {6149, 5059}, {6165, 5060}, {6155, 5061}, {6208, 5062},
+    {6209, 5064}, {6159, 5066}, {6175, 5067}, {6154, 5069}, {6174, 5070}, {6330, 5071}, {6370, 5072}, {6390, 5073},
+    {6275, 5074}, {6391, 5075}, {6375, 5076}, {6386, 5078}, {6383, 5079}, {6322, 5080}, {6370, 5081}, {6374, 5082},
+    {6382, 5084}, {6370, 5085}, {6376, 5086}, {6395, 5087}, {6371, 5088}, {6370, 5089}, {6338, 5090}, {6399, 5091},
+    {6312, 5092}, {6313, 5094}, {6368, 5095}, {6319, 5096}, {6294, 5097}, {6393, 5099}, {6378, 5100}, {438, 5101},
+    {6380, 5102}, {6387, 5103}, {6380, 5104}, {6382, 5106}, {6381, 5111}, {6308, 5107}, {275, 5108}, {184, 5109},
+    {6398, 5112}, {6340, 5113}, {6358, 5115}, {6347, 5116}, {6310, 5117}, {6392, 5118}, {6290, 5119}, {6366, 5121},
+    {6347, 5142}, {6388, 5122}, {6343, 5123}, {6361, 5124}, {6385, 5125}, {6319, 5126}, {6367, 5127}, {6283, 5128},
+    {6280, 5129}, {6323, 5130}, {6286, 5131}, {6359, 5132}, {6366, 5133}, {6351, 5134}, {364, 5136}, {6329, 5138},
+    {6351, 5139}, {6359, 5141}, {755, 5143}, {6357, 5144}, {6360, 5146}, {6276, 5147}, {6368, 5148}, {6303, 5149},
+    {6316, 5150}, {272, 5151}, {6301, 5152}, {6300, 5153}, {6305, 5154}, {6189, 5029}, {1071, 5156}, {6341, 5158},
+    {6308, 5160}, {6296, 5161}, {6311, 5162}, {6335, 5163}, {6307, 5164}, {792, 5165}, {6335, 5166}, {6306, 5167},
+    {6289, 5168}, {6311, 5169}, {6332, 5170}, {6286, 5172}, {6326, 5173}, {395, 5174}, {6332, 5175}, {6308, 5177},
+    {6276, 5178}, {6331, 5179}, {6333, 5180}, {6314, 5182}, {6325, 5184}, {6330, 5186}, {6318, 5187}, {6375, 5188},
+    {6306, 5114}, {6356, 5176}, {6331, 5189}, {6373, 5190}, {491, 5191}, {6292, 5192}, {49, 5193}, {563, 5194},
+    {568, 5195}, {1273, 5196}, {6360, 5206}, {6332, 5207}, {6273, 5208}, {6281, 5209}, {6374, 5211}, {735, 5212},
+    {6365, 5213}, {6276, 5215}, {6377, 5216}, {6275, 5218}, {6277, 5219}, {6286, 5220}, {6322, 5221}, {708, 5222},
+    {6287, 5223}, {6320, 5224}, {6384, 5225}, {6344, 5226}, {6300, 5227}, {6315, 5228}, {787, 5229}, {6290, 5230},
+    {6276, 5231}, {6289, 5232}, {6292, 5233}, {6393, 5234}, {6303, 5235}, {6299, 5236}, {6284, 5237}, {6514, 5238},
+    {6514, 5239}, {6519, 5240}, {6509, 5241}, {6516, 5242}, {6517, 5243}, {6498, 5245}, {6407, 5246}, {6509, 5247},
+    {6496, 5248}, {6505, 5250}, {6449, 5251}, {6509, 5252}, {6455, 5253}, {6511, 5254}, {6508, 5255}, {6416, 5256},
+    {6516, 5258}, {6518, 5259}, {6527, 5260}, {6497, 5261}, {6524, 5263}, {6498, 5265}, {6500, 5280}, {6507, 5299},
+    {6507, 5266}, {6432, 5267}, {6526, 5268}, {6428, 5269}, {6520, 5270}, {365, 5271}, {6426, 5272}, {6469, 5273},
+    {6478, 5274}, {6490, 5275}, {6480, 5276}, {6431, 5277}, {6428, 5278}, {6483, 5279}, {6418, 5281}, {482, 5282},
+    {6476, 5283}, {253, 5284}, {6479, 5285}, {6484, 5381}, {6648, 5390}, {6611, 5392}, {6534, 5400}, {6531, 5506},
+    {6519, 5270}, {6483, 5381}, {6640, 5286}, {6557, 5287}, {6485, 5381}, {6600, 5288}, {6513, 5270}, {6494, 5381},
+    {6476, 5376}, {6418, 5383}, {6554, 5289}, {6536, 5399}, {6321, 5176}, {6352, 5114}, {6418, 5380}, {6539, 5399},
+    {6473, 5376}, {6474, 5380}, {6482, 5376}, {6473, 5376}, {6644, 5291}, {6453, 5380}, {6556, 5292}, {6530, 5399},
+    {6554, 5294}, {6535, 5295}, {6414, 5383}, {6466, 5376}, {6439, 5376}, {6476, 5376}, {6536, 5296}, {1196, 5300},
+    {6458, 5380}, {6432, 5380}, {6424, 5383}, {6458, 5380}, {6487, 5376}, {6547, 5329}, {6462, 5380}, {6442, 5380},
+    {6441, 5379}, {6413, 5378}, {6406, 5382}, {6400, 5385}, {6440, 5379}, {6443, 5378}, {6410, 5382}, {6411, 5385},
+    {6460, 5378}, {6470, 5379}, {6405, 5382}, {6407, 5382}, {6493, 5378}, {6430, 5385}, {6436, 5379}, {6402, 5378},
+    {6593, 5301}, {6413, 5382}, {6489, 5378}, {6442, 5379}, {6446, 5379}, {6443, 5378}, {6625, 5382}, {6427, 5385},
+    {6532, 5398}, {6471, 5378}, {6493, 5378}, {6652, 5303}, {6553, 5398}, {6547, 5304}, {6714, 5305}, {6657, 5306},
+    {6428, 5384}, {6638, 5387}, {6653, 5386}, {6643, 5388}, {6712, 5307}, {6412, 5387}, {6631, 5386}, {6754, 5308},
+    {6647, 5389}, {6763, 5309}, {6648, 5386}, {1055, 5310}, {6648, 5386}, {6430, 5384}, {1024, 5312}, {6644, 5387},
+    {6638, 5384}, {6624, 5384}, {1082, 5313}, {6642, 5388}, {6595, 5389}, {6596, 5388}, {6651, 5386}, {6426, 5384},
+    {6594, 5389}, {6776, 5314}, {6655, 5386}, {6593, 5388}, {6625, 5389}, {6758, 5315}, {6767, 5316}, {6632, 5388},
+    {6606, 5391}, {6616, 5395}, {6594, 5393}, {6663, 5317}, {6627, 5391}, {6528, 5403}, {6632, 5393}, {6757, 5318},
+    {6600, 5391}, {6763, 5319}, {6633, 5393}, {6642, 5393}, {6600, 5393}, {6531, 5403}, {6628, 5391}, {328, 5321},
+    {6669, 5322}, {6737, 5323}, {6777, 5324}, {6755, 5325}, {6783, 5326}, {6732, 5327}, {6650, 5393}, {6731, 5328},
+    {6757, 5330}, {6621, 5395}, {6757, 5331}, {6602, 5395}, {6679, 5332}, {6690, 5333}, {6726, 5334}, {6772, 5336},
+    {6573, 5394}, {6535, 5397}, {723, 5337}, {636, 5338}, {6575, 5394}, {6780, 5340}, {6574, 5397}, {6591, 5397},
+    {6567, 5394}, {6684, 5342}, {6685, 5343}, {907, 5377}, {6770, 5476}, {6571, 5394}, {6570, 5394}, {6585, 5397},
+    {6774, 5344}, {6564, 5394}, {6727, 5345}, {6561, 5394}, {6568, 5394}, {6628, 5394}, {6576, 5394}, {6570, 5394},
+    {6591, 5394}, {6724, 5346}, {1215, 5347}, {6543, 5397}, {6589, 5397}, {6737, 5348}, {271, 5349}, {6727, 5351},
+    {6536, 5396}, {6667, 5320}, {6692, 5352}, {6739, 5353}, {6777, 5354}, {6685, 5356}, {6748, 5357}, {6732, 5358},
+    {6745, 5360}, {6729, 5364}, {6750, 5372}, {6679, 5362}, {6749, 5375}, {6749, 5363}, {6748, 5365}, {6738, 5366},
+    {6743, 5367}, {6721, 5368}, {6670, 5369}, {6736, 5371}, {6742, 5373}, {6730, 5374}, {6731, 5401}, {6714, 5402},
+    {6729, 5404}, {1181, 5405}, {6738, 5407}, {6717, 5409}, {6660, 5410}, {6719, 5411}, {6778, 5412}, {6692, 5413},
+    {6688, 5414}, {875, 5415}, {6711, 5416}, {6541, 5378}, {6701, 5417}, {6697, 5418}, {6697, 5419}, {6715, 5432},
+    {890, 5420}, {6677, 5421}, {6731, 5422}, {6697, 5423}, {6693, 5424}, {6734, 5425}, {6735, 5426}, {6709, 5427},
+    {1202, 5428}, {6711, 5430}, {6715, 5431}, {6691, 5433}, {6767, 5435}, {6706, 5437}, {6743, 5438}, {6744, 5440},
+    {6714, 5442}, {6712, 5443}, {6706, 5458}, {6717, 5444}, {6719, 5446}, {6715, 5447}, {6701, 5448}, {499, 5449},
+    {6539, 5396}, {6752, 5450}, {6509, 5394}, {6675, 5451}, {6679, 5452}, {6572, 5396}, {613, 5453}, {6662, 5454},
+    {6672, 5456}, {6589, 5396}, {1275, 5457}, {6678, 5459}, {6748, 5460}, {6656, 5462}, {6656, 5463}, {6664, 5465},
+    {6762, 5466}, {6670, 5467}, {6680, 5469}, {6681, 5470}, {6534, 5396}, {237, 5473}, {6740, 5474}, {150, 5475},
+    {6683, 5477}, {6659, 5478}, {6685, 5492}, {6666, 5488}, {6550, 5396}, {1282, 5479}, {6684, 5480}, {6772, 5481},
+    {6773, 5482}, {874, 5483}, {6732, 5484}, {6680, 5485}, {6767, 5320}, {6722, 5486}, {6694, 5487}, {6671, 5489},
+    {12, 5490}, {6779, 5491}, {610, 5493}, {6685, 5494}, {6660, 5495}, {6422, 5395}, {6678, 5496}, {6673, 5497},
+    {6784, 5498}, {6893, 5499}, {6883, 5500}, {444, 5501}, {6893, 5502}, {6875, 5503}, {411, 5505}, {6903, 5507},
+    {6790, 5508}, {6791, 5509}, {6834, 5510}, {6793, 5512}, {6794, 5513}, {6833, 5514}, {6838, 5515}, {6888, 5516},
+    {6836, 5517}, {6837, 5518}, {6883, 5519}, {6885, 5521}, {6907, 5522}, {52, 5524}, {6803, 5525}, {6886, 5526},
+    {6907, 5527}, {6857, 5528}, {6829, 5529}, {6907, 5530}, {6819, 5531}, {6910, 5532}, {6811, 5533}, {6904, 5534},
+    {6813, 5535}, {6908, 5537}, {6815, 5538}, {6862, 5540}, {6852, 5541}, {814, 5542}, {6864, 5543}, {6819, 5544},
+    {6907, 5545}, {6821, 5546}, {6856, 5547}, {6867, 5548}, {6863, 5549}, {6848, 5550}, {6859, 5551}, {6873, 5552},
+    {6806, 5553}, {694, 5555}, {379, 5556}, {536, 5557}, {6853, 5558}, {6830, 5562}, {6805, 5563}, {6832, 5566},
+    {6879, 5567}, {6869, 5568}, {6892, 5569}, {6874, 5570}, {6890, 5571}, {6852, 5572}, {6868, 5574}, {6856, 5575},
+    {6870, 5576}, {6867, 5597}, {6878, 5577}, {6877, 5578}, {6873, 5579}, {6875, 5580}, {6861, 5581}, {941, 5582},
+    {6848, 5583}, {6907, 5584}, {494, 5585}, {6813, 5586}, {6905, 5587}, {876, 5588}, {6817, 5589}, {925, 5590},
+    {6816, 5593}, {6831, 5594}, {6822, 5595}, {6823, 5596}, {356, 5598}, {6857, 5599}, {6820, 5600}, {6804, 5601},
+    {6816, 5602}, {6824, 5603}, {6823, 5604}, {6822, 5605}, {6846, 5606}, {1148, 5607}, {6846, 5608}, {6867, 5609},
+    {6843, 5610}, {6842, 5611}, {6837, 5612}, {137, 5613}, {6871, 5614}, {6826, 5615}, {6827, 5616}, {6880, 5617},
+    {6881, 5618}, {6835, 5619}, {856, 5620}, {6830, 5621}, {6843, 5622}, {802, 5623}, {1295, 5632}, {6842, 5733},
+    {986, 5624}, {6874, 5625}, {6786, 5626}, {6798, 5627}, {6797, 5628}, {6884, 5629}, {6800, 5631}, {6876, 5633},
+    {6887, 5634}, {6866, 5635}, {887, 5636}, {6785, 5637}, {6796, 5638}, {6891, 5639}, {6789, 5640}, {6814, 5642},
+    {6790, 5641}, {6895, 5643}, {6804, 5644}, {6814, 5645}, {6829, 5647}, {6806, 5650}, {6810, 5651}, {6804, 5652},
+    {6809, 5653}, {6806, 5654}, {6904, 5655}, {6905, 5656}, {6809, 5657}, {6804, 5658}, {6855, 5659}, {6803, 5660},
+    {6912, 5661}, {7018, 5662}, {7015, 5663}, {1103, 5664}, {7008, 5665}, {7019, 5666}, {7008, 5667}, {7015, 5668},
+    {6919, 5669}, {6999, 5670}, {7020, 5671}, {7032, 5672}, {7010, 5673}, {6995, 5674}, {7008, 5675}, {6993, 5676},
+    {7018, 5677}, {7029, 5679}, {6931, 5680}, {6932, 5681}, {7037, 5682}, {6934, 5683}, {335, 5684}, {7027, 5685},
+    {7020, 5686}, {7021, 5688}, {7033, 5689}, {7034, 5690}, {7029, 5691}, {7036, 5692}, {6942, 5693}, {7021, 5696},
+    {7029, 5678}, {7039, 5697}, {1247, 5760}, {6988, 5861}, {6982, 5698}, {6980, 5699}, {698, 5700}, {6984, 5701},
+    {6949, 5702}, {6985, 5703}, {6980, 5704}, {6981, 5705}, {7005, 5706}, {6990, 5707}, {6976, 5708}, {726, 5709},
+    {6984, 5710}, {6958, 5711}, {6959, 5712}, {485, 5713}, {6960, 5714}, {7032, 5678}, {6994, 5715}, {7007, 5716},
+    {7002, 5717}, {505, 5719}, {7001, 5720}, {6927, 5721}, {6993, 5723}, {6914, 5724}, {6969, 5725}, {6984, 5726},
+    {6988, 5727}, {7010, 5728}, {7009, 5730}, {6988, 5731}, {6943, 5732}, {174, 5735}, {6962, 5736}, {6962, 5737},
+    {6964, 5738}, {6945, 5739}, {6946, 5740}, {7036, 5742}, {6964, 5743}, {6990, 5702}, {6959, 5744}, {6951, 5745},
+    {6946, 5746}, {6957, 5747}, {7030, 5748}, {6965, 5750}, {124, 5761}, {6951, 5860}, {6972, 5751}, {6963, 5753},
+    {7017, 5754}, {6971, 5755}, {6950, 5756}, {6948, 5757}, {6962, 5758}, {7000, 5759}, {7011, 5762}, {7002, 5763},
+    {6975, 5752}, {6962, 5765}, {7006, 5770}, {6952, 5771}, {6924, 5772}, {6920, 5773}, {976, 5774}, {7013, 5776},
+    {6922, 5777}, {665, 5778}, {6920, 5779}, {7098, 5780}, {6939, 5781}, {6938, 5782}, {6919, 5784}, {6915, 5785},
+    {255, 5786}, {6945, 5752}, {7020, 5787}, {6915, 5788}, {6927, 5789}, {6940, 5791}, {6932, 5792}, {6928, 5793},
+    {6984, 5794}, {378, 5795}, {6925, 5773}, {6915, 5773}, {6939, 5796}, {6923, 5773}, {6990, 5797}, {6918, 5798},
+    {6931, 5799}, {6915, 5800}, {6923, 5801}, {6941, 5802}, {6927, 5803}, {6942, 5804}, {7099, 5805}, {1298, 5806},
+    {6926, 5807}, {6942, 5808}, {6939, 5809}, {7039, 5810}, {7151, 5811}, {7043, 5812}, {7102, 5813}, {7140, 5814},
+    {239, 5815}, {7138, 5816}, {7128, 5817}, {7090, 5818}, {7150, 5819}, {7151, 5820}, {7139, 5821}, {7160, 5822},
+    {7161, 5823}, {7147, 5824}, {7055, 5825}, {7139, 5826}, {1199, 5827}, {7152, 5828}, {7166, 5854}, {7158, 5848},
+    {7060, 5830}, {7087, 5831}, {7084, 5832}, {7112, 5833}, {7074, 5834}, {7065, 5835}, {7066, 5836}, {7156, 5837},
+    {7068, 5838}, {7151, 5840}, {7105, 5842}, {7159, 5856}, {7120, 5867}, {7116, 5864}, {7115, 5864}, {7116, 5877},
+    {7105, 5866}, {7134, 5875}, {7129, 5884}, {7111, 5897}, {7099, 5900}, {7108, 5866}, {7093, 5906}, {7077, 5913},
+    {7099, 5914}, {7085, 6051}, {7095, 5843}, {7100, 5855}, {7102, 5852}, {7108, 5864}, {7092, 5849}, {7102, 5865},
+    {7107, 5876}, {7117, 5888}, {7130, 5908}, {7119, 5907}, {7121, 5892}, {7091, 5893}, {7128, 5892}, {7113, 5888},
+    {7133, 5902}, {7092, 5909}, {7106, 5876}, {7104, 5907}, {7056, 5869}, {7090, 5862}, {7075, 5896}, {7043, 5883},
+    {7108, 5902}, {7119, 5902}, {7114, 5876}, {7063, 5880}, {7049, 5881}, {7072, 5896}, {7054, 5886}, {7131, 5902},
+    {7047, 5887}, {7095, 5909}, {7135, 5892}, {7117, 5888}, {7083, 5908}, {7085, 5896}, {7100, 5893}, {7122, 5907},
+    {7075, 5889}, {7074, 5903}, {7042, 5874}, {7075, 5889}, {7040, 5890}, {7043, 5894}, {7069, 5899}, {7046, 5898},
+    {7056, 5905}, {7053, 5891}, {7048, 5895}, {7058, 5890}, {7094, 5903}, {7097, 5903}, {7072, 5903}, {7103, 5903},
+    {7064, 5901}, {7079, 5903}, {7042, 5882}, {7043, 5857}, {7080, 5889}, {7068, 5911}, {7040, 5882}, {7040, 5857},
+    {7071, 5894}, {7057, 5920}, {7272, 5933}, {7274, 5943}, {7045, 5874}, {7078, 5889}, {7288, 5925}, {7085, 5889},
+    {7268, 5910}, {7276, 5937}, {7265, 5936}, {7273, 5921}, {7044, 5910}, {7279, 5937}, {7272, 5935}, {7276, 5922},
+    {7065, 5910}, {7287, 5926}, {7270, 5930}, {7294, 5932}, {7283, 5942}, {7284, 5946}, {7271, 5948}, {7295, 5928},
+    {7247, 5951}, {7253, 5939}, {7232, 5923}, {7248, 5956}, {7276, 5956}, {7267, 5948}, {7206, 5966}, {7258, 5956},
+    {7065, 5910}, {7254, 5844}, {7223, 5958}, {7215, 5963}, {7268, 5936}, {7207, 5962}, {7275, 5921}, {7221, 5974},
+    {7287, 5944}, {7237, 5940}, {7290, 5947}, {7238, 5952}, {7204, 5964}, {7293, 5947}, {7291, 5940}, {7209, 5845},
+    {7244, 5941}, {7248, 5954}, {7243, 5941}, {7252, 5960}, {7258, 5954}, {7232, 5947}, {7259, 5954}, {7251, 5960},
+    {7200, 5954}, {7288, 5944}, {7240, 5954}, {7249, 5947}, {7276, 5947}, {7208, 5953}, {7236, 5941}, {7281, 5940},
+    {7244, 5947}, {7225, 5979}, {7218, 5964}, {7234, 5952}, {7205, 5977}, {7250, 5960}, {7244, 5941}, {7225, 6125},
+    {7202, 5984}, {7221, 5988}, {7207, 5992}, {7185, 5984}, {7200, 5997}, {7219, 6001}, {7224, 5998}, {7225, 5998},
+    {7172, 6003}, {7175, 5992}, {7171, 6005}, {7219, 6007}, {7228, 6004}, {7181, 6008}, {7178, 6082}, {7168, 5990},
+    {7185, 5999}, {7195, 6006}, {7173, 5991}, {7182, 5999}, {7169, 6012}, {7174, 6006}, {7223, 5988}, {7186, 5999},
+    {7211, 5984}, {7191, 6006}, {7223, 6004}, {7258, 6016}, {7195, 6089}, {7217, 5988}, {7191, 6085}, {7213, 5998},
+    {7172, 5985}, {7175, 6011}, {7171, 6080}, {7199, 6108}, {7196, 6100}, {7183, 5863}, {7193, 5859}, {7177, 5871},
+    {7186, 5912}, {7178, 5985}, {7179, 5916}, {7397, 5846}, {7177, 5985}, {7395, 5957}, {7392, 5965}, {7394, 5847},
+    {550, 5850}, {7405, 5851}, {7301, 5853}, {7400, 5858}, {1318, 5868}, {7393, 5870}, {7399, 5872}, {7392, 5873},
+    {7344, 5878}, {7184, 6011}, {7423, 5885}, {7308, 5904}, {662, 5915}, {7195, 6011}, {7400, 5917}, {7186, 5863},
+    {7310, 5918}, {118, 5919}, {7311, 5924}, {7396, 5927}, {7423, 5929}, {7423, 5949}, {7414, 5950}, {1079, 5955},
+    {7419, 5945}, {7340, 5959}, {7395, 5961}, {769, 6017}, {7417, 6116}, {1234, 5968}, {7412, 5969}, {7393, 5945},
+    {7413, 5970}, {7364, 5971}, {7421, 5972}, {7416, 5973}, {7405, 5975}, {7411, 5976}, {7369, 5978}, {847, 5980},
+    {7329, 5981}, {7381, 5982}, {7366, 5983}, {7326, 5989}, {236, 5993}, {243, 5994}, {7370, 5996}, {7368, 6000},
+    {7366, 6002}, {7314, 6009}, {7389, 6013}, {7388, 6015}, {622, 6018}, {7374, 6019}, {7368, 6020}, {7341, 6021},
+    {7371, 6022}, {7389, 6023}, {7364, 6024}, {7389, 6025}, {7383, 6026}, {7347, 6027}, {7377, 6028}, {7361, 6029},
+    {7391, 6030}, {7390, 6031}, {7398, 6032}, {7397, 6033}, {7356, 6034}, {7303, 6035}, {7377, 6031}, {7372, 6036},
+    {7373, 6037}, {7418, 6038}, {18, 6039}, {7330, 6040}, {7337, 6042}, {1200, 6043}, {7363, 6044}, {375, 6045},
+    {7364, 6046}, {7350, 6047}, {7335, 6048}, {7349, 6048}, {7343, 6050}, {7316, 6052}, {7335, 6048}, {7337, 6053},
+    {7314, 6054}, {7340, 6055}, {7340, 6057}, {321, 6058}, {7402, 6059}, {7310, 6060}, {478, 6061}, {2, 6062},
+    {7336, 6048}, {7347, 6063}, {7308, 6065}, {7307, 6066}, {7356, 6067}, {7382, 6068}, {7405, 6069}, {757, 6070},
+    {283, 6071}, {7329, 6072}, {7349, 6073}, {7350, 6074}, {7393, 6075}, {7347, 6076}, {7399, 6077}, {7355, 6078},
+    {1121, 6081}, {7348, 6083}, {7297, 6084}, {7387, 6087}, {7306, 6088}, {7319, 6091}, {7396, 6092}, {7307, 6093},
+    {7305, 6094}, {7305, 6095}, {101, 6096}, {7351, 6097}, {7297, 6098}, {7376, 6099}, {7403, 6102}, {7299, 6104},
+    {7383, 6105}, {7303, 6106}, {7302, 6107}, {7324, 6110}, {685, 6111}, {811, 6112}, {7409, 6114}, {7297, 6115},
+    {7411, 6117}, {7297, 6118}, {7303, 6119}, {100, 6121}, {7298, 6123}, {7373, 6124}, {7313, 6126}, {7309, 6127},
+    {520, 6128}, {7360, 6129}, {7305, 6130}, {7317, 6132}, {7522, 6133}, {7310, 6135}, {846, 6136}, {512, 6137},
+    {7422, 6138}, {577, 6139}, {619, 6140}, {7423, 6141}, {7425, 6142}, {7536, 6143}, {7427, 6144}, {7428, 6145},
+    {7487, 6146}, {7484, 6147}, {7529, 6148}, {923, 6150}, {7531, 6151}, {7475, 6152}, {7545, 6153}, {7435, 6154},
+    {7527, 6155}, {7437, 6156}, {7466, 6157}, {1027, 6158}, {7544, 6159}, {877, 6160}, {7537, 6161}, {424, 6162},
+    {7536, 6163}, {7540, 6164}, {7468, 6166}, {758, 6167}, {7541, 6168}, {1159, 6169}, {7549, 6170}, {7548, 6171},
+    {7538, 6172}, {7541, 6173}, {7536, 6174}, {7529, 6175}, {7454, 6176}, {7546, 6180}, {714, 6181}, {7456, 6182},
+    {669, 6183}, {7492, 6184}, {7505, 6185}, {7499, 6186}, {7491, 6187}, {7510, 6188}, {7497, 6189}, {7496, 6190},
+    {7505, 6191}, {7518, 6192}, {7494, 6193}, {7441, 6194}, {7490, 6195}, {7492, 6196}, {7537, 6197}, {7494, 6198},
+    {658, 6200}, {7472, 6201}, {7516, 6203}, {7474, 6204}, {7489, 6206}, {7509, 6208}, {7513, 6209}, {7506, 6210},
+    {7512, 6211}, {643, 6213}, {7516, 6214}, {7497, 6215}, {7424, 6216}, {7496, 6217}, {7512, 6218}, {7519, 6219},
+    {7477, 6156}, {7498, 6220}, {7514, 6222}, {582, 6223}, {7470, 6224}, {7473, 6225}, {7463, 6226}, {661, 6228},
+    {7452, 6229}, {7461, 6230}, {7493, 6231}, {7494, 6232}, {7549, 6233}, {7447, 6235}, {7468, 6236}, {7465, 6239},
+    {7499, 6241}, {7465, 6242}, {7458, 6243}, {7441, 6244}, {159, 6245}, {7467, 6246}, {7504, 6247}, {119, 6248},
+    {7505, 6249}, {7462, 6251}, {7487, 6252}, {1164, 6253}, {7483, 6254}, {7486, 6255}, {7459, 6256}, {1293, 6257},
+    {7473, 6258}, {7477, 6259}, {7485, 6260}, {7521, 6261}, {7427, 6262}, {7483, 6263}, {7482, 6264}, {7525, 6265},
+    {1186, 6266}, {556, 6267}, {7429, 6268}, {7444, 6269}, {7545, 6156}, {7522, 6270}, {7457, 6252}, {7436, 6271},
+    {929, 6272}, {7483, 6273}, {7482, 6274}, {7427, 6276}, {7442, 6277}, {7450, 6278}, {7451, 6279}, {1252, 6280},
+    {7431, 6281}, {7505, 6282}, {7510, 6283}, {7427, 6284}, {7453, 6285}, {7472, 6286}, {7427, 6287}, {7470, 6288},
+    {7450, 6304}, {7431, 6325}, {7467, 6289}, {500, 6290}, {603, 6291}, {7440, 6292}, {960, 6293}, {7500, 6295},
+    {7501, 6296}, {7440, 6297}, {7442, 6298}, {7427, 6299}, {7437, 6300}, {7438, 6301}, {1271, 6302}, {7449, 6303},
+    {7652, 6305}, {7455, 6307}, {7493, 6308}, {7646, 6309}, {7655, 6311}, {413, 6312}, {7659, 6349}, {7615, 6313},
+    {7658, 6314}, {7650, 6315}, {7648, 6316}, {7672, 6317}, {7652, 6318}, {7606, 6320}, {1105, 6321}, {142, 6322},
+    {530, 6324}, {7676, 6326}, {7604, 6327}, {7675, 6328}, {7666, 6330}, {7570, 6331}, {7677, 6332}, {7649, 6315},
+    {7572, 6333}, {762, 6334}, {7658, 6311}, {7655, 6335}, {7672, 6336}, {7659, 6337}, {7657, 6338}, {7659, 6339},
+    {7673, 6340}, {7590, 6342}, {7666, 6343}, {7588, 6344}, {7625, 6345}, {7625, 6346}, {7586, 6347}, {7639, 6348},
+    {7635, 6351}, {7638, 6350}, {7624, 6352}, {7620, 6353}, {7593, 6354}, {7568, 6355}, {7645, 6357}, {7625, 6358},
+    {7642, 6368}, {7641, 6385}, {7624, 6359}, {7600, 6360}, {7644, 6361}, {7617, 6362}, {7561, 6363}, {7633, 6364},
+    {293, 6365}, {7605, 6366}, {1113, 6367}, {7642, 6369}, {7628, 6350}, {7667, 6333}, {280, 6370}, {7646, 6371},
+    {7636, 6372}, {7646, 6373}, {7635, 6395}, {7636, 6394}, {7630, 6397}, {1322, 6375}, {7559, 6376}, {7632, 6378},
+    {7675, 6380}, {7606, 6381}, {7603, 6382}, {7585, 6383}, {1061, 6386}, {7679, 6387}, {7592, 6388}, {7677, 6389},
+    {7611, 6390}, {7594, 6391}, {7626, 6392}, {7594, 6396}, {7628, 6398}, {7592, 6399}, {7595, 6400}, {7584, 6401},
+    {7605, 6402}, {7659, 6403}, {7590, 6404}, {7564, 6405}, {7660, 6408}, {7606, 6409}, {7650, 6410}, {1286, 6411},
+    {7615, 6379}, {7636, 6406}, {7612, 6412}, {786, 6413}, {7642, 6414}, {7592, 6415}, {7555, 6417}, {7612, 6418},
+    {7646, 6419}, {7653, 6420}, {7570, 6421}, {7614, 6422}, {7566, 6423}, {7612, 6424}, {7553, 6425}, {1178, 6426},
+    {7574, 6427}, {7554, 6429}, {7563, 6430}, {7578, 6431}, {206, 6432}, {7657, 6433}, {7658, 6434}, {7576, 6435},
+    {7660, 6436}, {557, 6437}, {148, 6438}, {7583, 6439}, {1060, 6440}, {7601, 6441}, {7566, 6442}, {7569, 6443},
+    {7583, 6448}, {7552, 6453}, {7578, 6444}, {7558, 6445}, {7577, 6446}, {7557, 6461}, {7575, 6464}, {7572, 6474},
+    {7578, 6482}, {7570, 6447}, {7567, 6449}, {7580, 6450}, {7570, 6465}, {7583, 6461}, {7789, 6471}, {7779, 6491},
+    {7793, 6468}, {7784, 6470}, {7794, 6490}, {7785, 6451}, {7807, 6472}, {7779, 6487}, {7789, 6468}, {7804, 6480},
+    {7807, 6468}, {7785, 6481}, {7780, 6475}, {7783, 6467}, {7786, 6495}, {7793, 6466}, {7583, 6446}, {7777, 6465},
+    {7800, 6492}, {7804, 6496}, {7748, 6499}, {7754, 6525}, {7796, 6527}, {7798, 6516}, {7782, 6496}, {7786, 6469},
+    {7800, 6494}, {7712, 6493}, {7790, 6478}, {7790, 6452}, {7806, 6485}, {7788, 6497}, {7805, 6485}, {7756, 6510},
+    {7760, 6511}, {7756, 6508}, {7803, 6509}, {7748, 6513}, {7762, 6454}, {7709, 6473}, {7915, 6489}, {7772, 6455},
+    {7746, 6456}, {7758, 6457}, {7757, 6458}, {7746, 6459}, {7745, 6460}, {7745, 6462}, {7804, 6492}, {7764, 6463},
+    {7749, 6476}, {7763, 6477}, {7751, 6479}, {7750, 6483}, {7591, 6406}, {7607, 6379}, {7771, 6484}, {7768, 6486},
+    {7752, 6488}, {7765, 6498}, {7775, 6524}, {7681, 6514}, {7773, 6518}, {7774, 6515}, {7773, 6519}, {7761, 6500},
+    {7721, 6507}, {7718, 6501}, {7715, 6520}, {7714, 6502}, {7717, 6503}, {7718, 6504}, {7717, 6532}, {7721, 6536},
+    {7715, 6552}, {7719, 6505}, {7723, 6506}, {7731, 6517}, {7717, 6512}, {7730, 6521}, {7719, 6504}, {7694, 6512},
+    {7714, 6528}, {7733, 6522}, {7788, 6529}, {7737, 6533}, {7686, 6530}, {7743, 6556}, {7714, 6523}, {7739, 6522},
+    {7733, 6531}, {7795, 6528}, {7731, 6558}, {7739, 6526}, {7742, 6534}, {7691, 6535}, {7680, 6537}, {7680, 6538},
+    {7727, 6528}, {7701, 6539}, {7693, 6540}, {7708, 6541}, {7772, 6542}, {7694, 6549}, {7686, 6560}, {7709, 6577},
+    {7684, 6566}, {7704, 6583}, {7683, 6543}, {7706, 6562}, {7702, 6565}, {7789, 6529}, {7697, 6580}, {7700, 6562},
+    {7704, 6561}, {7685, 6573}, {7710, 6579}, {7693, 6584}, {7706, 6573}, {7710, 6579}, {7705, 6544}, {7700, 6545},
+    {7698, 6568}, {7758, 6573}, {7709, 6570}, {7906, 6582}, {7696, 6570}, {7919, 6590}, {7918, 6546}, {7910, 6563},
+    {7920, 6587}, {7914, 6547}, {7906, 6551}, {7883, 6548}, {7700, 6573}, {7931, 6571}, {7928, 6575}, {7857, 6589},
+    {7861, 6553}, {7907, 6569}, {7911, 6574}, {7929, 6572}, {7690, 6561}, {7924, 6578}, {7904, 6574}, {7909, 6570},
+    {7907, 6550}, {7920, 6576}, {7842, 6554}, {7920, 6555}, {7931, 6557}, {7925, 6564}, {7913, 6586}, {7913, 6559},
+    {7916, 6567}, {7921, 6581}, {7881, 6585}, {7877, 6588}, {7884, 6591}, {7874, 6592}, {7913, 6595}, {7884, 6616},
+    {7873, 6593}, {7919, 6550}, {7909, 6550}, {7886, 6621}, {7872, 6614}, {7899, 6594}, {7889, 6596}, {7873, 6598},
+    {7873, 6599}, {7878, 6623}, {7873, 6597}, {7933, 6600}, {7810, 6602}, {7900, 6604}, {7901, 6618}, {7895, 6603},
+    {7883, 6601}, {7903, 6609}, {7890, 6613}, {7874, 6617}, {7896, 6605}, {7909, 6606}, {7898, 6608}, {7895, 6611},
+    {7900, 6615}, {7890, 6607}, {7885, 6610}, {7931, 6624}, {7854, 6636}, {7842, 6633}, {7861, 6625}, {7853, 6612},
+    {7860, 6653}, {7844, 6649}, {7857, 6612}, {7924, 6601}, {7828, 6619}, {7848, 6620}, {7844, 6622}, {7861, 6626},
+    {7846, 6627}, {7870, 6628}, {7863, 6629}, {7860, 6655}, {7842, 6630}, {7860, 6631}, {7858, 6632}, {7865, 6634},
+    {7859, 6635}, {7863, 6637}, {7870, 6638}, {7822, 6639}, {7826, 6641}, {660, 6642}, {7813, 6643}, {7814, 6645},
+    {7826, 6646}, {7814, 6647}, {7910, 6648}, {7823, 6650}, {1205, 6651}, {7834, 6654}, {1084, 6656}, {1062, 6658},
+    {7808, 6659}, {7888, 6660}, {7816, 6664}, {7817, 6671}, {7895, 6661}, {7813, 6662}, {7919, 6665}, {7833, 6666},
+    {7813, 6668}, {7827, 6670}, {7837, 6672}, {7815, 6673}, {7809, 6674}, {7822, 6675}, {7838, 6676}, {7825, 6677},
+    {7838, 6678}, {691, 6680}, {7826, 6681}, {7816, 6682}, {7932, 6683}, {7818, 6686}, {7833, 6687}, {7821, 6688},
+    {7936, 6689}, {8040, 6690}, {8035, 6691}, {8047, 6693}, {8033, 6694}, {832, 6695}, {8052, 6696}, {8041, 6697},
+    {8036, 6698}, {8032, 6699}, {7984, 6700}, {1292, 6701}, {8047, 6702}, {7990, 6703}, {8035, 6704}, {8060, 6705},
+    {8046, 6710}, {8052, 6706}, {8060, 6707}, {8042, 6694}, {369, 6708}, {7954, 6709}, {8033, 6711}, {8059, 6712},
+    {7957, 6713}, {8058, 6715}, {8008, 6716}, {307, 6718}, {534, 6720}, {8043, 6721}, {8053, 6722}, {8059, 6723},
+    {8046, 6726}, {8053, 6736}, {8057, 6724}, {8013, 6725}, {8045, 6727}, {8047, 6728}, {8000, 6729}, {8014, 6730},
+    {7972, 6732}, {8011, 6733}, {8010, 6737}, {8008, 6738}, {8014, 6739}, {8007, 6740}, {1284, 6741}, {7978, 6742},
+    {8008, 6745}, {8009, 6746}, {8026, 6747}, {7982, 6748}, {8014, 6749}, {7984, 6750}, {7947, 6751}, {7944, 6753},
+    {8001, 6754}, {7988, 6755}, {8042, 6756}, {8023, 6757}, {1274, 6758}, {7949, 6759}, {8022, 6760}, {8010, 6761},
+    {8013, 6763}, {8036, 6764}, {7996, 6765}, {406, 6766}, {8016, 6767}, {7998, 6768}, {8028, 6769}, {8058, 6770},
+    {7973, 6771}, {362, 6774}, {7985, 6775}, {446, 6776}, {7987, 6777}, {7976, 6778}, {7980, 6780}, {8006, 6781},
+    {7991, 6782}, {7994, 6783}, {8009, 6785}, {7998, 6786}, {7973, 6787}, {7973, 6789}, {828, 6792}, {435, 6795},
+    {7985, 6788}, {461, 6796}, {8052, 6797}, {1305, 6798}, {1219, 6799}, {8015, 6800}, {8017, 6801}, {7949, 6802},
+    {7978, 6804}, {8020, 6805}, {7996, 6806}, {440, 6807}, {8044, 6808}, {90, 6809}, {7998, 6908}, {8024, 6864},
+    {8025, 6810}, {7993, 6812}, {7971, 6788}, {7988, 6814}, {7939, 6816}, {7980, 6817}, {8031, 6818}, {7957, 6820},
+    {7958, 6822}, {7952, 6823}, {7959, 6824}, {8030, 6825}, {7945, 6826}, {7993, 6827}, {477, 6828}, {7947, 6829},
+    {71, 6831}, {8018, 6833}, {8019, 6834}, {7941, 6835}, {7967, 6836}, {7960, 6837}, {7966, 6838}, {7939, 6839},
+    {8021, 6840}, {7966, 6841}, {7960, 6842}, {8050, 6843}, {7958, 6844}, {7957, 6845}, {7953, 6846}, {7959, 6847},
+    {167, 6849}, {7960, 6850}, {199, 6851}, {8002, 6852}, {7947, 6853}, {8000, 6854}, {7972, 6855}, {7954, 6856},
+    {7964, 6858}, {7967, 6859}, {8063, 6860}, {8163, 6861}, {8123, 6862}, {8167, 6863}, {8170, 6865}, {8182, 6866},
+    {8162, 6868}, {8174, 6869}, {8125, 6870}, {8165, 6872}, {8160, 6873}, {537, 6874}, {1279, 6875}, {8074, 6876},
+    {8187, 6877}, {8118, 6878}, {8168, 6879}, {1268, 6880}, {8116, 6881}, {8160, 6882}, {8189, 6883}, {8142, 6885},
+    {1308, 6886}, {696, 6888}, {8104, 6889}, {8178, 6890}, {8184, 6910}, {8190, 6892}, {8108, 6893}, {8160, 6894},
+    {8182, 6896}, {8189, 6897}, {8168, 6898}, {8091, 6899}, {8186, 6900}, {8187, 6901}, {8187, 6902}, {8095, 6903},
+    {8142, 6906}, {8146, 6907}, {1236, 6909}, {8088, 6911}, {8133, 6913}, {8130, 6914}, {8139, 6915}, {8149, 6916},
+    {8093, 6917}, {8133, 6918}, {8136, 6920}, {8106, 6921}, {8107, 6922}, {8139, 6923}, {8156, 6924}, {8157, 6925},
+    {8158, 6926}, {8146, 6927}, {8152, 6928}, {8154, 6929}, {8149, 6930}, {8135, 6933}, {8117, 6935}, {8118, 6936},
+    {8168, 6937}, {8157, 6938}, {8067, 6939}, {8147, 6940}, {8143, 6941}, {8070, 6943}, {8147, 6945}, {8128, 6946},
+    {8146, 6944}, {8101, 6947}, {8100, 6948}, {8100, 6970}, {8107, 6950}, {8133, 6951}, {8188, 6952}, {8097, 6953},
+    {8111, 6967}, {8122, 6954}, {8105, 6955}, {8121, 6956}, {8140, 6957}, {8120, 6961}, {8142, 6962}, {8103, 6963},
+    {8099, 6964}, {8142, 6944}, {1066, 6965}, {8168, 6966}, {417, 6968}, {8124, 7005}, {8097, 6971}, {8124, 6972},
+    {8077, 6973}, {8121, 6974}, {8098, 6975}, {8109, 6976}, {8154, 6977}, {8107, 6978}, {8156, 6979}, {8118, 6976},
+    {8113, 6980}, {8106, 6981}, {162, 6982}, {8109, 6983}, {8078, 6985}, {8070, 7004}, {8070, 6984}, {8081, 6986},
+    {8068, 6987}, {76, 6988}, {8166, 6989}, {8078, 6990}, {8146, 6991}, {8071, 6992}, {8075, 6993}, {8145, 6994},
+    {28, 6995}, {8150, 6996}, {8068, 6997}, {8174, 6998}, {8149, 6999}, {1144, 7001}, {8084, 7003}, {8069, 7007},
+    {8083, 7008}, {8091, 7009}, {8090, 7010}, {8066, 7011}, {8088, 7012}, {8183, 7014}, {8075, 7015}, {918, 7040},
+    {8086, 7141}, {8186, 7016}, {8084, 7017}, {8135, 7018}, {8095, 7019}, {8191, 7021}, {8292, 7022}, {8193, 7023},
+    {8248, 7024}, {8294, 7025}, {481, 7026}, {8298, 7027}, {515, 7028}, {8310, 7029}, {8252, 7030}, {8309, 7031},
+    {8279, 7032}, {8201, 7033}, {8303, 7034}, {8316, 7035}, {1163, 7041}, {8297, 7140}, {8205, 7036}, {8290, 7037},
+    {8207, 7038}, {8316, 7042}, {489, 7044}, {8235, 7045}, {8304, 7046}, {8288, 7047}, {183, 7048}, {8212, 7049},
+    {8266, 7050}, {8311, 7051}, {8306, 7052}, {8311, 7053}, {8227, 7054}, {8224, 7056}, {8260, 7057}, {8309, 7058},
+    {8304, 7059}, {46, 7061}, {840, 7062}, {8298, 7063}, {1003, 7064}, {8229, 7067}, {8269, 7069}, {8271, 7070},
+    {8268, 7071}, {8266, 7072}, {8269, 7073}, {8262, 7074}, {8276, 7075}, {8262, 7076}, {8260, 7102}, {8266, 7077},
+    {8287, 7085}, {8287, 7078}, {8261, 7079}, {8215, 7080}, {8285, 7081}, {8273, 7082}, {8270, 7083}, {8272, 7084},
+    {8283, 7103}, {8274, 7086}, {8272, 7087}, {8256, 7088}, {8259, 7094}, {8274, 7096}, {8195, 7089}, {8286, 7090},
+    {8277, 7091}, {8277, 7092}, {8284, 7093}, {8287, 7095}, {8267, 7097}, {8236, 7098}, {8242, 7099}, {8235, 7100},
+    {8241, 7101}, {8234, 7104}, {8225, 7134}, {8226, 7105}, {8232, 7110}, {8220, 7107}, {8233, 7108}, {8226, 7109},
+    {8236, 7111}, {8209, 7112}, {8271, 7113}, {8298, 7116}, {8299, 7118}, {8230, 7114}, {8246, 7115}, {8203, 7117},
+    {8233, 7106}, {8247, 7119}, {8249, 7120}, {8200, 7121}, {8209, 7122}, {8198, 7123}, {8243, 7124}, {8283, 7125},
+    {8443, 7126}, {8238, 7127}, {8193, 7128}, {8192, 7129}, {8210, 7130}, {8254, 7131}, {8215, 7132}, {8202, 7133},
+    {8203, 7135}, {8287, 7136}, {8202, 7137}, {8200, 7138}, {8205, 7139}, {8192, 7142}, {8240, 7106}, {8218, 7143},
+    {8206, 7144}, {8205, 7145}, {8242, 7146}, {8302, 7147}, {8193, 7148}, {8213, 7149}, {8217, 7150}, {8264, 7151},
+    {8210, 7152}, {8221, 7153}, {8219, 7154}, {8268, 7155}, {8219, 7156}, {8221, 7157}, {8222, 7166}, {8215, 7168},
+    {8213, 7157}, {8316, 7177}, {8208, 7184}, {8205, 7158}, {8222, 7159}, {8417, 7160}, {8379, 7161}, {8413, 7162},
+    {8433, 7164}, {8399, 7167}, {8439, 7163}, {8424, 7165}, {8381, 7169}, {8429, 7175}, {8329, 7170}, {8330, 7197},
+    {8421, 7171}, {8419, 7172}, {8417, 7173}, {8372, 7174}, {8428, 7176}, {8362, 7178}, {8424, 7179}, {8444, 7180},
+    {8443, 7181}, {8366, 7182}, {8436, 7183}, {8441, 7185}, {8419, 7186}, {8418, 7187}, {8345, 7188}, {8443, 7189},
+    {8436, 7190}, {8436, 7191}, {8436, 7200}, {8356, 7228}, {8427, 7192}, {8385, 7193}, {8387, 7194}, {8344, 7195},
+    {8396, 7199}, {8389, 7196}, {8396, 7201}, {8401, 7204}, {8360, 7209}, {8339, 7220}, {8395, 7202}, {8389, 7205},
+    {8408, 7198}, {8409, 7203}, {8385, 7206}, {8385, 7207}, {8405, 7201}, {8390, 7208}, {8414, 7210}, {8414, 7212},
+    {8413, 7231}, {8406, 7211}, {8404, 7213}, {8406, 7214}, {8401, 7215}, {8323, 7216}, {8320, 7217}, {8393, 7218},
+    {8413, 7219}, {8415, 7221}, {8325, 7222}, {8384, 7223}, {8365, 7232}, {8349, 7250}, {8378, 7249}, {8388, 7224},
+    {8369, 7225}, {8408, 7219}, {8444, 7226}, {8371, 7230}, {8361, 7227}, {8342, 7229}, {8401, 7231}, {8383, 7233},
+    {8395, 7234}, {8380, 7235}, {8356, 7236}, {8362, 7237}, {8360, 7238}, {8383, 7239}, {8427, 7240}, {8379, 7241},
+    {8370, 7242}, {8373, 7243}, {8380, 7244}, {8428, 7245}, {8374, 7246}, {8327, 7247}, {8376, 7248}, {8379, 7251},
+    {8382, 7252}, {8381, 7253}, {8365, 7264}, {8339, 7283}, {8334, 7255}, {8331, 7256}, {8380, 7257}, {8414, 7258},
+    {8372, 7254}, {8324, 7259}, {8404, 7261}, {8334, 7262}, {8334, 7254}, {8337, 7263}, {8349, 7265}, {8348, 7266},
+    {8342, 7267}, {8398, 7268}, {8353, 7269}, {8344, 7270}, {8350, 7271}, {8343, 7272}, {8347, 7273}, {8356, 7274},
+    {8327, 7260}, {8444, 7275}, {8348, 7276}, {8388, 7277}, {8347, 7279}, {8545, 7282}, {8552, 7278}, {8539, 7280},
+    {8560, 7281}, {8321, 7260}, {8322, 7260}, {8521, 7284}, {8550, 7285}, {8550, 7286}, {8348, 7260}, {8331, 7260},
+    {8557, 7287}, {8571, 7280}, {8322, 7260}, {8555, 7288}, {8324, 7260}, {8546, 7289}, {8568, 7290}, {8556, 7291},
+    {8571, 7292}, {8550, 7280}, {8558, 7293}, {8547, 7294}, {8547, 7295}, {8488, 7296}, {8562, 7297}, {8566, 7298},
+    {8561, 7299}, {8492, 7300}, {8520, 7302}, {8482, 7303}, {8572, 7304}, {8558, 7305}, {181, 7306}, {8516, 7307},
+    {8565, 7309}, {8562, 7312}, {8478, 7313}, {8523, 7314}, {8527, 7315}, {8482, 7316}, {8473, 7317}, {1123, 7318},
+    {8523, 7319}, {8479, 7320}, {8532, 7321}, {8568, 7322}, {8513, 7323}, {8512, 7324}, {8521, 7325}, {8524, 7326},
+    {8527, 7327}, {8515, 7328}, {8519, 7330}, {8540, 7331}, {187, 7332}, {8537, 7333}, {8514, 7334}, {8534, 7335},
+    {1141, 7336}, {8528, 7337}, {8538, 7338}, {8538, 7339}, {8517, 7340}, {8514, 7355}, {8534, 7342}, {8451, 7343},
+    {8543, 7344}, {8533, 7345}, {8508, 7346}, {8546, 7348}, {8510, 7349}, {8536, 7350}, {8483, 7351}, {8492, 7352},
+    {8491, 7353}, {8492, 7354}, {799, 7357}, {8491, 7358}, {8498, 7359}, {578, 7360}, {8495, 7361}, {8503, 7362},
+    {8562, 7365}, {8485, 7366}, {8499, 7367}, {8485, 7368}, {8482, 7369}, {8567, 7370}, {8483, 7372}, {8504, 7373},
+    {8495, 7371}, {8508, 7374}, {8508, 7375}, {8480, 7371}, {1180, 7376}, {8509, 7377}, {8559, 7378}, {8496, 7379},
+    {8502, 7380}, {8511, 7381}, {69, 7383}, {8501, 7384}, {8493, 7385}, {8506, 7386}, {1145, 7387}, {8494, 7388},
+    {1023, 7389}, {8541, 7390}, {8542, 7391}, {8506, 7392}, {974, 7393}, {8454, 7394}, {8467, 7395}, {8546, 7397},
+    {8454, 7398}, {8542, 7399}, {8452, 7400}, {8450, 7401}, {299, 7402}, {8456, 7404}, {497, 7405}, {8461, 7406},
+    {8553, 7407}, {8463, 7408}, {8529, 7410}, {8534, 7412}, {8535, 7413}, {8449, 7414}, {138, 7415}, {8533, 7416},
+    {8479, 7417}, {192, 7418}, {8450, 7419}, {8469, 7420}, {8448, 7442}, {8479, 7421}, {8567, 7426}, {96, 7429},
+    {8479, 7424}, {1198, 7430}, {8465, 7431}, {8474, 7432}, {276, 7433}, {8477, 7434}, {8571, 7436}, {8456, 7438},
+    {1100, 7439}, {1287, 7440}, {8479, 7441}, {8465, 7443}, {8695, 7444}, {8475, 7424}, {8693, 7445}, {576, 7446},
+    {8672, 7447}, {8688, 7448}, {8638, 7449}, {8639, 7450}, {8582, 7451}, {8637, 7452}, {8703, 7453}, {8627, 7455},
+    {8586, 7457}, {8587, 7458}, {8702, 7459}, {8677, 7460}, {8687, 7461}, {8700, 7462}, {8701, 7463}, {8593, 7464},
+    {8699, 7465}, {8701, 7466}, {978, 7467}, {8622, 7468}, {8696, 7469}, {8703, 7470}, {8697, 7471}, {8685, 7473},
+    {8601, 7475}, {8686, 7476}, {8603, 7477}, {8693, 7478}, {8615, 7479}, {8684, 7480}, {8699, 7481}, {72, 7482},
+    {8645, 7483}, {8609, 7484}, {8656, 7485}, {8661, 7486}, {8606, 7487}, {8656, 7488}, {8649, 7489}, {8615, 7490},
+    {8647, 7491}, {8645, 7492}, {870, 7495}, {8651, 7496}, {8619, 7497}, {8645, 7498}, {8621, 7500}, {8640, 7501},
+    {8640, 7502}, {8657, 7503}, {8625, 7506}, {8661, 7507}, {8662, 7508}, {8590, 7509}, {8629, 7510}, {8663, 7511},
+    {8656, 7512}, {8657, 7513}, {8662, 7514}, {1157, 7515}, {8667, 7516}, {8658, 7517}, {8582, 7518}, {394, 7519},
+    {8649, 7520}, {8673, 7521}, {8639, 7523}, {8620, 7524}, {8621, 7525}, {8630, 7526}, {8604, 7527}, {8644, 7528},
+    {8612, 7529}, {8628, 7530}, {1210, 7531}, {930, 7532}, {8600, 7533}, {8637, 7534}, {8612, 7535}, {8639, 7536},
+    {8638, 7537}, {8610, 7538}, {8594, 7539}, {8623, 7540}, {8693, 7541}, {57, 7542}, {376, 7543}, {8630, 7544},
+    {8613, 7545}, {8658, 7546}, {8637, 7547}, {8609, 7548}, {8662, 7549}, {8608, 7552}, {8674, 7569}, {8629, 7550},
+    {962, 7551}, {8629, 7553}, {8616, 7554}, {8629, 7555}, {8629, 7556}, {1041, 7557}, {8671, 7558}, {8596, 7559},
+    {8585, 7560}, {8583, 7561}, {8591, 7562}, {8598, 7563}, {948, 7564}, {8576, 7565}, {408, 7566}, {8633, 7567},
+    {8619, 7553}, {8578, 7568}, {8680, 7571}, {8603, 7573}, {8587, 7574}, {8581, 7575}, {8583, 7577}, {8590, 7578},
+    {8580, 7579}, {8579, 7583}, {972, 7580}, {8578, 7581}, {1118, 7582}, {8649, 7584}, {8654, 7585}, {8576, 7587},
+    {8589, 7576}, {8600, 7588}, {8594, 7589}, {8588, 7590}, {8604, 7591}, {8585, 7592}, {1172, 7594}, {8607, 7595},
+    {8700, 7596}, {8586, 7597}, {8588, 7598}, {8703, 7599}, {8704, 7601}, {8815, 7602}, {165, 7603}, {8706, 7604},
+    {8810, 7606}, {8812, 7607}, {8767, 7608}, {8818, 7609}, {8765, 7610}, {8754, 7611}, {8808, 7612}, {312, 7613},
+    {8752, 7614}, {8825, 7616}, {624, 7617}, {8830, 7618}, {8600, 7576}, {8717, 7619}, {8828, 7620}, {14, 7621},
+    {8784, 7622}, {740, 7623}, {8720, 7624}, {8747, 7625}, {8821, 7627}, {8745, 7629}, {8724, 7630}, {8816, 7631},
+    {8820, 7632}, {678, 7633}, {8805, 7634}, {8817, 7635}, {8821, 7637}, {938, 7638}, {8773, 7639}, {914, 7640},
+    {8737, 7641}, {8732, 7643}, {8817, 7644}, {8810, 7645}, {278, 7647}, {8825, 7648}, {8786, 7649}, {8731, 7650},
+    {8772, 7651}, {8739, 7652}, {8740, 7653}, {8826, 7654}, {8776, 7655}, {8776, 7656}, {8769, 7659}, {8745, 7661},
+    {8773, 7662}, {8783, 7663}, {8773, 7664}, {8780, 7665}, {8783, 7666}, {8782, 7667}, {8785, 7668}, {8715, 7669},
+    {8798, 7670}, {8775, 7671}, {8789, 7672}, {8796, 7673}, {8791, 7674}, {8759, 7675}, {8785, 7676}, {8786, 7678},
+    {8789, 7677}, {8783, 7679}, {8787, 7680}, {8794, 7681}, {8784, 7682}, {8755, 7683}, {8748, 7684}, {8824, 7685},
+    {8795, 7677}, {8771, 7686}, {8741, 7687}, {8831, 7688}, {8743, 7689}, {8728, 7690}, {8742, 7691}, {8726, 7692},
+    {8816, 7693}, {8739, 7694}, {8822, 7695}, {8740, 7696}, {8751, 7697}, {8742, 7698}, {8761, 7699}, {8766, 7700},
+    {8808, 7712}, {8716, 7734}, {8753, 7701}, {8752, 7702}, {8713, 7703}, {8763, 7704}, {8830, 7705}, {535, 7706},
+    {8793, 7707}, {8794, 7708}, {8758, 7709}, {8750, 7710}, {8706, 7711}, {8759, 7713}, {8748, 7714}, {8767, 7715},
+    {8722, 7716}, {8752, 7717}, {8706, 7718}, {504, 7719}, {8709, 7720}, {8799, 7721}, {8756, 7722}, {8707, 7723},
+    {8707, 7724}, {8750, 7725}, {8734, 7726}, {8712, 7727}, {8734, 7728}, {8813, 7729}, {8728, 7730}, {8733, 7731},
+    {8721, 7732}, {8720, 7733}, {8731, 7735}, {8722, 7736}, {8730, 7737}, {8764, 7738}, {1069, 7739}, {8722, 7740},
+    {8781, 7741}, {8743, 7742}, {8825, 7743}, {8768, 7744}, {8730, 7745}, {8709, 7746}, {8829, 7747}, {8714, 7748},
+    {8773, 7749}, {8929, 7752}, {8928, 7750}, {8941, 7751}, {1197, 7753}, {8930, 7754}, {8929, 7755}, {8895, 7756},
+    {8892, 7757}, {8839, 7758}, {8878, 7759}, {8936, 7760}, {8933, 7761}, {8946, 7762}, {8936, 7763}, {8845, 7764},
+    {8957, 7765}, {117, 7766}, {671, 7767}, {8939, 7768}, {8950, 7769}, {8875, 7770}, {8850, 7771}, {8946, 7772},
+    {8852, 7773}, {8879, 7774}, {8876, 7775}, {8932, 7776}, {8856, 7777}, {8941, 7778}, {8864, 7779}, {8865, 7780},
+    {8943, 7781}, {566, 7782}, {8871, 7783}, {8944, 7784}, {8944, 7785}, {8897, 7786}, {8865, 7787}, {8903, 7788},
+    {8909, 7789}, {8907, 7790}, {8869, 7791}, {8904, 7792}, {8916, 7793}, {8850, 7794}, {8896, 7804}, {8911, 7795},
+    {1012, 7796}, {8875, 7797}, {8896, 7798}, {8900, 7799}, {8913, 7800}, {8907, 7801}, {8853, 7802}, {8916, 7803},
+    {8915, 7805}, {8841, 7806}, {8925, 7807}, {8912, 7808}, {8900, 7830}, {8920, 7809}, {8912, 7810}, {8904, 7811},
+    {8922, 7812}, {8892, 7813}, {8893, 7814}, {8914, 7815}, {8915, 7816}, {8865, 7825}, {8870, 7817}, {8898, 7818},
+    {830, 7819}, {8879, 7820}, {8846, 7821}, {8957, 7822}, {551, 7823}, {8873, 7824}, {8905, 7826}, {8867, 7827},
+    {8945, 7828}, {8834, 7829}, {8876, 7831}, {794, 7832}, {8894, 7833}, {8893, 7834}, {8938, 7835}, {8880, 7836},
+    {8845, 7837}, {8915, 7838}, {8885, 7839}, {8943, 7840}, {8940, 7841}, {8888, 7842}, {8920, 7843}, {8875, 7844},
+    {8859, 7845}, {8887, 7846}, {8934, 7847}, {8881, 7848}, {8833, 7849}, {8880, 7850}, {8832, 7851}, {8843, 7856},
+    {8842, 7860}, {8842, 7852}, {8836, 7853}, {8877, 7854}, {8935, 7855}, {8838, 7857}, {8859, 7872}, {8839, 7882},
+    {8857, 7881}, {8845, 7886}, {8861, 7887}, {8853, 7890}, {8866, 7818}, {8863, 7892}, {8946, 7858}, {8862, 7859},
+    {8838, 7861}, {8852, 7862}, {8908, 7863}, {8837, 7864}, {8952, 7865}, {8854, 7866}, {8896, 7867}, {8840, 7868},
+    {8884, 7821}, {8853, 7869}, {8851, 7870}, {8864, 7871}, {1120, 7873}, {9077, 7874}, {8961, 7875}, {9059, 7876},
+    {9069, 7877}, {9061, 7878}, {9023, 7889}, {9064, 7897}, {8993, 7879}, {9010, 7880}, {9084, 7883}, {9009, 7884},
+    {9065, 7885}, {9042, 7888}, {9079, 7891}, {9084, 7893}, {9061, 7894}, {9087, 7895}, {9079, 7896}, {9086, 7898},
+    {9035, 7899}, {9083, 7900}, {8982, 7901}, {9005, 7902}, {9071, 7903}, {9030, 7904}, {8986, 7905}, {9080, 7906},
+    {8988, 7907}, {9068, 7908}, {9066, 7909}, {9030, 7911}, {9029, 7912}, {9036, 7913}, {427, 7914}, {9059, 7883},
+    {8985, 7915}, {9031, 7916}, {1189, 7917}, {8997, 7918}, {9032, 7920}, {8999, 7921}, {9027, 7922}, {9050, 7923},
+    {9037, 7924}, {9028, 7925}, {9024, 7926}, {9027, 7927}, {9039, 7928}, {8981, 7929}, {9028, 7930}, {8971, 7931},
+    {9052, 7933}, {8969, 7934}, {9041, 7935}, {9054, 7937}, {9026, 7938}, {9031, 7939}, {9043, 7940}, {9035, 7941},
+    {8960, 7942}, {9019, 7943}, {8966, 7944}, {8967, 7945}, {1008, 7946}, {9051, 7947}, {1015, 7948}, {9056, 7949},
+    {9004, 7950}, {9006, 7951}, {8995, 7952}, {9004, 7953}, {9011, 7955}, {8986, 7956}, {9014, 7958}, {8994, 7959},
+    {9032, 7960}, {9017, 7961}, {8997, 7962}, {9023, 7963}, {9016, 7964}, {9037, 7965}, {8999, 7968}, {8976, 7971},
+    {8975, 7966}, {8974, 7967}, {9064, 7969}, {9008, 7970}, {9018, 7973}, {9045, 7974}, {9008, 7975}, {9012, 7976},
+    {9003, 7977}, {9008, 7979}, {9019, 7980}, {8994, 7981}, {9016, 7983}, {845, 7985}, {1179, 7986}, {9017, 7987},
+    {9023, 7989}, {9004, 7990}, {926, 7991}, {8979, 7992}, {9057, 7993}, {8982, 7994}, {8966, 7995}, {8966, 7997},
+    {9018, 7999}, {180, 8000}, {8980, 8001}, {9063, 8002}, {9064, 8003}, {9065, 8004}, {8964, 8005}, {9067, 8007},
+    {8960, 8008}, {9047, 8010}, {9044, 8011}, {8963, 8016}, {8990, 8029}, {8965, 8012}, {8962, 8013}, {947, 8014},
+    {8967, 8018}, {8984, 8019}, {8987, 8021}, {146, 8022}, {8990, 8023}, {9066, 7907}, {8963, 8026}, {9026, 8027},
+    {8976, 8028}, {8969, 8030}, {8985, 8032}, {8972, 8033}, {9085, 8034}, {9086, 8035}, {281, 8036}, {9087, 8037},
+    {9193, 8038}, {9089, 8039}, {522, 8040}, {1161, 8041}, {9196, 8042}, {9145, 8043}, {9206, 8044}, {9191, 8045},
+    {9193, 8046}, {719, 8047}, {9193, 8048}, {9199, 8049}, {9097, 8051}, {9189, 8052}, {9194, 8053}, {9195, 8054},
+    {9187, 8055}, {288, 8056}, {9140, 8057}, {274, 8058}, {9185, 8059}, {9104, 8060}, {9166, 8061}, {9128, 8062},
+    {9213, 8064}, {1160, 8065}, {9184, 8066}, {9200, 8067}, {9110, 8068}, {9202, 8069}, {9206, 8070}, {88, 8071},
+    {9196, 8072}, {9197, 8073}, {9215, 8075}, {492, 8076}, {9194, 8077}, {457, 8078}, {9127, 8079}, {9195, 8080},
+    {9201, 8081}, {351, 8082}, {9215, 8083}, {9171, 8084}, {9122, 8085}, {524, 8086}, {9169, 8087}, {9211, 8088},
+    {9163, 8089}, {9171, 8090}, {9156, 8092}, {9163, 8093}, {9129, 8094}, {9205, 8096}, {9158, 8097}, {1187, 8098},
+    {9165, 8099}, {9164, 8100}, {9201, 8101}, {9154, 8102}, {971, 8103}, {9098, 8104}, {9178, 8105}, {9172, 8108},
+    {9170, 8109}, {9173, 8110}, {9175, 8111}, {9155, 8112}, {9180, 8113}, {9162, 8114}, {9177, 8115}, {9147, 8116},
+    {9181, 8119}, {9166, 8120}, {572, 8121}, {9177, 8122}, {9165, 8123}, {9152, 8110}, {4, 8124}, {9134, 8125},
+    {9153, 8126}, {9208, 8127}, {9140, 8129}, {9214, 8144}, {9215, 8130}, {9138, 8131}, {9213, 8132}, {651, 8134},
+    {9202, 8135}, {9149, 8136}, {9200, 8137}, {9124, 8138}, {9141, 8139}, {9145, 8141}, {9132, 8143}, {9148, 8145},
+    {16, 8146}, {9102, 8147}, {9120, 8148}, {9127, 8149}, {9144, 8160}, {9140, 8188}, {9144, 8150}, {9125, 8151},
+    {9132, 8152}, {9094, 8153}, {9139, 8155}, {9179, 8157}, {9180, 8158}, {9150, 8159}, {9130, 8161}, {9189, 8162},
+    {9108, 8163}, {9109, 8164}, {9098, 8165}, {9094, 8167}, {680, 8168}, {9093, 8169}, {9089, 8170}, {471, 8171},
+    {1249, 8172}, {9089, 8173}, {396, 8175}, {9097, 8176}, {9143, 8177}, {9193, 8178}, {9092, 8179}, {9195, 8180},
+    {9196, 8181}, {9097, 8182}, {9198, 8184}, {9092, 8185}, {9109, 8187}, {872, 8189}, {9093, 8190}, {9104, 8192},
+    {1044, 8194}, {9203, 8195}, {9105, 8196}, {9205, 8197}, {145, 8198}, {9164, 8199}, {9090, 8200}, {9154, 8202},
+    {9101, 8203}, {9107, 8204}, {9113, 8206}, {9212, 8208}, {1217, 8209}, {9116, 8210}, {9115, 8211}, {9110, 8213},
+    {9330, 8214}, {9217, 8215}, {9316, 8216}, {542, 8217}, {626, 8218}, {9313, 8219}, {9315, 8220}, {9320, 8221},
+    {9317, 8222}, {305, 8223}, {9320, 8224}, {9303, 8225}, {9338, 8226}, {9264, 8227}, {9265, 8228}, {9314, 8229},
+    {9271, 8230}, {9230, 8231}, {9326, 8232}, {9337, 8233}, {9294, 8234}, {9340, 8235}, {9257, 8236}, {422, 8237},
+    {9339, 8238}, {9340, 8240}, {9260, 8248}, {9341, 8239}, {9250, 8241}, {9251, 8242}, {9343, 8243}, {9320, 8244},
+    {9254, 8245}, {9255, 8246}, {9246, 8247}, {102, 8249}, {9253, 8250}, {9248, 8251}, {9243, 8252}, {9220, 8253},
+    {9282, 8254}, {9325, 8255}, {9253, 8256}, {9337, 8257}, {9255, 8258}, {9289, 8259}, {9334, 8260}, {9232, 8261},
+    {9290, 8262}, {9282, 8263}, {9261, 8264}, {9319, 8265}, {9309, 8266}, {9297, 8267}, {9336, 8268}, {9325, 8269},
+    {9324, 8270}, {1250, 8272}, {91, 8273}, {9301, 8274}, {9281, 8275}, {9343, 8276}, {9302, 8277}, {9218, 8278},
+    {9318, 8279}, {9302, 8280}, {9298, 8281}, {9222, 8282}, {9298, 8284}, {9278, 8285}, {9306, 8286}, {9378, 8287},
+    {9339, 8288}, {9251, 8289}, {9258, 8290}, {9253, 8291}, {9343, 8292}, {104, 8293}, {9255, 8294}, {9262, 8295},
+    {9330, 8296}, {9331, 8297}, {9259, 8298}, {9253, 8299}, {9256, 8300}, {9278, 8301}, {9332, 8303}, {9295, 8304},
+    {9255, 8305}, {1238, 8306}, {9296, 8307}, {9323, 8308}, {9320, 8309}, {883, 8310}, {9266, 8311}, {9300, 8312},
+    {9275, 8313}, {9324, 8314}, {9250, 8315}, {9268, 8317}, {9248, 8318}, {9306, 8319}, {9308, 8320}, {954, 8321},
+    {9218, 8322}, {9261, 8323}, {9265, 8324}, {9307, 8325}, {9304, 8326}, {575, 8327}, {9226, 8328}, {9310, 8331},
+    {9274, 8332}, {9318, 8333}, {906, 8334}, {9309, 8335}, {1201, 8336}, {9320, 8337}, {9321, 8338}, {9246, 8339},
+    {869, 8340}, {9218, 8341}, {9324, 8342}, {9325, 8343}, {9242, 8344}, {9327, 8346}, {9290, 8347}, {9291, 8348},
+    {9288, 8349}, {363, 8350}, {9245, 8351}, {9244, 8352}, {9219, 8353}, {377, 8354}, {9233, 8355}, {9242, 8356},
+    {9338, 8357}, {9242, 8358}, {9231, 8359}, {788, 8361}, {9233, 8362}, {9231, 8363}, {9403, 8365}, {9346, 8366},
+    {9233, 8364}, {9456, 8367}, {9406, 8368}, {9349, 8369}, {9447, 8370}, {9440, 8371}, {9466, 8372}, {9395, 8373},
+    {9461, 8364}, {9467, 8374}, {9393, 8375}, {9398, 8376}, {1296, 8377}, {1013, 8378}, {9452, 8379}, {9451, 8380},
+    {9443, 8381}, {9445, 8382}, {654, 8383}, {9387, 8428}, {9421, 8385}, {9468, 8386}, {9466, 8440}, {9365, 8387},
+    {9464, 8389}, {257, 8390}, {9465, 8391}, {9368, 8392}, {9468, 8393}, {9443, 8394}, {9458, 8396}, {9458, 8397},
+    {9373, 8398}, {9458, 8399}, {9421, 8400}, {1323, 8401}, {9370, 8402}, {9377, 8403}, {9378, 8404}, {9421, 8405},
+    {262, 8406}, {9421, 8407}, {9431, 8408}, {9372, 8409}, {9383, 8410}, {9412, 8411}, {9445, 8412}, {9432, 8413},
+    {9220, 8319}, {9418, 8414}, {9421, 8415}, {9420, 8416}, {9457, 8417}, {9365, 8418}, {9437, 8419}, {555, 8420},
+    {9439, 8421}, {9409, 8422}, {9428, 8419}, {9427, 8423}, {9430, 8419}, {9411, 8424}, {9425, 8425}, {9421, 8426},
+    {9416, 8427}, {9432, 8429}, {510, 8430}, {9433, 8431}, {9433, 8432}, {9424, 8433}, {9407, 8434}, {9388, 8435},
+    {374, 8436}, {9388, 8437}, {9410, 8438}, {9399, 8439}, {9381, 8441}, {9377, 8442}, {9414, 8419}, {9354, 8443},
+    {9469, 8445}, {441, 8446}, {9388, 8447}, {9366, 8448}, {9456, 8449}, {9419, 8450}, {9381, 8451}, {9362, 8452},
+    {9422, 8453}, {9403, 8454}, {9378, 8479}, {9425, 8455}, {9448, 8456}, {9377, 8457}, {9449, 8458}, {9376, 8459},
+    {9455, 8460}, {9353, 8461}, {9403, 8462}, {9442, 8463}, {9471, 8464}, {9349, 8465}, {702, 8466}, {9435, 8467},
+    {9401, 8468}, {9364, 8469}, {722, 8470}, {9407, 8471}, {967, 8472}, {9398, 8573}, {9435, 8473}, {9360, 8474},
+    {9346, 8475}, {9357, 8476}, {9439, 8477}, {9446, 8480}, {9359, 8481}, {1281, 8483}, {9426, 8484}, {1297, 8485},
+    {9427, 8486}, {9346, 8487}, {9346, 8488}, {9347, 8489}, {9359, 8490}, {9429, 8491}, {9348, 8492}, {9457, 8493},
+    {9366, 8494}, {9460, 8495}, {9362, 8496}, {9462, 8497}, {9369, 8498}, {9383, 8499}, {9368, 8500}, {9375, 8501},
+    {9380, 8502}, {9375, 8503}, {9469, 8504}, {27, 8505}, {9470, 8506}, {9471, 8507}, {9593, 8509}, {9572, 8511},
+    {9575, 8512}, {9581, 8513}, {9577, 8514}, {9579, 8515}, {9532, 8516}, {9584, 8517}, {9595, 8518}, {9575, 8519},
+    {309, 8520}, {9573, 8521}, {9573, 8522}, {9581, 8523}, {9583, 8524}, {160, 8525}, {9570, 8526}, {9570, 8527},
+    {9571, 8528}, {9596, 8529}, {9490, 8530}, {9592, 8531}, {9585, 8532}, {144, 8533}, {9519, 8534}, {9587, 8535},
+    {9517, 8536}, {9579, 8537}, {9568, 8538}, {9504, 8539}, {9505, 8540}, {9539, 8543}, {9598, 8544}, {9508, 8545},
+    {9509, 8547}, {1097, 8548}, {9541, 8549}, {9538, 8550}, {9547, 8551}, {9536, 8552}, {9502, 8554}, {729, 8555},
+    {502, 8556}, {1026, 8557}, {9594, 8558}, {767, 8559}, {9500, 8560}, {9511, 8561}, {9512, 8562}, {9491, 8563},
+    {9550, 8564}, {9538, 8565}, {9494, 8566}, {9566, 8568}, {9547, 8569}, {9493, 8570}, {9583, 8572}, {9566, 8574},
+    {9522, 8575}, {9543, 8576}, {9486, 8577}, {9561, 8578}, {9559, 8579}, {60, 8580}, {56, 8581}, {715, 8583},
+    {9539, 8584}, {33, 8585}, {9547, 8588}, {9529, 8589}, {9472, 8590}, {9556, 8591}, {9560, 8592}, {9562, 8594},
+    {9569, 8595}, {1218, 8596}, {9553, 8597}, {9517, 8598}, {9517, 8599}, {9526, 8600}, {9539, 8602}, {9499, 8604},
+    {849, 8605}, {9525, 8606}, {9542, 8607}, {9523, 8608}, {9521, 8610}, {9587, 8611}, {453, 8612}, {9658, 8613},
+    {9519, 8614}, {9509, 8616}, {9517, 8617}, {9513, 8618}, {9515, 8620}, {9551, 8622}, {9507, 8623}, {9525, 8624},
+    {9533, 8626}, {9577, 8627}, {182, 8628}, {9520, 8630}, {9533, 8631}, {9521, 8632}, {9529, 8633}, {9533, 8634},
+    {9478, 8635}, {1057, 8636}, {9527, 8637}, {9524, 8638}, {9531, 8640}, {9530, 8641}, {9523, 8642}, {9520, 8643},
+    {9568, 8645}, {9563, 8646}, {9475, 8647}, {9489, 8648}, {9480, 8649}, {9476, 8661}, {9492, 8650}, {9491, 8651},
+    {9527, 8652}, {9476, 8653}, {9487, 8654}, {189, 8655}, {9480, 8656}, {9558, 8657}, {9559, 8659}, {9483, 8660},
+    {9557, 8663}, {1, 8664}, {9584, 8665}, {9503, 8666}, {9586, 8667}, {9587, 8668}, {9550, 8669}, {9589, 8670},
+    {9590, 8672}, {9549, 8673}, {9592, 8674}, {9498, 8675}, {9536, 8676}, {9508, 8677}, {9501, 8678}, {9493, 8678},
+    {9490, 8679}, {9485, 8681}, {9700, 8682}, {9707, 8683}, {9711, 8684}, {9718, 8685}, {9713, 8686}, {9699, 8687},
+    {9704, 8688}, {9723, 8689}, {9703, 8690}, {423, 8691}, {437, 8692}, {9726, 8693}, {9649, 8694}, {9612, 8695},
+    {9704, 8696}, {9722, 8697}, {9653, 8698}, {9698, 8699}, {9699, 8701}, {9697, 8702}, {9641, 8705}, {9715, 8707},
+    {9726, 8708}, {390, 8709}, {9727, 8710}, {880, 8711}, {712, 8712}, {9720, 8713}, {53, 8714}, {9725, 8715},
+    {9635, 8716}, {9632, 8718}, {9722, 8719}, {1074, 8721}, {9638, 8722}, {214, 8723}, {9629, 8725}, {9719, 8726},
+    {9631, 8727}, {9672, 8728}, {9668, 8729}, {9667, 8730}, {623, 8731}, {9664, 8733}, {9686, 8734}, {9681, 8735},
+    {9673, 8736}, {695, 8737}, {9678, 8738}, {9673, 8741}, {9718, 8742}, {9679, 8743}, {9664, 8744}, {9666, 8746},
+    {9675, 8747}, {9690, 8748}, {9647, 8749}, {9648, 8750}, {9710, 8751}, {9650, 8752}, {393, 8753}, {9609, 8754},
+    {9687, 8755}, {9619, 8756}, {9687, 8757}, {9655, 8758}, {9686, 8760}, {9688, 8761}, {9658, 8762}, {9690, 8763},
+    {9660, 8764}, {9661, 8765}, {9677, 8766}, {9605, 8767}, {9664, 8768}, {9665, 8769}, {952, 8770}, {9666, 8772},
+    {656, 8773}, {9667, 8774}, {9627, 8775}, {9727, 8776}, {9653, 8777}, {630, 8778}, {9614, 8779}, {176, 8780},
+    {9714, 8781}, {9615, 8782}, {9674, 8783}, {9713, 8784}, {9718, 8785}, {185, 8786}, {9662, 8787}, {9642, 8788},
+    {9633, 8789}, {9635, 8790}, {9616, 8791}, {9631, 8792}, {9632, 8795}, {9659, 8796}, {9638, 8797}, {9708, 8798},
+    {9687, 8799}, {9606, 8800}, {9659, 8801}, {9656, 8802}, {9692, 8803}, {9703, 8804}, {264, 8805}, {9646, 8806},
+    {9567, 8807}, {9696, 8808}, {9619, 8809}, {9688, 8810}, {9786, 8811}, {9699, 8812}, {9600, 8814}, {9607, 8815},
+    {9703, 8816}, {9704, 8817}, {9683, 8818}, {9653, 8819}, {9652, 8820}, {9600, 8821}, {9709, 8822}, {1262, 8823},
+    {777, 8826}, {9713, 8827}, {9714, 8828}, {9601, 8830}, {113, 8831}, {9616, 8832}, {9717, 8833}, {9606, 8834},
+    {9622, 8835}, {9666, 8836}, {229, 8837}, {9659, 8928}, {709, 8838}, {9655, 8840}, {9665, 8841}, {9627, 8842},
+    {9627, 8824}, {9725, 8843}, {9726, 8844}, {9630, 8846}, {9729, 8847}, {9807, 8848}, {921, 8849}, {9731, 8851},
+    {1214, 8853}, {1237, 8854}, {9829, 8855}, {9791, 8857}, {38, 8858}, {1063, 8859}, {9831, 8860}, {933, 8861},
+    {9735, 8862}, {9736, 8863}, {9737, 8864}, {9849, 8866}, {9631, 8824}, {9834, 8867}, {9854, 8868}, {9600, 8824},
+    {9836, 8870}, {9839, 8871}, {759, 8872}, {9781, 8873}, {9770, 8874}, {9806, 8876}, {9831, 8877}, {9850, 8880},
+    {9831, 8888}, {9749, 8878}, {29, 8879}, {9855, 8881}, {9751, 8882}, {868, 8883}, {9762, 8884}, {9835, 8885},
+    {9851, 8886}, {9755, 8887}, {9833, 8889}, {9757, 8890}, {9758, 8891}, {9841, 8894}, {9796, 8895}, {9792, 8896},
+    {9795, 8897}, {9763, 8899}, {9837, 8900}, {9815, 8901}, {9849, 8902}, {1004, 8903}, {9757, 8904}, {9793, 8906},
+    {143, 8907}, {9822, 8908}, {9744, 8909}, {9797, 8910}, {9843, 8911}, {739, 8912}, {9751, 8913}, {9799, 8914},
+    {9775, 8916}, {586, 8917}, {231, 8918}, {9738, 8919}, {9823, 8921}, {9811, 8922}, {9779, 8923}, {37, 8924},
+    {9809, 8925}, {9808, 8926}, {9811, 8927}, {9797, 8929}, {9730, 8930}, {9731, 8931}, {9843, 8932}, {9787, 8933},
+    {9806, 8940}, {9810, 8938}, {9804, 8934}, {9819, 8958}, {9761, 8936}, {9769, 8937}, {9772, 8939}, {9776, 8941},
+    {9765, 8942}, {9772, 8943}, {9780, 8944}, {9762, 8945}, {9842, 8947}, {9750, 8948}, {9774, 8949}, {650, 8950},
+    {9770, 8951}, {9871, 8953}, {1169, 8954}, {9772, 8955}, {9844, 8956}, {9845, 8957}, {9781, 8959}, {9809, 8960},
+    {9741, 8962}, {9783, 8963}, {9813, 8964}, {820, 8965}, {9765, 8966}, {9748, 8967}, {973, 8968}, {9780, 8969},
+    {9790, 8970}, {242, 8971}, {9818, 8972}, {9822, 8974}, {9790, 8975}, {9824, 8976}, {9762, 8977}, {9731, 8978},
+    {9827, 8979}, {9787, 8980}, {9782, 8981}, {940, 8983}, {9820, 8984}, {9748, 8985}, {9754, 8987}, {9757, 8989},
+    {9769, 8973}, {9834, 8990}, {9742, 8991}, {9743, 8992}, {9740, 8993}, {9838, 8994}, {21, 8995}, {9813, 8996},
+    {9840, 8998}, {9841, 9000}, {9781, 8973}, {9749, 9001}, {9801, 9002}, {9771, 9003}, {9752, 9004}, {9846, 9005},
+    {9758, 9006}, {1036, 9007}, {9769, 8973}, {9767, 9008}, {89, 9009}, {9766, 9010}, {85, 9011}, {9792, 9012},
+    {9754, 9013}, {9755, 9014}, {9799, 9015}, {9742, 9016}, {9754, 9017}, {716, 9018}, {65, 9020}, {419, 9021},
+    {9957, 9022}, {9976, 9023}, {9912, 9024}, {9959, 9025}, {9963, 9026}, {9919, 9027}, {9862, 9028}, {9966, 9029},
+    {9906, 9030}, {9907, 9031}, {9955, 9033}, {9905, 9034}, {9957, 9035}, {9983, 9036}, {9908, 9038}, {9966, 9039},
+    {9957, 9040}, {9968, 9041}, {178, 9042}, {9896, 9043}, {9932, 9044}, {9876, 9046}, {9903, 9047}, {9878, 9048},
+    {9955, 9049}, {9890, 9050}, {9881, 9051}, {9882, 9052}, {9976, 9053}, {9977, 9054}, {9885, 9055}, {9886, 9056},
+    {9965, 9058}, {9935, 9059}, {9933, 9060}, {9923, 9061}, {9891, 9062}, {9929, 9066}, {9893, 9068}, {1005, 9069},
+    {383, 9070}, {9894, 9071}, {9976, 9072}, {9926, 9073}, {9897, 9074}, {9973, 9075}, {9873, 9076}, {9900, 9077},
+    {9931, 9078}, {9948, 9079}, {476, 9080}, {9927, 9081}, {9904, 9082}, {9940, 9083}, {9922, 9084}, {9947, 9088},
+    {9870, 9090}, {193, 9091}, {9909, 9092}, {9944, 9093}, {9942, 9094}, {9959, 9095}, {9951, 9096}, {9950, 9098},
+    {9939, 9099}, {9944, 9100}, {9951, 9101}, {824, 9102}, {9932, 9103}, {9889, 9105}, {826, 9106}, {9979, 9107},
+    {9976, 9108}, {9923, 9109}, {9980, 9112}, {9907, 9113}, {9905, 9114}, {9893, 9115}, {9912, 9116}, {213, 9117},
+    {9902, 9118}, {9875, 9119}, {9891, 9120}, {9934, 9121}, {9916, 9123}, {9905, 9124}, {9869, 9125}, {9911, 9126},
+    {9966, 9127}, {9913, 9128}, {9913, 9130}, {9912, 9131}, {9954, 9132}, {9955, 9133}, {9909, 9134}, {9908, 9135},
+    {75, 9136}, {9948, 9137}, {9918, 9138}, {9915, 9139}, {9907, 9140}, {9875, 9141}, {9863, 9142}, {9868, 9143},
+    {9863, 9144}, {9860, 9145}, {9948, 9146}, {9858, 9148}, {9960, 9149}, {9961, 9150}, {9936, 9151}, {9963, 9152},
+    {538, 9154}, {9942, 9155}, {8, 9156}, {559, 9157}, {9965, 9158}, {421, 9159}, {593, 9160}, {9966, 9161},
+    {490, 9162}, {9860, 9163}, {9968, 9164}, {9872, 9165}, {9886, 9166}, {9878, 9167}, {9877, 9168}, {9872, 9169},
+    {9924, 9111}, {9932, 9170}, {9881, 9171}, {9895, 9172}, {9884, 9173}, {9875, 9174}, {9921, 9175}, {9874, 9176},
+    {9865, 9177}, {9881, 9178}, {9878, 9181}, {9984, 9182}, {569, 9183}, {10043, 9184}, {10087, 9185}, {9987, 9186},
+    {10103, 9187}, {10081, 9188}, {10073, 9189}, {9991, 9190}, {10034, 9191}, {10092, 9192}, {10084, 9194}, {10033, 9197},
+    {10110, 9199}, {9997, 9200}, {9998, 9201}, {10083, 9202}, {10000, 9204}, {498, 9206}, {10109, 9207}, {1037, 9208},
+    {10061, 9209}, {10085, 9210}, {10086, 9211}, {10110, 9213}, {10111, 9214}, {10093, 9215}, {10095, 9216}, {10106, 9218},
+    {10100, 9219}, {10110, 9220}, {10088, 9221}, {10050, 9222}, {10020, 9223}, {10102, 9224}, {10049, 9225}, {597, 9226},
+    {583, 9227}, {10098, 9228}, {1083, 9229}, {10018, 9231}, {10050, 9232}, {10107, 9233}, {10015, 9234}, {775, 9235},
+    {10105, 9236}, {10013, 9237}, {611, 9238}, {10054, 9239}, {458, 9240}, {467, 9241}, {10049, 9242}, {10026, 9243},
+    {234, 9244}, {133, 9245}, {780, 9247}, {706, 9249}, {10083, 9250}, {10028, 9251}, {10049, 9252}, {10048, 9254},
+    {10032, 9256}, {10064, 9257}, {166, 9258}, {10034, 9259}, {10035, 9260}, {10072, 9262}, {10064, 9263}, {10089, 9264},
+    {10075, 9265}, {10078, 9266}, {10076, 9267}, {10085, 9268}, {10069, 9269}, {10064, 9270}, {10045, 9271}, {350, 9272},
+    {10054, 9254}, {9986, 9273}, {10064, 9274}, {10078, 9275}, {1324, 9276}, {10049, 9277}, {10039, 9279}, {10202, 9280},
+    {980, 9281}, {10023, 9282}, {10053, 9283}, {539, 9285}, {10023, 9286}, {9894, 9111}, {10022, 9287}, {999, 9288},
+    {1114, 9289}, {10059, 9290}, {10009, 9291}, {9988, 9292}, {10031, 9293}, {863, 9294}, {10022, 9312}, {10044, 9335},
+    {10020, 9332}, {580, 9297}, {1222, 9298}, {10088, 9299}, {10089, 9301}, {168, 9302}, {10033, 9303}, {10095, 9304},
+    {10070, 9305}, {10046, 9307}, {10043, 9309}, {10073, 9310}, {10080, 9311}, {1110, 9313}, {667, 9314}, {10081, 9315},
+    {10054, 9284}, {1155, 9316}, {10045, 9317}, {590, 9319}, {10035, 9322}, {10078, 9323}, {10033, 9326}, {149, 9328},
+    {35, 9329}, {107, 9330}, {10004, 9331}, {10075, 9333}, {9989, 9334}, {10073, 9336}, {10006, 9337}, {10085, 9339},
+    {10086, 9340}, {10030, 9341}, {9997, 9342}, {9992, 9343}, {10064, 9344}, {525, 9345}, {9994, 9347}, {1319, 9348},
+    {10092, 9350}, {9986, 9351}, {10010, 9352}, {902, 9353}, {9994, 9354}, {134, 9355}, {548, 9356}, {10004, 9357},
+    {10014, 9358}, {10012, 9359}, {10057, 9360}, {747, 9361}, {9991, 9362}, {10000, 9363}, {10043, 9364}, {10103, 9366},
+    {10009, 9367}, {10022, 9369}, {10106, 9370}, {10009, 9371}, {10036, 9372}, {10110, 9374}, {10012, 9375}, {318, 9376},
+    {10112, 9379}, {10222, 9380}, {10208, 9381}, {950, 9382}, {10224, 9384}, {10219, 9385}, {10175, 9386}, {10226, 9387},
+    {10119, 9388}, {10120, 9389}, {10234, 9390}, {655, 9391}, {10211, 9392}, {10233, 9393}, {10217, 9394}, {10220, 9395},
+    {10164, 9396}, {10060, 9397}, {10225, 9398}, {10190, 9399}, {10152, 9400}, {10237, 9401}, {10225, 9402}, {10235, 9403},
+    {10134, 9404}, {10161, 9405}, {10146, 9406}, {10231, 9408}, {10035, 9409}, {10229, 9411}, {10140, 9412}, {10141, 9413},
+    {10221, 9414}, {743, 9415}, {10169, 9416}, {10177, 9417}, {10008, 9284}, {164, 9418}, {10197, 9420}, {10179, 9421},
+    {10202, 9423}, {10189, 9424}, {1000, 9426}, {10180, 9440}, {10184, 9450}, {10182, 9458}, {913, 9427}, {10182, 9428},
+    {1116, 9429}, {10176, 9430}, {10128, 9431}, {1107, 9432}, {10221, 9433}, {10189, 9434}, {10157, 9436}, {10178, 9437},
+    {10187, 9438}, {10200, 9439}, {386, 9441}, {10123, 9442}, {10199, 9443}, {10205, 9444}, {23, 9445}, {10164, 9447},
+    {806, 9448}, {908, 9449}, {10203, 9451}, {10166, 9452}, {10202, 9453}, {10201, 9454}, {1137, 9455}, {10198, 9456},
+    {10201, 9459}, {10184, 9461}, {10172, 9463}, {10195, 9464}, {10203, 9465}, {10175, 9466}, {10149, 9467}, {10235, 9468},
+    {10161, 9472}, {10150, 9473}, {10180, 9474}, {10239, 9475}, {10152, 9476}, {10183, 9477}, {112, 9478}, {10173, 9479},
+    {10186, 9480}, {10187, 9481}, {10146, 9482}, {10189, 9483}, {10144, 9484}, {10170, 9485}, {10192, 9486}, {10168, 9487},
+    {10171, 9488}, {10172, 9489}, {10196, 9491}, {10167, 9492}, {771, 9493}, {10198, 9494}, {939, 9495}, {10221, 9496},
+    {10200, 9497}, {132, 9498}, {511, 9499}, {10155, 9500}, {10208, 9501}, {20, 9502}, {836, 9503}, {10209, 9504},
+    {10158, 9505}, {10168, 9506}, {10156, 9507}, {564, 9508}, {10174, 9509}, {1276, 9510}, {352, 9513}, {10120, 9514},
+    {10118, 9515}, {710, 9516}, {10130, 9517}, {10211, 9518}, {1040, 9519}, {10125, 9520}, {10169, 9521}, {10168, 9523},
+    {778, 9524}, {10194, 9525}, {10124, 9526}, {10165, 9527}, {10219, 9528}, {765, 9530}, {10121, 9531}, {10137, 9532},
+    {10120, 9533}, {10126, 9534}, {10186, 9535}, {10116, 9520}, {10143, 9536}, {10298, 9537}, {10139, 9538}, {10138, 9540},
+    {10128, 9541}, {10229, 9543}, {10230, 9544}, {353, 9545}, {325, 9600}, {10139, 9701}, {10233, 9546}, {10139, 9547},
+    {10177, 9548}, {10137, 9549}, {10183, 9550}, {10180, 9552}, {10125, 9553}, {10334, 9554}, {154, 9555}, {10333, 9556},
+    {10349, 9557}, {10129, 9701}, {10348, 9558}, {10303, 9559}, {10246, 9560}, {10350, 9561}, {10343, 9562}, {10343, 9563},
+    {10250, 9564}, {10251, 9565}, {10339, 9566}, {10339, 9567}, {469, 9569}, {10347, 9570}, {10293, 9571}, {10319, 9572},
+    {10175, 9477}, {10356, 9573}, {10280, 9574}, {10365, 9575}, {10360, 9576}, {10361, 9577}, {10262, 9578}, {10285, 9579},
+    {961, 9580}, {1152, 9581}, {10264, 9582}, {1132, 9583}, {10265, 9585}, {1182, 9588}, {684, 9591}, {10349, 9593},
+    {882, 9594}, {10357, 9595}, {10352, 9596}, {10366, 9597}, {10276, 9598}, {10364, 9599}, {10272, 9601}, {10310, 9602},
+    {10321, 9603}, {10265, 9604}, {10314, 9605}, {10277, 9606}, {10268, 9607}, {10312, 9608}, {10359, 9609}, {10310, 9610},
+    {86, 9611}, {10282, 9613}, {10257, 9614}, {310, 9615}, {10262, 9616}, {10334, 9617}, {10330, 9618}, {639, 9619},
+    {10287, 9620}, {10313, 9621}, {10326, 9622}, {10290, 9623}, {10249, 9624}, {912, 9625}, {812, 9626}, {10328, 9627},
+    {1125, 9628}, {10321, 9630}, {10327, 9632}, {10322, 9633}, {10242, 9634}, {10342, 9635}, {10313, 9636}, {10315, 9637},
+    {10246, 9638}, {10328, 9639}, {10330, 9640}, {10310, 9641}, {10277, 9642}, {10272, 9643}, {10306, 9644}, {10295, 9645},
+    {10283, 9646}, {10279, 9649}, {552, 9651}, {10365, 9652}, {10250, 9653}, {10313, 9654}, {10243, 9656}, {10315, 9657},
+    {10358, 9659}, {10359, 9662}, {389, 9663}, {10283, 9668}, {949, 9669}, {10286, 9670}, {10292, 9671}, {10275, 9688},
+    {641, 9672}, {10273, 9673}, {1085, 9675}, {725, 9676}, {10290, 9677}, {10350, 9678}, {10267, 9679}, {10295, 9680},
+    {10277, 9681}, {10292, 9682}, {10256, 9683}, {10245, 9684}, {10298, 9685}, {359, 9686}, {10298, 9690}, {10341, 9691},
+    {10286, 9689}, {813, 9693}, {10242, 9694}, {10280, 9695}, {10251, 9697}, {860, 9698}, {853, 9728}, {10289, 9812},
+    {10262, 9700}, {10292, 9689}, {10297, 9702}, {892, 9705}, {10249, 9706}, {10267, 9707}, {10247, 9708}, {10251, 9710},
+    {10258, 9711}, {10264, 9712}, {10349, 9715}, {10350, 9716}, {10325, 9718}, {10352, 9719}, {205, 9720}, {10242, 9721},
+    {10294, 9722}, {1162, 9723}, {10355, 9724}, {10356, 9727}, {10267, 9730}, {10316, 9732}, {161, 9733}, {10317, 9734},
+    {10269, 9738}, {10361, 9739}, {10304, 9740}, {10363, 9741}, {10310, 9742}, {434, 9743}, {717, 9744}, {10254, 9745},
+    {10308, 9746}, {10309, 9747}, {10368, 9748}, {10427, 9750}, {81, 9752}, {10424, 9753}, {10425, 9754}, {10430, 9756},
+    {10486, 9759}, {10472, 9760}, {10467, 9761}, {10376, 9762}, {10469, 9764}, {10475, 9765}, {10474, 9766}, {223, 9767},
+    {10466, 9768}, {10442, 9769}, {355, 9770}, {10292, 9644}, {10493, 9771}, {10492, 9772}, {821, 9773}, {10495, 9774},
+    {1031, 9776}, {10411, 9777}, {10491, 9778}, {10409, 9780}, {10490, 9781}, {10389, 9782}, {10483, 9783}, {244, 9784},
+    {277, 9785}, {10491, 9786}, {10491, 9788}, {10494, 9789}, {10491, 9790}, {10485, 9791}, {10396, 9792}, {10292, 9793},
+    {10404, 9794}, {10425, 9795}, {10400, 9796}, {10395, 9797}, {10493, 9798}, {10455, 9799}, {1109, 9800}, {10491, 9801},
+    {10405, 9802}, {10434, 9803}, {10488, 9804}, {10386, 9805}, {673, 9806}, {1227, 9807}, {10461, 9808}, {10485, 9810},
+    {10484, 9811}, {10445, 9814}, {10436, 9815}, {10439, 9816}, {10433, 9817}, {10450, 9819}, {10454, 9820}, {10438, 9821},
+    {10377, 9823}, {10432, 9825}, {10421, 9826}, {10435, 9828}, {10463, 9829}, {1175, 9830}, {10457, 9831}, {10442, 9832},
+    {10469, 9833}, {10427, 9835}, {10374, 9836}, {10446, 9837}, {1088, 9839}, {10372, 9842}, {345, 9843}, {10462, 9844},
+    {10420, 9845}, {10415, 9847}, {10416, 9848}, {10402, 9849}, {1136, 9850}, {10400, 9851}, {10495, 9852}, {1230, 9853},
+    {10420, 9854}, {10439, 9855}, {10482, 9856}, {10426, 9857}, {734, 9858}, {10442, 9859}, {10415, 9860}, {1289, 9861},
+    {10405, 9952}, {10405, 9863}, {608, 9864}, {25, 9865}, {10426, 9866}, {1265, 9867}, {10384, 9868}, {10403, 9869},
+    {233, 9870}, {10429, 9871}, {10406, 9872}, {10473, 9873}, {807, 9874}, {10406, 9875}, {212, 9877}, {10453, 9879},
+    {1246, 9880}, {10425, 9883}, {10455, 9884}, {10456, 9887}, {10424, 9888}, {10464, 9889}, {10465, 9890}, {10414, 9892},
+    {10428, 9895}, {10369, 9896}, {10419, 9898}, {689, 9899}, {10382, 9901}, {10387, 9915}, {10397, 9902}, {10383, 9903},
+    {10467, 9905}, {10388, 9906}, {10382, 9907}, {73, 9908}, {10611, 9910}, {10600, 9911}, {10595, 9912}, {10592, 9913},
+    {10500, 9914}, {10593, 9916}, {10598, 9918}, {10597, 9919}, {10544, 9920}, {371, 9921}, {208, 9922}, {10596, 9925},
+    {10594, 9937}, {79, 9926}, {10596, 9927}, {10510, 9928}, {10576, 9929}, {10512, 9930}, {10513, 9931}, {10611, 9932},
+    {10502, 9917}, {10595, 9933}, {10613, 9935}, {10609, 9936}, {10615, 9938}, {10519, 9939}, {1251, 9940}, {10623, 9941},
+    {10615, 9942}, {10528, 9943}, {1135, 9944}, {1280, 9945}, {10613, 9946}, {10534, 9947}, {10535, 9949}, {10526, 9950},
+    {10604, 9951}, {10522, 9953}, {10529, 9954}, {10520, 9955}, {10572, 9956}, {10568, 9957}, {852, 9958}, {10533, 9959},
+    {901, 9962}, {225, 9964}, {10575, 9967}, {10563, 9969}, {10567, 9970}, {10562, 9971}, {10538, 9972}, {10564, 9973},
+    {835, 9974}, {10611, 9975}, {10588, 9976}, {10542, 9977}, {10568, 9978}, {810, 9979}, {10544, 9980}, {10561, 9981},
+    {10577, 9982}, {10589, 9983}, {970, 9985}, {10548, 9986}, {10549, 9988}, {10601, 9989}, {10565, 9990}, {445, 9992},
+    {10498, 9993}, {10499, 9994}, {1134, 9995}, {10554, 9996}, {10497, 9999}, {10581, 10001}, {10594, 10002}, {10586, 10003},
+    {10559, 10004}, {10547, 10005}, {10538, 10006}, {10531, 10007}, {10563, 10008}, {10622, 10009}, {10532, 10010}, {10531, 10011},
+    {10549, 10012}, {10534, 10013}, {470, 10014}, {10528, 10107}, {10530, 10015}, {10609, 10016}, {10529, 10017}, {10573, 10019},
+    {10543, 10020}, {805, 10021}, {10556, 10022}, {652, 10023}, {10576, 10024}, {10577, 10025}, {10528, 10027}, {10557, 10029},
+    {10557, 10030}, {10546, 10031}, {10553, 10033}, {10553, 10036}, {10584, 10037}, {10556, 10038}, {10548, 10039}, {10546, 10040},
+    {10549, 10041}, {10542, 10042}, {10519, 10043}, {10545, 10044}, {10497, 10048}, {10511, 10057}, {10513, 10046}, {10595, 10047},
+    {10504, 10050}, {10515, 10051}, {10503, 10052}, {10498, 10055}, {10578, 10056}, {10595, 9917}, {10542, 10058}, {10499, 10060},
+    {10503, 10061}, {10504, 10062}, {10499, 10063}, {10496, 10064}, {10503, 10065}, {900, 10066}, {1253, 10067}, {10608, 10068},
+    {488, 10069}, {10498, 10071}, {10525, 10072}, {334, 10074}, {246, 10075}, {10569, 10076}, {10612, 10077}, {10613, 10079},
+    {10527, 10080}, {316, 10081}, {10615, 10082}, {711, 10083}, {10616, 10084}, {10517, 10087}, {10618, 10088}, {10619, 10089},
+    {750, 10090}, {10620, 10091}, {10621, 10093}, {10622, 10094}, {10623, 10095}, {10682, 10096}, {10728, 10097}, {10680, 10098},
+    {545, 10099}, {10722, 10100}, {10686, 10101}, {10743, 10102}, {10713, 10104}, {10738, 10105}, {10674, 10108}, {10725, 10109},
+    {10672, 10111}, {10635, 10113}, {10733, 10114}, {10637, 10115}, {10731, 10116}, {1021, 10117}, {10721, 10118}, {10737, 10121},
+    {10736, 10122}, {10747, 10123}, {10665, 10124}, {10670, 10125}, {779, 10126}, {10745, 10127}, {10646, 10128}, {10696, 10129},
+    {772, 10130}, {10648, 10131}, {10687, 10132}, {10693, 10133}, {10705, 10135}, {340, 10136}, {10662, 10137}, {10683, 10138},
+    {10654, 10139}, {10746, 10142}, {10740, 10143}, {10722, 10144}, {10700, 10145}, {10688, 10146}, {10698, 10147}, {10746, 10148},
+    {10745, 10149}, {10691, 10150}, {10701, 10151}, {10665, 10152}, {10707, 10153}, {959, 10154}, {10719, 10155}, {10701, 10156},
+    {10691, 10158}, {10644, 10159}, {10719, 10160}, {1203, 10161}, {10672, 10162}, {10635, 10163}, {10674, 10165}, {10689, 10167},
+    {10717, 10168}, {10730, 10169}, {10713, 10170}, {10713, 10171}, {10727, 10173}, {10681, 10174}, {10697, 10176}, {1321, 10177},
+    {10683, 10178}, {10630, 10179}, {1315, 10181}, {10631, 10182}, {10698, 10184}, {10720, 10185}, {10655, 10188}, {10673, 10190},
+    {10666, 10191}, {10745, 10193}, {10651, 10194}, {10693, 10195}, {10663, 10197}, {1029, 10199}, {10676, 10201}, {749, 10202},
+    {77, 10203}, {10684, 10204}, {10697, 10205}, {10698, 10206}, {10656, 10207}, {10661, 10208}, {10667, 10209}, {10671, 10210},
+    {10664, 10212}, {10660, 10213}, {10626, 10215}, {1064, 10216}, {10707, 10214}, {10706, 10214}, {10710, 10217}, {10704, 10214},
+    {10719, 10214}, {10718, 10214}, {10717, 10214}, {10716, 10214}, {10715, 10214}, {10714, 10214}, {10713, 10214}, {10712, 10214},
+    {10727, 10214}, {10726, 10214}, {10725, 10214}, {10724, 10214}, {10723, 10214}, {10722, 10214}, {10721, 10214}, {10720, 10214},
+    {10735, 10214}, {10734, 10214}, {10733, 10214}, {10732, 10214}, {10731, 10214}, {10636, 10218}, {10729, 10214}, {10728, 10214},
+    {10708, 10220}, {10624, 10221}, {10643, 10222}, {10644, 10223}, {819, 10224}, {10696, 10225}, {1235, 10240}, {10652, 10341},
+    {10702, 10226}, {10653, 10227}, {10742, 10228}, {10628, 10231}, {10643, 10232}, {10647, 10234}, {1278, 10235}, {10651, 10236},
+    {432, 10237}, {653, 10238}, {10642, 10239}, {10643, 10241}, {10639, 10242}, {10637, 10243}, {10641, 10244}, {607, 10245},
+    {10856, 10247}, {10811, 10248}, {10754, 10249}, {10809, 10252}, {10756, 10253}, {10757, 10254}, {348, 10255}, {10871, 10256},
+    {10759, 10257}, {203, 10258}, {10760, 10259}, {10876, 10260}, {10837, 10261}, {1053, 10263}, {10872, 10266}, {10835, 10267},
+    {10873, 10268}, {10804, 10269}, {1011, 10270}, {10877, 10271}, {10868, 10273}, {10852, 10274}, {175, 10275}, {10829, 10276},
+    {1140, 10278}, {10793, 10279}, {10875, 10280}, {10799, 10281}, {732, 10283}, {123, 10284}, {10850, 10285}, {10866, 10286},
+    {10776, 10288}, {10777, 10289}, {1130, 10291}, {10778, 10292}, {10869, 10293}, {10872, 10294}, {10791, 10295}, {291, 10296},
+    {10858, 10297}, {10789, 10298}, {10836, 10299}, {773, 10300}, {10785, 10301}, {10821, 10302}, {10832, 10303}, {10782, 10304},
+    {10817, 10305}, {10834, 10307}, {10781, 10308}, {10792, 10309}, {10822, 10310}, {410, 10311}, {10840, 10312}, {10823, 10314},
+    {640, 10316}, {919, 10317}, {10838, 10318}, {10825, 10319}, {10831, 10320}, {10822, 10321}, {10762, 10322}, {10837, 10323},
+    {42, 10324}, {10822, 10325}, {10839, 10326}, {10839, 10327}, {10841, 10328}, {10842, 10329}, {10820, 10330}, {10844, 10331},
+    {10819, 10332}, {10825, 10333}, {10753, 10334}, {737, 10335}, {10837, 10336}, {10834, 10337}, {10756, 10338}, {10831, 10339},
+    {10816, 10340}, {10804, 10342}, {10797, 10343}, {10786, 10344}, {10807, 10345}, {10788, 10346}, {10787, 10347}, {10786, 10348},
+    {1095, 10351}, {10793, 10353}, {10791, 10354}, {10826, 10357}, {514, 10358}, {1017, 10359}, {10789, 10360}, {428, 10362},
+    {1143, 10364}, {10797, 10365}, {87, 10366}, {361, 10367}, {337, 10369}, {455, 10370}, {472, 10371}, {815, 10372},
+    {10829, 10373}, {10799, 10374}, {10831, 10375}, {10814, 10377}, {10833, 10378}, {10811, 10379}, {10759, 10380}, {10813, 10381},
+    {10837, 10382}, {10807, 10383}, {10839, 10384}, {401, 10385}, {10850, 10386}, {888, 10387}, {10851, 10388}, {10848, 10390},
+    {10805, 10391}, {10854, 10392}, {10812, 10393}, {10846, 10394}, {10847, 10395}, {10757, 10397}, {261, 10398}, {10799, 10399},
+    {649, 10401}, {10813, 10402}, {10821, 10403}, {10757, 10404}, {10853, 10406}, {10809, 10407}, {646, 10408}, {10845, 10409},
+    {10759, 10410}, {10780, 10411}, {10832, 10412}, {10756, 10413}, {10763, 10414}, {10788, 10415}, {10795, 10416}, {10752, 10417},
+    {10755, 10418}, {910, 10419}, {10827, 10420}, {10759, 10422}, {10753, 10423}, {10768, 10424}, {10869, 10425}, {10778, 10426},
+    {733, 10428}, {10871, 10429}, {596, 10430}, {10771, 10431}, {10774, 10432}, {10754, 10433}, {10760, 10434}, {10776, 10435},
+    {10765, 10436}, {924, 10437}, {10769, 10438}, {346, 10440}, {10879, 10441}, {10880, 10443}, {10985, 10444}, {10986, 10445},
+    {10995, 10446}, {10977, 10447}, {10943, 10448}, {10886, 10449}, {10987, 10450}, {782, 10451}, {10982, 10452}, {11002, 10454},
+    {10979, 10457}, {1112, 10458}, {190, 10459}, {10929, 10460}, {11006, 10461}, {10988, 10462}, {10989, 10463}, {10986, 10464},
+    {10959, 10465}, {10897, 10492}, {10898, 10495}, {10899, 10494}, {10900, 10489}, {10901, 10488}, {10902, 10491}, {10903, 10490},
+    {10904, 10485}, {10905, 10484}, {10906, 10487}, {10907, 10486}, {10908, 10481}, {10909, 10480}, {10910, 10483}, {10911, 10482},
+    {10912, 10477}, {10913, 10476}, {10914, 10479}, {10915, 10478}, {10916, 10473}, {10917, 10472}, {10918, 10475}, {10919, 10474},
+    {10920, 10469}, {10921, 10468}, {10922, 10471}, {10959, 10466}, {10924, 10470}, {10974, 10493}, {10926, 10496}, {10945, 10497},
+    {10965, 10498}, {10891, 10499}, {10930, 10501}, {10948, 10503}, {10932, 10504}, {10970, 10505}, {314, 10506}, {10963, 10507},
+    {10974, 10508}, {10955, 10509}, {10967, 10511}, {10964, 10514}, {10952, 10515}, {10958, 10516}, {10887, 10517}, {10970, 10518},
+    {10955, 10520}, {10944, 10521}, {412, 10522}, {10945, 10523}, {354, 10524}, {633, 10525}, {10935, 10527}, {629, 10528},
+    {993, 10530}, {10919, 10531}, {10919, 10532}, {10912, 10534}, {10933, 10535}, {11005, 10536}, {10952, 10537}, {10925, 10539},
+    {10917, 10540}, {10922, 10541}, {10920, 10543}, {10957, 10545}, {10940, 10546}, {10959, 10547}, {10914, 10550}, {10943, 10551},
+    {1149, 10552}, {1294, 10553}, {1098, 10555}, {10933, 10556}, {10940, 10557}, {10964, 10558}, {10932, 10560}, {10966, 10561},
+    {10917, 10562}, {392, 10564}, {10941, 10565}, {10979, 10566}, {10970, 10567}, {10884, 10568}, {10933, 10569}, {10974, 10570},
+    {403, 10571}, {10942, 10572}, {10882, 10574}, {10880, 10575}, {10887, 10578}, {10969, 10579}, {10890, 10580}, {10891, 10581},
+    {10982, 10582}, {10900, 10583}, {10880, 10585}, {10906, 10586}, {10891, 10587}, {10887, 10588}, {10893, 10589}, {10881, 10590},
+    {10909, 10591}, {10901, 10592}, {10904, 10593}, {10993, 10594}, {10897, 10596}, {10906, 10597}, {10996, 10598}, {10880, 10599},
+    {468, 10600}, {10911, 10601}, {10905, 10602}, {10902, 10603}, {10947, 10604}, {10944, 10605}, {10888, 10606}, {10894, 10607},
+    {10888, 10609}, {10911, 10610}, {1142, 10611}, {10949, 10614}, {11118, 10617}, {598, 10624}, {11067, 10625}, {294, 10626},
+    {11110, 10627}, {326, 10628}, {11106, 10629}, {11105, 10630}, {11115, 10631}, {1176, 10632}, {11112, 10633}, {768, 10634},
+    {11015, 10636}, {11016, 10638}, {11017, 10639}, {11118, 10640}, {11019, 10641}, {11091, 10642}, {245, 10643}, {1264, 10644},
+    {11104, 10645}, {11115, 10647}, {11074, 10649}, {11087, 10650}, {11135, 10651}, {700, 10652}, {11074, 10653}, {11027, 10655},
+    {11126, 10656}, {11131, 10657}, {11030, 10658}, {11108, 10659}, {11079, 10660}, {11114, 10661}, {11127, 10662}, {11126, 10663},
+    {11046, 10664}, {11037, 10666}, {11120, 10667}, {11134, 10668}, {11091, 10669}, {1255, 10670}, {11072, 10671}, {541, 10673},
+    {11032, 10675}, {11085, 10676}, {11038, 10677}, {11094, 10678}, {11036, 10679}, {11090, 10680}, {11078, 10682}, {416, 10684},
+    {131, 10685}, {11126, 10686}, {11077, 10687}, {11086, 10688}, {11074, 10689}, {11053, 10690}, {211, 10691}, {11083, 10692},
+    {11084, 10694}, {11119, 10695}, {11079, 10696}, {11058, 10699}, {11017, 10700}, {11095, 10701}, {11088, 10702}, {11076, 10703},
+    {11093, 10704}, {664, 10705}, {644, 10706}, {298, 10707}, {1226, 10708}, {83, 10709}, {837, 10710}, {1022, 10711},
+    {647, 10712}, {854, 10713}, {282, 10714}, {452, 10715}, {84, 10716}, {284, 10717}, {1035, 10718}, {1232, 10719},
+    {834, 10720}, {1018, 10721}, {202, 10722}, {663, 10723}, {260, 10724}, {433, 10725}, {672, 10726}, {68, 10727},
+    {979, 10728}, {1173, 10729}, {615, 10730}, {11100, 10731}, {1285, 10732}, {11089, 10733}, {922, 10734}, {11008, 10735},
+    {11009, 10736}, {11068, 10737}, {430, 10738}, {11091, 10739}, {252, 10740}, {11083, 10741}, {11099, 10743}, {11054, 10744},
+    {11131, 10745}, {11046, 10746}, {11129, 10747}, {11056, 10748}, {11050, 10749}, {11078, 10750}, {11060, 10751}, {11122, 10752},
+    {507, 10753}, {560, 10755}, {11048, 10758}, {11194, 10761}, {11046, 10762}, {11121, 10763}, {11044, 10764}, {11085, 10765},
+    {204, 10766}, {11124, 10767}, {11066, 10768}, {11042, 10769}, {11070, 10770}, {19, 10771}, {11064, 10772}, {420, 10773},
+    {11057, 10774}, {11057, 10775}, {11116, 10779}, {11043, 10780}, {998, 10781}, {11050, 10782}, {871, 10783}, {11056, 10784},
+    {11104, 10786}, {11099, 10787}, {690, 10788}, {11070, 10789}, {11040, 10770}, {11010, 10790}, {1033, 10791}, {11108, 10793},
+    {11050, 10794}, {11022, 10795}, {11014, 10796}, {11106, 10797}, {11068, 10798}, {11067, 10799}, {32, 10800}, {11103, 10801},
+    {11011, 10802}, {11101, 10803}, {11014, 10804}, {11016, 10805}, {11012, 10806}, {11018, 10807}, {11094, 10808}, {11020, 10809},
+    {11023, 10810}, {80, 10811}, {11093, 10812}, {11010, 10813}, {571, 10814}, {11027, 10815}, {11036, 10817}, {11081, 10818},
+    {11024, 10819}, {11125, 10820}, {11126, 10821}, {11038, 10822}, {11030, 10823}, {11075, 10824}, {11030, 10825}, {11131, 10827},
+    {11032, 10828}, {11133, 10830}, {11076, 10832}, {11025, 10834}, {11251, 10835}, {11239, 10836}, {11239, 10838}, {989, 10840},
+    {617, 10841}, {816, 10842}, {11255, 10843}, {486, 10844}, {11171, 10845}, {11263, 10848}, {11249, 10849}, {11233, 10850},
+    {11214, 10851}, {11221, 10852}, {11257, 10854}, {632, 10855}, {11245, 10856}, {11237, 10857}, {58, 10858}, {11217, 10859},
+    {11206, 10860}, {11260, 10861}, {11256, 10862}, {11176, 10863}, {11155, 10864}, {620, 10865}, {11253, 10866}, {11183, 10867},
+    {11180, 10868}, {11235, 10870}, {11160, 10872}, {11206, 10873}, {11162, 10874}, {11169, 10875}, {11164, 10876}, {11262, 10877},
+    {11172, 10878}, {11257, 10881}, {11215, 10882}, {11215, 10883}, {11160, 10884}, {798, 10885}, {11221, 10887}, {11212, 10888},
+    {11208, 10889}, {11203, 10890}, {682, 10891}, {11175, 10892}, {11213, 10893}, {11155, 10894}, {11225, 10895}, {11214, 10896},
+    {11200, 10923}, {11159, 10925}, {11182, 10927}, {11183, 10928}, {286, 10929}, {11146, 10931}, {11220, 10933}, {11245, 10934},
+    {11220, 10935}, {11188, 10936}, {11242, 10937}, {11190, 10938}, {11149, 10939}, {11215, 10940}, {701, 10941}, {11139, 10942},
+    {11194, 10943}, {11209, 10946}, {11217, 10948}, {11199, 10949}, {11189, 10950}, {1283, 10951}, {11201, 10953}, {11168, 10954},
+    {11174, 10955}, {11185, 10956}, {11180, 10972}, {11260, 10958}, {11177, 10960}, {11250, 10961}, {11209, 10962}, {11157, 10963},
+    {11249, 10965}, {11183, 10967}, {11213, 10968}, {487, 10969}, {11183, 10971}, {11177, 10973}, {11216, 10975}, {11189, 10976},
+    {11190, 10977}, {11196, 10978}, {1127, 10979}, {11163, 10980}, {11164, 10981}, {11222, 10983}, {11173, 10984}, {11224, 10985},
+    {11142, 10986}, {11232, 10987}, {11199, 10988}, {11186, 10989}, {11229, 10990}, {11176, 10991}, {11180, 10992}, {11232, 10994},
+    {11140, 10995}, {11150, 10997}, {11142, 10998}, {11236, 10999}, {11157, 11000}, {601, 11001}, {508, 11002}, {11142, 11003},
+    {11191, 11004}, {11241, 11005}, {11150, 11006}, {891, 11007}, {11160, 11008}, {330, 11009}, {11244, 11010}, {11148, 11011},
+    {11196, 10947}, {11164, 11012}, {11150, 11013}, {11139, 11014}, {11211, 11018}, {11181, 11020}, {11209, 11021}, {11165, 11022},
+    {11140, 11023}, {11140, 11024}, {11194, 11025}, {11067, 11026}, {11166, 11028}, {11163, 11029}, {11186, 11031}, {11151, 11032},
+    {11164, 11033}, {11148, 11034}, {11263, 11035}, {1119, 11036}, {11322, 11038}, {11265, 11039}, {11266, 11040}, {11366, 11041},
+    {591, 11042}, {11369, 11043}, {935, 11044}, {11269, 11045}, {450, 11046}, {11373, 11047}, {11271, 11048}, {11369, 11049},
+    {11362, 11050}, {11312, 11051}, {11275, 11052}, {11365, 11054}, {11368, 11055}, {11375, 11056}, {11344, 11057}, {1047, 11059},
+    {11306, 11060}, {11281, 11061}, {11341, 11062}, {11367, 11063}, {11377, 11064}, {11285, 11065}, {1183, 11066}, {1117, 11067},
+    {11286, 11069}, {11363, 11070}, {11389, 11071}, {11334, 11072}, {801, 11073}, {11384, 11074}, {1126, 11075}, {11291, 11076},
+    {11375, 11077}, {11293, 11079}, {1038, 11080}, {11387, 11081}, {1304, 11136}, {11382, 11237}, {11349, 11082}, {11, 11083},
+    {11349, 11084}, {503, 11086}, {11342, 11087}, {11289, 11088}, {11334, 11089}, {11332, 11090}, {11302, 11091}, {11331, 11092},
+    {11304, 11093}, {1239, 11094}, {11328, 11095}, {11306, 11096}, {11328, 11097}, {903, 11098}, {11328, 11100}, {11340, 11101},
+    {197, 11102}, {11343, 11103}, {11285, 11104}, {11334, 11105}, {11346, 11107}, {11329, 11108}, {614, 11109}, {11359, 11110},
+    {803, 11111}, {11366, 11112}, {11317, 11113}, {11276, 11114}, {11347, 11115}, {367, 11116}, {11345, 11117}, {11352, 11118},
+    {966, 11119}, {11264, 11120}, {11346, 11121}, {11357, 11122}, {114, 11123}, {11210, 10947}, {11271, 11124}, {11268, 11127},
+    {11371, 11128}, {1089, 11129}, {11295, 11130}, {11387, 11132}, {1212, 11134}, {11293, 11135}, {11306, 11137}, {11390, 11138},
+    {11391, 11139}, {11334, 11140}, {11284, 11141}, {11336, 11142}, {11322, 11143}, {11327, 11144}, {11310, 11145}, {11309, 11146},
+    {11488, 11147}, {11297, 11148}, {11381, 11149}, {11299, 11150}, {11325, 11151}, {11324, 11152}, {11314, 11153}, {1170, 11154},
+    {11348, 11156}, {357, 11157}, {106, 11158}, {11375, 11159}, {11319, 11161}, {574, 11163}, {11373, 11165}, {129, 11166},
+    {11323, 11167}, {11363, 11168}, {11354, 11169}, {540, 11170}, {11311, 11171}, {11311, 11172}, {11311, 11173}, {11325, 11174},
+    {11359, 11176}, {558, 11177}, {11283, 11178}, {11286, 11179}, {11325, 11180}, {332, 11181}, {831, 11184}, {11287, 11185},
+    {11293, 11186}, {11264, 11187}, {11271, 11189}, {179, 11191}, {11357, 11192}, {127, 11193}, {11346, 11195}, {11293, 11197},
+    {11278, 11198}, {11295, 11200}, {11273, 11202}, {11373, 11203}, {11266, 11204}, {11265, 11205}, {36, 11206}, {11338, 11207},
+    {1034, 11208}, {11295, 11210}, {1209, 11211}, {11309, 11212}, {11295, 11214}, {11287, 11215}, {11343, 11217}, {11382, 11218},
+    {11294, 11219}, {11293, 11220}, {11285, 11221}, {11291, 11223}, {11294, 11225}, {1195, 11226}, {11388, 11227}, {11335, 11228},
+    {11282, 11230}, {11333, 11231}, {11392, 11233}, {11490, 11234}, {11448, 11235}, {11395, 11238}, {11396, 11239}, {11488, 11240},
+    {11471, 11242}, {11399, 11243}, {11457, 11245}, {11517, 11246}, {11402, 11247}, {11403, 11248}, {894, 11249}, {11491, 11250},
+    {152, 11251}, {11447, 11252}, {11499, 11253}, {11489, 11254}, {11497, 11255}, {11519, 11256}, {11432, 11257}, {11411, 11258},
+    {11512, 11259}, {11508, 11260}, {11506, 11261}, {11491, 11262}, {776, 11264}, {11416, 11267}, {11499, 11268}, {11418, 11270},
+    {11518, 11272}, {11420, 11273}, {215, 11274}, {11516, 11276}, {11428, 11277}, {11508, 11278}, {11471, 11279}, {518, 11280},
+    {11473, 11282}, {11463, 11283}, {11461, 11284}, {11457, 11287}, {11456, 11288}, {11487, 11289}, {11467, 11290}, {11432, 11292},
+    {11433, 11294}, {11458, 11295}, {11409, 11296}, {11456, 11297}, {11506, 11298}, {1244, 11299}, {11467, 11300}, {11464, 11301},
+    {11440, 11303}, {11458, 11305}, {11462, 11307}, {11401, 11308}, {11473, 11309}, {11445, 11310}, {850, 11311}, {11480, 11312},
+    {11478, 11313}, {11481, 11314}, {11479, 11315}, {11466, 11316}, {1240, 11318}, {11451, 11319}, {11472, 11320}, {11453, 11321},
+    {105, 11322}, {11396, 11323}, {11455, 11324}, {764, 11325}, {1072, 11326}, {11442, 11327}, {11442, 11328}, {1207, 11329},
+    {11441, 11330}, {11436, 11331}, {1096, 11332}, {606, 11333}, {11441, 11335}, {11461, 11337}, {11434, 11338}, {11430, 11339},
+    {11437, 11340}, {11434, 11341}, {11466, 11342}, {657, 11343}, {11434, 11344}, {11426, 11345}, {11454, 11346}, {11435, 11347},
+    {62, 11349}, {11428, 11350}, {886, 11351}, {11498, 11352}, {1032, 11353}, {11429, 11355}, {11474, 11356}, {11497, 11357},
+    {11426, 11358}, {11449, 11360}, {11443, 11361}, {11454, 11362}, {11490, 11363}, {11434, 11364}, {11455, 11365}, {11447, 11366},
+    {1185, 11367}, {1248, 11368}, {11395, 11369}, {11485, 11370}, {11451, 11371}, {11435, 11372}, {11455, 11374}, {11405, 11375},
+    {128, 11376}, {11403, 11377}, {11418, 11378}, {11492, 11379}, {11487, 11380}, {1259, 11381}, {11399, 11383}, {11401, 11384},
+    {11398, 11385}, {11405, 11386}, {11423, 11387}, {238, 11389}, {11406, 11390}, {256, 11391}, {11500, 11393}, {1231, 11394},
+    {11423, 11397}, {11394, 11398}, {11395, 11400}, {11394, 11401}, {11397, 11404}, {220, 11405}, {11421, 11406}, {11415, 11407},
+    {11418, 11408}, {11420, 11409}, {519, 11410}, {11416, 11412}, {11411, 11413}, {11458, 11414}, {11402, 11415}, {11429, 11417},
+    {11515, 11419}, {11413, 11421}, {251, 11422}, {11517, 11423}, {11419, 11424}, {11422, 11425}, {11630, 11426}, {11631, 11427},
+    {11522, 11428}, {11577, 11429}, {11582, 11430}, {11583, 11431}, {11636, 11434}, {784, 11435}, {11620, 11436}, {11642, 11437},
+    {11645, 11438}, {11631, 11439}, {11631, 11441}, {11644, 11442}, {61, 11443}, {11533, 11444}, {11572, 11446}, {11600, 11447},
+    {11636, 11448}, {11618, 11449}, {11632, 11450}, {11561, 11452}, {599, 11454}, {11645, 11456}, {11636, 11457}, {11639, 11458},
+    {11646, 11459}, {11632, 11460}, {11639, 11462}, {11635, 11463}, {11553, 11464}, {11628, 11465}, {11641, 11467}, {11629, 11468},
+    {11551, 11469}, {11546, 11470}, {11598, 11471}, {1039, 11472}, {11596, 11473}, {858, 11475}, {11601, 11476}, {11613, 11477},
+    {11642, 11478}, {11585, 11479}, {905, 11480}, {11559, 11481}, {11560, 11482}, {11561, 11483}, {11595, 11484}, {11588, 11486},
+    {11589, 11487}, {11615, 11488}, {11633, 11489}, {11594, 11490}, {11605, 11491}, {139, 11493}, {11569, 11494}, {11622, 11495},
+    {11584, 11496}, {11534, 11497}, {11609, 11498}, {11574, 11499}, {11587, 11501}, {11606, 11502}, {11607, 11503}, {11615, 11504},
+    {11620, 11505}, {11526, 11506}, {11603, 11507}, {11582, 11508}, {11610, 11509}, {11571, 11510}, {11643, 11511}, {616, 11512},
+    {11586, 11513}, {11569, 11514}, {11555, 11516}, {11647, 11518}, {11555, 11519}, {11562, 11520}, {11565, 11521}, {399, 11523},
+    {728, 11524}, {795, 11525}, {11552, 11526}, {11561, 11527}, {11562, 11528}, {11557, 11529}, {11578, 11530}, {11636, 11531},
+    {11536, 11532}, {945, 11534}, {11573, 11535}, {11627, 11536}, {11602, 11537}, {11578, 11538}, {218, 11539}, {11579, 11540},
+    {11569, 11541}, {11570, 11542}, {11556, 11543}, {11531, 11544}, {11609, 11545}, {11583, 11546}, {217, 11547}, {11617, 11548},
+    {11622, 11549}, {11613, 11550}, {878, 11552}, {11568, 11553}, {11621, 11554}, {11616, 11555}, {11525, 11556}, {11531, 11557},
+    {11537, 11558}, {11530, 11562}, {11534, 11563}, {11528, 11564}, {11526, 11565}, {11521, 11566}, {11625, 11567}, {11573, 11568},
+    {11545, 11570}, {11628, 11571}, {324, 11572}, {11534, 11573}, {11548, 11575}, {11548, 11576}, {11523, 11577}, {11595, 11578},
+    {11539, 11579}, {273, 11580}, {11520, 11581}, {11636, 11583}, {11637, 11584}, {495, 11585}, {11543, 11587}, {11639, 11588},
+    {1316, 11589}, {11586, 11590}, {11549, 11591}, {11557, 11592}, {11585, 11593}, {11590, 11594}, {11546, 11595}, {11536, 11596},
+    {11531, 11597}, {1245, 11598}, {11697, 11599}, {11763, 11600}, {533, 11601}, {11705, 11603}, {11759, 11604}, {11698, 11605},
+    {11699, 11606}, {11658, 11607}, {11749, 11608}, {11702, 11610}, {951, 11611}, {713, 11612}, {11744, 11614}, {370, 11615},
+    {11662, 11617}, {11755, 11618}, {11765, 11619}, {11665, 11620}, {11666, 11621}, {11775, 11622}, {11763, 11623}, {11773, 11624},
+    {11721, 11626}, {11762, 11627}, {11693, 11626}, {11676, 11629}, {11683, 11626}, {11682, 11626}, {11768, 11630}, {11680, 11626},
+    {11678, 11631}, {11679, 11632}, {1049, 11633}, {11716, 11634}, {11681, 11635}, {11719, 11638}, {705, 11640}, {11727, 11641},
+    {11740, 11642}, {3, 11643}, {1311, 11644}, {11712, 11645}, {11722, 11646}, {11768, 11647}, {11767, 11648}, {11689, 11650},
+    {11690, 11653}, {11691, 11652}, {11692, 11655}, {11737, 11649}, {266, 11651}, {11741, 11654}, {344, 11656}, {790, 11657},
+    {11736, 11659}, {400, 11660}, {11742, 11661}, {11732, 11663}, {11718, 11664}, {11756, 11667}, {11729, 11668}, {11729, 11669},
+    {11652, 11670}, {1099, 11671}, {224, 11672}, {31, 11673}, {1156, 11674}, {11736, 11675}, {11650, 11677}, {11728, 11680},
+    {11726, 11682}, {11748, 11683}, {11737, 11684}, {11722, 11685}, {11745, 11686}, {11728, 11687}, {11770, 11688}, {11699, 11693},
+    {11714, 11694}, {11680, 11695}, {11774, 11696}, {11684, 11697}, {11688, 11698}, {11694, 11699}, {11711, 11700}, {11708, 11701},
+    {11722, 11702}, {11698, 11703}, {953, 11704}, {11684, 11705}, {11725, 11706}, {11680, 11707}, {11691, 11708}, {11684, 11709},
+    {11704, 11710}, {11696, 11711}, {589, 11712}, {11753, 11713}, {11659, 11715}, {1301, 11716}, {11697, 11717}, {11699, 11718},
+    {11711, 11719}, {11692, 11720}, {11701, 11721}, {11738, 11723}, {11666, 11724}, {11651, 11726}, {11705, 11727}, {11649, 11728},
+    {11703, 11729}, {11653, 11730}, {126, 11731}, {11666, 11732}, {11664, 11733}, {11737, 11734}, {11666, 11735}, {11706, 11736},
+    {11705, 11737}, {11659, 11739}, {11649, 11740}, {11753, 11741}, {11663, 11742}, {11677, 11743}, {11674, 11744}, {11660, 11745},
+    {11648, 11746}, {198, 11747}, {11677, 11748}, {11669, 11749}, {11668, 11750}, {11676, 11751}, {11668, 11752}, {11648, 11754},
+    {11655, 11755}, {11652, 11756}, {11667, 11757}, {11687, 11758}, {11664, 11759}, {11662, 11760}, {11663, 11761}, {11663, 11762},
+    {11675, 11763}, {11677, 11764}, {11670, 11765}, {11881, 11766}, {11835, 11767}, {11883, 11768}, {11874, 11769}, {11879, 11770},
+    {11878, 11771}, {11782, 11772}, {11881, 11773}, {11876, 11774}, {11880, 11775}, {11883, 11776}, {5, 11777}, {11884, 11778},
+    {11859, 11779}, {11873, 11780}, {11874, 11781}, {11882, 11783}, {11890, 11784}, {11854, 11785}, {11853, 11786}, {11873, 11787},
+    {11893, 11788}, {11895, 11789}, {11892, 11790}, {11876, 11791}, {11882, 11792}, {11896, 11793}, {11899, 11794}, {11809, 11795},
+    {11814, 11796}, {11887, 11797}, {11884, 11798}, {11807, 11799}, {11808, 11800}, {11803, 11801}, {11800, 11802}, {677, 11803},
+    {528, 11804}, {11811, 11805}, {11812, 11806}, {996, 11809}, {745, 11810}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+    {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1}, {0, -1},
+};
+TURBO_DLL extern const size_t EMOJI_ALIAS_NAMES_EN_TRIE_SIZE = 12032;
+
+}  // namespace libtext
@@ -0,0 +1,147 @@
+#!/usr/bin/python
+"""Generate the static emoji double arrays used by EmojiFilter.
+
+Usage: <path_to_libtext>/libtext/normalize/generate_emoji_trie.py
+
+The tries are generated from emoji_unicode_codes_en.cc and
+emoji_unicode_alias_codes_en.cc and written to emoji_trie_data.cc. The
+layout is the one of cedar::da<int> (see libtext/common/double_array.h),
+the value of every key is its row in the source table.
+"""
+
+from os import path
+import re
+
+
+# Helper functions
+def file_header_lines():
+  return [
+      "GENERATED! DO NOT MANUALLY EDIT THIS FILE.", "",
+      "(1) Edit libtext/normalize/emoji_unicode_codes_en.cc or",
+      "    libtext/normalize/emoji_unicode_alias_codes_en.cc.",
+      "(2) Run `python <path_to_libtext>/libtext/normalize/"
+      "generate_emoji_trie.py`."
+  ]
+
+
+def relative_filename(filename):
+  return path.join(path.dirname(path.abspath(__file__)), filename)
+
+
+def decode_c_string(s):
+  s = re.sub(r"\\U([0-9a-fA-F]{8})", lambda m: chr(int(m.group(1), 16)), s)
+  s = re.sub(r"\\u([0-9a-fA-F]{4})", lambda m: chr(int(m.group(1), 16)), s)
+  return s.replace("\\\"", "\"").replace("\\\\", "\\")
+
+
+def load_table(filename):
+  """Returns the [name, code] rows of an emoji table as utf8 bytes."""
+  with open(relative_filename(filename), encoding="utf-8") as f:
+    src = f.read()
+  body = src[src.index("= {") + 3:src.rindex("};")]
+  strings = [
+      decode_c_string(s).encode("utf-8")
+      for s in re.findall(r'"((?:[^"\\]|\\.)*)"', body)
+  ]
+  return list(zip(strings[0::2], strings[1::2]))
+
+
+class DoubleArray(object):
+  """Builds a cedar::da<int> compatible array of (base, check) units."""
+
+  def __init__(self):
+    self.base = []
+    self.check = []
+    self.first_free = 1
+
+  def _grow(self, pos):
+    while len(self.base) <= pos:
+      self.base.extend([0] * 256)
+      self.check.extend([-1] * 256)
+
+  def _is_free(self, pos):
+    self._grow(pos)
+    return pos != 0 and self.check[pos] < 0
+
+  def _find_base(self, labels):
+    pos = self.first_free
+    while True:
+      if self._is_free(pos):
+        base = pos ^ labels[0]
+        if all(self._is_free(base ^ l) for l in labels):
+          return base
+      pos += 1
+
+  def build(self, keys):
+    trie = {}
+    for key, value in keys:
+      node = trie
+      for c in key:
+        node = node.setdefault(c, {})
+      node.setdefault(None, value)
+    self._grow(0)
+    queue = [(trie, 0)]
+    while queue:
+      node, index = queue.pop(0)
+      labels = sorted(0 if c is None else c for c in node)
+      base = self._find_base(labels)
+      self.base[index] = base
+      for l in labels:
+        self.check[base ^ l] = index
+      while not self._is_free(self.first_free):
+        self.first_free += 1
+      for c, child in sorted(node.items(), key=lambda x: x[0] or 0):
+        if c is None:
+          self.base[base] = child
+        else:
+          queue.append((child, base ^ c))
+    return self
+
+
+def unique_keys(rows, column):
+  seen = {}
+  for i, row in enumerate(rows):
+    seen.setdefault(row[column], i)
+  return sorted(seen.items())
+
+
+def format_array(name, da):
+  lines = [
+      "TURBO_DLL extern const DoubleArrayUnit %s[] = {" % name,
+  ]
+  units = ["{%d, %d}," % unit for unit in zip(da.base, da.check)]
+  for i in range(0, len(units), 8):
+    lines.append("    " + " ".join(units[i:i + 8]))
+  lines.append("};")
+  lines.append("TURBO_DLL extern const size_t %s_SIZE = %d;" %
+               (name, len(units)))
+  lines.append("")
+  return lines
+
+
+def main():
+  emoji = load_table("emoji_unicode_codes_en.cc")
+  alias = load_table("emoji_unicode_alias_codes_en.cc")
+  tries = [
+      ("EMOJI_CODES_EN_TRIE", unique_keys(emoji, 1)),
+      ("EMOJI_NAMES_EN_TRIE", unique_keys(emoji, 0)),
+      ("EMOJI_ALIAS_NAMES_EN_TRIE", unique_keys(alias, 0)),
+  ]
+  lines = ["// " + line if line else "//" for line in file_header_lines()]
+  lines += [
+      "",
+      "#include \"libtext/common/double_array.h\"",
+      "#include \"turbo/platform/port.h\"",
+      "",
+      "namespace libtext {",
+      "",
+  ]
+  for name, keys in tries:
+    lines += format_array(name, DoubleArray().build(keys))
+  lines += ["}  // namespace libtext", ""]
+  with open(relative_filename("emoji_trie_data.cc"), "w") as f:
+    f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,108 @@
+#!/usr/bin/python
+"""Generate the NFKC mapping tables used by TextNormalizer.
+
+Usage: <path_to_libtext>/libtext/normalize/generate_nfkc_table.py
+
+The tables are computed with the unicodedata module of the running Python
+and written to nfkc_table_data.cc:
+
+  NFKC_MAPPINGS      every code point NFKC changes, with its NFKC form
+  NFKC_COMPOSITIONS  kana followed by a (half-width) voiced sound mark
+                     that NFKC composes into one character
+"""
+
+from os import path
+import unicodedata
+
+VOICED_MARKS = [0x3099, 0x309a, 0xff9e, 0xff9f]
+KANA_RANGES = [(0x3040, 0x30ff), (0xff65, 0xff9d)]
+
+
+# Helper functions
+def file_header_lines():
+  return [
+      "GENERATED! DO NOT MANUALLY EDIT THIS FILE.", "",
+      "Unicode %s." % unicodedata.unidata_version, "",
+      "Run `python <path_to_libtext>/libtext/normalize/"
+      "generate_nfkc_table.py`."
+  ]
+
+
+def relative_filename(filename):
+  return path.join(path.dirname(path.abspath(__file__)), filename)
+
+
+def c_string(s):
+  out = []
+  for c in s:
+    if c in "\\\"":
+      out.append("\\" + c)
+    elif 0x20 <= ord(c) < 0x7f:
+      out.append(c)
+    elif ord(c) < 0x10000:
+      out.append("\\u%04x" % ord(c))
+    else:
+      out.append("\\U%08x" % ord(c))
+  return "\"%s\"" % "".join(out)
+
+
+def nfkc_mappings():
+  rows = []
+  for cp in range(0x110000):
+    if 0xd800 <= cp <= 0xdfff:
+      continue
+    c = chr(cp)
+    nfkc = unicodedata.normalize("NFKC", c)
+    if nfkc != c:
+      rows.append((cp, nfkc))
+  return rows
+
+
+def nfkc_compositions():
+  rows = []
+  for lo, hi in KANA_RANGES:
+    for cp in range(lo, hi + 1):
+      for mark in VOICED_MARKS:
+        nfkc = unicodedata.normalize("NFKC", chr(cp) + chr(mark))
+        if len(nfkc) == 1:
+          rows.append((cp, mark, nfkc))
+  return rows
+
+
+def main():
+  mappings = nfkc_mappings()
+  compositions = nfkc_compositions()
+  lines = ["// " + line if line else "//" for line in file_header_lines()]
+  lines += [
+      "",
+      "#include \"libtext/normalize/codepoint_table.h\"",
+      "#include \"turbo/platform/port.h\"",
+      "",
+      "namespace libtext {",
+      "",
+      "TURBO_DLL extern const CodepointMapping NFKC_MAPPINGS[] = {",
+  ]
+  for cp, nfkc in mappings:
+    lines.append("    {0x%x, %s}," % (cp, c_string(nfkc)))
+  lines += [
+      "};",
+      "TURBO_DLL extern const size_t NFKC_MAPPINGS_SIZE = %d;" % len(mappings),
+      "",
+      "TURBO_DLL extern const CodepointPairMapping NFKC_COMPOSITIONS[] = {",
+  ]
+  for first, second, nfkc in compositions:
+    lines.append("    {0x%x, 0x%x, %s}," % (first, second, c_string(nfkc)))
+  lines += [
+      "};",
+      "TURBO_DLL extern const size_t NFKC_COMPOSITIONS_SIZE = %d;" %
+      len(compositions),
+      "",
+      "}  // namespace libtext",
+      "",
+  ]
+  with open(relative_filename("nfkc_table_data.cc"), "w") as f:
+    f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,168 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "libtext/normalize/sensitive_word_filter.h"
+
+#include <atomic>
+#include <map>
+#include <utility>
+
+namespace libtext {
+
+namespace {
+
+TextNormalizer::Options NormalizerOptions(SensitiveWordFilter::Options opt) {
+  TextNormalizer::Options result;
+  result.case_fold = opt.case_fold;
+  result.width_fold = opt.width_fold;
+  return result;
+}
+
+}  // namespace
+
+SensitiveWordFilter::SensitiveWordFilter(Options opt)
+    : opt_(opt), normalizer_(NormalizerOptions(opt)) {
+  Reload({});
+}
+
+SensitiveWordFilter::SensitiveWordFilter(Options opt,
+                                         const std::vector<Term> &terms)
+    : opt_(opt), normalizer_(NormalizerOptions(opt)) {
+  Reload(terms);
+}
+
+void SensitiveWordFilter::Reload(const std::vector<Term> &terms) {
+  auto dict = std::make_shared<Dict>();
+  dict->terms = terms;
+  std::map<turbo::inlined_string, int> dic;
+  turbo::inlined_string folded;
+  for (size_t i = 0; i < terms.size(); ++i) {
+    normalizer_.Normalize(terms[i].word, &folded);
+    if (folded.empty()) {
+      continue;
+    }
+    if (dic.emplace(folded, static_cast<int>(i)).second) {
+      dict->lead_bytes.Insert(static_cast<unsigned char>(folded[0]));
+    }
+  }
+  dict->num_words = dic.size();
+  dict->trie = std::make_unique<PrefixMap>(dic);
+  std::atomic_store(&dict_, std::shared_ptr<const Dict>(std::move(dict)));
+}
+
+std::shared_ptr<const SensitiveWordFilter::Dict>
+SensitiveWordFilter::Load() const {
+  return std::atomic_load(&dict_);
+}
+
+size_t SensitiveWordFilter::size() const { return Load()->num_words; }
+
+template <typename Fn>
+void SensitiveWordFilter::Scan(const Dict &dict, const std::string_view &str,
+                               Fn &&fn) const {
+  if (dict.num_words == 0) {
+    return;
+  }
+  const bool fold = opt_.case_fold || opt_.width_fold;
+  turbo::inlined_string folded;
+  std::vector<uint32_t> offsets;
+  const char *text = str.data();
+  size_t len = str.size();
+  if (fold) {
+    normalizer_.Normalize(str, &folded, &offsets);
+    text = folded.data();
+    len = folded.size();
+  }
+  size_t pos = 0;
+  while (pos < len) {
+    pos += dict.lead_bytes.FindFirst(text + pos, len - pos);
+    if (pos == len) {
+      break;
+    }
+    int term = 0;
+    const size_t n = dict.trie->PrefixSearch(text + pos, len - pos, &term);
+    if (n == 0) {
+      ++pos;
+      continue;
+    }
+    const size_t begin = fold ? offsets[pos] : pos;
+    const size_t end = fold ? offsets[pos + n] : pos + n;
+    if (!fn(begin, end - begin, static_cast<size_t>(term))) {
+      return;
+    }
+    pos += n;
+  }
+}
+
+size_t SensitiveWordFilter::Find(const std::string_view &str,
+                                 std::vector<Match> *matches) const {
+  auto dict = Load();
+  size_t num = 0;
+  Scan(*dict, str, [&](size_t offset, size_t length, size_t term) {
+    matches->push_back(Match{str.substr(offset, length), term});
+    ++num;
+    return true;
+  });
+  return num;
+}
+
+bool SensitiveWordFilter::Contains(const std::string_view &str) const {
+  auto dict = Load();
+  bool found = false;
+  Scan(*dict, str, [&found](size_t, size_t, size_t) {
+    found = true;
+    return false;
+  });
+  return found;
+}
+
+turbo::inlined_string SensitiveWordFilter::Mask(const std::string_view &str,
+                                                bool keep_all) const {
+  auto dict = Load();
+  turbo::inlined_string result;
+  result.reserve(str.size());
+  size_t last = 0;
+  bool matched = false;
+  Scan(*dict, str, [&](size_t offset, size_t length, size_t term) {
+    const bool adjacent = matched && offset == last;
+    result.append(str.data() + last, offset - last);
+    if (keep_all || !adjacent) {
+      const Term &t = dict->terms[term];
+      switch (t.policy) {
+      case Policy::kMaskChars:
+        for (size_t i = 0; i < length; ++i) {
+          // one replacement per UTF8 lead byte
+          if ((static_cast<unsigned char>(str[offset + i]) & 0xc0) != 0x80) {
+            result.append(t.replacement.data(), t.replacement.size());
+          }
+        }
+        break;
+      case Policy::kReplace:
+        result.append(t.replacement.data(), t.replacement.size());
+        break;
+      case Policy::kRemove:
+        break;
+      }
+    }
+    last = offset + length;
+    matched = true;
+    return true;
+  });
+  result.append(str.data() + last, str.size() - last);
+  return result;
+}
+
+} // namespace libtext
@@ -0,0 +1,116 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#ifndef LIBTEXT_NORMALIZE_SENSITIVE_WORD_FILTER_H_
+#define LIBTEXT_NORMALIZE_SENSITIVE_WORD_FILTER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+#include "turbo/strings/string_view.h"
+#include "turbo/strings/inlined_string.h"
+#include "libtext/common/prefix_map.h"
+#include "libtext/common/simd_scan.h"
+#include "libtext/normalize/text_normalizer.h"
+
+namespace libtext {
+
+// Finds and masks the terms of a block list in text. Matching is
+// leftmost-longest over UTF8 in a single pass; each term carries its own
+// replacement. The term list can be reloaded while other threads match.
+class SensitiveWordFilter {
+public:
+  struct Options {
+    bool case_fold;  // match regardless of case, see FoldCase
+    bool width_fold; // match full-width forms as ASCII, see FoldWidth
+
+    Options() : case_fold(false), width_fold(false) {}
+  };
+
+  enum class Policy {
+    kMaskChars, // the replacement once per character of the match
+    kReplace,   // the replacement once for the whole match
+    kRemove,    // drop the match
+  };
+
+  struct Term {
+    std::string word;
+    Policy policy;
+    std::string replacement;
+
+    Term(std::string w, Policy p = Policy::kMaskChars, std::string r = "*")
+        : word(std::move(w)), policy(p), replacement(std::move(r)) {}
+  };
+
+  // A match in the searched text. `span` points into the text, `term` is
+  // the index of the matched term in the list loaded at search time.
+  struct Match {
+    std::string_view span;
+    size_t term;
+  };
+
+  explicit SensitiveWordFilter(Options opt);
+  SensitiveWordFilter(Options opt, const std::vector<Term> &terms);
+  virtual ~SensitiveWordFilter() = default;
+
+  // Replaces the term list. Searches that already started finish on the
+  // old list. Empty words are ignored; of terms that are equal after
+  // folding the first one wins.
+  void Reload(const std::vector<Term> &terms);
+
+  // Number of distinct terms loaded.
+  size_t size() const;
+
+  // Appends the leftmost-longest matches in `str` to `matches`, returns
+  // the number of matches found.
+  size_t Find(const std::string_view &str, std::vector<Match> *matches) const;
+
+  bool Contains(const std::string_view &str) const;
+
+  // Replaces every match according to its term's policy. If `keep_all` is
+  // false, a run of adjacent matches is replaced only by its first one,
+  // like EmojiFilter::Replace.
+  turbo::inlined_string Mask(const std::string_view &str,
+                             bool keep_all = true) const;
+
+private:
+  struct Dict {
+    std::unique_ptr<PrefixMap> trie;
+    std::vector<Term> terms;
+    size_t num_words;
+    // first bytes of the folded terms, the trie is only probed at these
+    ByteSet lead_bytes;
+  };
+
+  // Calls `fn(offset, length, term)` for every match, offsets are bytes of
+  // `str`. Stops as soon as `fn` returns false.
+  template <typename Fn>
+  void Scan(const Dict &dict, const std::string_view &str, Fn &&fn) const;
+
+  std::shared_ptr<const Dict> Load() const;
+
+  Options opt_;
+  // folds the terms and the searched text
+  TextNormalizer normalizer_;
+  std::shared_ptr<const Dict> dict_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_NORMALIZE_SENSITIVE_WORD_FILTER_H_
@@ -0,0 +1,113 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include <gtest/gtest.h>
+#include <libtext/normalize/sensitive_word_filter.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace libtext {
+
+using Policy = SensitiveWordFilter::Policy;
+
+TEST(SensitiveWordFilter, Find) {
+  SensitiveWordFilter filter(SensitiveWordFilter::Options(),
+                             {{"bad"}, {"badly"}, {"\xE5\x9D\x8F"}, {""}});
+  ASSERT_EQ(filter.size(), 3);
+  std::string text("so badly, bad\xE5\x9D\x8F" "bad");
+  std::vector<SensitiveWordFilter::Match> matches;
+  ASSERT_EQ(filter.Find(text, &matches), 4);
+  // leftmost-longest, the spans point into the text
+  ASSERT_EQ(matches[0].span, "badly");
+  ASSERT_EQ(matches[0].span.data(), text.data() + 3);
+  ASSERT_EQ(matches[0].term, 1);
+  ASSERT_EQ(matches[1].span, "bad");
+  ASSERT_EQ(matches[2].span, "\xE5\x9D\x8F");
+  ASSERT_EQ(matches[2].term, 2);
+  ASSERT_EQ(matches[3].span, "bad");
+  ASSERT_TRUE(filter.Contains("a bad day"));
+  ASSERT_FALSE(filter.Contains("a good day"));
+  ASSERT_FALSE(filter.Contains("BAD"));
+}
+
+TEST(SensitiveWordFilter, Mask) {
+  SensitiveWordFilter filter(
+      SensitiveWordFilter::Options(),
+      {{"foo"},
+       {"\xE5\x9D\x8F\xE4\xBA\xBA"},
+       {"bar", Policy::kReplace, "<x>"},
+       {"baz", Policy::kRemove}});
+  ASSERT_EQ(filter.Mask(""), "");
+  ASSERT_EQ(filter.Mask("a foo b"), "a *** b");
+  // one mask per character
+  ASSERT_EQ(filter.Mask("\xE5\x9D\x8F\xE4\xBA\xBA!"), "**!");
+  ASSERT_EQ(filter.Mask("bar-baz-bar"), "<x>--<x>");
+  ASSERT_EQ(filter.Mask("barbarbar"), "<x><x><x>");
+  ASSERT_EQ(filter.Mask("barbarbar bar", false), "<x> <x>");
+  ASSERT_EQ(filter.Mask("nothing here"), "nothing here");
+}
+
+TEST(SensitiveWordFilter, Folding) {
+  SensitiveWordFilter::Options opt;
+  opt.case_fold = true;
+  opt.width_fold = true;
+  SensitiveWordFilter filter(opt, {{"Spam"}, {"\xD0\x9F\xD1\x80"}});
+  // full-width "ＳＰＡＭ" and mixed case match, the span is the original text
+  std::string text("x \xEF\xBC\xB3\xEF\xBC\xB0\xEF\xBC\xA1\xEF\xBC\xAD sPaM");
+  std::vector<SensitiveWordFilter::Match> matches;
+  ASSERT_EQ(filter.Find(text, &matches), 2);
+  ASSERT_EQ(matches[0].span, "\xEF\xBC\xB3\xEF\xBC\xB0\xEF\xBC\xA1\xEF\xBC\xAD");
+  ASSERT_EQ(matches[1].span, "sPaM");
+  ASSERT_EQ(filter.Mask(text), "x **** ****");
+  // Cyrillic
+  ASSERT_TRUE(filter.Contains("\xD0\xBF\xD0\xA0"));
+  // an invalid byte is not folded as if it were a Latin-1 character
+  SensitiveWordFilter latin(opt, {{"\xC3\xA0"}});
+  ASSERT_TRUE(latin.Contains("\xC3\x80"));
+  ASSERT_FALSE(latin.Contains("\xC0"));
+
+  SensitiveWordFilter exact(SensitiveWordFilter::Options(), {{"Spam"}});
+  ASSERT_FALSE(exact.Contains("spam"));
+  ASSERT_TRUE(exact.Contains("Spam"));
+}
+
+TEST(SensitiveWordFilter, Reload) {
+  SensitiveWordFilter filter((SensitiveWordFilter::Options()));
+  ASSERT_EQ(filter.size(), 0);
+  ASSERT_EQ(filter.Mask("foo bar"), "foo bar");
+  filter.Reload({{"foo"}});
+  ASSERT_EQ(filter.Mask("foo bar"), "*** bar");
+
+  int failures = 0;
+  std::string failed;
+  std::thread reader([&filter, &failures, &failed] {
+    for (int i = 0; i < 1000; ++i) {
+      auto masked = filter.Mask("foo bar");
+      if (masked != "*** bar" && masked != "foo ***") {
+        ++failures;
+        failed = masked;
+      }
+    }
+  });
+  for (int i = 0; i < 100; ++i) {
+    filter.Reload({{i % 2 ? "foo" : "bar"}});
+  }
+  reader.join();
+  ASSERT_EQ(0, failures) << failed;
+}
+
+}  // namespace libtext
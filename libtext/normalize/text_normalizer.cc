@@ -0,0 +1,245 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include "libtext/normalize/text_normalizer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include "libtext/normalize/char_fold.h"
+
+namespace libtext {
+
+// declare resource
+extern const CodepointMapping NFKC_MAPPINGS[];
+extern const size_t NFKC_MAPPINGS_SIZE;
+extern const CodepointPairMapping NFKC_COMPOSITIONS[];
+extern const size_t NFKC_COMPOSITIONS_SIZE;
+
+namespace {
+
+// NFKC form of `cp`, or nullptr if NFKC keeps it
+const char *FindNfkc(uint32_t cp) {
+  const CodepointMapping *end = NFKC_MAPPINGS + NFKC_MAPPINGS_SIZE;
+  const CodepointMapping *it = std::lower_bound(
+      NFKC_MAPPINGS, end, cp,
+      [](const CodepointMapping &m, uint32_t c) { return m.cp < c; });
+  return it != end && it->cp == cp ? it->repl : nullptr;
+}
+
+// kana which a following voiced sound mark composes with
+bool IsKana(uint32_t cp) {
+  return (cp >= 0x3040 && cp <= 0x30ff) || (cp >= 0xff65 && cp <= 0xff9d);
+}
+
+// `first` and `second` composed, or nullptr
+const char *FindComposition(uint32_t first, uint32_t second) {
+  const CodepointPairMapping *end = NFKC_COMPOSITIONS + NFKC_COMPOSITIONS_SIZE;
+  const CodepointPairMapping *it = std::lower_bound(
+      NFKC_COMPOSITIONS, end, std::make_pair(first, second),
+      [](const CodepointPairMapping &m, const std::pair<uint32_t, uint32_t> &p) {
+        return m.first < p.first || (m.first == p.first && m.second < p.second);
+      });
+  return it != end && it->first == first && it->second == second ? it->repl
+                                                                 : nullptr;
+}
+
+// Code points any of the stages may change.
+const uint32_t kCandidates[][2] = {
+    {0x0000, 0x042f}, // ASCII, Latin-1, Greek and Cyrillic capitals
+    {0x1680, 0x1680}, {0x2000, 0x205f}, {0x3000, 0x3000}, // white space
+    {0xff01, 0xff5e}, // full-width ASCII
+};
+
+}  // namespace
+
+TextNormalizer::TextNormalizer(Options opt) : opt_(opt) {
+  std::vector<uint32_t> candidates;
+  for (const auto &range : kCandidates) {
+    for (uint32_t cp = range[0]; cp <= range[1]; ++cp) {
+      candidates.push_back(cp);
+    }
+  }
+  if (opt_.nfkc) {
+    for (size_t i = 0; i < NFKC_MAPPINGS_SIZE; ++i) {
+      candidates.push_back(NFKC_MAPPINGS[i].cp);
+    }
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()),
+                     candidates.end());
+  }
+  for (uint32_t b = 0; b < 0x80; ++b) {
+    ascii_[b] = static_cast<char>(b);
+  }
+  std::string repl;
+  for (uint32_t cp : candidates) {
+    repl.clear();
+    if (!Transform(cp, &repl)) {
+      continue;
+    }
+    if (cp < 0x80) {
+      // the stages map ASCII to ASCII
+      ascii_[cp] = repl[0];
+      special_.Insert(static_cast<unsigned char>(cp));
+    } else {
+      table_.Set(cp, repl);
+      char lead[4];
+      EncodeCodePoint(cp, lead);
+      special_.Insert(static_cast<unsigned char>(lead[0]));
+    }
+  }
+  if (opt_.collapse_whitespace) {
+    special_.Insert(' ');
+  }
+  if (opt_.filter_emoji) {
+    emoji_ = std::make_unique<EmojiFilter>(opt_.emoji);
+    for (int b = 0; b < 256; ++b) {
+      if (emoji_->lead_bytes().Contains(static_cast<unsigned char>(b))) {
+        special_.Insert(static_cast<unsigned char>(b));
+      }
+    }
+  }
+}
+
+bool TextNormalizer::Transform(uint32_t cp, std::string *out) const {
+  auto fold = [this](uint32_t c) {
+    if (opt_.width_fold) {
+      c = FoldWidth(c);
+    }
+    if (opt_.case_fold) {
+      c = FoldCase(c);
+    }
+    if (opt_.collapse_whitespace && IsSpace(c)) {
+      c = ' ';
+    }
+    return c;
+  };
+  char buf[4];
+  const char *nfkc = opt_.nfkc ? FindNfkc(cp) : nullptr;
+  if (nfkc == nullptr) {
+    const uint32_t folded = fold(cp);
+    if (folded == cp) {
+      return false;
+    }
+    out->append(buf, EncodeCodePoint(folded, buf));
+    return true;
+  }
+  for (size_t i = 0, len = std::strlen(nfkc); i < len;) {
+    uint32_t c;
+    i += DecodeCodePoint(nfkc + i, len - i, &c);
+    out->append(buf, EncodeCodePoint(fold(c), buf));
+  }
+  return true;
+}
+
+void TextNormalizer::Normalize(const std::string_view &str,
+                               turbo::inlined_string *out,
+                               std::vector<uint32_t> *offsets) const {
+  if (offsets) {
+    Run<true>(str, out, offsets);
+  } else {
+    Run<false>(str, out, nullptr);
+  }
+}
+
+turbo::inlined_string
+TextNormalizer::Normalize(const std::string_view &str) const {
+  turbo::inlined_string result;
+  Run<false>(str, &result, nullptr);
+  return result;
+}
+
+template <bool kOffsets>
+void TextNormalizer::Run(const std::string_view &str,
+                         turbo::inlined_string *out,
+                         std::vector<uint32_t> *offsets) const {
+  const char *ptr = str.data();
+  const size_t len = str.size();
+  out->clear();
+  out->reserve(len);
+  if (kOffsets) {
+    offsets->clear();
+    offsets->reserve(len + 1);
+  }
+  // the last output is a collapsed run of white space
+  bool space = false;
+  size_t i = 0;
+  while (i < len) {
+    const size_t skip = special_.FindFirst(ptr + i, len - i);
+    if (skip > 0) {
+      out->append(ptr + i, skip);
+      if (kOffsets) {
+        for (size_t k = 0; k < skip; ++k) {
+          offsets->push_back(static_cast<uint32_t>(i + k));
+        }
+      }
+      i += skip;
+      space = false;
+      if (i == len) {
+        break;
+      }
+    }
+    if (emoji_) {
+      // a dropped emoji does not end a run of white space
+      const size_t n = emoji_->CheckPos(ptr, len, i);
+      if (n > 0) {
+        i += n;
+        continue;
+      }
+    }
+    const unsigned char b = static_cast<unsigned char>(ptr[i]);
+    size_t n = 1;
+    std::string_view repl;
+    if (b < 0x80) {
+      repl = std::string_view(&ascii_[b], 1);
+    } else {
+      uint32_t cp;
+      n = DecodeCodePoint(ptr + i, len - i, &cp);
+      // invalid bytes decode to themselves and are kept as they are
+      if (n == 1 || !table_.Lookup(cp, &repl)) {
+        repl = std::string_view(ptr + i, n);
+      }
+      if (opt_.nfkc && IsKana(cp) && i + n < len) {
+        uint32_t mark;
+        const size_t m = DecodeCodePoint(ptr + i + n, len - i - n, &mark);
+        const char *composed = FindComposition(cp, mark);
+        if (composed != nullptr) {
+          repl = composed;
+          n += m;
+        }
+      }
+    }
+    if (opt_.collapse_whitespace && repl.size() == 1 && repl[0] == ' ') {
+      if (space) {
+        i += n;
+        continue;
+      }
+      space = true;
+    } else if (!repl.empty()) {
+      space = false;
+    }
+    out->append(repl.data(), repl.size());
+    if (kOffsets) {
+      offsets->insert(offsets->end(), repl.size(), static_cast<uint32_t>(i));
+    }
+    i += n;
+  }
+  if (kOffsets) {
+    offsets->push_back(static_cast<uint32_t>(len));
+  }
+}
+
+}  // namespace libtext
@@ -0,0 +1,94 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#ifndef LIBTEXT_NORMALIZE_TEXT_NORMALIZER_H_
+#define LIBTEXT_NORMALIZE_TEXT_NORMALIZER_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "turbo/strings/string_view.h"
+#include "turbo/strings/inlined_string.h"
+#include "libtext/common/simd_scan.h"
+#include "libtext/normalize/codepoint_table.h"
+#include "libtext/normalize/emoji_filter.h"
+
+namespace libtext {
+
+// Normalizes text before segmentation or matching. The enabled stages run
+// fused in one pass into one output buffer:
+//
+//   emoji     drops emoji, see EmojiFilter; matched on the input text
+//   nfkc      the NFKC form of every code point, and kana followed by a
+//             voiced sound mark composed into one; combining marks are
+//             neither reordered nor composed otherwise
+//   width     full-width ASCII forms and U+3000 to ASCII, see FoldWidth
+//   case      lower-cases, see FoldCase
+//   space     collapses every run of white space to one ' '
+//
+// The per code point stages are composed into one CodepointTable when the
+// normalizer is built, and spans of bytes none of the stages touch are
+// copied in bulk.
+class TextNormalizer {
+public:
+  struct Options {
+    bool nfkc;
+    bool width_fold;
+    bool case_fold;
+    bool collapse_whitespace;
+    bool filter_emoji;
+    EmojiFilter::Options emoji; // emoji sets dropped if filter_emoji
+
+    Options()
+        : nfkc(false), width_fold(false), case_fold(false),
+          collapse_whitespace(false), filter_emoji(false) {}
+  };
+
+  explicit TextNormalizer(Options opt);
+  virtual ~TextNormalizer() = default;
+
+  // Writes the normalized `str` to `out`. If `offsets` is given it gets
+  // one entry per byte of `out`, the offset in `str` of the byte it was
+  // copied from or of the character it was produced from, plus a last
+  // entry `str.size()`. A span [b, e) of `out` whose ends fall on
+  // character boundaries comes from [offsets[b], offsets[e]) of `str`.
+  void Normalize(const std::string_view &str, turbo::inlined_string *out,
+                 std::vector<uint32_t> *offsets = nullptr) const;
+  turbo::inlined_string Normalize(const std::string_view &str) const;
+
+private:
+  template <bool kOffsets>
+  void Run(const std::string_view &str, turbo::inlined_string *out,
+           std::vector<uint32_t> *offsets) const;
+
+  // Applies the code point stages to `cp`. Returns false if they leave it
+  // unchanged, else true and the UTF8 result in `out`.
+  bool Transform(uint32_t cp, std::string *out) const;
+
+  Options opt_;
+  CodepointTable table_;
+  // ASCII is mapped byte to byte
+  char ascii_[128];
+  // bytes that can not be copied as they are: non-ASCII, ASCII the table
+  // changes, white space and the first bytes of emoji
+  ByteSet special_;
+  std::unique_ptr<EmojiFilter> emoji_;
+};
+
+} // namespace libtext
+
+#endif // LIBTEXT_NORMALIZE_TEXT_NORMALIZER_H_
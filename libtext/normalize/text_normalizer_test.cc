@@ -0,0 +1,124 @@
+// Copyright 2023 The Turbo Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+
+#include <gtest/gtest.h>
+#include <libtext/normalize/text_normalizer.h>
+#include <string>
+#include <vector>
+
+namespace libtext {
+
+TEST(TextNormalizer, Identity) {
+  TextNormalizer normalizer((TextNormalizer::Options()));
+  ASSERT_EQ(normalizer.Normalize(""), "");
+  std::string text("Hello  \xEF\xBC\xA1 \xE4\xBD\xA0\xE5\xA5\xBD \U0001f600");
+  ASSERT_EQ(normalizer.Normalize(text), text);
+}
+
+TEST(TextNormalizer, Fold) {
+  TextNormalizer::Options opt;
+  opt.width_fold = true;
+  opt.case_fold = true;
+  TextNormalizer normalizer(opt);
+  // full-width "ＡＢ１" is folded to ASCII and then lower-cased
+  ASSERT_EQ(normalizer.Normalize("X\xEF\xBC\xA1\xEF\xBC\xA2\xEF\xBC\x91y"),
+            "xab1y");
+  // Latin-1, Greek and Cyrillic capitals, CJK is copied as it is
+  ASSERT_EQ(normalizer.Normalize("\xC3\x80\xCE\x91\xD0\x9F\xE4\xBD\xA0"),
+            "\xC3\xA0\xCE\xB1\xD0\xBF\xE4\xBD\xA0");
+  // invalid and truncated bytes are kept as they are
+  ASSERT_EQ(normalizer.Normalize("A\xC0" "B\xEF\xBC"),
+            "a\xC0" "b\xEF\xBC");
+  // white space is left alone, the ideographic space becomes ASCII
+  ASSERT_EQ(normalizer.Normalize("a \t\xE3\x80\x80" "b"), "a \t b");
+}
+
+TEST(TextNormalizer, Nfkc) {
+  TextNormalizer::Options opt;
+  opt.nfkc = true;
+  TextNormalizer normalizer(opt);
+  // full-width digits, circled numbers, ligatures, super scripts
+  ASSERT_EQ(normalizer.Normalize("\uff11\uff12 \u2460\u2461 \ufb01 x\u00b2"),
+            "12 12 fi x2");
+  // half-width katakana, with voiced sound marks composed
+  ASSERT_EQ(normalizer.Normalize("\uff76\uff9e\uff8a\uff9f\uff71"),
+            "\u30ac\u30d1\u30a2");
+  ASSERT_EQ(normalizer.Normalize("\u304b\u3099\uff9e"), "\u304c\u3099");
+  // compatibility ideographs, squared and parenthesized forms
+  ASSERT_EQ(normalizer.Normalize("\uf900\u337b\u3231"),
+            "\u8c48\u5e73\u6210(\u682a)");
+  // clean ASCII and CJK is copied as it is, in spans of any length
+  std::string clean("Hello, \u4f60\u597d\u4e16\u754c! \ud55c\uad6d\uc5b4 "
+                    "0123456789 abcdefghij \u3002\u3001");
+  ASSERT_EQ(normalizer.Normalize(clean), clean);
+  ASSERT_EQ(normalizer.Normalize(clean + "\uff21" + clean), clean + "A" + clean);
+
+  // the later stages apply to the NFKC form
+  opt.case_fold = true;
+  opt.collapse_whitespace = true;
+  ASSERT_EQ(TextNormalizer(opt).Normalize("\u216b\u00a0\u2003 \u2126"),
+            "xii \u03c9");
+}
+
+TEST(TextNormalizer, CollapseWhitespace) {
+  TextNormalizer::Options opt;
+  opt.collapse_whitespace = true;
+  TextNormalizer normalizer(opt);
+  ASSERT_EQ(normalizer.Normalize("a  b\t\n c"), "a b c");
+  ASSERT_EQ(normalizer.Normalize(" a\xC2\xA0\xE3\x80\x80" "b "), " a b ");
+  ASSERT_EQ(normalizer.Normalize("\r\n"), " ");
+  // spans longer than one vector
+  std::string text(20, 'x');
+  ASSERT_EQ(normalizer.Normalize(text + "   " + text), text + " " + text);
+}
+
+TEST(TextNormalizer, FilterEmoji) {
+  TextNormalizer::Options opt;
+  opt.filter_emoji = true;
+  opt.collapse_whitespace = true;
+  opt.case_fold = true;
+  TextNormalizer normalizer(opt);
+  ASSERT_EQ(normalizer.Normalize("Hi \U0001f600 There\U0001f44d\U0001f3fd"),
+            "hi there");
+  // emoji are matched on the input, keycaps start with ASCII
+  ASSERT_EQ(normalizer.Normalize("A 1\U0000fe0f\U000020e3 B 123"), "a b 123");
+
+  TextNormalizer::Options only;
+  only.filter_emoji = true;
+  ASSERT_EQ(TextNormalizer(only).Normalize("a \U0001f600 b"), "a  b");
+}
+
+TEST(TextNormalizer, Offsets) {
+  TextNormalizer::Options opt;
+  opt.width_fold = true;
+  opt.case_fold = true;
+  opt.collapse_whitespace = true;
+  opt.filter_emoji = true;
+  TextNormalizer normalizer(opt);
+  std::string text("\xEF\xBC\xA1  \U0001f600b\xE4\xBD\xA0");
+  turbo::inlined_string out("stale");
+  std::vector<uint32_t> offsets(3, 7);
+  normalizer.Normalize(text, &out, &offsets);
+  ASSERT_EQ(out, "a b\xE4\xBD\xA0");
+  // copied bytes map to themselves, replaced ones to their character
+  ASSERT_EQ(offsets, std::vector<uint32_t>({0, 3, 9, 10, 11, 12, 13}));
+  // the same output without offsets
+  turbo::inlined_string plain;
+  normalizer.Normalize(text, &plain);
+  ASSERT_EQ(plain, out);
+}
+
+}  // namespace libtext